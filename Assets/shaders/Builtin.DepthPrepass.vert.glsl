@@ -0,0 +1,11 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "scene.glsl"
+
+invariant gl_Position;
+
+void main() {
+    Vertex v = load_vertex(gl_VertexIndex);
+    gl_Position = scene_position(v.position);
+}
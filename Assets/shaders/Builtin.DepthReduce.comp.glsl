@@ -0,0 +1,150 @@
+#version 450
+
+// Builds the whole hierarchical-Z pyramid in a single dispatch, in the manner of
+// AMD's single pass downsampler. Every workgroup reduces a 64x64 tile of level 0
+// down to one texel of level 6 in shared memory, and the last workgroup to finish
+// carries level 6 down to the 1x1 top.
+// The sampler does a min reduction, and with reversed-Z the smallest depth is the
+// farthest, so every texel holds the most distant depth under its footprint.
+layout(local_size_x = 256) in;
+
+// mirrors Backend::MaxDepthPyramidLevels, enough for a 4096 pyramid
+const uint MaxLevels = 13;
+
+layout(set = 0, binding = 0) uniform sampler2D depthImage;
+layout(set = 0, binding = 1, r32f) uniform coherent image2D pyramid[MaxLevels];
+// counts the workgroups that are done, the last one resets it for the next frame
+layout(set = 0, binding = 2) coherent buffer Counter {
+    uint finishedGroups;
+};
+
+layout(push_constant) uniform constants {
+    // part of the depth buffer covered by the pyramid, the draw extent
+    vec2 uvScale;
+    uvec2 size;
+    uint levels;
+    uint groupCount;
+} PushConstants;
+
+shared float tile[64 * 64];
+shared bool lastGroup;
+
+float reduce4(float a, float b, float c, float d)
+{
+    return min(min(a, b), min(c, d));
+}
+
+float tile_reduce(uvec2 a, uvec2 b)
+{
+    return reduce4(tile[a.y * 64 + a.x], tile[a.y * 64 + b.x], tile[b.y * 64 + a.x], tile[b.y * 64 + b.x]);
+}
+
+void main()
+{
+    uint t = gl_LocalInvocationIndex;
+    uvec2 group = gl_WorkGroupID.xy;
+    uint levels = PushConstants.levels;
+
+    // 16x16 threads, each owning a 4x4 block of level 0
+    uvec2 local = uvec2(t % 16, t / 16);
+    uvec2 base = group * 64 + local * 4;
+    vec2 texelSize = PushConstants.uvScale / vec2(PushConstants.size);
+
+    float level1[4];
+    for (uint q = 0; q < 4; q++) {
+        uvec2 quad = base + uvec2(q & 1, q >> 1) * 2;
+
+        float d[4];
+        for (uint k = 0; k < 4; k++) {
+            uvec2 pos = quad + uvec2(k & 1, k >> 1);
+            d[k] = textureLod(depthImage, (vec2(pos) + 0.5) * texelSize, 0).x;
+            imageStore(pyramid[0], ivec2(pos), vec4(d[k]));
+        }
+
+        level1[q] = reduce4(d[0], d[1], d[2], d[3]);
+        if (levels > 1) {
+            imageStore(pyramid[1], ivec2(quad / 2), vec4(level1[q]));
+        }
+    }
+
+    float level2 = reduce4(level1[0], level1[1], level1[2], level1[3]);
+    if (levels > 2) {
+        imageStore(pyramid[2], ivec2(group * 16 + local), vec4(level2));
+    }
+    tile[local.y * 64 + local.x] = level2;
+    barrier();
+
+    // levels 3 to 6 stay in shared memory, halving the active threads every step
+    uint size = 16;
+    for (uint level = 3; level <= 6 && level < levels; level++) {
+        size /= 2;
+        bool active = t < size * size;
+        uvec2 p = uvec2(t % size, t / size);
+
+        float v = 0.0;
+        if (active) {
+            v = tile_reduce(p * 2, p * 2 + 1);
+        }
+        barrier();
+
+        if (active) {
+            tile[p.y * 64 + p.x] = v;
+            imageStore(pyramid[level], ivec2(group * size + p), vec4(v));
+        }
+        barrier();
+    }
+
+    if (levels <= 7) {
+        return;
+    }
+
+    // publish this group's level 6 texel before counting the group as done
+    if (t == 0) {
+        memoryBarrierImage();
+        lastGroup = atomicAdd(finishedGroups, 1) == PushConstants.groupCount - 1;
+    }
+    barrier();
+
+    if (!lastGroup) {
+        return;
+    }
+
+    // level 6 is at most 64x64 and fits the tile
+    uvec2 levelSize = max(PushConstants.size >> 6, uvec2(1));
+    for (uint i = t; i < levelSize.x * levelSize.y; i += 256) {
+        uvec2 p = uvec2(i % levelSize.x, i / levelSize.x);
+        tile[p.y * 64 + p.x] = imageLoad(pyramid[6], ivec2(p)).x;
+    }
+    if (t == 0) {
+        finishedGroups = 0;
+    }
+    barrier();
+
+    for (uint level = 7; level < levels; level++) {
+        uvec2 next = max(levelSize >> 1, uvec2(1));
+        uint count = next.x * next.y;
+
+        // up to 32x32 texels, 4 per thread
+        float v[4];
+        for (uint k = 0; k < 4; k++) {
+            uint i = t + k * 256;
+            if (i < count) {
+                uvec2 p = uvec2(i % next.x, i / next.x);
+                v[k] = tile_reduce(min(p * 2, levelSize - 1), min(p * 2 + 1, levelSize - 1));
+            }
+        }
+        barrier();
+
+        for (uint k = 0; k < 4; k++) {
+            uint i = t + k * 256;
+            if (i < count) {
+                uvec2 p = uvec2(i % next.x, i / next.x);
+                tile[p.y * 64 + p.x] = v[k];
+                imageStore(pyramid[level], ivec2(p), vec4(v[k]));
+            }
+        }
+        barrier();
+
+        levelSize = next;
+    }
+}
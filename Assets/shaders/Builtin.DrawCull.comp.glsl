@@ -0,0 +1,199 @@
+#version 450
+#extension GL_KHR_shader_subgroup_arithmetic : require
+
+// Two-phase occlusion culling, see DrawCuller in vk_culling.h.
+// Early phase: draw the objects in the frustum that were visible last frame.
+// Late phase: test every object in the frustum against the depth pyramid built
+// from the early phase, draw the ones that just became visible and remember the
+// result for the next frame.
+layout(local_size_x = 64) in;
+
+// mirrors GPUCullData in vk_culling.h
+layout(set = 0, binding = 0) uniform CullData {
+    mat4 view;
+    float P00, P11;
+    float P22, P32;
+    float znear, zfar;
+    float pyramidWidth, pyramidHeight;
+    uint objectCount;
+    uint occlusionEnabled;
+} cullData;
+
+// mirrors GPUCullObject in vk_culling.h
+struct CullObject {
+    vec4 sphere;
+    uint indexCount;
+    uint firstIndex;
+    uint pad0;
+    uint pad1;
+};
+
+// mirrors VkDrawIndexedIndirectCommand
+struct DrawCommand {
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+layout(set = 0, binding = 1) readonly buffer ObjectBuffer {
+    CullObject objects[];
+};
+
+layout(set = 0, binding = 2) buffer VisibilityBuffer {
+    uint visibility[];
+};
+
+layout(set = 0, binding = 3) writeonly buffer CommandBuffer {
+    DrawCommand commands[];
+};
+
+// every object visible after the late phase
+layout(set = 0, binding = 4) writeonly buffer FinalCommandBuffer {
+    DrawCommand finalCommands[];
+};
+
+// mirrors CullStats in vk_culling.h
+layout(set = 0, binding = 5) buffer StatsBuffer {
+    uint objects;
+    uint frustumCulled;
+    uint occlusionCulled;
+    uint earlyDraws;
+    uint lateDraws;
+} stats;
+
+layout(set = 0, binding = 6) uniform sampler2D depthPyramid;
+
+layout(push_constant) uniform constants {
+    uint late;
+    uint resetVisibility;
+} PushConstants;
+
+// 2D Polyhedral Bounds of a Clipped, Perspective-Projected 3D Sphere. Michael Mara, Morgan McGuire. 2013
+// C is in view space with z the distance in front of the camera. Returns false when
+// the sphere crosses the near plane, aabb is in uv space otherwise
+bool project_sphere(vec3 C, float r, out vec4 aabb)
+{
+    if (C.z < r + cullData.znear) {
+        return false;
+    }
+
+    vec2 cx = -C.xz;
+    vec2 vx = vec2(sqrt(dot(cx, cx) - r * r), r);
+    vec2 minx = mat2(vx.x, vx.y, -vx.y, vx.x) * cx;
+    vec2 maxx = mat2(vx.x, -vx.y, vx.y, vx.x) * cx;
+
+    vec2 cy = -C.yz;
+    vec2 vy = vec2(sqrt(dot(cy, cy) - r * r), r);
+    vec2 miny = mat2(vy.x, vy.y, -vy.y, vy.x) * cy;
+    vec2 maxy = mat2(vy.x, -vy.y, vy.y, vy.x) * cy;
+
+    aabb = vec4(minx.x / minx.y * cullData.P00, miny.x / miny.y * cullData.P11,
+        maxx.x / maxx.y * cullData.P00, maxy.x / maxy.y * cullData.P11);
+    // clip space to uv space, vulkan uv has y down
+    aabb = aabb.xwzy * vec4(0.5f, -0.5f, 0.5f, -0.5f) + vec4(0.5f);
+
+    return true;
+}
+
+bool in_frustum(vec3 center, float radius)
+{
+    // side planes through the eye, |x| * P00 <= z inside
+    bool visible = center.z - abs(center.x) * cullData.P00 > -radius * sqrt(cullData.P00 * cullData.P00 + 1.0);
+    visible = visible && center.z - abs(center.y) * cullData.P11 > -radius * sqrt(cullData.P11 * cullData.P11 + 1.0);
+    visible = visible && center.z + radius > cullData.znear && center.z - radius < cullData.zfar;
+    return visible;
+}
+
+bool occluded(vec3 center, float radius)
+{
+    vec4 aabb;
+    if (!project_sphere(center, radius, aabb)) {
+        return false;
+    }
+
+    // the level where the box covers about 2x2 texels, one min-filtered fetch covers it
+    float width = (aabb.z - aabb.x) * cullData.pyramidWidth;
+    float height = (aabb.w - aabb.y) * cullData.pyramidHeight;
+    float level = floor(log2(max(width, height)));
+
+    float depth = textureLod(depthPyramid, (aabb.xy + aabb.zw) * 0.5, level).x;
+    // reversed-Z, the nearest point of the sphere has the largest depth
+    float depthSphere = cullData.P32 / (center.z - radius) - cullData.P22;
+
+    return depthSphere < depth;
+}
+
+void main()
+{
+    uint objectIndex = gl_GlobalInvocationID.x;
+    bool valid = objectIndex < cullData.objectCount;
+
+    uint frustumCulled = 0;
+    uint occlusionCulled = 0;
+    uint drawn = 0;
+
+    if (valid) {
+        CullObject object = objects[objectIndex];
+
+        vec3 center = (cullData.view * vec4(object.sphere.xyz, 1.0)).xyz;
+        // view space looks down -z
+        center.z = -center.z;
+        float radius = object.sphere.w;
+
+        bool wasVisible = PushConstants.resetVisibility == 0 && visibility[objectIndex] != 0;
+
+        bool visible = in_frustum(center, radius);
+        frustumCulled = visible ? 0 : 1;
+
+        bool draw;
+        if (PushConstants.late == 0) {
+            draw = visible && (wasVisible || cullData.occlusionEnabled == 0);
+        } else {
+            if (visible && cullData.occlusionEnabled != 0 && occluded(center, radius)) {
+                visible = false;
+                occlusionCulled = 1;
+            }
+
+            // the early phase already drew what was visible last frame
+            draw = visible && !wasVisible && cullData.occlusionEnabled != 0;
+            visibility[objectIndex] = visible ? 1 : 0;
+
+            DrawCommand finalCommand;
+            finalCommand.indexCount = object.indexCount;
+            finalCommand.instanceCount = visible ? 1 : 0;
+            finalCommand.firstIndex = object.firstIndex;
+            finalCommand.vertexOffset = 0;
+            finalCommand.firstInstance = 0;
+            finalCommands[objectIndex] = finalCommand;
+        }
+
+        DrawCommand command;
+        command.indexCount = object.indexCount;
+        command.instanceCount = draw ? 1 : 0;
+        command.firstIndex = object.firstIndex;
+        command.vertexOffset = 0;
+        command.firstInstance = 0;
+        commands[objectIndex] = command;
+
+        drawn = draw ? 1 : 0;
+    }
+
+    // one atomic per subgroup instead of one per object
+    uint objectTotal = subgroupAdd(valid ? 1 : 0);
+    uint frustumTotal = subgroupAdd(frustumCulled);
+    uint occlusionTotal = subgroupAdd(occlusionCulled);
+    uint drawnTotal = subgroupAdd(drawn);
+
+    if (subgroupElect()) {
+        if (PushConstants.late == 0) {
+            atomicAdd(stats.earlyDraws, drawnTotal);
+        } else {
+            atomicAdd(stats.objects, objectTotal);
+            atomicAdd(stats.frustumCulled, frustumTotal);
+            atomicAdd(stats.occlusionCulled, occlusionTotal);
+            atomicAdd(stats.lateDraws, drawnTotal);
+        }
+    }
+}
@@ -0,0 +1,194 @@
+#version 450
+#extension GL_EXT_buffer_reference : require
+
+// Light assignment of ClusteredLighting, see vk_lighting.h.
+// One workgroup per cluster: the cluster's view space bounds come from its screen
+// tile and depth slice, every thread tests a share of the lights against them, and
+// the hits are written as one compact range of the light index list.
+layout(local_size_x = 64) in;
+
+// mirrors ClusteredLighting::MaxClusterLights
+const uint MaxClusterLights = 256;
+// mirrors ClusteredLighting::MaxLightIndices for the default grid
+const uint MaxLightIndices = 16 * 9 * 24 * 64;
+
+// mirrors GPULight in vk_types.h
+const uint LightSpot = 1;
+
+struct Light {
+    vec3 position;
+    float range;
+    vec3 color;
+    float intensity;
+    vec3 direction;
+    uint type;
+    float spotInnerCos;
+    float spotOuterCos;
+    uint pad[2];
+};
+
+layout(buffer_reference, std430) readonly buffer LightBuffer {
+    Light lights[];
+};
+
+layout(buffer_reference, std430) writeonly buffer ClusterGrid {
+    uvec2 clusters[];
+};
+
+layout(buffer_reference, std430) writeonly buffer LightIndexList {
+    uint indices[];
+};
+
+// mirrors GPUSceneData in vk_types.h
+layout(buffer_reference, std430) readonly buffer SceneData {
+    mat4 view;
+    mat4 proj;
+    mat4 viewproj;
+    vec4 ambientColor;
+    vec4 sunlightDirection;
+    vec4 sunlightColor;
+    LightBuffer lights;
+    ClusterGrid clusterGrid;
+    LightIndexList lightIndices;
+    uint lightCount;
+    uint pad;
+    vec4 clusterParams;
+};
+
+// mirrors LightClusterStats in vk_lighting.h
+layout(buffer_reference, std430) buffer LightStats {
+    uint lights;
+    uint occupiedClusters;
+    // also hands out the ranges of the index list
+    uint lightIndices;
+    uint maxClusterLights;
+    uint droppedLights;
+};
+
+layout(push_constant) uniform constants {
+    SceneData sceneData;
+    LightStats stats;
+    vec2 screenSize;
+    float znear;
+    float zfar;
+} PushConstants;
+
+shared uint hitCount;
+shared uint hits[MaxClusterLights];
+shared uint rangeOffset;
+shared uint rangeCount;
+
+// point on the near plane under a pixel position, in view space
+vec3 near_plane_point(vec2 pixel, mat4 invProj)
+{
+    vec2 ndc = clamp(pixel / PushConstants.screenSize, 0.0, 1.0) * 2.0 - 1.0;
+    // reversed-Z, the near plane is at depth 1
+    vec4 p = invProj * vec4(ndc, 1.0, 1.0);
+    return p.xyz / p.w;
+}
+
+bool sphere_intersects_box(vec3 center, float radius, vec3 boxMin, vec3 boxMax)
+{
+    vec3 closest = clamp(center, boxMin, boxMax);
+    vec3 d = center - closest;
+    return dot(d, d) <= radius * radius;
+}
+
+// cone against the bounding sphere of the cluster, Bart Wronski's test
+bool cone_intersects_sphere(vec3 origin, vec3 direction, float range, float cosAngle, vec3 center, float radius)
+{
+    vec3 v = center - origin;
+    float lenSq = dot(v, v);
+    float v1Len = dot(v, direction);
+    float sinAngle = sqrt(max(1.0 - cosAngle * cosAngle, 0.0));
+    float distanceClosest = cosAngle * sqrt(max(lenSq - v1Len * v1Len, 0.0)) - v1Len * sinAngle;
+
+    bool angleCull = distanceClosest > radius;
+    bool frontCull = v1Len > radius + range;
+    bool backCull = v1Len < -radius;
+    return !(angleCull || frontCull || backCull);
+}
+
+void main()
+{
+    SceneData scene = PushConstants.sceneData;
+    uvec3 cluster = gl_WorkGroupID;
+    uint clusterIndex = cluster.x + cluster.y * gl_NumWorkGroups.x + cluster.z * gl_NumWorkGroups.x * gl_NumWorkGroups.y;
+
+    if (gl_LocalInvocationIndex == 0) {
+        hitCount = 0;
+    }
+
+    // view space bounds, every thread computes them instead of sharing
+    mat4 invProj = inverse(scene.proj);
+    vec2 tileSize = scene.clusterParams.xy;
+    vec3 nearMin = near_plane_point(vec2(cluster.xy) * tileSize, invProj);
+    vec3 nearMax = near_plane_point(vec2(cluster.xy + 1) * tileSize, invProj);
+
+    float depthRange = PushConstants.zfar / PushConstants.znear;
+    float sliceNear = PushConstants.znear * pow(depthRange, float(cluster.z) / gl_NumWorkGroups.z);
+    float sliceFar = PushConstants.znear * pow(depthRange, float(cluster.z + 1) / gl_NumWorkGroups.z);
+
+    // scale the near plane corners along their view rays to both slice depths
+    vec3 p0 = nearMin * (sliceNear / -nearMin.z);
+    vec3 p1 = nearMax * (sliceNear / -nearMax.z);
+    vec3 p2 = nearMin * (sliceFar / -nearMin.z);
+    vec3 p3 = nearMax * (sliceFar / -nearMax.z);
+    vec3 boxMin = min(min(p0, p1), min(p2, p3));
+    vec3 boxMax = max(max(p0, p1), max(p2, p3));
+
+    vec3 boxCenter = (boxMin + boxMax) * 0.5;
+    float boxRadius = length(boxMax - boxCenter);
+
+    barrier();
+
+    uint lightCount = scene.lightCount;
+    for (uint i = gl_LocalInvocationIndex; i < lightCount; i += gl_WorkGroupSize.x) {
+        Light light = scene.lights.lights[i];
+        vec3 center = (scene.view * vec4(light.position, 1.0)).xyz;
+
+        bool visible = sphere_intersects_box(center, light.range, boxMin, boxMax);
+        if (visible && light.type == LightSpot) {
+            vec3 direction = normalize(mat3(scene.view) * light.direction);
+            visible = cone_intersects_sphere(center, direction, light.range, light.spotOuterCos, boxCenter, boxRadius);
+        }
+
+        if (visible) {
+            uint slot = atomicAdd(hitCount, 1);
+            if (slot < MaxClusterLights) {
+                hits[slot] = i;
+            }
+        }
+    }
+
+    barrier();
+
+    if (gl_LocalInvocationIndex == 0) {
+        uint count = min(hitCount, MaxClusterLights);
+        uint offset = count > 0 ? atomicAdd(PushConstants.stats.lightIndices, count) : 0;
+
+        // the index list is full, the cluster goes without
+        uint stored = offset + count <= MaxLightIndices ? count : 0;
+        scene.clusterGrid.clusters[clusterIndex] = uvec2(offset, stored);
+
+        rangeOffset = offset;
+        rangeCount = stored;
+
+        if (stored > 0) {
+            atomicAdd(PushConstants.stats.occupiedClusters, 1);
+            atomicMax(PushConstants.stats.maxClusterLights, stored);
+        }
+        if (hitCount > stored) {
+            atomicAdd(PushConstants.stats.droppedLights, hitCount - stored);
+        }
+        if (clusterIndex == 0) {
+            PushConstants.stats.lights = lightCount;
+        }
+    }
+
+    barrier();
+
+    for (uint i = gl_LocalInvocationIndex; i < rangeCount; i += gl_WorkGroupSize.x) {
+        scene.lightIndices.indices[rangeOffset + i] = hits[i];
+    }
+}
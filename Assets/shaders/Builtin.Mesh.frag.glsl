@@ -0,0 +1,23 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "scene.glsl"
+#include "bindless.glsl"
+#include "lighting.glsl"
+
+layout(location = 0) in vec3 inWorldPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec4 inColor;
+layout(location = 3) in vec2 inUV;
+
+layout(location = 0) out vec4 outFragColor;
+
+void main() {
+    GLTFMaterialData material = bindlessMaterials[MaterialBufferIndex].materials[PushConstants.materialIndex];
+
+    vec4 albedo = inColor * material.colorFactors
+        * sample_bindless(material.colorTexIndex, material.colorSamplerIndex, inUV);
+
+    vec3 color = clustered_lighting(inWorldPosition, normalize(inNormal), albedo.rgb, gl_FragCoord.xy);
+    outFragColor = vec4(color, albedo.a);
+}
@@ -0,0 +1,21 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "scene.glsl"
+
+invariant gl_Position;
+
+layout(location = 0) out vec3 outWorldPosition;
+layout(location = 1) out vec3 outNormal;
+layout(location = 2) out vec4 outColor;
+layout(location = 3) out vec2 outUV;
+
+void main() {
+    Vertex v = load_vertex(gl_VertexIndex);
+    gl_Position = scene_position(v.position);
+
+    outWorldPosition = (PushConstants.render_matrix * vec4(v.position, 1.0f)).xyz;
+    outNormal = mat3(PushConstants.render_matrix) * v.normal;
+    outColor = v.color;
+    outUV = vec2(v.uv_x, v.uv_y);
+}
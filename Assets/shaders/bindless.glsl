@@ -0,0 +1,30 @@
+// Global bindless descriptor set, mirrors BindlessRegistry in vk_bindless.h.
+// Include it from shaders compiled with GL_GOOGLE_include_directive.
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(set = 0, binding = 0) uniform texture2D bindlessTextures[];
+layout(set = 0, binding = 1) uniform sampler bindlessSamplers[];
+
+// mirrors GPUGLTFMaterial in vk_types.h
+struct GLTFMaterialData {
+    vec4 colorFactors;
+    vec4 metal_rough_factors;
+    uint colorTexIndex;
+    uint colorSamplerIndex;
+    uint metalRoughTexIndex;
+    uint metalRoughSamplerIndex;
+    vec4 extra[13];
+};
+
+// the material buffer is the first storage buffer registered with the bindless set
+const uint MaterialBufferIndex = 0;
+
+// storage buffers are aliased with whatever layout the shader needs
+layout(set = 0, binding = 2) readonly buffer MaterialBuffer {
+    GLTFMaterialData materials[];
+} bindlessMaterials[];
+
+vec4 sample_bindless(uint textureIndex, uint samplerIndex, vec2 uv)
+{
+    return texture(sampler2D(bindlessTextures[nonuniformEXT(textureIndex)], bindlessSamplers[nonuniformEXT(samplerIndex)]), uv);
+}
@@ -0,0 +1,88 @@
+// Clustered forward lighting, see ClusteredLighting in vk_lighting.h, and the
+// sun's cascaded shadows, see CascadedShadows in vk_shadows.h.
+// Include it after scene.glsl and bindless.glsl.
+
+// smooth falloff to exactly zero at the light's range
+float light_attenuation(float distance, float range)
+{
+    float ratio = distance / range;
+    float window = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+    return window * window / (distance * distance + 1.0);
+}
+
+uint cluster_index(vec2 fragCoord, float viewDepth)
+{
+    SceneData scene = PushConstants.sceneData;
+    uvec2 tile = uvec2(fragCoord / scene.clusterParams.xy);
+    uint slice = uint(max(log(viewDepth) * scene.clusterParams.z + scene.clusterParams.w, 0.0));
+
+    // mirrors ClusteredLighting::ClusterCountX/Y/Z
+    uvec3 cluster = min(uvec3(tile, slice), uvec3(15, 8, 23));
+    return cluster.x + cluster.y * 16 + cluster.z * 16 * 9;
+}
+
+// fraction of the sun reaching a point, 3x3 PCF in the first cascade that covers it
+float sun_shadow(vec3 worldPosition, float viewDepth)
+{
+    SceneData scene = PushConstants.sceneData;
+
+    uint cascade = 0;
+    while (cascade < scene.shadowCascades && viewDepth > scene.cascadeSplits[cascade]) {
+        cascade++;
+    }
+    if (cascade >= scene.shadowCascades) {
+        return 1.0;
+    }
+
+    vec4 position = scene.shadowMatrices[cascade] * vec4(worldPosition, 1.0);
+    vec3 coord = vec3(position.xy * 0.5 + 0.5, position.z);
+
+    uint textureIndex = scene.shadowTextures[cascade];
+    vec2 texelSize = 1.0 / vec2(textureSize(bindlessTextures[nonuniformEXT(textureIndex)], 0));
+
+    float lit = 0.0;
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            vec3 offsetCoord = vec3(coord.xy + vec2(x, y) * texelSize, coord.z);
+            lit += texture(sampler2DShadow(bindlessTextures[nonuniformEXT(textureIndex)], bindlessSamplers[scene.shadowSampler]), offsetCoord);
+        }
+    }
+    return lit / 9.0;
+}
+
+// diffuse light of the sun and every point and spot light of the fragment's cluster
+vec3 clustered_lighting(vec3 worldPosition, vec3 normal, vec3 albedo, vec2 fragCoord)
+{
+    SceneData scene = PushConstants.sceneData;
+
+    float viewDepth = -(scene.view * vec4(worldPosition, 1.0)).z;
+
+    vec3 sunDirection = normalize(scene.sunlightDirection.xyz);
+    float sun = max(dot(normal, sunDirection), 0.0);
+    if (sun > 0.0) {
+        sun *= sun_shadow(worldPosition, viewDepth);
+    }
+    vec3 light = scene.ambientColor.rgb + scene.sunlightColor.rgb * scene.sunlightDirection.w * sun;
+    uvec2 range = scene.clusterGrid.clusters[cluster_index(fragCoord, viewDepth)];
+
+    for (uint i = 0; i < range.y; i++) {
+        Light l = scene.lights.lights[scene.lightIndices.indices[range.x + i]];
+
+        vec3 toLight = l.position - worldPosition;
+        float distance = length(toLight);
+        if (distance >= l.range) {
+            continue;
+        }
+        vec3 direction = toLight / distance;
+
+        float attenuation = light_attenuation(distance, l.range);
+        if (l.type == LightSpot) {
+            float cosAngle = dot(-direction, normalize(l.direction));
+            attenuation *= smoothstep(l.spotOuterCos, l.spotInnerCos, cosAngle);
+        }
+
+        light += l.color * l.intensity * attenuation * max(dot(normal, direction), 0.0);
+    }
+
+    return albedo * light;
+}
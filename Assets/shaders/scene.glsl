@@ -0,0 +1,137 @@
+// Per-draw inputs of the mesh shaders, mirrors GPUDrawPushConstants, GPUSceneData,
+// GPULight and Vertex in vk_types.h, and QuantizedVertex in MeshOptimizer.h.
+// Include it from shaders compiled with GL_GOOGLE_include_directive.
+#extension GL_EXT_buffer_reference : require
+
+struct Vertex {
+    vec3 position;
+    float uv_x;
+    vec3 normal;
+    float uv_y;
+    vec4 color;
+};
+
+layout(buffer_reference, std430) readonly buffer VertexBuffer {
+    Vertex vertices[];
+};
+
+// mirrors VertexFormat in vk_types.h
+const uint VertexFormatFull = 0;
+const uint VertexFormatQuantized = 1;
+
+struct QuantizedVertex {
+    // 16 bit unorm inside the mesh bounds
+    uint positionXY;
+    uint positionZ;
+    // octahedral, 2x16 bit snorm
+    uint normal;
+    // 2x half
+    uint uv;
+    // 4x8 bit unorm
+    uint color;
+};
+
+layout(buffer_reference, std430) readonly buffer QuantizedVertexBuffer {
+    vec4 positionOffset;
+    vec4 positionScale;
+    QuantizedVertex vertices[];
+};
+
+// mirrors GPULight in vk_types.h
+const uint LightPoint = 0;
+const uint LightSpot = 1;
+
+struct Light {
+    vec3 position;
+    float range;
+    vec3 color;
+    float intensity;
+    vec3 direction;
+    uint type;
+    float spotInnerCos;
+    float spotOuterCos;
+    uint pad[2];
+};
+
+layout(buffer_reference, std430) readonly buffer LightBuffer {
+    Light lights[];
+};
+
+// per cluster: offset into the index list and light count
+layout(buffer_reference, std430) buffer ClusterGrid {
+    uvec2 clusters[];
+};
+
+layout(buffer_reference, std430) buffer LightIndexList {
+    uint indices[];
+};
+
+layout(buffer_reference, std430) readonly buffer SceneData {
+    mat4 view;
+    mat4 proj;
+    mat4 viewproj;
+    vec4 ambientColor;
+    vec4 sunlightDirection; // w for sun power
+    vec4 sunlightColor;
+    LightBuffer lights;
+    ClusterGrid clusterGrid;
+    LightIndexList lightIndices;
+    uint lightCount;
+    uint pad;
+    // pixels per cluster in xy, depth slice scale and bias in zw
+    vec4 clusterParams;
+    mat4 shadowMatrices[4];
+    // view depth where each cascade ends
+    vec4 cascadeSplits;
+    // bindless index of each cascade's layer and the comparison sampler
+    uvec4 shadowTextures;
+    uint shadowSampler;
+    // 0 when shadows are off
+    uint shadowCascades;
+};
+
+layout(push_constant) uniform constants {
+    mat4 render_matrix;
+    VertexBuffer vertexBuffer;
+    SceneData sceneData;
+    uint materialIndex;
+    uint vertexFormat;
+} PushConstants;
+
+vec3 octahedral_decode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+// the draw's vertex in the full layout, whatever the buffer holds
+Vertex load_vertex(uint index)
+{
+    if (PushConstants.vertexFormat == VertexFormatQuantized) {
+        QuantizedVertexBuffer buffer = QuantizedVertexBuffer(PushConstants.vertexBuffer);
+        QuantizedVertex q = buffer.vertices[index];
+
+        vec3 position = vec3(unpackUnorm2x16(q.positionXY), unpackUnorm2x16(q.positionZ).x);
+        vec2 uv = unpackHalf2x16(q.uv);
+
+        Vertex v;
+        v.position = buffer.positionOffset.xyz + position * buffer.positionScale.xyz;
+        v.normal = octahedral_decode(unpackSnorm2x16(q.normal));
+        v.uv_x = uv.x;
+        v.uv_y = uv.y;
+        v.color = unpackUnorm4x8(q.color);
+        return v;
+    }
+
+    return PushConstants.vertexBuffer.vertices[index];
+}
+
+// The depth prepass and the shading pass have to write bit identical depth, so
+// every mesh vertex shader declares gl_Position invariant and computes it with this
+vec4 scene_position(vec3 position)
+{
+    return PushConstants.sceneData.viewproj * PushConstants.render_matrix * vec4(position, 1.0f);
+}
@@ -1,14 +1,169 @@
 #pragma once
-// #include <unordered_map>
-// #include <Renderer/VulkanBackend/VulkanTypes.inl>
-// #include <Defines.h>
-
-// namespace std {
-//     template<> struct hash<Quasar::RendererBackend::Vertex> {
-//         size_t operator()(Quasar::RendererBackend::Vertex const& vertex) const {
-//             return ((hash<glm::vec3>()(vertex.pos) ^
-//                    (hash<glm::vec3>()(vertex.color) << 1)) >> 1) ^
-//                    (hash<glm::vec2>()(vertex.texCoord) << 1);
-//         }
-//     };
-// }
\ No newline at end of file
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Quasar {
+
+// Open addressing hash map with linear probing, for hot lookups over plain keys
+// such as vertex deduplication. Keys and values live in one flat array, so a
+// probe touches a cache line or two instead of chasing buckets. Erasing shifts
+// the following entries back, there are no tombstones.
+//
+// Hash results are mixed before use, so an identity std::hash is fine.
+template<typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>>
+class Hashmap {
+public:
+    Hashmap() = default;
+    explicit Hashmap(size_t expected) { Reserve(expected); }
+
+    // room for count entries without growing
+    void Reserve(size_t count)
+    {
+        size_t capacity = 16;
+        while (capacity * MaxLoadNum < count * MaxLoadDen) {
+            capacity *= 2;
+        }
+        if (capacity > m_slots.size()) {
+            Rehash(capacity);
+        }
+    }
+
+    // the value stored for key, or value inserted under it. The bool tells
+    // whether it was inserted. The pointer is valid until the next insert
+    std::pair<V*, bool> Insert(const K& key, const V& value)
+    {
+        if ((m_size + 1) * MaxLoadDen > m_slots.size() * MaxLoadNum) {
+            Rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+        }
+
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = Mix(Hash{}(key)) & mask;; i = (i + 1) & mask) {
+            Slot& slot = m_slots[i];
+            if (!slot.used) {
+                slot.used = true;
+                slot.key = key;
+                slot.value = value;
+                m_size++;
+                return { &slot.value, true };
+            }
+            if (Equal{}(slot.key, key)) {
+                return { &slot.value, false };
+            }
+        }
+    }
+
+    V* Find(const K& key)
+    {
+        size_t index = FindSlot(key);
+        return index == NotFound ? nullptr : &m_slots[index].value;
+    }
+
+    const V* Find(const K& key) const { return const_cast<Hashmap*>(this)->Find(key); }
+
+    bool Erase(const K& key)
+    {
+        size_t hole = FindSlot(key);
+        if (hole == NotFound) {
+            return false;
+        }
+
+        // move back every entry of the probe run that the hole would cut off from its home slot
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = (hole + 1) & mask; m_slots[i].used; i = (i + 1) & mask) {
+            size_t home = Mix(Hash{}(m_slots[i].key)) & mask;
+            bool reachable = hole <= i ? (home > hole && home <= i) : (home > hole || home <= i);
+            if (!reachable) {
+                m_slots[hole] = std::move(m_slots[i]);
+                hole = i;
+            }
+        }
+
+        m_slots[hole].used = false;
+        m_size--;
+        return true;
+    }
+
+    void Clear()
+    {
+        for (Slot& slot : m_slots) {
+            slot.used = false;
+        }
+        m_size = 0;
+    }
+
+    size_t Size() const { return m_size; }
+    bool Empty() const { return m_size == 0; }
+
+    template<typename F>
+    void ForEach(F&& function) const
+    {
+        for (const Slot& slot : m_slots) {
+            if (slot.used) {
+                function(slot.key, slot.value);
+            }
+        }
+    }
+
+private:
+    // grow past 3/4 full, linear probe runs get long beyond that
+    static constexpr size_t MaxLoadNum = 3;
+    static constexpr size_t MaxLoadDen = 4;
+
+    static constexpr size_t NotFound = ~size_t(0);
+
+    struct Slot {
+        K key;
+        V value;
+        bool used = false;
+    };
+
+    // the finalizer of MurmurHash3, spreads every input bit over the low bits
+    static size_t Mix(size_t h)
+    {
+        uint64_t x = h;
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return size_t(x);
+    }
+
+    size_t FindSlot(const K& key) const
+    {
+        if (m_size == 0) {
+            return NotFound;
+        }
+
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = Mix(Hash{}(key)) & mask;; i = (i + 1) & mask) {
+            if (!m_slots[i].used) {
+                return NotFound;
+            }
+            if (Equal{}(m_slots[i].key, key)) {
+                return i;
+            }
+        }
+    }
+
+    void Rehash(size_t capacity)
+    {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.clear();
+        m_slots.resize(capacity);
+        m_size = 0;
+
+        for (Slot& slot : old) {
+            if (slot.used) {
+                Insert(slot.key, slot.value);
+            }
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;
+};
+
+} // namespace Quasar
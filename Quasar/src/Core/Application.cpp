@@ -6,6 +6,9 @@ namespace Quasar
 {
     Application* Application::s_instance = nullptr;
 
+    // written by the pack-assets target, next to the Assets directory
+    static constexpr const char* AssetPak = "Assets.pak";
+
     Application::Application(AppState state) : m_state{state} {
         assert(!s_instance);
         s_instance = this;
@@ -21,6 +24,18 @@ namespace Quasar
         QS_CORE_INFO("Initializing Input System...")
         if (!Input::Init()) {QS_CORE_ERROR("Event system failed to Initialize")}
 
+        QS_CORE_INFO("Initializing Thread Pool...")
+        if (!ThreadPool::Init()) {QS_CORE_ERROR("Thread pool failed to Initialize")}
+
+        QS_CORE_INFO("Initializing Async IO...")
+        if (!AsyncIO::Init()) {QS_CORE_ERROR("Async IO failed to Initialize")}
+
+        // loose files still win over the pak in debug builds
+        if (Filesystem::Exists(AssetPak)) {
+            QS_CORE_INFO("Mounting %s...", AssetPak)
+            if (!Filesystem::Mount(AssetPak)) {QS_CORE_ERROR("Failed to mount %s", AssetPak)}
+        }
+
         QS_CORE_INFO("Initializing Renderer...")
         if (!QS_RENDERER_API.Init(state.app_name)) {QS_CORE_ERROR("Renderer failed to Initialize")}
 
@@ -64,6 +79,9 @@ namespace Quasar
         QS_EVENT.Unregister(EVENT_CODE_RESIZED, 0, ApplicationOnResized);
 
         QS_RENDERER_API.Shutdown();
+        Filesystem::UnmountAll();
+        QS_ASYNC_IO.Shutdown();
+        QS_THREAD_POOL.Shutdown();
         QS_EVENT.Shutdown();
         Log::Shutdown();
     }
@@ -5,6 +5,9 @@
 #include "Window.h"
 #include "Event.h"
 #include "Input.h"
+#include "ThreadPool.h"
+#include "AsyncIO.h"
+#include "Filesystem.h"
 
 namespace Quasar
 {
@@ -0,0 +1,429 @@
+#include "AsyncIO.h"
+
+#include "Filesystem.h"
+#include "ThreadPool.h"
+
+#if defined(QS_PLATFORM_LINUX) && __has_include(<linux/io_uring.h>)
+#define QS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef QS_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Quasar
+{
+    // bytes asked of the kernel per read, larger requests are read in steps
+    static constexpr u64 MaxReadSize = 1ull << 30;
+
+    struct AsyncIO::Request {
+        std::string filename;
+        u8* destination;
+        u64 offset;
+        u64 size;
+        u64 done = 0;
+        Callback onComplete;
+#ifndef QS_PLATFORM_WINDOWS
+        int fd = -1;
+#endif
+#ifdef QS_IO_URING
+        // the kernel reads it when the entry is submitted
+        iovec vector;
+#endif
+    };
+
+#ifdef QS_IO_URING
+    // the rings shared with the kernel. The submission ring has one producer,
+    // whoever holds m_mutex, the completion ring one consumer, the completion thread
+    struct AsyncIO::Ring {
+        int fd = -1;
+        void* submissionMap = MAP_FAILED;
+        size_t submissionMapSize = 0;
+        void* completionMap = MAP_FAILED;
+        size_t completionMapSize = 0;
+        io_uring_sqe* entries = static_cast<io_uring_sqe*>(MAP_FAILED);
+        size_t entriesSize = 0;
+
+        u32* submissionTail;
+        u32 submissionMask;
+        u32* submissionArray;
+        u32* completionHead;
+        u32* completionTail;
+        u32 completionMask;
+        io_uring_cqe* completions;
+
+        // nullptr when the kernel has no io_uring or doesn't allow it, as in some containers
+        static Ring* Create(u32 depth);
+        // m_mutex held. A null request is the completion thread's signal to exit.
+        // False when the kernel refused the entry, it is taken back off the ring
+        b8 Push(u8 opcode, int file, const iovec* vector, u64 offset, Request* request);
+
+        ~Ring() {
+            if (entries != MAP_FAILED) munmap(entries, entriesSize);
+            if (completionMap != MAP_FAILED && completionMap != submissionMap) munmap(completionMap, completionMapSize);
+            if (submissionMap != MAP_FAILED) munmap(submissionMap, submissionMapSize);
+            if (fd >= 0) close(fd);
+        }
+    };
+
+    static int RingEnter(int fd, u32 submit, u32 waitFor, u32 flags) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, submit, waitFor, flags, nullptr, 0));
+    }
+
+    template<typename T>
+    static T* RingField(void* map, u32 offset) {
+        return reinterpret_cast<T*>(static_cast<u8*>(map) + offset);
+    }
+
+    AsyncIO::Ring* AsyncIO::Ring::Create(u32 depth) {
+        io_uring_params params {};
+        int fd = static_cast<int>(syscall(__NR_io_uring_setup, depth, &params));
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        auto* ring = new Ring();
+        ring->fd = fd;
+        ring->submissionMapSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        ring->completionMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMap) {
+            ring->submissionMapSize = ring->completionMapSize = std::max(ring->submissionMapSize, ring->completionMapSize);
+        }
+
+        ring->submissionMap = mmap(nullptr, ring->submissionMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            fd, IORING_OFF_SQ_RING);
+        ring->completionMap = singleMap ? ring->submissionMap
+            : mmap(nullptr, ring->completionMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        ring->entriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        ring->entries = static_cast<io_uring_sqe*>(mmap(nullptr, ring->entriesSize, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (ring->submissionMap == MAP_FAILED || ring->completionMap == MAP_FAILED || ring->entries == MAP_FAILED) {
+            delete ring;
+            return nullptr;
+        }
+
+        ring->submissionTail = RingField<u32>(ring->submissionMap, params.sq_off.tail);
+        ring->submissionMask = *RingField<u32>(ring->submissionMap, params.sq_off.ring_mask);
+        ring->submissionArray = RingField<u32>(ring->submissionMap, params.sq_off.array);
+        ring->completionHead = RingField<u32>(ring->completionMap, params.cq_off.head);
+        ring->completionTail = RingField<u32>(ring->completionMap, params.cq_off.tail);
+        ring->completionMask = *RingField<u32>(ring->completionMap, params.cq_off.ring_mask);
+        ring->completions = RingField<io_uring_cqe>(ring->completionMap, params.cq_off.cqes);
+        return ring;
+    }
+
+    b8 AsyncIO::Ring::Push(u8 opcode, int file, const iovec* vector, u64 offset, Request* request) {
+        u32 tail = *submissionTail;
+        u32 index = tail & submissionMask;
+
+        io_uring_sqe& entry = entries[index];
+        memset(&entry, 0, sizeof(entry));
+        entry.opcode = opcode;
+        entry.fd = file;
+        entry.addr = reinterpret_cast<u64>(vector);
+        entry.len = vector ? 1 : 0;
+        entry.off = offset;
+        entry.user_data = reinterpret_cast<u64>(request);
+        submissionArray[index] = index;
+
+        // the entry has to be visible before the kernel sees the new tail
+        std::atomic_ref<u32>(*submissionTail).store(tail + 1, std::memory_order_release);
+
+        int result;
+        do {
+            result = RingEnter(fd, 1, 0, 0);
+        } while (result < 0 && (errno == EINTR || errno == EAGAIN));
+        if (result < 0) {
+            // nothing was submitted, so the entry is still ours. Left behind the
+            // tail it would only go out with some later entry, if ever
+            QS_CORE_ERROR("io_uring_enter failed: %s", strerror(errno));
+            std::atomic_ref<u32>(*submissionTail).store(tail, std::memory_order_release);
+            return false;
+        }
+        return true;
+    }
+#else
+    struct AsyncIO::Ring {};
+#endif
+
+    AsyncIO* AsyncIO::s_instance = nullptr;
+
+    AsyncIO::~AsyncIO() {
+        Shutdown();
+    }
+
+    b8 AsyncIO::Init(u32 queueDepth) {
+        assert(!s_instance);
+        s_instance = new AsyncIO();
+        s_instance->m_queueDepth = std::max(queueDepth, 1u);
+
+#ifdef QS_IO_URING
+        s_instance->m_ring = Ring::Create(s_instance->m_queueDepth);
+        if (s_instance->m_ring) {
+            s_instance->m_completionThread = std::thread(&AsyncIO::CompletionLoop, s_instance);
+        }
+#endif
+        QS_CORE_INFO("Async reads through %s", s_instance->m_ring ? "io_uring" : "the thread pool");
+        return true;
+    }
+
+    void AsyncIO::Shutdown() {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idle.wait(lock, [this]() { return m_inFlight == 0; });
+
+#ifdef QS_IO_URING
+            // the completion thread already stopped when the ring failed
+            if (m_ring && !m_ringFailed && !m_ring->Push(IORING_OP_NOP, -1, nullptr, 0, nullptr)) {
+                // it can't be told to exit, so leave it waiting on a ring that
+                // stays open rather than hang here
+                QS_CORE_ERROR("Could not stop the io_uring completion thread, leaking the ring");
+                m_completionThread.detach();
+                m_ring = nullptr;
+            }
+#endif
+        }
+
+        if (m_completionThread.joinable()) {
+            m_completionThread.join();
+        }
+        delete m_ring;
+        m_ring = nullptr;
+    }
+
+    void AsyncIO::Read(const std::string& filename, u64 offset, u64 size, void* destination, Callback&& onComplete) {
+        auto* request = new Request();
+        request->filename = filename;
+        request->destination = static_cast<u8*>(destination);
+        request->offset = offset;
+        request->size = size;
+        request->onComplete = std::move(onComplete);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_inFlight == m_queueDepth) {
+                m_waiting.push_back(request);
+                return;
+            }
+            m_inFlight++;
+        }
+        Start(request);
+    }
+
+    std::future<std::vector<u8>> AsyncIO::ReadFile(const std::string& filename) {
+        auto promise = std::make_shared<std::promise<std::vector<u8>>>();
+        std::future<std::vector<u8>> future = promise->get_future();
+
+        Filesystem::FileInfo info;
+        if (!Filesystem::Stat(filename, info)) {
+            QS_CORE_ERROR("Could not read %s, there is no such file", filename.c_str());
+            promise->set_value({});
+            return future;
+        }
+
+        auto buffer = std::make_shared<std::vector<u8>>(static_cast<size_t>(info.size));
+        Read(filename, 0, info.size, buffer->data(), [filename, promise, buffer](b8 ok, u64 bytesRead) {
+            if (!ok) {
+                QS_CORE_ERROR("Could not read %s", filename.c_str());
+                buffer->clear();
+            }
+            buffer->resize(static_cast<size_t>(std::min<u64>(buffer->size(), bytesRead)));
+            promise->set_value(std::move(*buffer));
+        });
+        return future;
+    }
+
+    void AsyncIO::Start(Request* request) {
+        if (!m_ring || m_ringFailed) {
+            QS_THREAD_POOL.Enqueue([this, request]() { ReadBlocking(request); });
+            return;
+        }
+
+#ifdef QS_IO_URING
+        request->fd = open(request->filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (request->fd < 0) {
+            Complete(request, false);
+            return;
+        }
+        if (request->size == 0) {
+            Complete(request, true);
+            return;
+        }
+        Submit(request);
+#endif
+    }
+
+    void AsyncIO::Submit(Request* request) {
+#ifdef QS_IO_URING
+        request->vector.iov_base = request->destination + request->done;
+        request->vector.iov_len = static_cast<size_t>(std::min(request->size - request->done, MaxReadSize));
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_ringFailed) {
+                if (m_ring->Push(IORING_OP_READV, request->fd, &request->vector, request->offset + request->done, request)) {
+                    m_onRing.insert(request);
+                    return;
+                }
+            }
+        }
+        // the ring failed since the request started, or refused this read
+        Complete(request, false);
+#endif
+    }
+
+    void AsyncIO::CompletionLoop() {
+#ifdef QS_IO_URING
+        Ring& ring = *m_ring;
+        while (true) {
+            // interrupted, or the kernel is short of memory or completion slots for
+            // now. Anything else won't get better by trying again
+            if (RingEnter(ring.fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                QS_CORE_ERROR("io_uring_enter failed, reading on the thread pool from now on: %s", strerror(errno));
+                FailRing();
+                return;
+            }
+
+            u32 head = *ring.completionHead;
+            u32 tail = std::atomic_ref<u32>(*ring.completionTail).load(std::memory_order_acquire);
+            for (; head != tail; head++) {
+                const io_uring_cqe& completion = ring.completions[head & ring.completionMask];
+                auto* request = reinterpret_cast<Request*>(completion.user_data);
+                i32 result = completion.res;
+                // free the slot before the callback, which may queue more reads
+                std::atomic_ref<u32>(*ring.completionHead).store(head + 1, std::memory_order_release);
+
+                if (!request) {
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_onRing.erase(request);
+                }
+                if (result == -EINTR || result == -EAGAIN) {
+                    Submit(request);
+                } else if (result < 0) {
+                    Complete(request, false);
+                } else {
+                    request->done += static_cast<u64>(result);
+                    // 0 is the end of the file
+                    if (result == 0 || request->done == request->size) {
+                        Complete(request, true);
+                    } else {
+                        Submit(request);
+                    }
+                }
+            }
+        }
+#endif
+    }
+
+    void AsyncIO::FailRing() {
+        std::vector<Request*> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_ringFailed = true;
+            pending.assign(m_onRing.begin(), m_onRing.end());
+            m_onRing.clear();
+        }
+        for (Request* request : pending) {
+            Complete(request, false);
+        }
+    }
+
+#ifdef QS_PLATFORM_WINDOWS
+    void AsyncIO::ReadBlocking(Request* request) {
+        HANDLE file = CreateFileA(request->filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            Complete(request, false);
+            return;
+        }
+
+        b8 ok = true;
+        while (request->done < request->size) {
+            // a synchronous handle still takes the offset from an OVERLAPPED
+            u64 offset = request->offset + request->done;
+            OVERLAPPED overlapped {};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD read = 0;
+            DWORD size = static_cast<DWORD>(std::min(request->size - request->done, MaxReadSize));
+            if (!::ReadFile(file, request->destination + request->done, size, &read, &overlapped)) {
+                ok = GetLastError() == ERROR_HANDLE_EOF;
+                break;
+            }
+            if (read == 0) {
+                break;
+            }
+            request->done += read;
+        }
+        CloseHandle(file);
+        Complete(request, ok);
+    }
+#else
+    void AsyncIO::ReadBlocking(Request* request) {
+        request->fd = open(request->filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (request->fd < 0) {
+            Complete(request, false);
+            return;
+        }
+
+        b8 ok = true;
+        while (request->done < request->size) {
+            size_t size = static_cast<size_t>(std::min(request->size - request->done, MaxReadSize));
+            ssize_t read = pread(request->fd, request->destination + request->done, size,
+                static_cast<off_t>(request->offset + request->done));
+            if (read < 0 && errno == EINTR) {
+                continue;
+            }
+            if (read <= 0) {
+                ok = read == 0;
+                break;
+            }
+            request->done += static_cast<u64>(read);
+        }
+        Complete(request, ok);
+    }
+#endif
+
+    void AsyncIO::Complete(Request* request, b8 ok) {
+#ifndef QS_PLATFORM_WINDOWS
+        if (request->fd >= 0) {
+            close(request->fd);
+        }
+#endif
+        if (request->onComplete) {
+            request->onComplete(ok, request->done);
+        }
+        delete request;
+
+        Request* next = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_waiting.empty()) {
+                m_inFlight--;
+            } else {
+                // keeps the slot
+                next = m_waiting.front();
+                m_waiting.pop_front();
+            }
+        }
+
+        if (next) {
+            Start(next);
+        } else {
+            m_idle.notify_all();
+        }
+    }
+}
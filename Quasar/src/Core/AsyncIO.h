@@ -0,0 +1,83 @@
+#pragma once
+
+#include <qspch.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_set>
+
+namespace Quasar
+{
+    // Reads files in the background. On Linux the reads go to the kernel through
+    // io_uring, so any number of them are in flight at once and one completion
+    // thread collects them, no worker sits blocked on the disk. Without io_uring,
+    // or when the kernel won't set a ring up, each read is a blocking pread on
+    // the thread pool instead.
+    //
+    // If io_uring_enter keeps failing, the reads on the ring fail and later ones
+    // go to the thread pool.
+    //
+    // At most queueDepth reads are in flight, the others wait in submission order.
+    // Callbacks run on the completion thread or a pool worker: they should be
+    // short, and hand decoding and the like to the pool.
+    class QS_API AsyncIO {
+    public:
+        // ok is false when the file couldn't be opened or read. bytesRead falls
+        // short of the size asked for when the file ended first
+        using Callback = std::function<void(b8 ok, u64 bytesRead)>;
+
+        ~AsyncIO();
+
+        // after the thread pool, which the fallback runs on
+        static b8 Init(u32 queueDepth = 64);
+        // waits for the reads queued and in flight, callbacks included
+        void Shutdown();
+
+        static AsyncIO& GetInstance() { return *s_instance; }
+
+        // reads size bytes at offset of the file into destination, which has to
+        // stay valid until onComplete has run
+        void Read(const std::string& filename, u64 offset, u64 size, void* destination, Callback&& onComplete);
+
+        // the whole file, empty when it couldn't be read
+        std::future<std::vector<u8>> ReadFile(const std::string& filename);
+
+        QS_INLINE b8 UsesIoUring() const { return m_ring != nullptr && !m_ringFailed; }
+
+    private:
+        struct Request;
+        struct Ring;
+
+        AsyncIO() {};
+        // opens the file and hands the request to the ring or the pool
+        void Start(Request* request);
+        // queues the rest of the request on the ring
+        void Submit(Request* request);
+        void ReadBlocking(Request* request);
+        // runs the callback and starts the next waiting request
+        void Complete(Request* request, b8 ok);
+        void CompletionLoop();
+        // the ring is no use anymore: fails the requests on it and sends later
+        // ones to the pool
+        void FailRing();
+
+        static AsyncIO* s_instance;
+
+        Ring* m_ring = nullptr;
+        std::atomic<b8> m_ringFailed { false };
+        std::thread m_completionThread;
+
+        std::mutex m_mutex;
+        std::condition_variable m_idle;
+        std::deque<Request*> m_waiting;
+        // submitted to the ring and not completed yet
+        std::unordered_set<Request*> m_onRing;
+        u32 m_queueDepth = 0;
+        u32 m_inFlight = 0;
+    };
+
+    #define QS_ASYNC_IO AsyncIO::GetInstance()
+} // namespace Quasar
@@ -1,12 +1,171 @@
 #include "Filesystem.h"
-#include <iostream>
+#include "AsyncIO.h"
+#include "Lz4.h"
+#include "PakFile.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <cstdio>
 #include <fstream>
+#include <shared_mutex>
+
+#include <sys/stat.h>
+#include <sys/types.h>
 
 namespace Quasar {
+// oldest first
+static std::vector<std::shared_ptr<const PakFile>> s_mounts;
+static std::shared_mutex s_mountMutex;
+#ifdef NDEBUG
+static std::atomic<bool> s_looseOverrides = false;
+#else
+static std::atomic<bool> s_looseOverrides = true;
+#endif
+
+#ifdef QS_PLATFORM_WINDOWS
+static bool StatOnDisk(const std::string& filename, Filesystem::FileInfo& info) {
+    struct _stat64 status;
+    if (_stat64(filename.c_str(), &status) != 0 || !(status.st_mode & _S_IFREG)) {
+        return false;
+    }
+    info.size = static_cast<u64>(status.st_size);
+    info.modified = static_cast<i64>(status.st_mtime) * 1000000000ll;
+    return true;
+}
+#else
+static bool StatOnDisk(const std::string& filename, Filesystem::FileInfo& info) {
+    struct stat status;
+    if (stat(filename.c_str(), &status) != 0 || !S_ISREG(status.st_mode)) {
+        return false;
+    }
+    info.size = static_cast<u64>(status.st_size);
+#ifdef QS_PLATFORM_APPLE
+    info.modified = static_cast<i64>(status.st_mtimespec.tv_sec) * 1000000000ll + status.st_mtimespec.tv_nsec;
+#else
+    info.modified = static_cast<i64>(status.st_mtim.tv_sec) * 1000000000ll + status.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+#endif
+
+bool Filesystem::Mount(const std::string& pakFilename) {
+    auto pak = std::make_shared<PakFile>();
+    if (!pak->Open(pakFilename)) {
+        return false;
+    }
+
+    QS_CORE_INFO("Mounted %s, %u files", pakFilename.c_str(), static_cast<u32>(pak->GetEntries().size()));
+    std::unique_lock<std::shared_mutex> lock(s_mountMutex);
+    s_mounts.push_back(std::move(pak));
+    return true;
+}
+
+void Filesystem::UnmountAll() {
+    // files opened from the paks keep theirs mapped
+    std::unique_lock<std::shared_mutex> lock(s_mountMutex);
+    s_mounts.clear();
+}
+
+void Filesystem::SetLooseOverrides(bool enabled) {
+    s_looseOverrides = enabled;
+}
+
+bool Filesystem::GetLooseOverrides() {
+    return s_looseOverrides;
+}
+
+std::shared_ptr<const PakFile> Filesystem::FindPacked(const std::string& filename, const PakEntry*& entry) {
+    std::shared_lock<std::shared_mutex> lock(s_mountMutex);
+    if (s_mounts.empty()) {
+        return nullptr;
+    }
+
+    std::string path = PakNormalizePath(filename);
+    for (auto it = s_mounts.rbegin(); it != s_mounts.rend(); it++) {
+        if ((entry = (*it)->Find(path))) {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+bool Filesystem::Stat(const std::string& filename, FileInfo& info) {
+    bool looseFirst = s_looseOverrides;
+    if (looseFirst && StatOnDisk(filename, info)) {
+        return true;
+    }
+
+    const PakEntry* entry = nullptr;
+    if (std::shared_ptr<const PakFile> pak = FindPacked(filename, entry)) {
+        info.size = entry->size;
+        info.modified = pak->GetModified();
+        return true;
+    }
+    return !looseFirst && StatOnDisk(filename, info);
+}
+
+bool Filesystem::Exists(const std::string& filename) {
+    FileInfo info;
+    return Stat(filename, info);
+}
+
+u64 Filesystem::FileSize(const std::string& filename) {
+    FileInfo info;
+    return Stat(filename, info) ? info.size : 0;
+}
+
+// reads the whole file on disk into buffer with a single fread, resized to
+// what was read since text mode may drop carriage returns
+template<typename Buffer>
+static bool ReadFromDisk(const std::string& filename, u64 size, const char* mode, Buffer& buffer) {
+    FILE* file = std::fopen(filename.c_str(), mode);
+    if (!file) {
+        QS_CORE_ERROR("Could not open %s for reading", filename.c_str());
+        return false;
+    }
+
+    buffer.resize(static_cast<size_t>(size));
+    size_t read = size ? std::fread(buffer.data(), 1, buffer.size(), file) : 0;
+    bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+
+    if (failed) {
+        QS_CORE_ERROR("Could not read %s", filename.c_str());
+        buffer.clear();
+        return false;
+    }
+    buffer.resize(read);
+    return true;
+}
+
+template<typename Buffer>
+static bool ReadInto(const std::string& filename, const char* mode, Buffer& buffer) {
+    Filesystem::FileInfo info;
+    bool looseFirst = Filesystem::GetLooseOverrides();
+    if (looseFirst && StatOnDisk(filename, info)) {
+        return ReadFromDisk(filename, info.size, mode, buffer);
+    }
+
+    const PakEntry* entry = nullptr;
+    if (std::shared_ptr<const PakFile> pak = Filesystem::FindPacked(filename, entry)) {
+        buffer.resize(static_cast<size_t>(entry->size));
+        if (!pak->Decompress(*entry, reinterpret_cast<u8*>(buffer.data()))) {
+            buffer.clear();
+            return false;
+        }
+        return true;
+    }
+
+    if (!looseFirst && StatOnDisk(filename, info)) {
+        return ReadFromDisk(filename, info.size, mode, buffer);
+    }
+    QS_CORE_ERROR("Could not open %s for reading, there is no such file", filename.c_str());
+    return false;
+}
+
 void Filesystem::Write(const std::string& filename, const std::string& data) {
     std::ofstream outfile(filename, std::ios::out | std::ios::trunc);
     if (!outfile) {
-        std::cerr << "Error: Could not open the file for writing." << std::endl;
+        QS_CORE_ERROR("Could not open %s for writing", filename.c_str());
         return;
     }
     outfile << data;
@@ -16,7 +175,7 @@ void Filesystem::Write(const std::string& filename, const std::string& data) {
 void Filesystem::Append(const std::string& filename, const std::string& data) {
     std::ofstream outfile(filename, std::ios::out | std::ios::app);
     if (!outfile) {
-        std::cerr << "Error: Could not open the file for appending." << std::endl;
+        QS_CORE_ERROR("Could not open %s for appending", filename.c_str());
         return;
     }
     outfile << data;
@@ -24,46 +183,65 @@ void Filesystem::Append(const std::string& filename, const std::string& data) {
 }
 
 std::string Filesystem::Read(const std::string& filename) {
-    std::ifstream infile(filename, std::ios::in);
-    if (!infile) {
-        std::cerr << "Error: Could not open the file for reading." << std::endl;
-        return "";
-    }
-    std::string data((std::istreambuf_iterator<char>(infile)), std::istreambuf_iterator<char>());
-    infile.close();
+    std::string data;
+    ReadInto(filename, "r", data);
     return data;
 }
 
 std::vector<char> Filesystem::ReadBinary(const std::string& filename) {
-    std::ifstream infile(filename, std::ios::in | std::ios::binary);
-    if (!infile) {
-        std::cerr << "Error: Could not open the file for reading in binary mode." << std::endl;
-        return {};
-    }
-    infile.seekg(0, std::ios::end);
-    std::streamsize size = infile.tellg();
-    infile.seekg(0, std::ios::beg);
+    std::vector<char> buffer;
+    ReadInto(filename, "rb", buffer);
+    return buffer;
+}
 
-    std::vector<char> buffer(size);
-    if (!infile.read(buffer.data(), size)) {
-        std::cerr << "Error: Could not read the file data." << std::endl;
-        return {};
+std::future<std::vector<u8>> Filesystem::ReadAsync(const std::string& filename) {
+    const PakEntry* entry = nullptr;
+    std::shared_ptr<const PakFile> pak;
+    FileInfo info;
+    if (!(s_looseOverrides && StatOnDisk(filename, info))) {
+        pak = FindPacked(filename, entry);
     }
-    infile.close();
-    return buffer;
+    if (!pak) {
+        return QS_ASYNC_IO.ReadFile(filename);
+    }
+
+    // the stored range straight from the pak file, rather than faulting in the
+    // mapping one page at a time
+    auto promise = std::make_shared<std::promise<std::vector<u8>>>();
+    std::future<std::vector<u8>> future = promise->get_future();
+    auto stored = std::make_shared<std::vector<u8>>(static_cast<size_t>(entry->storedSize));
+
+    QS_ASYNC_IO.Read(pak->GetPath(), entry->offset, entry->storedSize, stored->data(),
+        [pak, entry, promise, stored](b8 ok, u64 bytesRead) {
+            if (!ok || bytesRead != entry->storedSize) {
+                QS_CORE_ERROR("Could not read %s", std::string(pak->GetName(*entry)).c_str());
+                promise->set_value({});
+                return;
+            }
+            if (PakCompression(entry->compression) == PakCompression::None) {
+                promise->set_value(std::move(*stored));
+                return;
+            }
+
+            // decompressing is cpu work, keep it off the completion thread
+            QS_THREAD_POOL.Enqueue([pak, entry, promise, stored]() {
+                std::vector<u8> bytes(static_cast<size_t>(entry->size));
+                if (!Lz4Decompress(stored->data(), stored->size(), bytes.data(), bytes.size())) {
+                    QS_CORE_ERROR("Could not decompress %s", std::string(pak->GetName(*entry)).c_str());
+                    bytes.clear();
+                }
+                promise->set_value(std::move(bytes));
+            });
+        });
+    return future;
 }
 
 bool Filesystem::Delete(const std::string& filename) {
     if (std::remove(filename.c_str()) != 0) {
-        std::cerr << "Error: Could not delete the file." << std::endl;
+        QS_CORE_ERROR("Could not delete %s", filename.c_str());
         return false;
     }
     return true;
 }
 
-bool Filesystem::Exists(const std::string& filename) {
-    std::ifstream infile(filename);
-    return infile.good();
-}
-
 }
@@ -2,21 +2,62 @@
 
 #include <qspch.h>
 
+#include <future>
+
 namespace Quasar
 {
-class Filesystem {
+class PakFile;
+struct PakEntry;
+
+// Files by name, loose on disk or packed in the mounted paks (Core/PakFormat.h).
+// Reading functions and MappedFile::Open resolve a name through the paks, the
+// last mounted first. Loose files override packed ones while loose overrides
+// are on, so assets can be edited without repacking. Either way a file no pak
+// has is read from disk. Writing functions only ever touch the disk.
+class QS_API Filesystem {
 public:
-    void Write(const std::string& filename, const std::string& data);
+    struct FileInfo {
+        u64 size = 0;
+        // last write, nanoseconds since the epoch where the platform has them
+        i64 modified = 0;
+    };
+
+    static void Write(const std::string& filename, const std::string& data);
+
+    static void Append(const std::string& filename, const std::string& data);
+
+    // the whole file in one read, sized up front
+    static std::string Read(const std::string& filename);
+
+    static std::vector<char> ReadBinary(const std::string& filename);
+
+    static bool Delete(const std::string& filename);
+
+    // stat only, the file isn't opened. False for directories
+    static bool Exists(const std::string& filename);
+
+    // false, and no error logged, when there is no such file
+    static bool Stat(const std::string& filename, FileInfo& info);
 
-    void Append(const std::string& filename, const std::string& data);
+    // 0 when there is no such file
+    static u64 FileSize(const std::string& filename);
 
-    std::string Read(const std::string& filename);
+    // the whole file read in the background, through AsyncIO. Packed entries
+    // are read from the pak's range and decompressed on the pool. Empty when
+    // the file couldn't be read. Don't wait for it on a pool worker, the
+    // fallback reads run there too
+    static std::future<std::vector<u8>> ReadAsync(const std::string& filename);
 
-    std::vector<char> ReadBinary(const std::string& filename);
+    // mounts a pak over the ones before it. Thread safe, as are the lookups
+    static bool Mount(const std::string& pakFilename);
+    static void UnmountAll();
 
-    bool Delete(const std::string& filename);
+    // on by default in debug builds
+    static void SetLooseOverrides(bool enabled);
+    static bool GetLooseOverrides();
 
-    bool Exists(const std::string& filename);
+    // the newest mounted pak with the file and its entry, nullptr when none has it
+    static std::shared_ptr<const PakFile> FindPacked(const std::string& filename, const PakEntry*& entry);
 };
 
 } // namespace Quasar
@@ -0,0 +1,190 @@
+#include "Lz4.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Quasar
+{
+    static constexpr size_t MinMatch = 4;
+    // the block ends in at least this many literals
+    static constexpr size_t LastLiterals = 5;
+    // and the last match starts at least this far from the end
+    static constexpr size_t MatchLimit = 12;
+    static constexpr size_t MaxOffset = 65535;
+    static constexpr uint32_t HashBits = 16;
+
+    static uint32_t Read32(const uint8_t* p)
+    {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    static uint32_t HashSequence(uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - HashBits);
+    }
+
+    // 15 in the token, the rest as 255s and a final byte below 255
+    static uint8_t* WriteLength(uint8_t* out, size_t length)
+    {
+        for (length -= 15; length >= 255; length -= 255) {
+            *out++ = 255;
+        }
+        *out++ = uint8_t(length);
+        return out;
+    }
+
+    // one sequence, literals then a match. A matchLength of 0 is the last
+    // sequence, which has literals only
+    static uint8_t* WriteSequence(uint8_t* out, const uint8_t* outEnd, const uint8_t* literals, size_t literalLength,
+        size_t offset, size_t matchLength)
+    {
+        size_t worst = 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1;
+        if (size_t(outEnd - out) < worst) {
+            return nullptr;
+        }
+
+        uint8_t* token = out++;
+        *token = uint8_t(std::min<size_t>(literalLength, 15) << 4);
+        if (literalLength >= 15) {
+            out = WriteLength(out, literalLength);
+        }
+        if (literalLength > 0) {
+            memcpy(out, literals, literalLength);
+            out += literalLength;
+        }
+
+        if (matchLength == 0) {
+            return out;
+        }
+
+        *out++ = uint8_t(offset);
+        *out++ = uint8_t(offset >> 8);
+        size_t length = matchLength - MinMatch;
+        *token |= uint8_t(std::min<size_t>(length, 15));
+        if (length >= 15) {
+            out = WriteLength(out, length);
+        }
+        return out;
+    }
+
+    size_t Lz4Compress(const uint8_t* source, size_t size, uint8_t* destination, size_t capacity)
+    {
+        uint8_t* out = destination;
+        const uint8_t* outEnd = destination + capacity;
+
+        size_t anchor = 0;
+        if (size > MatchLimit) {
+            // last position seen for each hashed 4 byte sequence, plus one
+            std::vector<uint32_t> table(size_t(1) << HashBits, 0);
+            size_t matchEnd = size - MatchLimit;
+            size_t limit = size - LastLiterals;
+
+            size_t position = 0;
+            while (position < matchEnd) {
+                uint32_t sequence = Read32(source + position);
+                uint32_t& slot = table[HashSequence(sequence)];
+                size_t candidate = slot;
+                slot = uint32_t(position + 1);
+
+                if (candidate == 0 || position - (candidate - 1) > MaxOffset || Read32(source + candidate - 1) != sequence) {
+                    // skip faster the longer nothing has matched, incompressible data goes by quickly
+                    position += 1 + ((position - anchor) >> 6);
+                    continue;
+                }
+
+                size_t match = candidate - 1;
+                size_t length = MinMatch;
+                while (position + length < limit && source[match + length] == source[position + length]) {
+                    length++;
+                }
+
+                out = WriteSequence(out, outEnd, source + anchor, position - anchor, position - match, length);
+                if (!out) {
+                    return 0;
+                }
+                position += length;
+                anchor = position;
+            }
+        }
+
+        out = WriteSequence(out, outEnd, source + anchor, size - anchor, 0, 0);
+        return out ? size_t(out - destination) : 0;
+    }
+
+    // adds the bytes after a 15 in the token, false when the input ends first
+    static bool ReadLength(const uint8_t*& in, const uint8_t* inEnd, size_t& length)
+    {
+        uint8_t byte;
+        do {
+            if (in == inEnd) {
+                return false;
+            }
+            byte = *in++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    bool Lz4Decompress(const uint8_t* source, size_t size, uint8_t* destination, size_t destinationSize)
+    {
+        const uint8_t* in = source;
+        const uint8_t* inEnd = source + size;
+        uint8_t* out = destination;
+        uint8_t* outEnd = destination + destinationSize;
+
+        while (in < inEnd) {
+            uint8_t token = *in++;
+
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLength(in, inEnd, literalLength)) {
+                return false;
+            }
+            if (literalLength > size_t(inEnd - in) || literalLength > size_t(outEnd - out)) {
+                return false;
+            }
+            if (literalLength > 0) {
+                memcpy(out, in, literalLength);
+                in += literalLength;
+                out += literalLength;
+            }
+
+            // the last sequence has no match
+            if (in == inEnd) {
+                break;
+            }
+
+            if (inEnd - in < 2) {
+                return false;
+            }
+            size_t offset = size_t(in[0]) | size_t(in[1]) << 8;
+            in += 2;
+            if (offset == 0 || offset > size_t(out - destination)) {
+                return false;
+            }
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !ReadLength(in, inEnd, matchLength)) {
+                return false;
+            }
+            matchLength += MinMatch;
+            if (matchLength > size_t(outEnd - out)) {
+                return false;
+            }
+
+            const uint8_t* match = out - offset;
+            if (offset >= matchLength) {
+                memcpy(out, match, matchLength);
+                out += matchLength;
+            } else {
+                // overlapping, the match repeats what it is writing
+                for (size_t i = 0; i < matchLength; i++) {
+                    *out++ = match[i];
+                }
+            }
+        }
+        return out == outEnd;
+    }
+} // namespace Quasar
@@ -0,0 +1,27 @@
+#pragma once
+
+// LZ4 block format, the raw blocks without the frame around them. Paks store
+// entries compressed with it, see PakFormat.h. Only fixed size types, so the
+// PakBuilder tool can use it without the rest of the engine.
+//
+// The encoder is greedy with a single hash table, decompression is what has to
+// be fast, and checks every length and offset against both buffers.
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Quasar
+{
+    // worst case size of size bytes once compressed
+    inline size_t Lz4CompressBound(size_t size)
+    {
+        return size + size / 255 + 16;
+    }
+
+    // the compressed size, 0 when it doesn't fit in capacity
+    size_t Lz4Compress(const uint8_t* source, size_t size, uint8_t* destination, size_t capacity);
+
+    // false when the block is malformed or doesn't decompress to exactly
+    // destinationSize bytes
+    bool Lz4Decompress(const uint8_t* source, size_t size, uint8_t* destination, size_t destinationSize);
+} // namespace Quasar
@@ -0,0 +1,232 @@
+#include "MappedFile.h"
+
+#include "Filesystem.h"
+#include "PakFile.h"
+
+#ifdef QS_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Quasar {
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_owner, other.m_owner);
+#ifdef QS_PLATFORM_WINDOWS
+        std::swap(m_file, other.m_file);
+        std::swap(m_mapping, other.m_mapping);
+#endif
+    }
+    return *this;
+}
+
+b8 MappedFile::Open(const std::string& filename, Access access) {
+    Close();
+
+    // loose files come first while they override the paks, and last otherwise,
+    // for files that were never packed such as caches
+    b8 looseFirst = Filesystem::GetLooseOverrides();
+    b8 missing = true;
+    if (looseFirst && (Map(filename, access, missing) || !missing)) {
+        return IsOpen();
+    }
+
+    const PakEntry* entry = nullptr;
+    if (std::shared_ptr<const PakFile> pak = Filesystem::FindPacked(filename, entry)) {
+        return OpenPacked(std::move(pak), *entry, access);
+    }
+
+    if (!looseFirst && Map(filename, access, missing)) {
+        return true;
+    }
+    if (missing) {
+        QS_CORE_ERROR("Could not open %s for mapping", filename.c_str());
+    }
+    return false;
+}
+
+b8 MappedFile::OpenPacked(std::shared_ptr<const PakFile> pak, const PakEntry& entry, Access access) {
+    if (PakCompression(entry.compression) == PakCompression::None) {
+        m_data = pak->GetFile().Data() + entry.offset;
+        m_size = entry.size;
+        m_owner = std::move(pak);
+        if (access != Access::Normal) {
+            Advise(0, m_size, access);
+        }
+        return true;
+    }
+
+    auto bytes = std::make_shared<std::vector<u8>>(static_cast<size_t>(entry.size));
+    if (!pak->Decompress(entry, bytes->data())) {
+        return false;
+    }
+    m_data = bytes->data();
+    m_size = bytes->size();
+    m_owner = std::move(bytes);
+    return true;
+}
+
+#ifdef QS_PLATFORM_WINDOWS
+b8 MappedFile::Map(const std::string& filename, Access access, b8& missing) {
+    // the cache manager's read-ahead follows the file handle's flags
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (access == Access::Sequential || access == Access::WillNeed) {
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    } else if (access == Access::Random) {
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+    }
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        DWORD error = GetLastError();
+        missing = error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND;
+        if (!missing) {
+            QS_CORE_ERROR("Could not open %s for mapping", filename.c_str());
+        }
+        return false;
+    }
+    missing = false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        QS_CORE_ERROR("Could not map %s, the file is empty", filename.c_str());
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        QS_CORE_ERROR("Could not create a file mapping for %s", filename.c_str());
+        CloseHandle(file);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        QS_CORE_ERROR("Could not map a view of %s", filename.c_str());
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const u8*>(data);
+    m_size = static_cast<u64>(size.QuadPart);
+
+    if (access == Access::WillNeed) {
+        Advise(0, m_size, access);
+    }
+    return true;
+}
+
+void MappedFile::Advise(u64 offset, u64 size, Access access) const {
+    // only prefetching has a per-range equivalent
+    if (!m_data || access != Access::WillNeed || offset >= m_size) {
+        return;
+    }
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<u8*>(m_data + offset);
+    range.NumberOfBytes = static_cast<SIZE_T>(std::min(size, m_size - offset));
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+void MappedFile::Close() {
+    if (m_owner) {
+        m_owner.reset();
+    } else if (m_data) {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mapping);
+        CloseHandle(m_file);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_file = nullptr;
+    m_mapping = nullptr;
+}
+#else
+static int AdviceFor(MappedFile::Access access) {
+    switch (access) {
+        case MappedFile::Access::Sequential: return POSIX_MADV_SEQUENTIAL;
+        case MappedFile::Access::Random: return POSIX_MADV_RANDOM;
+        case MappedFile::Access::WillNeed: return POSIX_MADV_WILLNEED;
+        default: return POSIX_MADV_NORMAL;
+    }
+}
+
+b8 MappedFile::Map(const std::string& filename, Access access, b8& missing) {
+    int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        missing = errno == ENOENT || errno == ENOTDIR;
+        if (!missing) {
+            QS_CORE_ERROR("Could not open %s for mapping", filename.c_str());
+        }
+        return false;
+    }
+    missing = false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        QS_CORE_ERROR("Could not map %s, the file is empty", filename.c_str());
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED) {
+        QS_CORE_ERROR("Could not map %s", filename.c_str());
+        return false;
+    }
+
+    m_data = static_cast<const u8*>(data);
+    m_size = static_cast<u64>(info.st_size);
+
+    if (access != Access::Normal) {
+        posix_madvise(data, static_cast<size_t>(m_size), AdviceFor(access));
+    }
+    return true;
+}
+
+void MappedFile::Advise(u64 offset, u64 size, Access access) const {
+    if (!m_data || offset >= m_size) {
+        return;
+    }
+    // the range has to start on a page, a packed entry's view may not
+    uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = reinterpret_cast<uintptr_t>(m_data + offset) & ~(page - 1);
+    uintptr_t end = reinterpret_cast<uintptr_t>(m_data + offset + std::min(size, m_size - offset));
+    posix_madvise(reinterpret_cast<void*>(begin), static_cast<size_t>(end - begin), AdviceFor(access));
+}
+
+void MappedFile::Close() {
+    if (m_owner) {
+        m_owner.reset();
+    } else if (m_data) {
+        munmap(const_cast<u8*>(m_data), static_cast<size_t>(m_size));
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+#endif
+
+}
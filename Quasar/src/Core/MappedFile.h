@@ -0,0 +1,70 @@
+#pragma once
+
+#include <qspch.h>
+
+#include <memory>
+#include <span>
+
+namespace Quasar
+{
+    class PakFile;
+    struct PakEntry;
+
+    // A read-only file mapped into memory. The pages are loaded by the OS on
+    // first touch, so opening is cheap and data can be used in place.
+    //
+    // Open() resolves the name through the paks mounted in Filesystem. A packed
+    // entry stored as is is a view into the pak's mapping, a compressed one is
+    // decompressed into memory the MappedFile owns.
+    class QS_API MappedFile {
+    public:
+        // how the mapping is going to be read, so the OS can read ahead or not
+        enum class Access : u8 {
+            Normal,
+            // front to back once, such as a file parsed in a single pass
+            Sequential,
+            // scattered reads, read-ahead would only waste memory
+            Random,
+            // all of it soon, reading starts in the background right away
+            WillNeed,
+        };
+
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        b8 Open(const std::string& filename, Access access = Access::Normal);
+        void Close();
+
+        // a hint for part of the mapping, such as the mips about to be uploaded
+        void Advise(u64 offset, u64 size, Access access) const;
+
+        QS_INLINE b8 IsOpen() const { return m_data != nullptr; }
+        QS_INLINE const u8* Data() const { return m_data; }
+        QS_INLINE u64 Size() const { return m_size; }
+
+        // the bytes in place, clamped to the file. Valid while the file is open
+        QS_INLINE std::span<const u8> View(u64 offset = 0, u64 size = ~0ull) const {
+            offset = std::min(offset, m_size);
+            return { m_data + offset, static_cast<size_t>(std::min(size, m_size - offset)) };
+        }
+
+    private:
+        // the file on disk alone. missing is set when there is no such file
+        b8 Map(const std::string& filename, Access access, b8& missing);
+        b8 OpenPacked(std::shared_ptr<const PakFile> pak, const PakEntry& entry, Access access);
+
+        const u8* m_data = nullptr;
+        u64 m_size = 0;
+        // keeps the pak or the decompressed bytes alive, nothing was mapped when set
+        std::shared_ptr<const void> m_owner;
+#ifdef QS_PLATFORM_WINDOWS
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#endif
+    };
+} // namespace Quasar
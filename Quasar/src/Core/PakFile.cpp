@@ -0,0 +1,70 @@
+#include "PakFile.h"
+
+#include "Filesystem.h"
+#include "Lz4.h"
+
+namespace Quasar
+{
+    b8 PakFile::Open(const std::string& filename) {
+        Filesystem::FileInfo info;
+        // the table is searched at random, the blobs are advised as they are opened
+        if (!Filesystem::Stat(filename, info) || !m_file.Open(filename, MappedFile::Access::Random)) {
+            QS_CORE_ERROR("Could not open the pak %s", filename.c_str());
+            return false;
+        }
+        if (!ValidatePak(m_file.Data(), m_file.Size())) {
+            QS_CORE_ERROR("%s is not a valid pak", filename.c_str());
+            m_file.Close();
+            return false;
+        }
+
+        const PakHeader* header = reinterpret_cast<const PakHeader*>(m_file.Data());
+        m_path = filename;
+        m_modified = info.modified;
+        m_entries = reinterpret_cast<const PakEntry*>(m_file.Data() + header->entryOffset);
+        m_entryCount = header->entryCount;
+        m_names = reinterpret_cast<const char*>(m_file.Data() + header->namesOffset);
+        return true;
+    }
+
+    const PakEntry* PakFile::Find(std::string_view path) const {
+        u64 hash = PakPathHash(path);
+        const PakEntry* end = m_entries + m_entryCount;
+        const PakEntry* entry = std::lower_bound(m_entries, end, hash,
+            [](const PakEntry& entry, u64 hash) { return entry.pathHash < hash; });
+
+        // the builder refuses colliding paths, the name check keeps a path that
+        // isn't packed from landing on another one's entry
+        for (; entry != end && entry->pathHash == hash; entry++) {
+            if (GetName(*entry) == path) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::string_view PakFile::GetName(const PakEntry& entry) const {
+        return { m_names + entry.nameOffset, entry.nameLength };
+    }
+
+    std::span<const u8> PakFile::GetStored(const PakEntry& entry) const {
+        return m_file.View(entry.offset, entry.storedSize);
+    }
+
+    b8 PakFile::Decompress(const PakEntry& entry, u8* destination) const {
+        std::span<const u8> stored = GetStored(entry);
+        switch (PakCompression(entry.compression)) {
+            case PakCompression::None:
+                memcpy(destination, stored.data(), stored.size());
+                return true;
+            case PakCompression::LZ4:
+                if (Lz4Decompress(stored.data(), stored.size(), destination, static_cast<size_t>(entry.size))) {
+                    return true;
+                }
+                break;
+        }
+        QS_CORE_ERROR("Could not decompress %.*s from %s", static_cast<int>(entry.nameLength), GetName(entry).data(),
+            m_path.c_str());
+        return false;
+    }
+} // namespace Quasar
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <qspch.h>
+
+#include "MappedFile.h"
+#include "PakFormat.h"
+
+#include <span>
+#include <string_view>
+
+namespace Quasar
+{
+    // A .pak mapped whole, see PakFormat.h. Entries stored as is are used in
+    // place, compressed ones are decompressed straight from the mapping.
+    // Immutable once open, so any thread may read it.
+    class QS_API PakFile {
+    public:
+        b8 Open(const std::string& filename);
+
+        // the entry of the path, nullptr when the pak has none
+        const PakEntry* Find(std::string_view path) const;
+
+        std::string_view GetName(const PakEntry& entry) const;
+        // the bytes of the blob as stored, compressed or not
+        std::span<const u8> GetStored(const PakEntry& entry) const;
+        // entry.size bytes into destination
+        b8 Decompress(const PakEntry& entry, u8* destination) const;
+
+        QS_INLINE const std::string& GetPath() const { return m_path; }
+        QS_INLINE const MappedFile& GetFile() const { return m_file; }
+        // what Filesystem::Stat reports for the entries
+        QS_INLINE i64 GetModified() const { return m_modified; }
+        QS_INLINE std::span<const PakEntry> GetEntries() const { return { m_entries, m_entryCount }; }
+
+    private:
+        std::string m_path;
+        MappedFile m_file;
+        i64 m_modified = 0;
+        const PakEntry* m_entries = nullptr;
+        u32 m_entryCount = 0;
+        const char* m_names = nullptr;
+    };
+} // namespace Quasar
@@ -0,0 +1,157 @@
+#pragma once
+
+// Packed asset archive (.pak), written by the PakBuilder tool and mounted by
+// the engine's Filesystem, which resolves paths through every mounted pak.
+// Only fixed size types, so the builder can use it without the rest of the
+// engine.
+//
+// Layout:
+//
+//   PakHeader
+//   PakEntry[entryCount], sorted by pathHash for a binary search
+//   names, the path of every entry back to back, not terminated
+//   blobs, each starting at a PakAlignment aligned offset
+//
+// Paths are spelled the way the engine opens them, relative to the directory it
+// runs in with forward slashes ("Assets/shaders/Builtin.Mesh.vert.spv"), see
+// PakNormalizePath. Entries with the same contents share one blob.
+//
+// All values are little endian.
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Quasar
+{
+    constexpr uint32_t PakMagic = 0x4B415051; // "QPAK"
+    constexpr uint32_t PakVersion = 1;
+    // a multiple of every page size, so a blob stored as is maps like a file of
+    // its own, page aligned, and its pages belong to it alone
+    constexpr uint64_t PakAlignment = 64 * 1024;
+
+    enum class PakCompression : uint32_t {
+        None = 0,
+        // Lz4.h, one block for the whole entry
+        LZ4 = 1,
+    };
+
+    struct PakEntry {
+        uint64_t pathHash;
+        // of the uncompressed bytes, for finding duplicates
+        uint64_t contentHash;
+        // byte offset of the blob from the start of the file
+        uint64_t offset;
+        // bytes of the blob in the pak
+        uint64_t storedSize;
+        // bytes once decompressed, storedSize when stored as is
+        uint64_t size;
+        // into the names
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        // a PakCompression
+        uint32_t compression;
+        uint32_t pad;
+    };
+
+    struct PakHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t pad;
+        // byte offsets from the start of the file
+        uint64_t entryOffset;
+        uint64_t namesOffset;
+        uint64_t namesSize;
+        uint64_t fileSize;
+    };
+
+    static_assert(sizeof(PakEntry) == 56);
+    static_assert(sizeof(PakHeader) == 48);
+
+    inline uint64_t PakAlign(uint64_t offset)
+    {
+        return (offset + PakAlignment - 1) & ~(PakAlignment - 1);
+    }
+
+    // FNV-1a, stable between runs and platforms. hash continues an earlier call
+    inline uint64_t PakHash(const void* data, size_t size, uint64_t hash = 14695981039346656037ull)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // forward slashes, without "." segments or repeated slashes, so
+    // "./Assets\\shaders//a.spv" and "Assets/shaders/a.spv" are the same entry
+    inline std::string PakNormalizePath(std::string_view path)
+    {
+        std::string normalized;
+        normalized.reserve(path.size());
+
+        size_t begin = 0;
+        while (begin <= path.size()) {
+            size_t end = path.find_first_of("/\\", begin);
+            if (end == std::string_view::npos) {
+                end = path.size();
+            }
+            std::string_view segment = path.substr(begin, end - begin);
+            if (!segment.empty() && segment != ".") {
+                if (!normalized.empty()) {
+                    normalized += '/';
+                }
+                normalized += segment;
+            }
+            begin = end + 1;
+        }
+        return normalized;
+    }
+
+    inline uint64_t PakPathHash(std::string_view normalizedPath)
+    {
+        return PakHash(normalizedPath.data(), normalizedPath.size());
+    }
+
+    // true when the tables and every blob lie inside size bytes, the blobs are
+    // aligned and the entries are sorted
+    inline bool ValidatePak(const void* data, uint64_t size)
+    {
+        if (size < sizeof(PakHeader)) {
+            return false;
+        }
+
+        const PakHeader* header = static_cast<const PakHeader*>(data);
+        if (header->magic != PakMagic || header->version != PakVersion || header->fileSize != size) {
+            return false;
+        }
+
+        auto inside = [&](uint64_t offset, uint64_t bytes) {
+            return offset <= size && bytes <= size - offset;
+        };
+        if (header->entryOffset % alignof(PakEntry) != 0
+            || !inside(header->entryOffset, uint64_t(header->entryCount) * sizeof(PakEntry))
+            || !inside(header->namesOffset, header->namesSize)) {
+            return false;
+        }
+
+        const PakEntry* entries = reinterpret_cast<const PakEntry*>(static_cast<const uint8_t*>(data) + header->entryOffset);
+        for (uint32_t i = 0; i < header->entryCount; i++) {
+            const PakEntry& entry = entries[i];
+            if (i > 0 && entries[i - 1].pathHash > entry.pathHash) {
+                return false;
+            }
+            if (entry.offset % PakAlignment != 0 || !inside(entry.offset, entry.storedSize)
+                || uint64_t(entry.nameOffset) + entry.nameLength > header->namesSize) {
+                return false;
+            }
+            if (entry.compression == uint32_t(PakCompression::None) ? entry.size != entry.storedSize
+                : entry.compression != uint32_t(PakCompression::LZ4)) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace Quasar
@@ -0,0 +1,102 @@
+#include "ThreadPool.h"
+
+namespace Quasar
+{
+    ThreadPool* ThreadPool::s_instance = nullptr;
+
+    ThreadPool::~ThreadPool() {
+        Shutdown();
+    }
+
+    b8 ThreadPool::Init(u32 threadCount) {
+        assert(!s_instance);
+        s_instance = new ThreadPool();
+
+        if (threadCount == 0) {
+            u32 hardwareThreads = std::thread::hardware_concurrency();
+            threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+        s_instance->m_threads.reserve(threadCount);
+        for (u32 i = 0; i < threadCount; i++) {
+            s_instance->m_threads.emplace_back(&ThreadPool::WorkerLoop, s_instance);
+        }
+        return true;
+    }
+
+    void ThreadPool::Shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+
+        // workers finish the queued tasks before they exit
+        for (std::thread& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+    }
+
+    void ThreadPool::Enqueue(std::function<void()>&& task) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_wake.notify_one();
+    }
+
+    void ThreadPool::ParallelFor(u32 count, const std::function<void(u32 index)>& function) {
+        if (count == 0) {
+            return;
+        }
+
+        // helpers that start after the loop is done still touch the state, so it is shared
+        struct LoopState {
+            std::atomic<u32> next{0};
+            std::atomic<u32> done{0};
+            std::mutex mutex;
+            std::condition_variable finished;
+        };
+        auto state = std::make_shared<LoopState>();
+        const std::function<void(u32)>* body = &function;
+
+        auto run = [state, body, count]() {
+            for (u32 i = state->next.fetch_add(1); i < count; i = state->next.fetch_add(1)) {
+                (*body)(i);
+                if (state->done.fetch_add(1) + 1 == count) {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->finished.notify_all();
+                }
+            }
+        };
+
+        u32 helpers = std::min(count - 1, GetThreadCount());
+        for (u32 i = 0; i < helpers; i++) {
+            Enqueue(run);
+        }
+
+        run();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&]() { return state->done.load() == count; });
+    }
+
+    void ThreadPool::WorkerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+                if (m_tasks.empty()) {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <qspch.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+
+namespace Quasar
+{
+    // Worker threads for CPU work off the main thread, such as asset loading.
+    // Tasks run in submission order, the pool does not steal or prioritize.
+    class QS_API ThreadPool {
+    public:
+        ~ThreadPool();
+
+        // threadCount 0 uses one thread per hardware thread, minus the main thread
+        static b8 Init(u32 threadCount = 0);
+        void Shutdown();
+
+        static ThreadPool& GetInstance() { return *s_instance; }
+
+        void Enqueue(std::function<void()>&& task);
+
+        template<typename F>
+        auto Submit(F&& task) -> std::future<std::invoke_result_t<F>>
+        {
+            using R = std::invoke_result_t<F>;
+            auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+            std::future<R> future = packaged->get_future();
+            Enqueue([packaged]() { (*packaged)(); });
+            return future;
+        }
+
+        // calls function(i) for i in [0, count) on the workers and the calling
+        // thread, and returns once every call has finished
+        void ParallelFor(u32 count, const std::function<void(u32 index)>& function);
+
+        QS_INLINE u32 GetThreadCount() const { return static_cast<u32>(m_threads.size()); }
+
+    private:
+        ThreadPool() {};
+        void WorkerLoop();
+
+        static ThreadPool* s_instance;
+
+        std::vector<std::thread> m_threads;
+        std::deque<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        b8 m_stopping = false;
+    };
+
+    #define QS_THREAD_POOL ThreadPool::GetInstance()
+} // namespace Quasar
@@ -0,0 +1,650 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Quasar
+{
+    namespace
+    {
+        struct Color565 {
+            uint16_t packed;
+            // expanded back to 8 bits, what the hardware interpolates
+            int r, g, b;
+        };
+
+        Color565 Quantize565(float r, float g, float b)
+        {
+            int r5 = std::clamp(int(std::lround(r * 31.f / 255.f)), 0, 31);
+            int g6 = std::clamp(int(std::lround(g * 63.f / 255.f)), 0, 63);
+            int b5 = std::clamp(int(std::lround(b * 31.f / 255.f)), 0, 31);
+
+            Color565 c;
+            c.packed = uint16_t(r5 << 11 | g6 << 5 | b5);
+            c.r = r5 << 3 | r5 >> 2;
+            c.g = g6 << 2 | g6 >> 4;
+            c.b = b5 << 3 | b5 >> 2;
+            return c;
+        }
+
+        Color565 Unpack565(uint16_t packed)
+        {
+            int r5 = packed >> 11 & 31;
+            int g6 = packed >> 5 & 63;
+            int b5 = packed & 31;
+            return { packed, r5 << 3 | r5 >> 2, g6 << 2 | g6 >> 4, b5 << 3 | b5 >> 2 };
+        }
+
+        // principal axis of the block's colors by power iteration on the covariance,
+        // over the first channels of every pixel
+        template<int Channels>
+        void PrincipalAxis(const float (*pixels)[4], float* mean, float* axis)
+        {
+            for (int c = 0; c < Channels; c++) {
+                mean[c] = 0.f;
+                for (int i = 0; i < 16; i++) {
+                    mean[c] += pixels[i][c];
+                }
+                mean[c] /= 16.f;
+            }
+
+            float covariance[Channels][Channels] = {};
+            for (int i = 0; i < 16; i++) {
+                for (int a = 0; a < Channels; a++) {
+                    for (int b = 0; b < Channels; b++) {
+                        covariance[a][b] += (pixels[i][a] - mean[a]) * (pixels[i][b] - mean[b]);
+                    }
+                }
+            }
+
+            for (int c = 0; c < Channels; c++) {
+                axis[c] = 1.f;
+            }
+            for (int iteration = 0; iteration < 8; iteration++) {
+                float next[Channels] = {};
+                float length = 0.f;
+                for (int a = 0; a < Channels; a++) {
+                    for (int b = 0; b < Channels; b++) {
+                        next[a] += covariance[a][b] * axis[b];
+                    }
+                    length = std::max(length, std::fabs(next[a]));
+                }
+                // a flat block, any axis will do
+                if (length < 1e-6f) {
+                    break;
+                }
+                for (int c = 0; c < Channels; c++) {
+                    axis[c] = next[c] / length;
+                }
+            }
+        }
+
+        // the ends of the block along its principal axis, pulled in a little
+        // since the extremes are rarely worth exact palette entries
+        template<int Channels>
+        void FitEndpoints(const float (*pixels)[4], float* e0, float* e1)
+        {
+            float mean[Channels], axis[Channels];
+            PrincipalAxis<Channels>(pixels, mean, axis);
+
+            float axisLength = 0.f;
+            for (int c = 0; c < Channels; c++) {
+                axisLength += axis[c] * axis[c];
+            }
+
+            float tMin = 0.f, tMax = 0.f;
+            for (int i = 0; i < 16; i++) {
+                float t = 0.f;
+                for (int c = 0; c < Channels; c++) {
+                    t += (pixels[i][c] - mean[c]) * axis[c];
+                }
+                t /= std::max(axisLength, 1e-12f);
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+
+            float inset = (tMax - tMin) / 32.f;
+            tMin += inset;
+            tMax -= inset;
+            for (int c = 0; c < Channels; c++) {
+                e0[c] = std::clamp(mean[c] + axis[c] * tMax, 0.f, 255.f);
+                e1[c] = std::clamp(mean[c] + axis[c] * tMin, 0.f, 255.f);
+            }
+        }
+
+        void LoadBlock(const uint8_t* rgba, float (*pixels)[4])
+        {
+            for (int i = 0; i < 16; i++) {
+                for (int c = 0; c < 4; c++) {
+                    pixels[i][c] = float(rgba[i * 4 + c]);
+                }
+            }
+        }
+
+        // single channel block, used for BC3 alpha and both BC5 channels
+        void EncodeBC4(const uint8_t* rgba, int channel, uint8_t* block)
+        {
+            int lo = 255, hi = 0;
+            for (int i = 0; i < 16; i++) {
+                lo = std::min(lo, int(rgba[i * 4 + channel]));
+                hi = std::max(hi, int(rgba[i * 4 + channel]));
+            }
+
+            // eight value mode needs a0 > a1, a flat block gets all zero indices
+            block[0] = uint8_t(hi);
+            block[1] = uint8_t(lo);
+
+            uint64_t indices = 0;
+            if (hi > lo) {
+                int palette[8];
+                palette[0] = hi;
+                palette[1] = lo;
+                for (int i = 2; i < 8; i++) {
+                    palette[i] = ((8 - i) * hi + (i - 1) * lo + 3) / 7;
+                }
+
+                for (int i = 0; i < 16; i++) {
+                    int value = rgba[i * 4 + channel];
+                    int best = 0, bestError = 256;
+                    for (int p = 0; p < 8; p++) {
+                        int error = std::abs(palette[p] - value);
+                        if (error < bestError) {
+                            bestError = error;
+                            best = p;
+                        }
+                    }
+                    indices |= uint64_t(best) << (3 * i);
+                }
+            }
+
+            for (int i = 0; i < 6; i++) {
+                block[2 + i] = uint8_t(indices >> (8 * i));
+            }
+        }
+
+        void DecodeBC4(const uint8_t* block, int channel, uint8_t* rgba)
+        {
+            int a0 = block[0], a1 = block[1];
+            int palette[8] = { a0, a1 };
+            if (a0 > a1) {
+                for (int i = 2; i < 8; i++) {
+                    palette[i] = ((8 - i) * a0 + (i - 1) * a1 + 3) / 7;
+                }
+            } else {
+                for (int i = 2; i < 6; i++) {
+                    palette[i] = ((6 - i) * a0 + (i - 1) * a1 + 2) / 5;
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+
+            uint64_t indices = 0;
+            for (int i = 0; i < 6; i++) {
+                indices |= uint64_t(block[2 + i]) << (8 * i);
+            }
+            for (int i = 0; i < 16; i++) {
+                rgba[i * 4 + channel] = uint8_t(palette[indices >> (3 * i) & 7]);
+            }
+        }
+
+        uint32_t BC1Indices(const float (*pixels)[4], const int (*palette)[3], float* totalError)
+        {
+            uint32_t indices = 0;
+            float error = 0.f;
+            for (int i = 0; i < 16; i++) {
+                int best = 0;
+                float bestError = 1e30f;
+                for (int p = 0; p < 4; p++) {
+                    float dr = pixels[i][0] - palette[p][0];
+                    float dg = pixels[i][1] - palette[p][1];
+                    float db = pixels[i][2] - palette[p][2];
+                    float e = dr * dr + dg * dg + db * db;
+                    if (e < bestError) {
+                        bestError = e;
+                        best = p;
+                    }
+                }
+                indices |= uint32_t(best) << (2 * i);
+                error += bestError;
+            }
+            *totalError = error;
+            return indices;
+        }
+
+        // 4 color palette of two endpoints, in BC1 index order
+        void BC1Palette(const Color565& c0, const Color565& c1, int (*palette)[3])
+        {
+            int e0[3] = { c0.r, c0.g, c0.b };
+            int e1[3] = { c1.r, c1.g, c1.b };
+            for (int c = 0; c < 3; c++) {
+                palette[0][c] = e0[c];
+                palette[1][c] = e1[c];
+                palette[2][c] = (2 * e0[c] + e1[c]) / 3;
+                palette[3][c] = (e0[c] + 2 * e1[c]) / 3;
+            }
+        }
+
+        // BC7 mode 6 interpolation weights of the 4 bit indices
+        constexpr int BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        int BC7Interpolate(int e0, int e1, int weight)
+        {
+            return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+        }
+
+        struct BitWriter {
+            uint8_t* data;
+            uint32_t position = 0;
+
+            void Write(uint32_t value, uint32_t bits)
+            {
+                for (uint32_t i = 0; i < bits; i++, position++) {
+                    data[position >> 3] |= uint8_t((value >> i & 1) << (position & 7));
+                }
+            }
+        };
+
+        struct BitReader {
+            const uint8_t* data;
+            uint32_t position = 0;
+
+            uint32_t Read(uint32_t bits)
+            {
+                uint32_t value = 0;
+                for (uint32_t i = 0; i < bits; i++, position++) {
+                    value |= uint32_t(data[position >> 3] >> (position & 7) & 1) << i;
+                }
+                return value;
+            }
+        };
+
+        float SrgbToLinear(float c)
+        {
+            return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(float c)
+        {
+            return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.f / 2.4f) - 0.055f;
+        }
+
+        struct SrgbTable {
+            float toLinear[256];
+
+            SrgbTable()
+            {
+                for (int i = 0; i < 256; i++) {
+                    toLinear[i] = SrgbToLinear(float(i) / 255.f);
+                }
+            }
+        };
+    } // namespace
+
+    void EncodeBC1Block(const uint8_t* rgba, uint8_t* block)
+    {
+        float pixels[16][4];
+        LoadBlock(rgba, pixels);
+
+        float e0[3], e1[3];
+        FitEndpoints<3>(pixels, e0, e1);
+
+        Color565 c0 = Quantize565(e0[0], e0[1], e0[2]);
+        Color565 c1 = Quantize565(e1[0], e1[1], e1[2]);
+
+        int palette[4][3];
+        BC1Palette(c0, c1, palette);
+        float error;
+        uint32_t indices = BC1Indices(pixels, palette, &error);
+
+        // least squares endpoints for the chosen indices, kept when they do better
+        {
+            constexpr float Weights[4] = { 1.f, 0.f, 2.f / 3.f, 1.f / 3.f };
+            float aa = 0.f, bb = 0.f, ab = 0.f;
+            float ax[3] = {}, bx[3] = {};
+            for (int i = 0; i < 16; i++) {
+                float a = Weights[indices >> (2 * i) & 3];
+                float b = 1.f - a;
+                aa += a * a;
+                bb += b * b;
+                ab += a * b;
+                for (int c = 0; c < 3; c++) {
+                    ax[c] += a * pixels[i][c];
+                    bx[c] += b * pixels[i][c];
+                }
+            }
+
+            float determinant = aa * bb - ab * ab;
+            if (std::fabs(determinant) > 1e-6f) {
+                float refined0[3], refined1[3];
+                for (int c = 0; c < 3; c++) {
+                    refined0[c] = std::clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.f, 255.f);
+                    refined1[c] = std::clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.f, 255.f);
+                }
+
+                Color565 r0 = Quantize565(refined0[0], refined0[1], refined0[2]);
+                Color565 r1 = Quantize565(refined1[0], refined1[1], refined1[2]);
+                int refinedPalette[4][3];
+                BC1Palette(r0, r1, refinedPalette);
+                float refinedError;
+                uint32_t refinedIndices = BC1Indices(pixels, refinedPalette, &refinedError);
+                if (refinedError < error) {
+                    c0 = r0;
+                    c1 = r1;
+                    indices = refinedIndices;
+                }
+            }
+        }
+
+        // four color mode needs c0 > c1, swapping the endpoints swaps 0 with 1 and 2 with 3
+        if (c0.packed < c1.packed) {
+            std::swap(c0, c1);
+            indices ^= 0x55555555;
+        } else if (c0.packed == c1.packed) {
+            indices = 0;
+        }
+
+        block[0] = uint8_t(c0.packed);
+        block[1] = uint8_t(c0.packed >> 8);
+        block[2] = uint8_t(c1.packed);
+        block[3] = uint8_t(c1.packed >> 8);
+        for (int i = 0; i < 4; i++) {
+            block[4 + i] = uint8_t(indices >> (8 * i));
+        }
+    }
+
+    void EncodeBC3Block(const uint8_t* rgba, uint8_t* block)
+    {
+        EncodeBC4(rgba, 3, block);
+        EncodeBC1Block(rgba, block + 8);
+    }
+
+    void EncodeBC5Block(const uint8_t* rgba, uint8_t* block)
+    {
+        EncodeBC4(rgba, 0, block);
+        EncodeBC4(rgba, 1, block + 8);
+    }
+
+    void EncodeBC7Block(const uint8_t* rgba, uint8_t* block)
+    {
+        float pixels[16][4];
+        LoadBlock(rgba, pixels);
+
+        float e0[4], e1[4];
+        FitEndpoints<4>(pixels, e0, e1);
+
+        // every combination of the shared low bits, keeping the closest result
+        int bestEndpoints[2][4] = {};
+        int bestPBits[2] = {};
+        uint8_t bestIndices[16] = {};
+        float bestError = 1e30f;
+
+        for (int pbits = 0; pbits < 4; pbits++) {
+            int p[2] = { pbits & 1, pbits >> 1 };
+            int quantized[2][4];
+            int expanded[2][4];
+            for (int c = 0; c < 4; c++) {
+                quantized[0][c] = std::clamp(int(std::lround((e0[c] - p[0]) / 2.f)), 0, 127);
+                quantized[1][c] = std::clamp(int(std::lround((e1[c] - p[1]) / 2.f)), 0, 127);
+                expanded[0][c] = quantized[0][c] << 1 | p[0];
+                expanded[1][c] = quantized[1][c] << 1 | p[1];
+            }
+
+            int palette[16][4];
+            for (int w = 0; w < 16; w++) {
+                for (int c = 0; c < 4; c++) {
+                    palette[w][c] = BC7Interpolate(expanded[0][c], expanded[1][c], BC7Weights4[w]);
+                }
+            }
+
+            uint8_t indices[16];
+            float error = 0.f;
+            for (int i = 0; i < 16; i++) {
+                float pixelBest = 1e30f;
+                for (int w = 0; w < 16; w++) {
+                    float e = 0.f;
+                    for (int c = 0; c < 4; c++) {
+                        float d = pixels[i][c] - palette[w][c];
+                        e += d * d;
+                    }
+                    if (e < pixelBest) {
+                        pixelBest = e;
+                        indices[i] = uint8_t(w);
+                    }
+                }
+                error += pixelBest;
+            }
+
+            if (error < bestError) {
+                bestError = error;
+                memcpy(bestEndpoints, quantized, sizeof(quantized));
+                bestPBits[0] = p[0];
+                bestPBits[1] = p[1];
+                memcpy(bestIndices, indices, sizeof(indices));
+            }
+        }
+
+        // the first index is stored without its top bit, so it has to be below 8
+        if (bestIndices[0] >= 8) {
+            for (int c = 0; c < 4; c++) {
+                std::swap(bestEndpoints[0][c], bestEndpoints[1][c]);
+            }
+            std::swap(bestPBits[0], bestPBits[1]);
+            for (int i = 0; i < 16; i++) {
+                bestIndices[i] = uint8_t(15 - bestIndices[i]);
+            }
+        }
+
+        memset(block, 0, 16);
+        BitWriter writer { block };
+        writer.Write(1 << 6, 7);
+        for (int c = 0; c < 4; c++) {
+            writer.Write(bestEndpoints[0][c], 7);
+            writer.Write(bestEndpoints[1][c], 7);
+        }
+        writer.Write(bestPBits[0], 1);
+        writer.Write(bestPBits[1], 1);
+        writer.Write(bestIndices[0], 3);
+        for (int i = 1; i < 16; i++) {
+            writer.Write(bestIndices[i], 4);
+        }
+    }
+
+    void DecodeBC1Block(const uint8_t* block, uint8_t* rgba)
+    {
+        uint16_t packed0 = uint16_t(block[0] | block[1] << 8);
+        uint16_t packed1 = uint16_t(block[2] | block[3] << 8);
+        Color565 c0 = Unpack565(packed0);
+        Color565 c1 = Unpack565(packed1);
+
+        int palette[4][4];
+        int e0[3] = { c0.r, c0.g, c0.b };
+        int e1[3] = { c1.r, c1.g, c1.b };
+        for (int c = 0; c < 3; c++) {
+            palette[0][c] = e0[c];
+            palette[1][c] = e1[c];
+            if (packed0 > packed1) {
+                palette[2][c] = (2 * e0[c] + e1[c]) / 3;
+                palette[3][c] = (e0[c] + 2 * e1[c]) / 3;
+            } else {
+                palette[2][c] = (e0[c] + e1[c]) / 2;
+                palette[3][c] = 0;
+            }
+        }
+        palette[0][3] = palette[1][3] = palette[2][3] = 255;
+        palette[3][3] = packed0 > packed1 ? 255 : 0;
+
+        uint32_t indices = uint32_t(block[4] | block[5] << 8 | block[6] << 16 | uint32_t(block[7]) << 24);
+        for (int i = 0; i < 16; i++) {
+            const int* color = palette[indices >> (2 * i) & 3];
+            for (int c = 0; c < 4; c++) {
+                rgba[i * 4 + c] = uint8_t(color[c]);
+            }
+        }
+    }
+
+    void DecodeBC3Block(const uint8_t* block, uint8_t* rgba)
+    {
+        DecodeBC1Block(block + 8, rgba);
+        DecodeBC4(block, 3, rgba);
+    }
+
+    void DecodeBC5Block(const uint8_t* block, uint8_t* rgba)
+    {
+        DecodeBC4(block, 0, rgba);
+        DecodeBC4(block + 8, 1, rgba);
+        for (int i = 0; i < 16; i++) {
+            rgba[i * 4 + 2] = 0;
+            rgba[i * 4 + 3] = 255;
+        }
+    }
+
+    void DecodeBC7Block(const uint8_t* block, uint8_t* rgba)
+    {
+        BitReader reader { block };
+        if (reader.Read(7) != 1 << 6) {
+            for (int i = 0; i < 16; i++) {
+                rgba[i * 4 + 0] = 255;
+                rgba[i * 4 + 1] = 0;
+                rgba[i * 4 + 2] = 255;
+                rgba[i * 4 + 3] = 255;
+            }
+            return;
+        }
+
+        int endpoints[2][4];
+        for (int c = 0; c < 4; c++) {
+            endpoints[0][c] = int(reader.Read(7)) << 1;
+            endpoints[1][c] = int(reader.Read(7)) << 1;
+        }
+        int p0 = int(reader.Read(1));
+        int p1 = int(reader.Read(1));
+        for (int c = 0; c < 4; c++) {
+            endpoints[0][c] |= p0;
+            endpoints[1][c] |= p1;
+        }
+
+        for (int i = 0; i < 16; i++) {
+            uint32_t index = reader.Read(i == 0 ? 3 : 4);
+            for (int c = 0; c < 4; c++) {
+                rgba[i * 4 + c] = uint8_t(BC7Interpolate(endpoints[0][c], endpoints[1][c], BC7Weights4[index]));
+            }
+        }
+    }
+
+    void CompressBlockRows(TextureFormat format, const uint8_t* rgba, uint32_t width, uint32_t height,
+        uint32_t firstRow, uint32_t rowCount, uint8_t* out)
+    {
+        void (*encode)(const uint8_t*, uint8_t*);
+        switch (format) {
+        case TextureFormat::BC1:
+        case TextureFormat::BC1_SRGB:
+            encode = EncodeBC1Block;
+            break;
+        case TextureFormat::BC3:
+        case TextureFormat::BC3_SRGB:
+            encode = EncodeBC3Block;
+            break;
+        case TextureFormat::BC5:
+            encode = EncodeBC5Block;
+            break;
+        case TextureFormat::BC7:
+        case TextureFormat::BC7_SRGB:
+            encode = EncodeBC7Block;
+            break;
+        default:
+            return;
+        }
+
+        const uint32_t blockSize = TextureBlockSize(format);
+        const uint32_t blocksX = (width + 3) / 4;
+
+        uint8_t pixels[64];
+        for (uint32_t by = firstRow; by < firstRow + rowCount; by++) {
+            for (uint32_t bx = 0; bx < blocksX; bx++) {
+                for (uint32_t y = 0; y < 4; y++) {
+                    uint32_t sy = std::min(by * 4 + y, height - 1);
+                    for (uint32_t x = 0; x < 4; x++) {
+                        uint32_t sx = std::min(bx * 4 + x, width - 1);
+                        memcpy(&pixels[(y * 4 + x) * 4], &rgba[(size_t(sy) * width + sx) * 4], 4);
+                    }
+                }
+                encode(pixels, out + (size_t(by) * blocksX + bx) * blockSize);
+            }
+        }
+    }
+
+    void DecompressLevel(TextureFormat format, const uint8_t* data, uint32_t width, uint32_t height, uint8_t* rgba)
+    {
+        if (!IsBlockCompressed(format)) {
+            memcpy(rgba, data, size_t(width) * height * 4);
+            return;
+        }
+
+        void (*decode)(const uint8_t*, uint8_t*);
+        switch (format) {
+        case TextureFormat::BC1:
+        case TextureFormat::BC1_SRGB:
+            decode = DecodeBC1Block;
+            break;
+        case TextureFormat::BC3:
+        case TextureFormat::BC3_SRGB:
+            decode = DecodeBC3Block;
+            break;
+        case TextureFormat::BC5:
+            decode = DecodeBC5Block;
+            break;
+        default:
+            decode = DecodeBC7Block;
+            break;
+        }
+
+        const uint32_t blockSize = TextureBlockSize(format);
+        const uint32_t blocksX = (width + 3) / 4;
+        const uint32_t blocksY = (height + 3) / 4;
+
+        uint8_t pixels[64];
+        for (uint32_t by = 0; by < blocksY; by++) {
+            for (uint32_t bx = 0; bx < blocksX; bx++) {
+                decode(data + (size_t(by) * blocksX + bx) * blockSize, pixels);
+                for (uint32_t y = 0; y < 4 && by * 4 + y < height; y++) {
+                    for (uint32_t x = 0; x < 4 && bx * 4 + x < width; x++) {
+                        memcpy(&rgba[(size_t(by * 4 + y) * width + bx * 4 + x) * 4], &pixels[(y * 4 + x) * 4], 4);
+                    }
+                }
+            }
+        }
+    }
+
+    void DownsampleLevel(const uint8_t* rgba, uint32_t width, uint32_t height, bool srgb, uint8_t* out)
+    {
+        static const SrgbTable table;
+
+        const uint32_t outWidth = MipExtent(width, 1);
+        const uint32_t outHeight = MipExtent(height, 1);
+
+        for (uint32_t y = 0; y < outHeight; y++) {
+            for (uint32_t x = 0; x < outWidth; x++) {
+                // a dimension of 1 stays, the same pixel is read twice
+                uint32_t x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+                uint32_t y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+                const uint8_t* p[4] = {
+                    &rgba[(size_t(y0) * width + x0) * 4],
+                    &rgba[(size_t(y0) * width + x1) * 4],
+                    &rgba[(size_t(y1) * width + x0) * 4],
+                    &rgba[(size_t(y1) * width + x1) * 4],
+                };
+
+                uint8_t* result = &out[(size_t(y) * outWidth + x) * 4];
+                for (int c = 0; c < 4; c++) {
+                    if (srgb && c < 3) {
+                        float sum = table.toLinear[p[0][c]] + table.toLinear[p[1][c]] + table.toLinear[p[2][c]] + table.toLinear[p[3][c]];
+                        result[c] = uint8_t(std::lround(LinearToSrgb(sum * 0.25f) * 255.f));
+                    } else {
+                        result[c] = uint8_t((p[0][c] + p[1][c] + p[2][c] + p[3][c] + 2) / 4);
+                    }
+                }
+            }
+        }
+    }
+} // namespace Quasar
@@ -0,0 +1,42 @@
+#pragma once
+
+// CPU encoders and decoders for the BCn block formats, used by the TextureConverter
+// tool at build time and by the engine for textures that come without a
+// compressed asset. Only fixed size types, like TextureFormat.h.
+//
+// Blocks are 4x4 pixels. Pixels are RGBA8, row major.
+
+#include "TextureFormat.h"
+
+namespace Quasar
+{
+    // one block of 16 RGBA8 pixels to 8 (BC1) or 16 bytes. BC1 is written in its
+    // opaque four color mode, BC5 takes red and green, and BC7 uses mode 6: one
+    // RGBA endpoint pair with 4 bit indices, good for color with and without alpha
+    void EncodeBC1Block(const uint8_t* rgba, uint8_t* block);
+    void EncodeBC3Block(const uint8_t* rgba, uint8_t* block);
+    void EncodeBC5Block(const uint8_t* rgba, uint8_t* block);
+    void EncodeBC7Block(const uint8_t* rgba, uint8_t* block);
+
+    // Back to 16 RGBA8 pixels, for devices that can't sample the format. The BC7
+    // decoder only reads mode 6, the mode EncodeBC7Block writes, and returns
+    // magenta for blocks in other modes
+    void DecodeBC1Block(const uint8_t* block, uint8_t* rgba);
+    void DecodeBC3Block(const uint8_t* block, uint8_t* rgba);
+    void DecodeBC5Block(const uint8_t* block, uint8_t* rgba);
+    void DecodeBC7Block(const uint8_t* block, uint8_t* rgba);
+
+    // Encodes the block rows [firstRow, firstRow + rowCount) of a width x height
+    // RGBA8 image, edge blocks repeat the last pixel. out is the whole level,
+    // TextureLevelSize bytes. Rows are independent, so callers can split a level
+    // across threads
+    void CompressBlockRows(TextureFormat format, const uint8_t* rgba, uint32_t width, uint32_t height,
+        uint32_t firstRow, uint32_t rowCount, uint8_t* out);
+
+    // decodes a whole level to width x height RGBA8 pixels
+    void DecompressLevel(TextureFormat format, const uint8_t* data, uint32_t width, uint32_t height, uint8_t* rgba);
+
+    // the next mip of a width x height RGBA8 image, averaging 2x2 pixels. Color is
+    // averaged in linear space when srgb is set
+    void DownsampleLevel(const uint8_t* rgba, uint32_t width, uint32_t height, bool srgb, uint8_t* out);
+} // namespace Quasar
@@ -0,0 +1,98 @@
+#pragma once
+
+// Binary mesh asset (.qmesh), written by the MeshConverter tool and mapped
+// straight into memory by the engine. Only fixed size types, so the converter
+// can use it without the rest of the engine.
+//
+// Layout, every block starting at a 16 byte aligned offset:
+//
+//   MeshFileHeader
+//   MeshFileSubmesh[submeshCount]
+//   vertices, vertexCount * sizeof(MeshFileVertex), same layout as Renderer::Vertex
+//   indices, indexCount * indexSize, 16 bit when every index fits
+//
+// All values are little endian.
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Quasar
+{
+    constexpr uint32_t MeshFileMagic = 0x48534D51; // "QMSH"
+    constexpr uint32_t MeshFileVersion = 1;
+    constexpr uint64_t MeshFileAlignment = 16;
+
+    struct MeshFileBounds {
+        float origin[3];
+        float sphereRadius;
+        // half size of the box around origin
+        float extents[3];
+        float pad;
+    };
+
+    struct MeshFileSubmesh {
+        uint32_t firstIndex;
+        uint32_t indexCount;
+        // material of the source primitive or OBJ shape, for the importer to resolve
+        uint32_t materialSlot;
+        uint32_t pad;
+        MeshFileBounds bounds;
+    };
+
+    struct MeshFileVertex {
+        float position[3];
+        float uv_x;
+        float normal[3];
+        float uv_y;
+        float color[4];
+    };
+
+    struct MeshFileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        // 2 or 4
+        uint32_t indexSize;
+        uint32_t submeshCount;
+        // byte offsets from the start of the file
+        uint64_t submeshOffset;
+        uint64_t vertexOffset;
+        uint64_t indexOffset;
+        uint64_t fileSize;
+        MeshFileBounds bounds;
+    };
+
+    static_assert(sizeof(MeshFileBounds) == 32);
+    static_assert(sizeof(MeshFileSubmesh) == 48);
+    static_assert(sizeof(MeshFileVertex) == 48);
+    static_assert(sizeof(MeshFileHeader) == 88);
+
+    inline uint64_t MeshFileAlign(uint64_t offset)
+    {
+        return (offset + MeshFileAlignment - 1) & ~(MeshFileAlignment - 1);
+    }
+
+    // true when every block of the header lies inside size bytes and is aligned
+    inline bool ValidateMeshFile(const void* data, uint64_t size)
+    {
+        if (size < sizeof(MeshFileHeader)) {
+            return false;
+        }
+
+        const MeshFileHeader* header = static_cast<const MeshFileHeader*>(data);
+        if (header->magic != MeshFileMagic || header->version != MeshFileVersion || header->fileSize != size) {
+            return false;
+        }
+        if (header->indexSize != 2 && header->indexSize != 4) {
+            return false;
+        }
+
+        auto inside = [&](uint64_t offset, uint64_t bytes) {
+            return offset % MeshFileAlignment == 0 && offset <= size && bytes <= size - offset;
+        };
+        return inside(header->submeshOffset, uint64_t(header->submeshCount) * sizeof(MeshFileSubmesh))
+            && inside(header->vertexOffset, uint64_t(header->vertexCount) * sizeof(MeshFileVertex))
+            && inside(header->indexOffset, uint64_t(header->indexCount) * header->indexSize);
+    }
+} // namespace Quasar
@@ -0,0 +1,575 @@
+#include "MeshOptimizer.h"
+
+#include <glm/glm.hpp>
+#include <glm/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace Quasar
+{
+    namespace
+    {
+        // Forsyth's tuning. Vertices of the last triangle score a little lower than
+        // the rest of the front of the cache, so the next triangle doesn't just
+        // repeat its edge, and vertices with few triangles left get a boost so
+        // they are finished off instead of leaving lone triangles behind
+        constexpr float CacheDecayPower = 1.5f;
+        constexpr float LastTriangleScore = 0.75f;
+        constexpr float ValenceBoostScale = 2.0f;
+        constexpr float ValenceBoostPower = 0.5f;
+
+        constexpr uint32_t MaxValenceScore = 32;
+        constexpr uint32_t NoTriangle = ~0u;
+
+        struct ScoreTables {
+            float cache[VertexCacheSize];
+            float valence[MaxValenceScore];
+
+            ScoreTables()
+            {
+                for (uint32_t i = 0; i < VertexCacheSize; i++) {
+                    if (i < 3) {
+                        cache[i] = LastTriangleScore;
+                    } else {
+                        const float scaler = 1.f / float(VertexCacheSize - 3);
+                        cache[i] = powf(1.f - float(i - 3) * scaler, CacheDecayPower);
+                    }
+                }
+                valence[0] = 0.f;
+                for (uint32_t i = 1; i < MaxValenceScore; i++) {
+                    valence[i] = ValenceBoostScale * powf(float(i), -ValenceBoostPower);
+                }
+            }
+        };
+
+        const ScoreTables& Tables()
+        {
+            static const ScoreTables tables;
+            return tables;
+        }
+
+        float VertexScore(int32_t cachePosition, uint32_t remainingTriangles)
+        {
+            // no triangles left, nothing to gain from the vertex
+            if (remainingTriangles == 0) {
+                return -1.f;
+            }
+
+            const ScoreTables& tables = Tables();
+            float score = cachePosition >= 0 ? tables.cache[cachePosition] : 0.f;
+            if (remainingTriangles < MaxValenceScore) {
+                score += tables.valence[remainingTriangles];
+            } else {
+                score += ValenceBoostScale * powf(float(remainingTriangles), -ValenceBoostPower);
+            }
+            return score;
+        }
+
+        // symmetric 4x4 error quadric of a set of planes, weighted by triangle area
+        struct Quadric {
+            double a00, a01, a02, a11, a12, a22;
+            double b0, b1, b2;
+            double c;
+            double weight;
+        };
+
+        void QuadricAdd(Quadric& q, const Quadric& r)
+        {
+            q.a00 += r.a00;
+            q.a01 += r.a01;
+            q.a02 += r.a02;
+            q.a11 += r.a11;
+            q.a12 += r.a12;
+            q.a22 += r.a22;
+            q.b0 += r.b0;
+            q.b1 += r.b1;
+            q.b2 += r.b2;
+            q.c += r.c;
+            q.weight += r.weight;
+        }
+
+        Quadric PlaneQuadric(glm::dvec3 n, double d, double weight)
+        {
+            Quadric q;
+            q.a00 = weight * n.x * n.x;
+            q.a01 = weight * n.x * n.y;
+            q.a02 = weight * n.x * n.z;
+            q.a11 = weight * n.y * n.y;
+            q.a12 = weight * n.y * n.z;
+            q.a22 = weight * n.z * n.z;
+            q.b0 = weight * n.x * d;
+            q.b1 = weight * n.y * d;
+            q.b2 = weight * n.z * d;
+            q.c = weight * d * d;
+            q.weight = weight;
+            return q;
+        }
+
+        // weighted mean of the squared distances from p to the planes
+        double QuadricError(const Quadric& q, glm::dvec3 p)
+        {
+            double rx = q.a00 * p.x + q.a01 * p.y + q.a02 * p.z;
+            double ry = q.a01 * p.x + q.a11 * p.y + q.a12 * p.z;
+            double rz = q.a02 * p.x + q.a12 * p.y + q.a22 * p.z;
+            double error = p.x * rx + p.y * ry + p.z * rz + 2.0 * (q.b0 * p.x + q.b1 * p.y + q.b2 * p.z) + q.c;
+            return q.weight > 0.0 ? fabs(error) / q.weight : 0.0;
+        }
+
+        struct Collapse {
+            // source is a vertex of its own position, target keeps the index the
+            // edge's triangles use, so the right side of a seam is kept
+            uint32_t source;
+            uint32_t target;
+            float error;
+        };
+
+        // [-1, 1] on both axes, the lower hemisphere folded over the diagonals
+        glm::vec2 OctahedralEncode(glm::vec3 n)
+        {
+            float sum = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+            if (sum == 0.f) {
+                return glm::vec2(0.f);
+            }
+
+            glm::vec2 p = glm::vec2(n.x, n.y) / sum;
+            if (n.z < 0.f) {
+                glm::vec2 sign(p.x >= 0.f ? 1.f : -1.f, p.y >= 0.f ? 1.f : -1.f);
+                p = (1.f - glm::abs(glm::vec2(p.y, p.x))) * sign;
+            }
+            return p;
+        }
+    } // namespace
+
+    void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount)
+    {
+        const size_t triangleCount = indexCount / 3;
+        if (triangleCount == 0) {
+            return;
+        }
+
+        // triangles of every vertex, the first remaining[v] of them not emitted yet
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (size_t i = 0; i < triangleCount * 3; i++) {
+            remaining[indices[i]]++;
+        }
+
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (size_t v = 0; v < vertexCount; v++) {
+            offsets[v + 1] = offsets[v] + remaining[v];
+        }
+
+        std::vector<uint32_t> adjacency(triangleCount * 3);
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; t++) {
+                for (size_t k = 0; k < 3; k++) {
+                    adjacency[fill[indices[t * 3 + k]]++] = uint32_t(t);
+                }
+            }
+        }
+
+        std::vector<int32_t> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScores(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++) {
+            vertexScores[v] = VertexScore(-1, remaining[v]);
+        }
+
+        std::vector<float> triangleScores(triangleCount);
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        uint32_t best = 0;
+        for (size_t t = 0; t < triangleCount; t++) {
+            const uint32_t* tri = &indices[t * 3];
+            triangleScores[t] = vertexScores[tri[0]] + vertexScores[tri[1]] + vertexScores[tri[2]];
+            if (triangleScores[t] > triangleScores[best]) {
+                best = uint32_t(t);
+            }
+        }
+
+        // the cache holds up to VertexCacheSize vertices, the extra 3 slots catch
+        // what the newest triangle pushes out so its scores can drop
+        uint32_t cache[VertexCacheSize + 3];
+        uint32_t cacheCount = 0;
+
+        std::vector<uint32_t> output(triangleCount * 3);
+        size_t deadEndCursor = 0;
+
+        for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++) {
+            // dead end, nothing in the cache has triangles left. Continue with the
+            // next triangle in input order
+            if (best == NoTriangle) {
+                while (emitted[deadEndCursor]) {
+                    deadEndCursor++;
+                }
+                best = uint32_t(deadEndCursor);
+            }
+
+            const uint32_t tri[3] = { indices[best * 3], indices[best * 3 + 1], indices[best * 3 + 2] };
+            memcpy(&output[emittedCount * 3], tri, sizeof(tri));
+            emitted[best] = 1;
+
+            // take the triangle out of its vertices' remaining lists
+            for (uint32_t v : tri) {
+                uint32_t* list = &adjacency[offsets[v]];
+                uint32_t count = remaining[v];
+                for (uint32_t i = 0; i < count; i++) {
+                    if (list[i] == best) {
+                        list[i] = list[count - 1];
+                        remaining[v]--;
+                        break;
+                    }
+                }
+            }
+
+            // the triangle's vertices move to the front of the cache
+            uint32_t newCache[VertexCacheSize + 3];
+            uint32_t newCount = 0;
+            for (uint32_t v : tri) {
+                if (std::find(newCache, newCache + newCount, v) == newCache + newCount) {
+                    newCache[newCount++] = v;
+                }
+            }
+            for (uint32_t i = 0; i < cacheCount; i++) {
+                uint32_t v = cache[i];
+                if (v != tri[0] && v != tri[1] && v != tri[2]) {
+                    newCache[newCount++] = v;
+                }
+            }
+
+            // rescore everything whose cache position changed, including the
+            // vertices that fell out, and pick the best triangle around the cache
+            best = NoTriangle;
+            float bestScore = -1.f;
+            for (uint32_t i = 0; i < newCount; i++) {
+                uint32_t v = newCache[i];
+                int32_t position = i < VertexCacheSize ? int32_t(i) : -1;
+                cachePosition[v] = position;
+
+                float score = VertexScore(position, remaining[v]);
+                float delta = score - vertexScores[v];
+                vertexScores[v] = score;
+
+                const uint32_t* list = &adjacency[offsets[v]];
+                for (uint32_t j = 0; j < remaining[v]; j++) {
+                    uint32_t t = list[j];
+                    triangleScores[t] += delta;
+                    if (position >= 0 && triangleScores[t] > bestScore) {
+                        bestScore = triangleScores[t];
+                        best = t;
+                    }
+                }
+            }
+
+            cacheCount = std::min(newCount, VertexCacheSize);
+            memcpy(cache, newCache, cacheCount * sizeof(uint32_t));
+        }
+
+        memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+    }
+
+    size_t SimplifyMesh(uint32_t* destination, const uint32_t* indices, size_t indexCount, const float* positions,
+        size_t vertexCount, size_t vertexStride, size_t targetIndexCount, float maxError, float* resultError)
+    {
+        std::vector<glm::dvec3> position(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++) {
+            const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + v * vertexStride);
+            position[v] = glm::dvec3(p[0], p[1], p[2]);
+        }
+
+        // vertices at the same position are one vertex of the topology, the first
+        // of them stands in for the rest
+        std::vector<uint32_t> canonical(vertexCount);
+        std::vector<uint8_t> locked(vertexCount, 0);
+        {
+            std::vector<uint32_t> order(vertexCount);
+            for (size_t v = 0; v < vertexCount; v++) {
+                order[v] = uint32_t(v);
+            }
+            auto less = [&](uint32_t a, uint32_t b) {
+                const glm::dvec3& pa = position[a];
+                const glm::dvec3& pb = position[b];
+                return pa.x != pb.x ? pa.x < pb.x : pa.y != pb.y ? pa.y < pb.y : pa.z != pb.z ? pa.z < pb.z : a < b;
+            };
+            std::sort(order.begin(), order.end(), less);
+
+            for (size_t i = 0; i < vertexCount;) {
+                size_t end = i + 1;
+                while (end < vertexCount && position[order[end]] == position[order[i]]) {
+                    end++;
+                }
+                for (size_t j = i; j < end; j++) {
+                    canonical[order[j]] = order[i];
+                    // a seam, moving one side would tear it
+                    locked[order[j]] = end - i > 1;
+                }
+                i = end;
+            }
+        }
+
+        const size_t triangleCount = indexCount / 3;
+
+        std::vector<Quadric> quadrics(vertexCount, Quadric {});
+        std::vector<uint64_t> edges;
+        edges.reserve(triangleCount * 3);
+        for (size_t t = 0; t < triangleCount; t++) {
+            const uint32_t c[3] = { canonical[indices[t * 3]], canonical[indices[t * 3 + 1]], canonical[indices[t * 3 + 2]] };
+
+            glm::dvec3 n = glm::cross(position[c[1]] - position[c[0]], position[c[2]] - position[c[0]]);
+            double length = glm::length(n);
+            if (length > 0.0) {
+                n /= length;
+                Quadric q = PlaneQuadric(n, -glm::dot(n, position[c[0]]), length * 0.5);
+                for (uint32_t v : c) {
+                    QuadricAdd(quadrics[v], q);
+                }
+            }
+
+            for (int k = 0; k < 3; k++) {
+                uint32_t a = c[k];
+                uint32_t b = c[(k + 1) % 3];
+                if (a != b) {
+                    edges.push_back(uint64_t(std::min(a, b)) << 32 | std::max(a, b));
+                }
+            }
+        }
+
+        // an edge with one triangle is on the border, its vertices stay
+        std::sort(edges.begin(), edges.end());
+        for (size_t i = 0; i < edges.size();) {
+            size_t end = i + 1;
+            while (end < edges.size() && edges[end] == edges[i]) {
+                end++;
+            }
+            if (end - i == 1) {
+                locked[uint32_t(edges[i] >> 32)] = 1;
+                locked[uint32_t(edges[i])] = 1;
+            }
+            i = end;
+        }
+
+        std::vector<uint32_t> result(indices, indices + triangleCount * 3);
+        const double errorLimit = double(maxError) * double(maxError);
+        double largestError = 0.0;
+
+        std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+        std::vector<uint32_t> adjacency;
+        std::vector<Collapse> collapses;
+        std::vector<uint8_t> touched(vertexCount);
+        std::vector<uint32_t> remap(vertexCount, ~0u);
+
+        // every pass collapses the cheapest edges that don't share a neighbourhood,
+        // so each decision sees up to date geometry, then rebuilds the index list
+        while (result.size() > targetIndexCount) {
+            const size_t currentTriangles = result.size() / 3;
+
+            std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+            for (uint32_t index : result) {
+                adjacencyOffsets[canonical[index] + 1]++;
+            }
+            for (size_t v = 0; v < vertexCount; v++) {
+                adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+            }
+            adjacency.resize(result.size());
+            {
+                std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t t = 0; t < currentTriangles; t++) {
+                    for (int k = 0; k < 3; k++) {
+                        adjacency[fill[canonical[result[t * 3 + k]]]++] = uint32_t(t);
+                    }
+                }
+            }
+
+            collapses.clear();
+            for (size_t t = 0; t < currentTriangles; t++) {
+                for (int k = 0; k < 3; k++) {
+                    uint32_t i0 = result[t * 3 + k];
+                    uint32_t i1 = result[t * 3 + (k + 1) % 3];
+                    uint32_t c0 = canonical[i0];
+                    uint32_t c1 = canonical[i1];
+                    if (c0 == c1) {
+                        continue;
+                    }
+
+                    Quadric q = quadrics[c0];
+                    QuadricAdd(q, quadrics[c1]);
+                    if (!locked[c0]) {
+                        collapses.push_back({ c0, i1, float(QuadricError(q, position[c1])) });
+                    }
+                    if (!locked[c1]) {
+                        collapses.push_back({ c1, i0, float(QuadricError(q, position[c0])) });
+                    }
+                }
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+            std::fill(touched.begin(), touched.end(), 0);
+            const size_t triangleBudget = (result.size() - targetIndexCount) / 3;
+            size_t removed = 0;
+            size_t applied = 0;
+
+            for (const Collapse& collapse : collapses) {
+                if (collapse.error > errorLimit || removed >= triangleBudget) {
+                    break;
+                }
+
+                const uint32_t source = collapse.source;
+                const uint32_t target = canonical[collapse.target];
+                if (touched[source] || touched[target]) {
+                    continue;
+                }
+
+                // the triangles around source that stay must not turn over
+                bool flips = false;
+                size_t dying = 0;
+                for (uint32_t a = adjacencyOffsets[source]; a < adjacencyOffsets[source + 1] && !flips; a++) {
+                    const uint32_t* tri = &result[adjacency[a] * 3];
+                    const uint32_t c[3] = { canonical[tri[0]], canonical[tri[1]], canonical[tri[2]] };
+                    if (c[0] == target || c[1] == target || c[2] == target) {
+                        dying++;
+                        continue;
+                    }
+
+                    glm::dvec3 p[3] = { position[c[0]], position[c[1]], position[c[2]] };
+                    glm::dvec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    for (int k = 0; k < 3; k++) {
+                        if (c[k] == source) {
+                            p[k] = position[target];
+                        }
+                    }
+                    glm::dvec3 after = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    flips = glm::dot(before, after) <= 0.0;
+                }
+                if (flips) {
+                    continue;
+                }
+
+                remap[source] = collapse.target;
+                QuadricAdd(quadrics[target], quadrics[source]);
+                largestError = std::max(largestError, double(collapse.error));
+                removed += dying;
+                applied++;
+
+                // the neighbourhood is settled for this pass
+                touched[target] = 1;
+                for (uint32_t a = adjacencyOffsets[source]; a < adjacencyOffsets[source + 1]; a++) {
+                    const uint32_t* tri = &result[adjacency[a] * 3];
+                    touched[canonical[tri[0]]] = 1;
+                    touched[canonical[tri[1]]] = 1;
+                    touched[canonical[tri[2]]] = 1;
+                }
+            }
+
+            if (applied == 0) {
+                break;
+            }
+
+            // sources have a position of their own, so their index is their canonical one
+            size_t write = 0;
+            for (size_t t = 0; t < currentTriangles; t++) {
+                uint32_t tri[3];
+                for (int k = 0; k < 3; k++) {
+                    uint32_t index = result[t * 3 + k];
+                    tri[k] = remap[index] != ~0u ? remap[index] : index;
+                }
+
+                uint32_t c0 = canonical[tri[0]], c1 = canonical[tri[1]], c2 = canonical[tri[2]];
+                if (c0 != c1 && c1 != c2 && c0 != c2) {
+                    memcpy(&result[write], tri, sizeof(tri));
+                    write += 3;
+                }
+            }
+            result.resize(write);
+
+            for (const Collapse& collapse : collapses) {
+                remap[collapse.source] = ~0u;
+            }
+        }
+
+        memcpy(destination, result.data(), result.size() * sizeof(uint32_t));
+        if (resultError) {
+            *resultError = float(sqrt(largestError));
+        }
+        return result.size();
+    }
+
+    size_t OptimizeVertexFetch(void* vertices, size_t vertexCount, size_t vertexSize, uint32_t* indices, size_t indexCount)
+    {
+        std::vector<uint32_t> remap(vertexCount, ~0u);
+        uint32_t next = 0;
+        for (size_t i = 0; i < indexCount; i++) {
+            uint32_t& slot = remap[indices[i]];
+            if (slot == ~0u) {
+                slot = next++;
+            }
+            indices[i] = slot;
+        }
+
+        std::vector<uint8_t> source(static_cast<uint8_t*>(vertices), static_cast<uint8_t*>(vertices) + vertexCount * vertexSize);
+        uint8_t* destination = static_cast<uint8_t*>(vertices);
+        for (size_t v = 0; v < vertexCount; v++) {
+            if (remap[v] != ~0u) {
+                memcpy(destination + remap[v] * vertexSize, source.data() + v * vertexSize, vertexSize);
+            }
+        }
+
+        return next;
+    }
+
+    float AverageCacheMissRatio(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+    {
+        if (indexCount < 3) {
+            return 0.f;
+        }
+
+        // a vertex is cached while fewer than cacheSize misses happened since its own
+        std::vector<uint32_t> insertedAt(vertexCount, 0);
+        uint32_t time = cacheSize + 1;
+        uint32_t misses = 0;
+        for (size_t i = 0; i < indexCount; i++) {
+            uint32_t v = indices[i];
+            if (time - insertedAt[v] > cacheSize) {
+                insertedAt[v] = time++;
+                misses++;
+            }
+        }
+
+        return float(misses) / float(indexCount / 3);
+    }
+
+    void QuantizeVertices(const MeshFileVertex* vertices, size_t count, QuantizedVertexHeader& header, QuantizedVertex* out)
+    {
+        glm::vec3 minPosition(0.f);
+        glm::vec3 maxPosition(0.f);
+        if (count > 0) {
+            minPosition = maxPosition = glm::vec3(vertices[0].position[0], vertices[0].position[1], vertices[0].position[2]);
+        }
+        for (size_t i = 1; i < count; i++) {
+            glm::vec3 p(vertices[i].position[0], vertices[i].position[1], vertices[i].position[2]);
+            minPosition = glm::min(minPosition, p);
+            maxPosition = glm::max(maxPosition, p);
+        }
+
+        // a flat axis still needs a scale to divide by
+        glm::vec3 scale = glm::max(maxPosition - minPosition, glm::vec3(1e-20f));
+
+        header = {};
+        memcpy(header.positionOffset, &minPosition, sizeof(minPosition));
+        memcpy(header.positionScale, &scale, sizeof(scale));
+
+        for (size_t i = 0; i < count; i++) {
+            const MeshFileVertex& v = vertices[i];
+
+            glm::vec3 p = (glm::vec3(v.position[0], v.position[1], v.position[2]) - minPosition) / scale;
+            glm::vec3 n(v.normal[0], v.normal[1], v.normal[2]);
+
+            QuantizedVertex& q = out[i];
+            q.positionXY = glm::packUnorm2x16(glm::vec2(p.x, p.y));
+            q.positionZ = glm::packUnorm2x16(glm::vec2(p.z, 0.f));
+            q.normal = glm::packSnorm2x16(OctahedralEncode(n));
+            q.uv = glm::packHalf2x16(glm::vec2(v.uv_x, v.uv_y));
+            q.color = glm::packUnorm4x8(glm::vec4(v.color[0], v.color[1], v.color[2], v.color[3]));
+        }
+    }
+} // namespace Quasar
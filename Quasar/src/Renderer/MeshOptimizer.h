@@ -0,0 +1,70 @@
+#pragma once
+
+// Import time mesh processing, run by the engine's importers and the MeshConverter
+// tool. Works on plain index and vertex arrays with fixed size types, so the
+// converter can build it without the rest of the engine.
+
+#include "MeshFormat.h"
+
+namespace Quasar
+{
+    // post-transform cache size the optimizer scores against. Smaller hardware
+    // caches still get most of the benefit, the ordering degrades gracefully
+    constexpr uint32_t VertexCacheSize = 32;
+
+    // Reorders the triangles of indices for the post-transform vertex cache with
+    // Tom Forsyth's linear speed algorithm. Triangles stay inside the given range,
+    // so run it once per submesh to keep the submesh ranges intact. Every index has
+    // to be below vertexCount.
+    void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount);
+
+    // Reorders vertices in the order indices first reference them, so vertex fetch
+    // walks memory forward, and rewrites indices to match. Vertices no index uses
+    // are dropped. Returns the new vertex count.
+    size_t OptimizeVertexFetch(void* vertices, size_t vertexCount, size_t vertexSize, uint32_t* indices, size_t indexCount);
+
+    // Simplifies the triangles of indices towards targetIndexCount with edge
+    // collapses in order of quadric error (Garland and Heckbert). A vertex collapses
+    // onto one of its neighbours, so the result indexes the same vertex buffer.
+    // Vertices on mesh borders and vertices sharing their position with another
+    // (attribute seams) never move, so LODs don't crack open.
+    //
+    // positions points at the first vertex's x, y and z, vertexStride bytes apart.
+    // No collapse is made with an error above maxError, the distance to the
+    // original surface in object space units. destination needs room for
+    // indexCount indices. Returns the result's index count, resultError gets the
+    // largest error of a collapse that was made.
+    size_t SimplifyMesh(uint32_t* destination, const uint32_t* indices, size_t indexCount, const float* positions,
+        size_t vertexCount, size_t vertexStride, size_t targetIndexCount, float maxError, float* resultError = nullptr);
+
+    // average vertex shader invocations per triangle for a FIFO cache of cacheSize.
+    // 3 means no reuse at all, well ordered regular meshes get close to 0.5
+    float AverageCacheMissRatio(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = 16);
+
+    // Compact vertex, 20 bytes instead of the 48 of MeshFileVertex. Mirrors
+    // QuantizedVertex in scene.glsl, which unpacks it with the GLSL unpack functions.
+    struct QuantizedVertex {
+        // 16 bit unorm position inside the mesh bounds, x and y
+        uint32_t positionXY;
+        // z in the low half, the high half is unused
+        uint32_t positionZ;
+        // octahedral encoded unit normal, 2x16 bit snorm
+        uint32_t normal;
+        // 2x half float
+        uint32_t uv;
+        // 4x8 bit unorm
+        uint32_t color;
+    };
+
+    // first thing in a quantized vertex buffer, position = offset + unorm * scale
+    struct QuantizedVertexHeader {
+        float positionOffset[4];
+        float positionScale[4];
+    };
+
+    static_assert(sizeof(QuantizedVertex) == 20);
+    static_assert(sizeof(QuantizedVertexHeader) == 32);
+
+    // fills header with the bounds of vertices and out with count quantized vertices
+    void QuantizeVertices(const MeshFileVertex* vertices, size_t count, QuantizedVertexHeader& header, QuantizedVertex* out);
+} // namespace Quasar
@@ -0,0 +1,171 @@
+#pragma once
+
+// Compressed texture assets are KTX2 files (https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html),
+// written by the TextureConverter tool and mapped straight into memory by the
+// engine. Only what the engine reads and writes is described here: one 2D image,
+// no array layers or faces, no supercompression, BCn or RGBA8 payloads. Only fixed
+// size types, so the converter can use it without the rest of the engine.
+//
+// Layout:
+//
+//   Ktx2Header
+//   Ktx2Level[levelCount], mip 0 first
+//   data format descriptor
+//   mip levels, smallest first, each at a multiple of the block size
+//
+// All values are little endian.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace Quasar
+{
+    // the VkFormat values of the payloads, so the converter needs no vulkan headers
+    enum class TextureFormat : uint32_t {
+        RGBA8 = 37,       // VK_FORMAT_R8G8B8A8_UNORM
+        RGBA8_SRGB = 43,  // VK_FORMAT_R8G8B8A8_SRGB
+        BC1 = 133,        // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        BC1_SRGB = 134,   // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        BC3 = 137,        // VK_FORMAT_BC3_UNORM_BLOCK
+        BC3_SRGB = 138,   // VK_FORMAT_BC3_SRGB_BLOCK
+        BC5 = 141,        // VK_FORMAT_BC5_UNORM_BLOCK
+        BC7 = 145,        // VK_FORMAT_BC7_UNORM_BLOCK
+        BC7_SRGB = 146,   // VK_FORMAT_BC7_SRGB_BLOCK
+    };
+
+    constexpr uint8_t Ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    struct Ktx2Header {
+        uint8_t identifier[12];
+        uint32_t vkFormat;
+        uint32_t typeSize;
+        uint32_t pixelWidth;
+        uint32_t pixelHeight;
+        uint32_t pixelDepth;
+        uint32_t layerCount;
+        uint32_t faceCount;
+        uint32_t levelCount;
+        uint32_t supercompressionScheme;
+        // byte offsets from the start of the file
+        uint32_t dfdByteOffset;
+        uint32_t dfdByteLength;
+        uint32_t kvdByteOffset;
+        uint32_t kvdByteLength;
+        uint64_t sgdByteOffset;
+        uint64_t sgdByteLength;
+    };
+
+    struct Ktx2Level {
+        uint64_t byteOffset;
+        uint64_t byteLength;
+        uint64_t uncompressedByteLength;
+    };
+
+    static_assert(sizeof(Ktx2Header) == 80);
+    static_assert(sizeof(Ktx2Level) == 24);
+
+    inline bool IsBlockCompressed(TextureFormat format)
+    {
+        return format != TextureFormat::RGBA8 && format != TextureFormat::RGBA8_SRGB;
+    }
+
+    inline bool IsSrgb(TextureFormat format)
+    {
+        return format == TextureFormat::RGBA8_SRGB || format == TextureFormat::BC1_SRGB || format == TextureFormat::BC3_SRGB
+            || format == TextureFormat::BC7_SRGB;
+    }
+
+    // bytes per 4x4 block, or per pixel for RGBA8
+    inline uint32_t TextureBlockSize(TextureFormat format)
+    {
+        switch (format) {
+        case TextureFormat::BC1:
+        case TextureFormat::BC1_SRGB:
+            return 8;
+        case TextureFormat::RGBA8:
+        case TextureFormat::RGBA8_SRGB:
+            return 4;
+        default:
+            return 16;
+        }
+    }
+
+    inline uint32_t MipExtent(uint32_t extent, uint32_t level)
+    {
+        uint32_t mip = extent >> level;
+        return mip > 0 ? mip : 1;
+    }
+
+    inline uint32_t MipLevelCount(uint32_t width, uint32_t height)
+    {
+        uint32_t levels = 1;
+        while ((width | height) >> levels) {
+            levels++;
+        }
+        return levels;
+    }
+
+    inline uint64_t TextureLevelSize(TextureFormat format, uint32_t width, uint32_t height)
+    {
+        if (!IsBlockCompressed(format)) {
+            return uint64_t(width) * height * 4;
+        }
+        return uint64_t((width + 3) / 4) * ((height + 3) / 4) * TextureBlockSize(format);
+    }
+
+    // true when the file is a 2D KTX2 image this engine can read, with every level
+    // inside size bytes
+    inline bool ValidateKtx2(const void* data, uint64_t size)
+    {
+        if (size < sizeof(Ktx2Header)) {
+            return false;
+        }
+
+        Ktx2Header header;
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.identifier, Ktx2Identifier, sizeof(Ktx2Identifier)) != 0) {
+            return false;
+        }
+        if (header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelDepth > 1 || header.layerCount > 1
+            || header.faceCount != 1 || header.supercompressionScheme != 0) {
+            return false;
+        }
+
+        TextureFormat format = TextureFormat(header.vkFormat);
+        switch (format) {
+        case TextureFormat::RGBA8:
+        case TextureFormat::RGBA8_SRGB:
+        case TextureFormat::BC1:
+        case TextureFormat::BC1_SRGB:
+        case TextureFormat::BC3:
+        case TextureFormat::BC3_SRGB:
+        case TextureFormat::BC5:
+        case TextureFormat::BC7:
+        case TextureFormat::BC7_SRGB:
+            break;
+        default:
+            return false;
+        }
+
+        // 0 asks the reader to generate the mips, the engine doesn't
+        uint32_t levelCount = header.levelCount;
+        if (levelCount == 0 || levelCount > MipLevelCount(header.pixelWidth, header.pixelHeight)) {
+            return false;
+        }
+        if (size < sizeof(Ktx2Header) + uint64_t(levelCount) * sizeof(Ktx2Level)) {
+            return false;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (uint32_t i = 0; i < levelCount; i++) {
+            Ktx2Level level;
+            memcpy(&level, bytes + sizeof(Ktx2Header) + i * sizeof(Ktx2Level), sizeof(level));
+            uint64_t expected = TextureLevelSize(format, MipExtent(header.pixelWidth, i), MipExtent(header.pixelHeight, i));
+            if (level.byteLength != expected || level.byteOffset > size || level.byteLength > size - level.byteOffset) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace Quasar
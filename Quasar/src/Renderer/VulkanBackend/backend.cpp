@@ -5,15 +5,28 @@
 #include "vk_initializers.h"
 #include "vk_types.h"
 #include "vk_images.h"
+#include "vk_descriptor_buffer.h"
+#include "vk_pipelines.h"
 
 #include <VkBootstrap.h>
+#include <glm/packing.hpp>
 #include <array>
 #include <thread>
 #include <chrono>
 
+#define VMA_IMPLEMENTATION
+#include "vk_mem_alloc.h"
+
 namespace Quasar::Renderer {
 constexpr bool bUseValidationLayers = false;
 
+// mesh shaders include scene.glsl in both stages, so both see the push constants
+constexpr VkShaderStageFlags MeshPushConstantStages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+// view distances of the reversed-Z projection
+constexpr float NearPlane = 0.1f;
+constexpr float FarPlane = 10000.f;
+
 b8 Backend::init()
 {
     _window = QS_MAIN_WINDOW.GetGLFWwindow();
@@ -22,6 +35,15 @@ b8 Backend::init()
 	init_swapchain();
 	init_commands();
 	init_sync_structures();
+	init_descriptors();
+	init_uniform_ring();
+	init_render_graph();
+	init_pipelines();
+
+	init_default_data();
+
+	mainCamera.velocity = glm::vec3(0.f);
+	mainCamera.position = glm::vec3(0.f, 0.f, 5.f);
 
 	//everything went fine
 	_isInitialized = true;
@@ -41,22 +63,47 @@ void Backend::destroy_swapchain()
 void Backend::shutdown()
 {
     if (_isInitialized) {
+
+		//scenes still streaming have workers holding on to them, let those finish
+		auto loading = [&]() {
+			for (auto& [name, scene] : loadedScenes) {
+				if (!scene->is_loaded()) {
+					return true;
+				}
+			}
+			return false;
+		};
+		while (loading()) {
+			_uploads.flush();
+			std::this_thread::yield();
+		}
 		
 		//make sure the gpu has stopped doing its things
 		vkDeviceWaitIdle(_device);
 
+		loadedScenes.clear();
+
 		for (int i = 0; i < FRAME_OVERLAP; i++) {
 		
 			vkDestroyCommandPool(_device, _frames[i]._commandPool, nullptr);
 
 			//destroy sync objects
-			vkDestroyFence(_device, _frames[i]._renderFence, nullptr);
 			vkDestroySemaphore(_device, _frames[i]._renderSemaphore, nullptr);
 			vkDestroySemaphore(_device ,_frames[i]._swapchainSemaphore, nullptr);
+
+			_frames[i]._frameDescriptors->destroy();
 		}
 
+		vkDestroySemaphore(_device, _frameTimeline, nullptr);
+		vkDestroySemaphore(_device, _graphicsTimeline, nullptr);
+
+		_mainDeletionQueue.flush();
+
 		destroy_swapchain();
 
+		_bindless.cleanup();
+		_layoutCache.cleanup();
+
 		vkDestroySurfaceKHR(_instance, _surface, nullptr);
 
 		vkDestroyDevice(_device, nullptr);
@@ -70,10 +117,69 @@ void Backend::shutdown()
 void Backend::draw()
 {
     //> draw_1
-        // wait until the gpu has finished rendering the last frame. Timeout of 1
-        // second
-        VK_CHECK(vkWaitForFences(_device, 1, &get_current_frame()._renderFence, true, 1000000000));
-        VK_CHECK(vkResetFences(_device, 1, &get_current_frame()._renderFence));
+        // wait until the gpu has finished the frame that last used this slot
+        if (_frameNumber >= FRAME_OVERLAP) {
+            wait_for_frame(_frameNumber - FRAME_OVERLAP);
+        }
+        _asyncCompute.begin_frame(_frameNumber % FRAME_OVERLAP);
+
+        // every bindless index released up to the last completed frame can be
+        // handed out again
+        if (uint64_t completed = completed_frame_count(); completed > 0) {
+            _bindless.collect(completed - 1);
+            _materials.collect(completed - 1);
+            _textures.collect(completed - 1);
+        }
+
+        // publish finished uploads, and send the ones queued since last frame
+        // ahead of this frame's work
+        _uploads.poll();
+        _uploads.submit();
+
+        // nothing from the previous use of this slot is in flight anymore
+        get_current_frame()._frameDescriptors->reset();
+
+        update_scene();
+        update_texture_streaming();
+
+        //render at a fraction of the window, the blit scales it back up
+        renderScale = std::clamp(renderScale, 0.1f, 1.f);
+        _drawExtent.width = uint32_t(std::min(_swapchainExtent.width, _drawImage.imageExtent.width) * renderScale);
+        _drawExtent.height = uint32_t(std::min(_swapchainExtent.height, _drawImage.imageExtent.height) * renderScale);
+
+        // same for this slot's share of the uniform ring
+        _uniformRing.begin_frame(_frameNumber % FRAME_OVERLAP);
+
+        // the light grid follows the draw extent, and the scene data points the
+        // shaders at it and at the shadow cascades
+        _clusteredLighting.begin_frame(_frameNumber % FRAME_OVERLAP, mainDrawContext.Lights);
+        _clusteredLighting.update_scene_data(sceneData, _drawExtent, NearPlane, FarPlane);
+        _cascadedShadows.update(sceneData, _uniformRing, mainDrawContext.OpaqueSurfaces, NearPlane);
+
+        get_current_frame()._sceneDataBuffer = _uniformRing.push(sceneData);
+
+        // this slot's cull stats are complete now, and the new bounds go up
+        _culledObjectCount = _drawCuller.begin_frame(_frameNumber % FRAME_OVERLAP, mainDrawContext.OpaqueSurfaces);
+        if (_frameNumber >= FRAME_OVERLAP && _frameNumber % StatsLogInterval == 0) {
+            log_frame_stats();
+        }
+
+        GPUCullData cullData;
+        cullData.view = sceneData.view;
+        cullData.P00 = sceneData.proj[0][0];
+        // undo the y flip, the shader works with y up
+        cullData.P11 = -sceneData.proj[1][1];
+        cullData.P22 = sceneData.proj[2][2];
+        cullData.P32 = sceneData.proj[3][2];
+        cullData.znear = NearPlane;
+        cullData.zfar = FarPlane;
+        cullData.pyramidWidth = (float)_depthPyramidExtent.width;
+        cullData.pyramidHeight = (float)_depthPyramidExtent.height;
+        cullData.objectCount = _culledObjectCount;
+        cullData.occlusionEnabled = occlusionCulling ? 1 : 0;
+        RingAllocation cullDataBuffer = _uniformRing.push(cullData);
+
+        _renderGraph.begin_frame(_frameNumber, _frameNumber % FRAME_OVERLAP);
     //< draw_1
 
 
@@ -101,21 +207,171 @@ void Backend::draw()
     // 
     //> draw_4
 
-        //make the swapchain image into writeable mode before rendering
-        vkutil::transition_image(cmd, _swapchainImages[swapchainImageIndex], VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
-
-        //make a clear-color from frame number. This will flash with a 120 frame period.
-        VkClearColorValue clearValue;
-        float flash = std::abs(std::sin(_frameNumber / 120.f));
-        clearValue = { { 0.0f, 0.0f, flash, 1.0f } };
-
-        VkImageSubresourceRange clearRange = vkinit::image_subresource_range(VK_IMAGE_ASPECT_COLOR_BIT);
-
-        //clear image
-        vkCmdClearColorImage(cmd, _swapchainImages[swapchainImageIndex], VK_IMAGE_LAYOUT_GENERAL, &clearValue, 1, &clearRange);
+        //the acquired image has undefined contents, and the acquire semaphore is
+        //waited on at the color output stage, so every use has to come after it
+        TrackedImage& swapchainImage = _swapchainImageStates[swapchainImageIndex];
+        swapchainImage.reset(VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT);
+
+        RenderGraph::Resource swapchainTarget = _renderGraph.import_image("swapchain", swapchainImage,
+            _swapchainImageViews[swapchainImageIndex], VkExtent3D { _swapchainExtent.width, _swapchainExtent.height, 1 });
+        RenderGraph::Resource drawTarget = _renderGraph.import_image("draw image", _drawImageState, _drawImage.imageView, _drawImage.imageExtent);
+
+        RGImageDesc depthDesc;
+        depthDesc.format = _depthFormat;
+        depthDesc.extent = _drawImage.imageExtent;
+        depthDesc.aspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+        RenderGraph::Resource depthTarget = _renderGraph.create_image("depth", depthDesc);
+        RenderGraph::Resource depthPyramid = _renderGraph.import_image("depth pyramid", _depthPyramidState, _depthPyramid.imageView, _depthPyramid.imageExtent);
+
+        RenderGraph::Resource visibility = _renderGraph.import_buffer("visibility", _drawCuller.visibility());
+        RenderGraph::Resource earlyDraws = _renderGraph.import_buffer("early draws", _drawCuller.draw_commands(CullPhase::Early));
+        RenderGraph::Resource lateDraws = _renderGraph.import_buffer("late draws", _drawCuller.draw_commands(CullPhase::Late));
+        RenderGraph::Resource finalDraws = _renderGraph.import_buffer("final draws", _drawCuller.final_commands());
+        RenderGraph::Resource cullStats = _renderGraph.import_buffer("cull stats", _drawCuller.stats_buffer());
+
+        RenderGraph::Resource clusterGrid = _renderGraph.import_buffer("cluster grid", _clusteredLighting.cluster_grid());
+        RenderGraph::Resource lightIndices = _renderGraph.import_buffer("light indices", _clusteredLighting.light_indices());
+        RenderGraph::Resource lightStats = _renderGraph.import_buffer("light stats", _clusteredLighting.stats_buffer());
+
+        RenderGraph::Resource shadowMap = _renderGraph.import_image("shadow map", _cascadedShadows.shadow_map(),
+            VK_NULL_HANDLE, VkExtent3D { CascadedShadows::ShadowMapSize, CascadedShadows::ShadowMapSize, 1 });
+
+        //cascades that are still cached keep their layer as it is
+        _renderGraph.add_pass("shadow cascades", [&](RenderGraph::PassBuilder& pass) {
+            pass.write(shadowMap, ResourceAccess::DepthAttachmentWrite);
+        }, [this](VkCommandBuffer cmd, const RenderGraph& graph) {
+            _cascadedShadows.render(cmd, mainDrawContext.OpaqueSurfaces);
+        });
+
+        VkDeviceAddress sceneDataAddress = get_current_frame()._sceneDataBuffer.address;
+        _renderGraph.add_pass("light clusters", [&](RenderGraph::PassBuilder& pass) {
+            pass.async_compute();
+            pass.write(clusterGrid, ResourceAccess::ComputeShaderWrite);
+            pass.write(lightIndices, ResourceAccess::ComputeShaderWrite);
+            pass.write(lightStats, ResourceAccess::ComputeShaderReadWrite);
+        }, [this, sceneDataAddress](VkCommandBuffer cmd, const RenderGraph& graph) {
+            _clusteredLighting.build(cmd, sceneDataAddress);
+        });
+
+        VkBuffer earlyBuffer = _drawCuller.draw_commands(CullPhase::Early).buffer;
+        VkBuffer lateBuffer = _drawCuller.draw_commands(CullPhase::Late).buffer;
+        VkBuffer finalBuffer = _drawCuller.final_commands().buffer;
+
+        //phase 1: what was visible last frame
+        _renderGraph.add_pass("cull early", [&](RenderGraph::PassBuilder& pass) {
+            pass.async_compute();
+            pass.read(visibility, ResourceAccess::ComputeShaderRead);
+            //bound but not sampled in this phase, it still needs a valid layout
+            pass.read(depthPyramid, ResourceAccess::ComputeShaderRead);
+            pass.write(earlyDraws, ResourceAccess::ComputeShaderWrite);
+            pass.write(cullStats, ResourceAccess::ComputeShaderReadWrite);
+        }, [this, cullDataBuffer](VkCommandBuffer cmd, const RenderGraph& graph) {
+            _drawCuller.cull(cmd, CullPhase::Early, *get_current_frame()._frameDescriptors, cullDataBuffer, _depthPyramid.imageView);
+        });
+
+        bool prepass = depthPrepass;
+        if (prepass) {
+            _renderGraph.add_pass("depth prepass early", [&](RenderGraph::PassBuilder& pass) {
+                pass.read(earlyDraws, ResourceAccess::IndirectRead);
+                pass.write(depthTarget, ResourceAccess::DepthAttachmentWrite);
+            }, [this, earlyBuffer, depthTarget](VkCommandBuffer cmd, const RenderGraph& graph) {
+                draw_depth_prepass(cmd, graph.view(depthTarget), earlyBuffer, true);
+            });
+        } else {
+            _renderGraph.add_pass("geometry early", [&](RenderGraph::PassBuilder& pass) {
+                pass.read(earlyDraws, ResourceAccess::IndirectRead);
+                pass.read(clusterGrid, ResourceAccess::FragmentShaderRead);
+                pass.read(lightIndices, ResourceAccess::FragmentShaderRead);
+                pass.read(shadowMap, ResourceAccess::FragmentShaderRead);
+                pass.write(drawTarget, ResourceAccess::ColorAttachmentWrite);
+                pass.write(depthTarget, ResourceAccess::DepthAttachmentWrite);
+            }, [this, earlyBuffer, depthTarget](VkCommandBuffer cmd, const RenderGraph& graph) {
+                draw_geometry(cmd, graph.view(depthTarget), earlyBuffer, true, true, false);
+            });
+        }
+
+        _renderGraph.add_pass("depth pyramid", [&](RenderGraph::PassBuilder& pass) {
+            pass.async_compute();
+            pass.read(depthTarget, ResourceAccess::ComputeShaderRead);
+            pass.write(depthPyramid, ResourceAccess::ComputeShaderReadWrite);
+        }, [this, depthTarget](VkCommandBuffer cmd, const RenderGraph& graph) {
+            build_depth_pyramid(cmd, graph.view(depthTarget));
+        });
+
+        //phase 2: everything against the pyramid, drawing what just became visible
+        _renderGraph.add_pass("cull late", [&](RenderGraph::PassBuilder& pass) {
+            pass.async_compute();
+            pass.read(depthPyramid, ResourceAccess::ComputeShaderRead);
+            pass.write(visibility, ResourceAccess::ComputeShaderReadWrite);
+            pass.write(lateDraws, ResourceAccess::ComputeShaderWrite);
+            pass.write(finalDraws, ResourceAccess::ComputeShaderWrite);
+            pass.write(cullStats, ResourceAccess::ComputeShaderReadWrite);
+        }, [this, cullDataBuffer](VkCommandBuffer cmd, const RenderGraph& graph) {
+            _drawCuller.cull(cmd, CullPhase::Late, *get_current_frame()._frameDescriptors, cullDataBuffer, _depthPyramid.imageView);
+        });
+
+        if (prepass) {
+            _renderGraph.add_pass("depth prepass late", [&](RenderGraph::PassBuilder& pass) {
+                pass.read(lateDraws, ResourceAccess::IndirectRead);
+                pass.write(depthTarget, ResourceAccess::DepthAttachmentWrite);
+            }, [this, lateBuffer, depthTarget](VkCommandBuffer cmd, const RenderGraph& graph) {
+                draw_depth_prepass(cmd, graph.view(depthTarget), lateBuffer, false);
+            });
+
+            //depth is complete, shade every visible object once
+            _renderGraph.add_pass("geometry", [&](RenderGraph::PassBuilder& pass) {
+                pass.read(finalDraws, ResourceAccess::IndirectRead);
+                pass.read(clusterGrid, ResourceAccess::FragmentShaderRead);
+                pass.read(lightIndices, ResourceAccess::FragmentShaderRead);
+                pass.read(shadowMap, ResourceAccess::FragmentShaderRead);
+                pass.write(drawTarget, ResourceAccess::ColorAttachmentWrite);
+                pass.write(depthTarget, ResourceAccess::DepthAttachmentWrite);
+            }, [this, finalBuffer, depthTarget](VkCommandBuffer cmd, const RenderGraph& graph) {
+                draw_geometry(cmd, graph.view(depthTarget), finalBuffer, true, false, true);
+            });
+        } else {
+            _renderGraph.add_pass("geometry late", [&](RenderGraph::PassBuilder& pass) {
+                pass.read(lateDraws, ResourceAccess::IndirectRead);
+                pass.read(clusterGrid, ResourceAccess::FragmentShaderRead);
+                pass.read(lightIndices, ResourceAccess::FragmentShaderRead);
+                pass.read(shadowMap, ResourceAccess::FragmentShaderRead);
+                pass.write(drawTarget, ResourceAccess::ColorAttachmentWrite);
+                pass.write(depthTarget, ResourceAccess::DepthAttachmentWrite);
+            }, [this, lateBuffer, depthTarget](VkCommandBuffer cmd, const RenderGraph& graph) {
+                draw_geometry(cmd, graph.view(depthTarget), lateBuffer, false, false, true);
+            });
+        }
+
+        VkExtent2D drawExtent = _drawExtent;
+        VkExtent2D swapchainExtent = _swapchainExtent;
+        _renderGraph.add_pass("blit to swapchain", [&](RenderGraph::PassBuilder& pass) {
+            pass.read(drawTarget, ResourceAccess::TransferRead);
+            pass.write(swapchainTarget, ResourceAccess::TransferWrite);
+        }, [=](VkCommandBuffer cmd, const RenderGraph& graph) {
+            vkutil::copy_image_to_image(cmd, graph.image(drawTarget), graph.image(swapchainTarget), drawExtent, swapchainExtent);
+        });
+
+        _renderGraph.compile();
+
+        //the segments are submitted while the graph executes, so everything the
+        //frame pushed has to be visible by then
+        _uniformRing.flush();
+
+        uint64_t computeWaitValue;
+        VkPipelineStageFlags2 computeWaitStage;
+        cmd = execute_render_graph(cmd, computeWaitValue, computeWaitStage);
+
+        //the scene submits its objects again for the next frame
+        _lodTrianglesSaved = mainDrawContext.fullTriangles - mainDrawContext.drawnTriangles;
+        mainDrawContext.OpaqueSurfaces.clear();
+        mainDrawContext.TransparentSurfaces.clear();
+        mainDrawContext.Lights.clear();
+        mainDrawContext.fullTriangles = 0;
+        mainDrawContext.drawnTriangles = 0;
 
         //make the swapchain image into presentable mode
-        vkutil::transition_image(cmd, _swapchainImages[swapchainImageIndex],VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+        _barriers.image(swapchainImage, ResourceAccess::Present);
+        _barriers.flush(cmd);
 
         //finalize the command buffer (we can no longer add commands, but it can now be executed)
         VK_CHECK(vkEndCommandBuffer(cmd));
@@ -129,13 +385,32 @@ void Backend::draw()
         VkCommandBufferSubmitInfo cmdinfo = vkinit::command_buffer_submit_info(cmd);	
         
         VkSemaphoreSubmitInfo waitInfo = vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR,get_current_frame()._swapchainSemaphore);
-        VkSemaphoreSubmitInfo signalInfo = vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT, get_current_frame()._renderSemaphore);	
+        //ALL_COMMANDS so the signal also waits for transfers and the final present transition
+        VkSemaphoreSubmitInfo signalInfo = vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, get_current_frame()._renderSemaphore);	
+
+        //the frame timeline is signaled together with the binary semaphore for present,
+        //and the graphics timeline for next frame's compute work
+        std::array<VkSemaphoreSubmitInfo, 3> signalInfos = { signalInfo,
+            vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, _frameTimeline),
+            vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, _graphicsTimeline) };
+        signalInfos[1].value = uint64_t(_frameNumber) + 1;
+        signalInfos[2].value = ++_graphicsSubmitted;
         
         VkSubmitInfo2 submit = vkinit::submit_info(&cmdinfo,&signalInfo,&waitInfo);	
+        submit.signalSemaphoreInfoCount = (uint32_t)signalInfos.size();
+        submit.pSignalSemaphoreInfos = signalInfos.data();
+
+        //wait for compute work submitted this frame as well, if there was any
+        std::array<VkSemaphoreSubmitInfo, 2> waitInfos = { waitInfo };
+        if (computeWaitValue != 0) {
+            waitInfos[1] = _asyncCompute.wait_info(computeWaitValue, computeWaitStage);
+            submit.waitSemaphoreInfoCount = 2;
+            submit.pWaitSemaphoreInfos = waitInfos.data();
+        }
 
         //submit command buffer to the queue and execute it.
-        // _renderFence will now block until the graphic commands finish execution
-        VK_CHECK(vkQueueSubmit2(_graphicsQueue, 1, &submit, get_current_frame()._renderFence));
+        //_frameTimeline reaches _frameNumber + 1 once the graphic commands finish execution
+        VK_CHECK(vkQueueSubmit2(_graphicsQueue, 1, &submit, VK_NULL_HANDLE));
     //< draw_5
     // 
     //> draw_6
@@ -196,12 +471,30 @@ void Backend::init_vulkan()
 	VkPhysicalDeviceVulkan12Features features12{};
 	features12.bufferDeviceAddress = true;
 	features12.descriptorIndexing = true;
+	// bindless resource arrays
+	features12.runtimeDescriptorArray = true;
+	features12.descriptorBindingPartiallyBound = true;
+	features12.descriptorBindingUpdateUnusedWhilePending = true;
+	features12.descriptorBindingSampledImageUpdateAfterBind = true;
+	features12.descriptorBindingStorageBufferUpdateAfterBind = true;
+	features12.shaderSampledImageArrayNonUniformIndexing = true;
+	features12.shaderStorageBufferArrayNonUniformIndexing = true;
+	// cross-queue sync for async compute
+	features12.timelineSemaphore = true;
+	// min reduction sampler for the depth pyramid
+	features12.samplerFilterMinmax = true;
+
+	//vulkan 1.0 features
+	VkPhysicalDeviceFeatures features10{};
+	// the depth pyramid levels are an array of storage images
+	features10.shaderStorageImageArrayDynamicIndexing = true;
 
 	//use vkbootstrap to select a gpu. 
 	//We want a gpu that can write to the GLFW surface and supports vulkan 1.3 with the correct features
 	vkb::PhysicalDeviceSelector selector{ vkb_inst };
 	vkb::PhysicalDevice physicalDevice = selector
 		.set_minimum_version(1, 3)
+		.set_required_features(features10)
 		.set_required_features_13(features)
 		.set_required_features_12(features12)
 		.set_surface(_surface)
@@ -209,21 +502,74 @@ void Backend::init_vulkan()
 		.value();
 
 
+	//descriptor buffers are optional, transient descriptors fall back to pools without them
+	VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT};
+	descriptorBufferFeatures.descriptorBuffer = true;
+	_descriptorBufferSupported = DescriptorBufferAllocator::is_supported(physicalDevice.physical_device)
+		&& physicalDevice.enable_extension_if_present(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+	//block compressed textures are optional too, the texture loader decodes them to RGBA8 without
+	VkPhysicalDeviceFeatures compressionFeatures{};
+	compressionFeatures.textureCompressionBC = true;
+	_textureCompressionBC = physicalDevice.enable_features_if_present(compressionFeatures);
+
+	//real heap budgets for the texture streamer, vma estimates them without
+	_memoryBudgetSupported = physicalDevice.enable_extension_if_present(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
 	//create the final vulkan device
 	vkb::DeviceBuilder deviceBuilder{ physicalDevice };
+	if (_descriptorBufferSupported) {
+		deviceBuilder.add_pNext(&descriptorBufferFeatures);
+	}
 
 	vkb::Device vkbDevice = deviceBuilder.build().value();
 
 	// Get the VkDevice handle used in the rest of a vulkan application
 	_device = vkbDevice.device;
 	_chosenGPU = physicalDevice.physical_device;
+
+	_layoutCache.init(_device);
+	_bindless.init(_device, _chosenGPU, _layoutCache);
 //< init_device
 
 //> init_queue
 	// use vkbootstrap to get a Graphics queue
 	_graphicsQueue = vkbDevice.get_queue(vkb::QueueType::graphics).value();
 	_graphicsQueueFamily = vkbDevice.get_queue_index(vkb::QueueType::graphics).value();
+
+	// prefer a compute-only family, then any family apart from graphics, and
+	// share the graphics queue when there is nothing else
+	auto computeQueue = vkbDevice.get_dedicated_queue(vkb::QueueType::compute);
+	auto computeIndex = vkbDevice.get_dedicated_queue_index(vkb::QueueType::compute);
+	if (!computeQueue) {
+		computeQueue = vkbDevice.get_queue(vkb::QueueType::compute);
+		computeIndex = vkbDevice.get_queue_index(vkb::QueueType::compute);
+	}
+	if (computeQueue && computeIndex) {
+		_computeQueue = computeQueue.value();
+		_computeQueueFamily = computeIndex.value();
+	} else {
+		_computeQueue = _graphicsQueue;
+		_computeQueueFamily = _graphicsQueueFamily;
+	}
 //< init_queue
+
+//> vma_init
+	// initialize the memory allocator
+	VmaAllocatorCreateInfo allocatorInfo = {};
+	allocatorInfo.physicalDevice = _chosenGPU;
+	allocatorInfo.device = _device;
+	allocatorInfo.instance = _instance;
+	allocatorInfo.flags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+	if (_memoryBudgetSupported) {
+		allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+	}
+	vmaCreateAllocator(&allocatorInfo, &_allocator);
+
+	_mainDeletionQueue.push_function([&]() {
+		vmaDestroyAllocator(_allocator);
+	});
+//< vma_init
 }
 
 //> init_swap
@@ -248,12 +594,90 @@ void Backend::create_swapchain(uint32_t width, uint32_t height)
 	_swapchain = vkbSwapchain.swapchain;
 	_swapchainImages = vkbSwapchain.get_images().value();
 	_swapchainImageViews = vkbSwapchain.get_image_views().value();
+
+	_swapchainImageStates.resize(_swapchainImages.size());
+	for (size_t i = 0; i < _swapchainImages.size(); i++) {
+		_swapchainImageStates[i].init(_swapchainImages[i], VK_IMAGE_ASPECT_COLOR_BIT);
+	}
 }
 
 void Backend::init_swapchain()
 {
 	create_swapchain(_windowExtent.width, _windowExtent.height);
+
+	//draw image size will match the window
+	VkExtent3D drawImageExtent = {
+		_windowExtent.width,
+		_windowExtent.height,
+		1
+	};
+
+	//hardcoding the draw format to 16 bit float, for hdr
+	VkImageUsageFlags drawImageUsages{};
+	drawImageUsages |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	drawImageUsages |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+	drawImageUsages |= VK_IMAGE_USAGE_STORAGE_BIT;
+	drawImageUsages |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+	_drawImage = create_image(drawImageExtent, VK_FORMAT_R16G16B16A16_SFLOAT, drawImageUsages);
+	_drawImageState.init(_drawImage.image, VK_IMAGE_ASPECT_COLOR_BIT);
+
+	//add to deletion queues
+	_mainDeletionQueue.push_function([=]() {
+		destroy_image(_drawImage);
+	});
+
+	create_depth_pyramid();
+}
+
+//> depth_pyramid
+static uint32_t previous_pow2(uint32_t v)
+{
+	uint32_t result = 1;
+	while (result * 2 <= v) {
+		result *= 2;
+	}
+	return result;
 }
+
+void Backend::create_depth_pyramid()
+{
+	//a power of two keeps every level exactly half the one above it, so each
+	//texel covers a clean 2x2 footprint of its parent.
+	//the single pass reduction handles up to MaxDepthPyramidLevels levels
+	uint32_t maxSize = 1u << (MaxDepthPyramidLevels - 1);
+	_depthPyramidExtent.width = std::min(previous_pow2(_drawImage.imageExtent.width), maxSize);
+	_depthPyramidExtent.height = std::min(previous_pow2(_drawImage.imageExtent.height), maxSize);
+
+	VkExtent3D pyramidExtent = { _depthPyramidExtent.width, _depthPyramidExtent.height, 1 };
+	_depthPyramid = create_image(pyramidExtent, VK_FORMAT_R32_SFLOAT,
+		VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, true);
+	_depthPyramidLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(pyramidExtent.width, pyramidExtent.height)))) + 1;
+	_depthPyramidState.init(_depthPyramid.image, VK_IMAGE_ASPECT_COLOR_BIT, _depthPyramidLevels);
+
+	//one view per level for the reduction to write through
+	_depthPyramidMips.resize(_depthPyramidLevels);
+	for (uint32_t i = 0; i < _depthPyramidLevels; i++) {
+		VkImageViewCreateInfo viewInfo = vkinit::imageview_create_info(VK_FORMAT_R32_SFLOAT, _depthPyramid.image, VK_IMAGE_ASPECT_COLOR_BIT);
+		viewInfo.subresourceRange.baseMipLevel = i;
+		viewInfo.subresourceRange.levelCount = 1;
+		VK_CHECK(vkCreateImageView(_device, &viewInfo, nullptr, &_depthPyramidMips[i]));
+	}
+
+	//zero, and the last workgroup of every reduction leaves it at zero again
+	_depthPyramidCounter = create_buffer(sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU);
+	memset(_depthPyramidCounter.info.pMappedData, 0, sizeof(uint32_t));
+	vmaFlushAllocation(_allocator, _depthPyramidCounter.allocation, 0, VK_WHOLE_SIZE);
+
+	_mainDeletionQueue.push_function([=]() {
+		for (VkImageView view : _depthPyramidMips) {
+			vkDestroyImageView(_device, view, nullptr);
+		}
+		destroy_image(_depthPyramid);
+		destroy_buffer(_depthPyramidCounter);
+	});
+}
+//< depth_pyramid
 //< init_swap
 
 //> init_cmd
@@ -272,6 +696,23 @@ void Backend::init_commands()
 
 		VK_CHECK(vkAllocateCommandBuffers(_device, &cmdAllocInfo, &_frames[i]._mainCommandBuffer));
 	}
+
+	_asyncCompute.init(_device, _computeQueue, _computeQueueFamily, _graphicsQueueFamily, FRAME_OVERLAP);
+
+	VK_CHECK(vkCreateCommandPool(_device, &commandPoolInfo, nullptr, &_immCommandPool));
+
+	// allocate the command buffer for immediate submits
+	VkCommandBufferAllocateInfo immCmdAllocInfo = vkinit::command_buffer_allocate_info(_immCommandPool, 1);
+
+	VK_CHECK(vkAllocateCommandBuffers(_device, &immCmdAllocInfo, &_immCommandBuffer));
+
+	_uploads.init(_device, _allocator, _graphicsQueue, _graphicsQueueFamily);
+
+	_mainDeletionQueue.push_function([&]() {
+		vkDestroyCommandPool(_device, _immCommandPool, nullptr);
+		_asyncCompute.destroy();
+		_uploads.destroy();
+	});
 }
 //< init_cmd
 
@@ -279,18 +720,965 @@ void Backend::init_commands()
 void Backend::init_sync_structures()
 {
 	//create syncronization structures
-	//one fence to control when the gpu has finished rendering the frame,
-	//and 2 semaphores to syncronize rendering with swapchain
-	//we want the fence to start signalled so we can wait on it on the first frame
-	VkFenceCreateInfo fenceCreateInfo = vkinit::fence_create_info(VK_FENCE_CREATE_SIGNALED_BIT);
+	//one timeline semaphore counting the frames the gpu has finished,
+	//and 2 semaphores per frame to syncronize rendering with swapchain
+	VkSemaphoreTypeCreateInfo timelineInfo = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO};
+	timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+	timelineInfo.initialValue = 0;
+
+	VkSemaphoreCreateInfo timelineCreateInfo = vkinit::semaphore_create_info();
+	timelineCreateInfo.pNext = &timelineInfo;
+	VK_CHECK(vkCreateSemaphore(_device, &timelineCreateInfo, nullptr, &_frameTimeline));
+	VK_CHECK(vkCreateSemaphore(_device, &timelineCreateInfo, nullptr, &_graphicsTimeline));
+
 	VkSemaphoreCreateInfo semaphoreCreateInfo = vkinit::semaphore_create_info();
 
 	for (int i = 0; i < FRAME_OVERLAP; i++) {
-		VK_CHECK(vkCreateFence(_device, &fenceCreateInfo, nullptr, &_frames[i]._renderFence));
-
 		VK_CHECK(vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &_frames[i]._swapchainSemaphore));
 		VK_CHECK(vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &_frames[i]._renderSemaphore));
 	}
+
+	VkFenceCreateInfo fenceCreateInfo = vkinit::fence_create_info();
+	VK_CHECK(vkCreateFence(_device, &fenceCreateInfo, nullptr, &_immFence));
+	_mainDeletionQueue.push_function([=]() { vkDestroyFence(_device, _immFence, nullptr); });
+}
+
+//> frame_timeline
+bool Backend::is_frame_complete(uint64_t frameNumber) const
+{
+	return completed_frame_count() > frameNumber;
+}
+
+uint64_t Backend::completed_frame_count() const
+{
+	uint64_t value = 0;
+	VK_CHECK(vkGetSemaphoreCounterValue(_device, _frameTimeline, &value));
+	return value;
+}
+
+void Backend::wait_for_frame(uint64_t frameNumber) const
+{
+	uint64_t value = frameNumber + 1;
+
+	VkSemaphoreWaitInfo waitInfo = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
+	waitInfo.semaphoreCount = 1;
+	waitInfo.pSemaphores = &_frameTimeline;
+	waitInfo.pValues = &value;
+	VK_CHECK(vkWaitSemaphores(_device, &waitInfo, UINT64_MAX));
+}
+//< frame_timeline
+
+//> create_buffer
+AllocatedBuffer Backend::create_buffer(size_t allocSize, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage)
+{
+	// allocate buffer
+	VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+	bufferInfo.pNext = nullptr;
+	bufferInfo.size = allocSize;
+
+	bufferInfo.usage = usage;
+
+	VmaAllocationCreateInfo vmaallocInfo = {};
+	vmaallocInfo.usage = memoryUsage;
+	vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+	AllocatedBuffer newBuffer;
+
+	// allocate the buffer
+	VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &newBuffer.buffer, &newBuffer.allocation,
+		&newBuffer.info));
+
+	return newBuffer;
+}
+
+void Backend::destroy_buffer(const AllocatedBuffer& buffer)
+{
+	vmaDestroyBuffer(_allocator, buffer.buffer, buffer.allocation);
+}
+//< create_buffer
+
+//> imm_submit
+void Backend::immediate_submit(std::function<void(VkCommandBuffer cmd)>&& function)
+{
+	VK_CHECK(vkResetFences(_device, 1, &_immFence));
+	VK_CHECK(vkResetCommandBuffer(_immCommandBuffer, 0));
+
+	VkCommandBuffer cmd = _immCommandBuffer;
+
+	VkCommandBufferBeginInfo cmdBeginInfo = vkinit::command_buffer_begin_info(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+	VK_CHECK(vkBeginCommandBuffer(cmd, &cmdBeginInfo));
+
+	function(cmd);
+
+	VK_CHECK(vkEndCommandBuffer(cmd));
+
+	VkCommandBufferSubmitInfo cmdinfo = vkinit::command_buffer_submit_info(cmd);
+	VkSubmitInfo2 submit = vkinit::submit_info(&cmdinfo, nullptr, nullptr);
+
+	// submit command buffer to the queue and execute it.
+	//  _immFence will now block until the commands finish execution
+	VK_CHECK(vkQueueSubmit2(_graphicsQueue, 1, &submit, _immFence));
+
+	VK_CHECK(vkWaitForFences(_device, 1, &_immFence, true, 9999999999));
+}
+//< imm_submit
+
+//> mesh_upload
+GPUMeshBuffers Backend::upload_mesh(std::span<const uint32_t> indices, std::span<const Vertex> vertices)
+{
+	std::span<const uint8_t> indexData(reinterpret_cast<const uint8_t*>(indices.data()), indices.size_bytes());
+	return upload_mesh(indexData, VK_INDEX_TYPE_UINT32, vertices);
+}
+
+GPUMeshBuffers Backend::upload_mesh(const MeshAsset& mesh)
+{
+	return upload_mesh(mesh.index_data(), mesh.index_type(), mesh.vertices());
+}
+
+GPUMeshBuffers Backend::upload_mesh(std::span<const uint8_t> indexData, VkIndexType indexType, std::span<const Vertex> vertices)
+{
+	const size_t vertexBufferSize = vertices.size_bytes();
+	const size_t indexBufferSize = indexData.size_bytes();
+
+	GPUMeshBuffers newSurface = create_mesh_buffers(vertexBufferSize, indexBufferSize, indexType);
+
+	//one staging buffer for both, filled straight from the source memory
+	AllocatedBuffer staging = create_buffer(vertexBufferSize + indexBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
+
+	uint8_t* data = static_cast<uint8_t*>(staging.info.pMappedData);
+	memcpy(data, vertices.data(), vertexBufferSize);
+	memcpy(data + vertexBufferSize, indexData.data(), indexBufferSize);
+
+	immediate_submit([&](VkCommandBuffer cmd) {
+		VkBufferCopy vertexCopy{ 0 };
+		vertexCopy.dstOffset = 0;
+		vertexCopy.srcOffset = 0;
+		vertexCopy.size = vertexBufferSize;
+
+		vkCmdCopyBuffer(cmd, staging.buffer, newSurface.vertexBuffer.buffer, 1, &vertexCopy);
+
+		VkBufferCopy indexCopy{ 0 };
+		indexCopy.dstOffset = 0;
+		indexCopy.srcOffset = vertexBufferSize;
+		indexCopy.size = indexBufferSize;
+
+		vkCmdCopyBuffer(cmd, staging.buffer, newSurface.indexBuffer.buffer, 1, &indexCopy);
+	});
+
+	destroy_buffer(staging);
+
+	return newSurface;
+}
+
+void Backend::destroy_mesh(const GPUMeshBuffers& mesh)
+{
+	destroy_buffer(mesh.indexBuffer);
+	destroy_buffer(mesh.vertexBuffer);
+}
+
+GPUMeshBuffers Backend::create_mesh_buffers(size_t vertexBufferSize, size_t indexBufferSize, VkIndexType indexType)
+{
+	GPUMeshBuffers newSurface;
+	newSurface.indexType = indexType;
+
+	//create vertex buffer
+	newSurface.vertexBuffer = create_buffer(vertexBufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+		VMA_MEMORY_USAGE_GPU_ONLY);
+
+	//find the adress of the vertex buffer
+	VkBufferDeviceAddressInfo deviceAdressInfo{ .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,.buffer = newSurface.vertexBuffer.buffer };
+	newSurface.vertexBufferAddress = vkGetBufferDeviceAddress(_device, &deviceAdressInfo);
+
+	//create index buffer
+	newSurface.indexBuffer = create_buffer(indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VMA_MEMORY_USAGE_GPU_ONLY);
+
+	return newSurface;
+}
+//< mesh_upload
+
+//> create_image
+AllocatedImage Backend::create_image(VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool mipmapped)
+{
+	uint32_t mipLevels = 1;
+	if (mipmapped) {
+		mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(size.width, size.height)))) + 1;
+	}
+	return create_image(size, format, usage, mipLevels);
+}
+
+AllocatedImage Backend::create_image(VkExtent3D size, VkFormat format, VkImageUsageFlags usage, uint32_t mipLevels)
+{
+	AllocatedImage newImage;
+	newImage.imageFormat = format;
+	newImage.imageExtent = size;
+
+	VkImageCreateInfo img_info = vkinit::image_create_info(format, usage, size);
+	img_info.mipLevels = mipLevels;
+
+	// always allocate images on dedicated GPU memory
+	VmaAllocationCreateInfo allocinfo = {};
+	allocinfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+	allocinfo.requiredFlags = VkMemoryPropertyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	// allocate and create the image
+	VK_CHECK(vmaCreateImage(_allocator, &img_info, &allocinfo, &newImage.image, &newImage.allocation, nullptr));
+
+	// if the format is a depth format, we will need to have it use the correct
+	// aspect flag
+	VkImageAspectFlags aspectFlag = VK_IMAGE_ASPECT_COLOR_BIT;
+	if (format == VK_FORMAT_D32_SFLOAT) {
+		aspectFlag = VK_IMAGE_ASPECT_DEPTH_BIT;
+	}
+
+	// build a image-view for the image
+	VkImageViewCreateInfo view_info = vkinit::imageview_create_info(format, newImage.image, aspectFlag);
+	view_info.subresourceRange.levelCount = img_info.mipLevels;
+
+	VK_CHECK(vkCreateImageView(_device, &view_info, nullptr, &newImage.imageView));
+
+	return newImage;
+}
+
+AllocatedImage Backend::create_image(void* data, VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool mipmapped)
+{
+	size_t data_size = size.depth * size.width * size.height * 4;
+	AllocatedBuffer uploadbuffer = create_buffer(data_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU);
+
+	memcpy(uploadbuffer.info.pMappedData, data, data_size);
+
+	AllocatedImage new_image = create_image(size, format, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, mipmapped);
+
+	immediate_submit([&](VkCommandBuffer cmd) {
+		vkutil::transition_image(cmd, new_image.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+		VkBufferImageCopy copyRegion = {};
+		copyRegion.bufferOffset = 0;
+		copyRegion.bufferRowLength = 0;
+		copyRegion.bufferImageHeight = 0;
+
+		copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		copyRegion.imageSubresource.mipLevel = 0;
+		copyRegion.imageSubresource.baseArrayLayer = 0;
+		copyRegion.imageSubresource.layerCount = 1;
+		copyRegion.imageExtent = size;
+
+		// copy the buffer into the image
+		vkCmdCopyBufferToImage(cmd, uploadbuffer.buffer, new_image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+			&copyRegion);
+
+		if (mipmapped) {
+			vkutil::generate_mipmaps(cmd, new_image.image, VkExtent2D { new_image.imageExtent.width, new_image.imageExtent.height });
+		} else {
+			vkutil::transition_image(cmd, new_image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		}
+	});
+
+	destroy_buffer(uploadbuffer);
+
+	return new_image;
+}
+
+void Backend::destroy_image(const AllocatedImage& img)
+{
+	vkDestroyImageView(_device, img.imageView, nullptr);
+	vmaDestroyImage(_allocator, img.image, img.allocation);
+}
+//< create_image
+
+//> transient_descriptors
+Scope<TransientDescriptorAllocator> Backend::create_transient_descriptor_allocator()
+{
+	if (_descriptorBufferSupported) {
+		auto allocator = std::make_unique<DescriptorBufferAllocator>();
+		allocator->init(_device, _chosenGPU, _allocator, 1024 * 1024);
+		return allocator;
+	}
+
+	std::vector<DescriptorAllocatorGrowable::PoolSizeRatio> frameSizes = {
+		{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 3 },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 },
+		{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 3 },
+		{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4 },
+	};
+
+	auto allocator = std::make_unique<PoolTransientDescriptorAllocator>();
+	allocator->init(_device, 1000, frameSizes, &_layoutCache);
+	return allocator;
+}
+//< transient_descriptors
+
+//> submit_compute
+uint64_t Backend::submit_compute(std::function<void(VkCommandBuffer cmd)>&& function, std::span<const VkSemaphoreSubmitInfo> waits)
+{
+	VkCommandBuffer cmd = _asyncCompute.begin();
+	function(cmd);
+	return _asyncCompute.submit(cmd, waits);
+}
+
+uint64_t Backend::submit_graphics(VkCommandBuffer cmd, uint64_t computeWaitValue, VkPipelineStageFlags2 computeWaitStage)
+{
+	VK_CHECK(vkEndCommandBuffer(cmd));
+
+	VkCommandBufferSubmitInfo cmdInfo = vkinit::command_buffer_submit_info(cmd);
+
+	VkSemaphoreSubmitInfo signalInfo = vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, _graphicsTimeline);
+	signalInfo.value = ++_graphicsSubmitted;
+
+	VkSemaphoreSubmitInfo waitInfo = _asyncCompute.wait_info(computeWaitValue, computeWaitStage);
+	VkSubmitInfo2 submit = vkinit::submit_info(&cmdInfo, &signalInfo, computeWaitValue != 0 ? &waitInfo : nullptr);
+
+	VK_CHECK(vkQueueSubmit2(_graphicsQueue, 1, &submit, VK_NULL_HANDLE));
+	return signalInfo.value;
+}
+
+VkCommandBuffer Backend::execute_render_graph(VkCommandBuffer cmd, uint64_t& computeWaitValue, VkPipelineStageFlags2& computeWaitStage)
+{
+	std::span<const RenderGraph::Segment> segments = _renderGraph.segments();
+	_segmentValues.assign(segments.size(), 0);
+
+	//what the other queue submitted before this frame, for resources it used last
+	uint64_t previousGraphics = _graphicsSubmitted;
+	uint64_t previousCompute = _asyncCompute.submitted_value();
+
+	FrameData& frame = get_current_frame();
+	uint32_t segmentCommands = 0;
+	bool graphicsRecorded = false;
+	computeWaitValue = 0;
+	computeWaitStage = VK_PIPELINE_STAGE_2_NONE;
+
+	for (uint32_t s = 0; s < segments.size(); s++) {
+		const RenderGraph::Segment& segment = segments[s];
+
+		uint64_t waitValue = 0;
+		if (segment.waitSegment != INVALID_ID) {
+			waitValue = _segmentValues[segment.waitSegment];
+		} else if (segment.waitPreviousFrame) {
+			waitValue = segment.asyncCompute ? previousGraphics : previousCompute;
+		}
+
+		if (!segment.asyncCompute) {
+			//cmd goes out with the next graphics submit, whichever that is
+			if (waitValue != 0) {
+				computeWaitValue = std::max(computeWaitValue, waitValue);
+				computeWaitStage |= segment.waitStage;
+			}
+			_renderGraph.execute(s, cmd, _barriers);
+			_segmentValues[s] = _graphicsSubmitted + 1;
+			graphicsRecorded = true;
+			continue;
+		}
+
+		//submit the graphics work so far, so the compute work can overlap with it
+		//or wait for it. The frame goes on in a fresh command buffer
+		if (graphicsRecorded) {
+			submit_graphics(cmd, computeWaitValue, computeWaitStage);
+			computeWaitValue = 0;
+			computeWaitStage = VK_PIPELINE_STAGE_2_NONE;
+			graphicsRecorded = false;
+
+			if (segmentCommands == frame._segmentCommandBuffers.size()) {
+				VkCommandBufferAllocateInfo cmdAllocInfo = vkinit::command_buffer_allocate_info(frame._commandPool, 1);
+				VK_CHECK(vkAllocateCommandBuffers(_device, &cmdAllocInfo, &frame._segmentCommandBuffers.emplace_back()));
+			}
+			cmd = frame._segmentCommandBuffers[segmentCommands++];
+			VK_CHECK(vkResetCommandBuffer(cmd, 0));
+			VkCommandBufferBeginInfo cmdBeginInfo = vkinit::command_buffer_begin_info(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+			VK_CHECK(vkBeginCommandBuffer(cmd, &cmdBeginInfo));
+		}
+
+		VkSemaphoreSubmitInfo waitInfo = vkinit::semaphore_submit_info(segment.waitStage, _graphicsTimeline);
+		waitInfo.value = waitValue;
+		_segmentValues[s] = submit_compute([&](VkCommandBuffer computeCmd) {
+			_renderGraph.execute(s, computeCmd, _barriers);
+		}, std::span<const VkSemaphoreSubmitInfo>(&waitInfo, waitValue != 0 ? 1 : 0));
+	}
+
+	//a frame is complete once its compute work is as well
+	uint64_t lastCompute = _asyncCompute.submitted_value();
+	if (lastCompute > std::max(previousCompute, computeWaitValue)) {
+		computeWaitValue = lastCompute;
+		computeWaitStage |= VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+	}
+	return cmd;
+}
+//< submit_compute
+
+//> init_descriptors
+void Backend::init_descriptors()
+{
+	for (int i = 0; i < FRAME_OVERLAP; i++) {
+		_frames[i]._frameDescriptors = create_transient_descriptor_allocator();
+	}
+
+	_materials.init(_device, _allocator, _bindless);
+
+	_mainDeletionQueue.push_function([&]() {
+		_materials.destroy();
+	});
+}
+//< init_descriptors
+
+//> init_uniform_ring
+void Backend::init_uniform_ring()
+{
+	// sized for a few thousand objects worth of per-draw data on every frame in flight
+	_uniformRing.init(_device, _chosenGPU, _allocator, 8 * 1024 * 1024, FRAME_OVERLAP);
+
+	_mainDeletionQueue.push_function([&]() {
+		_uniformRing.destroy();
+	});
+}
+//< init_uniform_ring
+
+//> init_render_graph
+void Backend::init_render_graph()
+{
+	_renderGraph.init(_device, _chosenGPU, _allocator, FRAME_OVERLAP, _graphicsQueueFamily, _computeQueueFamily);
+
+	// the pass timings of every completed frame drive the render scale
+	_renderGraph.timingCallback = [this](std::span<const PassTiming> timings) {
+		_gpuFrameMilliseconds = 0.f;
+		for (const PassTiming& t : timings) {
+			_gpuFrameMilliseconds += t.milliseconds;
+		}
+		if (dynamicResolution) {
+			renderScale = _renderScaleController.update(_gpuFrameMilliseconds);
+		}
+	};
+
+	_mainDeletionQueue.push_function([&]() {
+		_renderGraph.destroy();
+	});
+}
+//< init_render_graph
+
+//> init_pipelines
+// mirrors the push constants of Builtin.DepthReduce.comp.glsl
+struct DepthReducePushConstants {
+	glm::vec2 uvScale;
+	glm::uvec2 size;
+	uint32_t levels;
+	uint32_t groupCount;
+};
+
+void Backend::init_pipelines()
+{
+	// every builtin shader is read in the background at once, while the
+	// pipelines ahead of it are built
+	static constexpr const char* BuiltinShaders[] = {
+		"Assets/shaders/Builtin.DepthPrepass.vert.spv",
+		"Assets/shaders/Builtin.DepthReduce.comp.spv",
+		"Assets/shaders/Builtin.DrawCull.comp.spv",
+		"Assets/shaders/Builtin.Mesh.vert.spv",
+		"Assets/shaders/Builtin.Mesh.frag.spv",
+		"Assets/shaders/Builtin.LightCluster.comp.spv",
+	};
+	vkutil::prefetch_shaders(BuiltinShaders);
+
+	init_depth_prepass_pipeline();
+	init_depth_reduce_pipeline();
+	init_culling();
+	init_mesh_pipelines();
+	init_lighting();
+	init_shadows();
+}
+
+void Backend::init_depth_prepass_pipeline()
+{
+	VkShaderModule prepassVertexShader;
+	ShaderReflection prepassReflection;
+	if (!vkutil::load_shader_module("Assets/shaders/Builtin.DepthPrepass.vert.spv", _device, &prepassVertexShader, &prepassReflection)) {
+		QS_CORE_ERROR("Error when building the depth prepass vertex shader module");
+	}
+
+	_depthPrepassPipeline.layout = vkutil::build_reflected_layout(_layoutCache, std::span(&prepassReflection, 1)).layout;
+
+	PipelineBuilder pipelineBuilder;
+	pipelineBuilder._pipelineLayout = _depthPrepassPipeline.layout;
+	//depth only, no fragment shader and no color attachment
+	pipelineBuilder._shaderStages.push_back(
+		vkinit::pipeline_shader_stage_create_info(VK_SHADER_STAGE_VERTEX_BIT, prepassVertexShader));
+	pipelineBuilder.set_input_topology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+	pipelineBuilder.set_polygon_mode(VK_POLYGON_MODE_FILL);
+	pipelineBuilder.set_cull_mode(VK_CULL_MODE_NONE, VK_FRONT_FACE_CLOCKWISE);
+	pipelineBuilder.set_multisampling_none();
+	pipelineBuilder.disable_blending();
+	pipelineBuilder.enable_depthtest(true, VK_COMPARE_OP_GREATER_OR_EQUAL);
+	pipelineBuilder.set_depth_format(_depthFormat);
+
+	_depthPrepassPipeline.pipeline = pipelineBuilder.build_pipeline(_device);
+
+	vkDestroyShaderModule(_device, prepassVertexShader, nullptr);
+
+	//the layout belongs to the layout cache
+	_mainDeletionQueue.push_function([&]() {
+		vkDestroyPipeline(_device, _depthPrepassPipeline.pipeline, nullptr);
+	});
+}
+
+void Backend::init_depth_reduce_pipeline()
+{
+	VkShaderModule reduceShader;
+	if (!vkutil::load_shader_module("Assets/shaders/Builtin.DepthReduce.comp.spv", _device, &reduceShader)) {
+		QS_CORE_ERROR("Error when building the depth reduce shader module");
+	}
+
+	//the sets come from the per-frame transient allocator, so the layout and the
+	//pipeline take its flags
+	const TransientDescriptorAllocator& frameDescriptors = *_frames[0]._frameDescriptors;
+
+	std::array<VkDescriptorSetLayoutBinding, 3> bindings = {
+		vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_COMPUTE_BIT, 0),
+		vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT, 1),
+		vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 2),
+	};
+	//every level of the pyramid, written in one dispatch
+	bindings[1].descriptorCount = MaxDepthPyramidLevels;
+	_depthReduceLayout = _layoutCache.create_descriptor_layout(bindings, {}, frameDescriptors.layout_create_flags());
+
+	VkPushConstantRange pushConstants = { .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(DepthReducePushConstants) };
+	_depthReducePipeline.layout = _layoutCache.create_pipeline_layout(std::span(&_depthReduceLayout, 1), std::span(&pushConstants, 1));
+
+	VkComputePipelineCreateInfo computePipelineCreateInfo = {.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+	computePipelineCreateInfo.layout = _depthReducePipeline.layout;
+	computePipelineCreateInfo.stage = vkinit::pipeline_shader_stage_create_info(VK_SHADER_STAGE_COMPUTE_BIT, reduceShader);
+	computePipelineCreateInfo.flags = frameDescriptors.pipeline_create_flags();
+
+	VK_CHECK(vkCreateComputePipelines(_device, VK_NULL_HANDLE, 1, &computePipelineCreateInfo, nullptr, &_depthReducePipeline.pipeline));
+
+	vkDestroyShaderModule(_device, reduceShader, nullptr);
+
+	//a linear min sampler returns the farthest reversed-Z depth of the 2x2 texels it touches
+	VkSamplerReductionModeCreateInfo reductionInfo = {.sType = VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO};
+	reductionInfo.reductionMode = VK_SAMPLER_REDUCTION_MODE_MIN;
+
+	VkSamplerCreateInfo samplerInfo = {.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+	samplerInfo.pNext = &reductionInfo;
+	samplerInfo.magFilter = VK_FILTER_LINEAR;
+	samplerInfo.minFilter = VK_FILTER_LINEAR;
+	samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+	samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.minLod = 0.f;
+	samplerInfo.maxLod = 16.f;
+
+	VK_CHECK(vkCreateSampler(_device, &samplerInfo, nullptr, &_depthReductionSampler));
+
+	_mainDeletionQueue.push_function([&]() {
+		vkDestroySampler(_device, _depthReductionSampler, nullptr);
+		vkDestroyPipeline(_device, _depthReducePipeline.pipeline, nullptr);
+	});
+}
+
+void Backend::init_culling()
+{
+	//occlusion tests sample the pyramid with the same min reduction sampler
+	_drawCuller.init(_device, _allocator, _layoutCache, *_frames[0]._frameDescriptors, _depthReductionSampler, FRAME_OVERLAP);
+
+	_mainDeletionQueue.push_function([&]() {
+		_drawCuller.destroy();
+	});
+}
+
+void Backend::init_mesh_pipelines()
+{
+	VkShaderModule meshVertexShader;
+	VkShaderModule meshFragmentShader;
+	std::array<ShaderReflection, 2> meshReflection;
+	if (!vkutil::load_shader_module("Assets/shaders/Builtin.Mesh.vert.spv", _device, &meshVertexShader, &meshReflection[0])) {
+		QS_CORE_ERROR("Error when building the mesh vertex shader module");
+	}
+	if (!vkutil::load_shader_module("Assets/shaders/Builtin.Mesh.frag.spv", _device, &meshFragmentShader, &meshReflection[1])) {
+		QS_CORE_ERROR("Error when building the mesh fragment shader module");
+	}
+
+	//set 0 is the global bindless set
+	VkDescriptorSetLayout bindlessLayout = _bindless.layout;
+	VkPipelineLayout layout = vkutil::build_reflected_layout(_layoutCache, meshReflection, std::span(&bindlessLayout, 1)).layout;
+	_meshPipeline.layout = layout;
+	_transparentMeshPipeline.layout = layout;
+
+	PipelineBuilder pipelineBuilder;
+	pipelineBuilder._pipelineLayout = layout;
+	pipelineBuilder.set_shaders(meshVertexShader, meshFragmentShader);
+	pipelineBuilder.set_input_topology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+	pipelineBuilder.set_polygon_mode(VK_POLYGON_MODE_FILL);
+	pipelineBuilder.set_cull_mode(VK_CULL_MODE_NONE, VK_FRONT_FACE_CLOCKWISE);
+	pipelineBuilder.set_multisampling_none();
+	pipelineBuilder.disable_blending();
+	pipelineBuilder.enable_depthtest(true, VK_COMPARE_OP_GREATER_OR_EQUAL);
+	pipelineBuilder.set_color_attachment_format(_drawImage.imageFormat);
+	pipelineBuilder.set_depth_format(_depthFormat);
+
+	_meshPipeline.pipeline = pipelineBuilder.build_pipeline(_device);
+
+	//transparent surfaces blend on top and leave the depth alone
+	pipelineBuilder.enable_blending_additive();
+	pipelineBuilder.enable_depthtest(false, VK_COMPARE_OP_GREATER_OR_EQUAL);
+
+	_transparentMeshPipeline.pipeline = pipelineBuilder.build_pipeline(_device);
+
+	vkDestroyShaderModule(_device, meshVertexShader, nullptr);
+	vkDestroyShaderModule(_device, meshFragmentShader, nullptr);
+
+	//the layout belongs to the layout cache
+	_mainDeletionQueue.push_function([&]() {
+		vkDestroyPipeline(_device, _meshPipeline.pipeline, nullptr);
+		vkDestroyPipeline(_device, _transparentMeshPipeline.pipeline, nullptr);
+	});
+}
+
+void Backend::init_lighting()
+{
+	_clusteredLighting.init(_device, _allocator, _layoutCache, FRAME_OVERLAP);
+
+	_mainDeletionQueue.push_function([&]() {
+		_clusteredLighting.destroy();
+	});
+}
+
+void Backend::init_shadows()
+{
+	_cascadedShadows.init(_device, _allocator, _layoutCache, _bindless);
+
+	_mainDeletionQueue.push_function([&]() {
+		_cascadedShadows.destroy();
+	});
+}
+//< init_pipelines
+
+//> init_data
+void Backend::init_default_data()
+{
+	//3 default textures, white, grey, black. 1 pixel each
+	uint32_t white = glm::packUnorm4x8(glm::vec4(1, 1, 1, 1));
+	_whiteImage = create_image((void*)&white, VkExtent3D{ 1, 1, 1 }, VK_FORMAT_R8G8B8A8_UNORM,
+		VK_IMAGE_USAGE_SAMPLED_BIT);
+
+	uint32_t grey = glm::packUnorm4x8(glm::vec4(0.66f, 0.66f, 0.66f, 1));
+	_greyImage = create_image((void*)&grey, VkExtent3D{ 1, 1, 1 }, VK_FORMAT_R8G8B8A8_UNORM,
+		VK_IMAGE_USAGE_SAMPLED_BIT);
+
+	uint32_t black = glm::packUnorm4x8(glm::vec4(0, 0, 0, 0));
+	_blackImage = create_image((void*)&black, VkExtent3D{ 1, 1, 1 }, VK_FORMAT_R8G8B8A8_UNORM,
+		VK_IMAGE_USAGE_SAMPLED_BIT);
+
+	//checkerboard image
+	uint32_t magenta = glm::packUnorm4x8(glm::vec4(1, 0, 1, 1));
+	std::array<uint32_t, 16 * 16 > pixels; //for 16x16 checkerboard texture
+	for (int x = 0; x < 16; x++) {
+		for (int y = 0; y < 16; y++) {
+			pixels[y * 16 + x] = ((x % 2) ^ (y % 2)) ? magenta : black;
+		}
+	}
+	_errorCheckerboardImage = create_image(pixels.data(), VkExtent3D{ 16, 16, 1 }, VK_FORMAT_R8G8B8A8_UNORM,
+		VK_IMAGE_USAGE_SAMPLED_BIT);
+
+	_whiteImageIndex = _bindless.register_texture(_whiteImage.imageView);
+	_greyImageIndex = _bindless.register_texture(_greyImage.imageView);
+	_blackImageIndex = _bindless.register_texture(_blackImage.imageView);
+	_errorCheckerboardImageIndex = _bindless.register_texture(_errorCheckerboardImage.imageView);
+
+	VkSamplerCreateInfo sampl = {.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+
+	sampl.magFilter = VK_FILTER_NEAREST;
+	sampl.minFilter = VK_FILTER_NEAREST;
+
+	vkCreateSampler(_device, &sampl, nullptr, &_defaultSamplerNearest);
+
+	sampl.magFilter = VK_FILTER_LINEAR;
+	sampl.minFilter = VK_FILTER_LINEAR;
+	vkCreateSampler(_device, &sampl, nullptr, &_defaultSamplerLinear);
+
+	_defaultSamplerNearestIndex = _bindless.register_sampler(_defaultSamplerNearest);
+	_defaultSamplerLinearIndex = _bindless.register_sampler(_defaultSamplerLinear);
+
+	//the bindless set goes away with everything in it
+	_mainDeletionQueue.push_function([&]() {
+		vkDestroySampler(_device, _defaultSamplerNearest, nullptr);
+		vkDestroySampler(_device, _defaultSamplerLinear, nullptr);
+
+		destroy_image(_whiteImage);
+		destroy_image(_greyImage);
+		destroy_image(_blackImage);
+		destroy_image(_errorCheckerboardImage);
+	});
+
+	_textures.init(this, _greyImageIndex, _errorCheckerboardImageIndex);
+
+	_mainDeletionQueue.push_function([&]() {
+		_textures.destroy();
+	});
+}
+//< init_data
+
+//> create_material
+MaterialInstance Backend::create_material(MaterialPass pass, const GPUGLTFMaterial& constants)
+{
+	MaterialInstance matData;
+	matData.passType = pass;
+	if (pass == MaterialPass::Transparent) {
+		matData.pipeline = &_transparentMeshPipeline;
+	} else {
+		matData.pipeline = &_meshPipeline;
+	}
+
+	matData.materialIndex = _materials.allocate(constants);
+	if (matData.materialIndex == INVALID_ID) {
+		QS_CORE_ERROR("Material buffer is full, falling back to material 0");
+		matData.materialIndex = 0;
+	}
+
+	return matData;
+}
+//< create_material
+
+//> update_scene
+void Backend::update_scene()
+{
+	mainCamera.update();
+
+	glm::mat4 view = mainCamera.getViewMatrix();
+
+	// camera projection, near and far are swapped for reversed-Z
+	const float fovY = glm::radians(70.f);
+	glm::mat4 projection = glm::perspective(fovY, (float)_windowExtent.width / (float)_windowExtent.height, FarPlane, NearPlane);
+
+	// invert the Y direction on projection matrix so that we are more similar
+	// to opengl and gltf axis
+	projection[1][1] *= -1;
+
+	sceneData.view = view;
+	sceneData.proj = projection;
+	sceneData.viewproj = projection * view;
+
+	//some default lighting parameters
+	sceneData.ambientColor = glm::vec4(.1f);
+	sceneData.sunlightColor = glm::vec4(1.f);
+	sceneData.sunlightDirection = glm::vec4(0, 1, 0.5, 1.f);
+
+	//levels of detail are judged in window pixels, whatever the render scale
+	mainDrawContext.lod.viewPosition = mainCamera.position;
+	mainDrawContext.lod.pixelsPerUnit = (float)_windowExtent.height / (2.f * std::tan(fovY * 0.5f));
+
+	for (auto& [name, scene] : loadedScenes) {
+		scene->Draw(glm::mat4 { 1.f }, mainDrawContext);
+	}
+}
+//< update_scene
+
+//> texture_streaming
+void Backend::update_texture_streaming()
+{
+	const LodSelection& view = mainDrawContext.lod;
+
+	// pixels across the bounding sphere of every surface, the largest per material.
+	// A texture that spans its surface once wants about that many texels
+	_materialScreenSize.Clear();
+	auto measure = [&](const std::vector<RenderObject>& surfaces) {
+		for (const RenderObject& object : surfaces) {
+			glm::vec3 center = object.transform * glm::vec4(object.bounds.origin, 1.f);
+			float scale = std::max({ glm::length(glm::vec3(object.transform[0])), glm::length(glm::vec3(object.transform[1])),
+				glm::length(glm::vec3(object.transform[2])) });
+			float radius = object.bounds.sphereRadius * scale;
+			float distance = std::max(glm::distance(center, view.viewPosition) - radius, NearPlane);
+			float screenSize = 2.f * radius * view.pixelsPerUnit / distance;
+
+			float* size = _materialScreenSize.Insert(object.material->materialIndex, screenSize).first;
+			*size = std::max(*size, screenSize);
+		}
+	};
+	measure(mainDrawContext.OpaqueSurfaces);
+	measure(mainDrawContext.TransparentSurfaces);
+
+	// the material buffer says which textures each material samples. glTF materials
+	// follow their textures' onChanged, so they hold the indices the loader
+	// registered and the feedback finds them, the defaults they start on are ignored
+	_materialScreenSize.ForEach([&](uint32_t materialIndex, float screenSize) {
+		const GPUGLTFMaterial& material = _materials.get(materialIndex);
+		_textures.request(material.colorTexIndex, screenSize);
+		_textures.request(material.metalRoughTexIndex, screenSize);
+	});
+
+	_textures.update();
+}
+//< texture_streaming
+
+//> frame_stats
+void Backend::log_frame_stats()
+{
+	const CullStats& cull = _drawCuller.stats();
+	QS_CORE_INFO("Culling: %u objects, %u frustum culled, %u occlusion culled, %u drawn early, %u drawn late",
+		cull.objects, cull.frustumCulled, cull.occlusionCulled, cull.earlyDraws, cull.lateDraws);
+
+	const LightClusterStats& lights = _clusteredLighting.stats();
+	QS_CORE_INFO("Light clusters: %u lights, %u occupied clusters, %u light indices, %u most in a cluster, %u dropped",
+		lights.lights, lights.occupiedClusters, lights.lightIndices, lights.maxClusterLights, lights.droppedLights);
+
+	QS_CORE_INFO("Levels of detail: %llu triangles left out", (unsigned long long)_lodTrianglesSaved);
+}
+//< frame_stats
+
+//> draw_geometry
+static void set_viewport_scissor(VkCommandBuffer cmd, VkExtent2D extent)
+{
+	VkViewport viewport = {};
+	viewport.x = 0;
+	viewport.y = 0;
+	viewport.width = (float)extent.width;
+	viewport.height = (float)extent.height;
+	viewport.minDepth = 0.f;
+	viewport.maxDepth = 1.f;
+
+	vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+	VkRect2D scissor = {};
+	scissor.offset.x = 0;
+	scissor.offset.y = 0;
+	scissor.extent = extent;
+
+	vkCmdSetScissor(cmd, 0, 1, &scissor);
+}
+
+void Backend::draw_depth_prepass(VkCommandBuffer cmd, VkImageView depth, VkBuffer drawCommands, bool clearDepth)
+{
+	VkRenderingAttachmentInfo depthAttachment = vkinit::depth_attachment_info(depth, VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL);
+	if (!clearDepth) {
+		depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+	}
+	VkRenderingInfo renderInfo = vkinit::rendering_info(_drawExtent, nullptr, &depthAttachment);
+
+	vkCmdBeginRendering(cmd, &renderInfo);
+
+	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _depthPrepassPipeline.pipeline);
+	set_viewport_scissor(cmd, _drawExtent);
+
+	for (uint32_t i = 0; i < _culledObjectCount; i++) {
+		const RenderObject& draw = mainDrawContext.OpaqueSurfaces[i];
+
+		//only materials that shade in the main pass are worth resolving early
+		if (draw.material->passType != MaterialPass::MainColor) {
+			continue;
+		}
+
+		vkCmdBindIndexBuffer(cmd, draw.indexBuffer, 0, draw.indexType);
+
+		GPUDrawPushConstants pushConstants;
+		pushConstants.worldMatrix = draw.transform;
+		pushConstants.vertexBuffer = draw.vertexBufferAddress;
+		pushConstants.sceneData = get_current_frame()._sceneDataBuffer.address;
+		pushConstants.materialIndex = draw.material->materialIndex;
+		pushConstants.vertexFormat = draw.vertexFormat;
+		vkCmdPushConstants(cmd, _depthPrepassPipeline.layout, VK_SHADER_STAGE_VERTEX_BIT, 0, DrawPushConstantsSize, &pushConstants);
+
+		//culled objects have an instance count of 0
+		vkCmdDrawIndexedIndirect(cmd, drawCommands, DrawCuller::command_offset(i), 1, sizeof(VkDrawIndexedIndirectCommand));
+	}
+
+	vkCmdEndRendering(cmd);
+}
+
+void Backend::draw_geometry(VkCommandBuffer cmd, VkImageView depth, VkBuffer drawCommands, bool clearColor, bool clearDepth, bool drawTransparent)
+{
+	//make a clear-color from frame number. This will flash with a 120 frame period.
+	float flash = std::abs(std::sin(_frameNumber / 120.f));
+	VkClearValue clearValue = { .color = { { 0.0f, 0.0f, flash, 1.0f } } };
+
+	VkRenderingAttachmentInfo colorAttachment = vkinit::attachment_info(_drawImage.imageView, clearColor ? &clearValue : nullptr, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+	VkRenderingAttachmentInfo depthAttachment = vkinit::depth_attachment_info(depth, VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL);
+	//keep the prepass depth. Material pipelines test GREATER_OR_EQUAL, so with it
+	//every hidden fragment is rejected by the early depth test, and without it
+	//they still sort correctly
+	if (!clearDepth) {
+		depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+	}
+
+	VkRenderingInfo renderInfo = vkinit::rendering_info(_drawExtent, &colorAttachment, &depthAttachment);
+	vkCmdBeginRendering(cmd, &renderInfo);
+
+	set_viewport_scissor(cmd, _drawExtent);
+
+	MaterialPipeline* lastPipeline = nullptr;
+	VkPipelineLayout lastLayout = VK_NULL_HANDLE;
+
+	auto bind = [&](const RenderObject& r) {
+		if (r.material->pipeline != lastPipeline) {
+			lastPipeline = r.material->pipeline;
+			vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, lastPipeline->pipeline);
+
+			//materials read their textures through the bindless set at set 0
+			if (lastPipeline->layout != lastLayout) {
+				lastLayout = lastPipeline->layout;
+				_bindless.bind(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, lastLayout, 0);
+			}
+		}
+
+		vkCmdBindIndexBuffer(cmd, r.indexBuffer, 0, r.indexType);
+
+		GPUDrawPushConstants pushConstants;
+		pushConstants.worldMatrix = r.transform;
+		pushConstants.vertexBuffer = r.vertexBufferAddress;
+		pushConstants.sceneData = get_current_frame()._sceneDataBuffer.address;
+		pushConstants.materialIndex = r.material->materialIndex;
+		pushConstants.vertexFormat = r.vertexFormat;
+		vkCmdPushConstants(cmd, r.material->pipeline->layout, MeshPushConstantStages, 0, DrawPushConstantsSize, &pushConstants);
+	};
+
+	//culled objects have an instance count of 0
+	for (uint32_t i = 0; i < _culledObjectCount; i++) {
+		bind(mainDrawContext.OpaqueSurfaces[i]);
+		vkCmdDrawIndexedIndirect(cmd, drawCommands, DrawCuller::command_offset(i), 1, sizeof(VkDrawIndexedIndirectCommand));
+	}
+
+	if (drawTransparent) {
+		for (const RenderObject& r : mainDrawContext.TransparentSurfaces) {
+			bind(r);
+			vkCmdDrawIndexed(cmd, r.indexCount, 1, r.firstIndex, 0, 0);
+		}
+	}
+
+	vkCmdEndRendering(cmd);
+}
+//< draw_geometry
+
+//> build_depth_pyramid
+void Backend::build_depth_pyramid(VkCommandBuffer cmd, VkImageView depth)
+{
+	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _depthReducePipeline.pipeline);
+
+	TransientDescriptorAllocator& frameDescriptors = *get_current_frame()._frameDescriptors;
+
+	_depthReduceWriter.clear();
+	_depthReduceWriter.write_image(0, depth, _depthReductionSampler,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+	//unused slots repeat the last level, the shader never reaches them
+	for (uint32_t i = 0; i < MaxDepthPyramidLevels; i++) {
+		VkImageView level = _depthPyramidMips[std::min(i, _depthPyramidLevels - 1)];
+		_depthReduceWriter.write_image(1, level, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_GENERAL, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, i);
+	}
+	_depthReduceWriter.write_buffer(2, _depthPyramidCounter.buffer, sizeof(uint32_t), 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+	TransientDescriptorSet set = frameDescriptors.allocate(_depthReduceLayout, _depthReduceWriter);
+	frameDescriptors.bind(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _depthReducePipeline.layout, 0, std::span(&set, 1));
+
+	//one 64x64 tile of level 0 per workgroup
+	uint32_t groupsX = (_depthPyramidExtent.width + 63) / 64;
+	uint32_t groupsY = (_depthPyramidExtent.height + 63) / 64;
+
+	//level 0 reads the part of the depth buffer that was rendered this frame
+	DepthReducePushConstants pushConstants;
+	pushConstants.uvScale = glm::vec2((float)_drawExtent.width / _drawImage.imageExtent.width,
+		(float)_drawExtent.height / _drawImage.imageExtent.height);
+	pushConstants.size = glm::uvec2(_depthPyramidExtent.width, _depthPyramidExtent.height);
+	pushConstants.levels = _depthPyramidLevels;
+	pushConstants.groupCount = groupsX * groupsY;
+	vkCmdPushConstants(cmd, _depthReducePipeline.layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(DepthReducePushConstants), &pushConstants);
+
+	vkCmdDispatch(cmd, groupsX, groupsY, 1);
 }
+//< build_depth_pyramid
 
 }
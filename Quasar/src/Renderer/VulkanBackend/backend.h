@@ -2,21 +2,69 @@
 
 #include <qspch.h>
 #include "vk_types.h"
+#include "vk_descriptors.h"
+#include "vk_bindless.h"
+#include "vk_uniform_ring.h"
+#include "vk_barriers.h"
+#include "vk_rendergraph.h"
+#include "vk_async_compute.h"
+#include "render_scale.h"
+#include "camera.h"
+#include "vk_culling.h"
+#include "vk_lighting.h"
+#include "vk_shadows.h"
+#include "mesh_asset.h"
+#include "vk_upload.h"
+#include "vk_materials.h"
+#include "vk_loader.h"
+#include "vk_textures.h"
 
 namespace Quasar::Renderer {
 
+//> deletion_queue
+struct DeletionQueue
+{
+	std::deque<std::function<void()>> deletors;
+
+	void push_function(std::function<void()>&& function) {
+		deletors.push_back(function);
+	}
+
+	void flush() {
+		// reverse iterate the deletion queue to execute all the functions
+		for (auto it = deletors.rbegin(); it != deletors.rend(); it++) {
+			(*it)(); //call functors
+		}
+
+		deletors.clear();
+	}
+};
+//< deletion_queue
+
 //> framedata
 struct FrameData {
+	// binary semaphores, only because the swapchain needs them. Frame completion
+	// is tracked by Backend::_frameTimeline
 	VkSemaphore _swapchainSemaphore, _renderSemaphore;
-	VkFence _renderFence;
 
 	VkCommandPool _commandPool;
 	VkCommandBuffer _mainCommandBuffer;
+
+	// per-frame descriptors, reset in one go once the slot's last frame has completed
+	Scope<TransientDescriptorAllocator> _frameDescriptors;
+
+	// this frame's GPUSceneData inside the uniform ring
+	RingAllocation _sceneDataBuffer;
+
+	// for the render graph's graphics segments that are submitted before
+	// _mainCommandBuffer, allocated as they are needed
+	std::vector<VkCommandBuffer> _segmentCommandBuffers;
 };
 
 constexpr unsigned int FRAME_OVERLAP = 2;
 //< framedata
 
+
 class Backend {
     public:
 	bool _isInitialized{ false };
@@ -34,14 +82,57 @@ class Backend {
 	VkSurfaceKHR _surface;// Vulkan window surface
 //< inst_init
 
+	DeletionQueue _mainDeletionQueue;
+
+	VmaAllocator _allocator;
+
+	// VK_EXT_descriptor_buffer was found and enabled on the device
+	bool _descriptorBufferSupported{ false };
+	// the BCn formats can be sampled, textures stay compressed on the gpu
+	bool _textureCompressionBC{ false };
+	// VK_EXT_memory_budget was found and enabled, vma reports the driver's budgets
+	bool _memoryBudgetSupported{ false };
+
 //> queues
 	FrameData _frames[FRAME_OVERLAP];
 
 	FrameData& get_current_frame() { return _frames[_frameNumber % FRAME_OVERLAP]; };
 
+	// timeline semaphore signaled with frameNumber + 1 when a frame's graphics work
+	// is done, so its value is the number of completed frames
+	VkSemaphore _frameTimeline;
+
+	// frames are numbered from 0, like _frameNumber
+	bool is_frame_complete(uint64_t frameNumber) const;
+	uint64_t completed_frame_count() const;
+	void wait_for_frame(uint64_t frameNumber) const;
+
 	VkQueue _graphicsQueue;
 	uint32_t _graphicsQueueFamily;
+
+	// timeline semaphore every graphics submit of a frame signals with the next
+	// value, async compute waits on it
+	VkSemaphore _graphicsTimeline;
+	uint64_t _graphicsSubmitted = 0;
+
+	// separate compute family if the device has one, the graphics queue otherwise
+	VkQueue _computeQueue;
+	uint32_t _computeQueueFamily;
+	AsyncComputeQueue _asyncCompute;
 //< queues
+
+//> imm_submit
+	// one-off graphics queue work outside the frame, such as uploads
+	VkFence _immFence;
+	VkCommandBuffer _immCommandBuffer;
+	VkCommandPool _immCommandPool;
+
+	// records function and blocks until the gpu has run it
+	void immediate_submit(std::function<void(VkCommandBuffer cmd)>&& function);
+
+	// batched uploads from any thread, submitted once per frame ahead of it
+	UploadQueue _uploads;
+//< imm_submit
 	
 //> swap_init
 	VkSwapchainKHR _swapchain;
@@ -49,9 +140,124 @@ class Backend {
 
 	std::vector<VkImage> _swapchainImages;
 	std::vector<VkImageView> _swapchainImageViews;
+	// layout and sync state of each swapchain image, parallel to _swapchainImages
+	std::vector<TrackedImage> _swapchainImageStates;
 	VkExtent2D _swapchainExtent;
 //< swap_init
 
+//> draw_image
+	// hdr target everything renders into, blitted to the swapchain at the end of the frame
+	AllocatedImage _drawImage;
+	TrackedImage _drawImageState;
+	// part of _drawImage rendered this frame, the swapchain size times renderScale
+	VkExtent2D _drawExtent;
+
+	float renderScale = 1.f;
+	// let _renderScaleController pick renderScale from the gpu frame time
+	bool dynamicResolution = true;
+	RenderScaleController _renderScaleController;
+	// sum of the render graph pass times of the last completed frame
+	float _gpuFrameMilliseconds = 0.f;
+//< draw_image
+
+//> depth_image
+	// reversed-Z: cleared to 0, near is 1, and depth tests pass with GREATER_OR_EQUAL.
+	// Nothing reads it after the frame, so it is a render graph transient the size
+	// of _drawImage
+	VkFormat _depthFormat = VK_FORMAT_D32_SFLOAT;
+
+	// lay down the depth of opaque MainColor objects first, so the shading pass
+	// only runs its fragment shader for the visible surface of each pixel
+	bool depthPrepass = true;
+	MaterialPipeline _depthPrepassPipeline;
+
+	// hierarchical-Z: mip 0 is the depth of the draw extent at the previous power
+	// of two, every further mip keeps the farthest depth of the 2x2 texels above it
+	static constexpr uint32_t MaxDepthPyramidLevels = 13;
+	AllocatedImage _depthPyramid;
+	TrackedImage _depthPyramidState;
+	std::vector<VkImageView> _depthPyramidMips;
+	VkExtent2D _depthPyramidExtent;
+	uint32_t _depthPyramidLevels;
+	// workgroups of the single pass reduction that are done
+	AllocatedBuffer _depthPyramidCounter;
+
+	MaterialPipeline _depthReducePipeline;
+	VkDescriptorSetLayout _depthReduceLayout;
+	VkSampler _depthReductionSampler;
+	DescriptorWriter _depthReduceWriter;
+//< depth_image
+
+//> culling
+	// two-phase occlusion culling of the opaque surfaces against the depth pyramid.
+	// Frustum culling runs either way
+	bool occlusionCulling = true;
+	DrawCuller _drawCuller;
+	// opaque surfaces the culler got this frame
+	uint32_t _culledObjectCount = 0;
+//< culling
+
+//> lighting
+	// point and spot lights come from mainDrawContext.Lights
+	ClusteredLighting _clusteredLighting;
+	// the default lit materials, shading with the clustered lights
+	MaterialPipeline _meshPipeline;
+	MaterialPipeline _transparentMeshPipeline;
+	// the sun's shadows, surfaces flagged isStatic may live in the cached cascades
+	CascadedShadows _cascadedShadows;
+//< lighting
+
+	DrawContext mainDrawContext;
+	// triangles the picked levels of detail left out last frame
+	uint64_t _lodTrianglesSaved = 0;
+	Camera mainCamera;
+
+	// shared descriptor set and pipeline layouts, filled from shader reflection
+	DescriptorLayoutCache _layoutCache;
+
+	// global set with every texture, sampler and storage buffer, bound once per frame
+	BindlessRegistry _bindless;
+
+	// every material's constants, bindless storage buffer 0
+	MaterialRegistry _materials;
+
+//> default_data
+	AllocatedImage _whiteImage;
+	AllocatedImage _blackImage;
+	AllocatedImage _greyImage;
+	AllocatedImage _errorCheckerboardImage;
+	uint32_t _whiteImageIndex;
+	uint32_t _blackImageIndex;
+	uint32_t _greyImageIndex;
+	uint32_t _errorCheckerboardImageIndex;
+
+	VkSampler _defaultSamplerLinear;
+	VkSampler _defaultSamplerNearest;
+	uint32_t _defaultSamplerLinearIndex;
+	uint32_t _defaultSamplerNearestIndex;
+//< default_data
+
+	// image files, decoded on the workers, their mips streamed by screen size
+	TextureLoader _textures;
+	// this frame's largest screen size of every material's surfaces, by material index
+	Hashmap<uint32_t, float> _materialScreenSize;
+
+	// scenes drawn every frame, by name
+	std::unordered_map<std::string, std::shared_ptr<LoadedGLTF>> loadedScenes;
+
+	// per-frame and per-object uniform data, bump-allocated every frame
+	UniformRing _uniformRing;
+
+	GPUSceneData sceneData;
+
+	// pending barriers of the command buffer being recorded
+	BarrierBatch _barriers;
+
+	// rebuilt every frame in draw()
+	RenderGraph _renderGraph;
+	// timeline value each of the graph's segments signals, on its own queue's semaphore
+	std::vector<uint64_t> _segmentValues;
+
 	//initializes everything in the engine
 	b8 init();
 
@@ -61,6 +267,41 @@ class Backend {
 	//draw loop
 	void draw();
 
+	AllocatedBuffer create_buffer(size_t allocSize, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage);
+	void destroy_buffer(const AllocatedBuffer& buffer);
+
+	AllocatedImage create_image(VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool mipmapped = false);
+	// with an explicit mip count, for chains that come precomputed
+	AllocatedImage create_image(VkExtent3D size, VkFormat format, VkImageUsageFlags usage, uint32_t mipLevels);
+	// creates the image and fills it with data through immediate_submit, for small
+	// images needed right away. Streamed images go through _uploads instead
+	AllocatedImage create_image(void* data, VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool mipmapped = false);
+	void destroy_image(const AllocatedImage& img);
+
+	// copies the mesh into gpu-only buffers through a staging buffer and waits for it
+	GPUMeshBuffers upload_mesh(std::span<const uint32_t> indices, std::span<const Vertex> vertices);
+	// uploads straight from the mapped file, keeping its index width
+	GPUMeshBuffers upload_mesh(const MeshAsset& mesh);
+	void destroy_mesh(const GPUMeshBuffers& mesh);
+	// empty gpu-only mesh buffers for the caller to upload into. Thread safe
+	GPUMeshBuffers create_mesh_buffers(size_t vertexBufferSize, size_t indexBufferSize, VkIndexType indexType);
+
+	// a material in the registry drawn with the lit pipeline of pass
+	MaterialInstance create_material(MaterialPass pass, const GPUGLTFMaterial& constants);
+
+	// descriptors for a single frame, backed by VK_EXT_descriptor_buffer when the
+	// device has it and by descriptor pools otherwise
+	Scope<TransientDescriptorAllocator> create_transient_descriptor_allocator();
+
+	// records and submits compute work for the current frame on the compute queue,
+	// overlapping with graphics, after waiting on waits. Returns the compute
+	// timeline value of the work, for graphics to wait on
+	uint64_t submit_compute(std::function<void(VkCommandBuffer cmd)>&& function,
+		std::span<const VkSemaphoreSubmitInfo> waits = {});
+	// submits a graphics command buffer of the frame before its last one, signaling
+	// _graphicsTimeline. Waits for computeWaitValue first, when it is not 0
+	uint64_t submit_graphics(VkCommandBuffer cmd, uint64_t computeWaitValue, VkPipelineStageFlags2 computeWaitStage);
+
 	bool stop_rendering{false};
 private:
 
@@ -74,5 +315,44 @@ private:
 	void init_commands();
 
 	void init_sync_structures();
+
+	void init_descriptors();
+
+	void init_uniform_ring();
+
+	void init_render_graph();
+
+	void init_pipelines();
+	void init_depth_prepass_pipeline();
+	void init_depth_reduce_pipeline();
+	void init_culling();
+	void init_mesh_pipelines();
+	void init_lighting();
+	void init_shadows();
+
+	void init_default_data();
+
+	void create_depth_pyramid();
+
+	void update_scene();
+	// reports how large each material's textures appear this frame and lets the
+	// texture loader stream their mips
+	void update_texture_streaming();
+
+	// the culling and light binning stats read back from a completed frame, and
+	// what the levels of detail saved, go to the log every StatsLogInterval frames
+	static constexpr int StatsLogInterval = 300;
+	void log_frame_stats();
+
+	// records and submits the render graph's segments in order, starting in cmd.
+	// Returns the graphics command buffer the frame goes on in, still recording,
+	// and the compute work its submit has to wait for
+	VkCommandBuffer execute_render_graph(VkCommandBuffer cmd, uint64_t& computeWaitValue, VkPipelineStageFlags2& computeWaitStage);
+
+	void draw_depth_prepass(VkCommandBuffer cmd, VkImageView depth, VkBuffer drawCommands, bool clearDepth);
+	void draw_geometry(VkCommandBuffer cmd, VkImageView depth, VkBuffer drawCommands, bool clearColor, bool clearDepth, bool drawTransparent);
+	void build_depth_pyramid(VkCommandBuffer cmd, VkImageView depth);
+
+	GPUMeshBuffers upload_mesh(std::span<const uint8_t> indexData, VkIndexType indexType, std::span<const Vertex> vertices);
 };
 }
\ No newline at end of file
@@ -1,3 +1,5 @@
+#pragma once
+
 #include "vk_types.h"
 
 namespace Quasar::Renderer {
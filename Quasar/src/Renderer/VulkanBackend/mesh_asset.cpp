@@ -0,0 +1,63 @@
+#include "mesh_asset.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+static_assert(sizeof(Vertex) == sizeof(MeshFileVertex) && alignof(Vertex) <= MeshFileAlignment,
+    "the vertex block of a .qmesh file is read as Vertex");
+
+//> mesh_asset
+bool MeshAsset::load(const std::string& path)
+{
+    unload();
+
+    // the vertex and index blocks are uploaded whole right after, read them in now
+    if (!_file.Open(path, MappedFile::Access::WillNeed)) {
+        return false;
+    }
+
+    if (!ValidateMeshFile(_file.Data(), _file.Size())) {
+        QS_CORE_ERROR("%s is not a valid mesh file", path.c_str());
+        _file.Close();
+        return false;
+    }
+
+    _header = reinterpret_cast<const MeshFileHeader*>(_file.Data());
+    return true;
+}
+
+void MeshAsset::unload()
+{
+    _header = nullptr;
+    _file.Close();
+}
+
+std::span<const Vertex> MeshAsset::vertices() const
+{
+    const Vertex* first = reinterpret_cast<const Vertex*>(_file.Data() + _header->vertexOffset);
+    return { first, _header->vertexCount };
+}
+
+std::span<const uint8_t> MeshAsset::index_data() const
+{
+    return { _file.Data() + _header->indexOffset, size_t(_header->indexCount) * _header->indexSize };
+}
+
+std::span<const MeshFileSubmesh> MeshAsset::submeshes() const
+{
+    const MeshFileSubmesh* first = reinterpret_cast<const MeshFileSubmesh*>(_file.Data() + _header->submeshOffset);
+    return { first, _header->submeshCount };
+}
+
+Bounds MeshAsset::to_bounds(const MeshFileBounds& bounds)
+{
+    Bounds result;
+    result.origin = glm::vec3(bounds.origin[0], bounds.origin[1], bounds.origin[2]);
+    result.sphereRadius = bounds.sphereRadius;
+    result.extents = glm::vec3(bounds.extents[0], bounds.extents[1], bounds.extents[2]);
+    return result;
+}
+//< mesh_asset
+
+}
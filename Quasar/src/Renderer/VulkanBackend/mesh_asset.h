@@ -0,0 +1,37 @@
+#pragma once
+
+#include "vk_types.h"
+
+#include <Core/MappedFile.h>
+#include <Renderer/MeshFormat.h>
+
+namespace Quasar::Renderer {
+
+//> mesh_asset
+// A .qmesh file mapped into memory, see Renderer/MeshFormat.h. The vertex and
+// index blocks are used where they are, nothing is copied before the upload
+class MeshAsset {
+public:
+    bool load(const std::string& path);
+    void unload();
+
+    bool loaded() const { return _header != nullptr; }
+
+    std::span<const Vertex> vertices() const;
+    // index_type() tells how wide the indices are
+    std::span<const uint8_t> index_data() const;
+    uint32_t index_count() const { return _header->indexCount; }
+    VkIndexType index_type() const { return _header->indexSize == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32; }
+
+    std::span<const MeshFileSubmesh> submeshes() const;
+    Bounds bounds() const { return to_bounds(_header->bounds); }
+
+    static Bounds to_bounds(const MeshFileBounds& bounds);
+
+private:
+    MappedFile _file;
+    const MeshFileHeader* _header = nullptr;
+};
+//< mesh_asset
+
+}
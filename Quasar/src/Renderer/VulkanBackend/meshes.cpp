@@ -1,21 +0,0 @@
-#include "meshes.h" 
-
-namespace Quasar::Renderer {
-#pragma warning( disable : 4305)
-
-uint32_t Cube_vtx_count = 24;
-uint32_t Cube_idx_count = 36;
-Vertex Cube_vtx[] = { Vertex{ { 1,1,-1 }, 0.625, { 0,0,-1 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 1,1,-1 }, 0.625, { 0,1,-0 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 1,1,-1 }, 0.625, { 1,0,-0 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 1,-1,-1 }, 0.375, { 0,-1,-0 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 1,-1,-1 }, 0.375, { 0,0,-1 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 1,-1,-1 }, 0.375, { 1,0,-0 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 1,1,1 }, 0.625, { 0,0,1 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 1,1,1 }, 0.625, { 0,1,-0 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 1,1,1 }, 0.625, { 1,0,-0 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 1,-1,1 }, 0.375, { 0,-1,-0 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 1,-1,1 }, 0.375, { 0,0,1 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 1,-1,1 }, 0.375, { 1,0,-0 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { -1,1,-1 }, 0.625, { -1,0,-0 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1,1,-1 }, 0.625, { 0,0,-1 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1,1,-1 }, 0.875, { 0,1,-0 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -1,-1,-1 }, 0.375, { -1,0,-0 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1,-1,-1 }, 0.125, { 0,-1,-0 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -1,-1,-1 }, 0.375, { 0,0,-1 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1,1,1 }, 0.625, { -1,0,-0 }, 1 ,{ 1,1,1,1 } },Vertex{ { -1,1,1 }, 0.625, { 0,0,1 }, 0 ,{ 1,1,1,1 } },Vertex{ { -1,1,1 }, 0.875, { 0,1,-0 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { -1,-1,1 }, 0.375, { -1,0,-0 }, 1 ,{ 1,1,1,1 } },Vertex{ { -1,-1,1 }, 0.125, { 0,-1,-0 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { -1,-1,1 }, 0.375, { 0,0,1 }, 0 ,{ 1,1,1,1 } } }; 
-uint32_t Cube_idx[] = { 1,14,20,1,20,7,10,6,19,10,19,23,21,18,12,21,12,15,16,3,9,16,9,22,5,2,8,5,8,11,17,13,0,17,0,4 }; 
-
-uint32_t Sphere_vtx_count = 1984;
-uint32_t Sphere_idx_count = 2880;
-Vertex Sphere_vtx[] = { Vertex{ { 0,0.8314696,-0.55557024 }, 0.75, { -0.062398497,0.7714814,-0.63318473 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0,0.8314696,-0.55557024 }, 0.75, { -0.046398595,0.8809733,-0.47088575 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0,0.8314696,-0.55557024 }, 0.75, { 0.046398595,0.8809733,-0.47088575 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0,0.8314696,-0.55557024 }, 0.75, { 0.062398497,0.7714814,-0.63318473 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0,0.55557024,-0.8314696 }, 0.75, { -0.0865024,0.46961308,-0.87862444 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0,0.55557024,-0.8314696 }, 0.75, { -0.07589712,0.6325759,-0.77077067 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0,0.55557024,-0.8314696 }, 0.75, { 0.07589712,0.6325759,-0.77077067 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0,0.55557024,-0.8314696 }, 0.75, { 0.0865024,0.46961308,-0.87862444 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0,0.19509032,-0.98078525 }, 0.75, { -0.0976037,0.09750369,-0.99043757 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0,0.19509032,-0.98078525 }, 0.75, { -0.09380203,0.28900626,-0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0,0.19509032,-0.98078525 }, 0.75, { 0.09380203,0.28900626,-0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0,0.19509032,-0.98078525 }, 0.75, { 0.097504646,0.097504646,-0.9904472 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0,0,-1 }, 0.75, { -0.0976037,-0.09750369,-0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0,0,-1 }, 0.75, { -0.0976037,0.09750369,-0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0,0,-1 }, 0.75, { 0.097504646,-0.097504646,-0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0,0,-1 }, 0.75, { 0.097504646,0.097504646,-0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0,-0.19509032,-0.98078525 }, 0.75, { -0.0976037,-0.09750369,-0.99043757 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0,-0.19509032,-0.98078525 }, 0.75, { -0.09380203,-0.28900626,-0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0,-0.19509032,-0.98078525 }, 0.75, { 0.09380203,-0.28900626,-0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0,-0.19509032,-0.98078525 }, 0.75, { 0.097504646,-0.097504646,-0.9904472 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0,-0.55557024,-0.8314696 }, 0.75, { -0.0865024,-0.46961308,-0.87862444 }, 0.68749994 ,{ 1,1,1,1 } },Vertex{ { 0,-0.55557024,-0.8314696 }, 0.75, { -0.07589712,-0.6325759,-0.77077067 }, 0.68749994 ,{ 1,1,1,1 } },Vertex{ { 0,-0.55557024,-0.8314696 }, 0.75, { 0.07589712,-0.6325759,-0.77077067 }, 0.68749994 ,{ 1,1,1,1 } },Vertex{ { 0,-0.55557024,-0.8314696 }, 0.75, { 0.0865024,-0.46961308,-0.87862444 }, 0.68749994 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,0.98078525,-0.19134171 }, 0.71875, { 0.0097003775,0.99513876,-0.09800381 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,0.98078525,-0.19134171 }, 0.71875, { 0.028601056,0.9565353,-0.2902107 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,0.98078525,-0.19134171 }, 0.71875, { 0.028601207,0.99514204,-0.09420398 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,0.98078525,-0.19134171 }, 0.71875, { 0.084604636,0.9565524,-0.2790153 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,0.9238795,-0.3753303 }, 0.71875, { 0.028601056,0.9565353,-0.2902107 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,0.9238795,-0.3753303 }, 0.71875, { 0.046398595,0.8809733,-0.47088575 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,0.9238795,-0.3753303 }, 0.71875, { 0.084604636,0.9565524,-0.2790153 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,0.9238795,-0.3753303 }, 0.71875, { 0.13739537,0.88097024,-0.45278472 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,0.8314696,-0.5448951 }, 0.71875, { 0.046398595,0.8809733,-0.47088575 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,0.8314696,-0.5448951 }, 0.71875, { 0.062398497,0.7714814,-0.63318473 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,0.8314696,-0.5448951 }, 0.71875, { 0.13739537,0.88097024,-0.45278472 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,0.8314696,-0.5448951 }, 0.71875, { 0.18470335,0.771514,-0.608811 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,0.70710677,-0.6935199 }, 0.71875, { 0.062398497,0.7714814,-0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,0.70710677,-0.6935199 }, 0.71875, { 0.07589712,0.6325759,-0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,0.70710677,-0.6935199 }, 0.71875, { 0.18470335,0.771514,-0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,0.70710677,-0.6935199 }, 0.71875, { 0.2247893,0.6325699,-0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,0.55557024,-0.8154931 }, 0.71875, { 0.07589712,0.6325759,-0.77077067 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,0.55557024,-0.8154931 }, 0.71875, { 0.0865024,0.46961308,-0.87862444 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,0.55557024,-0.8154931 }, 0.71875, { 0.2247893,0.6325699,-0.74116474 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,0.55557024,-0.8154931 }, 0.71875, { 0.25631273,0.46962327,-0.8448419 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,-0.9061274 }, 0.71875, { 0.0865024,0.46961308,-0.87862444 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,-0.9061274 }, 0.71875, { 0.09380203,0.28900626,-0.95272064 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,-0.9061274 }, 0.71875, { 0.25631273,0.46962327,-0.8448419 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,-0.9061274 }, 0.71875, { 0.2779016,0.28900164,-0.9161052 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,0.19509032,-0.9619397 }, 0.71875, { 0.09380203,0.28900626,-0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,0.19509032,-0.9619397 }, 0.71875, { 0.097504646,0.097504646,-0.9904472 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,0.19509032,-0.9619397 }, 0.71875, { 0.2779016,0.28900164,-0.9161052 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,0.19509032,-0.9619397 }, 0.71875, { 0.2888921,0.09759733,-0.95237404 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19509032,0,-0.98078525 }, 0.71875, { 0.097504646,-0.097504646,-0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.19509032,0,-0.98078525 }, 0.71875, { 0.097504646,0.097504646,-0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.19509032,0,-0.98078525 }, 0.71875, { 0.2888921,-0.09759733,-0.95237404 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.19509032,0,-0.98078525 }, 0.71875, { 0.2888921,0.09759733,-0.95237404 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,-0.19509032,-0.9619397 }, 0.71875, { 0.09380203,-0.28900626,-0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,-0.19509032,-0.9619397 }, 0.71875, { 0.097504646,-0.097504646,-0.9904472 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,-0.19509032,-0.9619397 }, 0.71875, { 0.2779016,-0.28900164,-0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.19134171,-0.19509032,-0.9619397 }, 0.71875, { 0.2888921,-0.09759733,-0.95237404 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,-0.9061274 }, 0.71875, { 0.0865024,-0.46961308,-0.87862444 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,-0.9061274 }, 0.71875, { 0.09380203,-0.28900626,-0.95272064 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,-0.9061274 }, 0.71875, { 0.25631273,-0.46962327,-0.8448419 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,-0.9061274 }, 0.71875, { 0.2779016,-0.28900164,-0.9161052 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,-0.55557024,-0.8154931 }, 0.71875, { 0.07589712,-0.6325759,-0.77077067 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,-0.55557024,-0.8154931 }, 0.71875, { 0.0865024,-0.46961308,-0.87862444 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,-0.55557024,-0.8154931 }, 0.71875, { 0.2247893,-0.6325699,-0.74116474 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221167,-0.55557024,-0.8154931 }, 0.71875, { 0.25631273,-0.46962327,-0.8448419 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,-0.70710677,-0.6935199 }, 0.71875, { 0.062398497,-0.7714814,-0.63318473 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,-0.70710677,-0.6935199 }, 0.71875, { 0.07589712,-0.6325759,-0.77077067 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,-0.70710677,-0.6935199 }, 0.71875, { 0.18470335,-0.771514,-0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.13794969,-0.70710677,-0.6935199 }, 0.71875, { 0.2247893,-0.6325699,-0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,-0.8314696,-0.5448951 }, 0.71875, { 0.046398595,-0.8809733,-0.47088575 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,-0.8314696,-0.5448951 }, 0.71875, { 0.062398497,-0.7714814,-0.63318473 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,-0.8314696,-0.5448951 }, 0.71875, { 0.13739537,-0.88097024,-0.45278472 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.10838638,-0.8314696,-0.5448951 }, 0.71875, { 0.18470335,-0.771514,-0.608811 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,-0.9238795,-0.3753303 }, 0.71875, { 0.028601056,-0.9565353,-0.2902107 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,-0.9238795,-0.3753303 }, 0.71875, { 0.046398595,-0.8809733,-0.47088575 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,-0.9238795,-0.3753303 }, 0.71875, { 0.084604636,-0.9565524,-0.2790153 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.07465784,-0.9238795,-0.3753303 }, 0.71875, { 0.13739537,-0.88097024,-0.45278472 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,-0.98078525,-0.19134171 }, 0.71875, { 0.0097003775,-0.99513876,-0.09800381 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,-0.98078525,-0.19134171 }, 0.71875, { 0.028601056,-0.9565353,-0.2902107 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,-0.98078525,-0.19134171 }, 0.71875, { 0.028601207,-0.99514204,-0.09420398 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060233,-0.98078525,-0.19134171 }, 0.71875, { 0.084604636,-0.9565524,-0.2790153 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,0.98078525,-0.18023995 }, 0.6875, { 0.028601207,0.99514204,-0.09420398 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,0.98078525,-0.18023995 }, 0.6875, { 0.046401657,0.99513555,-0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,0.98078525,-0.18023995 }, 0.6875, { 0.084604636,0.9565524,-0.2790153 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,0.98078525,-0.18023995 }, 0.6875, { 0.13740884,0.9565615,-0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,0.9238795,-0.3535534 }, 0.6875, { 0.084604636,0.9565524,-0.2790153 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,0.9238795,-0.3535534 }, 0.6875, { 0.13739537,0.88097024,-0.45278472 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,0.9238795,-0.3535534 }, 0.6875, { 0.13740884,0.9565615,-0.25711653 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,0.9238795,-0.3535534 }, 0.6875, { 0.22299676,0.88098717,-0.4172939 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.8314696,-0.5132799 }, 0.6875, { 0.13739537,0.88097024,-0.45278472 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.8314696,-0.5132799 }, 0.6875, { 0.18470335,0.771514,-0.608811 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.8314696,-0.5132799 }, 0.6875, { 0.22299676,0.88098717,-0.4172939 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.8314696,-0.5132799 }, 0.6875, { 0.29990217,0.7715056,-0.56110406 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.70710677,-0.65328145 }, 0.6875, { 0.18470335,0.771514,-0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.70710677,-0.65328145 }, 0.6875, { 0.2247893,0.6325699,-0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.70710677,-0.65328145 }, 0.6875, { 0.29990217,0.7715056,-0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.70710677,-0.65328145 }, 0.6875, { 0.3650806,0.6325664,-0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,0.55557024,-0.7681776 }, 0.6875, { 0.2247893,0.6325699,-0.74116474 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,0.55557024,-0.7681776 }, 0.6875, { 0.25631273,0.46962327,-0.8448419 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,0.55557024,-0.7681776 }, 0.6875, { 0.3650806,0.6325664,-0.6830637 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,0.55557024,-0.7681776 }, 0.6875, { 0.4162074,0.46960834,-0.7786138 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,-0.85355335 }, 0.6875, { 0.25631273,0.46962327,-0.8448419 }, 0.375 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,-0.85355335 }, 0.6875, { 0.2779016,0.28900164,-0.9161052 }, 0.375 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,-0.85355335 }, 0.6875, { 0.4162074,0.46960834,-0.7786138 }, 0.375 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,-0.85355335 }, 0.6875, { 0.4512921,0.28899494,-0.8442852 }, 0.375 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,0.19509032,-0.9061274 }, 0.6875, { 0.2779016,0.28900164,-0.9161052 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,0.19509032,-0.9061274 }, 0.6875, { 0.2888921,0.09759733,-0.95237404 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,0.19509032,-0.9061274 }, 0.6875, { 0.4512921,0.28899494,-0.8442852 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,0.19509032,-0.9061274 }, 0.6875, { 0.4691192,0.09750398,-0.87773585 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.38268343,0,-0.92387944 }, 0.6875, { 0.2888921,-0.09759733,-0.95237404 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.38268343,0,-0.92387944 }, 0.6875, { 0.2888921,0.09759733,-0.95237404 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.38268343,0,-0.92387944 }, 0.6875, { 0.4691192,-0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.38268343,0,-0.92387944 }, 0.6875, { 0.4691192,0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,-0.19509032,-0.9061274 }, 0.6875, { 0.2779016,-0.28900164,-0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,-0.19509032,-0.9061274 }, 0.6875, { 0.2888921,-0.09759733,-0.95237404 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,-0.19509032,-0.9061274 }, 0.6875, { 0.4512921,-0.28899494,-0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.37533027,-0.19509032,-0.9061274 }, 0.6875, { 0.4691192,-0.09750398,-0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,-0.85355335 }, 0.6875, { 0.25631273,-0.46962327,-0.8448419 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,-0.85355335 }, 0.6875, { 0.2779016,-0.28900164,-0.9161052 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,-0.85355335 }, 0.6875, { 0.4162074,-0.46960834,-0.7786138 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,-0.85355335 }, 0.6875, { 0.4512921,-0.28899494,-0.8442852 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,-0.55557024,-0.7681776 }, 0.6875, { 0.2247893,-0.6325699,-0.74116474 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,-0.55557024,-0.7681776 }, 0.6875, { 0.25631273,-0.46962327,-0.8448419 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,-0.55557024,-0.7681776 }, 0.6875, { 0.3650806,-0.6325664,-0.6830637 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.31818962,-0.55557024,-0.7681776 }, 0.6875, { 0.4162074,-0.46960834,-0.7786138 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.70710677,-0.65328145 }, 0.6875, { 0.18470335,-0.771514,-0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.70710677,-0.65328145 }, 0.6875, { 0.2247893,-0.6325699,-0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.70710677,-0.65328145 }, 0.6875, { 0.29990217,-0.7715056,-0.56110406 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.70710677,-0.65328145 }, 0.6875, { 0.3650806,-0.6325664,-0.6830637 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.8314696,-0.5132799 }, 0.6875, { 0.13739537,-0.88097024,-0.45278472 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.8314696,-0.5132799 }, 0.6875, { 0.18470335,-0.771514,-0.608811 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.8314696,-0.5132799 }, 0.6875, { 0.22299676,-0.88098717,-0.4172939 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.8314696,-0.5132799 }, 0.6875, { 0.29990217,-0.7715056,-0.56110406 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,-0.9238795,-0.3535534 }, 0.6875, { 0.084604636,-0.9565524,-0.2790153 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,-0.9238795,-0.3535534 }, 0.6875, { 0.13739537,-0.88097024,-0.45278472 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,-0.9238795,-0.3535534 }, 0.6875, { 0.13740884,-0.9565615,-0.25711653 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.14644662,-0.9238795,-0.3535534 }, 0.6875, { 0.22299676,-0.88098717,-0.4172939 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,-0.98078525,-0.18023995 }, 0.6875, { 0.028601207,-0.99514204,-0.09420398 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,-0.98078525,-0.18023995 }, 0.6875, { 0.046401657,-0.99513555,-0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,-0.98078525,-0.18023995 }, 0.6875, { 0.084604636,-0.9565524,-0.2790153 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465783,-0.98078525,-0.18023995 }, 0.6875, { 0.13740884,-0.9565615,-0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,0.98078525,-0.16221166 }, 0.65625, { 0.046401657,0.99513555,-0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,0.98078525,-0.16221166 }, 0.65625, { 0.06250246,0.9951391,-0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,0.98078525,-0.16221166 }, 0.65625, { 0.13740884,0.9565615,-0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,0.98078525,-0.16221166 }, 0.65625, { 0.18500718,0.9565371,-0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.9238795,-0.31818965 }, 0.65625, { 0.13740884,0.9565615,-0.25711653 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.9238795,-0.31818965 }, 0.65625, { 0.18500718,0.9565371,-0.22540875 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.9238795,-0.31818965 }, 0.65625, { 0.22299676,0.88098717,-0.4172939 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,0.9238795,-0.31818965 }, 0.65625, { 0.3001864,0.88096005,-0.36578342 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,0.8314696,-0.4619397 }, 0.65625, { 0.22299676,0.88098717,-0.4172939 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,0.8314696,-0.4619397 }, 0.65625, { 0.29990217,0.7715056,-0.56110406 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,0.8314696,-0.4619397 }, 0.65625, { 0.3001864,0.88096005,-0.36578342 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,0.8314696,-0.4619397 }, 0.65625, { 0.40360555,0.7715106,-0.49180678 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,0.70710677,-0.5879378 }, 0.65625, { 0.29990217,0.7715056,-0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,0.70710677,-0.5879378 }, 0.65625, { 0.3650806,0.6325664,-0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,0.70710677,-0.5879378 }, 0.65625, { 0.40360555,0.7715106,-0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,0.70710677,-0.5879378 }, 0.65625, { 0.4913,0.6326,-0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,0.55557024,-0.6913416 }, 0.65625, { 0.3650806,0.6325664,-0.6830637 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,0.55557024,-0.6913416 }, 0.65625, { 0.4162074,0.46960834,-0.7786138 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,0.55557024,-0.6913416 }, 0.65625, { 0.4913,0.6326,-0.5987 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,0.55557024,-0.6913416 }, 0.65625, { 0.56008816,0.46959004,-0.6824855 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,-0.7681777 }, 0.65625, { 0.4162074,0.46960834,-0.7786138 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,-0.7681777 }, 0.65625, { 0.4512921,0.28899494,-0.8442852 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,-0.7681777 }, 0.65625, { 0.56008816,0.46959004,-0.6824855 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,-0.7681777 }, 0.65625, { 0.60731995,0.28900948,-0.7400243 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,0.19509032,-0.8154931 }, 0.65625, { 0.4512921,0.28899494,-0.8442852 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,0.19509032,-0.8154931 }, 0.65625, { 0.4691192,0.09750398,-0.87773585 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,0.19509032,-0.8154931 }, 0.65625, { 0.60731995,0.28900948,-0.7400243 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,0.19509032,-0.8154931 }, 0.65625, { 0.63140166,0.09750026,-0.76930207 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.55557024,0,-0.8314695 }, 0.65625, { 0.4691192,-0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.55557024,0,-0.8314695 }, 0.65625, { 0.4691192,0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.55557024,0,-0.8314695 }, 0.65625, { 0.63140166,-0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.55557024,0,-0.8314695 }, 0.65625, { 0.63140166,0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,-0.19509032,-0.8154931 }, 0.65625, { 0.4512921,-0.28899494,-0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,-0.19509032,-0.8154931 }, 0.65625, { 0.4691192,-0.09750398,-0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,-0.19509032,-0.8154931 }, 0.65625, { 0.60731995,-0.28900948,-0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5448951,-0.19509032,-0.8154931 }, 0.65625, { 0.63140166,-0.09750026,-0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,-0.7681777 }, 0.65625, { 0.4162074,-0.46960834,-0.7786138 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,-0.7681777 }, 0.65625, { 0.4512921,-0.28899494,-0.8442852 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,-0.7681777 }, 0.65625, { 0.56008816,-0.46959004,-0.6824855 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,-0.7681777 }, 0.65625, { 0.60731995,-0.28900948,-0.7400243 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,-0.55557024,-0.6913416 }, 0.65625, { 0.3650806,-0.6325664,-0.6830637 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,-0.55557024,-0.6913416 }, 0.65625, { 0.4162074,-0.46960834,-0.7786138 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,-0.55557024,-0.6913416 }, 0.65625, { 0.4913,-0.6326,-0.5987 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.4619397,-0.55557024,-0.6913416 }, 0.65625, { 0.56008816,-0.46959004,-0.6824855 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,-0.70710677,-0.5879378 }, 0.65625, { 0.29990217,-0.7715056,-0.56110406 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,-0.70710677,-0.5879378 }, 0.65625, { 0.3650806,-0.6325664,-0.6830637 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,-0.70710677,-0.5879378 }, 0.65625, { 0.40360555,-0.7715106,-0.49180678 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284748,-0.70710677,-0.5879378 }, 0.65625, { 0.4913,-0.6326,-0.5987 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,-0.8314696,-0.4619397 }, 0.65625, { 0.22299676,-0.88098717,-0.4172939 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,-0.8314696,-0.4619397 }, 0.65625, { 0.29990217,-0.7715056,-0.56110406 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,-0.8314696,-0.4619397 }, 0.65625, { 0.3001864,-0.88096005,-0.36578342 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.30865827,-0.8314696,-0.4619397 }, 0.65625, { 0.40360555,-0.7715106,-0.49180678 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.9238795,-0.31818965 }, 0.65625, { 0.13740884,-0.9565615,-0.25711653 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.9238795,-0.31818965 }, 0.65625, { 0.18500718,-0.9565371,-0.22540875 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.9238795,-0.31818965 }, 0.65625, { 0.22299676,-0.88098717,-0.4172939 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.21260753,-0.9238795,-0.31818965 }, 0.65625, { 0.3001864,-0.88096005,-0.36578342 }, 0.87499994 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,-0.98078525,-0.16221166 }, 0.65625, { 0.046401657,-0.99513555,-0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,-0.98078525,-0.16221166 }, 0.65625, { 0.06250246,-0.9951391,-0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,-0.98078525,-0.16221166 }, 0.65625, { 0.13740884,-0.9565615,-0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.10838637,-0.98078525,-0.16221166 }, 0.65625, { 0.18500718,-0.9565371,-0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,0.98078525,-0.13794966 }, 0.625, { 0.06250246,0.9951391,-0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,0.98078525,-0.13794966 }, 0.625, { 0.07610299,0.9951391,-0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,0.98078525,-0.13794966 }, 0.625, { 0.18500718,0.9565371,-0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,0.98078525,-0.13794966 }, 0.625, { 0.22540875,0.9565371,-0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.9238795,-0.27059802 }, 0.625, { 0.18500718,0.9565371,-0.22540875 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.9238795,-0.27059802 }, 0.625, { 0.22540875,0.9565371,-0.18500718 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.9238795,-0.27059802 }, 0.625, { 0.3001864,0.88096005,-0.36578342 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,0.9238795,-0.27059802 }, 0.625, { 0.36578342,0.88096005,-0.3001864 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,0.8314696,-0.3928474 }, 0.625, { 0.3001864,0.88096005,-0.36578342 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,0.8314696,-0.3928474 }, 0.625, { 0.36578342,0.88096005,-0.3001864 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,0.8314696,-0.3928474 }, 0.625, { 0.40360555,0.7715106,-0.49180678 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,0.8314696,-0.3928474 }, 0.625, { 0.49180678,0.7715106,-0.40360555 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.70710677,-0.5 }, 0.625, { 0.40360555,0.7715106,-0.49180678 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.70710677,-0.5 }, 0.625, { 0.4913,0.6326,-0.5987 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.70710677,-0.5 }, 0.625, { 0.49180678,0.7715106,-0.40360555 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.70710677,-0.5 }, 0.625, { 0.5987,0.6326,-0.4913 }, 0.25 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.55557024,-0.58793765 }, 0.625, { 0.4913,0.6326,-0.5987 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.55557024,-0.58793765 }, 0.625, { 0.56008816,0.46959004,-0.6824855 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.55557024,-0.58793765 }, 0.625, { 0.5987,0.6326,-0.4913 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.55557024,-0.58793765 }, 0.625, { 0.6824855,0.46959004,-0.56008816 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,-0.65328145 }, 0.625, { 0.56008816,0.46959004,-0.6824855 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,-0.65328145 }, 0.625, { 0.60731995,0.28900948,-0.7400243 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,-0.65328145 }, 0.625, { 0.6824855,0.46959004,-0.56008816 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,-0.65328145 }, 0.625, { 0.7400243,0.28900948,-0.60731995 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.19509032,-0.69351983 }, 0.625, { 0.60731995,0.28900948,-0.7400243 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.19509032,-0.69351983 }, 0.625, { 0.63140166,0.09750026,-0.76930207 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.19509032,-0.69351983 }, 0.625, { 0.7400243,0.28900948,-0.60731995 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.19509032,-0.69351983 }, 0.625, { 0.76930207,0.09750026,-0.63140166 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.70710677,0,-0.7071066 }, 0.625, { 0.63140166,-0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.70710677,0,-0.7071066 }, 0.625, { 0.63140166,0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.70710677,0,-0.7071066 }, 0.625, { 0.76930207,-0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.70710677,0,-0.7071066 }, 0.625, { 0.76930207,0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.19509032,-0.69351983 }, 0.625, { 0.60731995,-0.28900948,-0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.19509032,-0.69351983 }, 0.625, { 0.63140166,-0.09750026,-0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.19509032,-0.69351983 }, 0.625, { 0.7400243,-0.28900948,-0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.19509032,-0.69351983 }, 0.625, { 0.76930207,-0.09750026,-0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,-0.65328145 }, 0.625, { 0.56008816,-0.46959004,-0.6824855 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,-0.65328145 }, 0.625, { 0.60731995,-0.28900948,-0.7400243 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,-0.65328145 }, 0.625, { 0.6824855,-0.46959004,-0.56008816 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,-0.65328145 }, 0.625, { 0.7400243,-0.28900948,-0.60731995 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.55557024,-0.58793765 }, 0.625, { 0.4913,-0.6326,-0.5987 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.55557024,-0.58793765 }, 0.625, { 0.56008816,-0.46959004,-0.6824855 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.55557024,-0.58793765 }, 0.625, { 0.5987,-0.6326,-0.4913 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.55557024,-0.58793765 }, 0.625, { 0.6824855,-0.46959004,-0.56008816 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.5,-0.70710677,-0.5 }, 0.625, { 0.40360555,-0.7715106,-0.49180678 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5,-0.70710677,-0.5 }, 0.625, { 0.4913,-0.6326,-0.5987 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5,-0.70710677,-0.5 }, 0.625, { 0.49180678,-0.7715106,-0.40360555 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5,-0.70710677,-0.5 }, 0.625, { 0.5987,-0.6326,-0.4913 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,-0.8314696,-0.3928474 }, 0.625, { 0.3001864,-0.88096005,-0.36578342 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,-0.8314696,-0.3928474 }, 0.625, { 0.36578342,-0.88096005,-0.3001864 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,-0.8314696,-0.3928474 }, 0.625, { 0.40360555,-0.7715106,-0.49180678 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.39284745,-0.8314696,-0.3928474 }, 0.625, { 0.49180678,-0.7715106,-0.40360555 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.9238795,-0.27059802 }, 0.625, { 0.18500718,-0.9565371,-0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.9238795,-0.27059802 }, 0.625, { 0.22540875,-0.9565371,-0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.9238795,-0.27059802 }, 0.625, { 0.3001864,-0.88096005,-0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.27059805,-0.9238795,-0.27059802 }, 0.625, { 0.36578342,-0.88096005,-0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,-0.98078525,-0.13794966 }, 0.625, { 0.06250246,-0.9951391,-0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,-0.98078525,-0.13794966 }, 0.625, { 0.07610299,-0.9951391,-0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,-0.98078525,-0.13794966 }, 0.625, { 0.18500718,-0.9565371,-0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794968,-0.98078525,-0.13794966 }, 0.625, { 0.22540875,-0.9565371,-0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,0.98078525,-0.10838635 }, 0.59375, { 0.07610299,0.9951391,-0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,0.98078525,-0.10838635 }, 0.59375, { 0.0869031,0.99513555,-0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,0.98078525,-0.10838635 }, 0.59375, { 0.22540875,0.9565371,-0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,0.98078525,-0.10838635 }, 0.59375, { 0.25711653,0.9565615,-0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,0.9238795,-0.2126075 }, 0.59375, { 0.22540875,0.9565371,-0.18500718 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,0.9238795,-0.2126075 }, 0.59375, { 0.25711653,0.9565615,-0.13740884 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,0.9238795,-0.2126075 }, 0.59375, { 0.36578342,0.88096005,-0.3001864 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,0.9238795,-0.2126075 }, 0.59375, { 0.4172939,0.88098717,-0.22299676 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,0.8314696,-0.3086582 }, 0.59375, { 0.36578342,0.88096005,-0.3001864 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,0.8314696,-0.3086582 }, 0.59375, { 0.4172939,0.88098717,-0.22299676 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,0.8314696,-0.3086582 }, 0.59375, { 0.49180678,0.7715106,-0.40360555 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,0.8314696,-0.3086582 }, 0.59375, { 0.56110406,0.7715056,-0.29990217 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,0.70710677,-0.39284748 }, 0.59375, { 0.49180678,0.7715106,-0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,0.70710677,-0.39284748 }, 0.59375, { 0.56110406,0.7715056,-0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,0.70710677,-0.39284748 }, 0.59375, { 0.5987,0.6326,-0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,0.70710677,-0.39284748 }, 0.59375, { 0.6830637,0.6325664,-0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,0.55557024,-0.46193963 }, 0.59375, { 0.5987,0.6326,-0.4913 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,0.55557024,-0.46193963 }, 0.59375, { 0.6824855,0.46959004,-0.56008816 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,0.55557024,-0.46193963 }, 0.59375, { 0.6830637,0.6325664,-0.3650806 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,0.55557024,-0.46193963 }, 0.59375, { 0.7786138,0.46960834,-0.4162074 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,-0.51328 }, 0.59375, { 0.6824855,0.46959004,-0.56008816 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,-0.51328 }, 0.59375, { 0.7400243,0.28900948,-0.60731995 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,-0.51328 }, 0.59375, { 0.7786138,0.46960834,-0.4162074 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,-0.51328 }, 0.59375, { 0.8442852,0.28899494,-0.4512921 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,0.19509032,-0.544895 }, 0.59375, { 0.7400243,0.28900948,-0.60731995 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,0.19509032,-0.544895 }, 0.59375, { 0.76930207,0.09750026,-0.63140166 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,0.19509032,-0.544895 }, 0.59375, { 0.8442852,0.28899494,-0.4512921 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,0.19509032,-0.544895 }, 0.59375, { 0.87773585,0.09750398,-0.4691192 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.83146954,0,-0.55557 }, 0.59375, { 0.76930207,-0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.83146954,0,-0.55557 }, 0.59375, { 0.76930207,0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.83146954,0,-0.55557 }, 0.59375, { 0.87773585,-0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.83146954,0,-0.55557 }, 0.59375, { 0.87773585,0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,-0.19509032,-0.544895 }, 0.59375, { 0.7400243,-0.28900948,-0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,-0.19509032,-0.544895 }, 0.59375, { 0.76930207,-0.09750026,-0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,-0.19509032,-0.544895 }, 0.59375, { 0.8442852,-0.28899494,-0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8154931,-0.19509032,-0.544895 }, 0.59375, { 0.87773585,-0.09750398,-0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,-0.51328 }, 0.59375, { 0.6824855,-0.46959004,-0.56008816 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,-0.51328 }, 0.59375, { 0.7400243,-0.28900948,-0.60731995 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,-0.51328 }, 0.59375, { 0.7786138,-0.46960834,-0.4162074 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,-0.51328 }, 0.59375, { 0.8442852,-0.28899494,-0.4512921 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,-0.55557024,-0.46193963 }, 0.59375, { 0.5987,-0.6326,-0.4913 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,-0.55557024,-0.46193963 }, 0.59375, { 0.6824855,-0.46959004,-0.56008816 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,-0.55557024,-0.46193963 }, 0.59375, { 0.6830637,-0.6325664,-0.3650806 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69134164,-0.55557024,-0.46193963 }, 0.59375, { 0.7786138,-0.46960834,-0.4162074 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,-0.70710677,-0.39284748 }, 0.59375, { 0.49180678,-0.7715106,-0.40360555 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,-0.70710677,-0.39284748 }, 0.59375, { 0.56110406,-0.7715056,-0.29990217 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,-0.70710677,-0.39284748 }, 0.59375, { 0.5987,-0.6326,-0.4913 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5879378,-0.70710677,-0.39284748 }, 0.59375, { 0.6830637,-0.6325664,-0.3650806 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,-0.8314696,-0.3086582 }, 0.59375, { 0.36578342,-0.88096005,-0.3001864 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,-0.8314696,-0.3086582 }, 0.59375, { 0.4172939,-0.88098717,-0.22299676 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,-0.8314696,-0.3086582 }, 0.59375, { 0.49180678,-0.7715106,-0.40360555 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.46193972,-0.8314696,-0.3086582 }, 0.59375, { 0.56110406,-0.7715056,-0.29990217 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,-0.9238795,-0.2126075 }, 0.59375, { 0.22540875,-0.9565371,-0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,-0.9238795,-0.2126075 }, 0.59375, { 0.25711653,-0.9565615,-0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,-0.9238795,-0.2126075 }, 0.59375, { 0.36578342,-0.88096005,-0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.31818965,-0.9238795,-0.2126075 }, 0.59375, { 0.4172939,-0.88098717,-0.22299676 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,-0.98078525,-0.10838635 }, 0.59375, { 0.07610299,-0.9951391,-0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,-0.98078525,-0.10838635 }, 0.59375, { 0.0869031,-0.99513555,-0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,-0.98078525,-0.10838635 }, 0.59375, { 0.22540875,-0.9565371,-0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221166,-0.98078525,-0.10838635 }, 0.59375, { 0.25711653,-0.9565615,-0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.984375, { -0.09800381,0.99513876,-0.0097003775 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.015625, { -0.09800381,0.99513876,0.0097003775 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.953125, { -0.09420398,0.99514204,-0.028601207 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.04687497, { -0.09420398,0.99514204,0.028601207 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.921875, { -0.0869031,0.99513555,-0.046401657 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.078125, { -0.0869031,0.99513555,0.046401657 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.890625, { -0.07610299,0.9951391,-0.06250246 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.109375, { -0.07610299,0.9951391,0.06250246 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.859375, { -0.06250246,0.9951391,-0.07610299 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.14062503, { -0.06250246,0.9951391,0.07610299 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.828125, { -0.046401657,0.99513555,-0.0869031 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.17187503, { -0.046401657,0.99513555,0.0869031 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.796875, { -0.028601207,0.99514204,-0.09420398 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.203125, { -0.028601207,0.99514204,0.09420398 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.765625, { -0.0097003775,0.99513876,-0.09800381 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.234375, { -0.0097003775,0.99513876,0.09800381 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.734375, { 0.0097003775,0.99513876,-0.09800381 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.265625, { 0.0097003775,0.99513876,0.09800381 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.703125, { 0.028601207,0.99514204,-0.09420398 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.296875, { 0.028601207,0.99514204,0.09420398 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.671875, { 0.046401657,0.99513555,-0.0869031 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.328125, { 0.046401657,0.99513555,0.0869031 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.640625, { 0.06250246,0.9951391,-0.07610299 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.359375, { 0.06250246,0.9951391,0.07610299 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.609375, { 0.07610299,0.9951391,-0.06250246 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.390625, { 0.07610299,0.9951391,0.06250246 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.578125, { 0.0869031,0.99513555,-0.046401657 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.421875, { 0.0869031,0.99513555,0.046401657 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.546875, { 0.09420398,0.99514204,-0.028601207 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.453125, { 0.09420398,0.99514204,0.028601207 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.515625, { 0.09800381,0.99513876,-0.0097003775 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0,1,-0 }, 0.484375, { 0.09800381,0.99513876,0.0097003775 }, 0 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,0.98078525,-0.07465781 }, 0.5625, { 0.0869031,0.99513555,-0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,0.98078525,-0.07465781 }, 0.5625, { 0.09420398,0.99514204,-0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,0.98078525,-0.07465781 }, 0.5625, { 0.25711653,0.9565615,-0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,0.98078525,-0.07465781 }, 0.5625, { 0.2790153,0.9565524,-0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,-0.14644659 }, 0.5625, { 0.25711653,0.9565615,-0.13740884 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,-0.14644659 }, 0.5625, { 0.2790153,0.9565524,-0.084604636 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,-0.14644659 }, 0.5625, { 0.4172939,0.88098717,-0.22299676 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,-0.14644659 }, 0.5625, { 0.45278472,0.88097024,-0.13739537 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.8314696,-0.21260746 }, 0.5625, { 0.4172939,0.88098717,-0.22299676 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.8314696,-0.21260746 }, 0.5625, { 0.45278472,0.88097024,-0.13739537 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.8314696,-0.21260746 }, 0.5625, { 0.56110406,0.7715056,-0.29990217 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.8314696,-0.21260746 }, 0.5625, { 0.608811,0.771514,-0.18470335 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,0.70710677,-0.27059805 }, 0.5625, { 0.56110406,0.7715056,-0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,0.70710677,-0.27059805 }, 0.5625, { 0.608811,0.771514,-0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,0.70710677,-0.27059805 }, 0.5625, { 0.6830637,0.6325664,-0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,0.70710677,-0.27059805 }, 0.5625, { 0.74116474,0.6325699,-0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.55557024,-0.3181895 }, 0.5625, { 0.6830637,0.6325664,-0.3650806 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.55557024,-0.3181895 }, 0.5625, { 0.74116474,0.6325699,-0.2247893 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.55557024,-0.3181895 }, 0.5625, { 0.7786138,0.46960834,-0.4162074 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.55557024,-0.3181895 }, 0.5625, { 0.8448419,0.46962327,-0.25631273 }, 0.3125 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,-0.3535534 }, 0.5625, { 0.7786138,0.46960834,-0.4162074 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,-0.3535534 }, 0.5625, { 0.8442852,0.28899494,-0.4512921 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,-0.3535534 }, 0.5625, { 0.8448419,0.46962327,-0.25631273 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,-0.3535534 }, 0.5625, { 0.9161052,0.28900164,-0.2779016 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.19509032,-0.37533015 }, 0.5625, { 0.8442852,0.28899494,-0.4512921 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.19509032,-0.37533015 }, 0.5625, { 0.87773585,0.09750398,-0.4691192 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.19509032,-0.37533015 }, 0.5625, { 0.9161052,0.28900164,-0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.19509032,-0.37533015 }, 0.5625, { 0.9523832,0.097498275,-0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9238794,0,-0.38268322 }, 0.5625, { 0.87773585,-0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9238794,0,-0.38268322 }, 0.5625, { 0.87773585,0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9238794,0,-0.38268322 }, 0.5625, { 0.9523832,-0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9238794,0,-0.38268322 }, 0.5625, { 0.9523832,0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.19509032,-0.37533015 }, 0.5625, { 0.8442852,-0.28899494,-0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.19509032,-0.37533015 }, 0.5625, { 0.87773585,-0.09750398,-0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.19509032,-0.37533015 }, 0.5625, { 0.9161052,-0.28900164,-0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.19509032,-0.37533015 }, 0.5625, { 0.9523832,-0.097498275,-0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,-0.3535534 }, 0.5625, { 0.7786138,-0.46960834,-0.4162074 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,-0.3535534 }, 0.5625, { 0.8442852,-0.28899494,-0.4512921 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,-0.3535534 }, 0.5625, { 0.8448419,-0.46962327,-0.25631273 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,-0.3535534 }, 0.5625, { 0.9161052,-0.28900164,-0.2779016 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.55557024,-0.3181895 }, 0.5625, { 0.6830637,-0.6325664,-0.3650806 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.55557024,-0.3181895 }, 0.5625, { 0.74116474,-0.6325699,-0.2247893 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.55557024,-0.3181895 }, 0.5625, { 0.7786138,-0.46960834,-0.4162074 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.55557024,-0.3181895 }, 0.5625, { 0.8448419,-0.46962327,-0.25631273 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,-0.70710677,-0.27059805 }, 0.5625, { 0.56110406,-0.7715056,-0.29990217 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,-0.70710677,-0.27059805 }, 0.5625, { 0.608811,-0.771514,-0.18470335 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,-0.70710677,-0.27059805 }, 0.5625, { 0.6830637,-0.6325664,-0.3650806 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.65328145,-0.70710677,-0.27059805 }, 0.5625, { 0.74116474,-0.6325699,-0.2247893 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.8314696,-0.21260746 }, 0.5625, { 0.4172939,-0.88098717,-0.22299676 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.8314696,-0.21260746 }, 0.5625, { 0.45278472,-0.88097024,-0.13739537 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.8314696,-0.21260746 }, 0.5625, { 0.56110406,-0.7715056,-0.29990217 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.8314696,-0.21260746 }, 0.5625, { 0.608811,-0.771514,-0.18470335 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,-0.14644659 }, 0.5625, { 0.25711653,-0.9565615,-0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,-0.14644659 }, 0.5625, { 0.2790153,-0.9565524,-0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,-0.14644659 }, 0.5625, { 0.4172939,-0.88098717,-0.22299676 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,-0.14644659 }, 0.5625, { 0.45278472,-0.88097024,-0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,-0.98078525,-0.07465781 }, 0.5625, { 0.0869031,-0.99513555,-0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,-0.98078525,-0.07465781 }, 0.5625, { 0.09420398,-0.99514204,-0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,-0.98078525,-0.07465781 }, 0.5625, { 0.25711653,-0.9565615,-0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023992,-0.98078525,-0.07465781 }, 0.5625, { 0.2790153,-0.9565524,-0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,0.98078525,-0.038060214 }, 0.53125, { 0.09420398,0.99514204,-0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,0.98078525,-0.038060214 }, 0.53125, { 0.09800381,0.99513876,-0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,0.98078525,-0.038060214 }, 0.53125, { 0.2790153,0.9565524,-0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,0.98078525,-0.038060214 }, 0.53125, { 0.2902107,0.9565353,-0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,-0.07465781 }, 0.53125, { 0.2790153,0.9565524,-0.084604636 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,-0.07465781 }, 0.53125, { 0.2902107,0.9565353,-0.028601056 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,-0.07465781 }, 0.53125, { 0.45278472,0.88097024,-0.13739537 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,-0.07465781 }, 0.53125, { 0.47088575,0.8809733,-0.046398595 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,0.8314696,-0.108386315 }, 0.53125, { 0.45278472,0.88097024,-0.13739537 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,0.8314696,-0.108386315 }, 0.53125, { 0.47088575,0.8809733,-0.046398595 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,0.8314696,-0.108386315 }, 0.53125, { 0.608811,0.771514,-0.18470335 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,0.8314696,-0.108386315 }, 0.53125, { 0.63318473,0.7714814,-0.062398497 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.70710677,-0.1379497 }, 0.53125, { 0.608811,0.771514,-0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.70710677,-0.1379497 }, 0.53125, { 0.63318473,0.7714814,-0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.70710677,-0.1379497 }, 0.53125, { 0.74116474,0.6325699,-0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,0.70710677,-0.1379497 }, 0.53125, { 0.77077067,0.6325759,-0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.815493,0.55557024,-0.16221157 }, 0.53125, { 0.74116474,0.6325699,-0.2247893 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.815493,0.55557024,-0.16221157 }, 0.53125, { 0.77077067,0.6325759,-0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.815493,0.55557024,-0.16221157 }, 0.53125, { 0.8448419,0.46962327,-0.25631273 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.815493,0.55557024,-0.16221157 }, 0.53125, { 0.87862444,0.46961308,-0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,-0.18023999 }, 0.53125, { 0.8448419,0.46962327,-0.25631273 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,-0.18023999 }, 0.53125, { 0.87862444,0.46961308,-0.0865024 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,-0.18023999 }, 0.53125, { 0.9161052,0.28900164,-0.2779016 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,-0.18023999 }, 0.53125, { 0.95272064,0.28900626,-0.09380203 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,0.19509032,-0.19134161 }, 0.53125, { 0.9161052,0.28900164,-0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,0.19509032,-0.19134161 }, 0.53125, { 0.9523832,0.097498275,-0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,0.19509032,-0.19134161 }, 0.53125, { 0.95272064,0.28900626,-0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,0.19509032,-0.19134161 }, 0.53125, { 0.9904472,0.097504646,-0.097504646 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9807851,0,-0.19509013 }, 0.53125, { 0.9523832,-0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9807851,0,-0.19509013 }, 0.53125, { 0.9523832,0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9807851,0,-0.19509013 }, 0.53125, { 0.9904472,-0.097504646,-0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9807851,0,-0.19509013 }, 0.53125, { 0.9904472,0.097504646,-0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,-0.19509032,-0.19134161 }, 0.53125, { 0.9161052,-0.28900164,-0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,-0.19509032,-0.19134161 }, 0.53125, { 0.9523832,-0.097498275,-0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,-0.19509032,-0.19134161 }, 0.53125, { 0.95272064,-0.28900626,-0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.96193963,-0.19509032,-0.19134161 }, 0.53125, { 0.9904472,-0.097504646,-0.097504646 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,-0.18023999 }, 0.53125, { 0.8448419,-0.46962327,-0.25631273 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,-0.18023999 }, 0.53125, { 0.87862444,-0.46961308,-0.0865024 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,-0.18023999 }, 0.53125, { 0.9161052,-0.28900164,-0.2779016 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,-0.18023999 }, 0.53125, { 0.95272064,-0.28900626,-0.09380203 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.815493,-0.55557024,-0.16221157 }, 0.53125, { 0.74116474,-0.6325699,-0.2247893 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.815493,-0.55557024,-0.16221157 }, 0.53125, { 0.77077067,-0.6325759,-0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.815493,-0.55557024,-0.16221157 }, 0.53125, { 0.8448419,-0.46962327,-0.25631273 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.815493,-0.55557024,-0.16221157 }, 0.53125, { 0.87862444,-0.46961308,-0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.70710677,-0.1379497 }, 0.53125, { 0.608811,-0.771514,-0.18470335 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.70710677,-0.1379497 }, 0.53125, { 0.63318473,-0.7714814,-0.062398497 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.70710677,-0.1379497 }, 0.53125, { 0.74116474,-0.6325699,-0.2247893 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.6935199,-0.70710677,-0.1379497 }, 0.53125, { 0.77077067,-0.6325759,-0.07589712 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,-0.8314696,-0.108386315 }, 0.53125, { 0.45278472,-0.88097024,-0.13739537 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,-0.8314696,-0.108386315 }, 0.53125, { 0.47088575,-0.8809733,-0.046398595 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,-0.8314696,-0.108386315 }, 0.53125, { 0.608811,-0.771514,-0.18470335 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.54489505,-0.8314696,-0.108386315 }, 0.53125, { 0.63318473,-0.7714814,-0.062398497 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,-0.07465781 }, 0.53125, { 0.2790153,-0.9565524,-0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,-0.07465781 }, 0.53125, { 0.2902107,-0.9565353,-0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,-0.07465781 }, 0.53125, { 0.45278472,-0.88097024,-0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,-0.07465781 }, 0.53125, { 0.47088575,-0.8809733,-0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,-0.98078525,-0.038060214 }, 0.53125, { 0.09420398,-0.99514204,-0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,-0.98078525,-0.038060214 }, 0.53125, { 0.09800381,-0.99513876,-0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,-0.98078525,-0.038060214 }, 0.53125, { 0.2790153,-0.9565524,-0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134167,-0.98078525,-0.038060214 }, 0.53125, { 0.2902107,-0.9565353,-0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,0.98078525,1.1175871e-08 }, 0.5, { 0.09800381,0.99513876,-0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,0.98078525,1.1175871e-08 }, 0.5, { 0.09800381,0.99513876,0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,0.98078525,1.1175871e-08 }, 0.5, { 0.2902107,0.9565353,-0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,0.98078525,1.1175871e-08 }, 0.5, { 0.2902107,0.9565353,0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,0.9238795,2.2351742e-08 }, 0.5, { 0.2902107,0.9565353,-0.028601056 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,0.9238795,2.2351742e-08 }, 0.5, { 0.2902107,0.9565353,0.028601056 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,0.9238795,2.2351742e-08 }, 0.5, { 0.47088575,0.8809733,-0.046398595 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,0.9238795,2.2351742e-08 }, 0.5, { 0.47088575,0.8809733,0.046398595 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,0.8314696,5.2154064e-08 }, 0.49999997, { 0.47088575,0.8809733,-0.046398595 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,0.8314696,5.2154064e-08 }, 0.49999997, { 0.47088575,0.8809733,0.046398595 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,0.8314696,5.2154064e-08 }, 0.49999997, { 0.63318473,0.7714814,-0.062398497 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,0.8314696,5.2154064e-08 }, 0.49999997, { 0.63318473,0.7714814,0.062398497 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,0.70710677,-1.4901161e-08 }, 0.5, { 0.63318473,0.7714814,-0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,0.70710677,-1.4901161e-08 }, 0.5, { 0.63318473,0.7714814,0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,0.70710677,-1.4901161e-08 }, 0.5, { 0.77077067,0.6325759,-0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,0.70710677,-1.4901161e-08 }, 0.5, { 0.77077067,0.6325759,0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,0.55557024,8.940697e-08 }, 0.49999997, { 0.77077067,0.6325759,-0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,0.55557024,8.940697e-08 }, 0.49999997, { 0.77077067,0.6325759,0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,0.55557024,8.940697e-08 }, 0.49999997, { 0.87862444,0.46961308,-0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,0.55557024,8.940697e-08 }, 0.49999997, { 0.87862444,0.46961308,0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,0.38268346,-4.4703484e-08 }, 0.5, { 0.87862444,0.46961308,-0.0865024 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,0.38268346,-4.4703484e-08 }, 0.5, { 0.87862444,0.46961308,0.0865024 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,0.38268346,-4.4703484e-08 }, 0.5, { 0.95272064,0.28900626,-0.09380203 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,0.38268346,-4.4703484e-08 }, 0.5, { 0.95272064,0.28900626,0.09380203 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,0.19509032,8.940697e-08 }, 0.5, { 0.95272064,0.28900626,-0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,0.19509032,8.940697e-08 }, 0.5, { 0.95272064,0.28900626,0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,0.19509032,8.940697e-08 }, 0.5, { 0.99043757,0.09750369,0.0976037 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,0.19509032,8.940697e-08 }, 0.5, { 0.9904472,0.097504646,-0.097504646 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9999997,0,1.6391277e-07 }, 0.49999997, { 0.99043757,-0.09750369,0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9999997,0,1.6391277e-07 }, 0.49999997, { 0.99043757,0.09750369,0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9999997,0,1.6391277e-07 }, 0.49999997, { 0.9904472,-0.097504646,-0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9999997,0,1.6391277e-07 }, 0.49999997, { 0.9904472,0.097504646,-0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,-0.19509032,8.940697e-08 }, 0.5, { 0.95272064,-0.28900626,-0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,-0.19509032,8.940697e-08 }, 0.5, { 0.95272064,-0.28900626,0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,-0.19509032,8.940697e-08 }, 0.5, { 0.99043757,-0.09750369,0.0976037 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.98078513,-0.19509032,8.940697e-08 }, 0.5, { 0.9904472,-0.097504646,-0.097504646 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,-0.38268346,-4.4703484e-08 }, 0.5, { 0.87862444,-0.46961308,-0.0865024 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,-0.38268346,-4.4703484e-08 }, 0.5, { 0.87862444,-0.46961308,0.0865024 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,-0.38268346,-4.4703484e-08 }, 0.5, { 0.95272064,-0.28900626,-0.09380203 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.92387944,-0.38268346,-4.4703484e-08 }, 0.5, { 0.95272064,-0.28900626,0.09380203 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,-0.55557024,8.940697e-08 }, 0.49999997, { 0.77077067,-0.6325759,-0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,-0.55557024,8.940697e-08 }, 0.49999997, { 0.77077067,-0.6325759,0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,-0.55557024,8.940697e-08 }, 0.49999997, { 0.87862444,-0.46961308,-0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.8314694,-0.55557024,8.940697e-08 }, 0.49999997, { 0.87862444,-0.46961308,0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,-0.70710677,-1.4901161e-08 }, 0.5, { 0.63318473,-0.7714814,-0.062398497 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,-0.70710677,-1.4901161e-08 }, 0.5, { 0.63318473,-0.7714814,0.062398497 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,-0.70710677,-1.4901161e-08 }, 0.5, { 0.77077067,-0.6325759,-0.07589712 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.7071067,-0.70710677,-1.4901161e-08 }, 0.5, { 0.77077067,-0.6325759,0.07589712 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,-0.8314696,5.2154064e-08 }, 0.49999997, { 0.47088575,-0.8809733,-0.046398595 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,-0.8314696,5.2154064e-08 }, 0.49999997, { 0.47088575,-0.8809733,0.046398595 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,-0.8314696,5.2154064e-08 }, 0.49999997, { 0.63318473,-0.7714814,-0.062398497 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5555701,-0.8314696,5.2154064e-08 }, 0.49999997, { 0.63318473,-0.7714814,0.062398497 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,-0.9238795,2.2351742e-08 }, 0.5, { 0.2902107,-0.9565353,-0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,-0.9238795,2.2351742e-08 }, 0.5, { 0.2902107,-0.9565353,0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,-0.9238795,2.2351742e-08 }, 0.5, { 0.47088575,-0.8809733,-0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.3826834,-0.9238795,2.2351742e-08 }, 0.5, { 0.47088575,-0.8809733,0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,-0.98078525,1.1175871e-08 }, 0.5, { 0.09800381,-0.99513876,-0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,-0.98078525,1.1175871e-08 }, 0.5, { 0.09800381,-0.99513876,0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,-0.98078525,1.1175871e-08 }, 0.5, { 0.2902107,-0.9565353,-0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19509026,-0.98078525,1.1175871e-08 }, 0.5, { 0.2902107,-0.9565353,0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,0.98078525,0.038060233 }, 0.46875, { 0.09420398,0.99514204,0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,0.98078525,0.038060233 }, 0.46875, { 0.09800381,0.99513876,0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,0.98078525,0.038060233 }, 0.46875, { 0.2790153,0.9565524,0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,0.98078525,0.038060233 }, 0.46875, { 0.2902107,0.9565353,0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,0.07465785 }, 0.46875, { 0.2790153,0.9565524,0.084604636 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,0.07465785 }, 0.46875, { 0.2902107,0.9565353,0.028601056 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,0.07465785 }, 0.46875, { 0.45278472,0.88097024,0.13739537 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,0.9238795,0.07465785 }, 0.46875, { 0.47088575,0.8809733,0.046398595 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.544895,0.8314696,0.108386405 }, 0.46875, { 0.45278472,0.88097024,0.13739537 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.544895,0.8314696,0.108386405 }, 0.46875, { 0.47088575,0.8809733,0.046398595 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.544895,0.8314696,0.108386405 }, 0.46875, { 0.608811,0.771514,0.18470335 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.544895,0.8314696,0.108386405 }, 0.46875, { 0.63318473,0.7714814,0.062398497 }, 0.1875 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,0.70710677,0.13794966 }, 0.46875, { 0.608811,0.771514,0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,0.70710677,0.13794966 }, 0.46875, { 0.63318473,0.7714814,0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,0.70710677,0.13794966 }, 0.46875, { 0.74116474,0.6325699,0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,0.70710677,0.13794966 }, 0.46875, { 0.77077067,0.6325759,0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.55557024,0.16221173 }, 0.46874997, { 0.74116474,0.6325699,0.2247893 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.55557024,0.16221173 }, 0.46874997, { 0.77077067,0.6325759,0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.55557024,0.16221173 }, 0.46874997, { 0.8448419,0.46962327,0.25631273 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.55557024,0.16221173 }, 0.46874997, { 0.87862444,0.46961308,0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,0.1802399 }, 0.46875, { 0.8448419,0.46962327,0.25631273 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,0.1802399 }, 0.46875, { 0.87862444,0.46961308,0.0865024 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,0.1802399 }, 0.46875, { 0.9161052,0.28900164,0.2779016 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,0.38268346,0.1802399 }, 0.46875, { 0.95272064,0.28900626,0.09380203 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,0.19509032,0.19134177 }, 0.46875, { 0.9161052,0.28900164,0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,0.19509032,0.19134177 }, 0.46875, { 0.9523832,0.097498275,0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,0.19509032,0.19134177 }, 0.46875, { 0.95272064,0.28900626,0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,0.19509032,0.19134177 }, 0.46875, { 0.99043757,0.09750369,0.0976037 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9807849,0,0.19509043 }, 0.46874997, { 0.9523832,-0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9807849,0,0.19509043 }, 0.46874997, { 0.9523832,0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9807849,0,0.19509043 }, 0.46874997, { 0.99043757,-0.09750369,0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9807849,0,0.19509043 }, 0.46874997, { 0.99043757,0.09750369,0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,-0.19509032,0.19134177 }, 0.46875, { 0.9161052,-0.28900164,0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,-0.19509032,0.19134177 }, 0.46875, { 0.9523832,-0.097498275,0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,-0.19509032,0.19134177 }, 0.46875, { 0.95272064,-0.28900626,0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.9619396,-0.19509032,0.19134177 }, 0.46875, { 0.99043757,-0.09750369,0.0976037 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,0.1802399 }, 0.46875, { 0.8448419,-0.46962327,0.25631273 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,0.1802399 }, 0.46875, { 0.87862444,-0.46961308,0.0865024 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,0.1802399 }, 0.46875, { 0.9161052,-0.28900164,0.2779016 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.90612733,-0.38268346,0.1802399 }, 0.46875, { 0.95272064,-0.28900626,0.09380203 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.55557024,0.16221173 }, 0.46874997, { 0.74116474,-0.6325699,0.2247893 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.55557024,0.16221173 }, 0.46874997, { 0.77077067,-0.6325759,0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.55557024,0.16221173 }, 0.46874997, { 0.8448419,-0.46962327,0.25631273 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.55557024,0.16221173 }, 0.46874997, { 0.87862444,-0.46961308,0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,-0.70710677,0.13794966 }, 0.46875, { 0.608811,-0.771514,0.18470335 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,-0.70710677,0.13794966 }, 0.46875, { 0.63318473,-0.7714814,0.062398497 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,-0.70710677,0.13794966 }, 0.46875, { 0.74116474,-0.6325699,0.2247893 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.69351983,-0.70710677,0.13794966 }, 0.46875, { 0.77077067,-0.6325759,0.07589712 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.544895,-0.8314696,0.108386405 }, 0.46875, { 0.45278472,-0.88097024,0.13739537 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.544895,-0.8314696,0.108386405 }, 0.46875, { 0.47088575,-0.8809733,0.046398595 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.544895,-0.8314696,0.108386405 }, 0.46875, { 0.608811,-0.771514,0.18470335 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.544895,-0.8314696,0.108386405 }, 0.46875, { 0.63318473,-0.7714814,0.062398497 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,0.07465785 }, 0.46875, { 0.2790153,-0.9565524,0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,0.07465785 }, 0.46875, { 0.2902107,-0.9565353,0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,0.07465785 }, 0.46875, { 0.45278472,-0.88097024,0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.37533024,-0.9238795,0.07465785 }, 0.46875, { 0.47088575,-0.8809733,0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,-0.98078525,0.038060233 }, 0.46875, { 0.09420398,-0.99514204,0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,-0.98078525,0.038060233 }, 0.46875, { 0.09800381,-0.99513876,0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,-0.98078525,0.038060233 }, 0.46875, { 0.2790153,-0.9565524,0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.19134165,-0.98078525,0.038060233 }, 0.46875, { 0.2902107,-0.9565353,0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,0.98078525,0.07465782 }, 0.4375, { 0.0869031,0.99513555,0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,0.98078525,0.07465782 }, 0.4375, { 0.09420398,0.99514204,0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,0.98078525,0.07465782 }, 0.4375, { 0.25711653,0.9565615,0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,0.98078525,0.07465782 }, 0.4375, { 0.2790153,0.9565524,0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,0.14644662 }, 0.4375, { 0.25711653,0.9565615,0.13740884 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,0.14644662 }, 0.4375, { 0.2790153,0.9565524,0.084604636 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,0.14644662 }, 0.4375, { 0.4172939,0.88098717,0.22299676 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.9238795,0.14644662 }, 0.4375, { 0.45278472,0.88097024,0.13739537 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,0.8314696,0.21260753 }, 0.43749997, { 0.4172939,0.88098717,0.22299676 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,0.8314696,0.21260753 }, 0.43749997, { 0.45278472,0.88097024,0.13739537 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,0.8314696,0.21260753 }, 0.43749997, { 0.56110406,0.7715056,0.29990217 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,0.8314696,0.21260753 }, 0.43749997, { 0.608811,0.771514,0.18470335 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.70710677,0.270598 }, 0.4375, { 0.56110406,0.7715056,0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.70710677,0.270598 }, 0.4375, { 0.608811,0.771514,0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.70710677,0.270598 }, 0.4375, { 0.6830637,0.6325664,0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.70710677,0.270598 }, 0.4375, { 0.74116474,0.6325699,0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,0.55557024,0.31818965 }, 0.43749997, { 0.6830637,0.6325664,0.3650806 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,0.55557024,0.31818965 }, 0.43749997, { 0.74116474,0.6325699,0.2247893 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,0.55557024,0.31818965 }, 0.43749997, { 0.7786138,0.46960834,0.4162074 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,0.55557024,0.31818965 }, 0.43749997, { 0.8448419,0.46962327,0.25631273 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,0.3535533 }, 0.4375, { 0.7786138,0.46960834,0.4162074 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,0.3535533 }, 0.4375, { 0.8442852,0.28899494,0.4512921 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,0.3535533 }, 0.4375, { 0.8448419,0.46962327,0.25631273 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,0.38268346,0.3535533 }, 0.4375, { 0.9161052,0.28900164,0.2779016 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,0.19509032,0.3753303 }, 0.4375, { 0.8442852,0.28899494,0.4512921 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,0.19509032,0.3753303 }, 0.4375, { 0.87773585,0.09750398,0.4691192 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,0.19509032,0.3753303 }, 0.4375, { 0.9161052,0.28900164,0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,0.19509032,0.3753303 }, 0.4375, { 0.9523832,0.097498275,0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.9238791,0,0.38268346 }, 0.43749997, { 0.87773585,-0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9238791,0,0.38268346 }, 0.43749997, { 0.87773585,0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9238791,0,0.38268346 }, 0.43749997, { 0.9523832,-0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9238791,0,0.38268346 }, 0.43749997, { 0.9523832,0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,-0.19509032,0.3753303 }, 0.4375, { 0.8442852,-0.28899494,0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,-0.19509032,0.3753303 }, 0.4375, { 0.87773585,-0.09750398,0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,-0.19509032,0.3753303 }, 0.4375, { 0.9161052,-0.28900164,0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.9061272,-0.19509032,0.3753303 }, 0.4375, { 0.9523832,-0.097498275,0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,0.3535533 }, 0.4375, { 0.7786138,-0.46960834,0.4162074 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,0.3535533 }, 0.4375, { 0.8442852,-0.28899494,0.4512921 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,0.3535533 }, 0.4375, { 0.8448419,-0.46962327,0.25631273 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.8535533,-0.38268346,0.3535533 }, 0.4375, { 0.9161052,-0.28900164,0.2779016 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,-0.55557024,0.31818965 }, 0.43749997, { 0.6830637,-0.6325664,0.3650806 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,-0.55557024,0.31818965 }, 0.43749997, { 0.74116474,-0.6325699,0.2247893 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,-0.55557024,0.31818965 }, 0.43749997, { 0.7786138,-0.46960834,0.4162074 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.7681775,-0.55557024,0.31818965 }, 0.43749997, { 0.8448419,-0.46962327,0.25631273 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.70710677,0.270598 }, 0.4375, { 0.56110406,-0.7715056,0.29990217 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.70710677,0.270598 }, 0.4375, { 0.608811,-0.771514,0.18470335 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.70710677,0.270598 }, 0.4375, { 0.6830637,-0.6325664,0.3650806 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.70710677,0.270598 }, 0.4375, { 0.74116474,-0.6325699,0.2247893 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,-0.8314696,0.21260753 }, 0.43749997, { 0.4172939,-0.88098717,0.22299676 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,-0.8314696,0.21260753 }, 0.43749997, { 0.45278472,-0.88097024,0.13739537 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,-0.8314696,0.21260753 }, 0.43749997, { 0.56110406,-0.7715056,0.29990217 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.5132798,-0.8314696,0.21260753 }, 0.43749997, { 0.608811,-0.771514,0.18470335 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,0.14644662 }, 0.4375, { 0.25711653,-0.9565615,0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,0.14644662 }, 0.4375, { 0.2790153,-0.9565524,0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,0.14644662 }, 0.4375, { 0.4172939,-0.88098717,0.22299676 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.9238795,0.14644662 }, 0.4375, { 0.45278472,-0.88097024,0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,-0.98078525,0.07465782 }, 0.4375, { 0.0869031,-0.99513555,0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,-0.98078525,0.07465782 }, 0.4375, { 0.09420398,-0.99514204,0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,-0.98078525,0.07465782 }, 0.4375, { 0.25711653,-0.9565615,0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.18023989,-0.98078525,0.07465782 }, 0.4375, { 0.2790153,-0.9565524,0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,0.98078525,0.10838634 }, 0.40625, { 0.07610299,0.9951391,0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,0.98078525,0.10838634 }, 0.40625, { 0.0869031,0.99513555,0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,0.98078525,0.10838634 }, 0.40625, { 0.22540875,0.9565371,0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,0.98078525,0.10838634 }, 0.40625, { 0.25711653,0.9565615,0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,0.9238795,0.21260752 }, 0.40625, { 0.22540875,0.9565371,0.18500718 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,0.9238795,0.21260752 }, 0.40625, { 0.25711653,0.9565615,0.13740884 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,0.9238795,0.21260752 }, 0.40625, { 0.36578342,0.88096005,0.3001864 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,0.9238795,0.21260752 }, 0.40625, { 0.4172939,0.88098717,0.22299676 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,0.8314696,0.30865824 }, 0.40625, { 0.36578342,0.88096005,0.3001864 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,0.8314696,0.30865824 }, 0.40625, { 0.4172939,0.88098717,0.22299676 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,0.8314696,0.30865824 }, 0.40625, { 0.49180678,0.7715106,0.40360555 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,0.8314696,0.30865824 }, 0.40625, { 0.56110406,0.7715056,0.29990217 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.70710677,0.39284742 }, 0.40625, { 0.49180678,0.7715106,0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.70710677,0.39284742 }, 0.40625, { 0.56110406,0.7715056,0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.70710677,0.39284742 }, 0.40625, { 0.5987,0.6326,0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,0.70710677,0.39284742 }, 0.40625, { 0.6830637,0.6325664,0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,0.55557024,0.4619397 }, 0.40625, { 0.5987,0.6326,0.4913 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,0.55557024,0.4619397 }, 0.40625, { 0.6824855,0.46959004,0.56008816 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,0.55557024,0.4619397 }, 0.40625, { 0.6830637,0.6325664,0.3650806 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,0.55557024,0.4619397 }, 0.40625, { 0.7786138,0.46960834,0.4162074 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,0.51327986 }, 0.40625, { 0.6824855,0.46959004,0.56008816 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,0.51327986 }, 0.40625, { 0.7400243,0.28900948,0.60731995 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,0.51327986 }, 0.40625, { 0.7786138,0.46960834,0.4162074 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,0.38268346,0.51327986 }, 0.40625, { 0.8442852,0.28899494,0.4512921 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.19509032,0.54489505 }, 0.40625, { 0.7400243,0.28900948,0.60731995 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.19509032,0.54489505 }, 0.40625, { 0.76930207,0.09750026,0.63140166 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.19509032,0.54489505 }, 0.40625, { 0.8442852,0.28899494,0.4512921 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,0.19509032,0.54489505 }, 0.40625, { 0.87773585,0.09750398,0.4691192 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.8314691,0,0.5555702 }, 0.40624997, { 0.76930207,-0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.8314691,0,0.5555702 }, 0.40624997, { 0.76930207,0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.8314691,0,0.5555702 }, 0.40624997, { 0.87773585,-0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.8314691,0,0.5555702 }, 0.40624997, { 0.87773585,0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.19509032,0.54489505 }, 0.40625, { 0.7400243,-0.28900948,0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.19509032,0.54489505 }, 0.40625, { 0.76930207,-0.09750026,0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.19509032,0.54489505 }, 0.40625, { 0.8442852,-0.28899494,0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.8154929,-0.19509032,0.54489505 }, 0.40625, { 0.87773585,-0.09750398,0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,0.51327986 }, 0.40625, { 0.6824855,-0.46959004,0.56008816 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,0.51327986 }, 0.40625, { 0.7400243,-0.28900948,0.60731995 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,0.51327986 }, 0.40625, { 0.7786138,-0.46960834,0.4162074 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.7681776,-0.38268346,0.51327986 }, 0.40625, { 0.8442852,-0.28899494,0.4512921 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,-0.55557024,0.4619397 }, 0.40625, { 0.5987,-0.6326,0.4913 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,-0.55557024,0.4619397 }, 0.40625, { 0.6824855,-0.46959004,0.56008816 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,-0.55557024,0.4619397 }, 0.40625, { 0.6830637,-0.6325664,0.3650806 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.69134146,-0.55557024,0.4619397 }, 0.40625, { 0.7786138,-0.46960834,0.4162074 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.70710677,0.39284742 }, 0.40625, { 0.49180678,-0.7715106,0.40360555 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.70710677,0.39284742 }, 0.40625, { 0.56110406,-0.7715056,0.29990217 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.70710677,0.39284742 }, 0.40625, { 0.5987,-0.6326,0.4913 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.5879377,-0.70710677,0.39284742 }, 0.40625, { 0.6830637,-0.6325664,0.3650806 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,-0.8314696,0.30865824 }, 0.40625, { 0.36578342,-0.88096005,0.3001864 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,-0.8314696,0.30865824 }, 0.40625, { 0.4172939,-0.88098717,0.22299676 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,-0.8314696,0.30865824 }, 0.40625, { 0.49180678,-0.7715106,0.40360555 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.46193957,-0.8314696,0.30865824 }, 0.40625, { 0.56110406,-0.7715056,0.29990217 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,-0.9238795,0.21260752 }, 0.40625, { 0.22540875,-0.9565371,0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,-0.9238795,0.21260752 }, 0.40625, { 0.25711653,-0.9565615,0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,-0.9238795,0.21260752 }, 0.40625, { 0.36578342,-0.88096005,0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.3181896,-0.9238795,0.21260752 }, 0.40625, { 0.4172939,-0.88098717,0.22299676 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,-0.98078525,0.10838634 }, 0.40625, { 0.07610299,-0.9951391,0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,-0.98078525,0.10838634 }, 0.40625, { 0.0869031,-0.99513555,0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,-0.98078525,0.10838634 }, 0.40625, { 0.22540875,-0.9565371,0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.1622116,-0.98078525,0.10838634 }, 0.40625, { 0.25711653,-0.9565615,0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,0.98078525,0.13794963 }, 0.375, { 0.06250246,0.9951391,0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,0.98078525,0.13794963 }, 0.375, { 0.07610299,0.9951391,0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,0.98078525,0.13794963 }, 0.375, { 0.18500718,0.9565371,0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,0.98078525,0.13794963 }, 0.375, { 0.22540875,0.9565371,0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,0.9238795,0.27059802 }, 0.375, { 0.18500718,0.9565371,0.22540875 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,0.9238795,0.27059802 }, 0.375, { 0.22540875,0.9565371,0.18500718 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,0.9238795,0.27059802 }, 0.375, { 0.3001864,0.88096005,0.36578342 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,0.9238795,0.27059802 }, 0.375, { 0.36578342,0.88096005,0.3001864 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,0.8314696,0.39284742 }, 0.37499997, { 0.3001864,0.88096005,0.36578342 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,0.8314696,0.39284742 }, 0.37499997, { 0.36578342,0.88096005,0.3001864 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,0.8314696,0.39284742 }, 0.37499997, { 0.40360555,0.7715106,0.49180678 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,0.8314696,0.39284742 }, 0.37499997, { 0.49180678,0.7715106,0.40360555 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,0.70710677,0.49999994 }, 0.375, { 0.40360555,0.7715106,0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,0.70710677,0.49999994 }, 0.375, { 0.4913,0.6326,0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,0.70710677,0.49999994 }, 0.375, { 0.49180678,0.7715106,0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,0.70710677,0.49999994 }, 0.375, { 0.5987,0.6326,0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,0.55557024,0.58793765 }, 0.375, { 0.4913,0.6326,0.5987 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,0.55557024,0.58793765 }, 0.375, { 0.56008816,0.46959004,0.6824855 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,0.55557024,0.58793765 }, 0.375, { 0.5987,0.6326,0.4913 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,0.55557024,0.58793765 }, 0.375, { 0.6824855,0.46959004,0.56008816 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,0.65328133 }, 0.375, { 0.56008816,0.46959004,0.6824855 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,0.65328133 }, 0.375, { 0.60731995,0.28900948,0.7400243 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,0.65328133 }, 0.375, { 0.6824855,0.46959004,0.56008816 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,0.38268346,0.65328133 }, 0.375, { 0.7400243,0.28900948,0.60731995 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,0.19509032,0.69351983 }, 0.375, { 0.60731995,0.28900948,0.7400243 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,0.19509032,0.69351983 }, 0.375, { 0.63140166,0.09750026,0.76930207 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,0.19509032,0.69351983 }, 0.375, { 0.7400243,0.28900948,0.60731995 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,0.19509032,0.69351983 }, 0.375, { 0.76930207,0.09750026,0.63140166 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.70710623,0,0.70710665 }, 0.37499994, { 0.63140166,-0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.70710623,0,0.70710665 }, 0.37499994, { 0.63140166,0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.70710623,0,0.70710665 }, 0.37499994, { 0.76930207,-0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.70710623,0,0.70710665 }, 0.37499994, { 0.76930207,0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,-0.19509032,0.69351983 }, 0.375, { 0.60731995,-0.28900948,0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,-0.19509032,0.69351983 }, 0.375, { 0.63140166,-0.09750026,0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,-0.19509032,0.69351983 }, 0.375, { 0.7400243,-0.28900948,0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6935197,-0.19509032,0.69351983 }, 0.375, { 0.76930207,-0.09750026,0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,0.65328133 }, 0.375, { 0.56008816,-0.46959004,0.6824855 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,0.65328133 }, 0.375, { 0.60731995,-0.28900948,0.7400243 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,0.65328133 }, 0.375, { 0.6824855,-0.46959004,0.56008816 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.6532814,-0.38268346,0.65328133 }, 0.375, { 0.7400243,-0.28900948,0.60731995 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,-0.55557024,0.58793765 }, 0.375, { 0.4913,-0.6326,0.5987 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,-0.55557024,0.58793765 }, 0.375, { 0.56008816,-0.46959004,0.6824855 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,-0.55557024,0.58793765 }, 0.375, { 0.5987,-0.6326,0.4913 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.58793753,-0.55557024,0.58793765 }, 0.375, { 0.6824855,-0.46959004,0.56008816 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,-0.70710677,0.49999994 }, 0.375, { 0.40360555,-0.7715106,0.49180678 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,-0.70710677,0.49999994 }, 0.375, { 0.4913,-0.6326,0.5987 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,-0.70710677,0.49999994 }, 0.375, { 0.49180678,-0.7715106,0.40360555 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.49999994,-0.70710677,0.49999994 }, 0.375, { 0.5987,-0.6326,0.4913 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,-0.8314696,0.39284742 }, 0.37499997, { 0.3001864,-0.88096005,0.36578342 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,-0.8314696,0.39284742 }, 0.37499997, { 0.36578342,-0.88096005,0.3001864 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,-0.8314696,0.39284742 }, 0.37499997, { 0.40360555,-0.7715106,0.49180678 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.39284727,-0.8314696,0.39284742 }, 0.37499997, { 0.49180678,-0.7715106,0.40360555 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,-0.9238795,0.27059802 }, 0.375, { 0.18500718,-0.9565371,0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,-0.9238795,0.27059802 }, 0.375, { 0.22540875,-0.9565371,0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,-0.9238795,0.27059802 }, 0.375, { 0.3001864,-0.88096005,0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.27059796,-0.9238795,0.27059802 }, 0.375, { 0.36578342,-0.88096005,0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,-0.98078525,0.13794963 }, 0.375, { 0.06250246,-0.9951391,0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,-0.98078525,0.13794963 }, 0.375, { 0.07610299,-0.9951391,0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,-0.98078525,0.13794963 }, 0.375, { 0.18500718,-0.9565371,0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794962,-0.98078525,0.13794963 }, 0.375, { 0.22540875,-0.9565371,0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,0.98078525,0.1622116 }, 0.34375, { 0.046401657,0.99513555,0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,0.98078525,0.1622116 }, 0.34375, { 0.06250246,0.9951391,0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,0.98078525,0.1622116 }, 0.34375, { 0.13740884,0.9565615,0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,0.98078525,0.1622116 }, 0.34375, { 0.18500718,0.9565371,0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,0.9238795,0.31818962 }, 0.34375, { 0.13740884,0.9565615,0.25711653 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,0.9238795,0.31818962 }, 0.34375, { 0.18500718,0.9565371,0.22540875 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,0.9238795,0.31818962 }, 0.34375, { 0.22299676,0.88098717,0.4172939 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,0.9238795,0.31818962 }, 0.34375, { 0.3001864,0.88096005,0.36578342 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,0.8314696,0.46193966 }, 0.34375, { 0.22299676,0.88098717,0.4172939 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,0.8314696,0.46193966 }, 0.34375, { 0.29990217,0.7715056,0.56110406 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,0.8314696,0.46193966 }, 0.34375, { 0.3001864,0.88096005,0.36578342 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,0.8314696,0.46193966 }, 0.34375, { 0.40360555,0.7715106,0.49180678 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,0.70710677,0.5879377 }, 0.34375, { 0.29990217,0.7715056,0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,0.70710677,0.5879377 }, 0.34375, { 0.3650806,0.6325664,0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,0.70710677,0.5879377 }, 0.34375, { 0.40360555,0.7715106,0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,0.70710677,0.5879377 }, 0.34375, { 0.4913,0.6326,0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,0.55557024,0.6913415 }, 0.34375, { 0.3650806,0.6325664,0.6830637 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,0.55557024,0.6913415 }, 0.34375, { 0.4162074,0.46960834,0.7786138 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,0.55557024,0.6913415 }, 0.34375, { 0.4913,0.6326,0.5987 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,0.55557024,0.6913415 }, 0.34375, { 0.56008816,0.46959004,0.6824855 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,0.76817757 }, 0.34375, { 0.4162074,0.46960834,0.7786138 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,0.76817757 }, 0.34375, { 0.4512921,0.28899494,0.8442852 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,0.76817757 }, 0.34375, { 0.56008816,0.46959004,0.6824855 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,0.38268346,0.76817757 }, 0.34375, { 0.60731995,0.28900948,0.7400243 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,0.19509032,0.815493 }, 0.34375, { 0.4512921,0.28899494,0.8442852 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,0.19509032,0.815493 }, 0.34375, { 0.4691192,0.09750398,0.87773585 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,0.19509032,0.815493 }, 0.34375, { 0.60731995,0.28900948,0.7400243 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,0.19509032,0.815493 }, 0.34375, { 0.63140166,0.09750026,0.76930207 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.5555697,0,0.83146936 }, 0.34374994, { 0.4691192,-0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.5555697,0,0.83146936 }, 0.34374994, { 0.4691192,0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.5555697,0,0.83146936 }, 0.34374994, { 0.63140166,-0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.5555697,0,0.83146936 }, 0.34374994, { 0.63140166,0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,-0.19509032,0.815493 }, 0.34375, { 0.4512921,-0.28899494,0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,-0.19509032,0.815493 }, 0.34375, { 0.4691192,-0.09750398,0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,-0.19509032,0.815493 }, 0.34375, { 0.60731995,-0.28900948,0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5448949,-0.19509032,0.815493 }, 0.34375, { 0.63140166,-0.09750026,0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,0.76817757 }, 0.34375, { 0.4162074,-0.46960834,0.7786138 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,0.76817757 }, 0.34375, { 0.4512921,-0.28899494,0.8442852 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,0.76817757 }, 0.34375, { 0.56008816,-0.46959004,0.6824855 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.5132799,-0.38268346,0.76817757 }, 0.34375, { 0.60731995,-0.28900948,0.7400243 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,-0.55557024,0.6913415 }, 0.34375, { 0.3650806,-0.6325664,0.6830637 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,-0.55557024,0.6913415 }, 0.34375, { 0.4162074,-0.46960834,0.7786138 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,-0.55557024,0.6913415 }, 0.34375, { 0.4913,-0.6326,0.5987 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.46193954,-0.55557024,0.6913415 }, 0.34375, { 0.56008816,-0.46959004,0.6824855 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,-0.70710677,0.5879377 }, 0.34375, { 0.29990217,-0.7715056,0.56110406 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,-0.70710677,0.5879377 }, 0.34375, { 0.3650806,-0.6325664,0.6830637 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,-0.70710677,0.5879377 }, 0.34375, { 0.40360555,-0.7715106,0.49180678 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.39284742,-0.70710677,0.5879377 }, 0.34375, { 0.4913,-0.6326,0.5987 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,-0.8314696,0.46193966 }, 0.34375, { 0.22299676,-0.88098717,0.4172939 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,-0.8314696,0.46193966 }, 0.34375, { 0.29990217,-0.7715056,0.56110406 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,-0.8314696,0.46193966 }, 0.34375, { 0.3001864,-0.88096005,0.36578342 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.3086581,-0.8314696,0.46193966 }, 0.34375, { 0.40360555,-0.7715106,0.49180678 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,-0.9238795,0.31818962 }, 0.34375, { 0.13740884,-0.9565615,0.25711653 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,-0.9238795,0.31818962 }, 0.34375, { 0.18500718,-0.9565371,0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,-0.9238795,0.31818962 }, 0.34375, { 0.22299676,-0.88098717,0.4172939 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.21260744,-0.9238795,0.31818962 }, 0.34375, { 0.3001864,-0.88096005,0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,-0.98078525,0.1622116 }, 0.34375, { 0.046401657,-0.99513555,0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,-0.98078525,0.1622116 }, 0.34375, { 0.06250246,-0.9951391,0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,-0.98078525,0.1622116 }, 0.34375, { 0.13740884,-0.9565615,0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.108386315,-0.98078525,0.1622116 }, 0.34375, { 0.18500718,-0.9565371,0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,0.98078525,0.18023986 }, 0.3125, { 0.028601207,0.99514204,0.09420398 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,0.98078525,0.18023986 }, 0.3125, { 0.046401657,0.99513555,0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,0.98078525,0.18023986 }, 0.3125, { 0.084604636,0.9565524,0.2790153 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,0.98078525,0.18023986 }, 0.3125, { 0.13740884,0.9565615,0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,0.9238795,0.35355332 }, 0.3125, { 0.084604636,0.9565524,0.2790153 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,0.9238795,0.35355332 }, 0.3125, { 0.13739537,0.88097024,0.45278472 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,0.9238795,0.35355332 }, 0.3125, { 0.13740884,0.9565615,0.25711653 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,0.9238795,0.35355332 }, 0.3125, { 0.22299676,0.88098717,0.4172939 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,0.8314696,0.5132798 }, 0.3125, { 0.13739537,0.88097024,0.45278472 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,0.8314696,0.5132798 }, 0.3125, { 0.18470335,0.771514,0.608811 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,0.8314696,0.5132798 }, 0.3125, { 0.22299676,0.88098717,0.4172939 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,0.8314696,0.5132798 }, 0.3125, { 0.29990217,0.7715056,0.56110406 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.270598,0.70710677,0.6532814 }, 0.3125, { 0.18470335,0.771514,0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.270598,0.70710677,0.6532814 }, 0.3125, { 0.2247893,0.6325699,0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.270598,0.70710677,0.6532814 }, 0.3125, { 0.29990217,0.7715056,0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.270598,0.70710677,0.6532814 }, 0.3125, { 0.3650806,0.6325664,0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,0.55557024,0.7681775 }, 0.3125, { 0.2247893,0.6325699,0.74116474 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,0.55557024,0.7681775 }, 0.3125, { 0.25631273,0.46962327,0.8448419 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,0.55557024,0.7681775 }, 0.3125, { 0.3650806,0.6325664,0.6830637 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,0.55557024,0.7681775 }, 0.3125, { 0.4162074,0.46960834,0.7786138 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,0.8535532 }, 0.3125, { 0.25631273,0.46962327,0.8448419 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,0.8535532 }, 0.3125, { 0.2779016,0.28900164,0.9161052 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,0.8535532 }, 0.3125, { 0.4162074,0.46960834,0.7786138 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,0.38268346,0.8535532 }, 0.3125, { 0.4512921,0.28899494,0.8442852 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,0.19509032,0.9061272 }, 0.3125, { 0.2779016,0.28900164,0.9161052 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,0.19509032,0.9061272 }, 0.3125, { 0.2888949,0.097498275,0.9523832 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,0.19509032,0.9061272 }, 0.3125, { 0.4512921,0.28899494,0.8442852 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,0.19509032,0.9061272 }, 0.3125, { 0.4691192,0.09750398,0.87773585 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.38268295,0,0.92387915 }, 0.31249997, { 0.2888949,-0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.38268295,0,0.92387915 }, 0.31249997, { 0.2888949,0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.38268295,0,0.92387915 }, 0.31249997, { 0.4691192,-0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.38268295,0,0.92387915 }, 0.31249997, { 0.4691192,0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,-0.19509032,0.9061272 }, 0.3125, { 0.2779016,-0.28900164,0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,-0.19509032,0.9061272 }, 0.3125, { 0.2888949,-0.097498275,0.9523832 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,-0.19509032,0.9061272 }, 0.3125, { 0.4512921,-0.28899494,0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.37533003,-0.19509032,0.9061272 }, 0.3125, { 0.4691192,-0.09750398,0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,0.8535532 }, 0.3125, { 0.25631273,-0.46962327,0.8448419 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,0.8535532 }, 0.3125, { 0.2779016,-0.28900164,0.9161052 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,0.8535532 }, 0.3125, { 0.4162074,-0.46960834,0.7786138 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.35355335,-0.38268346,0.8535532 }, 0.3125, { 0.4512921,-0.28899494,0.8442852 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,-0.55557024,0.7681775 }, 0.3125, { 0.2247893,-0.6325699,0.74116474 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,-0.55557024,0.7681775 }, 0.3125, { 0.25631273,-0.46962327,0.8448419 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,-0.55557024,0.7681775 }, 0.3125, { 0.3650806,-0.6325664,0.6830637 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.31818944,-0.55557024,0.7681775 }, 0.3125, { 0.4162074,-0.46960834,0.7786138 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.270598,-0.70710677,0.6532814 }, 0.3125, { 0.18470335,-0.771514,0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.270598,-0.70710677,0.6532814 }, 0.3125, { 0.2247893,-0.6325699,0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.270598,-0.70710677,0.6532814 }, 0.3125, { 0.29990217,-0.7715056,0.56110406 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.270598,-0.70710677,0.6532814 }, 0.3125, { 0.3650806,-0.6325664,0.6830637 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,-0.8314696,0.5132798 }, 0.3125, { 0.13739537,-0.88097024,0.45278472 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,-0.8314696,0.5132798 }, 0.3125, { 0.18470335,-0.771514,0.608811 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,-0.8314696,0.5132798 }, 0.3125, { 0.22299676,-0.88098717,0.4172939 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.21260735,-0.8314696,0.5132798 }, 0.3125, { 0.29990217,-0.7715056,0.56110406 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,-0.9238795,0.35355332 }, 0.3125, { 0.084604636,-0.9565524,0.2790153 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,-0.9238795,0.35355332 }, 0.3125, { 0.13739537,-0.88097024,0.45278472 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,-0.9238795,0.35355332 }, 0.3125, { 0.13740884,-0.9565615,0.25711653 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.14644653,-0.9238795,0.35355332 }, 0.3125, { 0.22299676,-0.88098717,0.4172939 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,-0.98078525,0.18023986 }, 0.3125, { 0.028601207,-0.99514204,0.09420398 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,-0.98078525,0.18023986 }, 0.3125, { 0.046401657,-0.99513555,0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,-0.98078525,0.18023986 }, 0.3125, { 0.084604636,-0.9565524,0.2790153 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.07465778,-0.98078525,0.18023986 }, 0.3125, { 0.13740884,-0.9565615,0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,0.98078525,0.1913416 }, 0.28125, { 0.0097003775,0.99513876,0.09800381 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,0.98078525,0.1913416 }, 0.28125, { 0.028601056,0.9565353,0.2902107 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,0.98078525,0.1913416 }, 0.28125, { 0.028601207,0.99514204,0.09420398 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,0.98078525,0.1913416 }, 0.28125, { 0.084604636,0.9565524,0.2790153 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,0.9238795,0.37533018 }, 0.28125, { 0.028601056,0.9565353,0.2902107 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,0.9238795,0.37533018 }, 0.28125, { 0.046398595,0.8809733,0.47088575 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,0.9238795,0.37533018 }, 0.28125, { 0.084604636,0.9565524,0.2790153 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,0.9238795,0.37533018 }, 0.28125, { 0.13739537,0.88097024,0.45278472 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,0.8314696,0.5448949 }, 0.28124997, { 0.046398595,0.8809733,0.47088575 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,0.8314696,0.5448949 }, 0.28124997, { 0.062398497,0.7714814,0.63318473 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,0.8314696,0.5448949 }, 0.28124997, { 0.13739537,0.88097024,0.45278472 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,0.8314696,0.5448949 }, 0.28124997, { 0.18470335,0.771514,0.608811 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,0.70710677,0.69351983 }, 0.28125, { 0.062398497,0.7714814,0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,0.70710677,0.69351983 }, 0.28125, { 0.07589712,0.6325759,0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,0.70710677,0.69351983 }, 0.28125, { 0.18470335,0.771514,0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,0.70710677,0.69351983 }, 0.28125, { 0.2247893,0.6325699,0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,0.55557024,0.81549287 }, 0.28125, { 0.07589712,0.6325759,0.77077067 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,0.55557024,0.81549287 }, 0.28125, { 0.0865024,0.46961308,0.87862444 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,0.55557024,0.81549287 }, 0.28125, { 0.2247893,0.6325699,0.74116474 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,0.55557024,0.81549287 }, 0.28125, { 0.25631273,0.46962327,0.8448419 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,0.9061272 }, 0.28125, { 0.0865024,0.46961308,0.87862444 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,0.9061272 }, 0.28125, { 0.09380203,0.28900626,0.95272064 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,0.9061272 }, 0.28125, { 0.25631273,0.46962327,0.8448419 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,0.38268346,0.9061272 }, 0.28125, { 0.2779016,0.28900164,0.9161052 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,0.19509032,0.96193945 }, 0.28125, { 0.09380203,0.28900626,0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,0.19509032,0.96193945 }, 0.28125, { 0.097504646,0.097504646,0.9904472 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,0.19509032,0.96193945 }, 0.28125, { 0.2779016,0.28900164,0.9161052 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,0.19509032,0.96193945 }, 0.28125, { 0.2888949,0.097498275,0.9523832 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { 0.1950899,0,0.9807848 }, 0.28124994, { 0.097504646,-0.097504646,0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.1950899,0,0.9807848 }, 0.28124994, { 0.097504646,0.097504646,0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.1950899,0,0.9807848 }, 0.28124994, { 0.2888949,-0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.1950899,0,0.9807848 }, 0.28124994, { 0.2888949,0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,-0.19509032,0.96193945 }, 0.28125, { 0.09380203,-0.28900626,0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,-0.19509032,0.96193945 }, 0.28125, { 0.097504646,-0.097504646,0.9904472 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,-0.19509032,0.96193945 }, 0.28125, { 0.2779016,-0.28900164,0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.19134152,-0.19509032,0.96193945 }, 0.28125, { 0.2888949,-0.097498275,0.9523832 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,0.9061272 }, 0.28125, { 0.0865024,-0.46961308,0.87862444 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,0.9061272 }, 0.28125, { 0.09380203,-0.28900626,0.95272064 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,0.9061272 }, 0.28125, { 0.25631273,-0.46962327,0.8448419 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.18023995,-0.38268346,0.9061272 }, 0.28125, { 0.2779016,-0.28900164,0.9161052 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,-0.55557024,0.81549287 }, 0.28125, { 0.07589712,-0.6325759,0.77077067 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,-0.55557024,0.81549287 }, 0.28125, { 0.0865024,-0.46961308,0.87862444 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,-0.55557024,0.81549287 }, 0.28125, { 0.2247893,-0.6325699,0.74116474 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.16221152,-0.55557024,0.81549287 }, 0.28125, { 0.25631273,-0.46962327,0.8448419 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,-0.70710677,0.69351983 }, 0.28125, { 0.062398497,-0.7714814,0.63318473 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,-0.70710677,0.69351983 }, 0.28125, { 0.07589712,-0.6325759,0.77077067 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,-0.70710677,0.69351983 }, 0.28125, { 0.18470335,-0.771514,0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.13794966,-0.70710677,0.69351983 }, 0.28125, { 0.2247893,-0.6325699,0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,-0.8314696,0.5448949 }, 0.28124997, { 0.046398595,-0.8809733,0.47088575 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,-0.8314696,0.5448949 }, 0.28124997, { 0.062398497,-0.7714814,0.63318473 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,-0.8314696,0.5448949 }, 0.28124997, { 0.13739537,-0.88097024,0.45278472 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.10838623,-0.8314696,0.5448949 }, 0.28124997, { 0.18470335,-0.771514,0.608811 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,-0.9238795,0.37533018 }, 0.28125, { 0.028601056,-0.9565353,0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,-0.9238795,0.37533018 }, 0.28125, { 0.046398595,-0.8809733,0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,-0.9238795,0.37533018 }, 0.28125, { 0.084604636,-0.9565524,0.2790153 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.07465776,-0.9238795,0.37533018 }, 0.28125, { 0.13739537,-0.88097024,0.45278472 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,-0.98078525,0.1913416 }, 0.28125, { 0.0097003775,-0.99513876,0.09800381 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,-0.98078525,0.1913416 }, 0.28125, { 0.028601056,-0.9565353,0.2902107 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,-0.98078525,0.1913416 }, 0.28125, { 0.028601207,-0.99514204,0.09420398 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0.038060203,-0.98078525,0.1913416 }, 0.28125, { 0.084604636,-0.9565524,0.2790153 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,0.98078525,0.19509019 }, 0.25, { -0.028601056,0.9565353,0.2902107 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,0.98078525,0.19509019 }, 0.25, { -0.0097003775,0.99513876,0.09800381 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,0.98078525,0.19509019 }, 0.25, { 0.0097003775,0.99513876,0.09800381 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,0.98078525,0.19509019 }, 0.25, { 0.028601056,0.9565353,0.2902107 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,0.9238795,0.38268334 }, 0.24999997, { -0.046398595,0.8809733,0.47088575 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,0.9238795,0.38268334 }, 0.24999997, { -0.028601056,0.9565353,0.2902107 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,0.9238795,0.38268334 }, 0.24999997, { 0.028601056,0.9565353,0.2902107 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,0.9238795,0.38268334 }, 0.24999997, { 0.046398595,0.8809733,0.47088575 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,0.8314696,0.55556995 }, 0.24999997, { -0.062398497,0.7714814,0.63318473 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,0.8314696,0.55556995 }, 0.24999997, { -0.046398595,0.8809733,0.47088575 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,0.8314696,0.55556995 }, 0.24999997, { 0.046398595,0.8809733,0.47088575 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,0.8314696,0.55556995 }, 0.24999997, { 0.062398497,0.7714814,0.63318473 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,0.70710677,0.70710665 }, 0.25, { -0.07589712,0.6325759,0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,0.70710677,0.70710665 }, 0.25, { -0.062398497,0.7714814,0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,0.70710677,0.70710665 }, 0.25, { 0.062398497,0.7714814,0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,0.70710677,0.70710665 }, 0.25, { 0.07589712,0.6325759,0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,0.55557024,0.8314693 }, 0.24999997, { -0.0865024,0.46961308,0.87862444 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,0.55557024,0.8314693 }, 0.24999997, { -0.07589712,0.6325759,0.77077067 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,0.55557024,0.8314693 }, 0.24999997, { 0.07589712,0.6325759,0.77077067 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,0.55557024,0.8314693 }, 0.24999997, { 0.0865024,0.46961308,0.87862444 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,0.38268346,0.92387927 }, 0.25, { -0.09380203,0.28900626,0.95272064 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,0.38268346,0.92387927 }, 0.25, { -0.0865024,0.46961308,0.87862444 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,0.38268346,0.92387927 }, 0.25, { 0.0865024,0.46961308,0.87862444 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,0.38268346,0.92387927 }, 0.25, { 0.09380203,0.28900626,0.95272064 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,0.19509032,0.98078495 }, 0.24999997, { -0.0976037,0.09750369,0.99043757 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,0.19509032,0.98078495 }, 0.24999997, { -0.09380203,0.28900626,0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,0.19509032,0.98078495 }, 0.24999997, { 0.09380203,0.28900626,0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,0.19509032,0.98078495 }, 0.24999997, { 0.097504646,0.097504646,0.9904472 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -3.2782555e-07,0,0.99999934 }, 0.24999997, { -0.0976037,-0.09750369,0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -3.2782555e-07,0,0.99999934 }, 0.24999997, { -0.0976037,0.09750369,0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -3.2782555e-07,0,0.99999934 }, 0.24999997, { 0.097504646,-0.097504646,0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -3.2782555e-07,0,0.99999934 }, 0.24999997, { 0.097504646,0.097504646,0.9904472 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,-0.19509032,0.98078495 }, 0.24999997, { -0.0976037,-0.09750369,0.99043757 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,-0.19509032,0.98078495 }, 0.24999997, { -0.09380203,-0.28900626,0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,-0.19509032,0.98078495 }, 0.24999997, { 0.09380203,-0.28900626,0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -1.3411045e-07,-0.19509032,0.98078495 }, 0.24999997, { 0.097504646,-0.097504646,0.9904472 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,-0.38268346,0.92387927 }, 0.25, { -0.09380203,-0.28900626,0.95272064 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,-0.38268346,0.92387927 }, 0.25, { -0.0865024,-0.46961308,0.87862444 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,-0.38268346,0.92387927 }, 0.25, { 0.0865024,-0.46961308,0.87862444 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { 2.9802322e-08,-0.38268346,0.92387927 }, 0.25, { 0.09380203,-0.28900626,0.95272064 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,-0.55557024,0.8314693 }, 0.24999997, { -0.0865024,-0.46961308,0.87862444 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,-0.55557024,0.8314693 }, 0.24999997, { -0.07589712,-0.6325759,0.77077067 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,-0.55557024,0.8314693 }, 0.24999997, { 0.07589712,-0.6325759,0.77077067 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -1.0430813e-07,-0.55557024,0.8314693 }, 0.24999997, { 0.0865024,-0.46961308,0.87862444 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,-0.70710677,0.70710665 }, 0.25, { -0.07589712,-0.6325759,0.77077067 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,-0.70710677,0.70710665 }, 0.25, { -0.062398497,-0.7714814,0.63318473 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,-0.70710677,0.70710665 }, 0.25, { 0.062398497,-0.7714814,0.63318473 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -1.4901161e-08,-0.70710677,0.70710665 }, 0.25, { 0.07589712,-0.6325759,0.77077067 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,-0.8314696,0.55556995 }, 0.24999997, { -0.062398497,-0.7714814,0.63318473 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,-0.8314696,0.55556995 }, 0.24999997, { -0.046398595,-0.8809733,0.47088575 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,-0.8314696,0.55556995 }, 0.24999997, { 0.046398595,-0.8809733,0.47088575 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -9.685755e-08,-0.8314696,0.55556995 }, 0.24999997, { 0.062398497,-0.7714814,0.63318473 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,-0.9238795,0.38268334 }, 0.24999997, { -0.046398595,-0.8809733,0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,-0.9238795,0.38268334 }, 0.24999997, { -0.028601056,-0.9565353,0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,-0.9238795,0.38268334 }, 0.24999997, { 0.028601056,-0.9565353,0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -5.2154064e-08,-0.9238795,0.38268334 }, 0.24999997, { 0.046398595,-0.8809733,0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,-0.98078525,0.19509019 }, 0.25, { -0.028601056,-0.9565353,0.2902107 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,-0.98078525,0.19509019 }, 0.25, { -0.0097003775,-0.99513876,0.09800381 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,-0.98078525,0.19509019 }, 0.25, { 0.0097003775,-0.99513876,0.09800381 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -7.450581e-09,-0.98078525,0.19509019 }, 0.25, { 0.028601056,-0.9565353,0.2902107 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,0.98078525,0.19134158 }, 0.21875, { -0.084604636,0.9565524,0.2790153 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,0.98078525,0.19134158 }, 0.21875, { -0.028601207,0.99514204,0.09420398 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,0.98078525,0.19134158 }, 0.21875, { -0.028601056,0.9565353,0.2902107 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,0.98078525,0.19134158 }, 0.21875, { -0.0097003775,0.99513876,0.09800381 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,0.9238795,0.37533018 }, 0.21875, { -0.13739537,0.88097024,0.45278472 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,0.9238795,0.37533018 }, 0.21875, { -0.084604636,0.9565524,0.2790153 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,0.9238795,0.37533018 }, 0.21875, { -0.046398595,0.8809733,0.47088575 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,0.9238795,0.37533018 }, 0.21875, { -0.028601056,0.9565353,0.2902107 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,0.8314696,0.5448948 }, 0.21875, { -0.18470335,0.771514,0.608811 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,0.8314696,0.5448948 }, 0.21875, { -0.13739537,0.88097024,0.45278472 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,0.8314696,0.5448948 }, 0.21875, { -0.062398497,0.7714814,0.63318473 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,0.8314696,0.5448948 }, 0.21875, { -0.046398595,0.8809733,0.47088575 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,0.70710677,0.6935198 }, 0.21875, { -0.2247893,0.6325699,0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,0.70710677,0.6935198 }, 0.21875, { -0.18470335,0.771514,0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,0.70710677,0.6935198 }, 0.21875, { -0.07589712,0.6325759,0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,0.70710677,0.6935198 }, 0.21875, { -0.062398497,0.7714814,0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,0.55557024,0.8154928 }, 0.21875, { -0.25631273,0.46962327,0.8448419 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,0.55557024,0.8154928 }, 0.21875, { -0.2247893,0.6325699,0.74116474 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,0.55557024,0.8154928 }, 0.21875, { -0.0865024,0.46961308,0.87862444 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,0.55557024,0.8154928 }, 0.21875, { -0.07589712,0.6325759,0.77077067 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,0.38268346,0.90612715 }, 0.21875, { -0.2779016,0.28900164,0.9161052 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,0.38268346,0.90612715 }, 0.21875, { -0.25631273,0.46962327,0.8448419 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,0.38268346,0.90612715 }, 0.21875, { -0.09380203,0.28900626,0.95272064 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,0.38268346,0.90612715 }, 0.21875, { -0.0865024,0.46961308,0.87862444 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,0.19509032,0.9619394 }, 0.21875, { -0.2888949,0.097498275,0.9523832 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,0.19509032,0.9619394 }, 0.21875, { -0.2779016,0.28900164,0.9161052 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,0.19509032,0.9619394 }, 0.21875, { -0.0976037,0.09750369,0.99043757 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,0.19509032,0.9619394 }, 0.21875, { -0.09380203,0.28900626,0.95272064 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.19509052,0,0.98078454 }, 0.21874994, { -0.2888949,-0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19509052,0,0.98078454 }, 0.21874994, { -0.2888949,0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19509052,0,0.98078454 }, 0.21874994, { -0.0976037,-0.09750369,0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19509052,0,0.98078454 }, 0.21874994, { -0.0976037,0.09750369,0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,-0.19509032,0.9619394 }, 0.21875, { -0.2888949,-0.097498275,0.9523832 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,-0.19509032,0.9619394 }, 0.21875, { -0.2779016,-0.28900164,0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,-0.19509032,0.9619394 }, 0.21875, { -0.0976037,-0.09750369,0.99043757 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.19134179,-0.19509032,0.9619394 }, 0.21875, { -0.09380203,-0.28900626,0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,-0.38268346,0.90612715 }, 0.21875, { -0.2779016,-0.28900164,0.9161052 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,-0.38268346,0.90612715 }, 0.21875, { -0.25631273,-0.46962327,0.8448419 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,-0.38268346,0.90612715 }, 0.21875, { -0.09380203,-0.28900626,0.95272064 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { -0.18023987,-0.38268346,0.90612715 }, 0.21875, { -0.0865024,-0.46961308,0.87862444 }, 0.625 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,-0.55557024,0.8154928 }, 0.21875, { -0.25631273,-0.46962327,0.8448419 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,-0.55557024,0.8154928 }, 0.21875, { -0.2247893,-0.6325699,0.74116474 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,-0.55557024,0.8154928 }, 0.21875, { -0.0865024,-0.46961308,0.87862444 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221172,-0.55557024,0.8154928 }, 0.21875, { -0.07589712,-0.6325759,0.77077067 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,-0.70710677,0.6935198 }, 0.21875, { -0.2247893,-0.6325699,0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,-0.70710677,0.6935198 }, 0.21875, { -0.18470335,-0.771514,0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,-0.70710677,0.6935198 }, 0.21875, { -0.07589712,-0.6325759,0.77077067 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.13794968,-0.70710677,0.6935198 }, 0.21875, { -0.062398497,-0.7714814,0.63318473 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,-0.8314696,0.5448948 }, 0.21875, { -0.18470335,-0.771514,0.608811 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,-0.8314696,0.5448948 }, 0.21875, { -0.13739537,-0.88097024,0.45278472 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,-0.8314696,0.5448948 }, 0.21875, { -0.062398497,-0.7714814,0.63318473 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.10838642,-0.8314696,0.5448948 }, 0.21875, { -0.046398595,-0.8809733,0.47088575 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,-0.9238795,0.37533018 }, 0.21875, { -0.13739537,-0.88097024,0.45278472 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,-0.9238795,0.37533018 }, 0.21875, { -0.084604636,-0.9565524,0.2790153 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,-0.9238795,0.37533018 }, 0.21875, { -0.046398595,-0.8809733,0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.074657865,-0.9238795,0.37533018 }, 0.21875, { -0.028601056,-0.9565353,0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,-0.98078525,0.19134158 }, 0.21875, { -0.084604636,-0.9565524,0.2790153 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,-0.98078525,0.19134158 }, 0.21875, { -0.028601207,-0.99514204,0.09420398 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,-0.98078525,0.19134158 }, 0.21875, { -0.028601056,-0.9565353,0.2902107 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.038060214,-0.98078525,0.19134158 }, 0.21875, { -0.0097003775,-0.99513876,0.09800381 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,0.98078525,0.18023983 }, 0.1875, { -0.13740884,0.9565615,0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,0.98078525,0.18023983 }, 0.1875, { -0.084604636,0.9565524,0.2790153 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,0.98078525,0.18023983 }, 0.1875, { -0.046401657,0.99513555,0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,0.98078525,0.18023983 }, 0.1875, { -0.028601207,0.99514204,0.09420398 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,0.9238795,0.3535533 }, 0.1875, { -0.22299676,0.88098717,0.4172939 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,0.9238795,0.3535533 }, 0.1875, { -0.13740884,0.9565615,0.25711653 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,0.9238795,0.3535533 }, 0.1875, { -0.13739537,0.88097024,0.45278472 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,0.9238795,0.3535533 }, 0.1875, { -0.084604636,0.9565524,0.2790153 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.8314696,0.5132796 }, 0.18749997, { -0.29990217,0.7715056,0.56110406 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.8314696,0.5132796 }, 0.18749997, { -0.22299676,0.88098717,0.4172939 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.8314696,0.5132796 }, 0.18749997, { -0.18470335,0.771514,0.608811 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.8314696,0.5132796 }, 0.18749997, { -0.13739537,0.88097024,0.45278472 }, 0.18749994 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.70710677,0.65328133 }, 0.1875, { -0.3650806,0.6325664,0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.70710677,0.65328133 }, 0.1875, { -0.29990217,0.7715056,0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.70710677,0.65328133 }, 0.1875, { -0.2247893,0.6325699,0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.70710677,0.65328133 }, 0.1875, { -0.18470335,0.771514,0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,0.55557024,0.7681774 }, 0.1875, { -0.4162074,0.46960834,0.7786138 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,0.55557024,0.7681774 }, 0.1875, { -0.3650806,0.6325664,0.6830637 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,0.55557024,0.7681774 }, 0.1875, { -0.25631273,0.46962327,0.8448419 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,0.55557024,0.7681774 }, 0.1875, { -0.2247893,0.6325699,0.74116474 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,0.38268346,0.8535531 }, 0.1875, { -0.4512921,0.28899494,0.8442852 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,0.38268346,0.8535531 }, 0.1875, { -0.4162074,0.46960834,0.7786138 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,0.38268346,0.8535531 }, 0.1875, { -0.2779016,0.28900164,0.9161052 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,0.38268346,0.8535531 }, 0.1875, { -0.25631273,0.46962327,0.8448419 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,0.19509032,0.90612704 }, 0.18749997, { -0.4691192,0.09750398,0.87773585 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,0.19509032,0.90612704 }, 0.18749997, { -0.4512921,0.28899494,0.8442852 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,0.19509032,0.90612704 }, 0.18749997, { -0.2888949,0.097498275,0.9523832 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,0.19509032,0.90612704 }, 0.18749997, { -0.2779016,0.28900164,0.9161052 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.3826835,0,0.9238787 }, 0.18749997, { -0.4691192,-0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.3826835,0,0.9238787 }, 0.18749997, { -0.4691192,0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.3826835,0,0.9238787 }, 0.18749997, { -0.2888949,-0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.3826835,0,0.9238787 }, 0.18749997, { -0.2888949,0.097498275,0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,-0.19509032,0.90612704 }, 0.18749997, { -0.4691192,-0.09750398,0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,-0.19509032,0.90612704 }, 0.18749997, { -0.4512921,-0.28899494,0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,-0.19509032,0.90612704 }, 0.18749997, { -0.2888949,-0.097498275,0.9523832 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.37533027,-0.19509032,0.90612704 }, 0.18749997, { -0.2779016,-0.28900164,0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,-0.38268346,0.8535531 }, 0.1875, { -0.4512921,-0.28899494,0.8442852 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,-0.38268346,0.8535531 }, 0.1875, { -0.4162074,-0.46960834,0.7786138 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,-0.38268346,0.8535531 }, 0.1875, { -0.2779016,-0.28900164,0.9161052 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.35355324,-0.38268346,0.8535531 }, 0.1875, { -0.25631273,-0.46962327,0.8448419 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,-0.55557024,0.7681774 }, 0.1875, { -0.4162074,-0.46960834,0.7786138 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,-0.55557024,0.7681774 }, 0.1875, { -0.3650806,-0.6325664,0.6830637 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,-0.55557024,0.7681774 }, 0.1875, { -0.25631273,-0.46962327,0.8448419 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.31818962,-0.55557024,0.7681774 }, 0.1875, { -0.2247893,-0.6325699,0.74116474 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.70710677,0.65328133 }, 0.1875, { -0.3650806,-0.6325664,0.6830637 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.70710677,0.65328133 }, 0.1875, { -0.29990217,-0.7715056,0.56110406 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.70710677,0.65328133 }, 0.1875, { -0.2247893,-0.6325699,0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.70710677,0.65328133 }, 0.1875, { -0.18470335,-0.771514,0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.8314696,0.5132796 }, 0.18749997, { -0.29990217,-0.7715056,0.56110406 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.8314696,0.5132796 }, 0.18749997, { -0.22299676,-0.88098717,0.4172939 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.8314696,0.5132796 }, 0.18749997, { -0.18470335,-0.771514,0.608811 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.8314696,0.5132796 }, 0.18749997, { -0.13739537,-0.88097024,0.45278472 }, 0.8125 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,-0.9238795,0.3535533 }, 0.1875, { -0.22299676,-0.88098717,0.4172939 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,-0.9238795,0.3535533 }, 0.1875, { -0.13740884,-0.9565615,0.25711653 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,-0.9238795,0.3535533 }, 0.1875, { -0.13739537,-0.88097024,0.45278472 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.14644662,-0.9238795,0.3535533 }, 0.1875, { -0.084604636,-0.9565524,0.2790153 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,-0.98078525,0.18023983 }, 0.1875, { -0.13740884,-0.9565615,0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,-0.98078525,0.18023983 }, 0.1875, { -0.084604636,-0.9565524,0.2790153 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,-0.98078525,0.18023983 }, 0.1875, { -0.046401657,-0.99513555,0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.07465778,-0.98078525,0.18023983 }, 0.1875, { -0.028601207,-0.99514204,0.09420398 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,0.98078525,0.16221155 }, 0.15625003, { -0.18500718,0.9565371,0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,0.98078525,0.16221155 }, 0.15625003, { -0.13740884,0.9565615,0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,0.98078525,0.16221155 }, 0.15625003, { -0.06250246,0.9951391,0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,0.98078525,0.16221155 }, 0.15625003, { -0.046401657,0.99513555,0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.9238795,0.31818953 }, 0.15624997, { -0.3001864,0.88096005,0.36578342 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.9238795,0.31818953 }, 0.15624997, { -0.22299676,0.88098717,0.4172939 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.9238795,0.31818953 }, 0.15624997, { -0.18500718,0.9565371,0.22540875 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,0.9238795,0.31818953 }, 0.15624997, { -0.13740884,0.9565615,0.25711653 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,0.8314696,0.4619394 }, 0.15624997, { -0.40360555,0.7715106,0.49180678 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,0.8314696,0.4619394 }, 0.15624997, { -0.3001864,0.88096005,0.36578342 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,0.8314696,0.4619394 }, 0.15624997, { -0.29990217,0.7715056,0.56110406 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,0.8314696,0.4619394 }, 0.15624997, { -0.22299676,0.88098717,0.4172939 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,0.70710677,0.58793765 }, 0.15624997, { -0.4913,0.6326,0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,0.70710677,0.58793765 }, 0.15624997, { -0.40360555,0.7715106,0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,0.70710677,0.58793765 }, 0.15624997, { -0.3650806,0.6325664,0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,0.70710677,0.58793765 }, 0.15624997, { -0.29990217,0.7715056,0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,0.55557024,0.69134134 }, 0.15624997, { -0.56008816,0.46959004,0.6824855 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,0.55557024,0.69134134 }, 0.15624997, { -0.4913,0.6326,0.5987 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,0.55557024,0.69134134 }, 0.15624997, { -0.4162074,0.46960834,0.7786138 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,0.55557024,0.69134134 }, 0.15624997, { -0.3650806,0.6325664,0.6830637 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,0.38268346,0.7681775 }, 0.15625003, { -0.60731995,0.28900948,0.7400243 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,0.38268346,0.7681775 }, 0.15625003, { -0.56008816,0.46959004,0.6824855 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,0.38268346,0.7681775 }, 0.15625003, { -0.4512921,0.28899494,0.8442852 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,0.38268346,0.7681775 }, 0.15625003, { -0.4162074,0.46960834,0.7786138 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,0.19509032,0.81549275 }, 0.15624997, { -0.63140166,0.09750026,0.76930207 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,0.19509032,0.81549275 }, 0.15624997, { -0.60731995,0.28900948,0.7400243 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,0.19509032,0.81549275 }, 0.15624997, { -0.4691192,0.09750398,0.87773585 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,0.19509032,0.81549275 }, 0.15624997, { -0.4512921,0.28899494,0.8442852 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.5555701,0,0.83146876 }, 0.15624994, { -0.63140166,-0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.5555701,0,0.83146876 }, 0.15624994, { -0.63140166,0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.5555701,0,0.83146876 }, 0.15624994, { -0.4691192,-0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.5555701,0,0.83146876 }, 0.15624994, { -0.4691192,0.09750398,0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,-0.19509032,0.81549275 }, 0.15624997, { -0.63140166,-0.09750026,0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,-0.19509032,0.81549275 }, 0.15624997, { -0.60731995,-0.28900948,0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,-0.19509032,0.81549275 }, 0.15624997, { -0.4691192,-0.09750398,0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.54489505,-0.19509032,0.81549275 }, 0.15624997, { -0.4512921,-0.28899494,0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,-0.38268346,0.7681775 }, 0.15625003, { -0.60731995,-0.28900948,0.7400243 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,-0.38268346,0.7681775 }, 0.15625003, { -0.56008816,-0.46959004,0.6824855 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,-0.38268346,0.7681775 }, 0.15625003, { -0.4512921,-0.28899494,0.8442852 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.51327974,-0.38268346,0.7681775 }, 0.15625003, { -0.4162074,-0.46960834,0.7786138 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,-0.55557024,0.69134134 }, 0.15624997, { -0.56008816,-0.46959004,0.6824855 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,-0.55557024,0.69134134 }, 0.15624997, { -0.4913,-0.6326,0.5987 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,-0.55557024,0.69134134 }, 0.15624997, { -0.4162074,-0.46960834,0.7786138 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.46193963,-0.55557024,0.69134134 }, 0.15624997, { -0.3650806,-0.6325664,0.6830637 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,-0.70710677,0.58793765 }, 0.15624997, { -0.4913,-0.6326,0.5987 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,-0.70710677,0.58793765 }, 0.15624997, { -0.40360555,-0.7715106,0.49180678 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,-0.70710677,0.58793765 }, 0.15624997, { -0.3650806,-0.6325664,0.6830637 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.39284742,-0.70710677,0.58793765 }, 0.15624997, { -0.29990217,-0.7715056,0.56110406 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,-0.8314696,0.4619394 }, 0.15624997, { -0.40360555,-0.7715106,0.49180678 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,-0.8314696,0.4619394 }, 0.15624997, { -0.3001864,-0.88096005,0.36578342 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,-0.8314696,0.4619394 }, 0.15624997, { -0.29990217,-0.7715056,0.56110406 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.30865818,-0.8314696,0.4619394 }, 0.15624997, { -0.22299676,-0.88098717,0.4172939 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.9238795,0.31818953 }, 0.15624997, { -0.3001864,-0.88096005,0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.9238795,0.31818953 }, 0.15624997, { -0.22299676,-0.88098717,0.4172939 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.9238795,0.31818953 }, 0.15624997, { -0.18500718,-0.9565371,0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.2126075,-0.9238795,0.31818953 }, 0.15624997, { -0.13740884,-0.9565615,0.25711653 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,-0.98078525,0.16221155 }, 0.15625003, { -0.18500718,-0.9565371,0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,-0.98078525,0.16221155 }, 0.15625003, { -0.13740884,-0.9565615,0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,-0.98078525,0.16221155 }, 0.15625003, { -0.06250246,-0.9951391,0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.1083863,-0.98078525,0.16221155 }, 0.15625003, { -0.046401657,-0.99513555,0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,0.98078525,0.13794957 }, 0.125, { -0.22540875,0.9565371,0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,0.98078525,0.13794957 }, 0.125, { -0.18500718,0.9565371,0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,0.98078525,0.13794957 }, 0.125, { -0.07610299,0.9951391,0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,0.98078525,0.13794957 }, 0.125, { -0.06250246,0.9951391,0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.9238795,0.27059793 }, 0.125, { -0.36578342,0.88096005,0.3001864 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.9238795,0.27059793 }, 0.125, { -0.3001864,0.88096005,0.36578342 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.9238795,0.27059793 }, 0.125, { -0.22540875,0.9565371,0.18500718 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.270598,0.9238795,0.27059793 }, 0.125, { -0.18500718,0.9565371,0.22540875 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.8314696,0.39284712 }, 0.12499997, { -0.49180678,0.7715106,0.40360555 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.8314696,0.39284712 }, 0.12499997, { -0.40360555,0.7715106,0.49180678 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.8314696,0.39284712 }, 0.12499997, { -0.36578342,0.88096005,0.3001864 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.8314696,0.39284712 }, 0.12499997, { -0.3001864,0.88096005,0.36578342 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,0.70710677,0.49999988 }, 0.125, { -0.5987,0.6326,0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,0.70710677,0.49999988 }, 0.125, { -0.49180678,0.7715106,0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,0.70710677,0.49999988 }, 0.125, { -0.4913,0.6326,0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,0.70710677,0.49999988 }, 0.125, { -0.40360555,0.7715106,0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.55557024,0.5879374 }, 0.12499997, { -0.6824855,0.46959004,0.56008816 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.55557024,0.5879374 }, 0.12499997, { -0.5987,0.6326,0.4913 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.55557024,0.5879374 }, 0.12499997, { -0.56008816,0.46959004,0.6824855 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.55557024,0.5879374 }, 0.12499997, { -0.4913,0.6326,0.5987 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,0.38268346,0.6532813 }, 0.125, { -0.7400243,0.28900948,0.60731995 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,0.38268346,0.6532813 }, 0.125, { -0.6824855,0.46959004,0.56008816 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,0.38268346,0.6532813 }, 0.125, { -0.60731995,0.28900948,0.7400243 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,0.38268346,0.6532813 }, 0.125, { -0.56008816,0.46959004,0.6824855 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.19509032,0.69351953 }, 0.12499997, { -0.76930207,0.09750026,0.63140166 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.19509032,0.69351953 }, 0.12499997, { -0.7400243,0.28900948,0.60731995 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.19509032,0.69351953 }, 0.12499997, { -0.63140166,0.09750026,0.76930207 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.19509032,0.69351953 }, 0.12499997, { -0.60731995,0.28900948,0.7400243 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.7071065,0,0.70710593 }, 0.12499994, { -0.76930207,-0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.7071065,0,0.70710593 }, 0.12499994, { -0.76930207,0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.7071065,0,0.70710593 }, 0.12499994, { -0.63140166,-0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.7071065,0,0.70710593 }, 0.12499994, { -0.63140166,0.09750026,0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.19509032,0.69351953 }, 0.12499997, { -0.76930207,-0.09750026,0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.19509032,0.69351953 }, 0.12499997, { -0.7400243,-0.28900948,0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.19509032,0.69351953 }, 0.12499997, { -0.63140166,-0.09750026,0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.19509032,0.69351953 }, 0.12499997, { -0.60731995,-0.28900948,0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,-0.38268346,0.6532813 }, 0.125, { -0.7400243,-0.28900948,0.60731995 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,-0.38268346,0.6532813 }, 0.125, { -0.6824855,-0.46959004,0.56008816 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,-0.38268346,0.6532813 }, 0.125, { -0.60731995,-0.28900948,0.7400243 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.6532812,-0.38268346,0.6532813 }, 0.125, { -0.56008816,-0.46959004,0.6824855 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.55557024,0.5879374 }, 0.12499997, { -0.6824855,-0.46959004,0.56008816 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.55557024,0.5879374 }, 0.12499997, { -0.5987,-0.6326,0.4913 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.55557024,0.5879374 }, 0.12499997, { -0.56008816,-0.46959004,0.6824855 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.55557024,0.5879374 }, 0.12499997, { -0.4913,-0.6326,0.5987 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,-0.70710677,0.49999988 }, 0.125, { -0.5987,-0.6326,0.4913 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,-0.70710677,0.49999988 }, 0.125, { -0.49180678,-0.7715106,0.40360555 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,-0.70710677,0.49999988 }, 0.125, { -0.4913,-0.6326,0.5987 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.4999999,-0.70710677,0.49999988 }, 0.125, { -0.40360555,-0.7715106,0.49180678 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.8314696,0.39284712 }, 0.12499997, { -0.49180678,-0.7715106,0.40360555 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.8314696,0.39284712 }, 0.12499997, { -0.40360555,-0.7715106,0.49180678 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.8314696,0.39284712 }, 0.12499997, { -0.36578342,-0.88096005,0.3001864 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.8314696,0.39284712 }, 0.12499997, { -0.3001864,-0.88096005,0.36578342 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.9238795,0.27059793 }, 0.125, { -0.36578342,-0.88096005,0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.9238795,0.27059793 }, 0.125, { -0.3001864,-0.88096005,0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.9238795,0.27059793 }, 0.125, { -0.22540875,-0.9565371,0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.270598,-0.9238795,0.27059793 }, 0.125, { -0.18500718,-0.9565371,0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,-0.98078525,0.13794957 }, 0.125, { -0.22540875,-0.9565371,0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,-0.98078525,0.13794957 }, 0.125, { -0.18500718,-0.9565371,0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,-0.98078525,0.13794957 }, 0.125, { -0.07610299,-0.9951391,0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794959,-0.98078525,0.13794957 }, 0.125, { -0.06250246,-0.9951391,0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.984375, { -0.09800381,-0.99513876,-0.0097003775 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.015625, { -0.09800381,-0.99513876,0.0097003775 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.953125, { -0.09420398,-0.99514204,-0.028601207 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.04687497, { -0.09420398,-0.99514204,0.028601207 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.921875, { -0.0869031,-0.99513555,-0.046401657 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.078125, { -0.0869031,-0.99513555,0.046401657 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.890625, { -0.07610299,-0.9951391,-0.06250246 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.109375, { -0.07610299,-0.9951391,0.06250246 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.859375, { -0.06250246,-0.9951391,-0.07610299 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.14062503, { -0.06250246,-0.9951391,0.07610299 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.828125, { -0.046401657,-0.99513555,-0.0869031 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.17187503, { -0.046401657,-0.99513555,0.0869031 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.796875, { -0.028601207,-0.99514204,-0.09420398 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.203125, { -0.028601207,-0.99514204,0.09420398 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.765625, { -0.0097003775,-0.99513876,-0.09800381 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.234375, { -0.0097003775,-0.99513876,0.09800381 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.734375, { 0.0097003775,-0.99513876,-0.09800381 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.265625, { 0.0097003775,-0.99513876,0.09800381 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.703125, { 0.028601207,-0.99514204,-0.09420398 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.296875, { 0.028601207,-0.99514204,0.09420398 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.671875, { 0.046401657,-0.99513555,-0.0869031 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.328125, { 0.046401657,-0.99513555,0.0869031 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.640625, { 0.06250246,-0.9951391,-0.07610299 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.359375, { 0.06250246,-0.9951391,0.07610299 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.609375, { 0.07610299,-0.9951391,-0.06250246 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.390625, { 0.07610299,-0.9951391,0.06250246 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.578125, { 0.0869031,-0.99513555,-0.046401657 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.421875, { 0.0869031,-0.99513555,0.046401657 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.546875, { 0.09420398,-0.99514204,-0.028601207 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.453125, { 0.09420398,-0.99514204,0.028601207 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.515625, { 0.09800381,-0.99513876,-0.0097003775 }, 1 ,{ 1,1,1,1 } },Vertex{ { 0,-1,-0 }, 0.484375, { 0.09800381,-0.99513876,0.0097003775 }, 1 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,0.98078525,0.10838628 }, 0.09375, { -0.25711653,0.9565615,0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,0.98078525,0.10838628 }, 0.09375, { -0.22540875,0.9565371,0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,0.98078525,0.10838628 }, 0.09375, { -0.0869031,0.99513555,0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,0.98078525,0.10838628 }, 0.09375, { -0.07610299,0.9951391,0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,0.9238795,0.21260741 }, 0.09375, { -0.4172939,0.88098717,0.22299676 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,0.9238795,0.21260741 }, 0.09375, { -0.36578342,0.88096005,0.3001864 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,0.9238795,0.21260741 }, 0.09375, { -0.25711653,0.9565615,0.13740884 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,0.9238795,0.21260741 }, 0.09375, { -0.22540875,0.9565371,0.18500718 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,0.8314696,0.30865794 }, 0.09374997, { -0.56110406,0.7715056,0.29990217 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,0.8314696,0.30865794 }, 0.09374997, { -0.49180678,0.7715106,0.40360555 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,0.8314696,0.30865794 }, 0.09374997, { -0.4172939,0.88098717,0.22299676 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,0.8314696,0.30865794 }, 0.09374997, { -0.36578342,0.88096005,0.3001864 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,0.70710677,0.39284736 }, 0.09375, { -0.6830637,0.6325664,0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,0.70710677,0.39284736 }, 0.09375, { -0.5987,0.6326,0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,0.70710677,0.39284736 }, 0.09375, { -0.56110406,0.7715056,0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,0.70710677,0.39284736 }, 0.09375, { -0.49180678,0.7715106,0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,0.55557024,0.46193942 }, 0.09375, { -0.7786138,0.46960834,0.4162074 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,0.55557024,0.46193942 }, 0.09375, { -0.6830637,0.6325664,0.3650806 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,0.55557024,0.46193942 }, 0.09375, { -0.6824855,0.46959004,0.56008816 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,0.55557024,0.46193942 }, 0.09375, { -0.5987,0.6326,0.4913 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,0.38268346,0.5132798 }, 0.09375, { -0.8442852,0.28899494,0.4512921 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,0.38268346,0.5132798 }, 0.09375, { -0.7786138,0.46960834,0.4162074 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,0.38268346,0.5132798 }, 0.09375, { -0.7400243,0.28900948,0.60731995 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,0.38268346,0.5132798 }, 0.09375, { -0.6824855,0.46959004,0.56008816 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,0.19509032,0.5448947 }, 0.09374997, { -0.87773585,0.09750398,0.4691192 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,0.19509032,0.5448947 }, 0.09374997, { -0.8442852,0.28899494,0.4512921 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,0.19509032,0.5448947 }, 0.09374997, { -0.76930207,0.09750026,0.63140166 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,0.19509032,0.5448947 }, 0.09374997, { -0.7400243,0.28900948,0.60731995 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.8314691,0,0.5555694 }, 0.09374997, { -0.87773585,-0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.8314691,0,0.5555694 }, 0.09374997, { -0.87773585,0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.8314691,0,0.5555694 }, 0.09374997, { -0.76930207,-0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.8314691,0,0.5555694 }, 0.09374997, { -0.76930207,0.09750026,0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,-0.19509032,0.5448947 }, 0.09374997, { -0.87773585,-0.09750398,0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,-0.19509032,0.5448947 }, 0.09374997, { -0.8442852,-0.28899494,0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,-0.19509032,0.5448947 }, 0.09374997, { -0.76930207,-0.09750026,0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.8154929,-0.19509032,0.5448947 }, 0.09374997, { -0.7400243,-0.28900948,0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,-0.38268346,0.5132798 }, 0.09375, { -0.8442852,-0.28899494,0.4512921 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,-0.38268346,0.5132798 }, 0.09375, { -0.7786138,-0.46960834,0.4162074 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,-0.38268346,0.5132798 }, 0.09375, { -0.7400243,-0.28900948,0.60731995 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.76817745,-0.38268346,0.5132798 }, 0.09375, { -0.6824855,-0.46959004,0.56008816 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,-0.55557024,0.46193942 }, 0.09375, { -0.7786138,-0.46960834,0.4162074 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,-0.55557024,0.46193942 }, 0.09375, { -0.6830637,-0.6325664,0.3650806 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,-0.55557024,0.46193942 }, 0.09375, { -0.6824855,-0.46959004,0.56008816 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.69134146,-0.55557024,0.46193942 }, 0.09375, { -0.5987,-0.6326,0.4913 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,-0.70710677,0.39284736 }, 0.09375, { -0.6830637,-0.6325664,0.3650806 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,-0.70710677,0.39284736 }, 0.09375, { -0.5987,-0.6326,0.4913 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,-0.70710677,0.39284736 }, 0.09375, { -0.56110406,-0.7715056,0.29990217 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.58793765,-0.70710677,0.39284736 }, 0.09375, { -0.49180678,-0.7715106,0.40360555 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,-0.8314696,0.30865794 }, 0.09374997, { -0.56110406,-0.7715056,0.29990217 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,-0.8314696,0.30865794 }, 0.09374997, { -0.49180678,-0.7715106,0.40360555 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,-0.8314696,0.30865794 }, 0.09374997, { -0.4172939,-0.88098717,0.22299676 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.4619395,-0.8314696,0.30865794 }, 0.09374997, { -0.36578342,-0.88096005,0.3001864 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,-0.9238795,0.21260741 }, 0.09375, { -0.4172939,-0.88098717,0.22299676 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,-0.9238795,0.21260741 }, 0.09375, { -0.36578342,-0.88096005,0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,-0.9238795,0.21260741 }, 0.09375, { -0.25711653,-0.9565615,0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.31818956,-0.9238795,0.21260741 }, 0.09375, { -0.22540875,-0.9565371,0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,-0.98078525,0.10838628 }, 0.09375, { -0.25711653,-0.9565615,0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,-0.98078525,0.10838628 }, 0.09375, { -0.22540875,-0.9565371,0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,-0.98078525,0.10838628 }, 0.09375, { -0.0869031,-0.99513555,0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221155,-0.98078525,0.10838628 }, 0.09375, { -0.07610299,-0.9951391,0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.98078525,0.07465775 }, 0.0625, { -0.2790153,0.9565524,0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.98078525,0.07465775 }, 0.0625, { -0.25711653,0.9565615,0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.98078525,0.07465775 }, 0.0625, { -0.09420398,0.99514204,0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.98078525,0.07465775 }, 0.0625, { -0.0869031,0.99513555,0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,0.9238795,0.14644651 }, 0.0625, { -0.45278472,0.88097024,0.13739537 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,0.9238795,0.14644651 }, 0.0625, { -0.4172939,0.88098717,0.22299676 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,0.9238795,0.14644651 }, 0.0625, { -0.2790153,0.9565524,0.084604636 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,0.9238795,0.14644651 }, 0.0625, { -0.25711653,0.9565615,0.13740884 }, 0.125 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,0.8314696,0.21260723 }, 0.0625, { -0.608811,0.771514,0.18470335 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,0.8314696,0.21260723 }, 0.0625, { -0.56110406,0.7715056,0.29990217 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,0.8314696,0.21260723 }, 0.0625, { -0.45278472,0.88097024,0.13739537 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,0.8314696,0.21260723 }, 0.0625, { -0.4172939,0.88098717,0.22299676 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,0.70710677,0.27059796 }, 0.06250003, { -0.74116474,0.6325699,0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,0.70710677,0.27059796 }, 0.06250003, { -0.6830637,0.6325664,0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,0.70710677,0.27059796 }, 0.06250003, { -0.608811,0.771514,0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,0.70710677,0.27059796 }, 0.06250003, { -0.56110406,0.7715056,0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.55557024,0.31818932 }, 0.0625, { -0.8448419,0.46962327,0.25631273 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.55557024,0.31818932 }, 0.0625, { -0.7786138,0.46960834,0.4162074 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.55557024,0.31818932 }, 0.0625, { -0.74116474,0.6325699,0.2247893 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.55557024,0.31818932 }, 0.0625, { -0.6830637,0.6325664,0.3650806 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,0.38268346,0.35355327 }, 0.06250003, { -0.9161052,0.28900164,0.2779016 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,0.38268346,0.35355327 }, 0.06250003, { -0.8448419,0.46962327,0.25631273 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,0.38268346,0.35355327 }, 0.06250003, { -0.8442852,0.28899494,0.4512921 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,0.38268346,0.35355327 }, 0.06250003, { -0.7786138,0.46960834,0.4162074 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,0.19509032,0.37532988 }, 0.0625, { -0.9523832,0.097498275,0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,0.19509032,0.37532988 }, 0.0625, { -0.9161052,0.28900164,0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,0.19509032,0.37532988 }, 0.0625, { -0.87773585,0.09750398,0.4691192 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,0.19509032,0.37532988 }, 0.0625, { -0.8442852,0.28899494,0.4512921 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.92387885,0,0.38268268 }, 0.06249994, { -0.9523832,-0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.92387885,0,0.38268268 }, 0.06249994, { -0.9523832,0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.92387885,0,0.38268268 }, 0.06249994, { -0.87773585,-0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.92387885,0,0.38268268 }, 0.06249994, { -0.87773585,0.09750398,0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,-0.19509032,0.37532988 }, 0.0625, { -0.9523832,-0.097498275,0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,-0.19509032,0.37532988 }, 0.0625, { -0.9161052,-0.28900164,0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,-0.19509032,0.37532988 }, 0.0625, { -0.87773585,-0.09750398,0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612715,-0.19509032,0.37532988 }, 0.0625, { -0.8442852,-0.28899494,0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,-0.38268346,0.35355327 }, 0.06250003, { -0.9161052,-0.28900164,0.2779016 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,-0.38268346,0.35355327 }, 0.06250003, { -0.8448419,-0.46962327,0.25631273 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,-0.38268346,0.35355327 }, 0.06250003, { -0.8442852,-0.28899494,0.4512921 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.85355306,-0.38268346,0.35355327 }, 0.06250003, { -0.7786138,-0.46960834,0.4162074 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.55557024,0.31818932 }, 0.0625, { -0.8448419,-0.46962327,0.25631273 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.55557024,0.31818932 }, 0.0625, { -0.7786138,-0.46960834,0.4162074 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.55557024,0.31818932 }, 0.0625, { -0.74116474,-0.6325699,0.2247893 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.55557024,0.31818932 }, 0.0625, { -0.6830637,-0.6325664,0.3650806 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,-0.70710677,0.27059796 }, 0.06250003, { -0.74116474,-0.6325699,0.2247893 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,-0.70710677,0.27059796 }, 0.06250003, { -0.6830637,-0.6325664,0.3650806 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,-0.70710677,0.27059796 }, 0.06250003, { -0.608811,-0.771514,0.18470335 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.65328133,-0.70710677,0.27059796 }, 0.06250003, { -0.56110406,-0.7715056,0.29990217 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,-0.8314696,0.21260723 }, 0.0625, { -0.608811,-0.771514,0.18470335 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,-0.8314696,0.21260723 }, 0.0625, { -0.56110406,-0.7715056,0.29990217 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,-0.8314696,0.21260723 }, 0.0625, { -0.45278472,-0.88097024,0.13739537 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.5132796,-0.8314696,0.21260723 }, 0.0625, { -0.4172939,-0.88098717,0.22299676 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,-0.9238795,0.14644651 }, 0.0625, { -0.45278472,-0.88097024,0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,-0.9238795,0.14644651 }, 0.0625, { -0.4172939,-0.88098717,0.22299676 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,-0.9238795,0.14644651 }, 0.0625, { -0.2790153,-0.9565524,0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.35355327,-0.9238795,0.14644651 }, 0.0625, { -0.25711653,-0.9565615,0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.98078525,0.07465775 }, 0.0625, { -0.2790153,-0.9565524,0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.98078525,0.07465775 }, 0.0625, { -0.25711653,-0.9565615,0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.98078525,0.07465775 }, 0.0625, { -0.09420398,-0.99514204,0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.98078525,0.07465775 }, 0.0625, { -0.0869031,-0.99513555,0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,0.98078525,0.03806018 }, 0.03125, { -0.2902107,0.9565353,0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,0.98078525,0.03806018 }, 0.03125, { -0.2790153,0.9565524,0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,0.98078525,0.03806018 }, 0.03125, { -0.09800381,0.99513876,0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,0.98078525,0.03806018 }, 0.03125, { -0.09420398,0.99514204,0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,0.9238795,0.07465775 }, 0.03124997, { -0.47088575,0.8809733,0.046398595 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,0.9238795,0.07465775 }, 0.03124997, { -0.45278472,0.88097024,0.13739537 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,0.9238795,0.07465775 }, 0.03124997, { -0.2902107,0.9565353,0.028601056 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,0.9238795,0.07465775 }, 0.03124997, { -0.2790153,0.9565524,0.084604636 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,0.8314696,0.10838615 }, 0.03124997, { -0.63318473,0.7714814,0.062398497 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,0.8314696,0.10838615 }, 0.03124997, { -0.608811,0.771514,0.18470335 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,0.8314696,0.10838615 }, 0.03124997, { -0.47088575,0.8809733,0.046398595 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,0.8314696,0.10838615 }, 0.03124997, { -0.45278472,0.88097024,0.13739537 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.70710677,0.13794963 }, 0.03125, { -0.77077067,0.6325759,0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.70710677,0.13794963 }, 0.03125, { -0.74116474,0.6325699,0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.70710677,0.13794963 }, 0.03125, { -0.63318473,0.7714814,0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,0.70710677,0.13794963 }, 0.03125, { -0.608811,0.771514,0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,0.55557024,0.16221143 }, 0.03124997, { -0.87862444,0.46961308,0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,0.55557024,0.16221143 }, 0.03124997, { -0.8448419,0.46962327,0.25631273 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,0.55557024,0.16221143 }, 0.03124997, { -0.77077067,0.6325759,0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,0.55557024,0.16221143 }, 0.03124997, { -0.74116474,0.6325699,0.2247893 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,0.38268346,0.18023989 }, 0.03125, { -0.95272064,0.28900626,0.09380203 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,0.38268346,0.18023989 }, 0.03125, { -0.9161052,0.28900164,0.2779016 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,0.38268346,0.18023989 }, 0.03125, { -0.87862444,0.46961308,0.0865024 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,0.38268346,0.18023989 }, 0.03125, { -0.8448419,0.46962327,0.25631273 }, 0.37499994 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,0.19509032,0.19134139 }, 0.03124997, { -0.9904472,0.097504646,0.097504646 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,0.19509032,0.19134139 }, 0.03124997, { -0.95272064,0.28900626,0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,0.19509032,0.19134139 }, 0.03124997, { -0.9523832,0.097498275,0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,0.19509032,0.19134139 }, 0.03124997, { -0.9161052,0.28900164,0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9807844,0,0.1950897 }, 0.03124994, { -0.9904472,-0.097504646,0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.9807844,0,0.1950897 }, 0.03124994, { -0.9904472,0.097504646,0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.9807844,0,0.1950897 }, 0.03124994, { -0.9523832,-0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.9807844,0,0.1950897 }, 0.03124994, { -0.9523832,0.097498275,0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,-0.19509032,0.19134139 }, 0.03124997, { -0.9904472,-0.097504646,0.097504646 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,-0.19509032,0.19134139 }, 0.03124997, { -0.95272064,-0.28900626,0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,-0.19509032,0.19134139 }, 0.03124997, { -0.9523832,-0.097498275,0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9619394,-0.19509032,0.19134139 }, 0.03124997, { -0.9161052,-0.28900164,0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,-0.38268346,0.18023989 }, 0.03125, { -0.95272064,-0.28900626,0.09380203 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,-0.38268346,0.18023989 }, 0.03125, { -0.9161052,-0.28900164,0.2779016 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,-0.38268346,0.18023989 }, 0.03125, { -0.87862444,-0.46961308,0.0865024 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.9061271,-0.38268346,0.18023989 }, 0.03125, { -0.8448419,-0.46962327,0.25631273 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,-0.55557024,0.16221143 }, 0.03124997, { -0.87862444,-0.46961308,0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,-0.55557024,0.16221143 }, 0.03124997, { -0.8448419,-0.46962327,0.25631273 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,-0.55557024,0.16221143 }, 0.03124997, { -0.77077067,-0.6325759,0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.81549275,-0.55557024,0.16221143 }, 0.03124997, { -0.74116474,-0.6325699,0.2247893 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.70710677,0.13794963 }, 0.03125, { -0.77077067,-0.6325759,0.07589712 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.70710677,0.13794963 }, 0.03125, { -0.74116474,-0.6325699,0.2247893 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.70710677,0.13794963 }, 0.03125, { -0.63318473,-0.7714814,0.062398497 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.6935198,-0.70710677,0.13794963 }, 0.03125, { -0.608811,-0.771514,0.18470335 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,-0.8314696,0.10838615 }, 0.03124997, { -0.63318473,-0.7714814,0.062398497 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,-0.8314696,0.10838615 }, 0.03124997, { -0.608811,-0.771514,0.18470335 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,-0.8314696,0.10838615 }, 0.03124997, { -0.47088575,-0.8809733,0.046398595 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.5448947,-0.8314696,0.10838615 }, 0.03124997, { -0.45278472,-0.88097024,0.13739537 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,-0.9238795,0.07465775 }, 0.03124997, { -0.47088575,-0.8809733,0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,-0.9238795,0.07465775 }, 0.03124997, { -0.45278472,-0.88097024,0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,-0.9238795,0.07465775 }, 0.03124997, { -0.2902107,-0.9565353,0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.37533012,-0.9238795,0.07465775 }, 0.03124997, { -0.2790153,-0.9565524,0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,-0.98078525,0.03806018 }, 0.03125, { -0.2902107,-0.9565353,0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,-0.98078525,0.03806018 }, 0.03125, { -0.2790153,-0.9565524,0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,-0.98078525,0.03806018 }, 0.03125, { -0.09800381,-0.99513876,0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134155,-0.98078525,0.03806018 }, 0.03125, { -0.09420398,-0.99514204,0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,0.98078525,-1.8626451e-08 }, 1, { -0.2902107,0.9565353,-0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,0.98078525,-1.8626451e-08 }, 0, { -0.2902107,0.9565353,0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,0.98078525,-1.8626451e-08 }, 1, { -0.09800381,0.99513876,-0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,0.98078525,-1.8626451e-08 }, 0, { -0.09800381,0.99513876,0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,0.9238795,-5.2154064e-08 }, 1, { -0.47088575,0.8809733,-0.046398595 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,0.9238795,-5.2154064e-08 }, 0, { -0.47088575,0.8809733,0.046398595 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,0.9238795,-5.2154064e-08 }, 1, { -0.2902107,0.9565353,-0.028601056 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,0.9238795,-5.2154064e-08 }, 0, { -0.2902107,0.9565353,0.028601056 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,0.8314696,-1.4901161e-07 }, 1, { -0.63318473,0.7714814,-0.062398497 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,0.8314696,-1.4901161e-07 }, 0, { -0.63318473,0.7714814,0.062398497 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,0.8314696,-1.4901161e-07 }, 1, { -0.47088575,0.8809733,-0.046398595 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,0.8314696,-1.4901161e-07 }, 0, { -0.47088575,0.8809733,0.046398595 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,0.70710677,-2.9802322e-08 }, 1, { -0.77077067,0.6325759,-0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,0.70710677,-2.9802322e-08 }, 0, { -0.77077067,0.6325759,0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,0.70710677,-2.9802322e-08 }, 1, { -0.63318473,0.7714814,-0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,0.70710677,-2.9802322e-08 }, 0, { -0.63318473,0.7714814,0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,0.55557024,-1.6391277e-07 }, 1, { -0.87862444,0.46961308,-0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,0.55557024,-1.6391277e-07 }, 0, { -0.87862444,0.46961308,0.0865024 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,0.55557024,-1.6391277e-07 }, 1, { -0.77077067,0.6325759,-0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,0.55557024,-1.6391277e-07 }, 0, { -0.77077067,0.6325759,0.07589712 }, 0.31249994 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,0.38268346,-1.4901161e-08 }, 1, { -0.95272064,0.28900626,-0.09380203 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,0.38268346,-1.4901161e-08 }, 0, { -0.95272064,0.28900626,0.09380203 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,0.38268346,-1.4901161e-08 }, 1, { -0.87862444,0.46961308,-0.0865024 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,0.38268346,-1.4901161e-08 }, 0, { -0.87862444,0.46961308,0.0865024 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,0.19509032,-2.682209e-07 }, 0, { -0.9904472,0.097504646,0.097504646 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,0.19509032,-2.682209e-07 }, 1, { -0.99043757,0.09750369,-0.0976037 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,0.19509032,-2.682209e-07 }, 1, { -0.95272064,0.28900626,-0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,0.19509032,-2.682209e-07 }, 0, { -0.95272064,0.28900626,0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.99999905,0,-4.4703484e-07 }, 0, { -0.9904472,-0.097504646,0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.99999905,0,-4.4703484e-07 }, 0, { -0.9904472,0.097504646,0.097504646 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.99999905,0,-4.4703484e-07 }, 1, { -0.99043757,-0.09750369,-0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.99999905,0,-4.4703484e-07 }, 1, { -0.99043757,0.09750369,-0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,-0.19509032,-2.682209e-07 }, 0, { -0.9904472,-0.097504646,0.097504646 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,-0.19509032,-2.682209e-07 }, 1, { -0.99043757,-0.09750369,-0.0976037 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,-0.19509032,-2.682209e-07 }, 1, { -0.95272064,-0.28900626,-0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.98078483,-0.19509032,-2.682209e-07 }, 0, { -0.95272064,-0.28900626,0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,-0.38268346,-1.4901161e-08 }, 1, { -0.95272064,-0.28900626,-0.09380203 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,-0.38268346,-1.4901161e-08 }, 0, { -0.95272064,-0.28900626,0.09380203 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,-0.38268346,-1.4901161e-08 }, 1, { -0.87862444,-0.46961308,-0.0865024 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.92387915,-0.38268346,-1.4901161e-08 }, 0, { -0.87862444,-0.46961308,0.0865024 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,-0.55557024,-1.6391277e-07 }, 1, { -0.87862444,-0.46961308,-0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,-0.55557024,-1.6391277e-07 }, 0, { -0.87862444,-0.46961308,0.0865024 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,-0.55557024,-1.6391277e-07 }, 1, { -0.77077067,-0.6325759,-0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.8314692,-0.55557024,-1.6391277e-07 }, 0, { -0.77077067,-0.6325759,0.07589712 }, 0.68750006 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,-0.70710677,-2.9802322e-08 }, 1, { -0.77077067,-0.6325759,-0.07589712 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,-0.70710677,-2.9802322e-08 }, 0, { -0.77077067,-0.6325759,0.07589712 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,-0.70710677,-2.9802322e-08 }, 1, { -0.63318473,-0.7714814,-0.062398497 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.7071066,-0.70710677,-2.9802322e-08 }, 0, { -0.63318473,-0.7714814,0.062398497 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,-0.8314696,-1.4901161e-07 }, 1, { -0.63318473,-0.7714814,-0.062398497 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,-0.8314696,-1.4901161e-07 }, 0, { -0.63318473,-0.7714814,0.062398497 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,-0.8314696,-1.4901161e-07 }, 1, { -0.47088575,-0.8809733,-0.046398595 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.55556977,-0.8314696,-1.4901161e-07 }, 0, { -0.47088575,-0.8809733,0.046398595 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,-0.9238795,-5.2154064e-08 }, 1, { -0.47088575,-0.8809733,-0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,-0.9238795,-5.2154064e-08 }, 0, { -0.47088575,-0.8809733,0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,-0.9238795,-5.2154064e-08 }, 1, { -0.2902107,-0.9565353,-0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.38268325,-0.9238795,-5.2154064e-08 }, 0, { -0.2902107,-0.9565353,0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,-0.98078525,-1.8626451e-08 }, 1, { -0.2902107,-0.9565353,-0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,-0.98078525,-1.8626451e-08 }, 0, { -0.2902107,-0.9565353,0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,-0.98078525,-1.8626451e-08 }, 1, { -0.09800381,-0.99513876,-0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19509014,-0.98078525,-1.8626451e-08 }, 0, { -0.09800381,-0.99513876,0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,0.98078525,-0.038060218 }, 0.96875, { -0.2902107,0.9565353,-0.028601056 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,0.98078525,-0.038060218 }, 0.96875, { -0.2790153,0.9565524,-0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,0.98078525,-0.038060218 }, 0.96875, { -0.09800381,0.99513876,-0.0097003775 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,0.98078525,-0.038060218 }, 0.96875, { -0.09420398,0.99514204,-0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,0.9238795,-0.07465785 }, 0.96874994, { -0.47088575,0.8809733,-0.046398595 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,0.9238795,-0.07465785 }, 0.96874994, { -0.45278472,0.88097024,-0.13739537 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,0.9238795,-0.07465785 }, 0.96874994, { -0.2902107,0.9565353,-0.028601056 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,0.9238795,-0.07465785 }, 0.96874994, { -0.2790153,0.9565524,-0.084604636 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,0.8314696,-0.108386435 }, 0.96874994, { -0.63318473,0.7714814,-0.062398497 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,0.8314696,-0.108386435 }, 0.96874994, { -0.608811,0.771514,-0.18470335 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,0.8314696,-0.108386435 }, 0.96874994, { -0.47088575,0.8809733,-0.046398595 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,0.8314696,-0.108386435 }, 0.96874994, { -0.45278472,0.88097024,-0.13739537 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,0.70710677,-0.13794969 }, 0.96875, { -0.77077067,0.6325759,-0.07589712 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,0.70710677,-0.13794969 }, 0.96875, { -0.74116474,0.6325699,-0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,0.70710677,-0.13794969 }, 0.96875, { -0.63318473,0.7714814,-0.062398497 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,0.70710677,-0.13794969 }, 0.96875, { -0.608811,0.771514,-0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,0.55557024,-0.16221176 }, 0.96874994, { -0.87862444,0.46961308,-0.0865024 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,0.55557024,-0.16221176 }, 0.96874994, { -0.8448419,0.46962327,-0.25631273 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,0.55557024,-0.16221176 }, 0.96874994, { -0.77077067,0.6325759,-0.07589712 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,0.55557024,-0.16221176 }, 0.96874994, { -0.74116474,0.6325699,-0.2247893 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,0.38268346,-0.1802399 }, 0.96875, { -0.95272064,0.28900626,-0.09380203 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,0.38268346,-0.1802399 }, 0.96875, { -0.9161052,0.28900164,-0.2779016 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,0.38268346,-0.1802399 }, 0.96875, { -0.87862444,0.46961308,-0.0865024 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,0.38268346,-0.1802399 }, 0.96875, { -0.8448419,0.46962327,-0.25631273 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,0.19509032,-0.19134189 }, 0.96874994, { -0.99043757,0.09750369,-0.0976037 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,0.19509032,-0.19134189 }, 0.96874994, { -0.95272064,0.28900626,-0.09380203 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,0.19509032,-0.19134189 }, 0.96874994, { -0.9523832,0.097498275,-0.2888949 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,0.19509032,-0.19134189 }, 0.96874994, { -0.9161052,0.28900164,-0.2779016 }, 0.4375 ,{ 1,1,1,1 } },Vertex{ { -0.98078424,0,-0.19509058 }, 0.9687499, { -0.99043757,-0.09750369,-0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.98078424,0,-0.19509058 }, 0.9687499, { -0.99043757,0.09750369,-0.0976037 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.98078424,0,-0.19509058 }, 0.9687499, { -0.9523832,-0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.98078424,0,-0.19509058 }, 0.9687499, { -0.9523832,0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,-0.19509032,-0.19134189 }, 0.96874994, { -0.99043757,-0.09750369,-0.0976037 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,-0.19509032,-0.19134189 }, 0.96874994, { -0.95272064,-0.28900626,-0.09380203 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,-0.19509032,-0.19134189 }, 0.96874994, { -0.9523832,-0.097498275,-0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.9619392,-0.19509032,-0.19134189 }, 0.96874994, { -0.9161052,-0.28900164,-0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,-0.38268346,-0.1802399 }, 0.96875, { -0.95272064,-0.28900626,-0.09380203 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,-0.38268346,-0.1802399 }, 0.96875, { -0.9161052,-0.28900164,-0.2779016 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,-0.38268346,-0.1802399 }, 0.96875, { -0.87862444,-0.46961308,-0.0865024 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.90612704,-0.38268346,-0.1802399 }, 0.96875, { -0.8448419,-0.46962327,-0.25631273 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,-0.55557024,-0.16221176 }, 0.96874994, { -0.87862444,-0.46961308,-0.0865024 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,-0.55557024,-0.16221176 }, 0.96874994, { -0.8448419,-0.46962327,-0.25631273 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,-0.55557024,-0.16221176 }, 0.96874994, { -0.77077067,-0.6325759,-0.07589712 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.81549263,-0.55557024,-0.16221176 }, 0.96874994, { -0.74116474,-0.6325699,-0.2247893 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,-0.70710677,-0.13794969 }, 0.96875, { -0.77077067,-0.6325759,-0.07589712 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,-0.70710677,-0.13794969 }, 0.96875, { -0.74116474,-0.6325699,-0.2247893 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,-0.70710677,-0.13794969 }, 0.96875, { -0.63318473,-0.7714814,-0.062398497 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.6935197,-0.70710677,-0.13794969 }, 0.96875, { -0.608811,-0.771514,-0.18470335 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,-0.8314696,-0.108386435 }, 0.96874994, { -0.63318473,-0.7714814,-0.062398497 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,-0.8314696,-0.108386435 }, 0.96874994, { -0.608811,-0.771514,-0.18470335 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,-0.8314696,-0.108386435 }, 0.96874994, { -0.47088575,-0.8809733,-0.046398595 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.54489464,-0.8314696,-0.108386435 }, 0.96874994, { -0.45278472,-0.88097024,-0.13739537 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,-0.9238795,-0.07465785 }, 0.96874994, { -0.47088575,-0.8809733,-0.046398595 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,-0.9238795,-0.07465785 }, 0.96874994, { -0.45278472,-0.88097024,-0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,-0.9238795,-0.07465785 }, 0.96874994, { -0.2902107,-0.9565353,-0.028601056 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.3753301,-0.9238795,-0.07465785 }, 0.96874994, { -0.2790153,-0.9565524,-0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,-0.98078525,-0.038060218 }, 0.96875, { -0.2902107,-0.9565353,-0.028601056 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,-0.98078525,-0.038060218 }, 0.96875, { -0.2790153,-0.9565524,-0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,-0.98078525,-0.038060218 }, 0.96875, { -0.09800381,-0.99513876,-0.0097003775 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.19134153,-0.98078525,-0.038060218 }, 0.96875, { -0.09420398,-0.99514204,-0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,0.98078525,-0.07465778 }, 0.9375, { -0.2790153,0.9565524,-0.084604636 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,0.98078525,-0.07465778 }, 0.9375, { -0.25711653,0.9565615,-0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,0.98078525,-0.07465778 }, 0.9375, { -0.09420398,0.99514204,-0.028601207 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,0.98078525,-0.07465778 }, 0.9375, { -0.0869031,0.99513555,-0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,0.9238795,-0.14644659 }, 0.9375, { -0.45278472,0.88097024,-0.13739537 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,0.9238795,-0.14644659 }, 0.9375, { -0.41728458,0.88096744,-0.22309177 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,0.9238795,-0.14644659 }, 0.9375, { -0.2790153,0.9565524,-0.084604636 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,0.9238795,-0.14644659 }, 0.9375, { -0.25711653,0.9565615,-0.13740884 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,0.8314696,-0.21260749 }, 0.93749994, { -0.608811,0.771514,-0.18470335 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,0.8314696,-0.21260749 }, 0.93749994, { -0.56110406,0.7715056,-0.29990217 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,0.8314696,-0.21260749 }, 0.93749994, { -0.45278472,0.88097024,-0.13739537 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,0.8314696,-0.21260749 }, 0.93749994, { -0.41728458,0.88096744,-0.22309177 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,0.70710677,-0.270598 }, 0.9375, { -0.74116474,0.6325699,-0.2247893 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,0.70710677,-0.270598 }, 0.9375, { -0.6830637,0.6325664,-0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,0.70710677,-0.270598 }, 0.9375, { -0.608811,0.771514,-0.18470335 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,0.70710677,-0.270598 }, 0.9375, { -0.56110406,0.7715056,-0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,0.55557024,-0.31818962 }, 0.93749994, { -0.8448419,0.46962327,-0.25631273 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,0.55557024,-0.31818962 }, 0.93749994, { -0.7786138,0.46960834,-0.4162074 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,0.55557024,-0.31818962 }, 0.93749994, { -0.74116474,0.6325699,-0.2247893 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,0.55557024,-0.31818962 }, 0.93749994, { -0.6830637,0.6325664,-0.3650806 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.853553,0.38268346,-0.35355324 }, 0.9375, { -0.9161052,0.28900164,-0.2779016 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.853553,0.38268346,-0.35355324 }, 0.9375, { -0.8448419,0.46962327,-0.25631273 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.853553,0.38268346,-0.35355324 }, 0.9375, { -0.8442852,0.28899494,-0.4512921 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.853553,0.38268346,-0.35355324 }, 0.9375, { -0.7786138,0.46960834,-0.4162074 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,0.19509032,-0.37533033 }, 0.93749994, { -0.9523832,0.097498275,-0.2888949 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,0.19509032,-0.37533033 }, 0.93749994, { -0.9161052,0.28900164,-0.2779016 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,0.19509032,-0.37533033 }, 0.93749994, { -0.87773585,0.09750398,-0.4691192 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,0.19509032,-0.37533033 }, 0.93749994, { -0.8442852,0.28899494,-0.4512921 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.92387843,0,-0.3826835 }, 0.9374999, { -0.9523832,-0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.92387843,0,-0.3826835 }, 0.9374999, { -0.9523832,0.097498275,-0.2888949 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.92387843,0,-0.3826835 }, 0.9374999, { -0.87773585,-0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.92387843,0,-0.3826835 }, 0.9374999, { -0.87773585,0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,-0.19509032,-0.37533033 }, 0.93749994, { -0.9523832,-0.097498275,-0.2888949 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,-0.19509032,-0.37533033 }, 0.93749994, { -0.9161052,-0.28900164,-0.2779016 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,-0.19509032,-0.37533033 }, 0.93749994, { -0.87773585,-0.09750398,-0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.90612686,-0.19509032,-0.37533033 }, 0.93749994, { -0.8442852,-0.28899494,-0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.853553,-0.38268346,-0.35355324 }, 0.9375, { -0.9161052,-0.28900164,-0.2779016 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.853553,-0.38268346,-0.35355324 }, 0.9375, { -0.8448419,-0.46962327,-0.25631273 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.853553,-0.38268346,-0.35355324 }, 0.9375, { -0.8442852,-0.28899494,-0.4512921 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.853553,-0.38268346,-0.35355324 }, 0.9375, { -0.7786138,-0.46960834,-0.4162074 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,-0.55557024,-0.31818962 }, 0.93749994, { -0.8448419,-0.46962327,-0.25631273 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,-0.55557024,-0.31818962 }, 0.93749994, { -0.7786138,-0.46960834,-0.4162074 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,-0.55557024,-0.31818962 }, 0.93749994, { -0.74116474,-0.6325699,-0.2247893 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.7681772,-0.55557024,-0.31818962 }, 0.93749994, { -0.6830637,-0.6325664,-0.3650806 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,-0.70710677,-0.270598 }, 0.9375, { -0.74116474,-0.6325699,-0.2247893 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,-0.70710677,-0.270598 }, 0.9375, { -0.6830637,-0.6325664,-0.3650806 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,-0.70710677,-0.270598 }, 0.9375, { -0.608811,-0.771514,-0.18470335 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.6532813,-0.70710677,-0.270598 }, 0.9375, { -0.56110406,-0.7715056,-0.29990217 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,-0.8314696,-0.21260749 }, 0.93749994, { -0.608811,-0.771514,-0.18470335 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,-0.8314696,-0.21260749 }, 0.93749994, { -0.56110406,-0.7715056,-0.29990217 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,-0.8314696,-0.21260749 }, 0.93749994, { -0.45278472,-0.88097024,-0.13739537 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.51327944,-0.8314696,-0.21260749 }, 0.93749994, { -0.41728458,-0.88096744,-0.22309177 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,-0.9238795,-0.14644659 }, 0.9375, { -0.45278472,-0.88097024,-0.13739537 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,-0.9238795,-0.14644659 }, 0.9375, { -0.41728458,-0.88096744,-0.22309177 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,-0.9238795,-0.14644659 }, 0.9375, { -0.2790153,-0.9565524,-0.084604636 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.3535532,-0.9238795,-0.14644659 }, 0.9375, { -0.25711653,-0.9565615,-0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,-0.98078525,-0.07465778 }, 0.9375, { -0.2790153,-0.9565524,-0.084604636 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,-0.98078525,-0.07465778 }, 0.9375, { -0.25711653,-0.9565615,-0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,-0.98078525,-0.07465778 }, 0.9375, { -0.09420398,-0.99514204,-0.028601207 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.18023978,-0.98078525,-0.07465778 }, 0.9375, { -0.0869031,-0.99513555,-0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,0.98078525,-0.10838629 }, 0.90625, { -0.25711653,0.9565615,-0.13740884 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,0.98078525,-0.10838629 }, 0.90625, { -0.22540875,0.9565371,-0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,0.98078525,-0.10838629 }, 0.90625, { -0.0869031,0.99513555,-0.046401657 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,0.98078525,-0.10838629 }, 0.90625, { -0.07610299,0.9951391,-0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,0.9238795,-0.21260746 }, 0.90625, { -0.41728458,0.88096744,-0.22309177 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,0.9238795,-0.21260746 }, 0.90625, { -0.36578342,0.88096005,-0.3001864 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,0.9238795,-0.21260746 }, 0.90625, { -0.25711653,0.9565615,-0.13740884 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,0.9238795,-0.21260746 }, 0.90625, { -0.22540875,0.9565371,-0.18500718 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,0.8314696,-0.30865815 }, 0.90624994, { -0.56110406,0.7715056,-0.29990217 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,0.8314696,-0.30865815 }, 0.90624994, { -0.49180678,0.7715106,-0.40360555 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,0.8314696,-0.30865815 }, 0.90624994, { -0.41728458,0.88096744,-0.22309177 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,0.8314696,-0.30865815 }, 0.90624994, { -0.36578342,0.88096005,-0.3001864 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.70710677,-0.3928474 }, 0.90625, { -0.6830637,0.6325664,-0.3650806 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.70710677,-0.3928474 }, 0.90625, { -0.5987,0.6326,-0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.70710677,-0.3928474 }, 0.90625, { -0.56110406,0.7715056,-0.29990217 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,0.70710677,-0.3928474 }, 0.90625, { -0.49180678,0.7715106,-0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,0.55557024,-0.46193963 }, 0.90625, { -0.7786138,0.46960834,-0.4162074 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,0.55557024,-0.46193963 }, 0.90625, { -0.6830637,0.6325664,-0.3650806 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,0.55557024,-0.46193963 }, 0.90625, { -0.6824855,0.46959004,-0.56008816 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,0.55557024,-0.46193963 }, 0.90625, { -0.5987,0.6326,-0.4913 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.38268346,-0.51327974 }, 0.90625, { -0.8442852,0.28899494,-0.4512921 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.38268346,-0.51327974 }, 0.90625, { -0.7786138,0.46960834,-0.4162074 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.38268346,-0.51327974 }, 0.90625, { -0.7400243,0.28900948,-0.60731995 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,0.38268346,-0.51327974 }, 0.90625, { -0.6824855,0.46959004,-0.56008816 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,0.19509032,-0.54489505 }, 0.90624994, { -0.87773585,0.09750398,-0.4691192 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,0.19509032,-0.54489505 }, 0.90624994, { -0.8442852,0.28899494,-0.4512921 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,0.19509032,-0.54489505 }, 0.90624994, { -0.76930207,0.09750026,-0.63140166 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,0.19509032,-0.54489505 }, 0.90624994, { -0.7400243,0.28900948,-0.60731995 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.83146846,0,-0.55557007 }, 0.90624994, { -0.87773585,-0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.83146846,0,-0.55557007 }, 0.90624994, { -0.87773585,0.09750398,-0.4691192 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.83146846,0,-0.55557007 }, 0.90624994, { -0.76930207,-0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.83146846,0,-0.55557007 }, 0.90624994, { -0.76930207,0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,-0.19509032,-0.54489505 }, 0.90624994, { -0.87773585,-0.09750398,-0.4691192 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,-0.19509032,-0.54489505 }, 0.90624994, { -0.8442852,-0.28899494,-0.4512921 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,-0.19509032,-0.54489505 }, 0.90624994, { -0.76930207,-0.09750026,-0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.8154926,-0.19509032,-0.54489505 }, 0.90624994, { -0.7400243,-0.28900948,-0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.38268346,-0.51327974 }, 0.90625, { -0.8442852,-0.28899494,-0.4512921 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.38268346,-0.51327974 }, 0.90625, { -0.7786138,-0.46960834,-0.4162074 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.38268346,-0.51327974 }, 0.90625, { -0.7400243,-0.28900948,-0.60731995 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.7681774,-0.38268346,-0.51327974 }, 0.90625, { -0.6824855,-0.46959004,-0.56008816 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,-0.55557024,-0.46193963 }, 0.90625, { -0.7786138,-0.46960834,-0.4162074 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,-0.55557024,-0.46193963 }, 0.90625, { -0.6830637,-0.6325664,-0.3650806 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,-0.55557024,-0.46193963 }, 0.90625, { -0.6824855,-0.46959004,-0.56008816 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.69134116,-0.55557024,-0.46193963 }, 0.90625, { -0.5987,-0.6326,-0.4913 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.70710677,-0.3928474 }, 0.90625, { -0.6830637,-0.6325664,-0.3650806 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.70710677,-0.3928474 }, 0.90625, { -0.5987,-0.6326,-0.4913 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.70710677,-0.3928474 }, 0.90625, { -0.56110406,-0.7715056,-0.29990217 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.5879376,-0.70710677,-0.3928474 }, 0.90625, { -0.49180678,-0.7715106,-0.40360555 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,-0.8314696,-0.30865815 }, 0.90624994, { -0.56110406,-0.7715056,-0.29990217 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,-0.8314696,-0.30865815 }, 0.90624994, { -0.49180678,-0.7715106,-0.40360555 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,-0.8314696,-0.30865815 }, 0.90624994, { -0.41728458,-0.88096744,-0.22309177 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.46193922,-0.8314696,-0.30865815 }, 0.90624994, { -0.36578342,-0.88096005,-0.3001864 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,-0.9238795,-0.21260746 }, 0.90625, { -0.41728458,-0.88096744,-0.22309177 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,-0.9238795,-0.21260746 }, 0.90625, { -0.36578342,-0.88096005,-0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,-0.9238795,-0.21260746 }, 0.90625, { -0.25711653,-0.9565615,-0.13740884 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.31818944,-0.9238795,-0.21260746 }, 0.90625, { -0.22540875,-0.9565371,-0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,-0.98078525,-0.10838629 }, 0.90625, { -0.25711653,-0.9565615,-0.13740884 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,-0.98078525,-0.10838629 }, 0.90625, { -0.22540875,-0.9565371,-0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,-0.98078525,-0.10838629 }, 0.90625, { -0.0869031,-0.99513555,-0.046401657 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.16221151,-0.98078525,-0.10838629 }, 0.90625, { -0.07610299,-0.9951391,-0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,0.98078525,-0.13794957 }, 0.875, { -0.22540875,0.9565371,-0.18500718 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,0.98078525,-0.13794957 }, 0.875, { -0.18500718,0.9565371,-0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,0.98078525,-0.13794957 }, 0.875, { -0.07610299,0.9951391,-0.06250246 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,0.98078525,-0.13794957 }, 0.875, { -0.06250246,0.9951391,-0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,0.9238795,-0.27059793 }, 0.875, { -0.36578342,0.88096005,-0.3001864 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,0.9238795,-0.27059793 }, 0.875, { -0.3001864,0.88096005,-0.36578342 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,0.9238795,-0.27059793 }, 0.875, { -0.22540875,0.9565371,-0.18500718 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,0.9238795,-0.27059793 }, 0.875, { -0.18500718,0.9565371,-0.22540875 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,0.8314696,-0.39284724 }, 0.8749999, { -0.49180678,0.7715106,-0.40360555 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,0.8314696,-0.39284724 }, 0.8749999, { -0.40360555,0.7715106,-0.49180678 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,0.8314696,-0.39284724 }, 0.8749999, { -0.36578342,0.88096005,-0.3001864 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,0.8314696,-0.39284724 }, 0.8749999, { -0.3001864,0.88096005,-0.36578342 }, 0.18749988 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,0.70710677,-0.49999988 }, 0.875, { -0.5987,0.6326,-0.4913 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,0.70710677,-0.49999988 }, 0.875, { -0.49180678,0.7715106,-0.40360555 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,0.70710677,-0.49999988 }, 0.875, { -0.4913,0.6326,-0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,0.70710677,-0.49999988 }, 0.875, { -0.40360555,0.7715106,-0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,0.55557024,-0.58793753 }, 0.87499994, { -0.6824855,0.46959004,-0.56008816 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,0.55557024,-0.58793753 }, 0.87499994, { -0.5987,0.6326,-0.4913 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,0.55557024,-0.58793753 }, 0.87499994, { -0.56008816,0.46959004,-0.6824855 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,0.55557024,-0.58793753 }, 0.87499994, { -0.4913,0.6326,-0.5987 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,0.38268346,-0.65328115 }, 0.875, { -0.7400243,0.28900948,-0.60731995 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,0.38268346,-0.65328115 }, 0.875, { -0.6824855,0.46959004,-0.56008816 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,0.38268346,-0.65328115 }, 0.875, { -0.60731995,0.28900948,-0.7400243 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,0.38268346,-0.65328115 }, 0.875, { -0.56008816,0.46959004,-0.6824855 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,0.19509032,-0.6935197 }, 0.87499994, { -0.76930207,0.09750026,-0.63140166 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,0.19509032,-0.6935197 }, 0.87499994, { -0.7400243,0.28900948,-0.60731995 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,0.19509032,-0.6935197 }, 0.87499994, { -0.63140166,0.09750026,-0.76930207 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,0.19509032,-0.6935197 }, 0.87499994, { -0.60731995,0.28900948,-0.7400243 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.7071057,0,-0.70710635 }, 0.8749999, { -0.76930207,-0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.7071057,0,-0.70710635 }, 0.8749999, { -0.76930207,0.09750026,-0.63140166 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.7071057,0,-0.70710635 }, 0.8749999, { -0.63140166,-0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.7071057,0,-0.70710635 }, 0.8749999, { -0.63140166,0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,-0.19509032,-0.6935197 }, 0.87499994, { -0.76930207,-0.09750026,-0.63140166 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,-0.19509032,-0.6935197 }, 0.87499994, { -0.7400243,-0.28900948,-0.60731995 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,-0.19509032,-0.6935197 }, 0.87499994, { -0.63140166,-0.09750026,-0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.69351935,-0.19509032,-0.6935197 }, 0.87499994, { -0.60731995,-0.28900948,-0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,-0.38268346,-0.65328115 }, 0.875, { -0.7400243,-0.28900948,-0.60731995 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,-0.38268346,-0.65328115 }, 0.875, { -0.6824855,-0.46959004,-0.56008816 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,-0.38268346,-0.65328115 }, 0.875, { -0.60731995,-0.28900948,-0.7400243 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.65328115,-0.38268346,-0.65328115 }, 0.875, { -0.56008816,-0.46959004,-0.6824855 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,-0.55557024,-0.58793753 }, 0.87499994, { -0.6824855,-0.46959004,-0.56008816 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,-0.55557024,-0.58793753 }, 0.87499994, { -0.5987,-0.6326,-0.4913 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,-0.55557024,-0.58793753 }, 0.87499994, { -0.56008816,-0.46959004,-0.6824855 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.58793724,-0.55557024,-0.58793753 }, 0.87499994, { -0.4913,-0.6326,-0.5987 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,-0.70710677,-0.49999988 }, 0.875, { -0.5987,-0.6326,-0.4913 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,-0.70710677,-0.49999988 }, 0.875, { -0.49180678,-0.7715106,-0.40360555 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,-0.70710677,-0.49999988 }, 0.875, { -0.4913,-0.6326,-0.5987 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.49999982,-0.70710677,-0.49999988 }, 0.875, { -0.40360555,-0.7715106,-0.49180678 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,-0.8314696,-0.39284724 }, 0.8749999, { -0.49180678,-0.7715106,-0.40360555 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,-0.8314696,-0.39284724 }, 0.8749999, { -0.40360555,-0.7715106,-0.49180678 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,-0.8314696,-0.39284724 }, 0.8749999, { -0.36578342,-0.88096005,-0.3001864 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.39284694,-0.8314696,-0.39284724 }, 0.8749999, { -0.3001864,-0.88096005,-0.36578342 }, 0.81250006 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,-0.9238795,-0.27059793 }, 0.875, { -0.36578342,-0.88096005,-0.3001864 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,-0.9238795,-0.27059793 }, 0.875, { -0.3001864,-0.88096005,-0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,-0.9238795,-0.27059793 }, 0.875, { -0.22540875,-0.9565371,-0.18500718 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.27059788,-0.9238795,-0.27059793 }, 0.875, { -0.18500718,-0.9565371,-0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,-0.98078525,-0.13794957 }, 0.875, { -0.22540875,-0.9565371,-0.18500718 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,-0.98078525,-0.13794957 }, 0.875, { -0.18500718,-0.9565371,-0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,-0.98078525,-0.13794957 }, 0.875, { -0.07610299,-0.9951391,-0.06250246 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.13794954,-0.98078525,-0.13794957 }, 0.875, { -0.06250246,-0.9951391,-0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,0.98078525,-0.16221152 }, 0.84375, { -0.18500718,0.9565371,-0.22540875 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,0.98078525,-0.16221152 }, 0.84375, { -0.13740884,0.9565615,-0.25711653 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,0.98078525,-0.16221152 }, 0.84375, { -0.06250246,0.9951391,-0.07610299 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,0.98078525,-0.16221152 }, 0.84375, { -0.046401657,0.99513555,-0.0869031 }, 0.06249994 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,0.9238795,-0.3181895 }, 0.84375, { -0.3001864,0.88096005,-0.36578342 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,0.9238795,-0.3181895 }, 0.84375, { -0.22299676,0.88098717,-0.4172939 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,0.9238795,-0.3181895 }, 0.84375, { -0.18500718,0.9565371,-0.22540875 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,0.9238795,-0.3181895 }, 0.84375, { -0.13740884,0.9565615,-0.25711653 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,0.8314696,-0.46193942 }, 0.84374994, { -0.40360555,0.7715106,-0.49180678 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,0.8314696,-0.46193942 }, 0.84374994, { -0.3001864,0.88096005,-0.36578342 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,0.8314696,-0.46193942 }, 0.84374994, { -0.29990217,0.7715056,-0.56110406 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,0.8314696,-0.46193942 }, 0.84374994, { -0.22299676,0.88098717,-0.4172939 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.70710677,-0.58793765 }, 0.84375, { -0.4913,0.6326,-0.5987 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.70710677,-0.58793765 }, 0.84375, { -0.40360555,0.7715106,-0.49180678 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.70710677,-0.58793765 }, 0.84375, { -0.3650806,0.6325664,-0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,0.70710677,-0.58793765 }, 0.84375, { -0.29990217,0.7715056,-0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,0.55557024,-0.69134134 }, 0.84374994, { -0.56008816,0.46959004,-0.6824855 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,0.55557024,-0.69134134 }, 0.84374994, { -0.4913,0.6326,-0.5987 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,0.55557024,-0.69134134 }, 0.84374994, { -0.4162074,0.46960834,-0.7786138 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,0.55557024,-0.69134134 }, 0.84374994, { -0.3650806,0.6325664,-0.6830637 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,0.38268346,-0.7681774 }, 0.84375, { -0.60731995,0.28900948,-0.7400243 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,0.38268346,-0.7681774 }, 0.84375, { -0.56008816,0.46959004,-0.6824855 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,0.38268346,-0.7681774 }, 0.84375, { -0.4512921,0.28899494,-0.8442852 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,0.38268346,-0.7681774 }, 0.84375, { -0.4162074,0.46960834,-0.7786138 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,0.19509032,-0.8154928 }, 0.84374994, { -0.63140166,0.09750026,-0.76930207 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,0.19509032,-0.8154928 }, 0.84374994, { -0.60731995,0.28900948,-0.7400243 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,0.19509032,-0.8154928 }, 0.84374994, { -0.4691192,0.09750398,-0.87773585 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,0.19509032,-0.8154928 }, 0.84374994, { -0.4512921,0.28899494,-0.8442852 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.55556923,0,-0.83146894 }, 0.8437499, { -0.63140166,-0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.55556923,0,-0.83146894 }, 0.8437499, { -0.63140166,0.09750026,-0.76930207 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.55556923,0,-0.83146894 }, 0.8437499, { -0.4691192,-0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.55556923,0,-0.83146894 }, 0.8437499, { -0.4691192,0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,-0.19509032,-0.8154928 }, 0.84374994, { -0.63140166,-0.09750026,-0.76930207 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,-0.19509032,-0.8154928 }, 0.84374994, { -0.60731995,-0.28900948,-0.7400243 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,-0.19509032,-0.8154928 }, 0.84374994, { -0.4691192,-0.09750398,-0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.5448946,-0.19509032,-0.8154928 }, 0.84374994, { -0.4512921,-0.28899494,-0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,-0.38268346,-0.7681774 }, 0.84375, { -0.60731995,-0.28900948,-0.7400243 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,-0.38268346,-0.7681774 }, 0.84375, { -0.56008816,-0.46959004,-0.6824855 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,-0.38268346,-0.7681774 }, 0.84375, { -0.4512921,-0.28899494,-0.8442852 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.5132797,-0.38268346,-0.7681774 }, 0.84375, { -0.4162074,-0.46960834,-0.7786138 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,-0.55557024,-0.69134134 }, 0.84374994, { -0.56008816,-0.46959004,-0.6824855 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,-0.55557024,-0.69134134 }, 0.84374994, { -0.4913,-0.6326,-0.5987 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,-0.55557024,-0.69134134 }, 0.84374994, { -0.4162074,-0.46960834,-0.7786138 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.46193928,-0.55557024,-0.69134134 }, 0.84374994, { -0.3650806,-0.6325664,-0.6830637 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.70710677,-0.58793765 }, 0.84375, { -0.4913,-0.6326,-0.5987 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.70710677,-0.58793765 }, 0.84375, { -0.40360555,-0.7715106,-0.49180678 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.70710677,-0.58793765 }, 0.84375, { -0.3650806,-0.6325664,-0.6830637 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.3928473,-0.70710677,-0.58793765 }, 0.84375, { -0.29990217,-0.7715056,-0.56110406 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,-0.8314696,-0.46193942 }, 0.84374994, { -0.40360555,-0.7715106,-0.49180678 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,-0.8314696,-0.46193942 }, 0.84374994, { -0.3001864,-0.88096005,-0.36578342 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,-0.8314696,-0.46193942 }, 0.84374994, { -0.29990217,-0.7715056,-0.56110406 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.3086578,-0.8314696,-0.46193942 }, 0.84374994, { -0.22299676,-0.88098717,-0.4172939 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,-0.9238795,-0.3181895 }, 0.84375, { -0.3001864,-0.88096005,-0.36578342 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,-0.9238795,-0.3181895 }, 0.84375, { -0.22299676,-0.88098717,-0.4172939 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,-0.9238795,-0.3181895 }, 0.84375, { -0.18500718,-0.9565371,-0.22540875 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.21260737,-0.9238795,-0.3181895 }, 0.84375, { -0.13740884,-0.9565615,-0.25711653 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,-0.98078525,-0.16221152 }, 0.84375, { -0.18500718,-0.9565371,-0.22540875 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,-0.98078525,-0.16221152 }, 0.84375, { -0.13740884,-0.9565615,-0.25711653 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,-0.98078525,-0.16221152 }, 0.84375, { -0.06250246,-0.9951391,-0.07610299 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.10838625,-0.98078525,-0.16221152 }, 0.84375, { -0.046401657,-0.99513555,-0.0869031 }, 0.93750006 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,0.98078525,-0.18023977 }, 0.8125, { -0.13740884,0.9565615,-0.25711653 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,0.98078525,-0.18023977 }, 0.8125, { -0.084604636,0.9565524,-0.2790153 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,0.98078525,-0.18023977 }, 0.8125, { -0.046401657,0.99513555,-0.0869031 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,0.98078525,-0.18023977 }, 0.8125, { -0.028601207,0.99514204,-0.09420398 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,0.9238795,-0.35355324 }, 0.8125, { -0.22299676,0.88098717,-0.4172939 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,0.9238795,-0.35355324 }, 0.8125, { -0.13740884,0.9565615,-0.25711653 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,0.9238795,-0.35355324 }, 0.8125, { -0.13739537,0.88097024,-0.45278472 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,0.9238795,-0.35355324 }, 0.8125, { -0.084604636,0.9565524,-0.2790153 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,0.8314696,-0.5132795 }, 0.81249994, { -0.29990217,0.7715056,-0.56110406 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,0.8314696,-0.5132795 }, 0.81249994, { -0.22299676,0.88098717,-0.4172939 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,0.8314696,-0.5132795 }, 0.81249994, { -0.18470335,0.771514,-0.608811 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,0.8314696,-0.5132795 }, 0.81249994, { -0.13739537,0.88097024,-0.45278472 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,0.70710677,-0.65328133 }, 0.8125, { -0.3650806,0.6325664,-0.6830637 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,0.70710677,-0.65328133 }, 0.8125, { -0.29990217,0.7715056,-0.56110406 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,0.70710677,-0.65328133 }, 0.8125, { -0.2247893,0.6325699,-0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,0.70710677,-0.65328133 }, 0.8125, { -0.18470335,0.771514,-0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,0.55557024,-0.7681773 }, 0.81249994, { -0.4162074,0.46960834,-0.7786138 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,0.55557024,-0.7681773 }, 0.81249994, { -0.3650806,0.6325664,-0.6830637 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,0.55557024,-0.7681773 }, 0.81249994, { -0.25631273,0.46962327,-0.8448419 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,0.55557024,-0.7681773 }, 0.81249994, { -0.2247893,0.6325699,-0.74116474 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,0.38268346,-0.853553 }, 0.8125, { -0.4512921,0.28899494,-0.8442852 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,0.38268346,-0.853553 }, 0.8125, { -0.4162074,0.46960834,-0.7786138 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,0.38268346,-0.853553 }, 0.8125, { -0.2779016,0.28900164,-0.9161052 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,0.38268346,-0.853553 }, 0.8125, { -0.25631273,0.46962327,-0.8448419 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,0.19509032,-0.906127 }, 0.81249994, { -0.4691192,0.09750398,-0.87773585 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,0.19509032,-0.906127 }, 0.81249994, { -0.4512921,0.28899494,-0.8442852 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,0.19509032,-0.906127 }, 0.81249994, { -0.2888949,0.097498275,-0.9523832 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,0.19509032,-0.906127 }, 0.81249994, { -0.2779016,0.28900164,-0.9161052 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.38268256,0,-0.9238786 }, 0.81249994, { -0.4691192,-0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.38268256,0,-0.9238786 }, 0.81249994, { -0.4691192,0.09750398,-0.87773585 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.38268256,0,-0.9238786 }, 0.81249994, { -0.2888949,-0.097498275,-0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.38268256,0,-0.9238786 }, 0.81249994, { -0.2888949,0.097498275,-0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,-0.19509032,-0.906127 }, 0.81249994, { -0.4691192,-0.09750398,-0.87773585 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,-0.19509032,-0.906127 }, 0.81249994, { -0.4512921,-0.28899494,-0.8442852 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,-0.19509032,-0.906127 }, 0.81249994, { -0.2888949,-0.097498275,-0.9523832 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.3753298,-0.19509032,-0.906127 }, 0.81249994, { -0.2779016,-0.28900164,-0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,-0.38268346,-0.853553 }, 0.8125, { -0.4512921,-0.28899494,-0.8442852 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,-0.38268346,-0.853553 }, 0.8125, { -0.4162074,-0.46960834,-0.7786138 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,-0.38268346,-0.853553 }, 0.8125, { -0.2779016,-0.28900164,-0.9161052 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.35355318,-0.38268346,-0.853553 }, 0.8125, { -0.25631273,-0.46962327,-0.8448419 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,-0.55557024,-0.7681773 }, 0.81249994, { -0.4162074,-0.46960834,-0.7786138 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,-0.55557024,-0.7681773 }, 0.81249994, { -0.3650806,-0.6325664,-0.6830637 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,-0.55557024,-0.7681773 }, 0.81249994, { -0.25631273,-0.46962327,-0.8448419 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.3181892,-0.55557024,-0.7681773 }, 0.81249994, { -0.2247893,-0.6325699,-0.74116474 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,-0.70710677,-0.65328133 }, 0.8125, { -0.3650806,-0.6325664,-0.6830637 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,-0.70710677,-0.65328133 }, 0.8125, { -0.29990217,-0.7715056,-0.56110406 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,-0.70710677,-0.65328133 }, 0.8125, { -0.2247893,-0.6325699,-0.74116474 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.2705979,-0.70710677,-0.65328133 }, 0.8125, { -0.18470335,-0.771514,-0.608811 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,-0.8314696,-0.5132795 }, 0.81249994, { -0.29990217,-0.7715056,-0.56110406 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,-0.8314696,-0.5132795 }, 0.81249994, { -0.22299676,-0.88098717,-0.4172939 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,-0.8314696,-0.5132795 }, 0.81249994, { -0.18470335,-0.771514,-0.608811 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.2126071,-0.8314696,-0.5132795 }, 0.81249994, { -0.13739537,-0.88097024,-0.45278472 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,-0.9238795,-0.35355324 }, 0.8125, { -0.22299676,-0.88098717,-0.4172939 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,-0.9238795,-0.35355324 }, 0.8125, { -0.13740884,-0.9565615,-0.25711653 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,-0.9238795,-0.35355324 }, 0.8125, { -0.13739537,-0.88097024,-0.45278472 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.14644648,-0.9238795,-0.35355324 }, 0.8125, { -0.084604636,-0.9565524,-0.2790153 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,-0.98078525,-0.18023977 }, 0.8125, { -0.13740884,-0.9565615,-0.25711653 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,-0.98078525,-0.18023977 }, 0.8125, { -0.084604636,-0.9565524,-0.2790153 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,-0.98078525,-0.18023977 }, 0.8125, { -0.046401657,-0.99513555,-0.0869031 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.07465774,-0.98078525,-0.18023977 }, 0.8125, { -0.028601207,-0.99514204,-0.09420398 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,0.98078525,-0.1913415 }, 0.78125, { -0.084604636,0.9565524,-0.2790153 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,0.98078525,-0.1913415 }, 0.78125, { -0.028601207,0.99514204,-0.09420398 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,0.98078525,-0.1913415 }, 0.78125, { -0.028601056,0.9565353,-0.2902107 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,0.98078525,-0.1913415 }, 0.78125, { -0.0097003775,0.99513876,-0.09800381 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,0.9238795,-0.3753301 }, 0.78125, { -0.13739537,0.88097024,-0.45278472 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,0.9238795,-0.3753301 }, 0.78125, { -0.084604636,0.9565524,-0.2790153 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,0.9238795,-0.3753301 }, 0.78125, { -0.046398595,0.8809733,-0.47088575 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,0.9238795,-0.3753301 }, 0.78125, { -0.028601056,0.9565353,-0.2902107 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,0.8314696,-0.5448945 }, 0.78124994, { -0.18470335,0.771514,-0.608811 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,0.8314696,-0.5448945 }, 0.78124994, { -0.13739537,0.88097024,-0.45278472 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,0.8314696,-0.5448945 }, 0.78124994, { -0.062398497,0.7714814,-0.63318473 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,0.8314696,-0.5448945 }, 0.78124994, { -0.046398595,0.8809733,-0.47088575 }, 0.18749982 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,0.70710677,-0.6935198 }, 0.78125, { -0.2247893,0.6325699,-0.74116474 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,0.70710677,-0.6935198 }, 0.78125, { -0.18470335,0.771514,-0.608811 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,0.70710677,-0.6935198 }, 0.78125, { -0.07589712,0.6325759,-0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,0.70710677,-0.6935198 }, 0.78125, { -0.062398497,0.7714814,-0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,0.55557024,-0.8154926 }, 0.78124994, { -0.25631273,0.46962327,-0.8448419 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,0.55557024,-0.8154926 }, 0.78124994, { -0.2247893,0.6325699,-0.74116474 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,0.55557024,-0.8154926 }, 0.78124994, { -0.0865024,0.46961308,-0.87862444 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,0.55557024,-0.8154926 }, 0.78124994, { -0.07589712,0.6325759,-0.77077067 }, 0.31249988 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.38268346,-0.906127 }, 0.78125, { -0.2779016,0.28900164,-0.9161052 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.38268346,-0.906127 }, 0.78125, { -0.25631273,0.46962327,-0.8448419 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.38268346,-0.906127 }, 0.78125, { -0.09380203,0.28900626,-0.95272064 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,0.38268346,-0.906127 }, 0.78125, { -0.0865024,0.46961308,-0.87862444 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,0.19509032,-0.9619392 }, 0.78124994, { -0.2888949,0.097498275,-0.9523832 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,0.19509032,-0.9619392 }, 0.78124994, { -0.2779016,0.28900164,-0.9161052 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,0.19509032,-0.9619392 }, 0.78124994, { -0.0976037,0.09750369,-0.99043757 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,0.19509032,-0.9619392 }, 0.78124994, { -0.09380203,0.28900626,-0.95272064 }, 0.43749994 ,{ 1,1,1,1 } },Vertex{ { -0.19508962,0,-0.9807842 }, 0.7812499, { -0.2888949,-0.097498275,-0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19508962,0,-0.9807842 }, 0.7812499, { -0.2888949,0.097498275,-0.9523832 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19508962,0,-0.9807842 }, 0.7812499, { -0.0976037,-0.09750369,-0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19508962,0,-0.9807842 }, 0.7812499, { -0.0976037,0.09750369,-0.99043757 }, 0.5 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,-0.19509032,-0.9619392 }, 0.78124994, { -0.2888949,-0.097498275,-0.9523832 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,-0.19509032,-0.9619392 }, 0.78124994, { -0.2779016,-0.28900164,-0.9161052 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,-0.19509032,-0.9619392 }, 0.78124994, { -0.0976037,-0.09750369,-0.99043757 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.19134133,-0.19509032,-0.9619392 }, 0.78124994, { -0.09380203,-0.28900626,-0.95272064 }, 0.5625 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.38268346,-0.906127 }, 0.78125, { -0.2779016,-0.28900164,-0.9161052 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.38268346,-0.906127 }, 0.78125, { -0.25631273,-0.46962327,-0.8448419 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.38268346,-0.906127 }, 0.78125, { -0.09380203,-0.28900626,-0.95272064 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.18023981,-0.38268346,-0.906127 }, 0.78125, { -0.0865024,-0.46961308,-0.87862444 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,-0.55557024,-0.8154926 }, 0.78124994, { -0.25631273,-0.46962327,-0.8448419 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,-0.55557024,-0.8154926 }, 0.78124994, { -0.2247893,-0.6325699,-0.74116474 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,-0.55557024,-0.8154926 }, 0.78124994, { -0.0865024,-0.46961308,-0.87862444 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.16221133,-0.55557024,-0.8154926 }, 0.78124994, { -0.07589712,-0.6325759,-0.77077067 }, 0.6875001 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,-0.70710677,-0.6935198 }, 0.78125, { -0.2247893,-0.6325699,-0.74116474 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,-0.70710677,-0.6935198 }, 0.78125, { -0.18470335,-0.771514,-0.608811 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,-0.70710677,-0.6935198 }, 0.78125, { -0.07589712,-0.6325759,-0.77077067 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.13794957,-0.70710677,-0.6935198 }, 0.78125, { -0.062398497,-0.7714814,-0.63318473 }, 0.75 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,-0.8314696,-0.5448945 }, 0.78124994, { -0.18470335,-0.771514,-0.608811 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,-0.8314696,-0.5448945 }, 0.78124994, { -0.13739537,-0.88097024,-0.45278472 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,-0.8314696,-0.5448945 }, 0.78124994, { -0.062398497,-0.7714814,-0.63318473 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.10838604,-0.8314696,-0.5448945 }, 0.78124994, { -0.046398595,-0.8809733,-0.47088575 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,-0.9238795,-0.3753301 }, 0.78125, { -0.13739537,-0.88097024,-0.45278472 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,-0.9238795,-0.3753301 }, 0.78125, { -0.084604636,-0.9565524,-0.2790153 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,-0.9238795,-0.3753301 }, 0.78125, { -0.046398595,-0.8809733,-0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.07465773,-0.9238795,-0.3753301 }, 0.78125, { -0.028601056,-0.9565353,-0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,-0.98078525,-0.1913415 }, 0.78125, { -0.084604636,-0.9565524,-0.2790153 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,-0.98078525,-0.1913415 }, 0.78125, { -0.028601207,-0.99514204,-0.09420398 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,-0.98078525,-0.1913415 }, 0.78125, { -0.028601056,-0.9565353,-0.2902107 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { -0.038060177,-0.98078525,-0.1913415 }, 0.78125, { -0.0097003775,-0.99513876,-0.09800381 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,0.98078525,-0.1950901 }, 0.75, { -0.028601056,0.9565353,-0.2902107 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,0.98078525,-0.1950901 }, 0.75, { -0.0097003775,0.99513876,-0.09800381 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,0.98078525,-0.1950901 }, 0.75, { 0.0097003775,0.99513876,-0.09800381 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,0.98078525,-0.1950901 }, 0.75, { 0.028601056,0.9565353,-0.2902107 }, 0.06249988 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,0.9238795,-0.38268322 }, 0.74999994, { -0.046398595,0.8809733,-0.47088575 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,0.9238795,-0.38268322 }, 0.74999994, { -0.028601056,0.9565353,-0.2902107 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,0.9238795,-0.38268322 }, 0.74999994, { 0.028601056,0.9565353,-0.2902107 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,0.9238795,-0.38268322 }, 0.74999994, { 0.046398595,0.8809733,-0.47088575 }, 0.12499994 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,0.70710677,-0.7071066 }, 0.75, { -0.07589712,0.6325759,-0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,0.70710677,-0.7071066 }, 0.75, { -0.062398497,0.7714814,-0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,0.70710677,-0.7071066 }, 0.75, { 0.062398497,0.7714814,-0.63318473 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,0.70710677,-0.7071066 }, 0.75, { 0.07589712,0.6325759,-0.77077067 }, 0.24999994 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,0.38268346,-0.923879 }, 0.75, { -0.09380203,0.28900626,-0.95272064 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,0.38268346,-0.923879 }, 0.75, { -0.0865024,0.46961308,-0.87862444 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,0.38268346,-0.923879 }, 0.75, { 0.0865024,0.46961308,-0.87862444 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,0.38268346,-0.923879 }, 0.75, { 0.09380203,0.28900626,-0.95272064 }, 0.37499988 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,-0.38268346,-0.923879 }, 0.75, { -0.09380203,-0.28900626,-0.95272064 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,-0.38268346,-0.923879 }, 0.75, { -0.0865024,-0.46961308,-0.87862444 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,-0.38268346,-0.923879 }, 0.75, { 0.0865024,-0.46961308,-0.87862444 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { 5.9604645e-08,-0.38268346,-0.923879 }, 0.75, { 0.09380203,-0.28900626,-0.95272064 }, 0.62500006 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,-0.70710677,-0.7071066 }, 0.75, { -0.07589712,-0.6325759,-0.77077067 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,-0.70710677,-0.7071066 }, 0.75, { -0.062398497,-0.7714814,-0.63318473 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,-0.70710677,-0.7071066 }, 0.75, { 0.062398497,-0.7714814,-0.63318473 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { 8.940697e-08,-0.70710677,-0.7071066 }, 0.75, { 0.07589712,-0.6325759,-0.77077067 }, 0.75000006 ,{ 1,1,1,1 } },Vertex{ { 2.1606684e-07,-0.8314696,-0.5555695 }, 0.74999994, { -0.062398497,-0.7714814,-0.63318473 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { 2.1606684e-07,-0.8314696,-0.5555695 }, 0.74999994, { -0.046398595,-0.8809733,-0.47088575 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { 2.1606684e-07,-0.8314696,-0.5555695 }, 0.74999994, { 0.046398595,-0.8809733,-0.47088575 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { 2.1606684e-07,-0.8314696,-0.5555695 }, 0.74999994, { 0.062398497,-0.7714814,-0.63318473 }, 0.8125002 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,-0.9238795,-0.38268322 }, 0.74999994, { -0.046398595,-0.8809733,-0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,-0.9238795,-0.38268322 }, 0.74999994, { -0.028601056,-0.9565353,-0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,-0.9238795,-0.38268322 }, 0.74999994, { 0.028601056,-0.9565353,-0.2902107 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 6.7055225e-08,-0.9238795,-0.38268322 }, 0.74999994, { 0.046398595,-0.8809733,-0.47088575 }, 0.875 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,-0.98078525,-0.1950901 }, 0.75, { -0.028601056,-0.9565353,-0.2902107 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,-0.98078525,-0.1950901 }, 0.75, { -0.0097003775,-0.99513876,-0.09800381 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,-0.98078525,-0.1950901 }, 0.75, { 0.0097003775,-0.99513876,-0.09800381 }, 0.9375001 ,{ 1,1,1,1 } },Vertex{ { 1.4901161e-08,-0.98078525,-0.1950901 }, 0.75, { 0.028601056,-0.9565353,-0.2902107 }, 0.9375001 ,{ 1,1,1,1 } } }; 
-uint32_t Sphere_idx[] = { 23,1966,60,23,60,65,1958,3,33,1958,33,36,1971,22,64,1971,64,69,6,1959,37,6,37,40,1975,1970,68,1975,68,73,1962,7,41,1962,41,44,1979,1974,72,1979,72,77,10,1963,45,10,45,48,1983,1978,76,1983,76,81,15,11,49,15,49,53,1950,340,24,1272,1982,80,19,14,52,19,52,57,1954,1951,25,1954,25,28,1967,18,56,1967,56,61,2,1955,29,2,29,32,63,58,116,63,116,121,34,31,89,34,89,92,67,62,120,67,120,125,38,35,93,38,93,96,71,66,124,71,124,129,42,39,97,42,97,100,75,70,128,75,128,133,46,43,101,46,101,104,79,74,132,79,132,137,50,47,105,50,105,108,83,78,136,83,136,142,55,51,109,55,109,113,26,342,84,1274,82,140,59,54,112,59,112,117,30,27,86,30,86,88,139,134,192,139,192,198,110,107,165,110,165,168,143,138,196,143,196,202,115,111,169,115,169,173,85,344,144,1276,141,200,119,114,172,119,172,177,90,87,146,90,146,148,123,118,176,123,176,181,94,91,150,94,150,152,127,122,180,127,180,185,98,95,153,98,153,156,131,126,184,131,184,189,102,99,157,102,157,160,135,130,188,135,188,193,106,103,161,106,161,164,154,151,210,154,210,212,187,182,240,187,240,245,158,155,214,158,214,216,191,186,244,191,244,249,162,159,217,162,217,220,195,190,248,195,248,254,166,163,221,166,221,224,199,194,252,199,252,258,170,167,225,170,225,228,203,197,256,203,256,262,175,171,229,175,229,233,145,346,204,1278,201,260,179,174,232,179,232,237,149,147,206,149,206,208,183,178,236,183,236,241,230,227,285,230,285,288,263,257,316,263,316,322,235,231,289,235,289,293,205,348,264,1280,261,320,239,234,292,239,292,297,209,207,266,209,266,268,243,238,296,243,296,301,213,211,270,213,270,272,247,242,300,247,300,305,218,215,274,218,274,276,251,246,304,251,304,310,222,219,278,222,278,280,255,250,308,255,308,314,226,223,281,226,281,284,259,253,312,259,312,318,307,302,392,307,392,398,277,275,366,277,366,368,311,306,396,311,396,402,282,279,370,282,370,372,315,309,400,315,400,406,286,283,374,286,374,376,319,313,404,319,404,410,290,287,377,290,377,380,323,317,408,323,408,414,295,291,381,295,381,385,265,350,356,1282,321,412,299,294,384,299,384,389,269,267,358,269,358,360,303,298,388,303,388,393,273,271,362,273,362,364,415,409,468,415,468,474,387,383,441,387,441,445,357,352,416,1284,413,472,391,386,444,391,444,449,361,359,418,361,418,420,395,390,448,395,448,454,365,363,422,365,422,424,399,394,452,399,452,458,369,367,426,369,426,428,403,397,456,403,456,462,373,371,430,373,430,432,407,401,460,407,460,466,378,375,434,378,434,436,411,405,464,411,464,470,382,379,438,382,438,440,463,457,516,463,516,522,433,431,490,433,490,492,467,461,520,467,520,526,437,435,494,437,494,496,471,465,524,471,524,530,442,439,498,442,498,500,475,469,528,475,528,534,447,443,503,447,503,507,417,354,476,1286,473,532,451,446,506,451,506,511,421,419,478,421,478,480,455,450,508,455,508,514,425,423,482,425,482,484,459,453,512,459,512,518,429,427,486,429,486,488,477,355,537,1287,533,593,510,504,566,510,566,571,481,479,539,481,539,541,515,509,570,515,570,575,485,483,543,485,543,545,519,513,573,519,573,579,489,487,547,489,547,549,523,517,577,523,577,583,493,491,551,493,551,553,527,521,581,527,581,587,497,495,555,497,555,557,531,525,585,531,585,591,501,499,559,501,559,562,535,529,589,535,589,595,505,502,563,505,563,567,552,550,611,552,611,613,586,580,641,586,641,647,556,554,615,556,615,618,590,584,645,590,645,651,560,558,619,560,619,622,594,588,649,594,649,655,565,561,623,565,623,627,536,353,597,1285,592,653,569,564,626,569,626,631,540,538,599,540,599,601,574,568,630,574,630,635,544,542,603,544,603,605,578,572,634,578,634,639,548,546,607,548,607,609,582,576,637,582,637,643,629,624,686,629,686,691,600,598,659,600,659,661,633,628,690,633,690,695,604,602,663,604,663,665,638,632,694,638,694,699,608,606,667,608,667,669,642,636,698,642,698,703,612,610,671,612,671,674,646,640,701,646,701,707,616,614,675,616,675,678,650,644,705,650,705,711,620,617,679,620,679,682,654,648,709,654,709,715,625,621,683,625,683,687,596,351,657,1283,652,713,706,700,762,706,762,767,676,673,735,676,735,738,710,704,765,710,765,771,680,677,739,680,739,742,714,708,769,714,769,775,685,681,743,685,743,747,656,349,717,1281,712,773,689,684,746,689,746,751,660,658,719,660,719,721,693,688,750,693,750,755,664,662,723,664,723,725,697,692,754,697,754,759,668,666,727,668,727,730,702,696,758,702,758,763,672,670,731,672,731,734,720,718,779,720,779,781,753,748,810,753,810,815,724,722,783,724,783,786,757,752,814,757,814,819,728,726,787,728,787,790,761,756,818,761,818,823,732,729,791,732,791,794,766,760,822,766,822,827,736,733,795,736,795,798,770,764,826,770,826,831,740,737,799,740,799,802,774,768,829,774,829,835,745,741,803,745,803,807,716,347,777,1279,772,833,749,744,806,749,806,811,796,793,855,796,855,858,830,824,886,830,886,891,800,797,859,800,859,862,834,828,890,834,890,895,805,801,863,805,863,867,776,345,837,1277,832,893,809,804,866,809,866,871,780,778,839,780,839,842,813,808,870,813,870,875,784,782,843,784,843,846,817,812,874,817,874,879,788,785,847,788,847,850,821,816,878,821,878,883,792,789,851,792,851,854,825,820,882,825,882,887,873,868,930,873,930,935,844,841,903,844,903,906,877,872,934,877,934,939,848,845,907,848,907,910,881,876,938,881,938,943,852,849,911,852,911,914,885,880,942,885,942,947,856,853,915,856,915,918,889,884,946,889,946,951,860,857,919,860,919,922,894,888,950,894,950,955,865,861,923,865,923,927,836,343,898,1275,892,954,869,864,926,869,926,931,840,838,899,840,899,902,949,944,1006,949,1006,1011,920,917,979,920,979,982,953,948,1010,953,1010,1015,925,921,983,925,983,987,896,341,958,1273,952,1014,929,924,986,929,986,991,900,897,959,900,959,962,933,928,990,933,990,995,904,901,963,904,963,966,937,932,994,937,994,999,908,905,967,908,967,970,941,936,998,941,998,1003,912,909,971,912,971,974,945,940,1002,945,1002,1007,916,913,975,916,975,978,996,993,1055,996,1055,1058,969,964,1026,969,1026,1031,1000,997,1059,1000,1059,1062,973,968,1030,973,1030,1035,1004,1001,1063,1004,1063,1066,977,972,1034,977,1034,1039,1008,1005,1067,1008,1067,1070,981,976,1038,981,1038,1043,1012,1009,1071,1012,1071,1074,985,980,1042,985,1042,1047,957,339,1019,1271,1013,1075,988,984,1046,988,1046,1050,961,956,1018,961,1018,1023,992,989,1051,992,1051,1054,965,960,1022,965,1022,1027,1072,1069,1131,1072,1131,1133,1045,1040,1102,1045,1102,1107,1017,337,1079,1269,1073,1135,1048,1044,1106,1048,1106,1110,1021,1016,1077,1021,1077,1083,1052,1049,1111,1052,1111,1114,1025,1020,1082,1025,1082,1087,1056,1053,1115,1056,1115,1118,1029,1024,1086,1029,1086,1091,1060,1057,1119,1060,1119,1122,1033,1028,1090,1033,1090,1095,1064,1061,1123,1064,1123,1126,1037,1032,1094,1037,1094,1099,1068,1065,1127,1068,1127,1130,1041,1036,1098,1041,1098,1103,1089,1084,1146,1089,1146,1151,1120,1117,1179,1120,1179,1182,1093,1088,1150,1093,1150,1155,1124,1121,1183,1124,1183,1186,1097,1092,1154,1097,1154,1159,1128,1125,1187,1128,1187,1189,1101,1096,1158,1101,1158,1163,1132,1129,1191,1132,1191,1193,1105,1100,1162,1105,1162,1167,1078,335,1139,1267,1134,1195,1108,1104,1166,1108,1166,1170,1081,1076,1137,1081,1137,1143,1112,1109,1171,1112,1171,1174,1085,1080,1141,1085,1141,1147,1116,1113,1175,1116,1175,1178,1165,1160,1222,1165,1222,1227,1138,333,1199,1265,1194,1255,1168,1164,1226,1168,1226,1230,1142,1136,1197,1142,1197,1203,1172,1169,1231,1172,1231,1234,1145,1140,1201,1145,1201,1207,1176,1173,1235,1176,1235,1238,1149,1144,1205,1149,1205,1211,1180,1177,1239,1180,1239,1242,1153,1148,1210,1153,1210,1215,1184,1181,1243,1184,1243,1245,1157,1152,1214,1157,1214,1219,1188,1185,1247,1188,1247,1249,1161,1156,1218,1161,1218,1223,1192,1190,1251,1192,1251,1253,1240,1237,1331,1240,1331,1333,1213,1208,1301,1213,1301,1307,1244,1241,1335,1244,1335,1337,1217,1212,1306,1217,1306,1311,1248,1246,1339,1248,1339,1341,1221,1216,1310,1221,1310,1315,1252,1250,1343,1252,1343,1345,1225,1220,1314,1225,1314,1319,1198,331,1291,1263,1254,1347,1228,1224,1318,1228,1318,1322,1202,1196,1289,1202,1289,1295,1232,1229,1323,1232,1323,1326,1206,1200,1293,1206,1293,1299,1236,1233,1327,1236,1327,1330,1209,1204,1297,1209,1297,1303,1290,329,1351,1261,1346,1407,1320,1316,1378,1320,1378,1382,1294,1288,1349,1294,1349,1355,1324,1321,1383,1324,1383,1386,1298,1292,1353,1298,1353,1359,1328,1325,1387,1328,1387,1389,1302,1296,1357,1302,1357,1363,1332,1329,1391,1332,1391,1393,1305,1300,1361,1305,1361,1367,1336,1334,1395,1336,1395,1397,1309,1304,1365,1309,1365,1371,1340,1338,1399,1340,1399,1401,1313,1308,1370,1313,1370,1375,1344,1342,1403,1344,1403,1405,1317,1312,1374,1317,1374,1379,1366,1360,1421,1366,1421,1427,1396,1394,1455,1396,1455,1457,1369,1364,1425,1369,1425,1431,1400,1398,1459,1400,1459,1461,1373,1368,1429,1373,1429,1435,1404,1402,1463,1404,1463,1465,1377,1372,1434,1377,1434,1439,1350,327,1411,1259,1406,1467,1380,1376,1438,1380,1438,1442,1354,1348,1409,1354,1409,1415,1384,1381,1443,1384,1443,1445,1358,1352,1413,1358,1413,1419,1388,1385,1447,1388,1447,1449,1362,1356,1417,1362,1417,1423,1392,1390,1451,1392,1451,1453,1440,1436,1496,1440,1496,1500,1414,1408,1469,1414,1469,1475,1444,1441,1503,1444,1503,1505,1418,1412,1473,1418,1473,1479,1448,1446,1507,1448,1507,1509,1422,1416,1477,1422,1477,1483,1452,1450,1511,1452,1511,1513,1426,1420,1481,1426,1481,1487,1456,1454,1515,1456,1515,1517,1430,1424,1485,1430,1485,1491,1460,1458,1519,1460,1519,1521,1433,1428,1489,1433,1489,1495,1464,1462,1523,1464,1523,1525,1437,1432,1492,1437,1492,1497,1410,325,1471,1257,1466,1527,1516,1514,1574,1516,1574,1576,1490,1484,1544,1490,1544,1550,1520,1518,1578,1520,1578,1580,1494,1488,1548,1494,1548,1553,1524,1522,1582,1524,1582,1584,1499,1493,1552,1499,1552,1557,1470,324,1530,1256,1526,1586,1501,1498,1556,1501,1556,1560,1474,1468,1528,1474,1528,1534,1504,1502,1561,1504,1561,1564,1478,1472,1532,1478,1532,1538,1508,1506,1566,1508,1566,1568,1482,1476,1536,1482,1536,1542,1512,1510,1570,1512,1570,1572,1486,1480,1540,1486,1540,1546,1565,1563,1621,1565,1621,1624,1539,1533,1592,1539,1592,1598,1569,1567,1625,1569,1625,1628,1543,1537,1596,1543,1596,1602,1573,1571,1630,1573,1630,1632,1547,1541,1600,1547,1600,1606,1577,1575,1634,1577,1634,1636,1551,1545,1604,1551,1604,1609,1581,1579,1638,1581,1638,1640,1555,1549,1608,1555,1608,1613,1585,1583,1642,1585,1642,1644,1559,1554,1612,1559,1612,1617,1531,326,1590,1258,1587,1646,1562,1558,1616,1562,1616,1620,1535,1529,1588,1535,1588,1594,1641,1639,1698,1641,1698,1700,1615,1610,1668,1615,1668,1673,1645,1643,1702,1645,1702,1704,1619,1614,1672,1619,1672,1677,1591,328,1650,1260,1647,1706,1622,1618,1676,1622,1676,1680,1595,1589,1648,1595,1648,1654,1626,1623,1681,1626,1681,1684,1599,1593,1652,1599,1652,1658,1629,1627,1685,1629,1685,1688,1603,1597,1656,1603,1656,1662,1633,1631,1689,1633,1689,1692,1607,1601,1660,1607,1660,1665,1637,1635,1694,1637,1694,1696,1611,1605,1664,1611,1664,1669,1659,1653,1712,1659,1712,1718,1690,1687,1745,1690,1745,1748,1663,1657,1716,1663,1716,1721,1693,1691,1749,1693,1749,1752,1667,1661,1720,1667,1720,1725,1697,1695,1753,1697,1753,1756,1671,1666,1724,1671,1724,1729,1701,1699,1758,1701,1758,1760,1675,1670,1728,1675,1728,1733,1705,1703,1762,1705,1762,1764,1679,1674,1732,1679,1732,1737,1651,330,1710,1262,1707,1766,1682,1678,1736,1682,1736,1740,1655,1649,1708,1655,1708,1714,1686,1683,1741,1686,1741,1744,1735,1730,1788,1735,1788,1793,1765,1763,1822,1765,1822,1824,1739,1734,1792,1739,1792,1797,1711,332,1770,1264,1767,1826,1742,1738,1796,1742,1796,1800,1715,1709,1768,1715,1768,1774,1746,1743,1801,1746,1801,1804,1719,1713,1772,1719,1772,1777,1750,1747,1805,1750,1805,1808,1723,1717,1776,1723,1776,1781,1754,1751,1809,1754,1809,1812,1727,1722,1780,1727,1780,1785,1757,1755,1813,1757,1813,1816,1731,1726,1784,1731,1784,1789,1761,1759,1817,1761,1817,1820,1810,1807,1865,1810,1865,1868,1783,1778,1836,1783,1836,1841,1814,1811,1869,1814,1869,1872,1787,1782,1840,1787,1840,1845,1818,1815,1873,1818,1873,1876,1791,1786,1844,1791,1844,1849,1821,1819,1877,1821,1877,1880,1795,1790,1848,1795,1848,1853,1825,1823,1881,1825,1881,1884,1799,1794,1852,1799,1852,1857,1771,334,1830,1266,1827,1886,1802,1798,1856,1802,1856,1860,1775,1769,1828,1775,1828,1833,1806,1803,1861,1806,1861,1864,1779,1773,1832,1779,1832,1837,1885,1883,1941,1885,1941,1944,1859,1854,1912,1859,1912,1917,1831,336,1889,1268,1887,1945,1862,1858,1916,1862,1916,1920,1835,1829,1888,1835,1888,1893,1866,1863,1921,1866,1921,1924,1839,1834,1892,1839,1892,1897,1870,1867,1925,1870,1925,1928,1843,1838,1896,1843,1896,1901,1874,1871,1929,1874,1929,1932,1847,1842,1900,1847,1900,1905,1878,1875,1933,1878,1933,1936,1851,1846,1904,1851,1904,1909,1882,1879,1937,1882,1937,1940,1855,1850,1908,1855,1908,1913,1903,1898,0,1903,0,1957,1934,1931,21,1934,21,1968,1907,1902,1956,1907,1956,5,1938,1935,1969,1938,1969,1972,1911,1906,4,1911,4,1961,1942,1939,1973,1942,1973,1976,1915,1910,1960,1915,1960,9,1946,1943,1977,1946,1977,1980,1919,1914,8,1919,8,13,1891,338,1949,1270,1947,1981,1922,1918,12,1922,12,16,1895,1890,1948,1895,1948,1953,1926,1923,17,1926,17,1964,1899,1894,1952,1899,1952,1,1930,1927,1965,1930,1965,20 }; 
-
-uint32_t Suzanne_vtx_count = 1966;
-uint32_t Suzanne_idx_count = 2904;
-Vertex Suzanne_vtx[] = { Vertex{ { 0.4375,0.1640625,0.765625 }, 0.870622, { 0.20519929,-0.8205971,-0.53339815 }, 0.41035098 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.1640625,0.765625 }, 0.870622, { 0.35998145,-0.5088737,0.78195965 }, 0.41035098 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.1640625,0.765625 }, 0.870622, { 0.6649727,-0.20079176,0.7193705 }, 0.41035098 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.1640625,0.765625 }, 0.870622, { 0.79947704,-0.35098994,-0.487486 }, 0.41035098 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.1640625,0.765625 }, 0.868067, { -0.79947704,-0.35098994,-0.487486 }, 0.17848998 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.1640625,0.765625 }, 0.868067, { -0.6649727,-0.20079176,0.7193705 }, 0.17848998 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.1640625,0.765625 }, 0.868067, { -0.35998145,-0.5088737,0.78195965 }, 0.17848998 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.1640625,0.765625 }, 0.868067, { -0.20519929,-0.8205971,-0.53339815 }, 0.17848998 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.09375,0.6875 }, 0.860081, { 0.35998145,-0.5088737,0.78195965 }, 0.43988502 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.09375,0.6875 }, 0.860081, { 0.41552055,-0.7933392,0.44492203 }, 0.43988502 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.09375,0.6875 }, 0.860081, { 0.6649727,-0.20079176,0.7193705 }, 0.43988502 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.09375,0.6875 }, 0.860081, { 0.829423,-0.30360842,0.468913 }, 0.43988502 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.09375,0.6875 }, 0.856226, { -0.829423,-0.30360842,0.468913 }, 0.14945298 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.09375,0.6875 }, 0.856226, { -0.6649727,-0.20079176,0.7193705 }, 0.14945298 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.09375,0.6875 }, 0.856226, { -0.41552055,-0.7933392,0.44492203 }, 0.14945298 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.09375,0.6875 }, 0.856226, { -0.35998145,-0.5088737,0.78195965 }, 0.14945298 ,{ 1,1,1,1 } },Vertex{ { 0.546875,0.0546875,0.578125 }, 0.853018, { 0.41552055,-0.7933392,0.44492203 }, 0.47843802 ,{ 1,1,1,1 } },Vertex{ { 0.546875,0.0546875,0.578125 }, 0.853018, { 0.829423,-0.30360842,0.468913 }, 0.47843802 ,{ 1,1,1,1 } },Vertex{ { -0.546875,0.0546875,0.578125 }, 0.847458, { -0.829423,-0.30360842,0.468913 }, 0.11125201 ,{ 1,1,1,1 } },Vertex{ { -0.546875,0.0546875,0.578125 }, 0.847458, { -0.41552055,-0.7933392,0.44492203 }, 0.11125201 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,-0.0234375,0.6171875 }, 0.798481, { -0.2696051,-0.841316,0.46850887 }, 0.43046498 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,-0.0234375,0.6171875 }, 0.798481, { 0.41552055,-0.7933392,0.44492203 }, 0.43046498 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,-0.0234375,0.6171875 }, 0.795104, { -0.41552055,-0.7933392,0.44492203 }, 0.16159803 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,-0.0234375,0.6171875 }, 0.795104, { 0.2696051,-0.841316,0.46850887 }, 0.16159803 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.03125,0.71875 }, 0.8289, { -0.2696051,-0.841316,0.46850887 }, 0.40922898 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.03125,0.71875 }, 0.8289, { -0.078697614,-0.53938365,0.8383746 }, 0.40922898 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.03125,0.71875 }, 0.8289, { 0.35998145,-0.5088737,0.78195965 }, 0.40922898 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.03125,0.71875 }, 0.8289, { 0.41552055,-0.7933392,0.44492203 }, 0.40922898 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.03125,0.71875 }, 0.826436, { -0.41552055,-0.7933392,0.44492203 }, 0.181463 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.03125,0.71875 }, 0.826436, { -0.35998145,-0.5088737,0.78195965 }, 0.181463 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.03125,0.71875 }, 0.826436, { 0.078697614,-0.53938365,0.8383746 }, 0.181463 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.03125,0.71875 }, 0.826436, { 0.2696051,-0.841316,0.46850887 }, 0.181463 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1328125,0.78125 }, 0.854402, { -0.4223173,-0.78063196,-0.46071887 }, 0.39524603 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1328125,0.78125 }, 0.854402, { -0.078697614,-0.53938365,0.8383746 }, 0.39524603 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1328125,0.78125 }, 0.854402, { 0.20519929,-0.8205971,-0.53339815 }, 0.39524603 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1328125,0.78125 }, 0.854402, { 0.35998145,-0.5088737,0.78195965 }, 0.39524603 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1328125,0.78125 }, 0.852534, { -0.35998145,-0.5088737,0.78195965 }, 0.1943 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1328125,0.78125 }, 0.852534, { -0.20519929,-0.8205971,-0.53339815 }, 0.1943 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1328125,0.78125 }, 0.852534, { 0.078697614,-0.53938365,0.8383746 }, 0.1943 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1328125,0.78125 }, 0.852534, { 0.4223173,-0.78063196,-0.46071887 }, 0.1943 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.1640625,0.796875 }, 0.854107, { -0.8137308,-0.34871316,-0.4650176 }, 0.37454098 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.1640625,0.796875 }, 0.854107, { -0.46889296,-0.19399709,0.86168706 }, 0.37454098 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.1640625,0.796875 }, 0.854107, { -0.4223173,-0.78063196,-0.46071887 }, 0.37454098 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.1640625,0.796875 }, 0.854107, { -0.078697614,-0.53938365,0.8383746 }, 0.37454098 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.1640625,0.796875 }, 0.853157, { 0.078697614,-0.53938365,0.8383746 }, 0.214998 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.1640625,0.796875 }, 0.853157, { 0.4223173,-0.78063196,-0.46071887 }, 0.214998 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.1640625,0.796875 }, 0.853157, { 0.46889296,-0.19399709,0.86168706 }, 0.214998 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.1640625,0.796875 }, 0.853157, { 0.8137308,-0.34871316,-0.4650176 }, 0.214998 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.828171, { -0.7706608,-0.335183,0.54197246 }, 0.366646 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.828171, { -0.46889296,-0.19399709,0.86168706 }, 0.366646 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.828171, { -0.2696051,-0.841316,0.46850887 }, 0.366646 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.828171, { -0.078697614,-0.53938365,0.8383746 }, 0.366646 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.827598, { 0.078697614,-0.53938365,0.8383746 }, 0.22403598 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.827598, { 0.2696051,-0.841316,0.46850887 }, 0.22403598 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.827598, { 0.46889296,-0.19399709,0.86168706 }, 0.22403598 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.827598, { 0.7706608,-0.335183,0.54197246 }, 0.22403598 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.0546875,0.6484375 }, 0.791018, { -0.7706608,-0.335183,0.54197246 }, 0.35455698 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.0546875,0.6484375 }, 0.791018, { -0.2696051,-0.841316,0.46850887 }, 0.35455698 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.0546875,0.6484375 }, 0.791018, { 0.2696051,-0.841316,0.46850887 }, 0.23776197 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.0546875,0.6484375 }, 0.791018, { 0.7706608,-0.335183,0.54197246 }, 0.23776197 ,{ 1,1,1,1 } },Vertex{ { 0.078125,0.2421875,0.65625 }, 0.842358, { -0.7706608,-0.335183,0.54197246 }, 0.297509 ,{ 1,1,1,1 } },Vertex{ { 0.078125,0.2421875,0.65625 }, 0.842358, { -0.76722026,0.32640862,0.5521146 }, 0.297509 ,{ 1,1,1,1 } },Vertex{ { -0.078125,0.2421875,0.65625 }, 0.844839, { 0.76722026,0.32640862,0.5521146 }, 0.292475 ,{ 1,1,1,1 } },Vertex{ { -0.078125,0.2421875,0.65625 }, 0.844839, { 0.7706608,-0.335183,0.54197246 }, 0.292475 ,{ 1,1,1,1 } },Vertex{ { 0.140625,0.2421875,0.7421875 }, 0.855181, { -0.7706608,-0.335183,0.54197246 }, 0.331473 ,{ 1,1,1,1 } },Vertex{ { 0.140625,0.2421875,0.7421875 }, 0.855181, { -0.76722026,0.32640862,0.5521146 }, 0.331473 ,{ 1,1,1,1 } },Vertex{ { 0.140625,0.2421875,0.7421875 }, 0.855181, { -0.47671312,0.19070524,0.8581236 }, 0.331473 ,{ 1,1,1,1 } },Vertex{ { 0.140625,0.2421875,0.7421875 }, 0.855181, { -0.46889296,-0.19399709,0.86168706 }, 0.331473 ,{ 1,1,1,1 } },Vertex{ { -0.140625,0.2421875,0.7421875 }, 0.856142, { 0.46889296,-0.19399709,0.86168706 }, 0.25797498 ,{ 1,1,1,1 } },Vertex{ { -0.140625,0.2421875,0.7421875 }, 0.856142, { 0.47671312,0.19070524,0.8581236 }, 0.25797498 ,{ 1,1,1,1 } },Vertex{ { -0.140625,0.2421875,0.7421875 }, 0.856142, { 0.76722026,0.32640862,0.5521146 }, 0.25797498 ,{ 1,1,1,1 } },Vertex{ { -0.140625,0.2421875,0.7421875 }, 0.856142, { 0.7706608,-0.335183,0.54197246 }, 0.25797498 ,{ 1,1,1,1 } },Vertex{ { 0.2421875,0.2421875,0.796875 }, 0.867508, { -0.824052,0.3224812,-0.46577284 }, 0.357709 ,{ 1,1,1,1 } },Vertex{ { 0.2421875,0.2421875,0.796875 }, 0.867508, { -0.8137308,-0.34871316,-0.4650176 }, 0.357709 ,{ 1,1,1,1 } },Vertex{ { 0.2421875,0.2421875,0.796875 }, 0.867508, { -0.47671312,0.19070524,0.8581236 }, 0.357709 ,{ 1,1,1,1 } },Vertex{ { 0.2421875,0.2421875,0.796875 }, 0.867508, { -0.46889296,-0.19399709,0.86168706 }, 0.357709 ,{ 1,1,1,1 } },Vertex{ { -0.2421875,0.2421875,0.796875 }, 0.867293, { 0.46889296,-0.19399709,0.86168706 }, 0.23121798 ,{ 1,1,1,1 } },Vertex{ { -0.2421875,0.2421875,0.796875 }, 0.867293, { 0.47671312,0.19070524,0.8581236 }, 0.23121798 ,{ 1,1,1,1 } },Vertex{ { -0.2421875,0.2421875,0.796875 }, 0.867293, { 0.8137308,-0.34871316,-0.4650176 }, 0.23121798 ,{ 1,1,1,1 } },Vertex{ { -0.2421875,0.2421875,0.796875 }, 0.867293, { 0.824052,0.3224812,-0.46577284 }, 0.23121798 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.328125,0.796875 }, 0.890474, { -0.824052,0.3224812,-0.46577284 }, 0.358091 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.328125,0.796875 }, 0.890474, { -0.47671312,0.19070524,0.8581236 }, 0.358091 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.328125,0.796875 }, 0.890474, { -0.4223173,0.78063196,-0.46071887 }, 0.358091 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.328125,0.796875 }, 0.890474, { -0.094901934,0.5696116,0.8164167 }, 0.358091 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.328125,0.796875 }, 0.890219, { 0.094901934,0.5696116,0.8164167 }, 0.22981697 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.328125,0.796875 }, 0.890219, { 0.4223173,0.78063196,-0.46071887 }, 0.22981697 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.328125,0.796875 }, 0.890219, { 0.47671312,0.19070524,0.8581236 }, 0.22981697 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.328125,0.796875 }, 0.890219, { 0.824052,0.3224812,-0.46577284 }, 0.22981697 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.390625,0.7421875 }, 0.900375, { -0.76722026,0.32640862,0.5521146 }, 0.333036 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.390625,0.7421875 }, 0.900375, { -0.47671312,0.19070524,0.8581236 }, 0.333036 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.390625,0.7421875 }, 0.900375, { -0.25190452,0.8173147,0.5182093 }, 0.333036 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.390625,0.7421875 }, 0.900375, { -0.094901934,0.5696116,0.8164167 }, 0.333036 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.390625,0.7421875 }, 0.901223, { 0.094901934,0.5696116,0.8164167 }, 0.254408 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.390625,0.7421875 }, 0.901223, { 0.25190452,0.8173147,0.5182093 }, 0.254408 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.390625,0.7421875 }, 0.901223, { 0.47671312,0.19070524,0.8581236 }, 0.254408 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.390625,0.7421875 }, 0.901223, { 0.76722026,0.32640862,0.5521146 }, 0.254408 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.4375,0.6484375 }, 0.918898, { -0.76722026,0.32640862,0.5521146 }, 0.30030298 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.4375,0.6484375 }, 0.918898, { -0.25190452,0.8173147,0.5182093 }, 0.30030298 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.4375,0.6484375 }, 0.92118, { 0.25190452,0.8173147,0.5182093 }, 0.286287 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.4375,0.6484375 }, 0.92118, { 0.76722026,0.32640862,0.5521146 }, 0.286287 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.515625,0.6171875 }, 0.968392, { -0.25190452,0.8173147,0.5182093 }, 0.354667 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.515625,0.6171875 }, 0.968392, { 0.4141044,0.76720816,0.48980522 }, 0.354667 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.515625,0.6171875 }, 0.968213, { -0.4141044,0.76720816,0.48980522 }, 0.22978002 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.515625,0.6171875 }, 0.968213, { 0.25190452,0.8173147,0.5182093 }, 0.22978002 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.453125,0.71875 }, 0.931889, { -0.25190452,0.8173147,0.5182093 }, 0.363168 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.453125,0.71875 }, 0.931889, { -0.094901934,0.5696116,0.8164167 }, 0.363168 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.453125,0.71875 }, 0.931889, { 0.3667033,0.5370049,0.75970685 }, 0.363168 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.453125,0.71875 }, 0.931889, { 0.4141044,0.76720816,0.48980522 }, 0.363168 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.453125,0.71875 }, 0.931368, { -0.4141044,0.76720816,0.48980522 }, 0.222907 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.453125,0.71875 }, 0.931368, { -0.3667033,0.5370049,0.75970685 }, 0.222907 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.453125,0.71875 }, 0.931368, { 0.094901934,0.5696116,0.8164167 }, 0.222907 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.453125,0.71875 }, 0.931368, { 0.25190452,0.8173147,0.5182093 }, 0.222907 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.359375,0.78125 }, 0.905882, { -0.4223173,0.78063196,-0.46071887 }, 0.37209803 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.359375,0.78125 }, 0.905882, { -0.094901934,0.5696116,0.8164167 }, 0.37209803 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.359375,0.78125 }, 0.905882, { 0.20519929,0.8205971,-0.53339815 }, 0.37209803 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.359375,0.78125 }, 0.905882, { 0.3667033,0.5370049,0.75970685 }, 0.37209803 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.359375,0.78125 }, 0.90499, { -0.3667033,0.5370049,0.75970685 }, 0.21513999 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.359375,0.78125 }, 0.90499, { -0.20519929,0.8205971,-0.53339815 }, 0.21513999 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.359375,0.78125 }, 0.90499, { 0.094901934,0.5696116,0.8164167 }, 0.21513999 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.359375,0.78125 }, 0.90499, { 0.4223173,0.78063196,-0.46071887 }, 0.21513999 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.328125,0.765625 }, 0.906232, { 0.20519929,0.8205971,-0.53339815 }, 0.39425802 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.328125,0.765625 }, 0.906232, { 0.3667033,0.5370049,0.75970685 }, 0.39425802 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.328125,0.765625 }, 0.906232, { 0.6712992,0.19709976,0.7144992 }, 0.39425802 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.328125,0.765625 }, 0.906232, { 0.81110185,0.32440075,-0.4867011 }, 0.39425802 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.328125,0.765625 }, 0.904357, { -0.81110185,0.32440075,-0.4867011 }, 0.19298702 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.328125,0.765625 }, 0.904357, { -0.6712992,0.19709976,0.7144992 }, 0.19298702 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.328125,0.765625 }, 0.904357, { -0.3667033,0.5370049,0.75970685 }, 0.19298702 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.328125,0.765625 }, 0.904357, { -0.20519929,0.8205971,-0.53339815 }, 0.19298702 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.390625,0.6875 }, 0.933717, { 0.3667033,0.5370049,0.75970685 }, 0.406963 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.390625,0.6875 }, 0.933717, { 0.4141044,0.76720816,0.48980522 }, 0.406963 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.390625,0.6875 }, 0.933717, { 0.6712992,0.19709976,0.7144992 }, 0.406963 ,{ 1,1,1,1 } },Vertex{ { 0.5,0.390625,0.6875 }, 0.933717, { 0.8277601,0.29522142,0.47713464 }, 0.406963 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.390625,0.6875 }, 0.93125, { -0.8277601,0.29522142,0.47713464 }, 0.17907399 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.390625,0.6875 }, 0.93125, { -0.6712992,0.19709976,0.7144992 }, 0.17907399 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.390625,0.6875 }, 0.93125, { -0.4141044,0.76720816,0.48980522 }, 0.17907399 ,{ 1,1,1,1 } },Vertex{ { -0.5,0.390625,0.6875 }, 0.93125, { -0.3667033,0.5370049,0.75970685 }, 0.17907399 ,{ 1,1,1,1 } },Vertex{ { 0.546875,0.4375,0.578125 }, 0.968392, { 0.4141044,0.76720816,0.48980522 }, 0.426188 ,{ 1,1,1,1 } },Vertex{ { 0.546875,0.4375,0.578125 }, 0.968392, { 0.8277601,0.29522142,0.47713464 }, 0.426188 ,{ 1,1,1,1 } },Vertex{ { -0.546875,0.4375,0.578125 }, 0.965038, { -0.8277601,0.29522142,0.47713464 }, 0.15832901 ,{ 1,1,1,1 } },Vertex{ { -0.546875,0.4375,0.578125 }, 0.965038, { -0.4141044,0.76720816,0.48980522 }, 0.15832901 ,{ 1,1,1,1 } },Vertex{ { 0.625,0.2421875,0.5625 }, 0.920166, { 0.8277601,0.29522142,0.47713464 }, 0.47545397 ,{ 1,1,1,1 } },Vertex{ { 0.625,0.2421875,0.5625 }, 0.920166, { 0.829423,-0.30360842,0.468913 }, 0.47545397 ,{ 1,1,1,1 } },Vertex{ { -0.625,0.2421875,0.5625 }, 0.914672, { -0.829423,-0.30360842,0.468913 }, 0.11125201 ,{ 1,1,1,1 } },Vertex{ { -0.625,0.2421875,0.5625 }, 0.914672, { -0.8277601,0.29522142,0.47713464 }, 0.11125201 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.2421875,0.671875 }, 0.904571, { 0.6649727,-0.20079176,0.7193705 }, 0.44059598 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.2421875,0.671875 }, 0.904571, { 0.6712992,0.19709976,0.7144992 }, 0.44059598 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.2421875,0.671875 }, 0.904571, { 0.8277601,0.29522142,0.47713464 }, 0.44059598 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.2421875,0.671875 }, 0.904571, { 0.829423,-0.30360842,0.468913 }, 0.44059598 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.2421875,0.671875 }, 0.90064, { -0.829423,-0.30360842,0.468913 }, 0.14676797 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.2421875,0.671875 }, 0.90064, { -0.8277601,0.29522142,0.47713464 }, 0.14676797 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.2421875,0.671875 }, 0.90064, { -0.6712992,0.19709976,0.7144992 }, 0.14676797 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.2421875,0.671875 }, 0.90064, { -0.6649727,-0.20079176,0.7193705 }, 0.14676797 ,{ 1,1,1,1 } },Vertex{ { 0.46875,0.2421875,0.7578125 }, 0.890955, { 0.6649727,-0.20079176,0.7193705 }, 0.40993702 ,{ 1,1,1,1 } },Vertex{ { 0.46875,0.2421875,0.7578125 }, 0.890955, { 0.6712992,0.19709976,0.7144992 }, 0.40993702 ,{ 1,1,1,1 } },Vertex{ { 0.46875,0.2421875,0.7578125 }, 0.890955, { 0.79947704,-0.35098994,-0.487486 }, 0.40993702 ,{ 1,1,1,1 } },Vertex{ { 0.46875,0.2421875,0.7578125 }, 0.890955, { 0.81110185,0.32440075,-0.4867011 }, 0.40993702 ,{ 1,1,1,1 } },Vertex{ { -0.46875,0.2421875,0.7578125 }, 0.888398, { -0.81110185,0.32440075,-0.4867011 }, 0.17800099 ,{ 1,1,1,1 } },Vertex{ { -0.46875,0.2421875,0.7578125 }, 0.888398, { -0.79947704,-0.35098994,-0.487486 }, 0.17800099 ,{ 1,1,1,1 } },Vertex{ { -0.46875,0.2421875,0.7578125 }, 0.888398, { -0.6712992,0.19709976,0.7144992 }, 0.17800099 ,{ 1,1,1,1 } },Vertex{ { -0.46875,0.2421875,0.7578125 }, 0.888398, { -0.6649727,-0.20079176,0.7193705 }, 0.17800099 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.2421875,0.7734375 }, 0.889591, { 0.39999828,-0.062299732,0.91439605 }, 0.406725 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.2421875,0.7734375 }, 0.889591, { 0.4001784,0.05719691,0.91465056 }, 0.406725 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.2421875,0.7734375 }, 0.889591, { 0.79947704,-0.35098994,-0.487486 }, 0.406725 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.2421875,0.7734375 }, 0.889591, { 0.81110185,0.32440075,-0.4867011 }, 0.406725 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.2421875,0.7734375 }, 0.887178, { -0.81110185,0.32440075,-0.4867011 }, 0.18127102 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.2421875,0.7734375 }, 0.887178, { -0.79947704,-0.35098994,-0.487486 }, 0.18127102 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.2421875,0.7734375 }, 0.887178, { -0.4001784,0.05719691,0.91465056 }, 0.18127102 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.2421875,0.7734375 }, 0.887178, { -0.39999828,-0.062299732,0.91439605 }, 0.18127102 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.3359375,0.78125 }, 0.902359, { 0.20519929,0.8205971,-0.53339815 }, 0.39209098 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.3359375,0.78125 }, 0.902359, { 0.30359954,0.16559975,0.9382986 }, 0.39209098 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.3359375,0.78125 }, 0.902359, { 0.4001784,0.05719691,0.91465056 }, 0.39209098 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.3359375,0.78125 }, 0.902359, { 0.81110185,0.32440075,-0.4867011 }, 0.39209098 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.3359375,0.78125 }, 0.900583, { -0.81110185,0.32440075,-0.4867011 }, 0.19532299 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.3359375,0.78125 }, 0.900583, { -0.4001784,0.05719691,0.91465056 }, 0.19532299 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.3359375,0.78125 }, 0.900583, { -0.30359954,0.16559975,0.9382986 }, 0.19532299 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.3359375,0.78125 }, 0.900583, { -0.20519929,0.8205971,-0.53339815 }, 0.19532299 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.375,0.8046875 }, 0.899781, { -0.4223173,0.78063196,-0.46071887 }, 0.373743 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.375,0.8046875 }, 0.899781, { 0.09959908,0.1728984,0.9798909 }, 0.373743 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.375,0.8046875 }, 0.899781, { 0.20519929,0.8205971,-0.53339815 }, 0.373743 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.375,0.8046875 }, 0.899781, { 0.30359954,0.16559975,0.9382986 }, 0.373743 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.375,0.8046875 }, 0.898822, { -0.30359954,0.16559975,0.9382986 }, 0.21376699 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.375,0.8046875 }, 0.898822, { -0.20519929,0.8205971,-0.53339815 }, 0.21376699 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.375,0.8046875 }, 0.898822, { -0.09959908,0.1728984,0.9798909 }, 0.21376699 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.375,0.8046875 }, 0.898822, { 0.4223173,0.78063196,-0.46071887 }, 0.21376699 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.3359375,0.8203125 }, 0.887842, { -0.824052,0.3224812,-0.46577284 }, 0.363473 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.3359375,0.8203125 }, 0.887842, { -0.4223173,0.78063196,-0.46071887 }, 0.363473 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.3359375,0.8203125 }, 0.887842, { -0.06240078,0.026000326,0.9977125 }, 0.363473 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.3359375,0.8203125 }, 0.887842, { 0.09959908,0.1728984,0.9798909 }, 0.363473 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.3359375,0.8203125 }, 0.887351, { -0.09959908,0.1728984,0.9798909 }, 0.224558 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.3359375,0.8203125 }, 0.887351, { 0.06240078,0.026000326,0.9977125 }, 0.224558 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.3359375,0.8203125 }, 0.887351, { 0.4223173,0.78063196,-0.46071887 }, 0.224558 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.3359375,0.8203125 }, 0.887351, { 0.824052,0.3224812,-0.46577284 }, 0.224558 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.2421875,0.8203125 }, 0.870908, { -0.824052,0.3224812,-0.46577284 }, 0.36475497 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.2421875,0.8203125 }, 0.870908, { -0.8137308,-0.34871316,-0.4650176 }, 0.36475497 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.2421875,0.8203125 }, 0.870908, { -0.06240078,0.026000326,0.9977125 }, 0.36475497 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.2421875,0.8203125 }, 0.870908, { -0.06239688,-0.028298587,0.99765015 }, 0.36475497 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.2421875,0.8203125 }, 0.870376, { 0.06239688,-0.028298587,0.99765015 }, 0.22402799 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.2421875,0.8203125 }, 0.870376, { 0.06240078,0.026000326,0.9977125 }, 0.22402799 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.2421875,0.8203125 }, 0.870376, { 0.8137308,-0.34871316,-0.4650176 }, 0.22402799 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.2421875,0.8203125 }, 0.870376, { 0.824052,0.3224812,-0.46577284 }, 0.22402799 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.15625,0.8203125 }, 0.859881, { -0.8137308,-0.34871316,-0.4650176 }, 0.37605798 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.15625,0.8203125 }, 0.859881, { -0.4223173,-0.78063196,-0.46071887 }, 0.37605798 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.15625,0.8203125 }, 0.859881, { -0.06239688,-0.028298587,0.99765015 }, 0.37605798 ,{ 1,1,1,1 } },Vertex{ { 0.265625,0.15625,0.8203125 }, 0.859881, { 0.09449694,-0.18349408,0.9784684 }, 0.37605798 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.15625,0.8203125 }, 0.858859, { -0.09449694,-0.18349408,0.9784684 }, 0.21322602 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.15625,0.8203125 }, 0.858859, { 0.06239688,-0.028298587,0.99765015 }, 0.21322602 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.15625,0.8203125 }, 0.858859, { 0.4223173,-0.78063196,-0.46071887 }, 0.21322602 ,{ 1,1,1,1 } },Vertex{ { -0.265625,0.15625,0.8203125 }, 0.858859, { 0.8137308,-0.34871316,-0.4650176 }, 0.21322602 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { -0.06240078,0.026000326,0.9977125 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { -0.06239688,-0.028298587,0.99765015 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { 0.09449694,-0.18349408,0.9784684 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { 0.09959908,0.1728984,0.9798909 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { 0.30359954,0.16559975,0.9382986 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { 0.30691135,-0.1754065,0.93543464 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { 0.39999828,-0.062299732,0.91439605 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.2421875,0.828125 }, 0.8794, { 0.4001784,0.05719691,0.91465056 }, 0.383488 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { -0.4001784,0.05719691,0.91465056 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { -0.39999828,-0.062299732,0.91439605 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { -0.30691135,-0.1754065,0.93543464 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { -0.30359954,0.16559975,0.9382986 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { -0.09959908,0.1728984,0.9798909 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { -0.09449694,-0.18349408,0.9784684 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { 0.06239688,-0.028298587,0.99765015 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.2421875,0.828125 }, 0.878029, { 0.06240078,0.026000326,0.9977125 }, 0.20493698 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1171875,0.8046875 }, 0.859664, { -0.4223173,-0.78063196,-0.46071887 }, 0.391814 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1171875,0.8046875 }, 0.859664, { 0.09449694,-0.18349408,0.9784684 }, 0.391814 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1171875,0.8046875 }, 0.859664, { 0.20519929,-0.8205971,-0.53339815 }, 0.391814 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,0.1171875,0.8046875 }, 0.859664, { 0.30691135,-0.1754065,0.93543464 }, 0.391814 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1171875,0.8046875 }, 0.857942, { -0.30691135,-0.1754065,0.93543464 }, 0.19749498 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1171875,0.8046875 }, 0.857942, { -0.20519929,-0.8205971,-0.53339815 }, 0.19749498 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1171875,0.8046875 }, 0.857942, { -0.09449694,-0.18349408,0.9784684 }, 0.19749498 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,0.1171875,0.8046875 }, 0.857942, { 0.4223173,-0.78063196,-0.46071887 }, 0.19749498 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.15625,0.78125 }, 0.871664, { 0.20519929,-0.8205971,-0.53339815 }, 0.406039 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.15625,0.78125 }, 0.871664, { 0.30691135,-0.1754065,0.93543464 }, 0.406039 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.15625,0.78125 }, 0.871664, { 0.39999828,-0.062299732,0.91439605 }, 0.406039 ,{ 1,1,1,1 } },Vertex{ { 0.4453125,0.15625,0.78125 }, 0.871664, { 0.79947704,-0.35098994,-0.487486 }, 0.406039 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.15625,0.78125 }, 0.869299, { -0.79947704,-0.35098994,-0.487486 }, 0.182751 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.15625,0.78125 }, 0.869299, { -0.39999828,-0.062299732,0.91439605 }, 0.182751 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.15625,0.78125 }, 0.869299, { -0.30691135,-0.1754065,0.93543464 }, 0.182751 ,{ 1,1,1,1 } },Vertex{ { -0.4453125,0.15625,0.78125 }, 0.869299, { -0.20519929,-0.8205971,-0.53339815 }, 0.182751 ,{ 1,1,1,1 } },Vertex{ { 0,0.4296875,0.7421875 }, 0.521923, { -0.5880126,0.5554119,0.5880126 }, 0.613991 ,{ 1,1,1,1 } },Vertex{ { 0,0.4296875,0.7421875 }, 0.521923, { -0.53060406,0.8111062,-0.24610187 }, 0.613991 ,{ 1,1,1,1 } },Vertex{ { 0,0.4296875,0.7421875 }, 0.521923, { 0.53060406,0.8111062,-0.24610187 }, 0.613991 ,{ 1,1,1,1 } },Vertex{ { 0,0.4296875,0.7421875 }, 0.521923, { 0.5880126,0.5554119,0.5880126 }, 0.613991 ,{ 1,1,1,1 } },Vertex{ { 0,0.3515625,0.8203125 }, 0.521086, { -0.5880126,0.5554119,0.5880126 }, 0.656132 ,{ 1,1,1,1 } },Vertex{ { 0,0.3515625,0.8203125 }, 0.521086, { -0.39609417,-0.43209362,0.810188 }, 0.656132 ,{ 1,1,1,1 } },Vertex{ { 0,0.3515625,0.8203125 }, 0.521086, { -0.18559489,-0.24739319,0.9509738 }, 0.656132 ,{ 1,1,1,1 } },Vertex{ { 0,0.3515625,0.8203125 }, 0.521086, { 0.18559489,-0.24739319,0.9509738 }, 0.656132 ,{ 1,1,1,1 } },Vertex{ { 0,0.3515625,0.8203125 }, 0.521086, { 0.39609417,-0.43209362,0.810188 }, 0.656132 ,{ 1,1,1,1 } },Vertex{ { 0,0.3515625,0.8203125 }, 0.521086, { 0.5880126,0.5554119,0.5880126 }, 0.656132 ,{ 1,1,1,1 } },Vertex{ { 0,-0.6796875,0.734375 }, 0.518925, { -0.0026001106,-0.065602794,0.99784243 }, 0.906048 ,{ 1,1,1,1 } },Vertex{ { 0,-0.6796875,0.734375 }, 0.518925, { 0,0,1 }, 0.906048 ,{ 1,1,1,1 } },Vertex{ { 0,-0.6796875,0.734375 }, 0.518925, { 0.0026001106,-0.065602794,0.99784243 }, 0.906048 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3203125,0.78125 }, 0.518998, { -0.42068827,-0.87967545,0.22179382 }, 0.840972 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3203125,0.78125 }, 0.518998, { -0.2872947,-0.5746894,0.76628584 }, 0.840972 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3203125,0.78125 }, 0.518998, { 0.2872947,-0.5746894,0.76628584 }, 0.840972 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3203125,0.78125 }, 0.518998, { 0.42068827,-0.87967545,0.22179382 }, 0.840972 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1875,0.796875 }, 0.519132, { -0.8836127,0.3555051,0.30470437 }, 0.814618 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1875,0.796875 }, 0.519132, { -0.65419173,0.60189235,0.45799422 }, 0.814618 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1875,0.796875 }, 0.519132, { 0.65419173,0.60189235,0.45799422 }, 0.814618 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1875,0.796875 }, 0.519132, { 0.8836127,0.3555051,0.30470437 }, 0.814618 ,{ 1,1,1,1 } },Vertex{ { 0,-0.7734375,0.71875 }, 0.518925, { -0.30509105,-0.9449723,0.11809654 }, 0.916135 ,{ 1,1,1,1 } },Vertex{ { 0,-0.7734375,0.71875 }, 0.518925, { -0.2237087,-0.6539255,0.72272813 }, 0.916135 ,{ 1,1,1,1 } },Vertex{ { 0,-0.7734375,0.71875 }, 0.518925, { 0.2237087,-0.6539255,0.72272813 }, 0.916135 ,{ 1,1,1,1 } },Vertex{ { 0,-0.7734375,0.71875 }, 0.518925, { 0.30509105,-0.9449723,0.11809654 }, 0.916135 ,{ 1,1,1,1 } },Vertex{ { 0,0.40625,0.6015625 }, 0.523031, { -0.53060406,0.8111062,-0.24610187 }, 0.56637204 ,{ 1,1,1,1 } },Vertex{ { 0,0.40625,0.6015625 }, 0.819845, { -0.16160282,0.18470323,0.969417 }, 0.531929 ,{ 1,1,1,1 } },Vertex{ { 0,0.40625,0.6015625 }, 0.215894, { 0.16160282,0.18470323,0.969417 }, 0.496395 ,{ 1,1,1,1 } },Vertex{ { 0,0.40625,0.6015625 }, 0.523031, { 0.53060406,0.8111062,-0.24610187 }, 0.56637204 ,{ 1,1,1,1 } },Vertex{ { 0,0.5703125,0.5703125 }, 0.185281, { -0.22701113,0.57402813,0.7867386 }, 0.51590097 ,{ 1,1,1,1 } },Vertex{ { 0,0.5703125,0.5703125 }, 0.845499, { -0.16160282,0.18470323,0.969417 }, 0.550033 ,{ 1,1,1,1 } },Vertex{ { 0,0.5703125,0.5703125 }, 0.185281, { -0.04249845,0.91496664,0.40128538 }, 0.51590097 ,{ 1,1,1,1 } },Vertex{ { 0,0.5703125,0.5703125 }, 0.845499, { 0.04249845,0.91496664,0.40128538 }, 0.550033 ,{ 1,1,1,1 } },Vertex{ { 0,0.5703125,0.5703125 }, 0.185281, { 0.16160282,0.18470323,0.969417 }, 0.51590097 ,{ 1,1,1,1 } },Vertex{ { 0,0.5703125,0.5703125 }, 0.845499, { 0.22701113,0.57402813,0.7867386 }, 0.550033 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,-0.546875 }, 0.000144, { -0.34921232,0.5947209,-0.7241255 }, 0.740887 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,-0.546875 }, 0.000144, { -0.12750168,0.97441286,-0.18510245 }, 0.740887 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,-0.546875 }, 0.999856, { 0.12750168,0.97441286,-0.18510245 }, 0.74536 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,-0.546875 }, 0.999856, { 0.34921232,0.5947209,-0.7241255 }, 0.74536 ,{ 1,1,1,1 } },Vertex{ { 0,0.5625,-0.8515625 }, 0.011829, { -0.34921232,0.5947209,-0.7241255 }, 0.844633 ,{ 1,1,1,1 } },Vertex{ { 0,0.5625,-0.8515625 }, 0.011829, { -0.34489003,-0.11579665,-0.931473 }, 0.844633 ,{ 1,1,1,1 } },Vertex{ { 0,0.5625,-0.8515625 }, 0.994525, { 0.34489003,-0.11579665,-0.931473 }, 0.832295 ,{ 1,1,1,1 } },Vertex{ { 0,0.5625,-0.8515625 }, 0.994525, { 0.34921232,0.5947209,-0.7241255 }, 0.832295 ,{ 1,1,1,1 } },Vertex{ { 0,0.0703125,-0.828125 }, 0.078961, { -0.3707877,-0.47328433,-0.7990735 }, 0.939281 ,{ 1,1,1,1 } },Vertex{ { 0,0.0703125,-0.828125 }, 0.078961, { -0.34489003,-0.11579665,-0.931473 }, 0.939281 ,{ 1,1,1,1 } },Vertex{ { 0,0.0703125,-0.828125 }, 0.9459, { 0.34489003,-0.11579665,-0.931473 }, 0.920431 ,{ 1,1,1,1 } },Vertex{ { 0,0.0703125,-0.828125 }, 0.9459, { 0.3707877,-0.47328433,-0.7990735 }, 0.920431 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3828125,-0.3515625 }, 0.232648, { -0.31070977,-0.82842606,-0.46601465 }, 0.996516 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3828125,-0.3515625 }, 0.232648, { -0.27931055,-0.95153594,-0.12870486 }, 0.996516 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3828125,-0.3515625 }, 0.805584, { 0.27931055,-0.95153594,-0.12870486 }, 0.989214 ,{ 1,1,1,1 } },Vertex{ { 0,-0.3828125,-0.3515625 }, 0.805584, { 0.31070977,-0.82842606,-0.46601465 }, 0.989214 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.1875,0.5625 }, 0.605512, { 0.17609406,-0.88047034,-0.44018516 }, 0.834866 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.1875,0.5625 }, 0.605512, { 0.32409102,-0.8187773,0.47388688 }, 0.834866 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.1875,0.5625 }, 0.605512, { 0.9384765,0.16009599,0.30599234 }, 0.834866 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.1875,0.5625 }, 0.605512, { 0.940689,0.33379608,-0.06069929 }, 0.834866 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.1875,0.5625 }, 0.432024, { -0.940689,0.33379608,-0.06069929 }, 0.834356 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.1875,0.5625 }, 0.432024, { -0.9384765,0.16009599,0.30599234 }, 0.834356 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.1875,0.5625 }, 0.432024, { -0.32409102,-0.8187773,0.47388688 }, 0.834356 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.1875,0.5625 }, 0.432024, { -0.17609406,-0.88047034,-0.44018516 }, 0.834356 ,{ 1,1,1,1 } },Vertex{ { 0.3125,-0.4375,0.5703125 }, 0.583135, { 0.77963734,0.09000431,0.6197297 }, 0.891505 ,{ 1,1,1,1 } },Vertex{ { 0.3125,-0.4375,0.5703125 }, 0.583135, { 0.81228685,0.3009951,0.4995919 }, 0.891505 ,{ 1,1,1,1 } },Vertex{ { 0.3125,-0.4375,0.5703125 }, 0.583135, { 0.9120182,0.33760673,-0.23290463 }, 0.891505 ,{ 1,1,1,1 } },Vertex{ { 0.3125,-0.4375,0.5703125 }, 0.583135, { 0.91961956,0.13790293,-0.36780784 }, 0.891505 ,{ 1,1,1,1 } },Vertex{ { -0.3125,-0.4375,0.5703125 }, 0.454527, { -0.91961956,0.13790293,-0.36780784 }, 0.891519 ,{ 1,1,1,1 } },Vertex{ { -0.3125,-0.4375,0.5703125 }, 0.454527, { -0.9120182,0.33760673,-0.23290463 }, 0.891519 ,{ 1,1,1,1 } },Vertex{ { -0.3125,-0.4375,0.5703125 }, 0.454527, { -0.81228685,0.3009951,0.4995919 }, 0.891519 ,{ 1,1,1,1 } },Vertex{ { -0.3125,-0.4375,0.5703125 }, 0.454527, { -0.77963734,0.09000431,0.6197297 }, 0.891519 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,-0.6953125,0.5703125 }, 0.563812, { 0.7688822,-0.05059883,0.63738525 }, 0.923414 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,-0.6953125,0.5703125 }, 0.563812, { 0.77963734,0.09000431,0.6197297 }, 0.923414 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,-0.6953125,0.5703125 }, 0.563812, { 0.91961956,0.13790293,-0.36780784 }, 0.923414 ,{ 1,1,1,1 } },Vertex{ { 0.3515625,-0.6953125,0.5703125 }, 0.563812, { 0.93186295,0.16289352,-0.3241871 }, 0.923414 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,-0.6953125,0.5703125 }, 0.474014, { -0.93186295,0.16289352,-0.3241871 }, 0.923489 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,-0.6953125,0.5703125 }, 0.474014, { -0.91961956,0.13790293,-0.36780784 }, 0.923489 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,-0.6953125,0.5703125 }, 0.474014, { -0.77963734,0.09000431,0.6197297 }, 0.923489 ,{ 1,1,1,1 } },Vertex{ { -0.3515625,-0.6953125,0.5703125 }, 0.474014, { -0.7688822,-0.05059883,0.63738525 }, 0.923489 ,{ 1,1,1,1 } },Vertex{ { 0.3671875,-0.890625,0.53125 }, 0.555073, { 0.59020495,-0.4550038,0.66680557 }, 0.9381 ,{ 1,1,1,1 } },Vertex{ { 0.3671875,-0.890625,0.53125 }, 0.555073, { 0.7688822,-0.05059883,0.63738525 }, 0.9381 ,{ 1,1,1,1 } },Vertex{ { 0.3671875,-0.890625,0.53125 }, 0.555073, { 0.93186295,0.16289352,-0.3241871 }, 0.9381 ,{ 1,1,1,1 } },Vertex{ { 0.3671875,-0.890625,0.53125 }, 0.555073, { 0.9597264,-0.008500234,-0.28080773 }, 0.9381 ,{ 1,1,1,1 } },Vertex{ { -0.3671875,-0.890625,0.53125 }, 0.482805, { -0.9597264,-0.008500234,-0.28080773 }, 0.938171 ,{ 1,1,1,1 } },Vertex{ { -0.3671875,-0.890625,0.53125 }, 0.482805, { -0.93186295,0.16289352,-0.3241871 }, 0.938171 ,{ 1,1,1,1 } },Vertex{ { -0.3671875,-0.890625,0.53125 }, 0.482805, { -0.7688822,-0.05059883,0.63738525 }, 0.938171 ,{ 1,1,1,1 } },Vertex{ { -0.3671875,-0.890625,0.53125 }, 0.482805, { -0.59020495,-0.4550038,0.66680557 }, 0.938171 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9453125,0.5234375 }, 0.55193, { 0.11840059,-0.96690476,-0.22600111 }, 0.941662 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9453125,0.5234375 }, 0.55193, { 0.21900316,-0.8647125,0.45200652 }, 0.941662 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9453125,0.5234375 }, 0.55193, { 0.59020495,-0.4550038,0.66680557 }, 0.941662 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9453125,0.5234375 }, 0.55193, { 0.9597264,-0.008500234,-0.28080773 }, 0.941662 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9453125,0.5234375 }, 0.485955, { -0.9597264,-0.008500234,-0.28080773 }, 0.941727 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9453125,0.5234375 }, 0.485955, { -0.59020495,-0.4550038,0.66680557 }, 0.941727 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9453125,0.5234375 }, 0.485955, { -0.21900316,-0.8647125,0.45200652 }, 0.941727 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9453125,0.5234375 }, 0.485955, { -0.11840059,-0.96690476,-0.22600111 }, 0.941727 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.96875,0.5546875 }, 0.54026, { 0.115199685,-0.98359734,-0.13879961 }, 0.946195 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.96875,0.5546875 }, 0.54026, { 0.11840059,-0.96690476,-0.22600111 }, 0.946195 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.96875,0.5546875 }, 0.54026, { 0.1231021,-0.86161464,0.4924084 }, 0.946195 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.96875,0.5546875 }, 0.54026, { 0.21900316,-0.8647125,0.45200652 }, 0.946195 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.96875,0.5546875 }, 0.497626, { -0.21900316,-0.8647125,0.45200652 }, 0.94623 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.96875,0.5546875 }, 0.497626, { -0.1231021,-0.86161464,0.4924084 }, 0.94623 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.96875,0.5546875 }, 0.497626, { -0.11840059,-0.96690476,-0.22600111 }, 0.94623 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.96875,0.5546875 }, 0.497626, { -0.115199685,-0.98359734,-0.13879961 }, 0.94623 ,{ 1,1,1,1 } },Vertex{ { 0,-0.984375,0.578125 }, 0.518916, { -0.1231021,-0.86161464,0.4924084 }, 0.949706 ,{ 1,1,1,1 } },Vertex{ { 0,-0.984375,0.578125 }, 0.518916, { -0.115199685,-0.98359734,-0.13879961 }, 0.949706 ,{ 1,1,1,1 } },Vertex{ { 0,-0.984375,0.578125 }, 0.518916, { 0.115199685,-0.98359734,-0.13879961 }, 0.949706 ,{ 1,1,1,1 } },Vertex{ { 0,-0.984375,0.578125 }, 0.518916, { 0.1231021,-0.86161464,0.4924084 }, 0.949706 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.140625,0.53125 }, 0.647395, { 0.17609406,-0.88047034,-0.44018516 }, 0.799498 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.140625,0.53125 }, 0.647395, { 0.32409102,-0.8187773,0.47388688 }, 0.799498 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.140625,0.53125 }, 0.647395, { 0.38488582,-0.81307006,-0.4367839 }, 0.799498 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.140625,0.53125 }, 0.647395, { 0.3857039,-0.6629067,0.6417065 }, 0.799498 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.140625,0.53125 }, 0.389677, { -0.3857039,-0.6629067,0.6417065 }, 0.79811 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.140625,0.53125 }, 0.389677, { -0.38488582,-0.81307006,-0.4367839 }, 0.79811 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.140625,0.53125 }, 0.389677, { -0.32409102,-0.8187773,0.47388688 }, 0.79811 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.140625,0.53125 }, 0.389677, { -0.17609406,-0.88047034,-0.44018516 }, 0.79811 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,-0.0390625,0.5390625 }, 0.676379, { 0.38488582,-0.81307006,-0.4367839 }, 0.766759 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,-0.0390625,0.5390625 }, 0.676379, { 0.3857039,-0.6629067,0.6417065 }, 0.766759 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,-0.0390625,0.5390625 }, 0.676379, { 0.534193,-0.7232905,-0.43759423 }, 0.766759 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,-0.0390625,0.5390625 }, 0.676379, { 0.6894893,-0.4192935,0.59059083 }, 0.766759 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,-0.0390625,0.5390625 }, 0.360308, { -0.6894893,-0.4192935,0.59059083 }, 0.764101 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,-0.0390625,0.5390625 }, 0.360308, { -0.534193,-0.7232905,-0.43759423 }, 0.764101 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,-0.0390625,0.5390625 }, 0.360308, { -0.3857039,-0.6629067,0.6417065 }, 0.764101 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,-0.0390625,0.5390625 }, 0.360308, { -0.38488582,-0.81307006,-0.4367839 }, 0.764101 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.1484375,0.4453125 }, 0.715342, { 0.534193,-0.7232905,-0.43759423 }, 0.734608 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.1484375,0.4453125 }, 0.715342, { 0.6587689,-0.36338285,0.6587689 }, 0.734608 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.1484375,0.4453125 }, 0.715342, { 0.6894893,-0.4192935,0.59059083 }, 0.734608 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.1484375,0.4453125 }, 0.715342, { 0.85611546,0.13400242,-0.49910897 }, 0.734608 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.1484375,0.4453125 }, 0.320452, { -0.85611546,0.13400242,-0.49910897 }, 0.729697 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.1484375,0.4453125 }, 0.320452, { -0.6894893,-0.4192935,0.59059083 }, 0.729697 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.1484375,0.4453125 }, 0.320452, { -0.6587689,-0.36338285,0.6587689 }, 0.729697 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.1484375,0.4453125 }, 0.320452, { -0.534193,-0.7232905,-0.43759423 }, 0.729697 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.4296875,0.59375 }, 0.707254, { 0.28210953,0.915131,-0.28800973 }, 0.689946 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.4296875,0.59375 }, 0.707254, { 0.54651874,0.3707127,0.75092566 }, 0.689946 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.4296875,0.59375 }, 0.707254, { 0.6587689,-0.36338285,0.6587689 }, 0.689946 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.4296875,0.59375 }, 0.707254, { 0.85611546,0.13400242,-0.49910897 }, 0.689946 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.4296875,0.59375 }, 0.330721, { -0.85611546,0.13400242,-0.49910897 }, 0.683147 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.4296875,0.59375 }, 0.330721, { -0.6587689,-0.36338285,0.6587689 }, 0.683147 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.4296875,0.59375 }, 0.330721, { -0.54651874,0.3707127,0.75092566 }, 0.683147 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.4296875,0.59375 }, 0.330721, { -0.28210953,0.915131,-0.28800973 }, 0.683147 ,{ 1,1,1,1 } },Vertex{ { 0.7109375,0.484375,0.625 }, 0.697446, { 0.28210953,0.915131,-0.28800973 }, 0.667327 ,{ 1,1,1,1 } },Vertex{ { 0.7109375,0.484375,0.625 }, 0.697446, { 0.36849314,0.87578374,-0.3117942 }, 0.667327 ,{ 1,1,1,1 } },Vertex{ { 0.7109375,0.484375,0.625 }, 0.697446, { 0.5064359,0.6464458,0.5706404 }, 0.667327 ,{ 1,1,1,1 } },Vertex{ { 0.7109375,0.484375,0.625 }, 0.697446, { 0.54651874,0.3707127,0.75092566 }, 0.667327 ,{ 1,1,1,1 } },Vertex{ { -0.7109375,0.484375,0.625 }, 0.341964, { -0.54651874,0.3707127,0.75092566 }, 0.66033304 ,{ 1,1,1,1 } },Vertex{ { -0.7109375,0.484375,0.625 }, 0.341964, { -0.5064359,0.6464458,0.5706404 }, 0.66033304 ,{ 1,1,1,1 } },Vertex{ { -0.7109375,0.484375,0.625 }, 0.341964, { -0.36849314,0.87578374,-0.3117942 }, 0.66033304 ,{ 1,1,1,1 } },Vertex{ { -0.7109375,0.484375,0.625 }, 0.341964, { -0.28210953,0.915131,-0.28800973 }, 0.66033304 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.6015625,0.6875 }, 0.662817, { 0.36849314,0.87578374,-0.3117942 }, 0.62747896 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.6015625,0.6875 }, 0.662817, { 0.5064359,0.6464458,0.5706404 }, 0.62747896 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.6015625,0.6875 }, 0.662817, { 0.59239733,0.7464966,-0.30299863 }, 0.62747896 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.6015625,0.6875 }, 0.662817, { 0.60922873,0.5167244,0.60152835 }, 0.62747896 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.6015625,0.6875 }, 0.379297, { -0.60922873,0.5167244,0.60152835 }, 0.621314 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.6015625,0.6875 }, 0.379297, { -0.59239733,0.7464966,-0.30299863 }, 0.621314 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.6015625,0.6875 }, 0.379297, { -0.5064359,0.6464458,0.5706404 }, 0.621314 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.6015625,0.6875 }, 0.379297, { -0.36849314,0.87578374,-0.3117942 }, 0.621314 ,{ 1,1,1,1 } },Vertex{ { 0.3203125,0.7578125,0.734375 }, 0.626842, { -0.24460477,0.86751693,-0.43310842 }, 0.604208 ,{ 1,1,1,1 } },Vertex{ { 0.3203125,0.7578125,0.734375 }, 0.626842, { -0.044099633,0.66099447,0.7490938 }, 0.604208 ,{ 1,1,1,1 } },Vertex{ { 0.3203125,0.7578125,0.734375 }, 0.626842, { 0.59239733,0.7464966,-0.30299863 }, 0.604208 ,{ 1,1,1,1 } },Vertex{ { 0.3203125,0.7578125,0.734375 }, 0.626842, { 0.60922873,0.5167244,0.60152835 }, 0.604208 ,{ 1,1,1,1 } },Vertex{ { -0.3203125,0.7578125,0.734375 }, 0.416915, { -0.60922873,0.5167244,0.60152835 }, 0.59944797 ,{ 1,1,1,1 } },Vertex{ { -0.3203125,0.7578125,0.734375 }, 0.416915, { -0.59239733,0.7464966,-0.30299863 }, 0.59944797 ,{ 1,1,1,1 } },Vertex{ { -0.3203125,0.7578125,0.734375 }, 0.416915, { 0.044099633,0.66099447,0.7490938 }, 0.59944797 ,{ 1,1,1,1 } },Vertex{ { -0.3203125,0.7578125,0.734375 }, 0.416915, { 0.24460477,0.86751693,-0.43310842 }, 0.59944797 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.71875,0.7578125 }, 0.604826, { -0.85108703,0.36949438,-0.3729943 }, 0.602196 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.71875,0.7578125 }, 0.604826, { -0.72462326,0.3187102,0.6110196 }, 0.602196 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.71875,0.7578125 }, 0.604826, { -0.24460477,0.86751693,-0.43310842 }, 0.602196 ,{ 1,1,1,1 } },Vertex{ { 0.15625,0.71875,0.7578125 }, 0.604826, { -0.044099633,0.66099447,0.7490938 }, 0.602196 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.71875,0.7578125 }, 0.439252, { 0.044099633,0.66099447,0.7490938 }, 0.59845996 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.71875,0.7578125 }, 0.439252, { 0.24460477,0.86751693,-0.43310842 }, 0.59845996 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.71875,0.7578125 }, 0.439252, { 0.72462326,0.3187102,0.6110196 }, 0.59845996 ,{ 1,1,1,1 } },Vertex{ { -0.15625,0.71875,0.7578125 }, 0.439252, { 0.85108703,0.36949438,-0.3729943 }, 0.59845996 ,{ 1,1,1,1 } },Vertex{ { 0.0625,0.4921875,0.75 }, 0.553095, { -0.85108703,0.36949438,-0.3729943 }, 0.609488 ,{ 1,1,1,1 } },Vertex{ { 0.0625,0.4921875,0.75 }, 0.553095, { -0.72462326,0.3187102,0.6110196 }, 0.609488 ,{ 1,1,1,1 } },Vertex{ { 0.0625,0.4921875,0.75 }, 0.553095, { -0.5880126,0.5554119,0.5880126 }, 0.609488 ,{ 1,1,1,1 } },Vertex{ { 0.0625,0.4921875,0.75 }, 0.553095, { -0.53060406,0.8111062,-0.24610187 }, 0.609488 ,{ 1,1,1,1 } },Vertex{ { -0.0625,0.4921875,0.75 }, 0.490934, { 0.53060406,0.8111062,-0.24610187 }, 0.60813797 ,{ 1,1,1,1 } },Vertex{ { -0.0625,0.4921875,0.75 }, 0.490934, { 0.5880126,0.5554119,0.5880126 }, 0.60813797 ,{ 1,1,1,1 } },Vertex{ { -0.0625,0.4921875,0.75 }, 0.490934, { 0.72462326,0.3187102,0.6110196 }, 0.60813797 ,{ 1,1,1,1 } },Vertex{ { -0.0625,0.4921875,0.75 }, 0.490934, { 0.85108703,0.36949438,-0.3729943 }, 0.60813797 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.4140625,0.7734375 }, 0.577279, { -0.20828974,0.03739816,0.9773519 }, 0.65984404 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.4140625,0.7734375 }, 0.577279, { -0.017800191,0.2495027,0.96821046 }, 0.65984404 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.4140625,0.7734375 }, 0.577279, { 0.39609417,-0.43209362,0.810188 }, 0.65984404 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.4140625,0.7734375 }, 0.577279, { 0.5360975,-0.39089823,0.7481966 }, 0.65984404 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.4140625,0.7734375 }, 0.464579, { -0.5360975,-0.39089823,0.7481966 }, 0.65777004 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.4140625,0.7734375 }, 0.464579, { -0.39609417,-0.43209362,0.810188 }, 0.65777004 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.4140625,0.7734375 }, 0.464579, { 0.017800191,0.2495027,0.96821046 }, 0.65777004 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.4140625,0.7734375 }, 0.464579, { 0.20828974,0.03739816,0.9773519 }, 0.65777004 ,{ 1,1,1,1 } },Vertex{ { 0.125,0.3046875,0.765625 }, 0.558527, { -0.38428473,-0.04189834,0.9222634 }, 0.683406 ,{ 1,1,1,1 } },Vertex{ { 0.125,0.3046875,0.765625 }, 0.558527, { -0.20828974,0.03739816,0.9773519 }, 0.683406 ,{ 1,1,1,1 } },Vertex{ { 0.125,0.3046875,0.765625 }, 0.558527, { 0.18559489,-0.24739319,0.9509738 }, 0.683406 ,{ 1,1,1,1 } },Vertex{ { 0.125,0.3046875,0.765625 }, 0.558527, { 0.39609417,-0.43209362,0.810188 }, 0.683406 ,{ 1,1,1,1 } },Vertex{ { -0.125,0.3046875,0.765625 }, 0.482619, { -0.39609417,-0.43209362,0.810188 }, 0.68215704 ,{ 1,1,1,1 } },Vertex{ { -0.125,0.3046875,0.765625 }, 0.482619, { -0.18559489,-0.24739319,0.9509738 }, 0.68215704 ,{ 1,1,1,1 } },Vertex{ { -0.125,0.3046875,0.765625 }, 0.482619, { 0.20828974,0.03739816,0.9773519 }, 0.68215704 ,{ 1,1,1,1 } },Vertex{ { -0.125,0.3046875,0.765625 }, 0.482619, { 0.38428473,-0.04189834,0.9222634 }, 0.68215704 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.572941, { -0.5721103,-0.4767086,0.66741204 }, 0.741436 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.572941, { -0.13690044,-0.7531024,0.64350206 }, 0.741436 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.572941, { -0.13519809,0.26799625,0.95388657 }, 0.741436 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.09375,0.7421875 }, 0.572941, { 0.37619102,0.060298562,0.92457795 }, 0.741436 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.466409, { -0.37619102,0.060298562,0.92457795 }, 0.740291 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.466409, { 0.13519809,0.26799625,0.95388657 }, 0.740291 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.466409, { 0.13690044,-0.7531024,0.64350206 }, 0.740291 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.09375,0.7421875 }, 0.466409, { 0.5721103,-0.4767086,0.66741204 }, 0.740291 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.015625,0.703125 }, 0.613992, { -0.13690044,-0.7531024,0.64350206 }, 0.757338 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.015625,0.703125 }, 0.613992, { 0.3357079,-0.28780678,0.8969211 }, 0.757338 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.015625,0.703125 }, 0.613992, { 0.37619102,0.060298562,0.92457795 }, 0.757338 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.015625,0.703125 }, 0.613992, { 0.4088013,-0.6071019,0.6814021 }, 0.757338 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.015625,0.703125 }, 0.424464, { -0.4088013,-0.6071019,0.6814021 }, 0.755527 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.015625,0.703125 }, 0.424464, { -0.37619102,0.060298562,0.92457795 }, 0.755527 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.015625,0.703125 }, 0.424464, { -0.3357079,-0.28780678,0.8969211 }, 0.755527 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.015625,0.703125 }, 0.424464, { 0.13690044,-0.7531024,0.64350206 }, 0.755527 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.0625,0.671875 }, 0.639236, { 0.3357079,-0.28780678,0.8969211 }, 0.746953 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.0625,0.671875 }, 0.639236, { 0.38129255,-0.18239644,0.9062823 }, 0.746953 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.0625,0.671875 }, 0.639236, { 0.4088013,-0.6071019,0.6814021 }, 0.746953 ,{ 1,1,1,1 } },Vertex{ { 0.4921875,0.0625,0.671875 }, 0.639236, { 0.5740304,-0.41302186,0.7070375 }, 0.746953 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.0625,0.671875 }, 0.398938, { -0.5740304,-0.41302186,0.7070375 }, 0.744367 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.0625,0.671875 }, 0.398938, { -0.4088013,-0.6071019,0.6814021 }, 0.744367 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.0625,0.671875 }, 0.398938, { -0.38129255,-0.18239644,0.9062823 }, 0.744367 ,{ 1,1,1,1 } },Vertex{ { -0.4921875,0.0625,0.671875 }, 0.398938, { -0.3357079,-0.28780678,0.8969211 }, 0.744367 ,{ 1,1,1,1 } },Vertex{ { 0.625,0.1875,0.6484375 }, 0.664101, { 0.27841282,-0.21300982,0.93654317 }, 0.72212803 ,{ 1,1,1,1 } },Vertex{ { 0.625,0.1875,0.6484375 }, 0.664101, { 0.38129255,-0.18239644,0.9062823 }, 0.72212803 ,{ 1,1,1,1 } },Vertex{ { 0.625,0.1875,0.6484375 }, 0.664101, { 0.56652623,-0.096804485,0.8183379 }, 0.72212803 ,{ 1,1,1,1 } },Vertex{ { 0.625,0.1875,0.6484375 }, 0.664101, { 0.5740304,-0.41302186,0.7070375 }, 0.72212803 ,{ 1,1,1,1 } },Vertex{ { -0.625,0.1875,0.6484375 }, 0.3741, { -0.5740304,-0.41302186,0.7070375 }, 0.718222 ,{ 1,1,1,1 } },Vertex{ { -0.625,0.1875,0.6484375 }, 0.3741, { -0.56652623,-0.096804485,0.8183379 }, 0.718222 ,{ 1,1,1,1 } },Vertex{ { -0.625,0.1875,0.6484375 }, 0.3741, { -0.38129255,-0.18239644,0.9062823 }, 0.718222 ,{ 1,1,1,1 } },Vertex{ { -0.625,0.1875,0.6484375 }, 0.3741, { -0.27841282,-0.21300982,0.93654317 }, 0.718222 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.296875,0.6484375 }, 0.66844, { 0.0457021,-0.566726,0.8226378 }, 0.702042 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.296875,0.6484375 }, 0.66844, { 0.27841282,-0.21300982,0.93654317 }, 0.702042 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.296875,0.6484375 }, 0.66844, { 0.56652623,-0.096804485,0.8183379 }, 0.702042 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.296875,0.6484375 }, 0.66844, { 0.57030785,0.118001625,0.8129112 }, 0.702042 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.296875,0.6484375 }, 0.370304, { -0.57030785,0.118001625,0.8129112 }, 0.697356 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.296875,0.6484375 }, 0.370304, { -0.56652623,-0.096804485,0.8183379 }, 0.697356 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.296875,0.6484375 }, 0.370304, { -0.27841282,-0.21300982,0.93654317 }, 0.697356 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.296875,0.6484375 }, 0.370304, { -0.0457021,-0.566726,0.8226378 }, 0.697356 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0.375,0.6640625 }, 0.662406, { -0.082495324,-0.6574627,0.7489575 }, 0.687196 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0.375,0.6640625 }, 0.662406, { 0.0457021,-0.566726,0.8226378 }, 0.687196 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0.375,0.6640625 }, 0.662406, { 0.48229536,0.56209457,0.6718935 }, 0.687196 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0.375,0.6640625 }, 0.662406, { 0.57030785,0.118001625,0.8129112 }, 0.687196 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0.375,0.6640625 }, 0.377061, { -0.57030785,0.118001625,0.8129112 }, 0.682315 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0.375,0.6640625 }, 0.377061, { -0.48229536,0.56209457,0.6718935 }, 0.682315 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0.375,0.6640625 }, 0.377061, { -0.0457021,-0.566726,0.8226378 }, 0.682315 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0.375,0.6640625 }, 0.377061, { 0.082495324,-0.6574627,0.7489575 }, 0.682315 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,0.4375,0.71875 }, 0.634472, { -0.082495324,-0.6574627,0.7489575 }, 0.66768897 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,0.4375,0.71875 }, 0.634472, { -0.07940337,-0.53212255,0.8429357 }, 0.66768897 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,0.4375,0.71875 }, 0.634472, { 0.2603902,0.611377,0.7472719 }, 0.66768897 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,0.4375,0.71875 }, 0.634472, { 0.48229536,0.56209457,0.6718935 }, 0.66768897 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,0.4375,0.71875 }, 0.406362, { -0.48229536,0.56209457,0.6718935 }, 0.66352 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,0.4375,0.71875 }, 0.406362, { -0.2603902,0.611377,0.7472719 }, 0.66352 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,0.4375,0.71875 }, 0.406362, { 0.07940337,-0.53212255,0.8429357 }, 0.66352 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,0.4375,0.71875 }, 0.406362, { 0.082495324,-0.6574627,0.7489575 }, 0.66352 ,{ 1,1,1,1 } },Vertex{ { 0.25,0.46875,0.7578125 }, 0.599845, { -0.017800191,0.2495027,0.96821046 }, 0.655185 ,{ 1,1,1,1 } },Vertex{ { 0.25,0.46875,0.7578125 }, 0.599845, { 0.16399248,0.36068347,0.9181579 }, 0.655185 ,{ 1,1,1,1 } },Vertex{ { 0.25,0.46875,0.7578125 }, 0.599845, { 0.22069597,-0.46899146,0.8551844 }, 0.655185 ,{ 1,1,1,1 } },Vertex{ { 0.25,0.46875,0.7578125 }, 0.599845, { 0.5360975,-0.39089823,0.7481966 }, 0.655185 ,{ 1,1,1,1 } },Vertex{ { -0.25,0.46875,0.7578125 }, 0.441977, { -0.5360975,-0.39089823,0.7481966 }, 0.65218496 ,{ 1,1,1,1 } },Vertex{ { -0.25,0.46875,0.7578125 }, 0.441977, { -0.22069597,-0.46899146,0.8551844 }, 0.65218496 ,{ 1,1,1,1 } },Vertex{ { -0.25,0.46875,0.7578125 }, 0.441977, { -0.16399248,0.36068347,0.9181579 }, 0.65218496 ,{ 1,1,1,1 } },Vertex{ { -0.25,0.46875,0.7578125 }, 0.441977, { 0.017800191,0.2495027,0.96821046 }, 0.65218496 ,{ 1,1,1,1 } },Vertex{ { 0,-0.765625,0.734375 }, 0.518927, { -0.2237087,-0.6539255,0.72272813 }, 0.91482 ,{ 1,1,1,1 } },Vertex{ { 0,-0.765625,0.734375 }, 0.518927, { 0,0,1 }, 0.91482 ,{ 1,1,1,1 } },Vertex{ { 0,-0.765625,0.734375 }, 0.518927, { 0.2237087,-0.6539255,0.72272813 }, 0.91482 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.71875,0.734375 }, 0.531019, { -0.15360643,-0.19970836,0.9677405 }, 0.912569 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.71875,0.734375 }, 0.531019, { 0,0,1 }, 0.912569 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.71875,0.734375 }, 0.531019, { 0.2237087,-0.6539255,0.72272813 }, 0.912569 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.71875,0.734375 }, 0.531019, { 0.31569883,-0.27079898,0.90939665 }, 0.912569 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.71875,0.734375 }, 0.531019, { 0.32659882,-0.13059954,0.93609667 }, 0.912569 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.71875,0.734375 }, 0.506827, { -0.32659882,-0.13059954,0.93609667 }, 0.912584 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.71875,0.734375 }, 0.506827, { -0.31569883,-0.27079898,0.90939665 }, 0.912584 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.71875,0.734375 }, 0.506827, { -0.2237087,-0.6539255,0.72272813 }, 0.912584 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.71875,0.734375 }, 0.506827, { 0,0,1 }, 0.912584 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.71875,0.734375 }, 0.506827, { 0.15360643,-0.19970836,0.9677405 }, 0.912584 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.8359375,0.7109375 }, 0.531231, { -0.2732875,-0.10249532,0.9564563 }, 0.926171 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.8359375,0.7109375 }, 0.531231, { -0.15360643,-0.19970836,0.9677405 }, 0.926171 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.8359375,0.7109375 }, 0.531231, { 0.18630028,-0.57230085,0.7986012 }, 0.926171 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.8359375,0.7109375 }, 0.531231, { 0.31569883,-0.27079898,0.90939665 }, 0.926171 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.8359375,0.7109375 }, 0.506626, { -0.31569883,-0.27079898,0.90939665 }, 0.926189 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.8359375,0.7109375 }, 0.506626, { -0.18630028,-0.57230085,0.7986012 }, 0.926189 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.8359375,0.7109375 }, 0.506626, { 0.15360643,-0.19970836,0.9677405 }, 0.926189 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.8359375,0.7109375 }, 0.506626, { 0.2732875,-0.10249532,0.9564563 }, 0.926189 ,{ 1,1,1,1 } },Vertex{ { 0.0625,-0.8828125,0.6953125 }, 0.525483, { -0.2732875,-0.10249532,0.9564563 }, 0.931033 ,{ 1,1,1,1 } },Vertex{ { 0.0625,-0.8828125,0.6953125 }, 0.525483, { -0.097599536,0.19519907,0.97589535 }, 0.931033 ,{ 1,1,1,1 } },Vertex{ { 0.0625,-0.8828125,0.6953125 }, 0.525483, { 0.07210143,-0.6966138,0.71381414 }, 0.931033 ,{ 1,1,1,1 } },Vertex{ { 0.0625,-0.8828125,0.6953125 }, 0.525483, { 0.18630028,-0.57230085,0.7986012 }, 0.931033 ,{ 1,1,1,1 } },Vertex{ { -0.0625,-0.8828125,0.6953125 }, 0.512375, { -0.18630028,-0.57230085,0.7986012 }, 0.931044 ,{ 1,1,1,1 } },Vertex{ { -0.0625,-0.8828125,0.6953125 }, 0.512375, { -0.07210143,-0.6966138,0.71381414 }, 0.931044 ,{ 1,1,1,1 } },Vertex{ { -0.0625,-0.8828125,0.6953125 }, 0.512375, { 0.097599536,0.19519907,0.97589535 }, 0.931044 ,{ 1,1,1,1 } },Vertex{ { -0.0625,-0.8828125,0.6953125 }, 0.512375, { 0.2732875,-0.10249532,0.9564563 }, 0.931044 ,{ 1,1,1,1 } },Vertex{ { 0,-0.890625,0.6875 }, 0.518928, { -0.097599536,0.19519907,0.97589535 }, 0.932101 ,{ 1,1,1,1 } },Vertex{ { 0,-0.890625,0.6875 }, 0.518928, { -0.07210143,-0.6966138,0.71381414 }, 0.932101 ,{ 1,1,1,1 } },Vertex{ { 0,-0.890625,0.6875 }, 0.518928, { 0.07210143,-0.6966138,0.71381414 }, 0.932101 ,{ 1,1,1,1 } },Vertex{ { 0,-0.890625,0.6875 }, 0.518928, { 0.097599536,0.19519907,0.97589535 }, 0.932101 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1953125,0.75 }, 0.517577, { -0.8836127,0.3555051,0.30470437 }, 0.809393 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1953125,0.75 }, 0.517577, { 0.8836127,0.3555051,0.30470437 }, 0.809393 ,{ 1,1,1,1 } },Vertex{ { 0,-0.140625,0.7421875 }, 0.519841, { -0.8836127,0.3555051,0.30470437 }, 0.799157 ,{ 1,1,1,1 } },Vertex{ { 0,-0.140625,0.7421875 }, 0.519841, { -0.44517574,-0.16099122,0.88085204 }, 0.799157 ,{ 1,1,1,1 } },Vertex{ { 0,-0.140625,0.7421875 }, 0.519841, { -0.082496986,0.9072668,-0.41238493 }, 0.799157 ,{ 1,1,1,1 } },Vertex{ { 0,-0.140625,0.7421875 }, 0.519841, { 0.082496986,0.9072668,-0.41238493 }, 0.799157 ,{ 1,1,1,1 } },Vertex{ { 0,-0.140625,0.7421875 }, 0.519841, { 0.44517574,-0.16099122,0.88085204 }, 0.799157 ,{ 1,1,1,1 } },Vertex{ { 0,-0.140625,0.7421875 }, 0.519841, { 0.8836127,0.3555051,0.30470437 }, 0.799157 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,-0.1484375,0.7421875 }, 0.544281, { -0.44517574,-0.16099122,0.88085204 }, 0.806634 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,-0.1484375,0.7421875 }, 0.544281, { -0.21819885,-0.4363977,0.8728954 }, 0.806634 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,-0.1484375,0.7421875 }, 0.544281, { 0.082496986,0.9072668,-0.41238493 }, 0.806634 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,-0.1484375,0.7421875 }, 0.544281, { 0.94935733,0.22968967,-0.21439035 }, 0.806634 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,-0.1484375,0.7421875 }, 0.493996, { -0.94935733,0.22968967,-0.21439035 }, 0.806572 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,-0.1484375,0.7421875 }, 0.493996, { -0.082496986,0.9072668,-0.41238493 }, 0.806572 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,-0.1484375,0.7421875 }, 0.493996, { 0.21819885,-0.4363977,0.8728954 }, 0.806572 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,-0.1484375,0.7421875 }, 0.493996, { 0.44517574,-0.16099122,0.88085204 }, 0.806572 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.2265625,0.75 }, 0.548362, { -0.21819885,-0.4363977,0.8728954 }, 0.82644 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.2265625,0.75 }, 0.548362, { 0.43409255,-0.12899777,0.8915847 }, 0.82644 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.2265625,0.75 }, 0.548362, { 0.81738704,-0.5743909,-0.0441993 }, 0.82644 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.2265625,0.75 }, 0.548362, { 0.94935733,0.22968967,-0.21439035 }, 0.82644 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.2265625,0.75 }, 0.489683, { -0.94935733,0.22968967,-0.21439035 }, 0.826307 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.2265625,0.75 }, 0.489683, { -0.81738704,-0.5743909,-0.0441993 }, 0.826307 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.2265625,0.75 }, 0.489683, { -0.43409255,-0.12899777,0.8915847 }, 0.826307 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.2265625,0.75 }, 0.489683, { 0.21819885,-0.4363977,0.8728954 }, 0.826307 ,{ 1,1,1,1 } },Vertex{ { 0.0859375,-0.2890625,0.7421875 }, 0.538112, { -0.013699415,0.057397548,0.9982574 }, 0.841618 ,{ 1,1,1,1 } },Vertex{ { 0.0859375,-0.2890625,0.7421875 }, 0.538112, { 0.30079153,0.05009859,0.9523732 }, 0.841618 ,{ 1,1,1,1 } },Vertex{ { 0.0859375,-0.2890625,0.7421875 }, 0.538112, { 0.42068827,-0.87967545,0.22179382 }, 0.841618 ,{ 1,1,1,1 } },Vertex{ { 0.0859375,-0.2890625,0.7421875 }, 0.538112, { 0.43409255,-0.12899777,0.8915847 }, 0.841618 ,{ 1,1,1,1 } },Vertex{ { 0.0859375,-0.2890625,0.7421875 }, 0.538112, { 0.81738704,-0.5743909,-0.0441993 }, 0.841618 ,{ 1,1,1,1 } },Vertex{ { -0.0859375,-0.2890625,0.7421875 }, 0.499851, { -0.81738704,-0.5743909,-0.0441993 }, 0.84156597 ,{ 1,1,1,1 } },Vertex{ { -0.0859375,-0.2890625,0.7421875 }, 0.499851, { -0.43409255,-0.12899777,0.8915847 }, 0.84156597 ,{ 1,1,1,1 } },Vertex{ { -0.0859375,-0.2890625,0.7421875 }, 0.499851, { -0.42068827,-0.87967545,0.22179382 }, 0.84156597 ,{ 1,1,1,1 } },Vertex{ { -0.0859375,-0.2890625,0.7421875 }, 0.499851, { -0.30079153,0.05009859,0.9523732 }, 0.84156597 ,{ 1,1,1,1 } },Vertex{ { -0.0859375,-0.2890625,0.7421875 }, 0.499851, { 0.013699415,0.057397548,0.9982574 }, 0.84156597 ,{ 1,1,1,1 } },Vertex{ { 0.3984375,-0.046875,0.671875 }, 0.621513, { 0.32409102,-0.8187773,0.47388688 }, 0.772182 ,{ 1,1,1,1 } },Vertex{ { 0.3984375,-0.046875,0.671875 }, 0.621513, { 0.3357079,-0.28780678,0.8969211 }, 0.772182 ,{ 1,1,1,1 } },Vertex{ { 0.3984375,-0.046875,0.671875 }, 0.621513, { 0.37619102,0.060298562,0.92457795 }, 0.772182 ,{ 1,1,1,1 } },Vertex{ { 0.3984375,-0.046875,0.671875 }, 0.621513, { 0.3857039,-0.6629067,0.6417065 }, 0.772182 ,{ 1,1,1,1 } },Vertex{ { -0.3984375,-0.046875,0.671875 }, 0.416514, { -0.3857039,-0.6629067,0.6417065 }, 0.77051 ,{ 1,1,1,1 } },Vertex{ { -0.3984375,-0.046875,0.671875 }, 0.416514, { -0.37619102,0.060298562,0.92457795 }, 0.77051 ,{ 1,1,1,1 } },Vertex{ { -0.3984375,-0.046875,0.671875 }, 0.416514, { -0.3357079,-0.28780678,0.8969211 }, 0.77051 ,{ 1,1,1,1 } },Vertex{ { -0.3984375,-0.046875,0.671875 }, 0.416514, { -0.32409102,-0.8187773,0.47388688 }, 0.77051 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.0546875,0.625 }, 0.664761, { 0.3357079,-0.28780678,0.8969211 }, 0.74677503 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.0546875,0.625 }, 0.664761, { 0.38129255,-0.18239644,0.9062823 }, 0.74677503 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.0546875,0.625 }, 0.664761, { 0.3857039,-0.6629067,0.6417065 }, 0.74677503 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.0546875,0.625 }, 0.664761, { 0.6894893,-0.4192935,0.59059083 }, 0.74677503 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.0546875,0.625 }, 0.372747, { -0.6894893,-0.4192935,0.59059083 }, 0.743643 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.0546875,0.625 }, 0.372747, { -0.3857039,-0.6629067,0.6417065 }, 0.743643 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.0546875,0.625 }, 0.372747, { -0.38129255,-0.18239644,0.9062823 }, 0.743643 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.0546875,0.625 }, 0.372747, { -0.3357079,-0.28780678,0.8969211 }, 0.743643 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.203125,0.6015625 }, 0.683908, { 0.27841282,-0.21300982,0.93654317 }, 0.72000504 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.203125,0.6015625 }, 0.683908, { 0.38129255,-0.18239644,0.9062823 }, 0.72000504 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.203125,0.6015625 }, 0.683908, { 0.6587689,-0.36338285,0.6587689 }, 0.72000504 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.203125,0.6015625 }, 0.683908, { 0.6894893,-0.4192935,0.59059083 }, 0.72000504 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.203125,0.6015625 }, 0.353696, { -0.6894893,-0.4192935,0.59059083 }, 0.715394 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.203125,0.6015625 }, 0.353696, { -0.6587689,-0.36338285,0.6587689 }, 0.715394 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.203125,0.6015625 }, 0.353696, { -0.38129255,-0.18239644,0.9062823 }, 0.715394 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.203125,0.6015625 }, 0.353696, { -0.27841282,-0.21300982,0.93654317 }, 0.715394 ,{ 1,1,1,1 } },Vertex{ { 0.7421875,0.375,0.65625 }, 0.687515, { 0.0457021,-0.566726,0.8226378 }, 0.688461 ,{ 1,1,1,1 } },Vertex{ { 0.7421875,0.375,0.65625 }, 0.687515, { 0.27841282,-0.21300982,0.93654317 }, 0.688461 ,{ 1,1,1,1 } },Vertex{ { 0.7421875,0.375,0.65625 }, 0.687515, { 0.54651874,0.3707127,0.75092566 }, 0.688461 ,{ 1,1,1,1 } },Vertex{ { 0.7421875,0.375,0.65625 }, 0.687515, { 0.6587689,-0.36338285,0.6587689 }, 0.688461 ,{ 1,1,1,1 } },Vertex{ { -0.7421875,0.375,0.65625 }, 0.351187, { -0.6587689,-0.36338285,0.6587689 }, 0.68255997 ,{ 1,1,1,1 } },Vertex{ { -0.7421875,0.375,0.65625 }, 0.351187, { -0.54651874,0.3707127,0.75092566 }, 0.68255997 ,{ 1,1,1,1 } },Vertex{ { -0.7421875,0.375,0.65625 }, 0.351187, { -0.27841282,-0.21300982,0.93654317 }, 0.68255997 ,{ 1,1,1,1 } },Vertex{ { -0.7421875,0.375,0.65625 }, 0.351187, { -0.0457021,-0.566726,0.8226378 }, 0.68255997 ,{ 1,1,1,1 } },Vertex{ { 0.6875,0.4140625,0.7265625 }, 0.676824, { -0.082495324,-0.6574627,0.7489575 }, 0.676063 ,{ 1,1,1,1 } },Vertex{ { 0.6875,0.4140625,0.7265625 }, 0.676824, { 0.0457021,-0.566726,0.8226378 }, 0.676063 ,{ 1,1,1,1 } },Vertex{ { 0.6875,0.4140625,0.7265625 }, 0.676824, { 0.5064359,0.6464458,0.5706404 }, 0.676063 ,{ 1,1,1,1 } },Vertex{ { 0.6875,0.4140625,0.7265625 }, 0.676824, { 0.54651874,0.3707127,0.75092566 }, 0.676063 ,{ 1,1,1,1 } },Vertex{ { -0.6875,0.4140625,0.7265625 }, 0.362723, { -0.54651874,0.3707127,0.75092566 }, 0.670278 ,{ 1,1,1,1 } },Vertex{ { -0.6875,0.4140625,0.7265625 }, 0.362723, { -0.5064359,0.6464458,0.5706404 }, 0.670278 ,{ 1,1,1,1 } },Vertex{ { -0.6875,0.4140625,0.7265625 }, 0.362723, { -0.0457021,-0.566726,0.8226378 }, 0.670278 ,{ 1,1,1,1 } },Vertex{ { -0.6875,0.4140625,0.7265625 }, 0.362723, { 0.082495324,-0.6574627,0.7489575 }, 0.670278 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.546875,0.796875 }, 0.63905, { -0.082495324,-0.6574627,0.7489575 }, 0.64267004 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.546875,0.796875 }, 0.63905, { -0.07940337,-0.53212255,0.8429357 }, 0.64267004 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.546875,0.796875 }, 0.63905, { 0.5064359,0.6464458,0.5706404 }, 0.64267004 ,{ 1,1,1,1 } },Vertex{ { 0.4375,0.546875,0.796875 }, 0.63905, { 0.60922873,0.5167244,0.60152835 }, 0.64267004 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.546875,0.796875 }, 0.402772, { -0.60922873,0.5167244,0.60152835 }, 0.637869 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.546875,0.796875 }, 0.402772, { -0.5064359,0.6464458,0.5706404 }, 0.637869 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.546875,0.796875 }, 0.402772, { 0.07940337,-0.53212255,0.8429357 }, 0.637869 ,{ 1,1,1,1 } },Vertex{ { -0.4375,0.546875,0.796875 }, 0.402772, { 0.082495324,-0.6574627,0.7489575 }, 0.637869 ,{ 1,1,1,1 } },Vertex{ { 0.3125,0.640625,0.8359375 }, 0.618316, { -0.07940337,-0.53212255,0.8429357 }, 0.62484896 ,{ 1,1,1,1 } },Vertex{ { 0.3125,0.640625,0.8359375 }, 0.618316, { -0.044099633,0.66099447,0.7490938 }, 0.62484896 ,{ 1,1,1,1 } },Vertex{ { 0.3125,0.640625,0.8359375 }, 0.618316, { 0.22069597,-0.46899146,0.8551844 }, 0.62484896 ,{ 1,1,1,1 } },Vertex{ { 0.3125,0.640625,0.8359375 }, 0.618316, { 0.60922873,0.5167244,0.60152835 }, 0.62484896 ,{ 1,1,1,1 } },Vertex{ { -0.3125,0.640625,0.8359375 }, 0.424583, { -0.60922873,0.5167244,0.60152835 }, 0.620733 ,{ 1,1,1,1 } },Vertex{ { -0.3125,0.640625,0.8359375 }, 0.424583, { -0.22069597,-0.46899146,0.8551844 }, 0.620733 ,{ 1,1,1,1 } },Vertex{ { -0.3125,0.640625,0.8359375 }, 0.424583, { 0.044099633,0.66099447,0.7490938 }, 0.620733 ,{ 1,1,1,1 } },Vertex{ { -0.3125,0.640625,0.8359375 }, 0.424583, { 0.07940337,-0.53212255,0.8429357 }, 0.620733 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.6171875,0.8515625 }, 0.600808, { -0.72462326,0.3187102,0.6110196 }, 0.62214303 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.6171875,0.8515625 }, 0.600808, { -0.044099633,0.66099447,0.7490938 }, 0.62214303 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.6171875,0.8515625 }, 0.600808, { 0.22069597,-0.46899146,0.8551844 }, 0.62214303 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.6171875,0.8515625 }, 0.600808, { 0.5360975,-0.39089823,0.7481966 }, 0.62214303 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.6171875,0.8515625 }, 0.442396, { -0.5360975,-0.39089823,0.7481966 }, 0.618778 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.6171875,0.8515625 }, 0.442396, { -0.22069597,-0.46899146,0.8551844 }, 0.618778 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.6171875,0.8515625 }, 0.442396, { 0.044099633,0.66099447,0.7490938 }, 0.618778 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.6171875,0.8515625 }, 0.442396, { 0.72462326,0.3187102,0.6110196 }, 0.618778 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,0.4296875,0.84375 }, 0.559674, { -0.72462326,0.3187102,0.6110196 }, 0.64298904 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,0.4296875,0.84375 }, 0.559674, { -0.5880126,0.5554119,0.5880126 }, 0.64298904 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,0.4296875,0.84375 }, 0.559674, { 0.39609417,-0.43209362,0.810188 }, 0.64298904 ,{ 1,1,1,1 } },Vertex{ { 0.1015625,0.4296875,0.84375 }, 0.559674, { 0.5360975,-0.39089823,0.7481966 }, 0.64298904 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,0.4296875,0.84375 }, 0.482938, { -0.5360975,-0.39089823,0.7481966 }, 0.641503 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,0.4296875,0.84375 }, 0.482938, { -0.39609417,-0.43209362,0.810188 }, 0.641503 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,0.4296875,0.84375 }, 0.482938, { 0.5880126,0.5554119,0.5880126 }, 0.641503 ,{ 1,1,1,1 } },Vertex{ { -0.1015625,0.4296875,0.84375 }, 0.482938, { 0.72462326,0.3187102,0.6110196 }, 0.641503 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.1015625,0.8125 }, 0.553118, { -0.44517574,-0.16099122,0.88085204 }, 0.790401 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.1015625,0.8125 }, 0.553118, { -0.21819885,-0.4363977,0.8728954 }, 0.790401 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.1015625,0.8125 }, 0.553118, { -0.13519809,0.26799625,0.95388657 }, 0.790401 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.1015625,0.8125 }, 0.553118, { 0.32409102,-0.8187773,0.47388688 }, 0.790401 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.1015625,0.8125 }, 0.553118, { 0.37619102,0.060298562,0.92457795 }, 0.790401 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.1015625,0.8125 }, 0.553118, { 0.9384765,0.16009599,0.30599234 }, 0.790401 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.1015625,0.8125 }, 0.485339, { -0.9384765,0.16009599,0.30599234 }, 0.78994703 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.1015625,0.8125 }, 0.485339, { -0.37619102,0.060298562,0.92457795 }, 0.78994703 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.1015625,0.8125 }, 0.485339, { -0.32409102,-0.8187773,0.47388688 }, 0.78994703 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.1015625,0.8125 }, 0.485339, { 0.13519809,0.26799625,0.95388657 }, 0.78994703 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.1015625,0.8125 }, 0.485339, { 0.21819885,-0.4363977,0.8728954 }, 0.78994703 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.1015625,0.8125 }, 0.485339, { 0.44517574,-0.16099122,0.88085204 }, 0.78994703 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.4453125,0.7109375 }, 0.555621, { 0.30079153,0.05009859,0.9523732 }, 0.878251 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.4453125,0.7109375 }, 0.555621, { 0.30629015,-0.026499147,0.9515694 }, 0.878251 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.4453125,0.7109375 }, 0.555621, { 0.77963734,0.09000431,0.6197297 }, 0.878251 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.4453125,0.7109375 }, 0.555621, { 0.81228685,0.3009951,0.4995919 }, 0.878251 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.4453125,0.7109375 }, 0.482177, { -0.81228685,0.3009951,0.4995919 }, 0.878219 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.4453125,0.7109375 }, 0.482177, { -0.77963734,0.09000431,0.6197297 }, 0.878219 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.4453125,0.7109375 }, 0.482177, { -0.30629015,-0.026499147,0.9515694 }, 0.878219 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.4453125,0.7109375 }, 0.482177, { -0.30079153,0.05009859,0.9523732 }, 0.878219 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.703125,0.6875 }, 0.548333, { 0.30629015,-0.026499147,0.9515694 }, 0.915107 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.703125,0.6875 }, 0.548333, { 0.32659882,-0.13059954,0.93609667 }, 0.915107 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.703125,0.6875 }, 0.548333, { 0.7688822,-0.05059883,0.63738525 }, 0.915107 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.703125,0.6875 }, 0.548333, { 0.77963734,0.09000431,0.6197297 }, 0.915107 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.703125,0.6875 }, 0.489507, { -0.77963734,0.09000431,0.6197297 }, 0.915142 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.703125,0.6875 }, 0.489507, { -0.7688822,-0.05059883,0.63738525 }, 0.915142 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.703125,0.6875 }, 0.489507, { -0.32659882,-0.13059954,0.93609667 }, 0.915142 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.703125,0.6875 }, 0.489507, { -0.30629015,-0.026499147,0.9515694 }, 0.915142 ,{ 1,1,1,1 } },Vertex{ { 0.265625,-0.8203125,0.6640625 }, 0.54629, { 0.31569883,-0.27079898,0.90939665 }, 0.927331 ,{ 1,1,1,1 } },Vertex{ { 0.265625,-0.8203125,0.6640625 }, 0.54629, { 0.32659882,-0.13059954,0.93609667 }, 0.927331 ,{ 1,1,1,1 } },Vertex{ { 0.265625,-0.8203125,0.6640625 }, 0.54629, { 0.59020495,-0.4550038,0.66680557 }, 0.927331 ,{ 1,1,1,1 } },Vertex{ { 0.265625,-0.8203125,0.6640625 }, 0.54629, { 0.7688822,-0.05059883,0.63738525 }, 0.927331 ,{ 1,1,1,1 } },Vertex{ { -0.265625,-0.8203125,0.6640625 }, 0.491565, { -0.7688822,-0.05059883,0.63738525 }, 0.927375 ,{ 1,1,1,1 } },Vertex{ { -0.265625,-0.8203125,0.6640625 }, 0.491565, { -0.59020495,-0.4550038,0.66680557 }, 0.927375 ,{ 1,1,1,1 } },Vertex{ { -0.265625,-0.8203125,0.6640625 }, 0.491565, { -0.32659882,-0.13059954,0.93609667 }, 0.927375 ,{ 1,1,1,1 } },Vertex{ { -0.265625,-0.8203125,0.6640625 }, 0.491565, { -0.31569883,-0.27079898,0.90939665 }, 0.927375 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.9140625,0.6328125 }, 0.542788, { 0.18630028,-0.57230085,0.7986012 }, 0.935911 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.9140625,0.6328125 }, 0.542788, { 0.21900316,-0.8647125,0.45200652 }, 0.935911 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.9140625,0.6328125 }, 0.542788, { 0.31569883,-0.27079898,0.90939665 }, 0.935911 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.9140625,0.6328125 }, 0.542788, { 0.59020495,-0.4550038,0.66680557 }, 0.935911 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.9140625,0.6328125 }, 0.495083, { -0.59020495,-0.4550038,0.66680557 }, 0.935953 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.9140625,0.6328125 }, 0.495083, { -0.31569883,-0.27079898,0.90939665 }, 0.935953 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.9140625,0.6328125 }, 0.495083, { -0.21900316,-0.8647125,0.45200652 }, 0.935953 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.9140625,0.6328125 }, 0.495083, { -0.18630028,-0.57230085,0.7986012 }, 0.935953 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9296875,0.6328125 }, 0.536419, { 0.07210143,-0.6966138,0.71381414 }, 0.937928 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9296875,0.6328125 }, 0.536419, { 0.1231021,-0.86161464,0.4924084 }, 0.937928 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9296875,0.6328125 }, 0.536419, { 0.18630028,-0.57230085,0.7986012 }, 0.937928 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9296875,0.6328125 }, 0.536419, { 0.21900316,-0.8647125,0.45200652 }, 0.937928 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9296875,0.6328125 }, 0.501452, { -0.21900316,-0.8647125,0.45200652 }, 0.937957 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9296875,0.6328125 }, 0.501452, { -0.18630028,-0.57230085,0.7986012 }, 0.937957 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9296875,0.6328125 }, 0.501452, { -0.1231021,-0.86161464,0.4924084 }, 0.937957 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9296875,0.6328125 }, 0.501452, { -0.07210143,-0.6966138,0.71381414 }, 0.937957 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9453125,0.640625 }, 0.518925, { -0.1231021,-0.86161464,0.4924084 }, 0.940319 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9453125,0.640625 }, 0.518925, { -0.07210143,-0.6966138,0.71381414 }, 0.940319 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9453125,0.640625 }, 0.518925, { 0.07210143,-0.6966138,0.71381414 }, 0.940319 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9453125,0.640625 }, 0.518925, { 0.1231021,-0.86161464,0.4924084 }, 0.940319 ,{ 1,1,1,1 } },Vertex{ { 0,0.046875,0.7265625 }, 0.51976, { -0.44517574,-0.16099122,0.88085204 }, 0.751136 ,{ 1,1,1,1 } },Vertex{ { 0,0.046875,0.7265625 }, 0.51976, { -0.13519809,0.26799625,0.95388657 }, 0.751136 ,{ 1,1,1,1 } },Vertex{ { 0,0.046875,0.7265625 }, 0.51976, { -0.009899933,-0.19479868,0.9807933 }, 0.751136 ,{ 1,1,1,1 } },Vertex{ { 0,0.046875,0.7265625 }, 0.51976, { 0.009899933,-0.19479868,0.9807933 }, 0.751136 ,{ 1,1,1,1 } },Vertex{ { 0,0.046875,0.7265625 }, 0.51976, { 0.13519809,0.26799625,0.95388657 }, 0.751136 ,{ 1,1,1,1 } },Vertex{ { 0,0.046875,0.7265625 }, 0.51976, { 0.44517574,-0.16099122,0.88085204 }, 0.751136 ,{ 1,1,1,1 } },Vertex{ { 0,0.2109375,0.765625 }, 0.520277, { -0.18559489,-0.24739319,0.9509738 }, 0.70523596 ,{ 1,1,1,1 } },Vertex{ { 0,0.2109375,0.765625 }, 0.520277, { -0.009899933,-0.19479868,0.9807933 }, 0.70523596 ,{ 1,1,1,1 } },Vertex{ { 0,0.2109375,0.765625 }, 0.520277, { 0.009899933,-0.19479868,0.9807933 }, 0.70523596 ,{ 1,1,1,1 } },Vertex{ { 0,0.2109375,0.765625 }, 0.520277, { 0.18559489,-0.24739319,0.9509738 }, 0.70523596 ,{ 1,1,1,1 } },Vertex{ { 0.328125,0.4765625,0.7421875 }, 0.615546, { -0.07940337,-0.53212255,0.8429357 }, 0.657995 ,{ 1,1,1,1 } },Vertex{ { 0.328125,0.4765625,0.7421875 }, 0.615546, { 0.16399248,0.36068347,0.9181579 }, 0.657995 ,{ 1,1,1,1 } },Vertex{ { 0.328125,0.4765625,0.7421875 }, 0.615546, { 0.22069597,-0.46899146,0.8551844 }, 0.657995 ,{ 1,1,1,1 } },Vertex{ { 0.328125,0.4765625,0.7421875 }, 0.615546, { 0.2603902,0.611377,0.7472719 }, 0.657995 ,{ 1,1,1,1 } },Vertex{ { -0.328125,0.4765625,0.7421875 }, 0.425972, { -0.2603902,0.611377,0.7472719 }, 0.654418 ,{ 1,1,1,1 } },Vertex{ { -0.328125,0.4765625,0.7421875 }, 0.425972, { -0.22069597,-0.46899146,0.8551844 }, 0.654418 ,{ 1,1,1,1 } },Vertex{ { -0.328125,0.4765625,0.7421875 }, 0.425972, { -0.16399248,0.36068347,0.9181579 }, 0.654418 ,{ 1,1,1,1 } },Vertex{ { -0.328125,0.4765625,0.7421875 }, 0.425972, { 0.07940337,-0.53212255,0.8429357 }, 0.654418 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.140625,0.75 }, 0.563905, { -0.5721103,-0.4767086,0.66741204 }, 0.727993 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.140625,0.75 }, 0.563905, { -0.50849944,-0.2754997,0.8157991 }, 0.727993 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.140625,0.75 }, 0.563905, { -0.13519809,0.26799625,0.95388657 }, 0.727993 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,0.140625,0.75 }, 0.563905, { 0.009899933,-0.19479868,0.9807933 }, 0.727993 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.140625,0.75 }, 0.475886, { -0.009899933,-0.19479868,0.9807933 }, 0.72692204 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.140625,0.75 }, 0.475886, { 0.13519809,0.26799625,0.95388657 }, 0.72692204 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.140625,0.75 }, 0.475886, { 0.50849944,-0.2754997,0.8157991 }, 0.72692204 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,0.140625,0.75 }, 0.475886, { 0.5721103,-0.4767086,0.66741204 }, 0.72692204 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,0.2109375,0.7578125 }, 0.556923, { -0.50849944,-0.2754997,0.8157991 }, 0.708786 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,0.2109375,0.7578125 }, 0.556923, { -0.38428473,-0.04189834,0.9222634 }, 0.708786 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,0.2109375,0.7578125 }, 0.556923, { 0.009899933,-0.19479868,0.9807933 }, 0.708786 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,0.2109375,0.7578125 }, 0.556923, { 0.18559489,-0.24739319,0.9509738 }, 0.708786 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,0.2109375,0.7578125 }, 0.483433, { -0.18559489,-0.24739319,0.9509738 }, 0.70775104 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,0.2109375,0.7578125 }, 0.483433, { -0.009899933,-0.19479868,0.9807933 }, 0.70775104 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,0.2109375,0.7578125 }, 0.483433, { 0.38428473,-0.04189834,0.9222634 }, 0.70775104 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,0.2109375,0.7578125 }, 0.483433, { 0.50849944,-0.2754997,0.8157991 }, 0.70775104 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.6875,0.734375 }, 0.532669, { -0.0026001106,-0.065602794,0.99784243 }, 0.90908 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.6875,0.734375 }, 0.532669, { 0,0,1 }, 0.90908 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.6875,0.734375 }, 0.532669, { 0.30629015,-0.026499147,0.9515694 }, 0.90908 ,{ 1,1,1,1 } },Vertex{ { 0.1171875,-0.6875,0.734375 }, 0.532669, { 0.32659882,-0.13059954,0.93609667 }, 0.90908 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.6875,0.734375 }, 0.505177, { -0.32659882,-0.13059954,0.93609667 }, 0.909092 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.6875,0.734375 }, 0.505177, { -0.30629015,-0.026499147,0.9515694 }, 0.909092 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.6875,0.734375 }, 0.505177, { 0,0,1 }, 0.909092 ,{ 1,1,1,1 } },Vertex{ { -0.1171875,-0.6875,0.734375 }, 0.505177, { 0.0026001106,-0.065602794,0.99784243 }, 0.909092 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.4453125,0.75 }, 0.532042, { -0.013699415,0.057397548,0.9982574 }, 0.87228703 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.4453125,0.75 }, 0.532042, { -0.0026001106,-0.065602794,0.99784243 }, 0.87228703 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.4453125,0.75 }, 0.532042, { 0.30079153,0.05009859,0.9523732 }, 0.87228703 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.4453125,0.75 }, 0.532042, { 0.30629015,-0.026499147,0.9515694 }, 0.87228703 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.4453125,0.75 }, 0.505828, { -0.30629015,-0.026499147,0.9515694 }, 0.872272 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.4453125,0.75 }, 0.505828, { -0.30079153,0.05009859,0.9523732 }, 0.872272 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.4453125,0.75 }, 0.505828, { 0.0026001106,-0.065602794,0.99784243 }, 0.872272 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.4453125,0.75 }, 0.505828, { 0.013699415,0.057397548,0.9982574 }, 0.872272 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4453125,0.75 }, 0.518941, { -0.013699415,0.057397548,0.9982574 }, 0.871642 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4453125,0.75 }, 0.518941, { -0.0026001106,-0.065602794,0.99784243 }, 0.871642 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4453125,0.75 }, 0.518941, { 0.0026001106,-0.065602794,0.99784243 }, 0.871642 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4453125,0.75 }, 0.518941, { 0.013699415,0.057397548,0.9982574 }, 0.871642 ,{ 1,1,1,1 } },Vertex{ { 0,-0.328125,0.7421875 }, 0.518981, { -0.42068827,-0.87967545,0.22179382 }, 0.848251 ,{ 1,1,1,1 } },Vertex{ { 0,-0.328125,0.7421875 }, 0.518981, { -0.013699415,0.057397548,0.9982574 }, 0.848251 ,{ 1,1,1,1 } },Vertex{ { 0,-0.328125,0.7421875 }, 0.518981, { 0.013699415,0.057397548,0.9982574 }, 0.848251 ,{ 1,1,1,1 } },Vertex{ { 0,-0.328125,0.7421875 }, 0.518981, { 0.42068827,-0.87967545,0.22179382 }, 0.848251 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.2734375,0.78125 }, 0.535214, { 0.2872947,-0.5746894,0.76628584 }, 0.833192 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.2734375,0.78125 }, 0.535214, { 0.38890627,-0.7130115,0.5834094 }, 0.833192 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.2734375,0.78125 }, 0.535214, { 0.42068827,-0.87967545,0.22179382 }, 0.833192 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.2734375,0.78125 }, 0.535214, { 0.81738704,-0.5743909,-0.0441993 }, 0.833192 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.2734375,0.78125 }, 0.502799, { -0.81738704,-0.5743909,-0.0441993 }, 0.833143 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.2734375,0.78125 }, 0.502799, { -0.42068827,-0.87967545,0.22179382 }, 0.833143 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.2734375,0.78125 }, 0.502799, { -0.38890627,-0.7130115,0.5834094 }, 0.833143 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.2734375,0.78125 }, 0.502799, { -0.2872947,-0.5746894,0.76628584 }, 0.833143 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,-0.2265625,0.796875 }, 0.537959, { 0.38890627,-0.7130115,0.5834094 }, 0.824034 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,-0.2265625,0.796875 }, 0.537959, { 0.7581924,0.29159707,0.58319414 }, 0.824034 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,-0.2265625,0.796875 }, 0.537959, { 0.81738704,-0.5743909,-0.0441993 }, 0.824034 ,{ 1,1,1,1 } },Vertex{ { 0.1328125,-0.2265625,0.796875 }, 0.537959, { 0.94935733,0.22968967,-0.21439035 }, 0.824034 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,-0.2265625,0.796875 }, 0.5001, { -0.94935733,0.22968967,-0.21439035 }, 0.823967 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,-0.2265625,0.796875 }, 0.5001, { -0.81738704,-0.5743909,-0.0441993 }, 0.823967 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,-0.2265625,0.796875 }, 0.5001, { -0.7581924,0.29159707,0.58319414 }, 0.823967 ,{ 1,1,1,1 } },Vertex{ { -0.1328125,-0.2265625,0.796875 }, 0.5001, { -0.38890627,-0.7130115,0.5834094 }, 0.823967 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.1328125,0.78125 }, 0.537248, { 0.082496986,0.9072668,-0.41238493 }, 0.812423 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.1328125,0.78125 }, 0.537248, { 0.10519739,0.78918046,0.60508496 }, 0.812423 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.1328125,0.78125 }, 0.537248, { 0.7581924,0.29159707,0.58319414 }, 0.812423 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.1328125,0.78125 }, 0.537248, { 0.94935733,0.22968967,-0.21439035 }, 0.812423 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.1328125,0.78125 }, 0.50089, { -0.94935733,0.22968967,-0.21439035 }, 0.812429 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.1328125,0.78125 }, 0.50089, { -0.7581924,0.29159707,0.58319414 }, 0.812429 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.1328125,0.78125 }, 0.50089, { -0.10519739,0.78918046,0.60508496 }, 0.812429 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.1328125,0.78125 }, 0.50089, { -0.082496986,0.9072668,-0.41238493 }, 0.812429 ,{ 1,1,1,1 } },Vertex{ { 0.0390625,-0.125,0.78125 }, 0.528757, { -0.8836127,0.3555051,0.30470437 }, 0.808215 ,{ 1,1,1,1 } },Vertex{ { 0.0390625,-0.125,0.78125 }, 0.528757, { -0.65419173,0.60189235,0.45799422 }, 0.808215 ,{ 1,1,1,1 } },Vertex{ { 0.0390625,-0.125,0.78125 }, 0.528757, { 0.082496986,0.9072668,-0.41238493 }, 0.808215 ,{ 1,1,1,1 } },Vertex{ { 0.0390625,-0.125,0.78125 }, 0.528757, { 0.10519739,0.78918046,0.60508496 }, 0.808215 ,{ 1,1,1,1 } },Vertex{ { -0.0390625,-0.125,0.78125 }, 0.509219, { -0.10519739,0.78918046,0.60508496 }, 0.808374 ,{ 1,1,1,1 } },Vertex{ { -0.0390625,-0.125,0.78125 }, 0.509219, { -0.082496986,0.9072668,-0.41238493 }, 0.808374 ,{ 1,1,1,1 } },Vertex{ { -0.0390625,-0.125,0.78125 }, 0.509219, { 0.65419173,0.60189235,0.45799422 }, 0.808374 ,{ 1,1,1,1 } },Vertex{ { -0.0390625,-0.125,0.78125 }, 0.509219, { 0.8836127,0.3555051,0.30470437 }, 0.808374 ,{ 1,1,1,1 } },Vertex{ { 0,-0.203125,0.828125 }, 0.519099, { -0.65419173,0.60189235,0.45799422 }, 0.820543 ,{ 1,1,1,1 } },Vertex{ { 0,-0.203125,0.828125 }, 0.519099, { -0.04629804,0.23139018,0.9717588 }, 0.820543 ,{ 1,1,1,1 } },Vertex{ { 0,-0.203125,0.828125 }, 0.519099, { -0.033500448,-0.40180534,0.91511214 }, 0.820543 ,{ 1,1,1,1 } },Vertex{ { 0,-0.203125,0.828125 }, 0.519099, { 0.033500448,-0.40180534,0.91511214 }, 0.820543 ,{ 1,1,1,1 } },Vertex{ { 0,-0.203125,0.828125 }, 0.519099, { 0.04629804,0.23139018,0.9717588 }, 0.820543 ,{ 1,1,1,1 } },Vertex{ { 0,-0.203125,0.828125 }, 0.519099, { 0.65419173,0.60189235,0.45799422 }, 0.820543 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.1484375,0.8125 }, 0.528222, { -0.65419173,0.60189235,0.45799422 }, 0.813684 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.1484375,0.8125 }, 0.528222, { 0.04629804,0.23139018,0.9717588 }, 0.813684 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.1484375,0.8125 }, 0.528222, { 0.10519739,0.78918046,0.60508496 }, 0.813684 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.1484375,0.8125 }, 0.509787, { -0.10519739,0.78918046,0.60508496 }, 0.81374 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.1484375,0.8125 }, 0.509787, { -0.04629804,0.23139018,0.9717588 }, 0.81374 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.1484375,0.8125 }, 0.509787, { 0.65419173,0.60189235,0.45799422 }, 0.81374 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.15625,0.8125 }, 0.533528, { 0.04629804,0.23139018,0.9717588 }, 0.815785 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.15625,0.8125 }, 0.533528, { 0.10519739,0.78918046,0.60508496 }, 0.815785 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.15625,0.8125 }, 0.533528, { 0.7581924,0.29159707,0.58319414 }, 0.815785 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.15625,0.8125 }, 0.504547, { -0.7581924,0.29159707,0.58319414 }, 0.815794 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.15625,0.8125 }, 0.504547, { -0.10519739,0.78918046,0.60508496 }, 0.815794 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.15625,0.8125 }, 0.504547, { -0.04629804,0.23139018,0.9717588 }, 0.815794 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.2265625,0.828125 }, 0.533449, { 0.033500448,-0.40180534,0.91511214 }, 0.823261 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.2265625,0.828125 }, 0.533449, { 0.04629804,0.23139018,0.9717588 }, 0.823261 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.2265625,0.828125 }, 0.533449, { 0.38890627,-0.7130115,0.5834094 }, 0.823261 ,{ 1,1,1,1 } },Vertex{ { 0.109375,-0.2265625,0.828125 }, 0.533449, { 0.7581924,0.29159707,0.58319414 }, 0.823261 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.2265625,0.828125 }, 0.504604, { -0.7581924,0.29159707,0.58319414 }, 0.823209 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.2265625,0.828125 }, 0.504604, { -0.38890627,-0.7130115,0.5834094 }, 0.823209 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.2265625,0.828125 }, 0.504604, { -0.04629804,0.23139018,0.9717588 }, 0.823209 ,{ 1,1,1,1 } },Vertex{ { -0.109375,-0.2265625,0.828125 }, 0.504604, { -0.033500448,-0.40180534,0.91511214 }, 0.823209 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.25,0.8046875 }, 0.531131, { 0.033500448,-0.40180534,0.91511214 }, 0.828369 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.25,0.8046875 }, 0.531131, { 0.2872947,-0.5746894,0.76628584 }, 0.828369 ,{ 1,1,1,1 } },Vertex{ { 0.078125,-0.25,0.8046875 }, 0.531131, { 0.38890627,-0.7130115,0.5834094 }, 0.828369 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.25,0.8046875 }, 0.50691, { -0.38890627,-0.7130115,0.5834094 }, 0.828333 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.25,0.8046875 }, 0.50691, { -0.2872947,-0.5746894,0.76628584 }, 0.828333 ,{ 1,1,1,1 } },Vertex{ { -0.078125,-0.25,0.8046875 }, 0.50691, { -0.033500448,-0.40180534,0.91511214 }, 0.828333 ,{ 1,1,1,1 } },Vertex{ { 0,-0.2890625,0.8046875 }, 0.519016, { -0.2872947,-0.5746894,0.76628584 }, 0.834401 ,{ 1,1,1,1 } },Vertex{ { 0,-0.2890625,0.8046875 }, 0.519016, { -0.033500448,-0.40180534,0.91511214 }, 0.834401 ,{ 1,1,1,1 } },Vertex{ { 0,-0.2890625,0.8046875 }, 0.519016, { 0.033500448,-0.40180534,0.91511214 }, 0.834401 ,{ 1,1,1,1 } },Vertex{ { 0,-0.2890625,0.8046875 }, 0.519016, { 0.2872947,-0.5746894,0.76628584 }, 0.834401 ,{ 1,1,1,1 } },Vertex{ { 0.2578125,-0.3125,0.5546875 }, 0.596138, { 0.81228685,0.3009951,0.4995919 }, 0.866574 ,{ 1,1,1,1 } },Vertex{ { 0.2578125,-0.3125,0.5546875 }, 0.596138, { 0.87533003,0.25740886,0.40931407 }, 0.866574 ,{ 1,1,1,1 } },Vertex{ { 0.2578125,-0.3125,0.5546875 }, 0.596138, { 0.9120182,0.33760673,-0.23290463 }, 0.866574 ,{ 1,1,1,1 } },Vertex{ { 0.2578125,-0.3125,0.5546875 }, 0.596138, { 0.92973965,0.31271333,-0.19440828 }, 0.866574 ,{ 1,1,1,1 } },Vertex{ { -0.2578125,-0.3125,0.5546875 }, 0.441395, { -0.92973965,0.31271333,-0.19440828 }, 0.866408 ,{ 1,1,1,1 } },Vertex{ { -0.2578125,-0.3125,0.5546875 }, 0.441395, { -0.9120182,0.33760673,-0.23290463 }, 0.866408 ,{ 1,1,1,1 } },Vertex{ { -0.2578125,-0.3125,0.5546875 }, 0.441395, { -0.87533003,0.25740886,0.40931407 }, 0.866408 ,{ 1,1,1,1 } },Vertex{ { -0.2578125,-0.3125,0.5546875 }, 0.441395, { -0.81228685,0.3009951,0.4995919 }, 0.866408 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.2421875,0.7109375 }, 0.561572, { -0.21819885,-0.4363977,0.8728954 }, 0.83222103 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.2421875,0.7109375 }, 0.561572, { 0.43409255,-0.12899777,0.8915847 }, 0.83222103 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.2421875,0.7109375 }, 0.561572, { 0.87533003,0.25740886,0.40931407 }, 0.83222103 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.2421875,0.7109375 }, 0.561572, { 0.9384765,0.16009599,0.30599234 }, 0.83222103 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.2421875,0.7109375 }, 0.476363, { -0.9384765,0.16009599,0.30599234 }, 0.832004 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.2421875,0.7109375 }, 0.476363, { -0.87533003,0.25740886,0.40931407 }, 0.832004 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.2421875,0.7109375 }, 0.476363, { -0.43409255,-0.12899777,0.8915847 }, 0.832004 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.2421875,0.7109375 }, 0.476363, { 0.21819885,-0.4363977,0.8728954 }, 0.832004 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.3125,0.7109375 }, 0.559475, { 0.30079153,0.05009859,0.9523732 }, 0.850681 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.3125,0.7109375 }, 0.559475, { 0.43409255,-0.12899777,0.8915847 }, 0.850681 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.3125,0.7109375 }, 0.559475, { 0.81228685,0.3009951,0.4995919 }, 0.850681 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.3125,0.7109375 }, 0.559475, { 0.87533003,0.25740886,0.40931407 }, 0.850681 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.3125,0.7109375 }, 0.478371, { -0.87533003,0.25740886,0.40931407 }, 0.85055304 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.3125,0.7109375 }, 0.478371, { -0.81228685,0.3009951,0.4995919 }, 0.85055304 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.3125,0.7109375 }, 0.478371, { -0.43409255,-0.12899777,0.8915847 }, 0.85055304 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.3125,0.7109375 }, 0.478371, { -0.30079153,0.05009859,0.9523732 }, 0.85055304 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.25,0.5546875 }, 0.601169, { 0.87533003,0.25740886,0.40931407 }, 0.85211504 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.25,0.5546875 }, 0.601169, { 0.92973965,0.31271333,-0.19440828 }, 0.85211504 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.25,0.5546875 }, 0.601169, { 0.9384765,0.16009599,0.30599234 }, 0.85211504 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.25,0.5546875 }, 0.601169, { 0.940689,0.33379608,-0.06069929 }, 0.85211504 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.25,0.5546875 }, 0.436337, { -0.940689,0.33379608,-0.06069929 }, 0.851806 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.25,0.5546875 }, 0.436337, { -0.9384765,0.16009599,0.30599234 }, 0.851806 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.25,0.5546875 }, 0.436337, { -0.92973965,0.31271333,-0.19440828 }, 0.851806 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.25,0.5546875 }, 0.436337, { -0.87533003,0.25740886,0.40931407 }, 0.851806 ,{ 1,1,1,1 } },Vertex{ { 0,-0.875,0.6875 }, 0.518929, { -0.15820068,0.9494041,0.27130118 }, 0.930532 ,{ 1,1,1,1 } },Vertex{ { 0,-0.875,0.6875 }, 0.518929, { -0.097599536,0.19519907,0.97589535 }, 0.930532 ,{ 1,1,1,1 } },Vertex{ { 0,-0.875,0.6875 }, 0.518929, { 0.097599536,0.19519907,0.97589535 }, 0.930532 ,{ 1,1,1,1 } },Vertex{ { 0,-0.875,0.6875 }, 0.518929, { 0.15820068,0.9494041,0.27130118 }, 0.930532 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8671875,0.6875 }, 0.523751, { -0.6934047,0.7082047,0.13280088 }, 0.929492 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8671875,0.6875 }, 0.523751, { -0.2732875,-0.10249532,0.9564563 }, 0.929492 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8671875,0.6875 }, 0.523751, { -0.15820068,0.9494041,0.27130118 }, 0.929492 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8671875,0.6875 }, 0.523751, { -0.097599536,0.19519907,0.97589535 }, 0.929492 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8671875,0.6875 }, 0.514106, { 0.097599536,0.19519907,0.97589535 }, 0.92949903 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8671875,0.6875 }, 0.514106, { 0.15820068,0.9494041,0.27130118 }, 0.92949903 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8671875,0.6875 }, 0.514106, { 0.2732875,-0.10249532,0.9564563 }, 0.92949903 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8671875,0.6875 }, 0.514106, { 0.6934047,0.7082047,0.13280088 }, 0.92949903 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8203125,0.7109375 }, 0.529036, { -1,0,-0 }, 0.924571 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8203125,0.7109375 }, 0.529036, { -0.6934047,0.7082047,0.13280088 }, 0.924571 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8203125,0.7109375 }, 0.529036, { -0.2732875,-0.10249532,0.9564563 }, 0.924571 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8203125,0.7109375 }, 0.529036, { -0.15360643,-0.19970836,0.9677405 }, 0.924571 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8203125,0.7109375 }, 0.50882, { 0.15360643,-0.19970836,0.9677405 }, 0.924585 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8203125,0.7109375 }, 0.50882, { 0.2732875,-0.10249532,0.9564563 }, 0.924585 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8203125,0.7109375 }, 0.50882, { 0.6934047,0.7082047,0.13280088 }, 0.924585 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8203125,0.7109375 }, 0.50882, { 1,0,-0 }, 0.924585 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.7421875,0.7265625 }, 0.528933, { -1,0,-0 }, 0.915043 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.7421875,0.7265625 }, 0.528933, { -0.15360643,-0.19970836,0.9677405 }, 0.915043 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.7421875,0.7265625 }, 0.528933, { 0.2237087,-0.6539255,0.72272813 }, 0.915043 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.7421875,0.7265625 }, 0.528933, { 0.30509105,-0.9449723,0.11809654 }, 0.915043 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.7421875,0.7265625 }, 0.508915, { -0.30509105,-0.9449723,0.11809654 }, 0.915055 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.7421875,0.7265625 }, 0.508915, { -0.2237087,-0.6539255,0.72272813 }, 0.915055 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.7421875,0.7265625 }, 0.508915, { 0.15360643,-0.19970836,0.9677405 }, 0.915055 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.7421875,0.7265625 }, 0.508915, { 1,0,-0 }, 0.915055 ,{ 1,1,1,1 } },Vertex{ { 0,-0.78125,0.65625 }, 0.518926, { -0.30509105,-0.9449723,0.11809654 }, 0.920669 ,{ 1,1,1,1 } },Vertex{ { 0,-0.78125,0.65625 }, 0.518926, { -0.02979913,-0.2980913,0.9540722 }, 0.920669 ,{ 1,1,1,1 } },Vertex{ { 0,-0.78125,0.65625 }, 0.518926, { 0.02979913,-0.2980913,0.9540722 }, 0.920669 ,{ 1,1,1,1 } },Vertex{ { 0,-0.78125,0.65625 }, 0.518926, { 0.30509105,-0.9449723,0.11809654 }, 0.920669 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.75,0.6640625 }, 0.524601, { -1,0,-0 }, 0.920114 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.75,0.6640625 }, 0.524601, { 0.02979913,-0.2980913,0.9540722 }, 0.920114 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.75,0.6640625 }, 0.524601, { 0.13530219,-0.34790564,0.92771494 }, 0.920114 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.75,0.6640625 }, 0.524601, { 0.30509105,-0.9449723,0.11809654 }, 0.920114 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.75,0.6640625 }, 0.513252, { -0.30509105,-0.9449723,0.11809654 }, 0.920121 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.75,0.6640625 }, 0.513252, { -0.13530219,-0.34790564,0.92771494 }, 0.920121 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.75,0.6640625 }, 0.513252, { -0.02979913,-0.2980913,0.9540722 }, 0.920121 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.75,0.6640625 }, 0.513252, { 1,0,-0 }, 0.920121 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8125,0.640625 }, 0.524236, { -1,0,-0 }, 0.92330897 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8125,0.640625 }, 0.524236, { -0.6934047,0.7082047,0.13280088 }, 0.92330897 ,{ 1,1,1,1 } },Vertex{ { 0.09375,-0.8125,0.640625 }, 0.524236, { 0.13530219,-0.34790564,0.92771494 }, 0.92330897 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8125,0.640625 }, 0.513619, { -0.13530219,-0.34790564,0.92771494 }, 0.923316 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8125,0.640625 }, 0.513619, { 0.6934047,0.7082047,0.13280088 }, 0.923316 ,{ 1,1,1,1 } },Vertex{ { -0.09375,-0.8125,0.640625 }, 0.513619, { 1,0,-0 }, 0.923316 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8515625,0.6328125 }, 0.52156, { -0.6934047,0.7082047,0.13280088 }, 0.92503 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8515625,0.6328125 }, 0.52156, { -0.15820068,0.9494041,0.27130118 }, 0.92503 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8515625,0.6328125 }, 0.52156, { 0.02979913,-0.2980913,0.9540722 }, 0.92503 ,{ 1,1,1,1 } },Vertex{ { 0.046875,-0.8515625,0.6328125 }, 0.52156, { 0.13530219,-0.34790564,0.92771494 }, 0.92503 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8515625,0.6328125 }, 0.516297, { -0.13530219,-0.34790564,0.92771494 }, 0.925034 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8515625,0.6328125 }, 0.516297, { -0.02979913,-0.2980913,0.9540722 }, 0.925034 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8515625,0.6328125 }, 0.516297, { 0.15820068,0.9494041,0.27130118 }, 0.925034 ,{ 1,1,1,1 } },Vertex{ { -0.046875,-0.8515625,0.6328125 }, 0.516297, { 0.6934047,0.7082047,0.13280088 }, 0.925034 ,{ 1,1,1,1 } },Vertex{ { 0,-0.859375,0.6328125 }, 0.518928, { -0.15820068,0.9494041,0.27130118 }, 0.925741 ,{ 1,1,1,1 } },Vertex{ { 0,-0.859375,0.6328125 }, 0.518928, { -0.02979913,-0.2980913,0.9540722 }, 0.925741 ,{ 1,1,1,1 } },Vertex{ { 0,-0.859375,0.6328125 }, 0.518928, { 0.02979913,-0.2980913,0.9540722 }, 0.925741 ,{ 1,1,1,1 } },Vertex{ { 0,-0.859375,0.6328125 }, 0.518928, { 0.15820068,0.9494041,0.27130118 }, 0.925741 ,{ 1,1,1,1 } },Vertex{ { 0.171875,0.21875,0.78125 }, 0.568351, { -0.50849944,-0.2754997,0.8157991 }, 0.707096 ,{ 1,1,1,1 } },Vertex{ { 0.171875,0.21875,0.78125 }, 0.568351, { -0.38428473,-0.04189834,0.9222634 }, 0.707096 ,{ 1,1,1,1 } },Vertex{ { 0.171875,0.21875,0.78125 }, 0.568351, { 0.78400344,0.11610051,0.60980266 }, 0.707096 ,{ 1,1,1,1 } },Vertex{ { 0.171875,0.21875,0.78125 }, 0.568351, { 0.81649953,-0.073099956,0.57269967 }, 0.707096 ,{ 1,1,1,1 } },Vertex{ { -0.171875,0.21875,0.78125 }, 0.471978, { -0.81649953,-0.073099956,0.57269967 }, 0.70571804 ,{ 1,1,1,1 } },Vertex{ { -0.171875,0.21875,0.78125 }, 0.471978, { -0.78400344,0.11610051,0.60980266 }, 0.70571804 ,{ 1,1,1,1 } },Vertex{ { -0.171875,0.21875,0.78125 }, 0.471978, { 0.38428473,-0.04189834,0.9222634 }, 0.70571804 ,{ 1,1,1,1 } },Vertex{ { -0.171875,0.21875,0.78125 }, 0.471978, { 0.50849944,-0.2754997,0.8157991 }, 0.70571804 ,{ 1,1,1,1 } },Vertex{ { 0.1875,0.15625,0.7734375 }, 0.571787, { -0.5721103,-0.4767086,0.66741204 }, 0.722705 ,{ 1,1,1,1 } },Vertex{ { 0.1875,0.15625,0.7734375 }, 0.571787, { -0.50849944,-0.2754997,0.8157991 }, 0.722705 ,{ 1,1,1,1 } },Vertex{ { 0.1875,0.15625,0.7734375 }, 0.571787, { 0.49879423,0.52999383,0.6857921 }, 0.722705 ,{ 1,1,1,1 } },Vertex{ { 0.1875,0.15625,0.7734375 }, 0.571787, { 0.78400344,0.11610051,0.60980266 }, 0.722705 ,{ 1,1,1,1 } },Vertex{ { -0.1875,0.15625,0.7734375 }, 0.46807, { -0.78400344,0.11610051,0.60980266 }, 0.721383 ,{ 1,1,1,1 } },Vertex{ { -0.1875,0.15625,0.7734375 }, 0.46807, { -0.49879423,0.52999383,0.6857921 }, 0.721383 ,{ 1,1,1,1 } },Vertex{ { -0.1875,0.15625,0.7734375 }, 0.46807, { 0.50849944,-0.2754997,0.8157991 }, 0.721383 ,{ 1,1,1,1 } },Vertex{ { -0.1875,0.15625,0.7734375 }, 0.46807, { 0.5721103,-0.4767086,0.66741204 }, 0.721383 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.4296875,0.7578125 }, 0.614408, { -0.25419724,-0.65139294,0.71489227 }, 0.668028 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.4296875,0.7578125 }, 0.614408, { 0.16399248,0.36068347,0.9181579 }, 0.668028 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.4296875,0.7578125 }, 0.614408, { 0.2603902,0.611377,0.7472719 }, 0.668028 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.4296875,0.7578125 }, 0.614408, { 0.28110135,-0.26100126,0.9235044 }, 0.668028 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.4296875,0.7578125 }, 0.426727, { -0.28110135,-0.26100126,0.9235044 }, 0.664639 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.4296875,0.7578125 }, 0.426727, { -0.2603902,0.611377,0.7472719 }, 0.664639 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.4296875,0.7578125 }, 0.426727, { -0.16399248,0.36068347,0.9181579 }, 0.664639 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.4296875,0.7578125 }, 0.426727, { 0.25419724,-0.65139294,0.71489227 }, 0.664639 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.421875,0.7734375 }, 0.601033, { -0.017800191,0.2495027,0.96821046 }, 0.666376 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.421875,0.7734375 }, 0.601033, { 0.16399248,0.36068347,0.9181579 }, 0.666376 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.421875,0.7734375 }, 0.601033, { 0.28110135,-0.26100126,0.9235044 }, 0.666376 ,{ 1,1,1,1 } },Vertex{ { 0.2734375,0.421875,0.7734375 }, 0.601033, { 0.32730746,-0.41660947,0.8481193 }, 0.666376 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.421875,0.7734375 }, 0.440344, { -0.32730746,-0.41660947,0.8481193 }, 0.663463 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.421875,0.7734375 }, 0.440344, { -0.28110135,-0.26100126,0.9235044 }, 0.663463 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.421875,0.7734375 }, 0.440344, { -0.16399248,0.36068347,0.9181579 }, 0.663463 ,{ 1,1,1,1 } },Vertex{ { -0.2734375,0.421875,0.7734375 }, 0.440344, { 0.017800191,0.2495027,0.96821046 }, 0.663463 ,{ 1,1,1,1 } },Vertex{ { 0.421875,0.3984375,0.7734375 }, 0.62904, { -0.25419724,-0.65139294,0.71489227 }, 0.676136 ,{ 1,1,1,1 } },Vertex{ { 0.421875,0.3984375,0.7734375 }, 0.62904, { -0.026000585,-0.845519,0.53331196 }, 0.676136 ,{ 1,1,1,1 } },Vertex{ { 0.421875,0.3984375,0.7734375 }, 0.62904, { 0.2603902,0.611377,0.7472719 }, 0.676136 ,{ 1,1,1,1 } },Vertex{ { 0.421875,0.3984375,0.7734375 }, 0.62904, { 0.48229536,0.56209457,0.6718935 }, 0.676136 ,{ 1,1,1,1 } },Vertex{ { -0.421875,0.3984375,0.7734375 }, 0.411556, { -0.48229536,0.56209457,0.6718935 }, 0.67232704 ,{ 1,1,1,1 } },Vertex{ { -0.421875,0.3984375,0.7734375 }, 0.411556, { -0.2603902,0.611377,0.7472719 }, 0.67232704 ,{ 1,1,1,1 } },Vertex{ { -0.421875,0.3984375,0.7734375 }, 0.411556, { 0.026000585,-0.845519,0.53331196 }, 0.67232704 ,{ 1,1,1,1 } },Vertex{ { -0.421875,0.3984375,0.7734375 }, 0.411556, { 0.25419724,-0.65139294,0.71489227 }, 0.67232704 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.3515625,0.6953125 }, 0.652752, { -0.3517901,-0.26059267,0.89907473 }, 0.689814 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.3515625,0.6953125 }, 0.652752, { -0.026000585,-0.845519,0.53331196 }, 0.689814 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.3515625,0.6953125 }, 0.652752, { 0.48229536,0.56209457,0.6718935 }, 0.689814 ,{ 1,1,1,1 } },Vertex{ { 0.5625,0.3515625,0.6953125 }, 0.652752, { 0.57030785,0.118001625,0.8129112 }, 0.689814 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.3515625,0.6953125 }, 0.386858, { -0.57030785,0.118001625,0.8129112 }, 0.685385 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.3515625,0.6953125 }, 0.386858, { -0.48229536,0.56209457,0.6718935 }, 0.685385 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.3515625,0.6953125 }, 0.386858, { 0.026000585,-0.845519,0.53331196 }, 0.685385 ,{ 1,1,1,1 } },Vertex{ { -0.5625,0.3515625,0.6953125 }, 0.386858, { 0.3517901,-0.26059267,0.89907473 }, 0.685385 ,{ 1,1,1,1 } },Vertex{ { 0.5859375,0.2890625,0.6875 }, 0.656064, { -0.3523074,-0.011000232,0.9358197 }, 0.70236397 ,{ 1,1,1,1 } },Vertex{ { 0.5859375,0.2890625,0.6875 }, 0.656064, { -0.3517901,-0.26059267,0.89907473 }, 0.70236397 ,{ 1,1,1,1 } },Vertex{ { 0.5859375,0.2890625,0.6875 }, 0.656064, { 0.56652623,-0.096804485,0.8183379 }, 0.70236397 ,{ 1,1,1,1 } },Vertex{ { 0.5859375,0.2890625,0.6875 }, 0.656064, { 0.57030785,0.118001625,0.8129112 }, 0.70236397 ,{ 1,1,1,1 } },Vertex{ { -0.5859375,0.2890625,0.6875 }, 0.383015, { -0.57030785,0.118001625,0.8129112 }, 0.698136 ,{ 1,1,1,1 } },Vertex{ { -0.5859375,0.2890625,0.6875 }, 0.383015, { -0.56652623,-0.096804485,0.8183379 }, 0.698136 ,{ 1,1,1,1 } },Vertex{ { -0.5859375,0.2890625,0.6875 }, 0.383015, { 0.3517901,-0.26059267,0.89907473 }, 0.698136 ,{ 1,1,1,1 } },Vertex{ { -0.5859375,0.2890625,0.6875 }, 0.383015, { 0.3523074,-0.011000232,0.9358197 }, 0.698136 ,{ 1,1,1,1 } },Vertex{ { 0.578125,0.1953125,0.6796875 }, 0.653658, { -0.3523074,-0.011000232,0.9358197 }, 0.720029 ,{ 1,1,1,1 } },Vertex{ { 0.578125,0.1953125,0.6796875 }, 0.653658, { -0.13169745,0.46079108,0.87768304 }, 0.720029 ,{ 1,1,1,1 } },Vertex{ { 0.578125,0.1953125,0.6796875 }, 0.653658, { 0.56652623,-0.096804485,0.8183379 }, 0.720029 ,{ 1,1,1,1 } },Vertex{ { 0.578125,0.1953125,0.6796875 }, 0.653658, { 0.5740304,-0.41302186,0.7070375 }, 0.720029 ,{ 1,1,1,1 } },Vertex{ { -0.578125,0.1953125,0.6796875 }, 0.384904, { -0.5740304,-0.41302186,0.7070375 }, 0.716366 ,{ 1,1,1,1 } },Vertex{ { -0.578125,0.1953125,0.6796875 }, 0.384904, { -0.56652623,-0.096804485,0.8183379 }, 0.716366 ,{ 1,1,1,1 } },Vertex{ { -0.578125,0.1953125,0.6796875 }, 0.384904, { 0.13169745,0.46079108,0.87768304 }, 0.716366 ,{ 1,1,1,1 } },Vertex{ { -0.578125,0.1953125,0.6796875 }, 0.384904, { 0.3523074,-0.011000232,0.9358197 }, 0.716366 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.1015625,0.71875 }, 0.632494, { -0.13169745,0.46079108,0.87768304 }, 0.737147 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.1015625,0.71875 }, 0.632494, { -0.0342022,0.6159396,0.7870506 }, 0.737147 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.1015625,0.71875 }, 0.632494, { 0.4088013,-0.6071019,0.6814021 }, 0.737147 ,{ 1,1,1,1 } },Vertex{ { 0.4765625,0.1015625,0.71875 }, 0.632494, { 0.5740304,-0.41302186,0.7070375 }, 0.737147 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.1015625,0.71875 }, 0.406068, { -0.5740304,-0.41302186,0.7070375 }, 0.734492 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.1015625,0.71875 }, 0.406068, { -0.4088013,-0.6071019,0.6814021 }, 0.734492 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.1015625,0.71875 }, 0.406068, { 0.0342022,0.6159396,0.7870506 }, 0.734492 ,{ 1,1,1,1 } },Vertex{ { -0.4765625,0.1015625,0.71875 }, 0.406068, { 0.13169745,0.46079108,0.87768304 }, 0.734492 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.0625,0.7421875 }, 0.61172, { -0.13690044,-0.7531024,0.64350206 }, 0.744275 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.0625,0.7421875 }, 0.61172, { -0.0342022,0.6159396,0.7870506 }, 0.744275 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.0625,0.7421875 }, 0.61172, { 0.3603086,0.5836139,0.72771734 }, 0.744275 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.0625,0.7421875 }, 0.61172, { 0.4088013,-0.6071019,0.6814021 }, 0.744275 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.0625,0.7421875 }, 0.427062, { -0.4088013,-0.6071019,0.6814021 }, 0.742272 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.0625,0.7421875 }, 0.427062, { -0.3603086,0.5836139,0.72771734 }, 0.742272 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.0625,0.7421875 }, 0.427062, { 0.0342022,0.6159396,0.7870506 }, 0.742272 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.0625,0.7421875 }, 0.427062, { 0.13690044,-0.7531024,0.64350206 }, 0.742272 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.109375,0.78125 }, 0.580734, { -0.5721103,-0.4767086,0.66741204 }, 0.73337996 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.109375,0.78125 }, 0.580734, { -0.13690044,-0.7531024,0.64350206 }, 0.73337996 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.109375,0.78125 }, 0.580734, { 0.3603086,0.5836139,0.72771734 }, 0.73337996 ,{ 1,1,1,1 } },Vertex{ { 0.2265625,0.109375,0.78125 }, 0.580734, { 0.49879423,0.52999383,0.6857921 }, 0.73337996 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.109375,0.78125 }, 0.458737, { -0.49879423,0.52999383,0.6857921 }, 0.731951 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.109375,0.78125 }, 0.458737, { -0.3603086,0.5836139,0.72771734 }, 0.731951 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.109375,0.78125 }, 0.458737, { 0.13690044,-0.7531024,0.64350206 }, 0.731951 ,{ 1,1,1,1 } },Vertex{ { -0.2265625,0.109375,0.78125 }, 0.458737, { 0.5721103,-0.4767086,0.66741204 }, 0.731951 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,0.296875,0.78125 }, 0.573085, { -0.38428473,-0.04189834,0.9222634 }, 0.688614 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,0.296875,0.78125 }, 0.573085, { -0.20828974,0.03739816,0.9773519 }, 0.688614 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,0.296875,0.78125 }, 0.573085, { 0.66667783,-0.3332889,0.66667783 }, 0.688614 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,0.296875,0.78125 }, 0.573085, { 0.81649953,-0.073099956,0.57269967 }, 0.688614 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,0.296875,0.78125 }, 0.46779, { -0.81649953,-0.073099956,0.57269967 }, 0.686919 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,0.296875,0.78125 }, 0.46779, { -0.66667783,-0.3332889,0.66667783 }, 0.686919 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,0.296875,0.78125 }, 0.46779, { 0.20828974,0.03739816,0.9773519 }, 0.686919 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,0.296875,0.78125 }, 0.46779, { 0.38428473,-0.04189834,0.9222634 }, 0.686919 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,0.375,0.78125 }, 0.584855, { -0.20828974,0.03739816,0.9773519 }, 0.672292 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,0.375,0.78125 }, 0.584855, { -0.017800191,0.2495027,0.96821046 }, 0.672292 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,0.375,0.78125 }, 0.584855, { 0.32730746,-0.41660947,0.8481193 }, 0.672292 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,0.375,0.78125 }, 0.584855, { 0.66667783,-0.3332889,0.66667783 }, 0.672292 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,0.375,0.78125 }, 0.456477, { -0.66667783,-0.3332889,0.66667783 }, 0.670039 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,0.375,0.78125 }, 0.456477, { -0.32730746,-0.41660947,0.8481193 }, 0.670039 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,0.375,0.78125 }, 0.456477, { 0.017800191,0.2495027,0.96821046 }, 0.670039 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,0.375,0.78125 }, 0.456477, { 0.20828974,0.03739816,0.9773519 }, 0.670039 ,{ 1,1,1,1 } },Vertex{ { 0.234375,0.359375,0.7578125 }, 0.590644, { 0.32730746,-0.41660947,0.8481193 }, 0.67848396 ,{ 1,1,1,1 } },Vertex{ { 0.234375,0.359375,0.7578125 }, 0.590644, { 0.66667783,-0.3332889,0.66667783 }, 0.67848396 ,{ 1,1,1,1 } },Vertex{ { -0.234375,0.359375,0.7578125 }, 0.450408, { -0.66667783,-0.3332889,0.66667783 }, 0.676081 ,{ 1,1,1,1 } },Vertex{ { -0.234375,0.359375,0.7578125 }, 0.450408, { -0.32730746,-0.41660947,0.8481193 }, 0.676081 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.296875,0.7578125 }, 0.579548, { 0.66667783,-0.3332889,0.66667783 }, 0.69066 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.296875,0.7578125 }, 0.579548, { 0.81649953,-0.073099956,0.57269967 }, 0.69066 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.296875,0.7578125 }, 0.461204, { -0.81649953,-0.073099956,0.57269967 }, 0.68876696 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.296875,0.7578125 }, 0.461204, { -0.66667783,-0.3332889,0.66667783 }, 0.68876696 ,{ 1,1,1,1 } },Vertex{ { 0.2421875,0.125,0.7578125 }, 0.585166, { 0.3603086,0.5836139,0.72771734 }, 0.72900903 ,{ 1,1,1,1 } },Vertex{ { 0.2421875,0.125,0.7578125 }, 0.585166, { 0.49879423,0.52999383,0.6857921 }, 0.72900903 ,{ 1,1,1,1 } },Vertex{ { -0.2421875,0.125,0.7578125 }, 0.454369, { -0.49879423,0.52999383,0.6857921 }, 0.727417 ,{ 1,1,1,1 } },Vertex{ { -0.2421875,0.125,0.7578125 }, 0.454369, { -0.3603086,0.5836139,0.72771734 }, 0.727417 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.0859375,0.7265625 }, 0.612641, { -0.0342022,0.6159396,0.7870506 }, 0.73844004 ,{ 1,1,1,1 } },Vertex{ { 0.375,0.0859375,0.7265625 }, 0.612641, { 0.3603086,0.5836139,0.72771734 }, 0.73844004 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.0859375,0.7265625 }, 0.426254, { -0.3603086,0.5836139,0.72771734 }, 0.736307 ,{ 1,1,1,1 } },Vertex{ { -0.375,0.0859375,0.7265625 }, 0.426254, { 0.0342022,0.6159396,0.7870506 }, 0.736307 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.1171875,0.703125 }, 0.629829, { -0.13169745,0.46079108,0.87768304 }, 0.732737 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.1171875,0.703125 }, 0.629829, { -0.0342022,0.6159396,0.7870506 }, 0.732737 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.1171875,0.703125 }, 0.408893, { 0.0342022,0.6159396,0.7870506 }, 0.730041 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.1171875,0.703125 }, 0.408893, { 0.13169745,0.46079108,0.87768304 }, 0.730041 ,{ 1,1,1,1 } },Vertex{ { 0.546875,0.2109375,0.671875 }, 0.647785, { -0.3523074,-0.011000232,0.9358197 }, 0.716514 ,{ 1,1,1,1 } },Vertex{ { 0.546875,0.2109375,0.671875 }, 0.647785, { -0.13169745,0.46079108,0.87768304 }, 0.716514 ,{ 1,1,1,1 } },Vertex{ { -0.546875,0.2109375,0.671875 }, 0.39104, { 0.13169745,0.46079108,0.87768304 }, 0.712929 ,{ 1,1,1,1 } },Vertex{ { -0.546875,0.2109375,0.671875 }, 0.39104, { 0.3523074,-0.011000232,0.9358197 }, 0.712929 ,{ 1,1,1,1 } },Vertex{ { 0.5546875,0.28125,0.671875 }, 0.649541, { -0.3523074,-0.011000232,0.9358197 }, 0.703775 ,{ 1,1,1,1 } },Vertex{ { 0.5546875,0.28125,0.671875 }, 0.649541, { -0.3517901,-0.26059267,0.89907473 }, 0.703775 ,{ 1,1,1,1 } },Vertex{ { -0.5546875,0.28125,0.671875 }, 0.389662, { 0.3517901,-0.26059267,0.89907473 }, 0.699817 ,{ 1,1,1,1 } },Vertex{ { -0.5546875,0.28125,0.671875 }, 0.389662, { 0.3523074,-0.011000232,0.9358197 }, 0.699817 ,{ 1,1,1,1 } },Vertex{ { 0.53125,0.3359375,0.6796875 }, 0.646248, { -0.3517901,-0.26059267,0.89907473 }, 0.69357896 ,{ 1,1,1,1 } },Vertex{ { 0.53125,0.3359375,0.6796875 }, 0.646248, { -0.026000585,-0.845519,0.53331196 }, 0.69357896 ,{ 1,1,1,1 } },Vertex{ { -0.53125,0.3359375,0.6796875 }, 0.393381, { 0.026000585,-0.845519,0.53331196 }, 0.68948996 ,{ 1,1,1,1 } },Vertex{ { -0.53125,0.3359375,0.6796875 }, 0.393381, { 0.3517901,-0.26059267,0.89907473 }, 0.68948996 ,{ 1,1,1,1 } },Vertex{ { 0.4140625,0.390625,0.75 }, 0.626851, { -0.25419724,-0.65139294,0.71489227 }, 0.679487 ,{ 1,1,1,1 } },Vertex{ { 0.4140625,0.390625,0.75 }, 0.626851, { -0.026000585,-0.845519,0.53331196 }, 0.679487 ,{ 1,1,1,1 } },Vertex{ { -0.4140625,0.390625,0.75 }, 0.413648, { 0.026000585,-0.845519,0.53331196 }, 0.675825 ,{ 1,1,1,1 } },Vertex{ { -0.4140625,0.390625,0.75 }, 0.413648, { 0.25419724,-0.65139294,0.71489227 }, 0.675825 ,{ 1,1,1,1 } },Vertex{ { 0.28125,0.3984375,0.765625 }, 0.601799, { 0.28110135,-0.26100126,0.9235044 }, 0.671547 ,{ 1,1,1,1 } },Vertex{ { 0.28125,0.3984375,0.765625 }, 0.601799, { 0.32730746,-0.41660947,0.8481193 }, 0.671547 ,{ 1,1,1,1 } },Vertex{ { -0.28125,0.3984375,0.765625 }, 0.439372, { -0.32730746,-0.41660947,0.8481193 }, 0.668669 ,{ 1,1,1,1 } },Vertex{ { -0.28125,0.3984375,0.765625 }, 0.439372, { -0.28110135,-0.26100126,0.9235044 }, 0.668669 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.40625,0.75 }, 0.613335, { -0.25419724,-0.65139294,0.71489227 }, 0.672917 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.40625,0.75 }, 0.613335, { 0.28110135,-0.26100126,0.9235044 }, 0.672917 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.40625,0.75 }, 0.427623, { -0.28110135,-0.26100126,0.9235044 }, 0.669642 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.40625,0.75 }, 0.427623, { 0.25419724,-0.65139294,0.71489227 }, 0.669642 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.171875,0.75 }, 0.578124, { 0.49879423,0.52999383,0.6857921 }, 0.7181 ,{ 1,1,1,1 } },Vertex{ { 0.203125,0.171875,0.75 }, 0.578124, { 0.78400344,0.11610051,0.60980266 }, 0.7181 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.171875,0.75 }, 0.461798, { -0.78400344,0.11610051,0.60980266 }, 0.716559 ,{ 1,1,1,1 } },Vertex{ { -0.203125,0.171875,0.75 }, 0.461798, { -0.49879423,0.52999383,0.6857921 }, 0.716559 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.2265625,0.75 }, 0.577524, { 0.78400344,0.11610051,0.60980266 }, 0.70622396 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.2265625,0.75 }, 0.577524, { 0.81649953,-0.073099956,0.57269967 }, 0.70622396 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.2265625,0.75 }, 0.462754, { -0.81649953,-0.073099956,0.57269967 }, 0.704568 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.2265625,0.75 }, 0.462754, { -0.78400344,0.11610051,0.60980266 }, 0.704568 ,{ 1,1,1,1 } },Vertex{ { 0.109375,0.4609375,0.609375 }, 0.553209, { -0.85108703,0.36949438,-0.3729943 }, 0.56693697 ,{ 1,1,1,1 } },Vertex{ { 0.109375,0.4609375,0.609375 }, 0.553209, { -0.53060406,0.8111062,-0.24610187 }, 0.56693697 ,{ 1,1,1,1 } },Vertex{ { 0.109375,0.4609375,0.609375 }, 0.815858, { -0.17219876,0.10459925,-0.97949296 }, 0.554619 ,{ 1,1,1,1 } },Vertex{ { 0.109375,0.4609375,0.609375 }, 0.815858, { -0.16160282,0.18470323,0.969417 }, 0.554619 ,{ 1,1,1,1 } },Vertex{ { 0.109375,0.4609375,0.609375 }, 0.815858, { 0.04249845,0.91496664,0.40128538 }, 0.554619 ,{ 1,1,1,1 } },Vertex{ { -0.109375,0.4609375,0.609375 }, 0.21926, { -0.04249845,0.91496664,0.40128538 }, 0.52281404 ,{ 1,1,1,1 } },Vertex{ { -0.109375,0.4609375,0.609375 }, 0.21926, { 0.16160282,0.18470323,0.969417 }, 0.52281404 ,{ 1,1,1,1 } },Vertex{ { -0.109375,0.4609375,0.609375 }, 0.21926, { 0.17219876,0.10459925,-0.97949296 }, 0.52281404 ,{ 1,1,1,1 } },Vertex{ { -0.109375,0.4609375,0.609375 }, 0.492809, { 0.53060406,0.8111062,-0.24610187 }, 0.565462 ,{ 1,1,1,1 } },Vertex{ { -0.109375,0.4609375,0.609375 }, 0.492809, { 0.85108703,0.36949438,-0.3729943 }, 0.565462 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.6640625,0.6171875 }, 0.609819, { -0.85108703,0.36949438,-0.3729943 }, 0.568484 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.6640625,0.6171875 }, 0.609819, { -0.24460477,0.86751693,-0.43310842 }, 0.568484 ,{ 1,1,1,1 } },Vertex{ { 0.1953125,0.6640625,0.6171875 }, 0.770572, { -0.17219876,0.10459925,-0.97949296 }, 0.555739 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.6640625,0.6171875 }, 0.271364, { 0.17219876,0.10459925,-0.97949296 }, 0.526684 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.6640625,0.6171875 }, 0.43586, { 0.24460477,0.86751693,-0.43310842 }, 0.56426 ,{ 1,1,1,1 } },Vertex{ { -0.1953125,0.6640625,0.6171875 }, 0.43586, { 0.85108703,0.36949438,-0.3729943 }, 0.56426 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.6875,0.59375 }, 0.648174, { -0.24460477,0.86751693,-0.43310842 }, 0.580684 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.6875,0.59375 }, 0.7557, { -0.17219876,0.10459925,-0.97949296 }, 0.581397 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.6875,0.59375 }, 0.648174, { 0.59239733,0.7464966,-0.30299863 }, 0.580684 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.6875,0.59375 }, 0.396518, { -0.59239733,0.7464966,-0.30299863 }, 0.574584 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.6875,0.59375 }, 0.287033, { 0.17219876,0.10459925,-0.97949296 }, 0.557088 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.6875,0.59375 }, 0.396518, { 0.24460477,0.86751693,-0.43310842 }, 0.574584 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.5546875,0.5546875 }, 0.770185, { -0.17219876,0.10459925,-0.97949296 }, 0.620462 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.5546875,0.5546875 }, 0.770185, { 0.04249845,0.91496664,0.40128538 }, 0.620462 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.5546875,0.5546875 }, 0.770185, { 0.34278193,0.9260512,-0.15789169 }, 0.620462 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.5546875,0.5546875 }, 0.692106, { 0.36849314,0.87578374,-0.3117942 }, 0.611726 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.5546875,0.5546875 }, 0.692106, { 0.59239733,0.7464966,-0.30299863 }, 0.611726 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.5546875,0.5546875 }, 0.350292, { -0.59239733,0.7464966,-0.30299863 }, 0.603771 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.5546875,0.5546875 }, 0.350292, { -0.36849314,0.87578374,-0.3117942 }, 0.603771 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.5546875,0.5546875 }, 0.268122, { -0.34278193,0.9260512,-0.15789169 }, 0.601263 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.5546875,0.5546875 }, 0.268122, { -0.04249845,0.91496664,0.40128538 }, 0.601263 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.5546875,0.5546875 }, 0.268122, { 0.17219876,0.10459925,-0.97949296 }, 0.601263 ,{ 1,1,1,1 } },Vertex{ { 0.6796875,0.453125,0.4921875 }, 0.726332, { 0.28210953,0.915131,-0.28800973 }, 0.65824604 ,{ 1,1,1,1 } },Vertex{ { 0.6796875,0.453125,0.4921875 }, 0.749542, { 0.34278193,0.9260512,-0.15789169 }, 0.665317 ,{ 1,1,1,1 } },Vertex{ { 0.6796875,0.453125,0.4921875 }, 0.726332, { 0.36849314,0.87578374,-0.3117942 }, 0.65824604 ,{ 1,1,1,1 } },Vertex{ { 0.6796875,0.453125,0.4921875 }, 0.749542, { 0.41528887,0.89807594,-0.1448961 }, 0.665317 ,{ 1,1,1,1 } },Vertex{ { -0.6796875,0.453125,0.4921875 }, 0.288183, { -0.41528887,0.89807594,-0.1448961 }, 0.653504 ,{ 1,1,1,1 } },Vertex{ { -0.6796875,0.453125,0.4921875 }, 0.312756, { -0.36849314,0.87578374,-0.3117942 }, 0.64941204 ,{ 1,1,1,1 } },Vertex{ { -0.6796875,0.453125,0.4921875 }, 0.288183, { -0.34278193,0.9260512,-0.15789169 }, 0.653504 ,{ 1,1,1,1 } },Vertex{ { -0.6796875,0.453125,0.4921875 }, 0.312756, { -0.28210953,0.915131,-0.28800973 }, 0.64941204 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.40625,0.4609375 }, 0.735879, { 0.28210953,0.915131,-0.28800973 }, 0.687888 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.40625,0.4609375 }, 0.735879, { 0.41528887,0.89807594,-0.1448961 }, 0.687888 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.40625,0.4609375 }, 0.735879, { 0.85611546,0.13400242,-0.49910897 }, 0.687888 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.40625,0.4609375 }, 0.735879, { 0.9791505,0.19731018,0.048302494 }, 0.687888 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.40625,0.4609375 }, 0.301067, { -0.9791505,0.19731018,0.048302494 }, 0.679407 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.40625,0.4609375 }, 0.301067, { -0.85611546,0.13400242,-0.49910897 }, 0.679407 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.40625,0.4609375 }, 0.301067, { -0.41528887,0.89807594,-0.1448961 }, 0.679407 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.40625,0.4609375 }, 0.301067, { -0.28210953,0.915131,-0.28800973 }, 0.679407 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.1640625,0.375 }, 0.7299, { 0.534193,-0.7232905,-0.43759423 }, 0.74360704 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.1640625,0.375 }, 0.7299, { 0.8267188,-0.5066116,0.24470557 }, 0.74360704 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.1640625,0.375 }, 0.7299, { 0.85611546,0.13400242,-0.49910897 }, 0.74360704 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.1640625,0.375 }, 0.7299, { 0.9791505,0.19731018,0.048302494 }, 0.74360704 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.1640625,0.375 }, 0.304876, { -0.9791505,0.19731018,0.048302494 }, 0.738913 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.1640625,0.375 }, 0.304876, { -0.85611546,0.13400242,-0.49910897 }, 0.738913 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.1640625,0.375 }, 0.304876, { -0.8267188,-0.5066116,0.24470557 }, 0.738913 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.1640625,0.375 }, 0.304876, { -0.534193,-0.7232905,-0.43759423 }, 0.738913 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0,0.4140625 }, 0.698172, { 0.38488582,-0.81307006,-0.4367839 }, 0.783094 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0,0.4140625 }, 0.698172, { 0.44651994,-0.8644386,0.23101032 }, 0.783094 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0,0.4140625 }, 0.698172, { 0.534193,-0.7232905,-0.43759423 }, 0.783094 ,{ 1,1,1,1 } },Vertex{ { 0.6015625,0,0.4140625 }, 0.698172, { 0.8267188,-0.5066116,0.24470557 }, 0.783094 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0,0.4140625 }, 0.337414, { -0.8267188,-0.5066116,0.24470557 }, 0.78082097 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0,0.4140625 }, 0.337414, { -0.534193,-0.7232905,-0.43759423 }, 0.78082097 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0,0.4140625 }, 0.337414, { -0.44651994,-0.8644386,0.23101032 }, 0.78082097 ,{ 1,1,1,1 } },Vertex{ { -0.6015625,0,0.4140625 }, 0.337414, { -0.38488582,-0.81307006,-0.4367839 }, 0.78082097 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.09375,0.46875 }, 0.663103, { 0.17609406,-0.88047034,-0.44018516 }, 0.80932903 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.09375,0.46875 }, 0.663103, { 0.26369098,-0.44988462,0.85327077 }, 0.80932903 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.09375,0.46875 }, 0.663103, { 0.38488582,-0.81307006,-0.4367839 }, 0.80932903 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.09375,0.46875 }, 0.663103, { 0.44651994,-0.8644386,0.23101032 }, 0.80932903 ,{ 1,1,1,1 } },Vertex{ { 0.4375,-0.09375,0.46875 }, 0.663103, { 0.6065804,-0.7577755,0.24049224 }, 0.80932903 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.09375,0.46875 }, 0.373474, { -0.6065804,-0.7577755,0.24049224 }, 0.808128 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.09375,0.46875 }, 0.373474, { -0.44651994,-0.8644386,0.23101032 }, 0.808128 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.09375,0.46875 }, 0.373474, { -0.38488582,-0.81307006,-0.4367839 }, 0.808128 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.09375,0.46875 }, 0.373474, { -0.26369098,-0.44988462,0.85327077 }, 0.808128 ,{ 1,1,1,1 } },Vertex{ { -0.4375,-0.09375,0.46875 }, 0.373474, { -0.17609406,-0.88047034,-0.44018516 }, 0.808128 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,0.2890625 }, 0.1064, { -0.22701113,0.57402813,0.7867386 }, 0.567348 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,0.2890625 }, 0.1064, { -0.120300025,0.9644002,0.23550004 }, 0.567348 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,0.2890625 }, 0.911671, { 0.120300025,0.9644002,0.23550004 }, 0.597571 ,{ 1,1,1,1 } },Vertex{ { 0,0.8984375,0.2890625 }, 0.911671, { 0.22701113,0.57402813,0.7867386 }, 0.597571 ,{ 1,1,1,1 } },Vertex{ { 0,0.984375,-0.078125 }, 0.043968, { -0.12750168,0.97441286,-0.18510245 }, 0.632962 ,{ 1,1,1,1 } },Vertex{ { 0,0.984375,-0.078125 }, 0.043968, { -0.120300025,0.9644002,0.23550004 }, 0.632962 ,{ 1,1,1,1 } },Vertex{ { 0,0.984375,-0.078125 }, 0.962901, { 0.120300025,0.9644002,0.23550004 }, 0.655248 ,{ 1,1,1,1 } },Vertex{ { 0,0.984375,-0.078125 }, 0.962901, { 0.12750168,0.97441286,-0.18510245 }, 0.655248 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1953125,-0.671875 }, 0.142277, { -0.3707877,-0.47328433,-0.7990735 }, 0.978533 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1953125,-0.671875 }, 0.142277, { -0.31070977,-0.82842606,-0.46601465 }, 0.978533 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1953125,-0.671875 }, 0.89178, { 0.31070977,-0.82842606,-0.46601465 }, 0.963084 ,{ 1,1,1,1 } },Vertex{ { 0,-0.1953125,-0.671875 }, 0.89178, { 0.3707877,-0.47328433,-0.7990735 }, 0.963084 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4609375,0.1875 }, 0.365979, { -0.31390062,-0.93210185,-0.18070036 }, 0.979009 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4609375,0.1875 }, 0.365979, { -0.27931055,-0.95153594,-0.12870486 }, 0.979009 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4609375,0.1875 }, 0.672384, { 0.27931055,-0.95153594,-0.12870486 }, 0.977799 ,{ 1,1,1,1 } },Vertex{ { 0,-0.4609375,0.1875 }, 0.672384, { 0.31390062,-0.93210185,-0.18070036 }, 0.977799 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9765625,0.4609375 }, 0.518922, { -0.1162934,-0.45347428,-0.8836499 }, 0.975114 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9765625,0.4609375 }, 0.518922, { -0.115199685,-0.98359734,-0.13879961 }, 0.975114 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9765625,0.4609375 }, 0.518922, { 0.115199685,-0.98359734,-0.13879961 }, 0.975114 ,{ 1,1,1,1 } },Vertex{ { 0,-0.9765625,0.4609375 }, 0.518922, { 0.1162934,-0.45347428,-0.8836499 }, 0.975114 ,{ 1,1,1,1 } },Vertex{ { 0,-0.8046875,0.34375 }, 0.470636, { -0.24489857,-0.05829966,-0.96779436 }, 0.999856 ,{ 1,1,1,1 } },Vertex{ { 0,-0.8046875,0.34375 }, 0.470636, { -0.1162934,-0.45347428,-0.8836499 }, 0.999856 ,{ 1,1,1,1 } },Vertex{ { 0,-0.8046875,0.34375 }, 0.56746, { 0.1162934,-0.45347428,-0.8836499 }, 0.999856 ,{ 1,1,1,1 } },Vertex{ { 0,-0.8046875,0.34375 }, 0.56746, { 0.24489857,-0.05829966,-0.96779436 }, 0.999856 ,{ 1,1,1,1 } },Vertex{ { 0,-0.5703125,0.3203125 }, 0.411318, { -0.24489857,-0.05829966,-0.96779436 }, 0.984869 ,{ 1,1,1,1 } },Vertex{ { 0,-0.5703125,0.3203125 }, 0.411318, { -0.23349783,-0.5805946,-0.7799927 }, 0.984869 ,{ 1,1,1,1 } },Vertex{ { 0,-0.5703125,0.3203125 }, 0.626908, { 0.23349783,-0.5805946,-0.7799927 }, 0.984392 ,{ 1,1,1,1 } },Vertex{ { 0,-0.5703125,0.3203125 }, 0.626908, { 0.24489857,-0.05829966,-0.96779436 }, 0.984392 ,{ 1,1,1,1 } },Vertex{ { 0,-0.484375,0.28125 }, 0.388827, { -0.31390062,-0.93210185,-0.18070036 }, 0.978414 ,{ 1,1,1,1 } },Vertex{ { 0,-0.484375,0.28125 }, 0.388827, { -0.23349783,-0.5805946,-0.7799927 }, 0.978414 ,{ 1,1,1,1 } },Vertex{ { 0,-0.484375,0.28125 }, 0.649444, { 0.23349783,-0.5805946,-0.7799927 }, 0.977622 ,{ 1,1,1,1 } },Vertex{ { 0,-0.484375,0.28125 }, 0.649444, { 0.31390062,-0.93210185,-0.18070036 }, 0.977622 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.234375,0.0546875 }, 0.789046, { 0.8267188,-0.5066116,0.24470557 }, 0.766677 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.234375,0.0546875 }, 0.789046, { 0.90480334,-0.37340137,-0.20470075 }, 0.766677 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.234375,0.0546875 }, 0.789046, { 0.9469817,0.09179822,0.30789405 }, 0.766677 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.234375,0.0546875 }, 0.789046, { 0.9791505,0.19731018,0.048302494 }, 0.766677 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.234375,0.0546875 }, 0.241255, { -0.9791505,0.19731018,0.048302494 }, 0.763023 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.234375,0.0546875 }, 0.241255, { -0.9469817,0.09179822,0.30789405 }, 0.763023 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.234375,0.0546875 }, 0.241255, { -0.90480334,-0.37340137,-0.20470075 }, 0.763023 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.234375,0.0546875 }, 0.241255, { -0.8267188,-0.5066116,0.24470557 }, 0.763023 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3203125,-0.046875 }, 0.809631, { 0.90480334,-0.37340137,-0.20470075 }, 0.766113 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3203125,-0.046875 }, 0.809631, { 0.91048694,-0.39649433,-0.117498316 }, 0.766113 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3203125,-0.046875 }, 0.809631, { 0.9469817,0.09179822,0.30789405 }, 0.766113 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3203125,-0.046875 }, 0.809631, { 0.9794569,0.19051108,-0.066103846 }, 0.766113 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3203125,-0.046875 }, 0.809631, { 0.98181564,-0.18040287,-0.059100937 }, 0.766113 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3203125,-0.046875 }, 0.219168, { -0.98181564,-0.18040287,-0.059100937 }, 0.762612 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3203125,-0.046875 }, 0.219168, { -0.9794569,0.19051108,-0.066103846 }, 0.762612 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3203125,-0.046875 }, 0.219168, { -0.9469817,0.09179822,0.30789405 }, 0.762612 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3203125,-0.046875 }, 0.219168, { -0.91048694,-0.39649433,-0.117498316 }, 0.762612 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3203125,-0.046875 }, 0.219168, { -0.90480334,-0.37340137,-0.20470075 }, 0.762612 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.265625,-0.4375 }, 0.842355, { -0.78189635,0.62309706,0.019699909 }, 0.80483997 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.265625,-0.4375 }, 0.62042, { 0.5427693,-0.20628835,-0.81415397 }, 0.43432498 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.265625,-0.4375 }, 0.842355, { 0.55681026,-0.31810588,-0.76731414 }, 0.80483997 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.265625,-0.4375 }, 0.842355, { 0.667938,0.2007114,-0.7166407 }, 0.80483997 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,0.265625,-0.4375 }, 0.842355, { 0.99376976,0.031199051,-0.106996745 }, 0.80483997 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.265625,-0.4375 }, 0.176788, { -0.99376976,0.031199051,-0.106996745 }, 0.80382097 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.265625,-0.4375 }, 0.176788, { -0.667938,0.2007114,-0.7166407 }, 0.80382097 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.265625,-0.4375 }, 0.176788, { -0.55681026,-0.31810588,-0.76731414 }, 0.80382097 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.265625,-0.4375 }, 0.145041, { -0.5427693,-0.20628835,-0.81415397 }, 0.437405 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,0.265625,-0.4375 }, 0.145041, { 0.78189635,0.62309706,0.019699909 }, 0.437405 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.4375,-0.703125 }, 0.909112, { 0.34489003,-0.11579665,-0.931473 }, 0.81673896 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.4375,-0.703125 }, 0.909112, { 0.34921232,0.5947209,-0.7241255 }, 0.81673896 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.4375,-0.703125 }, 0.909112, { 0.4947841,0.434186,-0.7527758 }, 0.81673896 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.4375,-0.703125 }, 0.909112, { 0.5004116,-0.2807065,-0.819019 }, 0.81673896 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.4375,-0.703125 }, 0.107928, { -0.5004116,-0.2807065,-0.819019 }, 0.820917 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.4375,-0.703125 }, 0.107928, { -0.4947841,0.434186,-0.7527758 }, 0.820917 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.4375,-0.703125 }, 0.107928, { -0.34921232,0.5947209,-0.7241255 }, 0.820917 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.4375,-0.703125 }, 0.107928, { -0.34489003,-0.11579665,-0.931473 }, 0.820917 ,{ 1,1,1,1 } },Vertex{ { 0.734375,-0.046875,0.0703125 }, 0.760215, { 0.37219304,-0.9242827,0.08469842 }, 0.806756 ,{ 1,1,1,1 } },Vertex{ { 0.734375,-0.046875,0.0703125 }, 0.760215, { 0.44651994,-0.8644386,0.23101032 }, 0.806756 ,{ 1,1,1,1 } },Vertex{ { 0.734375,-0.046875,0.0703125 }, 0.760215, { 0.72198486,-0.6826857,-0.11259764 }, 0.806756 ,{ 1,1,1,1 } },Vertex{ { 0.734375,-0.046875,0.0703125 }, 0.760215, { 0.8267188,-0.5066116,0.24470557 }, 0.806756 ,{ 1,1,1,1 } },Vertex{ { 0.734375,-0.046875,0.0703125 }, 0.760215, { 0.90480334,-0.37340137,-0.20470075 }, 0.806756 ,{ 1,1,1,1 } },Vertex{ { -0.734375,-0.046875,0.0703125 }, 0.271553, { -0.90480334,-0.37340137,-0.20470075 }, 0.806129 ,{ 1,1,1,1 } },Vertex{ { -0.734375,-0.046875,0.0703125 }, 0.271553, { -0.8267188,-0.5066116,0.24470557 }, 0.806129 ,{ 1,1,1,1 } },Vertex{ { -0.734375,-0.046875,0.0703125 }, 0.271553, { -0.72198486,-0.6826857,-0.11259764 }, 0.806129 ,{ 1,1,1,1 } },Vertex{ { -0.734375,-0.046875,0.0703125 }, 0.271553, { -0.44651994,-0.8644386,0.23101032 }, 0.806129 ,{ 1,1,1,1 } },Vertex{ { -0.734375,-0.046875,0.0703125 }, 0.271553, { -0.37219304,-0.9242827,0.08469842 }, 0.806129 ,{ 1,1,1,1 } },Vertex{ { 0.59375,-0.125,-0.1640625 }, 0.391039, { -0.24739374,-0.9230767,-0.29449254 }, 0.38810903 ,{ 1,1,1,1 } },Vertex{ { 0.59375,-0.125,-0.1640625 }, 0.391039, { -0.19190317,0.28600472,0.9388155 }, 0.38810903 ,{ 1,1,1,1 } },Vertex{ { 0.59375,-0.125,-0.1640625 }, 0.785486, { 0.3189902,-0.8493739,-0.42048708 }, 0.84767 ,{ 1,1,1,1 } },Vertex{ { 0.59375,-0.125,-0.1640625 }, 0.785486, { 0.37219304,-0.9242827,0.08469842 }, 0.84767 ,{ 1,1,1,1 } },Vertex{ { 0.59375,-0.125,-0.1640625 }, 0.785486, { 0.72198486,-0.6826857,-0.11259764 }, 0.84767 ,{ 1,1,1,1 } },Vertex{ { -0.59375,-0.125,-0.1640625 }, 0.245969, { -0.72198486,-0.6826857,-0.11259764 }, 0.848998 ,{ 1,1,1,1 } },Vertex{ { -0.59375,-0.125,-0.1640625 }, 0.245969, { -0.37219304,-0.9242827,0.08469842 }, 0.848998 ,{ 1,1,1,1 } },Vertex{ { -0.59375,-0.125,-0.1640625 }, 0.245969, { -0.3189902,-0.8493739,-0.42048708 }, 0.848998 ,{ 1,1,1,1 } },Vertex{ { -0.59375,-0.125,-0.1640625 }, 0.369913, { 0.19190317,0.28600472,0.9388155 }, 0.389804 ,{ 1,1,1,1 } },Vertex{ { -0.59375,-0.125,-0.1640625 }, 0.369913, { 0.24739374,-0.9230767,-0.29449254 }, 0.389804 ,{ 1,1,1,1 } },Vertex{ { 0.640625,-0.0078125,-0.4296875 }, 0.498072, { -0.24739374,-0.9230767,-0.29449254 }, 0.447685 ,{ 1,1,1,1 } },Vertex{ { 0.640625,-0.0078125,-0.4296875 }, 0.837382, { 0.3189902,-0.8493739,-0.42048708 }, 0.843639 ,{ 1,1,1,1 } },Vertex{ { 0.640625,-0.0078125,-0.4296875 }, 0.498072, { 0.5427693,-0.20628835,-0.81415397 }, 0.447685 ,{ 1,1,1,1 } },Vertex{ { 0.640625,-0.0078125,-0.4296875 }, 0.837382, { 0.55681026,-0.31810588,-0.76731414 }, 0.843639 ,{ 1,1,1,1 } },Vertex{ { -0.640625,-0.0078125,-0.4296875 }, 0.196622, { -0.55681026,-0.31810588,-0.76731414 }, 0.844759 ,{ 1,1,1,1 } },Vertex{ { -0.640625,-0.0078125,-0.4296875 }, 0.264218, { -0.5427693,-0.20628835,-0.81415397 }, 0.44985998 ,{ 1,1,1,1 } },Vertex{ { -0.640625,-0.0078125,-0.4296875 }, 0.196622, { -0.3189902,-0.8493739,-0.42048708 }, 0.844759 ,{ 1,1,1,1 } },Vertex{ { -0.640625,-0.0078125,-0.4296875 }, 0.264218, { 0.24739374,-0.9230767,-0.29449254 }, 0.44985998 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.0546875,-0.6640625 }, 0.886245, { 0.34489003,-0.11579665,-0.931473 }, 0.878223 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.0546875,-0.6640625 }, 0.886245, { 0.3707877,-0.47328433,-0.7990735 }, 0.878223 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.0546875,-0.6640625 }, 0.886245, { 0.49720755,-0.4408067,-0.74731135 }, 0.878223 ,{ 1,1,1,1 } },Vertex{ { 0.3359375,0.0546875,-0.6640625 }, 0.886245, { 0.5004116,-0.2807065,-0.819019 }, 0.878223 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.0546875,-0.6640625 }, 0.141314, { -0.5004116,-0.2807065,-0.819019 }, 0.887518 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.0546875,-0.6640625 }, 0.141314, { -0.49720755,-0.4408067,-0.74731135 }, 0.887518 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.0546875,-0.6640625 }, 0.141314, { -0.3707877,-0.47328433,-0.7990735 }, 0.887518 ,{ 1,1,1,1 } },Vertex{ { -0.3359375,0.0546875,-0.6640625 }, 0.141314, { -0.34489003,-0.11579665,-0.931473 }, 0.887518 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.3515625,0.40625 }, 0.626663, { 0.7537835,-0.29259363,-0.5883872 }, 0.888643 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.3515625,0.40625 }, 0.626663, { 0.9120182,0.33760673,-0.23290463 }, 0.888643 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.3515625,0.40625 }, 0.626663, { 0.91961956,0.13790293,-0.36780784 }, 0.888643 ,{ 1,1,1,1 } },Vertex{ { 0.234375,-0.3515625,0.40625 }, 0.626663, { 0.9761687,-0.20829332,-0.060898047 }, 0.888643 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.3515625,0.40625 }, 0.410618, { -0.9761687,-0.20829332,-0.060898047 }, 0.888756 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.3515625,0.40625 }, 0.410618, { -0.91961956,0.13790293,-0.36780784 }, 0.888756 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.3515625,0.40625 }, 0.410618, { -0.9120182,0.33760673,-0.23290463 }, 0.888756 ,{ 1,1,1,1 } },Vertex{ { -0.234375,-0.3515625,0.40625 }, 0.410618, { -0.7537835,-0.29259363,-0.5883872 }, 0.888756 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.4140625,0.2578125 }, 0.660451, { 0.23349783,-0.5805946,-0.7799927 }, 0.923916 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.4140625,0.2578125 }, 0.660451, { 0.31390062,-0.93210185,-0.18070036 }, 0.923916 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.4140625,0.2578125 }, 0.660451, { 0.7537835,-0.29259363,-0.5883872 }, 0.923916 ,{ 1,1,1,1 } },Vertex{ { 0.1796875,-0.4140625,0.2578125 }, 0.660451, { 0.9761687,-0.20829332,-0.060898047 }, 0.923916 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.4140625,0.2578125 }, 0.376796, { -0.9761687,-0.20829332,-0.060898047 }, 0.924704 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.4140625,0.2578125 }, 0.376796, { -0.7537835,-0.29259363,-0.5883872 }, 0.924704 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.4140625,0.2578125 }, 0.376796, { -0.31390062,-0.93210185,-0.18070036 }, 0.924704 ,{ 1,1,1,1 } },Vertex{ { -0.1796875,-0.4140625,0.2578125 }, 0.376796, { -0.23349783,-0.5805946,-0.7799927 }, 0.924704 ,{ 1,1,1,1 } },Vertex{ { 0.2890625,-0.7109375,0.3828125 }, 0.576951, { -0.018800637,-0.21770738,-0.975833 }, 0.942002 ,{ 1,1,1,1 } },Vertex{ { 0.2890625,-0.7109375,0.3828125 }, 0.576951, { 0.16259596,0.020699486,-0.9864756 }, 0.942002 ,{ 1,1,1,1 } },Vertex{ { 0.2890625,-0.7109375,0.3828125 }, 0.576951, { 0.93186295,0.16289352,-0.3241871 }, 0.942002 ,{ 1,1,1,1 } },Vertex{ { 0.2890625,-0.7109375,0.3828125 }, 0.576951, { 0.9597264,-0.008500234,-0.28080773 }, 0.942002 ,{ 1,1,1,1 } },Vertex{ { -0.2890625,-0.7109375,0.3828125 }, 0.46092, { -0.9597264,-0.008500234,-0.28080773 }, 0.942155 ,{ 1,1,1,1 } },Vertex{ { -0.2890625,-0.7109375,0.3828125 }, 0.46092, { -0.93186295,0.16289352,-0.3241871 }, 0.942155 ,{ 1,1,1,1 } },Vertex{ { -0.2890625,-0.7109375,0.3828125 }, 0.46092, { -0.16259596,0.020699486,-0.9864756 }, 0.942155 ,{ 1,1,1,1 } },Vertex{ { -0.2890625,-0.7109375,0.3828125 }, 0.46092, { 0.018800637,-0.21770738,-0.975833 }, 0.942155 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.5,0.390625 }, 0.611687, { 0.16259596,0.020699486,-0.9864756 }, 0.921732 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.5,0.390625 }, 0.611687, { 0.7537835,-0.29259363,-0.5883872 }, 0.921732 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.5,0.390625 }, 0.611687, { 0.91961956,0.13790293,-0.36780784 }, 0.921732 ,{ 1,1,1,1 } },Vertex{ { 0.25,-0.5,0.390625 }, 0.611687, { 0.93186295,0.16289352,-0.3241871 }, 0.921732 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.5,0.390625 }, 0.425932, { -0.93186295,0.16289352,-0.3241871 }, 0.922015 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.5,0.390625 }, 0.425932, { -0.91961956,0.13790293,-0.36780784 }, 0.922015 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.5,0.390625 }, 0.425932, { -0.7537835,-0.29259363,-0.5883872 }, 0.922015 ,{ 1,1,1,1 } },Vertex{ { -0.25,-0.5,0.390625 }, 0.425932, { -0.16259596,0.020699486,-0.9864756 }, 0.922015 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9140625,0.3984375 }, 0.558059, { -0.018800637,-0.21770738,-0.975833 }, 0.946129 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9140625,0.3984375 }, 0.558059, { 0.11840059,-0.96690476,-0.22600111 }, 0.946129 ,{ 1,1,1,1 } },Vertex{ { 0.328125,-0.9140625,0.3984375 }, 0.558059, { 0.9597264,-0.008500234,-0.28080773 }, 0.946129 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9140625,0.3984375 }, 0.479842, { -0.9597264,-0.008500234,-0.28080773 }, 0.946215 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9140625,0.3984375 }, 0.479842, { -0.11840059,-0.96690476,-0.22600111 }, 0.946215 ,{ 1,1,1,1 } },Vertex{ { -0.328125,-0.9140625,0.3984375 }, 0.479842, { 0.018800637,-0.21770738,-0.975833 }, 0.946215 ,{ 1,1,1,1 } },Vertex{ { 0.140625,-0.7578125,0.3671875 }, 0.577206, { -0.018800637,-0.21770738,-0.975833 }, 0.967199 ,{ 1,1,1,1 } },Vertex{ { 0.140625,-0.7578125,0.3671875 }, 0.577206, { 0.1162934,-0.45347428,-0.8836499 }, 0.967199 ,{ 1,1,1,1 } },Vertex{ { 0.140625,-0.7578125,0.3671875 }, 0.577206, { 0.16259596,0.020699486,-0.9864756 }, 0.967199 ,{ 1,1,1,1 } },Vertex{ { 0.140625,-0.7578125,0.3671875 }, 0.577206, { 0.24489857,-0.05829966,-0.96779436 }, 0.967199 ,{ 1,1,1,1 } },Vertex{ { -0.140625,-0.7578125,0.3671875 }, 0.460782, { -0.24489857,-0.05829966,-0.96779436 }, 0.967344 ,{ 1,1,1,1 } },Vertex{ { -0.140625,-0.7578125,0.3671875 }, 0.460782, { -0.16259596,0.020699486,-0.9864756 }, 0.967344 ,{ 1,1,1,1 } },Vertex{ { -0.140625,-0.7578125,0.3671875 }, 0.460782, { -0.1162934,-0.45347428,-0.8836499 }, 0.967344 ,{ 1,1,1,1 } },Vertex{ { -0.140625,-0.7578125,0.3671875 }, 0.460782, { 0.018800637,-0.21770738,-0.975833 }, 0.967344 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.5390625,0.359375 }, 0.62144, { 0.16259596,0.020699486,-0.9864756 }, 0.951911 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.5390625,0.359375 }, 0.62144, { 0.23349783,-0.5805946,-0.7799927 }, 0.951911 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.5390625,0.359375 }, 0.62144, { 0.24489857,-0.05829966,-0.96779436 }, 0.951911 ,{ 1,1,1,1 } },Vertex{ { 0.125,-0.5390625,0.359375 }, 0.62144, { 0.7537835,-0.29259363,-0.5883872 }, 0.951911 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.5390625,0.359375 }, 0.416419, { -0.7537835,-0.29259363,-0.5883872 }, 0.952369 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.5390625,0.359375 }, 0.416419, { -0.24489857,-0.05829966,-0.96779436 }, 0.952369 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.5390625,0.359375 }, 0.416419, { -0.23349783,-0.5805946,-0.7799927 }, 0.952369 ,{ 1,1,1,1 } },Vertex{ { -0.125,-0.5390625,0.359375 }, 0.416419, { -0.16259596,0.020699486,-0.9864756 }, 0.952369 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9453125,0.4375 }, 0.547413, { -0.018800637,-0.21770738,-0.975833 }, 0.958276 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9453125,0.4375 }, 0.547413, { 0.115199685,-0.98359734,-0.13879961 }, 0.958276 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9453125,0.4375 }, 0.547413, { 0.1162934,-0.45347428,-0.8836499 }, 0.958276 ,{ 1,1,1,1 } },Vertex{ { 0.1640625,-0.9453125,0.4375 }, 0.547413, { 0.11840059,-0.96690476,-0.22600111 }, 0.958276 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9453125,0.4375 }, 0.490511, { -0.11840059,-0.96690476,-0.22600111 }, 0.958331 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9453125,0.4375 }, 0.490511, { -0.1162934,-0.45347428,-0.8836499 }, 0.958331 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9453125,0.4375 }, 0.490511, { -0.115199685,-0.98359734,-0.13879961 }, 0.958331 ,{ 1,1,1,1 } },Vertex{ { -0.1640625,-0.9453125,0.4375 }, 0.490511, { 0.018800637,-0.21770738,-0.975833 }, 0.958331 ,{ 1,1,1,1 } },Vertex{ { 0.21875,-0.28125,0.4296875 }, 0.629482, { 0.6065804,-0.7577755,0.24049224 }, 0.869544 ,{ 1,1,1,1 } },Vertex{ { 0.21875,-0.28125,0.4296875 }, 0.629482, { 0.7324975,-0.6367978,0.24069917 }, 0.869544 ,{ 1,1,1,1 } },Vertex{ { 0.21875,-0.28125,0.4296875 }, 0.629482, { 0.9120182,0.33760673,-0.23290463 }, 0.869544 ,{ 1,1,1,1 } },Vertex{ { 0.21875,-0.28125,0.4296875 }, 0.629482, { 0.92973965,0.31271333,-0.19440828 }, 0.869544 ,{ 1,1,1,1 } },Vertex{ { 0.21875,-0.28125,0.4296875 }, 0.629482, { 0.9761687,-0.20829332,-0.060898047 }, 0.869544 ,{ 1,1,1,1 } },Vertex{ { -0.21875,-0.28125,0.4296875 }, 0.407648, { -0.9761687,-0.20829332,-0.060898047 }, 0.869406 ,{ 1,1,1,1 } },Vertex{ { -0.21875,-0.28125,0.4296875 }, 0.407648, { -0.92973965,0.31271333,-0.19440828 }, 0.869406 ,{ 1,1,1,1 } },Vertex{ { -0.21875,-0.28125,0.4296875 }, 0.407648, { -0.9120182,0.33760673,-0.23290463 }, 0.869406 ,{ 1,1,1,1 } },Vertex{ { -0.21875,-0.28125,0.4296875 }, 0.407648, { -0.7324975,-0.6367978,0.24069917 }, 0.869406 ,{ 1,1,1,1 } },Vertex{ { -0.21875,-0.28125,0.4296875 }, 0.407648, { -0.6065804,-0.7577755,0.24049224 }, 0.869406 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.2265625,0.46875 }, 0.623495, { 0.26369098,-0.44988462,0.85327077 }, 0.853204 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.2265625,0.46875 }, 0.623495, { 0.6065804,-0.7577755,0.24049224 }, 0.853204 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.2265625,0.46875 }, 0.623495, { 0.92973965,0.31271333,-0.19440828 }, 0.853204 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.2265625,0.46875 }, 0.623495, { 0.940689,0.33379608,-0.06069929 }, 0.853204 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.2265625,0.46875 }, 0.413741, { -0.940689,0.33379608,-0.06069929 }, 0.852842 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.2265625,0.46875 }, 0.413741, { -0.92973965,0.31271333,-0.19440828 }, 0.852842 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.2265625,0.46875 }, 0.413741, { -0.6065804,-0.7577755,0.24049224 }, 0.852842 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.2265625,0.46875 }, 0.413741, { -0.26369098,-0.44988462,0.85327077 }, 0.852842 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.171875,0.5 }, 0.619303, { 0.17609406,-0.88047034,-0.44018516 }, 0.840159 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.171875,0.5 }, 0.619303, { 0.26369098,-0.44988462,0.85327077 }, 0.840159 ,{ 1,1,1,1 } },Vertex{ { 0.203125,-0.171875,0.5 }, 0.619303, { 0.940689,0.33379608,-0.06069929 }, 0.840159 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.171875,0.5 }, 0.418035, { -0.940689,0.33379608,-0.06069929 }, 0.839639 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.171875,0.5 }, 0.418035, { -0.26369098,-0.44988462,0.85327077 }, 0.839639 ,{ 1,1,1,1 } },Vertex{ { -0.203125,-0.171875,0.5 }, 0.418035, { -0.17609406,-0.88047034,-0.44018516 }, 0.839639 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.390625,0.1640625 }, 0.687018, { 0.27931055,-0.95153594,-0.12870486 }, 0.922796 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.390625,0.1640625 }, 0.687018, { 0.31390062,-0.93210185,-0.18070036 }, 0.922796 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.390625,0.1640625 }, 0.687018, { 0.71159816,-0.70079815,0.05009987 }, 0.922796 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.390625,0.1640625 }, 0.687018, { 0.7324975,-0.6367978,0.24069917 }, 0.922796 ,{ 1,1,1,1 } },Vertex{ { 0.2109375,-0.390625,0.1640625 }, 0.687018, { 0.9761687,-0.20829332,-0.060898047 }, 0.922796 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.390625,0.1640625 }, 0.349875, { -0.9761687,-0.20829332,-0.060898047 }, 0.92404497 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.390625,0.1640625 }, 0.349875, { -0.7324975,-0.6367978,0.24069917 }, 0.92404497 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.390625,0.1640625 }, 0.349875, { -0.71159816,-0.70079815,0.05009987 }, 0.92404497 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.390625,0.1640625 }, 0.349875, { -0.31390062,-0.93210185,-0.18070036 }, 0.92404497 ,{ 1,1,1,1 } },Vertex{ { -0.2109375,-0.390625,0.1640625 }, 0.349875, { -0.27931055,-0.95153594,-0.12870486 }, 0.92404497 ,{ 1,1,1,1 } },Vertex{ { 0.296875,-0.3125,-0.265625 }, 0.788458, { 0.27931055,-0.95153594,-0.12870486 }, 0.919174 ,{ 1,1,1,1 } },Vertex{ { 0.296875,-0.3125,-0.265625 }, 0.788458, { 0.31070977,-0.82842606,-0.46601465 }, 0.919174 ,{ 1,1,1,1 } },Vertex{ { 0.296875,-0.3125,-0.265625 }, 0.788458, { 0.71159816,-0.70079815,0.05009987 }, 0.919174 ,{ 1,1,1,1 } },Vertex{ { 0.296875,-0.3125,-0.265625 }, 0.788458, { 0.7197612,-0.6355657,-0.27928495 }, 0.919174 ,{ 1,1,1,1 } },Vertex{ { -0.296875,-0.3125,-0.265625 }, 0.246353, { -0.7197612,-0.6355657,-0.27928495 }, 0.92349 ,{ 1,1,1,1 } },Vertex{ { -0.296875,-0.3125,-0.265625 }, 0.246353, { -0.71159816,-0.70079815,0.05009987 }, 0.92349 ,{ 1,1,1,1 } },Vertex{ { -0.296875,-0.3125,-0.265625 }, 0.246353, { -0.31070977,-0.82842606,-0.46601465 }, 0.92349 ,{ 1,1,1,1 } },Vertex{ { -0.296875,-0.3125,-0.265625 }, 0.246353, { -0.27931055,-0.95153594,-0.12870486 }, 0.92349 ,{ 1,1,1,1 } },Vertex{ { 0.34375,-0.1484375,-0.5390625 }, 0.849114, { 0.31070977,-0.82842606,-0.46601465 }, 0.900268 ,{ 1,1,1,1 } },Vertex{ { 0.34375,-0.1484375,-0.5390625 }, 0.849114, { 0.3707877,-0.47328433,-0.7990735 }, 0.900268 ,{ 1,1,1,1 } },Vertex{ { 0.34375,-0.1484375,-0.5390625 }, 0.849114, { 0.49720755,-0.4408067,-0.74731135 }, 0.900268 ,{ 1,1,1,1 } },Vertex{ { 0.34375,-0.1484375,-0.5390625 }, 0.849114, { 0.7197612,-0.6355657,-0.27928495 }, 0.900268 ,{ 1,1,1,1 } },Vertex{ { -0.34375,-0.1484375,-0.5390625 }, 0.183115, { -0.7197612,-0.6355657,-0.27928495 }, 0.907873 ,{ 1,1,1,1 } },Vertex{ { -0.34375,-0.1484375,-0.5390625 }, 0.183115, { -0.49720755,-0.4408067,-0.74731135 }, 0.907873 ,{ 1,1,1,1 } },Vertex{ { -0.34375,-0.1484375,-0.5390625 }, 0.183115, { -0.3707877,-0.47328433,-0.7990735 }, 0.907873 ,{ 1,1,1,1 } },Vertex{ { -0.34375,-0.1484375,-0.5390625 }, 0.183115, { -0.31070977,-0.82842606,-0.46601465 }, 0.907873 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8671875,-0.3828125 }, 0.91536, { 0.12750168,0.97441286,-0.18510245 }, 0.740196 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8671875,-0.3828125 }, 0.91536, { 0.34921232,0.5947209,-0.7241255 }, 0.740196 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8671875,-0.3828125 }, 0.91536, { 0.4947841,0.434186,-0.7527758 }, 0.740196 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8671875,-0.3828125 }, 0.91536, { 0.6423234,0.7459271,-0.17610641 }, 0.740196 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8671875,-0.3828125 }, 0.098965, { -0.6423234,0.7459271,-0.17610641 }, 0.733032 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8671875,-0.3828125 }, 0.098965, { -0.4947841,0.434186,-0.7527758 }, 0.733032 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8671875,-0.3828125 }, 0.098965, { -0.34921232,0.5947209,-0.7241255 }, 0.733032 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8671875,-0.3828125 }, 0.098965, { -0.12750168,0.97441286,-0.18510245 }, 0.733032 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.9296875,-0.0703125 }, 0.894128, { 0.120300025,0.9644002,0.23550004 }, 0.698116 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.9296875,-0.0703125 }, 0.894128, { 0.12750168,0.97441286,-0.18510245 }, 0.698116 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.9296875,-0.0703125 }, 0.894128, { 0.6423234,0.7459271,-0.17610641 }, 0.698116 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.9296875,-0.0703125 }, 0.894128, { 0.7182037,0.6788035,0.15300079 }, 0.698116 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.9296875,-0.0703125 }, 0.123776, { -0.7182037,0.6788035,0.15300079 }, 0.684481 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.9296875,-0.0703125 }, 0.123776, { -0.6423234,0.7459271,-0.17610641 }, 0.684481 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.9296875,-0.0703125 }, 0.123776, { -0.12750168,0.97441286,-0.18510245 }, 0.684481 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.9296875,-0.0703125 }, 0.123776, { -0.120300025,0.9644002,0.23550004 }, 0.684481 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8515625,0.234375 }, 0.862868, { 0.120300025,0.9644002,0.23550004 }, 0.661444 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8515625,0.234375 }, 0.862868, { 0.22701113,0.57402813,0.7867386 }, 0.661444 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8515625,0.234375 }, 0.862868, { 0.7182037,0.6788035,0.15300079 }, 0.661444 ,{ 1,1,1,1 } },Vertex{ { 0.453125,0.8515625,0.234375 }, 0.862868, { 0.73881304,0.39720702,0.54440963 }, 0.661444 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8515625,0.234375 }, 0.160557, { -0.73881304,0.39720702,0.54440963 }, 0.643179 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8515625,0.234375 }, 0.160557, { -0.7182037,0.6788035,0.15300079 }, 0.643179 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8515625,0.234375 }, 0.160557, { -0.22701113,0.57402813,0.7867386 }, 0.643179 ,{ 1,1,1,1 } },Vertex{ { -0.453125,0.8515625,0.234375 }, 0.160557, { -0.120300025,0.9644002,0.23550004 }, 0.643179 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.5234375,0.4296875 }, 0.794286, { 0.04249845,0.91496664,0.40128538 }, 0.635938 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.5234375,0.4296875 }, 0.794286, { 0.22701113,0.57402813,0.7867386 }, 0.635938 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.5234375,0.4296875 }, 0.794286, { 0.34278193,0.9260512,-0.15789169 }, 0.635938 ,{ 1,1,1,1 } },Vertex{ { 0.4609375,0.5234375,0.4296875 }, 0.794286, { 0.73881304,0.39720702,0.54440963 }, 0.635938 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.5234375,0.4296875 }, 0.239776, { -0.73881304,0.39720702,0.54440963 }, 0.61740804 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.5234375,0.4296875 }, 0.239776, { -0.34278193,0.9260512,-0.15789169 }, 0.61740804 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.5234375,0.4296875 }, 0.239776, { -0.22701113,0.57402813,0.7867386 }, 0.61740804 ,{ 1,1,1,1 } },Vertex{ { -0.4609375,0.5234375,0.4296875 }, 0.239776, { -0.04249845,0.91496664,0.40128538 }, 0.61740804 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.40625,0.3359375 }, 0.766337, { 0.1844907,0.7035645,0.68626535 }, 0.699191 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.40625,0.3359375 }, 0.766337, { 0.41528887,0.89807594,-0.1448961 }, 0.699191 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.40625,0.3359375 }, 0.766337, { 0.9469817,0.09179822,0.30789405 }, 0.699191 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0.40625,0.3359375 }, 0.766337, { 0.9791505,0.19731018,0.048302494 }, 0.699191 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.40625,0.3359375 }, 0.267408, { -0.9791505,0.19731018,0.048302494 }, 0.68985796 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.40625,0.3359375 }, 0.267408, { -0.9469817,0.09179822,0.30789405 }, 0.68985796 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.40625,0.3359375 }, 0.267408, { -0.41528887,0.89807594,-0.1448961 }, 0.68985796 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0.40625,0.3359375 }, 0.267408, { -0.1844907,0.7035645,0.68626535 }, 0.68985796 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,0.453125,0.28125 }, 0.789162, { 0.1844907,0.7035645,0.68626535 }, 0.686273 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,0.453125,0.28125 }, 0.789162, { 0.34278193,0.9260512,-0.15789169 }, 0.686273 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,0.453125,0.28125 }, 0.789162, { 0.41528887,0.89807594,-0.1448961 }, 0.686273 ,{ 1,1,1,1 } },Vertex{ { 0.6328125,0.453125,0.28125 }, 0.789162, { 0.73881304,0.39720702,0.54440963 }, 0.686273 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,0.453125,0.28125 }, 0.242992, { -0.73881304,0.39720702,0.54440963 }, 0.674448 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,0.453125,0.28125 }, 0.242992, { -0.41528887,0.89807594,-0.1448961 }, 0.674448 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,0.453125,0.28125 }, 0.242992, { -0.34278193,0.9260512,-0.15789169 }, 0.674448 ,{ 1,1,1,1 } },Vertex{ { -0.6328125,0.453125,0.28125 }, 0.242992, { -0.1844907,0.7035645,0.68626535 }, 0.674448 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.703125,0.0546875 }, 0.846174, { 0.1844907,0.7035645,0.68626535 }, 0.706603 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.703125,0.0546875 }, 0.846174, { 0.6055781,0.77937186,0.16079418 }, 0.706603 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.703125,0.0546875 }, 0.846174, { 0.7182037,0.6788035,0.15300079 }, 0.706603 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.703125,0.0546875 }, 0.846174, { 0.73881304,0.39720702,0.54440963 }, 0.706603 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.703125,0.0546875 }, 0.178537, { -0.73881304,0.39720702,0.54440963 }, 0.695017 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.703125,0.0546875 }, 0.178537, { -0.7182037,0.6788035,0.15300079 }, 0.695017 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.703125,0.0546875 }, 0.178537, { -0.6055781,0.77937186,0.16079418 }, 0.695017 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.703125,0.0546875 }, 0.178537, { -0.1844907,0.7035645,0.68626535 }, 0.695017 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5625,0.125 }, 0.815314, { 0.1844907,0.7035645,0.68626535 }, 0.723612 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5625,0.125 }, 0.815314, { 0.6055781,0.77937186,0.16079418 }, 0.723612 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5625,0.125 }, 0.815314, { 0.9469817,0.09179822,0.30789405 }, 0.723612 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5625,0.125 }, 0.815314, { 0.9794569,0.19051108,-0.066103846 }, 0.723612 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5625,0.125 }, 0.213065, { -0.9794569,0.19051108,-0.066103846 }, 0.714836 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5625,0.125 }, 0.213065, { -0.9469817,0.09179822,0.30789405 }, 0.714836 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5625,0.125 }, 0.213065, { -0.6055781,0.77937186,0.16079418 }, 0.714836 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5625,0.125 }, 0.213065, { -0.1844907,0.7035645,0.68626535 }, 0.714836 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.6171875,-0.1171875 }, 0.845007, { 0.6055781,0.77937186,0.16079418 }, 0.743648 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.6171875,-0.1171875 }, 0.845007, { 0.7033016,0.6806016,-0.20530048 }, 0.743648 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.6171875,-0.1171875 }, 0.845007, { 0.9794569,0.19051108,-0.066103846 }, 0.743648 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.6171875,-0.1171875 }, 0.845007, { 0.99376976,0.031199051,-0.106996745 }, 0.743648 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.6171875,-0.1171875 }, 0.179662, { -0.99376976,0.031199051,-0.106996745 }, 0.736688 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.6171875,-0.1171875 }, 0.179662, { -0.9794569,0.19051108,-0.066103846 }, 0.736688 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.6171875,-0.1171875 }, 0.179662, { -0.7033016,0.6806016,-0.20530048 }, 0.736688 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.6171875,-0.1171875 }, 0.179662, { -0.6055781,0.77937186,0.16079418 }, 0.736688 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.75,-0.1953125 }, 0.873517, { 0.6055781,0.77937186,0.16079418 }, 0.734078 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.75,-0.1953125 }, 0.873517, { 0.6423234,0.7459271,-0.17610641 }, 0.734078 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.75,-0.1953125 }, 0.873517, { 0.7033016,0.6806016,-0.20530048 }, 0.734078 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.75,-0.1953125 }, 0.873517, { 0.7182037,0.6788035,0.15300079 }, 0.734078 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.75,-0.1953125 }, 0.147089, { -0.7182037,0.6788035,0.15300079 }, 0.725716 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.75,-0.1953125 }, 0.147089, { -0.7033016,0.6806016,-0.20530048 }, 0.725716 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.75,-0.1953125 }, 0.147089, { -0.6423234,0.7459271,-0.17610641 }, 0.725716 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.75,-0.1953125 }, 0.147089, { -0.6055781,0.77937186,0.16079418 }, 0.725716 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.6796875,-0.4453125 }, 0.886999, { 0.4947841,0.434186,-0.7527758 }, 0.766231 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.6796875,-0.4453125 }, 0.886999, { 0.6423234,0.7459271,-0.17610641 }, 0.766231 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.6796875,-0.4453125 }, 0.886999, { 0.667938,0.2007114,-0.7166407 }, 0.766231 ,{ 1,1,1,1 } },Vertex{ { 0.640625,0.6796875,-0.4453125 }, 0.886999, { 0.7033016,0.6806016,-0.20530048 }, 0.766231 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.6796875,-0.4453125 }, 0.131514, { -0.7033016,0.6806016,-0.20530048 }, 0.762413 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.6796875,-0.4453125 }, 0.131514, { -0.667938,0.2007114,-0.7166407 }, 0.762413 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.6796875,-0.4453125 }, 0.131514, { -0.6423234,0.7459271,-0.17610641 }, 0.762413 ,{ 1,1,1,1 } },Vertex{ { -0.640625,0.6796875,-0.4453125 }, 0.131514, { -0.4947841,0.434186,-0.7527758 }, 0.762413 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5390625,-0.359375 }, 0.859075, { 0.667938,0.2007114,-0.7166407 }, 0.771832 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5390625,-0.359375 }, 0.859075, { 0.7033016,0.6806016,-0.20530048 }, 0.771832 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.5390625,-0.359375 }, 0.859075, { 0.99376976,0.031199051,-0.106996745 }, 0.771832 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5390625,-0.359375 }, 0.162803, { -0.99376976,0.031199051,-0.106996745 }, 0.76828 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5390625,-0.359375 }, 0.162803, { -0.7033016,0.6806016,-0.20530048 }, 0.76828 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.5390625,-0.359375 }, 0.162803, { -0.667938,0.2007114,-0.7166407 }, 0.76828 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.328125,-0.5859375 }, 0.87503, { 0.4947841,0.434186,-0.7527758 }, 0.815295 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.328125,-0.5859375 }, 0.87503, { 0.5004116,-0.2807065,-0.819019 }, 0.815295 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.328125,-0.5859375 }, 0.87503, { 0.55681026,-0.31810588,-0.76731414 }, 0.815295 ,{ 1,1,1,1 } },Vertex{ { 0.6171875,0.328125,-0.5859375 }, 0.87503, { 0.667938,0.2007114,-0.7166407 }, 0.815295 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.328125,-0.5859375 }, 0.145224, { -0.667938,0.2007114,-0.7166407 }, 0.81725097 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.328125,-0.5859375 }, 0.145224, { -0.55681026,-0.31810588,-0.76731414 }, 0.81725097 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.328125,-0.5859375 }, 0.145224, { -0.5004116,-0.2807065,-0.819019 }, 0.81725097 ,{ 1,1,1,1 } },Vertex{ { -0.6171875,0.328125,-0.5859375 }, 0.145224, { -0.4947841,0.434186,-0.7527758 }, 0.81725097 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.0234375,-0.546875 }, 0.858171, { 0.3189902,-0.8493739,-0.42048708 }, 0.862225 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.0234375,-0.546875 }, 0.858171, { 0.49720755,-0.4408067,-0.74731135 }, 0.862225 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.0234375,-0.546875 }, 0.858171, { 0.5004116,-0.2807065,-0.819019 }, 0.862225 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.0234375,-0.546875 }, 0.858171, { 0.55681026,-0.31810588,-0.76731414 }, 0.862225 ,{ 1,1,1,1 } },Vertex{ { 0.484375,0.0234375,-0.546875 }, 0.858171, { 0.7197612,-0.6355657,-0.27928495 }, 0.862225 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.0234375,-0.546875 }, 0.171653, { -0.7197612,-0.6355657,-0.27928495 }, 0.867706 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.0234375,-0.546875 }, 0.171653, { -0.55681026,-0.31810588,-0.76731414 }, 0.867706 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.0234375,-0.546875 }, 0.171653, { -0.5004116,-0.2807065,-0.819019 }, 0.867706 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.0234375,-0.546875 }, 0.171653, { -0.49720755,-0.4408067,-0.74731135 }, 0.867706 ,{ 1,1,1,1 } },Vertex{ { -0.484375,0.0234375,-0.546875 }, 0.171653, { -0.3189902,-0.8493739,-0.42048708 }, 0.867706 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.328125,-0.203125 }, 0.829287, { -0.78189635,0.62309706,0.019699909 }, 0.780438 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.328125,-0.203125 }, 0.391747, { 0.10339721,0.15509583,0.98247355 }, 0.13790298 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.328125,-0.203125 }, 0.829287, { 0.9794569,0.19051108,-0.066103846 }, 0.780438 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.328125,-0.203125 }, 0.829287, { 0.98181564,-0.18040287,-0.059100937 }, 0.780438 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.328125,-0.203125 }, 0.829287, { 0.99376976,0.031199051,-0.106996745 }, 0.780438 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.328125,-0.203125 }, 0.199067, { -0.99376976,0.031199051,-0.106996745 }, 0.77753603 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.328125,-0.203125 }, 0.199067, { -0.98181564,-0.18040287,-0.059100937 }, 0.77753603 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.328125,-0.203125 }, 0.199067, { -0.9794569,0.19051108,-0.066103846 }, 0.77753603 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.328125,-0.203125 }, 0.363377, { -0.10339721,0.15509583,0.98247355 }, 0.13869202 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.328125,-0.203125 }, 0.051216, { 0.78189635,0.62309706,0.019699909 }, 0.477341 ,{ 1,1,1,1 } },Vertex{ { 0.40625,-0.171875,0.1484375 }, 0.715482, { 0.37219304,-0.9242827,0.08469842 }, 0.860273 ,{ 1,1,1,1 } },Vertex{ { 0.40625,-0.171875,0.1484375 }, 0.715482, { 0.44651994,-0.8644386,0.23101032 }, 0.860273 ,{ 1,1,1,1 } },Vertex{ { 0.40625,-0.171875,0.1484375 }, 0.715482, { 0.6065804,-0.7577755,0.24049224 }, 0.860273 ,{ 1,1,1,1 } },Vertex{ { 0.40625,-0.171875,0.1484375 }, 0.715482, { 0.71159816,-0.70079815,0.05009987 }, 0.860273 ,{ 1,1,1,1 } },Vertex{ { 0.40625,-0.171875,0.1484375 }, 0.715482, { 0.7324975,-0.6367978,0.24069917 }, 0.860273 ,{ 1,1,1,1 } },Vertex{ { -0.40625,-0.171875,0.1484375 }, 0.319538, { -0.7324975,-0.6367978,0.24069917 }, 0.860591 ,{ 1,1,1,1 } },Vertex{ { -0.40625,-0.171875,0.1484375 }, 0.319538, { -0.71159816,-0.70079815,0.05009987 }, 0.860591 ,{ 1,1,1,1 } },Vertex{ { -0.40625,-0.171875,0.1484375 }, 0.319538, { -0.6065804,-0.7577755,0.24049224 }, 0.860591 ,{ 1,1,1,1 } },Vertex{ { -0.40625,-0.171875,0.1484375 }, 0.319538, { -0.44651994,-0.8644386,0.23101032 }, 0.860591 ,{ 1,1,1,1 } },Vertex{ { -0.40625,-0.171875,0.1484375 }, 0.319538, { -0.37219304,-0.9242827,0.08469842 }, 0.860591 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,-0.1953125,-0.2109375 }, 0.78648, { 0.3189902,-0.8493739,-0.42048708 }, 0.882409 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,-0.1953125,-0.2109375 }, 0.78648, { 0.37219304,-0.9242827,0.08469842 }, 0.882409 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,-0.1953125,-0.2109375 }, 0.78648, { 0.71159816,-0.70079815,0.05009987 }, 0.882409 ,{ 1,1,1,1 } },Vertex{ { 0.4296875,-0.1953125,-0.2109375 }, 0.78648, { 0.7197612,-0.6355657,-0.27928495 }, 0.882409 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,-0.1953125,-0.2109375 }, 0.246666, { -0.7197612,-0.6355657,-0.27928495 }, 0.88515 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,-0.1953125,-0.2109375 }, 0.246666, { -0.71159816,-0.70079815,0.05009987 }, 0.88515 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,-0.1953125,-0.2109375 }, 0.246666, { -0.37219304,-0.9242827,0.08469842 }, 0.88515 ,{ 1,1,1,1 } },Vertex{ { -0.4296875,-0.1953125,-0.2109375 }, 0.246666, { -0.3189902,-0.8493739,-0.42048708 }, 0.88515 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.40625,-0.234375 }, 0.834578, { -0.78189635,0.62309706,0.019699909 }, 0.793121 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.40625,-0.234375 }, 0.740843, { -0.44989443,0.88378906,-0.1284984 }, 0.427572 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.40625,-0.234375 }, 0.432388, { 0.10339721,0.15509583,0.98247355 }, 0.105057 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.40625,-0.234375 }, 0.432388, { 0.3505868,0.38068566,0.85566777 }, 0.105057 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.40625,-0.234375 }, 0.321637, { -0.3505868,0.38068566,0.85566777 }, 0.106774986 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.40625,-0.234375 }, 0.321637, { -0.10339721,0.15509583,0.98247355 }, 0.106774986 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.40625,-0.234375 }, 0.033664, { 0.44989443,0.88378906,-0.1284984 }, 0.435597 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.40625,-0.234375 }, 0.033664, { 0.78189635,0.62309706,0.019699909 }, 0.435597 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,-0.140625,-0.125 }, 0.434803, { -0.24739374,-0.9230767,-0.29449254 }, 0.34111798 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,-0.140625,-0.125 }, 0.434803, { -0.19190317,0.28600472,0.9388155 }, 0.34111798 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,-0.140625,-0.125 }, 0.434803, { 0.093000606,-0.9924064,-0.08050052 }, 0.34111798 ,{ 1,1,1,1 } },Vertex{ { 0.7734375,-0.140625,-0.125 }, 0.434803, { 0.622479,-0.30448973,0.7209757 }, 0.34111798 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,-0.140625,-0.125 }, 0.325318, { -0.622479,-0.30448973,0.7209757 }, 0.343776 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,-0.140625,-0.125 }, 0.325318, { -0.093000606,-0.9924064,-0.08050052 }, 0.343776 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,-0.140625,-0.125 }, 0.325318, { 0.19190317,0.28600472,0.9388155 }, 0.343776 ,{ 1,1,1,1 } },Vertex{ { -0.7734375,-0.140625,-0.125 }, 0.325318, { 0.24739374,-0.9230767,-0.29449254 }, 0.343776 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.1015625,-0.328125 }, 0.50827, { 0.093000606,-0.9924064,-0.08050052 }, 0.302307 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.1015625,-0.328125 }, 0.50827, { 0.46427953,-0.05989736,0.88366103 }, 0.302307 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.1015625,-0.328125 }, 0.50827, { 0.50057477,-0.8656564,0.007999597 }, 0.302307 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.1015625,-0.328125 }, 0.50827, { 0.622479,-0.30448973,0.7209757 }, 0.302307 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.1015625,-0.328125 }, 0.250811, { -0.622479,-0.30448973,0.7209757 }, 0.306751 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.1015625,-0.328125 }, 0.250811, { -0.50057477,-0.8656564,0.007999597 }, 0.306751 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.1015625,-0.328125 }, 0.250811, { -0.46427953,-0.05989736,0.88366103 }, 0.306751 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.1015625,-0.328125 }, 0.250811, { -0.093000606,-0.9924064,-0.08050052 }, 0.306751 ,{ 1,1,1,1 } },Vertex{ { 1.28125,0.0546875,-0.4296875 }, 0.563786, { 0.24549368,-0.08019794,0.9660751 }, 0.26078898 ,{ 1,1,1,1 } },Vertex{ { 1.28125,0.0546875,-0.4296875 }, 0.563786, { 0.46427953,-0.05989736,0.88366103 }, 0.26078898 ,{ 1,1,1,1 } },Vertex{ { 1.28125,0.0546875,-0.4296875 }, 0.563786, { 0.50057477,-0.8656564,0.007999597 }, 0.26078898 ,{ 1,1,1,1 } },Vertex{ { 1.28125,0.0546875,-0.4296875 }, 0.563786, { 0.9285105,-0.24970283,0.2748031 }, 0.26078898 ,{ 1,1,1,1 } },Vertex{ { -1.28125,0.0546875,-0.4296875 }, 0.194086, { -0.9285105,-0.24970283,0.2748031 }, 0.26675898 ,{ 1,1,1,1 } },Vertex{ { -1.28125,0.0546875,-0.4296875 }, 0.194086, { -0.50057477,-0.8656564,0.007999597 }, 0.26675898 ,{ 1,1,1,1 } },Vertex{ { -1.28125,0.0546875,-0.4296875 }, 0.194086, { -0.46427953,-0.05989736,0.88366103 }, 0.26675898 ,{ 1,1,1,1 } },Vertex{ { -1.28125,0.0546875,-0.4296875 }, 0.194086, { -0.24549368,-0.08019794,0.9660751 }, 0.26675898 ,{ 1,1,1,1 } },Vertex{ { 1.3515625,0.3203125,-0.421875 }, 0.619962, { 0.24549368,-0.08019794,0.9660751 }, 0.20838499 ,{ 1,1,1,1 } },Vertex{ { 1.3515625,0.3203125,-0.421875 }, 0.619962, { 0.25829673,0.105498664,0.96028787 }, 0.20838499 ,{ 1,1,1,1 } },Vertex{ { 1.3515625,0.3203125,-0.421875 }, 0.619962, { 0.8392786,0.5423862,-0.037799034 }, 0.20838499 ,{ 1,1,1,1 } },Vertex{ { 1.3515625,0.3203125,-0.421875 }, 0.619962, { 0.9285105,-0.24970283,0.2748031 }, 0.20838499 ,{ 1,1,1,1 } },Vertex{ { -1.3515625,0.3203125,-0.421875 }, 0.136063, { -0.9285105,-0.24970283,0.2748031 }, 0.21590698 ,{ 1,1,1,1 } },Vertex{ { -1.3515625,0.3203125,-0.421875 }, 0.136063, { -0.8392786,0.5423862,-0.037799034 }, 0.21590698 ,{ 1,1,1,1 } },Vertex{ { -1.3515625,0.3203125,-0.421875 }, 0.136063, { -0.25829673,0.105498664,0.96028787 }, 0.21590698 ,{ 1,1,1,1 } },Vertex{ { -1.3515625,0.3203125,-0.421875 }, 0.136063, { -0.24549368,-0.08019794,0.9660751 }, 0.21590698 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.5078125,-0.421875 }, 0.707492, { -0.23551221,0.93674856,-0.25891343 }, 0.240116 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.5078125,-0.421875 }, 0.604825, { 0.25829673,0.105498664,0.96028787 }, 0.12005401 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.5078125,-0.421875 }, 0.604825, { 0.45659435,0.17149787,0.8729892 }, 0.12005401 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.5078125,-0.421875 }, 0.707492, { 0.8392786,0.5423862,-0.037799034 }, 0.240116 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.5078125,-0.421875 }, 0.049526, { -0.8392786,0.5423862,-0.037799034 }, 0.251176 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.5078125,-0.421875 }, 0.148729, { -0.45659435,0.17149787,0.8729892 }, 0.12665099 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.5078125,-0.421875 }, 0.148729, { -0.25829673,0.105498664,0.96028787 }, 0.12665099 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.5078125,-0.421875 }, 0.049526, { 0.23551221,0.93674856,-0.25891343 }, 0.251176 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4765625,-0.3125 }, 0.745511, { -0.44989443,0.88378906,-0.1284984 }, 0.34789997 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4765625,-0.3125 }, 0.745511, { -0.23551221,0.93674856,-0.25891343 }, 0.34789997 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4765625,-0.3125 }, 0.506166, { 0.3505868,0.38068566,0.85566777 }, 0.09514898 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4765625,-0.3125 }, 0.506166, { 0.45659435,0.17149787,0.8729892 }, 0.09514898 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4765625,-0.3125 }, 0.247207, { -0.45659435,0.17149787,0.8729892 }, 0.09884101 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4765625,-0.3125 }, 0.247207, { -0.3505868,0.38068566,0.85566777 }, 0.09884101 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4765625,-0.3125 }, 0.019409, { 0.23551221,0.93674856,-0.25891343 }, 0.360251 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4765625,-0.3125 }, 0.019409, { 0.44989443,0.88378906,-0.1284984 }, 0.360251 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.4140625,-0.2890625 }, 0.491058, { 0.3505868,0.38068566,0.85566777 }, 0.11828601 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.4140625,-0.2890625 }, 0.491058, { 0.45460802,-0.56651,0.6873121 }, 0.11828601 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.4140625,-0.2890625 }, 0.491058, { 0.45659435,0.17149787,0.8729892 }, 0.11828601 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.4140625,-0.2890625 }, 0.491058, { 0.69962895,-0.4497186,0.5552229 }, 0.11828601 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.4140625,-0.2890625 }, 0.263032, { -0.69962895,-0.4497186,0.5552229 }, 0.12167901 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.4140625,-0.2890625 }, 0.263032, { -0.45659435,0.17149787,0.8729892 }, 0.12167901 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.4140625,-0.2890625 }, 0.263032, { -0.45460802,-0.56651,0.6873121 }, 0.12167901 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.4140625,-0.2890625 }, 0.263032, { -0.3505868,0.38068566,0.85566777 }, 0.12167901 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.4375,-0.390625 }, 0.572792, { -0.5251108,-0.35660732,0.7727159 }, 0.139516 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.4375,-0.390625 }, 0.572792, { 0.25829673,0.105498664,0.96028787 }, 0.139516 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.4375,-0.390625 }, 0.572792, { 0.45460802,-0.56651,0.6873121 }, 0.139516 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.4375,-0.390625 }, 0.572792, { 0.45659435,0.17149787,0.8729892 }, 0.139516 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.4375,-0.390625 }, 0.181486, { -0.45659435,0.17149787,0.8729892 }, 0.145307 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.4375,-0.390625 }, 0.181486, { -0.45460802,-0.56651,0.6873121 }, 0.145307 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.4375,-0.390625 }, 0.181486, { -0.25829673,0.105498664,0.96028787 }, 0.145307 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.4375,-0.390625 }, 0.181486, { 0.5251108,-0.35660732,0.7727159 }, 0.145307 ,{ 1,1,1,1 } },Vertex{ { 1.265625,0.2890625,-0.40625 }, 0.586396, { -0.828418,0.22910498,0.5111111 }, 0.20602298 ,{ 1,1,1,1 } },Vertex{ { 1.265625,0.2890625,-0.40625 }, 0.586396, { -0.5251108,-0.35660732,0.7727159 }, 0.20602298 ,{ 1,1,1,1 } },Vertex{ { 1.265625,0.2890625,-0.40625 }, 0.586396, { 0.24549368,-0.08019794,0.9660751 }, 0.20602298 ,{ 1,1,1,1 } },Vertex{ { 1.265625,0.2890625,-0.40625 }, 0.586396, { 0.25829673,0.105498664,0.96028787 }, 0.20602298 ,{ 1,1,1,1 } },Vertex{ { -1.265625,0.2890625,-0.40625 }, 0.169745, { -0.25829673,0.105498664,0.96028787 }, 0.21252602 ,{ 1,1,1,1 } },Vertex{ { -1.265625,0.2890625,-0.40625 }, 0.169745, { -0.24549368,-0.08019794,0.9660751 }, 0.21252602 ,{ 1,1,1,1 } },Vertex{ { -1.265625,0.2890625,-0.40625 }, 0.169745, { 0.5251108,-0.35660732,0.7727159 }, 0.21252602 ,{ 1,1,1,1 } },Vertex{ { -1.265625,0.2890625,-0.40625 }, 0.169745, { 0.828418,0.22910498,0.5111111 }, 0.21252602 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.078125,-0.40625 }, 0.549027, { -0.828418,0.22910498,0.5111111 }, 0.25358802 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.078125,-0.40625 }, 0.549027, { -0.26669225,0.8308759,0.4883858 }, 0.25358802 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.078125,-0.40625 }, 0.549027, { 0.24549368,-0.08019794,0.9660751 }, 0.25358802 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.078125,-0.40625 }, 0.549027, { 0.46427953,-0.05989736,0.88366103 }, 0.25358802 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.078125,-0.40625 }, 0.208656, { -0.46427953,-0.05989736,0.88366103 }, 0.259121 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.078125,-0.40625 }, 0.208656, { -0.24549368,-0.08019794,0.9660751 }, 0.259121 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.078125,-0.40625 }, 0.208656, { 0.26669225,0.8308759,0.4883858 }, 0.259121 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.078125,-0.40625 }, 0.208656, { 0.828418,0.22910498,0.5111111 }, 0.259121 ,{ 1,1,1,1 } },Vertex{ { 1.03125,-0.0390625,-0.3046875 }, 0.500314, { -0.26669225,0.8308759,0.4883858 }, 0.288271 ,{ 1,1,1,1 } },Vertex{ { 1.03125,-0.0390625,-0.3046875 }, 0.500314, { 0.44999367,0.6589907,0.60269153 }, 0.288271 ,{ 1,1,1,1 } },Vertex{ { 1.03125,-0.0390625,-0.3046875 }, 0.500314, { 0.46427953,-0.05989736,0.88366103 }, 0.288271 ,{ 1,1,1,1 } },Vertex{ { 1.03125,-0.0390625,-0.3046875 }, 0.500314, { 0.622479,-0.30448973,0.7209757 }, 0.288271 ,{ 1,1,1,1 } },Vertex{ { -1.03125,-0.0390625,-0.3046875 }, 0.258399, { -0.622479,-0.30448973,0.7209757 }, 0.292503 ,{ 1,1,1,1 } },Vertex{ { -1.03125,-0.0390625,-0.3046875 }, 0.258399, { -0.46427953,-0.05989736,0.88366103 }, 0.292503 ,{ 1,1,1,1 } },Vertex{ { -1.03125,-0.0390625,-0.3046875 }, 0.258399, { -0.44999367,0.6589907,0.60269153 }, 0.292503 ,{ 1,1,1,1 } },Vertex{ { -1.03125,-0.0390625,-0.3046875 }, 0.258399, { 0.26669225,0.8308759,0.4883858 }, 0.292503 ,{ 1,1,1,1 } },Vertex{ { 0.828125,-0.0703125,-0.1328125 }, 0.438641, { -0.19190317,0.28600472,0.9388155 }, 0.31931698 ,{ 1,1,1,1 } },Vertex{ { 0.828125,-0.0703125,-0.1328125 }, 0.438641, { 0.08410282,0.93183124,0.35301182 }, 0.31931698 ,{ 1,1,1,1 } },Vertex{ { 0.828125,-0.0703125,-0.1328125 }, 0.438641, { 0.44999367,0.6589907,0.60269153 }, 0.31931698 ,{ 1,1,1,1 } },Vertex{ { 0.828125,-0.0703125,-0.1328125 }, 0.438641, { 0.622479,-0.30448973,0.7209757 }, 0.31931698 ,{ 1,1,1,1 } },Vertex{ { -0.828125,-0.0703125,-0.1328125 }, 0.320962, { -0.622479,-0.30448973,0.7209757 }, 0.32204098 ,{ 1,1,1,1 } },Vertex{ { -0.828125,-0.0703125,-0.1328125 }, 0.320962, { -0.44999367,0.6589907,0.60269153 }, 0.32204098 ,{ 1,1,1,1 } },Vertex{ { -0.828125,-0.0703125,-0.1328125 }, 0.320962, { -0.08410282,0.93183124,0.35301182 }, 0.32204098 ,{ 1,1,1,1 } },Vertex{ { -0.828125,-0.0703125,-0.1328125 }, 0.320962, { 0.19190317,0.28600472,0.9388155 }, 0.32204098 ,{ 1,1,1,1 } },Vertex{ { 0.921875,0.359375,-0.21875 }, 0.438797, { 0.10339721,0.15509583,0.98247355 }, 0.129771 ,{ 1,1,1,1 } },Vertex{ { 0.921875,0.359375,-0.21875 }, 0.438797, { 0.3505868,0.38068566,0.85566777 }, 0.129771 ,{ 1,1,1,1 } },Vertex{ { 0.921875,0.359375,-0.21875 }, 0.438797, { 0.59099764,-0.43049824,0.6821973 }, 0.129771 ,{ 1,1,1,1 } },Vertex{ { 0.921875,0.359375,-0.21875 }, 0.438797, { 0.69962895,-0.4497186,0.5552229 }, 0.129771 ,{ 1,1,1,1 } },Vertex{ { -0.921875,0.359375,-0.21875 }, 0.315867, { -0.69962895,-0.4497186,0.5552229 }, 0.131791 ,{ 1,1,1,1 } },Vertex{ { -0.921875,0.359375,-0.21875 }, 0.315867, { -0.59099764,-0.43049824,0.6821973 }, 0.131791 ,{ 1,1,1,1 } },Vertex{ { -0.921875,0.359375,-0.21875 }, 0.315867, { -0.3505868,0.38068566,0.85566777 }, 0.131791 ,{ 1,1,1,1 } },Vertex{ { -0.921875,0.359375,-0.21875 }, 0.315867, { -0.10339721,0.15509583,0.98247355 }, 0.131791 ,{ 1,1,1,1 } },Vertex{ { 0.9453125,0.3046875,-0.2890625 }, 0.457832, { 0.59099764,-0.43049824,0.6821973 }, 0.15995997 ,{ 1,1,1,1 } },Vertex{ { 0.9453125,0.3046875,-0.2890625 }, 0.457832, { 0.62367755,-0.7060746,0.33538792 }, 0.15995997 ,{ 1,1,1,1 } },Vertex{ { 0.9453125,0.3046875,-0.2890625 }, 0.457832, { 0.69962895,-0.4497186,0.5552229 }, 0.15995997 ,{ 1,1,1,1 } },Vertex{ { 0.9453125,0.3046875,-0.2890625 }, 0.457832, { 0.73131305,-0.65431166,0.19250342 }, 0.15995997 ,{ 1,1,1,1 } },Vertex{ { -0.9453125,0.3046875,-0.2890625 }, 0.297562, { -0.73131305,-0.65431166,0.19250342 }, 0.162642 ,{ 1,1,1,1 } },Vertex{ { -0.9453125,0.3046875,-0.2890625 }, 0.297562, { -0.69962895,-0.4497186,0.5552229 }, 0.162642 ,{ 1,1,1,1 } },Vertex{ { -0.9453125,0.3046875,-0.2890625 }, 0.297562, { -0.62367755,-0.7060746,0.33538792 }, 0.162642 ,{ 1,1,1,1 } },Vertex{ { -0.9453125,0.3046875,-0.2890625 }, 0.297562, { -0.59099764,-0.43049824,0.6821973 }, 0.162642 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.0234375,-0.2109375 }, 0.452955, { -0.055998147,0.996167,0.06719777 }, 0.299977 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.0234375,-0.2109375 }, 0.452955, { -0.008500153,0.99701786,0.07670138 }, 0.299977 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.0234375,-0.2109375 }, 0.452955, { 0.08410282,0.93183124,0.35301182 }, 0.299977 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.0234375,-0.2109375 }, 0.452955, { 0.44999367,0.6589907,0.60269153 }, 0.299977 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.0234375,-0.2109375 }, 0.306136, { -0.44999367,0.6589907,0.60269153 }, 0.303024 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.0234375,-0.2109375 }, 0.306136, { -0.08410282,0.93183124,0.35301182 }, 0.303024 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.0234375,-0.2109375 }, 0.306136, { 0.008500153,0.99701786,0.07670138 }, 0.303024 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.0234375,-0.2109375 }, 0.306136, { 0.055998147,0.996167,0.06719777 }, 0.303024 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0,-0.3671875 }, 0.505666, { -0.56549734,0.7846962,-0.25389877 }, 0.26905602 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0,-0.3671875 }, 0.505666, { -0.26669225,0.8308759,0.4883858 }, 0.26905602 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0,-0.3671875 }, 0.505666, { -0.055998147,0.996167,0.06719777 }, 0.26905602 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0,-0.3671875 }, 0.505666, { 0.44999367,0.6589907,0.60269153 }, 0.26905602 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0,-0.3671875 }, 0.252524, { -0.44999367,0.6589907,0.60269153 }, 0.273408 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0,-0.3671875 }, 0.252524, { 0.055998147,0.996167,0.06719777 }, 0.273408 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0,-0.3671875 }, 0.252524, { 0.26669225,0.8308759,0.4883858 }, 0.273408 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0,-0.3671875 }, 0.252524, { 0.56549734,0.7846962,-0.25389877 }, 0.273408 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.09375,-0.4453125 }, 0.54285, { -0.8339025,0.23770072,-0.4981015 }, 0.24424702 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.09375,-0.4453125 }, 0.54285, { -0.828418,0.22910498,0.5111111 }, 0.24424702 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.09375,-0.4453125 }, 0.54285, { -0.56549734,0.7846962,-0.25389877 }, 0.24424702 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.09375,-0.4453125 }, 0.54285, { -0.26669225,0.8308759,0.4883858 }, 0.24424702 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.09375,-0.4453125 }, 0.214575, { 0.26669225,0.8308759,0.4883858 }, 0.24958599 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.09375,-0.4453125 }, 0.214575, { 0.56549734,0.7846962,-0.25389877 }, 0.24958599 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.09375,-0.4453125 }, 0.214575, { 0.828418,0.22910498,0.5111111 }, 0.24958599 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.09375,-0.4453125 }, 0.214575, { 0.8339025,0.23770072,-0.4981015 }, 0.24958599 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.25,-0.4453125 }, 0.568148, { -0.8339025,0.23770072,-0.4981015 }, 0.21263301 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.25,-0.4453125 }, 0.568148, { -0.83279175,-0.507995,-0.21999782 }, 0.21263301 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.25,-0.4453125 }, 0.568148, { -0.828418,0.22910498,0.5111111 }, 0.21263301 ,{ 1,1,1,1 } },Vertex{ { 1.234375,0.25,-0.4453125 }, 0.568148, { -0.5251108,-0.35660732,0.7727159 }, 0.21263301 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.25,-0.4453125 }, 0.188269, { 0.5251108,-0.35660732,0.7727159 }, 0.21862501 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.25,-0.4453125 }, 0.188269, { 0.828418,0.22910498,0.5111111 }, 0.21862501 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.25,-0.4453125 }, 0.188269, { 0.83279175,-0.507995,-0.21999782 }, 0.21862501 ,{ 1,1,1,1 } },Vertex{ { -1.234375,0.25,-0.4453125 }, 0.188269, { 0.8339025,0.23770072,-0.4981015 }, 0.21862501 ,{ 1,1,1,1 } },Vertex{ { 1.171875,0.359375,-0.4375 }, 0.555495, { -0.83279175,-0.507995,-0.21999782 }, 0.173648 ,{ 1,1,1,1 } },Vertex{ { 1.171875,0.359375,-0.4375 }, 0.555495, { -0.5251108,-0.35660732,0.7727159 }, 0.173648 ,{ 1,1,1,1 } },Vertex{ { 1.171875,0.359375,-0.4375 }, 0.555495, { 0.27331164,-0.892538,0.3587153 }, 0.173648 ,{ 1,1,1,1 } },Vertex{ { 1.171875,0.359375,-0.4375 }, 0.555495, { 0.45460802,-0.56651,0.6873121 }, 0.173648 ,{ 1,1,1,1 } },Vertex{ { -1.171875,0.359375,-0.4375 }, 0.19985, { -0.45460802,-0.56651,0.6873121 }, 0.179111 ,{ 1,1,1,1 } },Vertex{ { -1.171875,0.359375,-0.4375 }, 0.19985, { -0.27331164,-0.892538,0.3587153 }, 0.179111 ,{ 1,1,1,1 } },Vertex{ { -1.171875,0.359375,-0.4375 }, 0.19985, { 0.5251108,-0.35660732,0.7727159 }, 0.179111 ,{ 1,1,1,1 } },Vertex{ { -1.171875,0.359375,-0.4375 }, 0.19985, { 0.83279175,-0.507995,-0.21999782 }, 0.179111 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.34375,-0.359375 }, 0.501231, { 0.27331164,-0.892538,0.3587153 }, 0.155644 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.34375,-0.359375 }, 0.501231, { 0.45460802,-0.56651,0.6873121 }, 0.155644 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.34375,-0.359375 }, 0.501231, { 0.62367755,-0.7060746,0.33538792 }, 0.155644 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.34375,-0.359375 }, 0.501231, { 0.69962895,-0.4497186,0.5552229 }, 0.155644 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.34375,-0.359375 }, 0.253846, { -0.69962895,-0.4497186,0.5552229 }, 0.15949798 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.34375,-0.359375 }, 0.253846, { -0.62367755,-0.7060746,0.33538792 }, 0.15949798 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.34375,-0.359375 }, 0.253846, { -0.45460802,-0.56651,0.6873121 }, 0.15949798 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.34375,-0.359375 }, 0.253846, { -0.27331164,-0.892538,0.3587153 }, 0.15949798 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.2890625,-0.2109375 }, 0.401605, { 0.10339721,0.15509583,0.98247355 }, 0.15854001 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.2890625,-0.2109375 }, 0.401605, { 0.5810875,-0.41279116,0.70138496 }, 0.15854001 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.2890625,-0.2109375 }, 0.401605, { 0.59099764,-0.43049824,0.6821973 }, 0.15854001 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.2890625,-0.2109375 }, 0.825107, { 0.98181564,-0.18040287,-0.059100937 }, 0.790238 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.2890625,-0.2109375 }, 0.199767, { -0.98181564,-0.18040287,-0.059100937 }, 0.785173 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.2890625,-0.2109375 }, 0.354026, { -0.59099764,-0.43049824,0.6821973 }, 0.15970302 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.2890625,-0.2109375 }, 0.354026, { -0.5810875,-0.41279116,0.70138496 }, 0.15970302 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.2890625,-0.2109375 }, 0.354026, { -0.10339721,0.15509583,0.98247355 }, 0.15970302 ,{ 1,1,1,1 } },Vertex{ { 0.8359375,0.171875,-0.2734375 }, 0.418086, { 0.5810875,-0.41279116,0.70138496 }, 0.21505398 ,{ 1,1,1,1 } },Vertex{ { 0.8359375,0.171875,-0.2734375 }, 0.418086, { 0.70224965,-0.70224965,0.11700827 }, 0.21505398 ,{ 1,1,1,1 } },Vertex{ { 0.8359375,0.171875,-0.2734375 }, 0.418086, { 0.7867186,-0.6079144,0.10730254 }, 0.21505398 ,{ 1,1,1,1 } },Vertex{ { 0.8359375,0.171875,-0.2734375 }, 0.418086, { 0.8032326,-0.48471966,0.34621406 }, 0.21505398 ,{ 1,1,1,1 } },Vertex{ { -0.8359375,0.171875,-0.2734375 }, 0.338952, { -0.8032326,-0.48471966,0.34621406 }, 0.21692699 ,{ 1,1,1,1 } },Vertex{ { -0.8359375,0.171875,-0.2734375 }, 0.338952, { -0.7867186,-0.6079144,0.10730254 }, 0.21692699 ,{ 1,1,1,1 } },Vertex{ { -0.8359375,0.171875,-0.2734375 }, 0.338952, { -0.70224965,-0.70224965,0.11700827 }, 0.21692699 ,{ 1,1,1,1 } },Vertex{ { -0.8359375,0.171875,-0.2734375 }, 0.338952, { -0.5810875,-0.41279116,0.70138496 }, 0.21692699 ,{ 1,1,1,1 } },Vertex{ { 0.7578125,0.09375,-0.2734375 }, 0.410995, { 0.18399948,0.9815972,-0.051099855 }, 0.252338 ,{ 1,1,1,1 } },Vertex{ { 0.7578125,0.09375,-0.2734375 }, 0.410995, { 0.43092853,0.47403136,0.76785076 }, 0.252338 ,{ 1,1,1,1 } },Vertex{ { 0.7578125,0.09375,-0.2734375 }, 0.410995, { 0.70224965,-0.70224965,0.11700827 }, 0.252338 ,{ 1,1,1,1 } },Vertex{ { 0.7578125,0.09375,-0.2734375 }, 0.410995, { 0.8032326,-0.48471966,0.34621406 }, 0.252338 ,{ 1,1,1,1 } },Vertex{ { -0.7578125,0.09375,-0.2734375 }, 0.347028, { -0.8032326,-0.48471966,0.34621406 }, 0.254184 ,{ 1,1,1,1 } },Vertex{ { -0.7578125,0.09375,-0.2734375 }, 0.347028, { -0.70224965,-0.70224965,0.11700827 }, 0.254184 ,{ 1,1,1,1 } },Vertex{ { -0.7578125,0.09375,-0.2734375 }, 0.347028, { -0.43092853,0.47403136,0.76785076 }, 0.254184 ,{ 1,1,1,1 } },Vertex{ { -0.7578125,0.09375,-0.2734375 }, 0.347028, { -0.18399948,0.9815972,-0.051099855 }, 0.254184 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.0859375,-0.2734375 }, 0.427812, { 0.18399948,0.9815972,-0.051099855 }, 0.257172 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.0859375,-0.2734375 }, 0.427812, { 0.43092853,0.47403136,0.76785076 }, 0.257172 ,{ 1,1,1,1 } },Vertex{ { 0.8203125,0.0859375,-0.2734375 }, 0.427812, { 0.9351759,0.3300915,0.12839669 }, 0.257172 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.0859375,-0.2734375 }, 0.33027, { -0.9351759,0.3300915,0.12839669 }, 0.25946403 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.0859375,-0.2734375 }, 0.33027, { -0.43092853,0.47403136,0.76785076 }, 0.25946403 ,{ 1,1,1,1 } },Vertex{ { -0.8203125,0.0859375,-0.2734375 }, 0.33027, { -0.18399948,0.9815972,-0.051099855 }, 0.25946403 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.015625,-0.2734375 }, 0.433669, { 0.43092853,0.47403136,0.76785076 }, 0.270339 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.015625,-0.2734375 }, 0.433669, { 0.64460176,-0.08830024,0.75940216 }, 0.270339 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.015625,-0.2734375 }, 0.433669, { 0.6633038,-0.7463043,0.055300318 }, 0.270339 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.015625,-0.2734375 }, 0.433669, { 0.9351759,0.3300915,0.12839669 }, 0.270339 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.015625,-0.2734375 }, 0.324726, { -0.9351759,0.3300915,0.12839669 }, 0.27282298 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.015625,-0.2734375 }, 0.324726, { -0.6633038,-0.7463043,0.055300318 }, 0.27282298 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.015625,-0.2734375 }, 0.324726, { -0.64460176,-0.08830024,0.75940216 }, 0.27282298 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.015625,-0.2734375 }, 0.324726, { -0.43092853,0.47403136,0.76785076 }, 0.27282298 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.2734375 }, 0.435018, { -0.008500153,0.99701786,0.07670138 }, 0.28171998 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.2734375 }, 0.435018, { 0.08410282,0.93183124,0.35301182 }, 0.28171998 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.2734375 }, 0.435018, { 0.64460176,-0.08830024,0.75940216 }, 0.28171998 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.2734375 }, 0.435018, { 0.6633038,-0.7463043,0.055300318 }, 0.28171998 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.2734375 }, 0.323658, { -0.6633038,-0.7463043,0.055300318 }, 0.28426898 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.2734375 }, 0.323658, { -0.64460176,-0.08830024,0.75940216 }, 0.28426898 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.2734375 }, 0.323658, { -0.08410282,0.93183124,0.35301182 }, 0.28426898 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.2734375 }, 0.323658, { 0.008500153,0.99701786,0.07670138 }, 0.28426898 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0,-0.0703125 }, 0.783193, { 0.72198486,-0.6826857,-0.11259764 }, 0.812551 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0,-0.0703125 }, 0.783193, { 0.90480334,-0.37340137,-0.20470075 }, 0.812551 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0,-0.0703125 }, 0.783193, { 0.91048694,-0.39649433,-0.117498316 }, 0.812551 ,{ 1,1,1,1 } },Vertex{ { 0.7265625,0,-0.0703125 }, 0.783193, { 0.9972042,-0.018100077,-0.0725003 }, 0.812551 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0,-0.0703125 }, 0.246955, { -0.9972042,-0.018100077,-0.0725003 }, 0.812925 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0,-0.0703125 }, 0.246955, { -0.91048694,-0.39649433,-0.117498316 }, 0.812925 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0,-0.0703125 }, 0.246955, { -0.90480334,-0.37340137,-0.20470075 }, 0.812925 ,{ 1,1,1,1 } },Vertex{ { -0.7265625,0,-0.0703125 }, 0.246955, { -0.72198486,-0.6826857,-0.11259764 }, 0.812925 ,{ 1,1,1,1 } },Vertex{ { 0.71875,-0.0234375,-0.171875 }, 0.394766, { -0.19190317,0.28600472,0.9388155 }, 0.31387502 ,{ 1,1,1,1 } },Vertex{ { 0.71875,-0.0234375,-0.171875 }, 0.394766, { 0.08410282,0.93183124,0.35301182 }, 0.31387502 ,{ 1,1,1,1 } },Vertex{ { 0.71875,-0.0234375,-0.171875 }, 0.394766, { 0.64460176,-0.08830024,0.75940216 }, 0.31387502 ,{ 1,1,1,1 } },Vertex{ { 0.71875,-0.0234375,-0.171875 }, 0.796021, { 0.72198486,-0.6826857,-0.11259764 }, 0.823031 ,{ 1,1,1,1 } },Vertex{ { 0.71875,-0.0234375,-0.171875 }, 0.796021, { 0.9972042,-0.018100077,-0.0725003 }, 0.823031 ,{ 1,1,1,1 } },Vertex{ { -0.71875,-0.0234375,-0.171875 }, 0.233625, { -0.9972042,-0.018100077,-0.0725003 }, 0.82438 ,{ 1,1,1,1 } },Vertex{ { -0.71875,-0.0234375,-0.171875 }, 0.233625, { -0.72198486,-0.6826857,-0.11259764 }, 0.82438 ,{ 1,1,1,1 } },Vertex{ { -0.71875,-0.0234375,-0.171875 }, 0.364838, { -0.64460176,-0.08830024,0.75940216 }, 0.31555498 ,{ 1,1,1,1 } },Vertex{ { -0.71875,-0.0234375,-0.171875 }, 0.364838, { -0.08410282,0.93183124,0.35301182 }, 0.31555498 ,{ 1,1,1,1 } },Vertex{ { -0.71875,-0.0234375,-0.171875 }, 0.364838, { 0.19190317,0.28600472,0.9388155 }, 0.31555498 ,{ 1,1,1,1 } },Vertex{ { 0.71875,0.0390625,-0.1875 }, 0.384658, { 0.43092853,0.47403136,0.76785076 }, 0.28970098 ,{ 1,1,1,1 } },Vertex{ { 0.71875,0.0390625,-0.1875 }, 0.384658, { 0.64460176,-0.08830024,0.75940216 }, 0.28970098 ,{ 1,1,1,1 } },Vertex{ { 0.71875,0.0390625,-0.1875 }, 0.384658, { 0.8032326,-0.48471966,0.34621406 }, 0.28970098 ,{ 1,1,1,1 } },Vertex{ { 0.71875,0.0390625,-0.1875 }, 0.802192, { 0.91048694,-0.39649433,-0.117498316 }, 0.815391 ,{ 1,1,1,1 } },Vertex{ { 0.71875,0.0390625,-0.1875 }, 0.802192, { 0.9972042,-0.018100077,-0.0725003 }, 0.815391 ,{ 1,1,1,1 } },Vertex{ { -0.71875,0.0390625,-0.1875 }, 0.226485, { -0.9972042,-0.018100077,-0.0725003 }, 0.816914 ,{ 1,1,1,1 } },Vertex{ { -0.71875,0.0390625,-0.1875 }, 0.226485, { -0.91048694,-0.39649433,-0.117498316 }, 0.816914 ,{ 1,1,1,1 } },Vertex{ { -0.71875,0.0390625,-0.1875 }, 0.3744, { -0.8032326,-0.48471966,0.34621406 }, 0.291031 ,{ 1,1,1,1 } },Vertex{ { -0.71875,0.0390625,-0.1875 }, 0.3744, { -0.64460176,-0.08830024,0.75940216 }, 0.291031 ,{ 1,1,1,1 } },Vertex{ { -0.71875,0.0390625,-0.1875 }, 0.3744, { -0.43092853,0.47403136,0.76785076 }, 0.291031 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.203125,-0.2109375 }, 0.384657, { 0.5810875,-0.41279116,0.70138496 }, 0.20457703 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.203125,-0.2109375 }, 0.384657, { 0.8032326,-0.48471966,0.34621406 }, 0.20457703 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.203125,-0.2109375 }, 0.816266, { 0.91048694,-0.39649433,-0.117498316 }, 0.796914 ,{ 1,1,1,1 } },Vertex{ { 0.796875,0.203125,-0.2109375 }, 0.816266, { 0.98181564,-0.18040287,-0.059100937 }, 0.796914 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.203125,-0.2109375 }, 0.209828, { -0.98181564,-0.18040287,-0.059100937 }, 0.793839 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.203125,-0.2109375 }, 0.209828, { -0.91048694,-0.39649433,-0.117498316 }, 0.793839 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.203125,-0.2109375 }, 0.37227, { -0.8032326,-0.48471966,0.34621406 }, 0.20552802 ,{ 1,1,1,1 } },Vertex{ { -0.796875,0.203125,-0.2109375 }, 0.37227, { -0.5810875,-0.41279116,0.70138496 }, 0.20552802 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.2421875,-0.265625 }, 0.431333, { 0.5810875,-0.41279116,0.70138496 }, 0.18246502 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.2421875,-0.265625 }, 0.431333, { 0.59099764,-0.43049824,0.6821973 }, 0.18246502 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.2421875,-0.265625 }, 0.431333, { 0.73131305,-0.65431166,0.19250342 }, 0.18246502 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.2421875,-0.265625 }, 0.431333, { 0.7867186,-0.6079144,0.10730254 }, 0.18246502 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.2421875,-0.265625 }, 0.32479, { -0.7867186,-0.6079144,0.10730254 }, 0.18453997 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.2421875,-0.265625 }, 0.32479, { -0.73131305,-0.65431166,0.19250342 }, 0.18453997 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.2421875,-0.265625 }, 0.32479, { -0.59099764,-0.43049824,0.6821973 }, 0.18453997 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.2421875,-0.265625 }, 0.32479, { -0.5810875,-0.41279116,0.70138496 }, 0.18453997 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.234375,-0.3203125 }, 0.448505, { 0.2571938,-0.060298547,0.96447676 }, 0.19537902 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.234375,-0.3203125 }, 0.448505, { 0.40060395,-0.03430034,0.91560906 }, 0.19537902 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.234375,-0.3203125 }, 0.448505, { 0.73131305,-0.65431166,0.19250342 }, 0.19537902 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.234375,-0.3203125 }, 0.448505, { 0.7867186,-0.6079144,0.10730254 }, 0.19537902 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.234375,-0.3203125 }, 0.307886, { -0.7867186,-0.6079144,0.10730254 }, 0.19796902 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.234375,-0.3203125 }, 0.307886, { -0.73131305,-0.65431166,0.19250342 }, 0.19796902 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.234375,-0.3203125 }, 0.307886, { -0.40060395,-0.03430034,0.91560906 }, 0.19796902 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.234375,-0.3203125 }, 0.307886, { -0.2571938,-0.060298547,0.96447676 }, 0.19796902 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.3203125 }, 0.440995, { -0.36370456,0.70390886,0.61010766 }, 0.275617 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.3203125 }, 0.440995, { -0.008500153,0.99701786,0.07670138 }, 0.275617 ,{ 1,1,1,1 } },Vertex{ { 0.8125,-0.015625,-0.3203125 }, 0.440995, { 0.6633038,-0.7463043,0.055300318 }, 0.275617 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.3203125 }, 0.31751, { -0.6633038,-0.7463043,0.055300318 }, 0.27830303 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.3203125 }, 0.31751, { 0.008500153,0.99701786,0.07670138 }, 0.27830303 ,{ 1,1,1,1 } },Vertex{ { -0.8125,-0.015625,-0.3203125 }, 0.31751, { 0.36370456,0.70390886,0.61010766 }, 0.27830303 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.015625,-0.3203125 }, 0.445392, { -0.36370456,0.70390886,0.61010766 }, 0.268003 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.015625,-0.3203125 }, 0.445392, { 0.14449368,0.02219903,0.98925674 }, 0.268003 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.015625,-0.3203125 }, 0.445392, { 0.6633038,-0.7463043,0.055300318 }, 0.268003 ,{ 1,1,1,1 } },Vertex{ { 0.8515625,0.015625,-0.3203125 }, 0.445392, { 0.9351759,0.3300915,0.12839669 }, 0.268003 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.015625,-0.3203125 }, 0.312907, { -0.9351759,0.3300915,0.12839669 }, 0.270778 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.015625,-0.3203125 }, 0.312907, { -0.6633038,-0.7463043,0.055300318 }, 0.270778 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.015625,-0.3203125 }, 0.312907, { -0.14449368,0.02219903,0.98925674 }, 0.270778 ,{ 1,1,1,1 } },Vertex{ { -0.8515625,0.015625,-0.3203125 }, 0.312907, { 0.36370456,0.70390886,0.61010766 }, 0.270778 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.078125,-0.3203125 }, 0.43795, { 0.06370081,-0.010600135,0.99791276 }, 0.25022298 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.078125,-0.3203125 }, 0.43795, { 0.14449368,0.02219903,0.98925674 }, 0.25022298 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.078125,-0.3203125 }, 0.43795, { 0.18399948,0.9815972,-0.051099855 }, 0.25022298 ,{ 1,1,1,1 } },Vertex{ { 0.828125,0.078125,-0.3203125 }, 0.43795, { 0.9351759,0.3300915,0.12839669 }, 0.25022298 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.078125,-0.3203125 }, 0.319919, { -0.9351759,0.3300915,0.12839669 }, 0.25274998 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.078125,-0.3203125 }, 0.319919, { -0.18399948,0.9815972,-0.051099855 }, 0.25274998 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.078125,-0.3203125 }, 0.319919, { -0.14449368,0.02219903,0.98925674 }, 0.25274998 ,{ 1,1,1,1 } },Vertex{ { -0.828125,0.078125,-0.3203125 }, 0.319919, { -0.06370081,-0.010600135,0.99791276 }, 0.25274998 ,{ 1,1,1,1 } },Vertex{ { 0.765625,0.09375,-0.3203125 }, 0.423718, { 0.06370081,-0.010600135,0.99791276 }, 0.24580902 ,{ 1,1,1,1 } },Vertex{ { 0.765625,0.09375,-0.3203125 }, 0.423718, { 0.18399948,0.9815972,-0.051099855 }, 0.24580902 ,{ 1,1,1,1 } },Vertex{ { 0.765625,0.09375,-0.3203125 }, 0.423718, { 0.70224965,-0.70224965,0.11700827 }, 0.24580902 ,{ 1,1,1,1 } },Vertex{ { -0.765625,0.09375,-0.3203125 }, 0.334089, { -0.70224965,-0.70224965,0.11700827 }, 0.24795502 ,{ 1,1,1,1 } },Vertex{ { -0.765625,0.09375,-0.3203125 }, 0.334089, { -0.18399948,0.9815972,-0.051099855 }, 0.24795502 ,{ 1,1,1,1 } },Vertex{ { -0.765625,0.09375,-0.3203125 }, 0.334089, { -0.06370081,-0.010600135,0.99791276 }, 0.24795502 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.171875,-0.3203125 }, 0.435868, { 0.06370081,-0.010600135,0.99791276 }, 0.22043103 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.171875,-0.3203125 }, 0.435868, { 0.2571938,-0.060298547,0.96447676 }, 0.22043103 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.171875,-0.3203125 }, 0.435868, { 0.70224965,-0.70224965,0.11700827 }, 0.22043103 ,{ 1,1,1,1 } },Vertex{ { 0.84375,0.171875,-0.3203125 }, 0.435868, { 0.7867186,-0.6079144,0.10730254 }, 0.22043103 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.171875,-0.3203125 }, 0.321237, { -0.7867186,-0.6079144,0.10730254 }, 0.22279203 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.171875,-0.3203125 }, 0.321237, { -0.70224965,-0.70224965,0.11700827 }, 0.22279203 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.171875,-0.3203125 }, 0.321237, { -0.2571938,-0.060298547,0.96447676 }, 0.22279203 ,{ 1,1,1,1 } },Vertex{ { -0.84375,0.171875,-0.3203125 }, 0.321237, { -0.06370081,-0.010600135,0.99791276 }, 0.22279203 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0.328125,-0.4140625 }, 0.512485, { 0.27331164,-0.892538,0.3587153 }, 0.17118901 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0.328125,-0.4140625 }, 0.512485, { 0.298,0.5802,0.758 }, 0.17118901 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0.328125,-0.4140625 }, 0.512485, { 0.34869474,0.28489572,0.8928866 }, 0.17118901 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,0.328125,-0.4140625 }, 0.512485, { 0.62367755,-0.7060746,0.33538792 }, 0.17118901 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0.328125,-0.4140625 }, 0.242975, { -0.62367755,-0.7060746,0.33538792 }, 0.175426 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0.328125,-0.4140625 }, 0.242975, { -0.34869474,0.28489572,0.8928866 }, 0.175426 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0.328125,-0.4140625 }, 0.242975, { -0.298,0.5802,0.758 }, 0.175426 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,0.328125,-0.4140625 }, 0.242975, { -0.27331164,-0.892538,0.3587153 }, 0.175426 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.34375,-0.484375 }, 0.550942, { -0.83279175,-0.507995,-0.21999782 }, 0.18818599 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.34375,-0.484375 }, 0.550942, { 0.27331164,-0.892538,0.3587153 }, 0.18818599 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.34375,-0.484375 }, 0.550942, { 0.298,0.5802,0.758 }, 0.18818599 ,{ 1,1,1,1 } },Vertex{ { 1.1875,0.34375,-0.484375 }, 0.550942, { 0.5257938,0.2618969,0.80929047 }, 0.18818599 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.34375,-0.484375 }, 0.204839, { -0.5257938,0.2618969,0.80929047 }, 0.19358301 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.34375,-0.484375 }, 0.204839, { -0.298,0.5802,0.758 }, 0.19358301 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.34375,-0.484375 }, 0.204839, { -0.27331164,-0.892538,0.3587153 }, 0.19358301 ,{ 1,1,1,1 } },Vertex{ { -1.1875,0.34375,-0.484375 }, 0.204839, { 0.83279175,-0.507995,-0.21999782 }, 0.19358301 ,{ 1,1,1,1 } },Vertex{ { 1.2578125,0.2421875,-0.4921875 }, 0.552139, { -0.8339025,0.23770072,-0.4981015 }, 0.212318 ,{ 1,1,1,1 } },Vertex{ { 1.2578125,0.2421875,-0.4921875 }, 0.552139, { -0.83279175,-0.507995,-0.21999782 }, 0.212318 ,{ 1,1,1,1 } },Vertex{ { 1.2578125,0.2421875,-0.4921875 }, 0.552139, { 0.50720465,-0.21410196,0.83480763 }, 0.212318 ,{ 1,1,1,1 } },Vertex{ { 1.2578125,0.2421875,-0.4921875 }, 0.552139, { 0.5257938,0.2618969,0.80929047 }, 0.212318 ,{ 1,1,1,1 } },Vertex{ { -1.2578125,0.2421875,-0.4921875 }, 0.204331, { -0.5257938,0.2618969,0.80929047 }, 0.21784401 ,{ 1,1,1,1 } },Vertex{ { -1.2578125,0.2421875,-0.4921875 }, 0.204331, { -0.50720465,-0.21410196,0.83480763 }, 0.21784401 ,{ 1,1,1,1 } },Vertex{ { -1.2578125,0.2421875,-0.4921875 }, 0.204331, { 0.83279175,-0.507995,-0.21999782 }, 0.21784401 ,{ 1,1,1,1 } },Vertex{ { -1.2578125,0.2421875,-0.4921875 }, 0.204331, { 0.8339025,0.23770072,-0.4981015 }, 0.21784401 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.0859375,-0.484375 }, 0.539407, { -0.8339025,0.23770072,-0.4981015 }, 0.235461 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.0859375,-0.484375 }, 0.539407, { -0.56549734,0.7846962,-0.25389877 }, 0.235461 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.0859375,-0.484375 }, 0.539407, { 0.44721594,-0.20020714,0.87173104 }, 0.235461 ,{ 1,1,1,1 } },Vertex{ { 1.2109375,0.0859375,-0.484375 }, 0.539407, { 0.50720465,-0.21410196,0.83480763 }, 0.235461 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.0859375,-0.484375 }, 0.217774, { -0.50720465,-0.21410196,0.83480763 }, 0.240681 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.0859375,-0.484375 }, 0.217774, { -0.44721594,-0.20020714,0.87173104 }, 0.240681 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.0859375,-0.484375 }, 0.217774, { 0.56549734,0.7846962,-0.25389877 }, 0.240681 ,{ 1,1,1,1 } },Vertex{ { -1.2109375,0.0859375,-0.484375 }, 0.217774, { 0.8339025,0.23770072,-0.4981015 }, 0.240681 ,{ 1,1,1,1 } },Vertex{ { 1.046875,0,-0.421875 }, 0.508439, { -0.56549734,0.7846962,-0.25389877 }, 0.25686502 ,{ 1,1,1,1 } },Vertex{ { 1.046875,0,-0.421875 }, 0.508439, { -0.055998147,0.996167,0.06719777 }, 0.25686502 ,{ 1,1,1,1 } },Vertex{ { 1.046875,0,-0.421875 }, 0.508439, { 0.44721594,-0.20020714,0.87173104 }, 0.25686502 ,{ 1,1,1,1 } },Vertex{ { 1.046875,0,-0.421875 }, 0.508439, { 0.62988263,0.035499025,0.77587867 }, 0.25686502 ,{ 1,1,1,1 } },Vertex{ { -1.046875,0,-0.421875 }, 0.249419, { -0.62988263,0.035499025,0.77587867 }, 0.26126802 ,{ 1,1,1,1 } },Vertex{ { -1.046875,0,-0.421875 }, 0.249419, { -0.44721594,-0.20020714,0.87173104 }, 0.26126802 ,{ 1,1,1,1 } },Vertex{ { -1.046875,0,-0.421875 }, 0.249419, { 0.055998147,0.996167,0.06719777 }, 0.26126802 ,{ 1,1,1,1 } },Vertex{ { -1.046875,0,-0.421875 }, 0.249419, { 0.56549734,0.7846962,-0.25389877 }, 0.26126802 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.015625,-0.265625 }, 0.455277, { -0.36370456,0.70390886,0.61010766 }, 0.286269 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.015625,-0.265625 }, 0.455277, { -0.055998147,0.996167,0.06719777 }, 0.286269 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.015625,-0.265625 }, 0.455277, { -0.008500153,0.99701786,0.07670138 }, 0.286269 ,{ 1,1,1,1 } },Vertex{ { 0.8828125,-0.015625,-0.265625 }, 0.455277, { 0.62988263,0.035499025,0.77587867 }, 0.286269 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.015625,-0.265625 }, 0.30346, { -0.62988263,0.035499025,0.77587867 }, 0.289343 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.015625,-0.265625 }, 0.30346, { 0.008500153,0.99701786,0.07670138 }, 0.289343 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.015625,-0.265625 }, 0.30346, { 0.055998147,0.996167,0.06719777 }, 0.289343 ,{ 1,1,1,1 } },Vertex{ { -0.8828125,-0.015625,-0.265625 }, 0.30346, { 0.36370456,0.70390886,0.61010766 }, 0.289343 ,{ 1,1,1,1 } },Vertex{ { 0.953125,0.2890625,-0.34375 }, 0.473386, { 0.34869474,0.28489572,0.8928866 }, 0.1753 ,{ 1,1,1,1 } },Vertex{ { 0.953125,0.2890625,-0.34375 }, 0.473386, { 0.40060395,-0.03430034,0.91560906 }, 0.1753 ,{ 1,1,1,1 } },Vertex{ { 0.953125,0.2890625,-0.34375 }, 0.473386, { 0.62367755,-0.7060746,0.33538792 }, 0.1753 ,{ 1,1,1,1 } },Vertex{ { 0.953125,0.2890625,-0.34375 }, 0.473386, { 0.73131305,-0.65431166,0.19250342 }, 0.1753 ,{ 1,1,1,1 } },Vertex{ { -0.953125,0.2890625,-0.34375 }, 0.282357, { -0.73131305,-0.65431166,0.19250342 }, 0.17847502 ,{ 1,1,1,1 } },Vertex{ { -0.953125,0.2890625,-0.34375 }, 0.282357, { -0.62367755,-0.7060746,0.33538792 }, 0.17847502 ,{ 1,1,1,1 } },Vertex{ { -0.953125,0.2890625,-0.34375 }, 0.282357, { -0.40060395,-0.03430034,0.91560906 }, 0.17847502 ,{ 1,1,1,1 } },Vertex{ { -0.953125,0.2890625,-0.34375 }, 0.282357, { -0.34869474,0.28489572,0.8928866 }, 0.17847502 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.109375,-0.328125 }, 0.454776, { 0.06370081,-0.010600135,0.99791276 }, 0.23833501 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.109375,-0.328125 }, 0.454776, { 0.14449368,0.02219903,0.98925674 }, 0.23833501 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.109375,-0.328125 }, 0.454776, { 0.2571938,-0.060298547,0.96447676 }, 0.23833501 ,{ 1,1,1,1 } },Vertex{ { 0.890625,0.109375,-0.328125 }, 0.454776, { 0.32748365,0.064496785,0.94265306 }, 0.23833501 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.109375,-0.328125 }, 0.302729, { -0.32748365,0.064496785,0.94265306 }, 0.24125803 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.109375,-0.328125 }, 0.302729, { -0.2571938,-0.060298547,0.96447676 }, 0.24125803 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.109375,-0.328125 }, 0.302729, { -0.14449368,0.02219903,0.98925674 }, 0.24125803 ,{ 1,1,1,1 } },Vertex{ { -0.890625,0.109375,-0.328125 }, 0.302729, { -0.06370081,-0.010600135,0.99791276 }, 0.24125803 ,{ 1,1,1,1 } },Vertex{ { 0.9375,0.0625,-0.3359375 }, 0.470841, { -0.36370456,0.70390886,0.61010766 }, 0.25159198 ,{ 1,1,1,1 } },Vertex{ { 0.9375,0.0625,-0.3359375 }, 0.470841, { 0.14449368,0.02219903,0.98925674 }, 0.25159198 ,{ 1,1,1,1 } },Vertex{ { 0.9375,0.0625,-0.3359375 }, 0.470841, { 0.32748365,0.064496785,0.94265306 }, 0.25159198 ,{ 1,1,1,1 } },Vertex{ { 0.9375,0.0625,-0.3359375 }, 0.470841, { 0.62988263,0.035499025,0.77587867 }, 0.25159198 ,{ 1,1,1,1 } },Vertex{ { -0.9375,0.0625,-0.3359375 }, 0.28696, { -0.62988263,0.035499025,0.77587867 }, 0.25498003 ,{ 1,1,1,1 } },Vertex{ { -0.9375,0.0625,-0.3359375 }, 0.28696, { -0.32748365,0.064496785,0.94265306 }, 0.25498003 ,{ 1,1,1,1 } },Vertex{ { -0.9375,0.0625,-0.3359375 }, 0.28696, { -0.14449368,0.02219903,0.98925674 }, 0.25498003 ,{ 1,1,1,1 } },Vertex{ { -0.9375,0.0625,-0.3359375 }, 0.28696, { 0.36370456,0.70390886,0.61010766 }, 0.25498003 ,{ 1,1,1,1 } },Vertex{ { 1,0.125,-0.3671875 }, 0.48887, { 0.31269068,0.023199309,0.94957167 }, 0.229536 ,{ 1,1,1,1 } },Vertex{ { 1,0.125,-0.3671875 }, 0.48887, { 0.32748365,0.064496785,0.94265306 }, 0.229536 ,{ 1,1,1,1 } },Vertex{ { 1,0.125,-0.3671875 }, 0.48887, { 0.44721594,-0.20020714,0.87173104 }, 0.229536 ,{ 1,1,1,1 } },Vertex{ { 1,0.125,-0.3671875 }, 0.48887, { 0.62988263,0.035499025,0.77587867 }, 0.229536 ,{ 1,1,1,1 } },Vertex{ { -1,0.125,-0.3671875 }, 0.268291, { -0.62988263,0.035499025,0.77587867 }, 0.23333901 ,{ 1,1,1,1 } },Vertex{ { -1,0.125,-0.3671875 }, 0.268291, { -0.44721594,-0.20020714,0.87173104 }, 0.23333901 ,{ 1,1,1,1 } },Vertex{ { -1,0.125,-0.3671875 }, 0.268291, { -0.32748365,0.064496785,0.94265306 }, 0.23333901 ,{ 1,1,1,1 } },Vertex{ { -1,0.125,-0.3671875 }, 0.268291, { -0.31269068,0.023199309,0.94957167 }, 0.23333901 ,{ 1,1,1,1 } },Vertex{ { 0.9609375,0.171875,-0.3515625 }, 0.475403, { 0.2571938,-0.060298547,0.96447676 }, 0.21609598 ,{ 1,1,1,1 } },Vertex{ { 0.9609375,0.171875,-0.3515625 }, 0.475403, { 0.31269068,0.023199309,0.94957167 }, 0.21609598 ,{ 1,1,1,1 } },Vertex{ { 0.9609375,0.171875,-0.3515625 }, 0.475403, { 0.32748365,0.064496785,0.94265306 }, 0.21609598 ,{ 1,1,1,1 } },Vertex{ { 0.9609375,0.171875,-0.3515625 }, 0.475403, { 0.40060395,-0.03430034,0.91560906 }, 0.21609598 ,{ 1,1,1,1 } },Vertex{ { -0.9609375,0.171875,-0.3515625 }, 0.281439, { -0.40060395,-0.03430034,0.91560906 }, 0.21948898 ,{ 1,1,1,1 } },Vertex{ { -0.9609375,0.171875,-0.3515625 }, 0.281439, { -0.32748365,0.064496785,0.94265306 }, 0.21948898 ,{ 1,1,1,1 } },Vertex{ { -0.9609375,0.171875,-0.3515625 }, 0.281439, { -0.31269068,0.023199309,0.94957167 }, 0.21948898 ,{ 1,1,1,1 } },Vertex{ { -0.9609375,0.171875,-0.3515625 }, 0.281439, { -0.2571938,-0.060298547,0.96447676 }, 0.21948898 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.234375,-0.375 }, 0.494476, { 0.1709983,0.027399728,0.9848903 }, 0.19752997 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.234375,-0.375 }, 0.494476, { 0.31269068,0.023199309,0.94957167 }, 0.19752997 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.234375,-0.375 }, 0.494476, { 0.34869474,0.28489572,0.8928866 }, 0.19752997 ,{ 1,1,1,1 } },Vertex{ { 1.015625,0.234375,-0.375 }, 0.494476, { 0.40060395,-0.03430034,0.91560906 }, 0.19752997 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.234375,-0.375 }, 0.26179, { -0.40060395,-0.03430034,0.91560906 }, 0.201374 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.234375,-0.375 }, 0.26179, { -0.34869474,0.28489572,0.8928866 }, 0.201374 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.234375,-0.375 }, 0.26179, { -0.31269068,0.023199309,0.94957167 }, 0.201374 ,{ 1,1,1,1 } },Vertex{ { -1.015625,0.234375,-0.375 }, 0.26179, { -0.1709983,0.027399728,0.9848903 }, 0.201374 ,{ 1,1,1,1 } },Vertex{ { 1.0546875,0.1875,-0.3828125 }, 0.503673, { 0.1709983,0.027399728,0.9848903 }, 0.21243799 ,{ 1,1,1,1 } },Vertex{ { 1.0546875,0.1875,-0.3828125 }, 0.503673, { 0.31269068,0.023199309,0.94957167 }, 0.21243799 ,{ 1,1,1,1 } },Vertex{ { 1.0546875,0.1875,-0.3828125 }, 0.503673, { 0.44721594,-0.20020714,0.87173104 }, 0.21243799 ,{ 1,1,1,1 } },Vertex{ { 1.0546875,0.1875,-0.3828125 }, 0.503673, { 0.50720465,-0.21410196,0.83480763 }, 0.21243799 ,{ 1,1,1,1 } },Vertex{ { -1.0546875,0.1875,-0.3828125 }, 0.252972, { -0.50720465,-0.21410196,0.83480763 }, 0.21658999 ,{ 1,1,1,1 } },Vertex{ { -1.0546875,0.1875,-0.3828125 }, 0.252972, { -0.44721594,-0.20020714,0.87173104 }, 0.21658999 ,{ 1,1,1,1 } },Vertex{ { -1.0546875,0.1875,-0.3828125 }, 0.252972, { -0.31269068,0.023199309,0.94957167 }, 0.21658999 ,{ 1,1,1,1 } },Vertex{ { -1.0546875,0.1875,-0.3828125 }, 0.252972, { -0.1709983,0.027399728,0.9848903 }, 0.21658999 ,{ 1,1,1,1 } },Vertex{ { 1.109375,0.2109375,-0.390625 }, 0.518562, { 0.1709983,0.027399728,0.9848903 }, 0.20839798 ,{ 1,1,1,1 } },Vertex{ { 1.109375,0.2109375,-0.390625 }, 0.518562, { 0.50720465,-0.21410196,0.83480763 }, 0.20839798 ,{ 1,1,1,1 } },Vertex{ { 1.109375,0.2109375,-0.390625 }, 0.518562, { 0.5257938,0.2618969,0.80929047 }, 0.20839798 ,{ 1,1,1,1 } },Vertex{ { -1.109375,0.2109375,-0.390625 }, 0.23792, { -0.5257938,0.2618969,0.80929047 }, 0.212955 ,{ 1,1,1,1 } },Vertex{ { -1.109375,0.2109375,-0.390625 }, 0.23792, { -0.50720465,-0.21410196,0.83480763 }, 0.212955 ,{ 1,1,1,1 } },Vertex{ { -1.109375,0.2109375,-0.390625 }, 0.23792, { -0.1709983,0.027399728,0.9848903 }, 0.212955 ,{ 1,1,1,1 } },Vertex{ { 1.0859375,0.2734375,-0.390625 }, 0.516802, { 0.1709983,0.027399728,0.9848903 }, 0.19266099 ,{ 1,1,1,1 } },Vertex{ { 1.0859375,0.2734375,-0.390625 }, 0.516802, { 0.298,0.5802,0.758 }, 0.19266099 ,{ 1,1,1,1 } },Vertex{ { 1.0859375,0.2734375,-0.390625 }, 0.516802, { 0.34869474,0.28489572,0.8928866 }, 0.19266099 ,{ 1,1,1,1 } },Vertex{ { 1.0859375,0.2734375,-0.390625 }, 0.516802, { 0.5257938,0.2618969,0.80929047 }, 0.19266099 ,{ 1,1,1,1 } },Vertex{ { -1.0859375,0.2734375,-0.390625 }, 0.239243, { -0.5257938,0.2618969,0.80929047 }, 0.19710898 ,{ 1,1,1,1 } },Vertex{ { -1.0859375,0.2734375,-0.390625 }, 0.239243, { -0.34869474,0.28489572,0.8928866 }, 0.19710898 ,{ 1,1,1,1 } },Vertex{ { -1.0859375,0.2734375,-0.390625 }, 0.239243, { -0.298,0.5802,0.758 }, 0.19710898 ,{ 1,1,1,1 } },Vertex{ { -1.0859375,0.2734375,-0.390625 }, 0.239243, { -0.1709983,0.027399728,0.9848903 }, 0.19710898 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4375,-0.484375 }, 0.677256, { -0.5383693,-0.009799441,-0.84265196 }, 0.32956398 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4375,-0.484375 }, 0.677256, { -0.44989443,0.88378906,-0.1284984 }, 0.32956398 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4375,-0.484375 }, 0.677256, { -0.23551221,0.93674856,-0.25891343 }, 0.32956398 ,{ 1,1,1,1 } },Vertex{ { 1.0234375,0.4375,-0.484375 }, 0.677256, { -0.19099891,-0.024099862,-0.9812944 }, 0.32956398 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4375,-0.484375 }, 0.083564, { 0.19099891,-0.024099862,-0.9812944 }, 0.33796197 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4375,-0.484375 }, 0.083564, { 0.23551221,0.93674856,-0.25891343 }, 0.33796197 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4375,-0.484375 }, 0.083564, { 0.44989443,0.88378906,-0.1284984 }, 0.33796197 ,{ 1,1,1,1 } },Vertex{ { -1.0234375,0.4375,-0.484375 }, 0.083564, { 0.5383693,-0.009799441,-0.84265196 }, 0.33796197 ,{ 1,1,1,1 } },Vertex{ { 1.25,0.46875,-0.546875 }, 0.660647, { -0.23551221,0.93674856,-0.25891343 }, 0.258833 ,{ 1,1,1,1 } },Vertex{ { 1.25,0.46875,-0.546875 }, 0.660647, { -0.19099891,-0.024099862,-0.9812944 }, 0.258833 ,{ 1,1,1,1 } },Vertex{ { 1.25,0.46875,-0.546875 }, 0.660647, { 0.40460253,0.026600165,-0.9141057 }, 0.258833 ,{ 1,1,1,1 } },Vertex{ { 1.25,0.46875,-0.546875 }, 0.660647, { 0.8392786,0.5423862,-0.037799034 }, 0.258833 ,{ 1,1,1,1 } },Vertex{ { -1.25,0.46875,-0.546875 }, 0.097038, { -0.8392786,0.5423862,-0.037799034 }, 0.26794797 ,{ 1,1,1,1 } },Vertex{ { -1.25,0.46875,-0.546875 }, 0.097038, { -0.40460253,0.026600165,-0.9141057 }, 0.26794797 ,{ 1,1,1,1 } },Vertex{ { -1.25,0.46875,-0.546875 }, 0.097038, { 0.19099891,-0.024099862,-0.9812944 }, 0.26794797 ,{ 1,1,1,1 } },Vertex{ { -1.25,0.46875,-0.546875 }, 0.097038, { 0.23551221,0.93674856,-0.25891343 }, 0.26794797 ,{ 1,1,1,1 } },Vertex{ { 1.3671875,0.296875,-0.5 }, 0.616701, { 0.40460253,0.026600165,-0.9141057 }, 0.240035 ,{ 1,1,1,1 } },Vertex{ { 1.3671875,0.296875,-0.5 }, 0.616701, { 0.8392786,0.5423862,-0.037799034 }, 0.240035 ,{ 1,1,1,1 } },Vertex{ { 1.3671875,0.296875,-0.5 }, 0.616701, { 0.9285105,-0.24970283,0.2748031 }, 0.240035 ,{ 1,1,1,1 } },Vertex{ { -1.3671875,0.296875,-0.5 }, 0.140379, { -0.9285105,-0.24970283,0.2748031 }, 0.24762303 ,{ 1,1,1,1 } },Vertex{ { -1.3671875,0.296875,-0.5 }, 0.140379, { -0.8392786,0.5423862,-0.037799034 }, 0.24762303 ,{ 1,1,1,1 } },Vertex{ { -1.3671875,0.296875,-0.5 }, 0.140379, { -0.40460253,0.026600165,-0.9141057 }, 0.24762303 ,{ 1,1,1,1 } },Vertex{ { 1.3125,0.0546875,-0.53125 }, 0.581052, { -0.19099891,-0.024099862,-0.9812944 }, 0.273067 ,{ 1,1,1,1 } },Vertex{ { 1.3125,0.0546875,-0.53125 }, 0.581052, { 0.40460253,0.026600165,-0.9141057 }, 0.273067 ,{ 1,1,1,1 } },Vertex{ { 1.3125,0.0546875,-0.53125 }, 0.581052, { 0.50057477,-0.8656564,0.007999597 }, 0.273067 ,{ 1,1,1,1 } },Vertex{ { 1.3125,0.0546875,-0.53125 }, 0.581052, { 0.9285105,-0.24970283,0.2748031 }, 0.273067 ,{ 1,1,1,1 } },Vertex{ { -1.3125,0.0546875,-0.53125 }, 0.177176, { -0.9285105,-0.24970283,0.2748031 }, 0.27957398 ,{ 1,1,1,1 } },Vertex{ { -1.3125,0.0546875,-0.53125 }, 0.177176, { -0.50057477,-0.8656564,0.007999597 }, 0.27957398 ,{ 1,1,1,1 } },Vertex{ { -1.3125,0.0546875,-0.53125 }, 0.177176, { -0.40460253,0.026600165,-0.9141057 }, 0.27957398 ,{ 1,1,1,1 } },Vertex{ { -1.3125,0.0546875,-0.53125 }, 0.177176, { 0.19099891,-0.024099862,-0.9812944 }, 0.27957398 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.0859375,-0.4921875 }, 0.543385, { -0.5383693,-0.009799441,-0.84265196 }, 0.31646198 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.0859375,-0.4921875 }, 0.543385, { -0.19099891,-0.024099862,-0.9812944 }, 0.31646198 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.0859375,-0.4921875 }, 0.543385, { 0.093000606,-0.9924064,-0.08050052 }, 0.31646198 ,{ 1,1,1,1 } },Vertex{ { 1.0390625,-0.0859375,-0.4921875 }, 0.543385, { 0.50057477,-0.8656564,0.007999597 }, 0.31646198 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.0859375,-0.4921875 }, 0.216123, { -0.50057477,-0.8656564,0.007999597 }, 0.32187998 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.0859375,-0.4921875 }, 0.216123, { -0.093000606,-0.9924064,-0.08050052 }, 0.32187998 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.0859375,-0.4921875 }, 0.216123, { 0.19099891,-0.024099862,-0.9812944 }, 0.32187998 ,{ 1,1,1,1 } },Vertex{ { -1.0390625,-0.0859375,-0.4921875 }, 0.216123, { 0.5383693,-0.009799441,-0.84265196 }, 0.32187998 ,{ 1,1,1,1 } },Vertex{ { 0.7890625,-0.125,-0.328125 }, 0.484068, { -0.5383693,-0.009799441,-0.84265196 }, 0.371224 ,{ 1,1,1,1 } },Vertex{ { 0.7890625,-0.125,-0.328125 }, 0.484068, { -0.24739374,-0.9230767,-0.29449254 }, 0.371224 ,{ 1,1,1,1 } },Vertex{ { 0.7890625,-0.125,-0.328125 }, 0.484068, { 0.093000606,-0.9924064,-0.08050052 }, 0.371224 ,{ 1,1,1,1 } },Vertex{ { 0.7890625,-0.125,-0.328125 }, 0.484068, { 0.5427693,-0.20628835,-0.81415397 }, 0.371224 ,{ 1,1,1,1 } },Vertex{ { -0.7890625,-0.125,-0.328125 }, 0.276936, { -0.5427693,-0.20628835,-0.81415397 }, 0.374933 ,{ 1,1,1,1 } },Vertex{ { -0.7890625,-0.125,-0.328125 }, 0.276936, { -0.093000606,-0.9924064,-0.08050052 }, 0.374933 ,{ 1,1,1,1 } },Vertex{ { -0.7890625,-0.125,-0.328125 }, 0.276936, { 0.24739374,-0.9230767,-0.29449254 }, 0.374933 ,{ 1,1,1,1 } },Vertex{ { -0.7890625,-0.125,-0.328125 }, 0.276936, { 0.5383693,-0.009799441,-0.84265196 }, 0.374933 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3828125,-0.3828125 }, 0.834705, { -0.78189635,0.62309706,0.019699909 }, 0.793041 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3828125,-0.3828125 }, 0.671403, { -0.5383693,-0.009799441,-0.84265196 }, 0.40734398 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3828125,-0.3828125 }, 0.671403, { -0.44989443,0.88378906,-0.1284984 }, 0.40734398 ,{ 1,1,1,1 } },Vertex{ { 0.859375,0.3828125,-0.3828125 }, 0.671403, { 0.5427693,-0.20628835,-0.81415397 }, 0.40734398 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3828125,-0.3828125 }, 0.09282, { -0.5427693,-0.20628835,-0.81415397 }, 0.410138 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3828125,-0.3828125 }, 0.09282, { 0.44989443,0.88378906,-0.1284984 }, 0.410138 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3828125,-0.3828125 }, 0.09282, { 0.5383693,-0.009799441,-0.84265196 }, 0.410138 ,{ 1,1,1,1 } },Vertex{ { -0.859375,0.3828125,-0.3828125 }, 0.09282, { 0.78189635,0.62309706,0.019699909 }, 0.410138 ,{ 1,1,1,1 } } }; 
-uint32_t Suzanne_idx[] = { 152,2,10,152,10,144,13,5,159,13,159,151,147,11,17,147,17,141,18,12,148,18,148,142,9,27,21,9,21,16,22,28,14,22,14,19,1,35,26,1,26,8,29,36,6,29,6,15,33,43,51,33,51,25,52,44,38,52,38,30,24,50,57,24,57,20,58,53,31,58,31,23,48,64,60,48,60,56,63,71,55,63,55,59,41,75,67,41,67,49,68,76,46,68,46,54,74,81,89,74,89,66,94,86,77,94,77,69,65,88,96,65,96,61,99,95,70,99,70,62,90,104,100,90,100,97,103,111,93,103,93,98,83,113,105,83,105,91,110,118,84,110,84,92,115,121,128,115,128,106,135,126,116,135,116,109,107,129,136,107,136,101,139,134,108,139,108,102,131,146,140,131,140,137,143,149,132,143,132,138,122,153,145,122,145,130,150,158,125,150,125,133,155,123,171,155,171,163,172,124,156,172,156,164,120,114,178,120,178,168,181,117,127,181,127,175,112,82,185,112,185,176,190,85,119,190,119,183,80,72,192,80,192,184,199,79,87,199,87,191,73,40,200,73,200,193,207,47,78,207,78,198,42,32,224,42,224,201,231,39,45,231,45,206,34,0,232,34,232,226,239,7,37,239,37,229,3,154,162,3,162,235,165,157,4,165,4,236,214,234,160,167,237,217,227,233,213,218,238,228,210,203,225,230,204,221,209,195,202,205,196,222,208,186,194,197,189,223,211,177,187,188,182,220,212,169,179,180,174,219,215,161,170,173,166,216,333,679,689,333,689,342,686,684,336,686,336,339,324,671,681,324,681,334,682,676,329,682,329,335,315,664,673,315,673,325,674,667,322,674,322,328,307,656,665,307,665,316,666,659,314,666,314,321,299,648,657,299,657,308,658,651,306,658,306,313,292,344,562,292,562,637,569,349,297,569,297,642,346,352,572,346,572,565,575,357,347,575,347,566,354,361,581,354,581,573,582,364,355,582,355,574,360,369,589,360,589,580,590,372,365,590,365,583,368,378,597,368,597,588,598,379,373,598,373,591,377,384,604,377,604,596,607,389,380,607,380,599,386,394,613,386,613,605,614,395,387,614,387,606,392,402,619,392,619,611,624,403,397,624,397,616,400,408,626,400,626,618,633,413,405,633,405,625,409,240,244,409,244,627,249,243,412,249,412,632,418,490,621,418,621,629,622,491,419,622,419,630,489,702,612,489,612,620,615,705,492,615,492,623,480,603,610,480,610,700,617,608,485,617,485,707,471,594,602,471,602,479,609,601,478,609,478,486,463,586,595,463,595,472,600,593,470,600,470,477,455,578,587,455,587,464,592,585,462,592,462,469,448,571,579,448,579,456,584,576,453,584,453,461,440,563,570,440,570,447,577,568,445,577,445,454,434,638,564,434,564,441,567,641,435,567,435,444,433,710,691,433,691,636,694,713,436,694,436,643,417,628,248,417,248,426,245,631,420,245,420,427,425,247,699,425,699,719,696,246,428,696,428,720,693,711,718,693,718,698,721,712,692,721,692,697,518,526,688,518,688,678,687,525,521,687,521,685,510,519,680,510,680,670,683,520,513,683,513,677,501,511,672,501,672,662,675,512,504,675,504,669,647,735,726,647,726,654,729,736,652,729,652,661,502,663,655,502,655,727,660,668,503,660,503,728,552,745,740,552,740,732,743,746,561,743,561,739,724,733,741,724,741,250,742,738,731,742,731,252,496,499,725,496,725,251,730,506,496,730,496,251,546,758,751,546,751,556,752,761,549,752,549,557,539,767,759,539,759,547,760,768,540,760,540,548,533,774,764,533,764,538,771,777,532,771,532,541,528,257,772,528,772,530,779,260,529,779,529,535,747,554,750,747,750,256,753,559,744,753,744,253,255,748,807,255,807,815,810,755,254,810,254,812,258,780,786,258,786,773,791,785,259,791,259,778,775,788,793,775,793,765,796,789,776,796,776,770,766,794,801,766,801,757,802,795,769,802,769,762,756,800,808,756,808,749,809,803,763,809,763,754,784,799,792,784,792,787,797,804,781,797,781,790,783,814,806,783,806,798,811,813,782,811,782,805,531,536,634,531,634,690,645,543,534,645,534,695,537,544,635,544,824,635,831,551,644,551,542,644,545,555,833,545,833,825,838,558,550,838,550,830,553,734,646,553,646,832,653,737,560,653,560,839,300,816,834,300,834,649,837,823,305,837,305,650,817,840,826,817,826,835,829,847,822,829,822,836,293,639,827,293,827,842,828,640,296,828,296,845,500,497,263,500,263,870,262,495,505,262,505,873,509,498,869,509,869,863,874,507,514,874,514,864,516,508,862,516,862,853,865,515,523,865,523,858,524,517,855,524,855,849,856,522,527,856,527,850,848,854,895,848,895,902,900,857,851,900,851,905,852,861,889,852,889,894,892,866,859,892,859,901,860,868,880,860,880,888,887,875,867,887,867,893,871,264,879,871,879,883,876,261,872,876,872,884,878,904,896,878,896,881,899,903,877,899,877,886,882,897,890,891,898,885,716,709,915,716,915,906,920,714,723,920,723,913,423,717,907,423,907,994,912,722,430,912,430,1001,415,424,995,415,995,1002,1000,429,422,1000,422,1009,708,431,986,708,986,914,993,438,715,993,715,921,432,439,978,432,978,987,985,446,437,985,437,992,442,449,972,442,972,981,975,452,443,975,443,982,450,458,965,450,965,973,966,459,451,966,451,974,457,465,956,457,956,964,959,468,460,959,460,967,466,474,949,466,949,957,950,475,467,950,467,958,473,482,941,473,941,948,942,483,476,942,476,951,481,703,924,481,924,940,927,704,484,927,484,943,701,488,931,701,931,923,936,493,706,936,706,928,487,416,1003,487,1003,930,1008,421,494,1008,494,937,933,1004,1010,933,1010,1047,1013,1007,934,1013,934,1048,925,932,1046,925,1046,1051,1049,935,926,1049,926,1052,938,922,1050,938,1050,1042,1053,929,945,1053,945,1045,947,939,1043,947,1043,1039,1044,944,952,1044,952,1040,955,946,1038,955,1038,1035,1041,953,960,1041,960,1036,962,954,1034,962,1034,1030,1037,961,969,1037,969,1033,970,963,1031,970,1031,1026,1032,968,977,1032,977,1029,979,971,1027,979,1027,1022,1028,976,984,1028,984,1025,988,980,1023,988,1023,1018,1024,983,991,1024,991,1021,916,989,1019,916,1019,1054,1020,990,919,1020,919,1057,1005,996,1014,1005,1014,1011,1017,999,1006,1017,1006,1012,997,909,1059,997,1059,1015,1060,910,998,1060,998,1016,908,917,1055,908,1055,1058,1056,918,911,1056,911,1061,241,410,1063,241,1063,265,1070,411,242,1070,242,268,407,399,1072,407,1072,1062,1077,406,414,1077,414,1071,401,391,1078,401,1078,1073,1083,398,404,1083,404,1076,393,385,1088,393,1088,1080,1089,388,396,1089,396,1081,383,376,1096,383,1096,1087,1099,381,390,1099,390,1090,375,367,1102,375,1102,1094,1109,374,382,1109,382,1101,370,362,1112,370,1112,1104,1115,363,371,1115,371,1107,359,353,1120,359,1120,1110,1123,356,366,1123,366,1117,351,345,1128,351,1128,1118,1133,348,358,1133,358,1125,1162,1166,1248,1162,1248,1287,1255,1165,1161,1255,1161,1292,1159,1163,1288,1159,1288,1281,1291,1160,1156,1291,1156,1282,1155,1158,1279,1155,1279,1296,1284,1157,1152,1284,1152,1299,331,341,1154,331,1154,1295,1153,340,338,1153,338,1300,323,332,1297,323,1297,1273,1298,337,330,1298,330,1276,318,326,1274,318,1274,1259,1275,327,319,1275,319,1260,310,317,1258,310,1258,1267,1261,320,311,1261,311,1268,1257,1280,1286,1257,1286,1264,1293,1283,1262,1293,1262,1271,1256,1272,1294,1256,1294,1278,1301,1277,1263,1301,1263,1285,1240,1265,1289,1240,1289,1250,1290,1270,1247,1290,1247,1253,302,309,1266,302,1266,1242,1269,312,303,1269,303,1245,819,1305,1314,819,1314,841,1317,1308,820,1317,820,846,301,1241,1304,301,1304,818,1309,1246,304,1309,304,821,294,843,1315,294,1315,1322,1316,844,295,1316,295,1323,291,1320,1126,291,1126,343,1135,1325,298,1135,298,350,286,1233,1345,286,1345,1147,1350,1238,283,1350,283,1144,1146,1344,1337,1146,1337,290,1342,1351,1145,1342,1145,287,289,1336,1326,289,1326,1150,1335,1343,288,1335,288,1149,1151,1327,1249,1151,1249,1167,1254,1334,1148,1254,1148,1164,1243,1251,1330,1243,1330,1306,1331,1252,1244,1331,1244,1307,1111,1121,1207,1111,1207,1168,1210,1122,1116,1210,1116,1175,281,1196,1232,281,1232,285,1239,1203,280,1239,280,284,1138,1368,1360,1138,1360,1142,1367,1375,1137,1367,1137,1141,1143,1361,1352,1143,1352,277,1359,1366,1140,1359,1140,276,278,1353,1197,278,1197,282,1202,1358,275,1202,275,279,1097,1103,1385,1097,1385,1394,1390,1108,1098,1390,1098,1397,1392,1384,1408,1392,1408,1400,1415,1391,1399,1415,1399,1407,1401,1409,1416,1401,1416,1424,1423,1414,1406,1423,1406,1431,1426,1417,1441,1426,1441,1435,1444,1422,1429,1444,1429,1436,1189,1449,1434,1189,1434,1440,1437,1450,1192,1437,1192,1445,1198,1354,1432,1198,1432,1446,1439,1357,1201,1439,1201,1453,1355,1362,1425,1355,1425,1433,1430,1365,1356,1430,1356,1438,1363,1370,1402,1363,1402,1427,1405,1373,1364,1405,1364,1428,1371,1379,1395,1371,1395,1403,1396,1380,1372,1396,1372,1404,1086,1095,1393,1086,1393,1378,1398,1100,1091,1398,1091,1381,274,1377,1369,274,1369,1139,1374,1382,269,1374,269,1136,1064,1074,1079,1064,1079,1084,1082,1075,1069,1082,1069,1093,1066,1085,1376,1066,1376,272,1383,1092,1067,1383,1067,271,266,1065,270,273,1068,267,1105,1113,1171,1105,1171,1387,1172,1114,1106,1172,1106,1388,1170,1178,1410,1170,1410,1386,1413,1183,1173,1413,1173,1389,1179,1466,1418,1179,1418,1411,1421,1471,1182,1421,1182,1412,1190,1442,1419,1190,1419,1468,1420,1443,1191,1420,1191,1469,1328,1338,1486,1328,1486,1477,1489,1341,1333,1489,1333,1480,1204,1474,1485,1204,1485,1217,1490,1483,1213,1490,1213,1220,1119,1129,1475,1119,1475,1205,1482,1132,1124,1482,1124,1212,1130,1313,1302,1130,1302,1476,1311,1318,1131,1311,1131,1481,1303,1329,1478,1479,1332,1310,1127,1321,1312,1319,1324,1134,1188,1227,1457,1188,1457,1448,1460,1228,1193,1460,1193,1451,1199,1447,1456,1199,1456,1235,1461,1452,1200,1461,1200,1236,1216,1484,1454,1216,1454,1225,1463,1491,1221,1463,1221,1230,1339,1347,1458,1339,1458,1487,1459,1348,1340,1459,1340,1488,1234,1455,1346,1349,1462,1237,1542,1495,1597,1542,1597,1548,1602,1496,1545,1602,1545,1555,1543,1550,1559,1543,1559,1534,1560,1553,1544,1560,1544,1537,1533,1557,1567,1533,1567,1525,1568,1562,1538,1568,1538,1530,1524,1566,1574,1524,1574,1516,1577,1569,1531,1577,1531,1523,1517,1575,1582,1517,1582,1509,1585,1576,1522,1585,1522,1514,1511,1583,1591,1511,1591,1503,1592,1584,1512,1592,1512,1504,1581,1623,1615,1581,1615,1590,1616,1624,1586,1616,1586,1593,1573,1631,1621,1573,1621,1580,1626,1632,1578,1626,1578,1587,1564,1638,1629,1564,1629,1572,1634,1641,1571,1634,1571,1579,1556,1645,1639,1556,1639,1565,1640,1650,1563,1640,1563,1570,1549,1653,1647,1549,1647,1558,1648,1658,1554,1648,1554,1561,1551,1599,1606,1551,1606,1655,1609,1600,1552,1609,1552,1656,1206,1218,1717,1206,1717,1706,1720,1219,1211,1720,1211,1713,1215,1501,1588,1215,1588,1714,1595,1506,1222,1595,1222,1723,1169,1208,1707,1169,1707,1176,1712,1209,1174,1712,1174,1185,1465,1660,1596,1465,1596,1494,1603,1667,1472,1603,1472,1497,1589,1614,1699,1589,1699,1715,1704,1617,1594,1704,1594,1722,1691,1725,1716,1691,1716,1700,1721,1732,1696,1721,1696,1703,1677,1724,1690,1677,1690,1685,1697,1733,1682,1697,1682,1688,1671,1735,1726,1671,1726,1679,1731,1740,1672,1731,1672,1680,1661,1734,1668,1661,1668,1742,1675,1741,1666,1675,1666,1749,1598,1662,1743,1598,1743,1604,1748,1665,1601,1748,1601,1611,1180,1737,1663,1180,1663,1467,1664,1738,1181,1664,1181,1470,1177,1708,1727,1177,1727,1736,1730,1711,1184,1730,1184,1739,1709,1718,1728,1729,1719,1710,1607,1744,1752,1607,1752,1845,1755,1747,1608,1755,1608,1846,1745,1670,1789,1745,1789,1753,1790,1673,1746,1790,1746,1754,1669,1678,1782,1669,1782,1788,1783,1681,1674,1783,1674,1791,1676,1684,1774,1676,1774,1781,1777,1689,1683,1777,1683,1784,1686,1693,1767,1686,1767,1775,1768,1694,1687,1768,1687,1776,1692,1701,1760,1692,1760,1766,1761,1702,1695,1761,1695,1769,1698,1613,1836,1698,1836,1759,1839,1618,1705,1839,1705,1762,1654,1605,1844,1654,1844,1797,1847,1610,1657,1847,1657,1798,1646,1652,1794,1646,1794,1803,1801,1659,1649,1801,1649,1808,1637,1644,1802,1637,1802,1811,1809,1651,1642,1809,1642,1816,1628,1636,1810,1628,1810,1818,1817,1643,1635,1817,1635,1825,1620,1630,1819,1620,1819,1826,1824,1633,1627,1824,1627,1833,1612,1622,1827,1612,1827,1835,1832,1625,1619,1832,1619,1840,1773,1765,1859,1773,1859,1851,1864,1770,1778,1864,1778,1856,1853,1860,1867,1853,1867,1876,1872,1863,1854,1872,1854,1879,1875,1866,1891,1875,1891,1883,1896,1873,1880,1896,1880,1888,1882,1890,1898,1882,1898,1904,1903,1897,1889,1903,1889,1911,1796,1842,1884,1796,1884,1906,1887,1849,1799,1887,1799,1909,1751,1877,1885,1751,1885,1843,1886,1878,1756,1886,1756,1848,1750,1787,1852,1750,1852,1874,1855,1792,1757,1855,1757,1881,1772,1850,1786,1772,1786,1780,1793,1857,1779,1793,1779,1785,1758,1834,1764,1834,1858,1764,1865,1841,1771,1841,1763,1771,1829,1869,1861,1829,1861,1837,1862,1870,1830,1862,1830,1838,1820,1892,1868,1820,1868,1828,1871,1895,1823,1871,1823,1831,1812,1899,1893,1812,1893,1821,1894,1902,1815,1894,1815,1822,1805,1907,1900,1805,1900,1813,1901,1908,1806,1901,1806,1814,1795,1905,1804,1807,1910,1800,1508,1502,1952,1508,1952,1944,1955,1505,1515,1955,1515,1947,1518,1510,1945,1518,1945,1936,1946,1513,1521,1946,1521,1939,1527,1519,1937,1527,1937,1930,1938,1520,1528,1938,1528,1931,1535,1526,1929,1535,1929,1923,1932,1529,1536,1932,1536,1924,1541,1532,1920,1541,1920,1914,1927,1539,1546,1927,1546,1917,1493,1540,1913,1493,1913,1960,1918,1547,1498,1918,1498,1963,1912,1942,1950,1912,1950,1959,1957,1949,1919,1957,1919,1964,1915,1921,1934,1915,1934,1943,1941,1926,1916,1941,1916,1948,1922,1928,1935,1940,1933,1925,1186,1464,1492,1186,1492,1958,1499,1473,1195,1499,1195,1965,1187,1961,1953,1187,1953,1226,1954,1962,1194,1954,1194,1229,1214,1224,1951,1214,1951,1500,1956,1231,1223,1956,1223,1507 }; 
- 
-}
\ No newline at end of file
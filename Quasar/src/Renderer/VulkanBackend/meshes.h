@@ -1,18 +0,0 @@
-#include "vk_types.h"
-
-namespace Quasar::Renderer {
-
-extern uint32_t Cube_vtx_count;
-extern Vertex Cube_vtx[];
-extern uint32_t Cube_idx_count;
-extern uint32_t Cube_idx[];
-extern uint32_t Sphere_vtx_count;
-extern Vertex Sphere_vtx[];
-extern uint32_t Sphere_idx_count;
-extern uint32_t Sphere_idx[];
-extern uint32_t Suzanne_vtx_count;
-extern Vertex Suzanne_vtx[];
-extern uint32_t Suzanne_idx_count;
-extern uint32_t Suzanne_idx[];
-
-}
\ No newline at end of file
@@ -0,0 +1,495 @@
+#include "obj_loader.h"
+
+#include <Core/MappedFile.h>
+#include <Core/ThreadPool.h>
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+namespace {
+
+constexpr uint32_t NoIndex = ~0u;
+
+// negative (relative) indices are resolved once every chunk knows where its
+// vertices start. Until then they are stored as RelativeBit | (local index + RelativeBias),
+// the local index being negative when the face reaches back into an earlier chunk
+constexpr uint32_t RelativeBit = 1u << 31;
+constexpr int64_t RelativeBias = int64_t(1) << 30;
+
+// below this a file is parsed as one chunk, splitting costs more than it saves
+constexpr size_t MinChunkSize = 1 << 20;
+
+struct Corner {
+    uint32_t position;
+    uint32_t uv;
+    uint32_t normal;
+
+    bool operator==(const Corner& other) const = default;
+};
+
+struct CornerHash {
+    size_t operator()(const Corner& c) const
+    {
+        return size_t((uint64_t(c.position) | uint64_t(c.uv) << 32) ^ (uint64_t(c.normal) * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+struct MaterialSwitch {
+    // corner the material starts at, local to the chunk until merged
+    uint64_t firstCorner;
+    std::string name;
+};
+
+struct ObjChunk {
+    const char* begin;
+    const char* end;
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> colors;
+    std::vector<glm::vec2> uvs;
+    std::vector<glm::vec3> normals;
+    // three per triangle
+    std::vector<Corner> corners;
+    std::vector<MaterialSwitch> materials;
+
+    // where the chunk's attributes start in the whole file
+    uint64_t positionBase = 0;
+    uint64_t uvBase = 0;
+    uint64_t normalBase = 0;
+    uint64_t cornerBase = 0;
+
+    bool failed = false;
+};
+
+const double Pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+bool is_digit(char c) { return c >= '0' && c <= '9'; }
+bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+const char* skip_space(const char* p, const char* end)
+{
+    while (p < end && is_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+// decimal float without locale or strtod. Keeps the first 19 significant digits,
+// which is far more than a float holds, and scales once by a power of ten
+const char* parse_float(const char* p, const char* end, float& out)
+{
+    p = skip_space(p, end);
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+
+    for (; p < end && is_digit(*p); p++) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + uint64_t(*p - '0');
+            digits += mantissa != 0;
+        } else {
+            exponent++;
+        }
+    }
+
+    if (p < end && *p == '.') {
+        for (p++; p < end && is_digit(*p); p++) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+                digits += mantissa != 0;
+                exponent--;
+            }
+        }
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negativeExponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negativeExponent = *p == '-';
+            p++;
+        }
+        int e = 0;
+        for (; p < end && is_digit(*p); p++) {
+            e = std::min(e * 10 + (*p - '0'), 1000);
+        }
+        exponent += negativeExponent ? -e : e;
+    }
+
+    double value = double(mantissa);
+    if (exponent < 0) {
+        value = -exponent <= 22 ? value / Pow10[-exponent] : value * std::pow(10.0, exponent);
+    } else if (exponent > 0) {
+        value = exponent <= 22 ? value * Pow10[exponent] : value * std::pow(10.0, exponent);
+    }
+
+    out = float(negative ? -value : value);
+    return p;
+}
+
+const char* parse_int(const char* p, const char* end, int64_t& out)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    int64_t value = 0;
+    for (; p < end && is_digit(*p); p++) {
+        value = value * 10 + (*p - '0');
+    }
+
+    out = negative ? -value : value;
+    return p;
+}
+
+// 1-based absolute or negative relative index to the stored form, see RelativeBit
+uint32_t encode_index(int64_t value, size_t localCount, bool& failed)
+{
+    if (value > 0 && value <= int64_t(RelativeBit)) {
+        return uint32_t(value - 1);
+    }
+    if (value < 0) {
+        int64_t local = int64_t(localCount) + value + RelativeBias;
+        if (local >= 0 && local < int64_t(RelativeBit) - 1) {
+            return RelativeBit | uint32_t(local);
+        }
+    }
+    failed = true;
+    return NoIndex;
+}
+
+uint32_t resolve_index(uint32_t stored, uint64_t base, uint64_t count, bool& failed)
+{
+    if (stored == NoIndex) {
+        return NoIndex;
+    }
+
+    int64_t index = (stored & RelativeBit)
+        ? int64_t(base) + int64_t(stored & ~RelativeBit) - RelativeBias
+        : int64_t(stored);
+
+    if (index < 0 || uint64_t(index) >= count) {
+        failed = true;
+        return NoIndex;
+    }
+    return uint32_t(index);
+}
+
+void parse_face(ObjChunk& chunk, const char* p, const char* end, std::vector<Corner>& polygon)
+{
+    polygon.clear();
+
+    while (true) {
+        p = skip_space(p, end);
+        if (p >= end || !(is_digit(*p) || *p == '-' || *p == '+')) {
+            break;
+        }
+
+        Corner corner { NoIndex, NoIndex, NoIndex };
+        int64_t value;
+
+        p = parse_int(p, end, value);
+        corner.position = encode_index(value, chunk.positions.size(), chunk.failed);
+
+        if (p < end && *p == '/') {
+            p++;
+            if (p < end && *p != '/') {
+                p = parse_int(p, end, value);
+                corner.uv = encode_index(value, chunk.uvs.size(), chunk.failed);
+            }
+            if (p < end && *p == '/') {
+                p = parse_int(p + 1, end, value);
+                corner.normal = encode_index(value, chunk.normals.size(), chunk.failed);
+            }
+        }
+
+        polygon.push_back(corner);
+    }
+
+    // fan from the first corner
+    for (size_t i = 2; i < polygon.size(); i++) {
+        chunk.corners.push_back(polygon[0]);
+        chunk.corners.push_back(polygon[i - 1]);
+        chunk.corners.push_back(polygon[i]);
+    }
+}
+
+void parse_chunk(ObjChunk& chunk)
+{
+    std::vector<Corner> polygon;
+
+    const char* p = chunk.begin;
+    while (p < chunk.end) {
+        const char* lineEnd = static_cast<const char*>(memchr(p, '\n', size_t(chunk.end - p)));
+        if (!lineEnd) {
+            lineEnd = chunk.end;
+        }
+
+        const char* line = skip_space(p, lineEnd);
+        size_t length = size_t(lineEnd - line);
+
+        if (length >= 2 && line[0] == 'v' && is_space(line[1])) {
+            glm::vec3 position;
+            const char* q = parse_float(line + 2, lineEnd, position.x);
+            q = parse_float(q, lineEnd, position.y);
+            q = parse_float(q, lineEnd, position.z);
+            chunk.positions.push_back(position);
+
+            // vertex colors, a common extension
+            glm::vec3 color { 1.f };
+            q = skip_space(q, lineEnd);
+            if (q < lineEnd) {
+                q = parse_float(q, lineEnd, color.r);
+                q = parse_float(q, lineEnd, color.g);
+                parse_float(q, lineEnd, color.b);
+            }
+            chunk.colors.push_back(color);
+        } else if (length >= 3 && line[0] == 'v' && line[1] == 't' && is_space(line[2])) {
+            glm::vec2 uv;
+            const char* q = parse_float(line + 3, lineEnd, uv.x);
+            parse_float(q, lineEnd, uv.y);
+            uv.y = 1.f - uv.y;
+            chunk.uvs.push_back(uv);
+        } else if (length >= 3 && line[0] == 'v' && line[1] == 'n' && is_space(line[2])) {
+            glm::vec3 normal;
+            const char* q = parse_float(line + 3, lineEnd, normal.x);
+            q = parse_float(q, lineEnd, normal.y);
+            parse_float(q, lineEnd, normal.z);
+            chunk.normals.push_back(normal);
+        } else if (length >= 2 && line[0] == 'f' && is_space(line[1])) {
+            parse_face(chunk, line + 2, lineEnd, polygon);
+        } else if (length >= 7 && memcmp(line, "usemtl", 6) == 0 && is_space(line[6])) {
+            const char* name = skip_space(line + 7, lineEnd);
+            const char* nameEnd = lineEnd;
+            while (nameEnd > name && is_space(nameEnd[-1])) {
+                nameEnd--;
+            }
+            chunk.materials.push_back({ chunk.corners.size(), std::string(name, nameEnd) });
+        }
+
+        p = lineEnd + 1;
+    }
+}
+
+void compute_missing_normals(ObjMesh& mesh, const std::vector<uint8_t>& needsNormal)
+{
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        uint32_t a = mesh.indices[i], b = mesh.indices[i + 1], c = mesh.indices[i + 2];
+        if (!(needsNormal[a] | needsNormal[b] | needsNormal[c])) {
+            continue;
+        }
+
+        // not normalized, so bigger faces weigh more
+        glm::vec3 n = glm::cross(mesh.vertices[b].position - mesh.vertices[a].position,
+            mesh.vertices[c].position - mesh.vertices[a].position);
+        for (uint32_t v : { a, b, c }) {
+            if (needsNormal[v]) {
+                mesh.vertices[v].normal += n;
+            }
+        }
+    }
+
+    for (size_t v = 0; v < mesh.vertices.size(); v++) {
+        if (needsNormal[v]) {
+            float length = glm::length(mesh.vertices[v].normal);
+            mesh.vertices[v].normal = length > 0.f ? mesh.vertices[v].normal / length : glm::vec3(0.f, 1.f, 0.f);
+        }
+    }
+}
+
+Bounds compute_bounds(const std::vector<Vertex>& vertices)
+{
+    Bounds bounds {};
+    if (vertices.empty()) {
+        return bounds;
+    }
+
+    glm::vec3 minpos = vertices[0].position;
+    glm::vec3 maxpos = vertices[0].position;
+    for (const Vertex& v : vertices) {
+        minpos = glm::min(minpos, v.position);
+        maxpos = glm::max(maxpos, v.position);
+    }
+
+    bounds.origin = (maxpos + minpos) / 2.f;
+    bounds.extents = (maxpos - minpos) / 2.f;
+
+    float radiusSq = 0.f;
+    for (const Vertex& v : vertices) {
+        glm::vec3 d = v.position - bounds.origin;
+        radiusSq = std::max(radiusSq, glm::dot(d, d));
+    }
+    bounds.sphereRadius = std::sqrt(radiusSq);
+    return bounds;
+}
+
+}
+
+//> obj_loader
+std::optional<ObjMesh> load_obj(const std::string& path)
+{
+    // every chunk is parsed at once, so the whole file is wanted up front
+    MappedFile file;
+    if (!file.Open(path, MappedFile::Access::WillNeed)) {
+        return {};
+    }
+
+    const char* data = reinterpret_cast<const char*>(file.Data());
+    const char* dataEnd = data + file.Size();
+
+    ThreadPool& pool = QS_THREAD_POOL;
+
+    // a few chunks per thread, so an uneven chunk does not hold up the rest
+    size_t chunkCount = std::clamp<size_t>(file.Size() / MinChunkSize, 1, size_t(pool.GetThreadCount() + 1) * 4);
+
+    std::vector<ObjChunk> chunks(chunkCount);
+    const char* chunkBegin = data;
+    for (size_t i = 0; i < chunkCount; i++) {
+        const char* chunkEnd = i + 1 == chunkCount ? dataEnd : std::max(chunkBegin, data + file.Size() * (i + 1) / chunkCount);
+        // every chunk ends after a newline, so no line is split
+        const char* newline = static_cast<const char*>(memchr(chunkEnd, '\n', size_t(dataEnd - chunkEnd)));
+        chunkEnd = newline ? newline + 1 : dataEnd;
+
+        chunks[i].begin = chunkBegin;
+        chunks[i].end = chunkEnd;
+        chunkBegin = chunkEnd;
+    }
+
+    pool.ParallelFor(uint32_t(chunkCount), [&](uint32_t i) {
+        parse_chunk(chunks[i]);
+    });
+
+    // where every chunk's attributes land in the whole file
+    uint64_t positionCount = 0, uvCount = 0, normalCount = 0, cornerCount = 0;
+    for (ObjChunk& chunk : chunks) {
+        if (chunk.failed) {
+            QS_CORE_ERROR("%s has a face with an invalid index", path.c_str());
+            return {};
+        }
+
+        chunk.positionBase = positionCount;
+        chunk.uvBase = uvCount;
+        chunk.normalBase = normalCount;
+        chunk.cornerBase = cornerCount;
+        positionCount += chunk.positions.size();
+        uvCount += chunk.uvs.size();
+        normalCount += chunk.normals.size();
+        cornerCount += chunk.corners.size();
+    }
+
+    if (cornerCount >= NoIndex || positionCount >= RelativeBit) {
+        QS_CORE_ERROR("%s is too large to load", path.c_str());
+        return {};
+    }
+
+    std::vector<glm::vec3> positions(positionCount);
+    std::vector<glm::vec3> colors(positionCount);
+    std::vector<glm::vec2> uvs(uvCount);
+    std::vector<glm::vec3> normals(normalCount);
+    std::vector<Corner> corners(cornerCount);
+
+    // gather the attributes and turn the corners into indices of the whole file
+    pool.ParallelFor(uint32_t(chunkCount), [&](uint32_t i) {
+        ObjChunk& chunk = chunks[i];
+
+        std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + chunk.positionBase);
+        std::copy(chunk.colors.begin(), chunk.colors.end(), colors.begin() + chunk.positionBase);
+        std::copy(chunk.uvs.begin(), chunk.uvs.end(), uvs.begin() + chunk.uvBase);
+        std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + chunk.normalBase);
+
+        Corner* out = corners.data() + chunk.cornerBase;
+        for (const Corner& c : chunk.corners) {
+            out->position = resolve_index(c.position, chunk.positionBase, positionCount, chunk.failed);
+            out->uv = resolve_index(c.uv, chunk.uvBase, uvCount, chunk.failed);
+            out->normal = resolve_index(c.normal, chunk.normalBase, normalCount, chunk.failed);
+            // a face without a position index is invalid
+            chunk.failed |= out->position == NoIndex;
+            out++;
+        }
+
+        // parsing memory is not needed past here
+        chunk.positions = {};
+        chunk.colors = {};
+        chunk.uvs = {};
+        chunk.normals = {};
+        chunk.corners = {};
+    });
+
+    for (const ObjChunk& chunk : chunks) {
+        if (chunk.failed) {
+            QS_CORE_ERROR("%s has a face index out of range", path.c_str());
+            return {};
+        }
+    }
+
+    ObjMesh mesh;
+    mesh.indices.resize(cornerCount);
+    mesh.vertices.reserve(std::min<uint64_t>(cornerCount, positionCount * 2));
+
+    std::vector<uint8_t> needsNormal;
+    needsNormal.reserve(mesh.vertices.capacity());
+
+    // deduplicate corners into vertices
+    Hashmap<Corner, uint32_t, CornerHash> unique(mesh.vertices.capacity());
+    for (uint64_t i = 0; i < cornerCount; i++) {
+        const Corner& c = corners[i];
+
+        auto [index, inserted] = unique.Insert(c, uint32_t(mesh.vertices.size()));
+        if (inserted) {
+            Vertex v;
+            v.position = positions[c.position];
+            v.color = glm::vec4(colors[c.position], 1.f);
+            v.normal = c.normal != NoIndex ? normals[c.normal] : glm::vec3(0.f);
+            glm::vec2 uv = c.uv != NoIndex ? uvs[c.uv] : glm::vec2(0.f);
+            v.uv_x = uv.x;
+            v.uv_y = uv.y;
+            mesh.vertices.push_back(v);
+            needsNormal.push_back(c.normal == NoIndex);
+        }
+        mesh.indices[i] = *index;
+    }
+
+    if (std::find(needsNormal.begin(), needsNormal.end(), 1) != needsNormal.end()) {
+        compute_missing_normals(mesh, needsNormal);
+    }
+
+    // one submesh per run of the same material
+    std::string material;
+    uint64_t runStart = 0;
+    auto close_run = [&](uint64_t runEnd) {
+        if (runEnd > runStart) {
+            if (!mesh.submeshes.empty() && mesh.submeshes.back().material == material) {
+                mesh.submeshes.back().indexCount += uint32_t(runEnd - runStart);
+            } else {
+                mesh.submeshes.push_back({ uint32_t(runStart), uint32_t(runEnd - runStart), material });
+            }
+        }
+        runStart = runEnd;
+    };
+    for (const ObjChunk& chunk : chunks) {
+        for (const MaterialSwitch& s : chunk.materials) {
+            close_run(chunk.cornerBase + s.firstCorner);
+            material = s.name;
+        }
+    }
+    close_run(cornerCount);
+
+    mesh.bounds = compute_bounds(mesh.vertices);
+    return mesh;
+}
+//< obj_loader
+
+}
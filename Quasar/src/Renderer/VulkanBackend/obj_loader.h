@@ -0,0 +1,33 @@
+#pragma once
+
+#include "vk_types.h"
+
+namespace Quasar::Renderer {
+
+//> obj_loader
+struct ObjSubmesh {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    // name given to usemtl, empty for faces before the first usemtl
+    std::string material;
+};
+
+struct ObjMesh {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    // one per run of faces with the same material
+    std::vector<ObjSubmesh> submeshes;
+    Bounds bounds;
+};
+
+// Loads the triangles of a Wavefront OBJ file.
+//
+// The file is mapped and cut into line aligned chunks that the thread pool
+// parses in parallel. Corners that repeat a position/uv/normal triple share one
+// vertex. Polygons are fanned into triangles, v is flipped to the top-left uv
+// origin, and vertices without a normal get the area weighted normal of their faces.
+// Materials are only named, mtllib is not read.
+QS_API std::optional<ObjMesh> load_obj(const std::string& path);
+//< obj_loader
+
+}
@@ -0,0 +1,46 @@
+#include "render_scale.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> render_scale
+float RenderScaleController::update(float gpuMilliseconds)
+{
+    //smooth out single frame spikes
+    _averageMilliseconds = _averageMilliseconds == 0.0f ? gpuMilliseconds : _averageMilliseconds + (gpuMilliseconds - _averageMilliseconds) * 0.2f;
+
+    if (_settle > 0) {
+        _settle--;
+        return _scale;
+    }
+
+    //gpu cost follows the pixel count, which goes with the square of the scale
+    float newScale = _scale;
+    if (_averageMilliseconds > targetMilliseconds) {
+        newScale = _scale * std::sqrt(targetMilliseconds / _averageMilliseconds);
+    } else if (_averageMilliseconds < targetMilliseconds * headroom) {
+        newScale = _scale + 0.05f;
+    }
+
+    //steps of 5% so tiny corrections don't change the resolution every frame
+    newScale = std::round(newScale * 20.0f) / 20.0f;
+    newScale = std::clamp(newScale, minScale, maxScale);
+
+    if (newScale != _scale) {
+        _scale = newScale;
+        _averageMilliseconds = 0.0f;
+        _settle = settleFrames;
+    }
+    return _scale;
+}
+
+void RenderScaleController::reset(float scale)
+{
+    _scale = std::clamp(scale, minScale, maxScale);
+    _averageMilliseconds = 0.0f;
+    _settle = 0;
+}
+//< render_scale
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "vk_types.h"
+
+namespace Quasar::Renderer {
+
+//> render_scale
+// Picks the render scale that keeps gpu frame time inside a budget. Resolution
+// drops as soon as frames run over budget and climbs back slowly once there is
+// headroom. Timings arrive a few frames late, so after every change the
+// controller waits for frames rendered at the new scale before judging again.
+class RenderScaleController {
+public:
+    float targetMilliseconds = 16.6f;
+    float minScale = 0.5f;
+    float maxScale = 1.0f;
+    // fraction of the budget the frame has to be under before resolution goes up
+    float headroom = 0.8f;
+    // frames to skip after a change
+    uint32_t settleFrames = 8;
+
+    // gpu time of a completed frame, returns the scale for the next frame
+    float update(float gpuMilliseconds);
+
+    float scale() const { return _scale; }
+    void reset(float scale);
+
+private:
+    float _scale = 1.0f;
+    float _averageMilliseconds = 0.0f;
+    uint32_t _settle = 0;
+};
+//< render_scale
+
+}
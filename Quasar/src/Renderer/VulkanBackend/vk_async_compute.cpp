@@ -0,0 +1,120 @@
+#include "vk_async_compute.h"
+#include "vk_initializers.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> async_compute_init
+void AsyncComputeQueue::init(VkDevice device, VkQueue queue, uint32_t family, uint32_t graphicsFamily, uint32_t framesInFlight)
+{
+    _device = device;
+    _queue = queue;
+    _family = family;
+    _graphicsFamily = graphicsFamily;
+
+    VkSemaphoreTypeCreateInfo timelineInfo = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO};
+    timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    timelineInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo semaphoreInfo = vkinit::semaphore_create_info();
+    semaphoreInfo.pNext = &timelineInfo;
+    VK_CHECK(vkCreateSemaphore(_device, &semaphoreInfo, nullptr, &_timeline));
+
+    VkCommandPoolCreateInfo poolInfo = vkinit::command_pool_create_info(_family, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+
+    //command buffers are allocated as frames ask for them
+    _slots.resize(framesInFlight);
+    for (Slot& slot : _slots) {
+        VK_CHECK(vkCreateCommandPool(_device, &poolInfo, nullptr, &slot.pool));
+    }
+
+    QS_CORE_INFO("Compute work runs on queue family %u (%s)", _family, is_async() ? "async" : "shared with graphics");
+}
+
+void AsyncComputeQueue::destroy()
+{
+    for (Slot& slot : _slots) {
+        vkDestroyCommandPool(_device, slot.pool, nullptr);
+    }
+    _slots.clear();
+
+    vkDestroySemaphore(_device, _timeline, nullptr);
+}
+//< async_compute_init
+
+//> async_compute_submit
+void AsyncComputeQueue::begin_frame(uint32_t frameSlot)
+{
+    _currentSlot = frameSlot;
+    Slot& slot = _slots[frameSlot];
+
+    //graphics normally waited on this value already, so this returns right away.
+    //No timeout, a slow frame is not an error
+    if (slot.value != 0) {
+        VkSemaphoreWaitInfo waitInfo = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &_timeline;
+        waitInfo.pValues = &slot.value;
+        VK_CHECK(vkWaitSemaphores(_device, &waitInfo, UINT64_MAX));
+    }
+
+    slot.used = 0;
+}
+
+VkCommandBuffer AsyncComputeQueue::begin()
+{
+    Slot& slot = _slots[_currentSlot];
+
+    if (slot.used == slot.cmds.size()) {
+        VkCommandBufferAllocateInfo cmdAllocInfo = vkinit::command_buffer_allocate_info(slot.pool, 1);
+        VK_CHECK(vkAllocateCommandBuffers(_device, &cmdAllocInfo, &slot.cmds.emplace_back()));
+    }
+    VkCommandBuffer cmd = slot.cmds[slot.used++];
+
+    VK_CHECK(vkResetCommandBuffer(cmd, 0));
+
+    VkCommandBufferBeginInfo cmdBeginInfo = vkinit::command_buffer_begin_info(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    VK_CHECK(vkBeginCommandBuffer(cmd, &cmdBeginInfo));
+
+    return cmd;
+}
+
+uint64_t AsyncComputeQueue::submit(VkCommandBuffer cmd, std::span<const VkSemaphoreSubmitInfo> waits)
+{
+    VK_CHECK(vkEndCommandBuffer(cmd));
+
+    //command buffers are submitted in the order they were begun, so the slot's
+    //value ends up at the last one
+    uint64_t value = ++_submitted;
+    _slots[_currentSlot].value = value;
+
+    VkCommandBufferSubmitInfo cmdInfo = vkinit::command_buffer_submit_info(cmd);
+
+    VkSemaphoreSubmitInfo signalInfo = vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, _timeline);
+    signalInfo.value = value;
+
+    VkSubmitInfo2 submit = vkinit::submit_info(&cmdInfo, &signalInfo, nullptr);
+    submit.waitSemaphoreInfoCount = (uint32_t)waits.size();
+    submit.pWaitSemaphoreInfos = waits.data();
+
+    VK_CHECK(vkQueueSubmit2(_queue, 1, &submit, VK_NULL_HANDLE));
+    return value;
+}
+
+VkSemaphoreSubmitInfo AsyncComputeQueue::wait_info(uint64_t value, VkPipelineStageFlags2 stage) const
+{
+    VkSemaphoreSubmitInfo info = vkinit::semaphore_submit_info(stage, _timeline);
+    info.value = value;
+    return info;
+}
+
+uint64_t AsyncComputeQueue::completed_value() const
+{
+    uint64_t value = 0;
+    VK_CHECK(vkGetSemaphoreCounterValue(_device, _timeline, &value));
+    return value;
+}
+//< async_compute_submit
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "vk_types.h"
+
+namespace Quasar::Renderer {
+
+//> async_compute
+// Submission path for compute work (culling, mip generation, post-processing,
+// light binning) that overlaps with graphics. Work goes to the dedicated compute
+// queue when the device has one and to the graphics queue otherwise, callers
+// don't need to care which. Every submit signals the next value of one timeline
+// semaphore, graphics waits for that value at the stage that consumes the results.
+class AsyncComputeQueue {
+public:
+    void init(VkDevice device, VkQueue queue, uint32_t family, uint32_t graphicsFamily, uint32_t framesInFlight);
+    void destroy();
+
+    // true when work really runs on a separate queue family. Resources shared
+    // with graphics then need ownership transfers, see BarrierBatch::release_image
+    bool is_async() const { return _family != _graphicsFamily; }
+    uint32_t family() const { return _family; }
+
+    // waits until the compute work of the frame that last used frameSlot is done
+    // and makes its command buffers available again. Call once per frame before begin()
+    void begin_frame(uint32_t frameSlot);
+
+    // a command buffer of the current frame slot, recording. A frame may submit
+    // several times, each begin() hands out another command buffer
+    VkCommandBuffer begin();
+
+    // ends and submits cmd, waiting on waits first. Returns the timeline value
+    // that is signaled when the work is done
+    uint64_t submit(VkCommandBuffer cmd, std::span<const VkSemaphoreSubmitInfo> waits = {});
+
+    // what another queue adds to its submit to wait for value before stage
+    VkSemaphoreSubmitInfo wait_info(uint64_t value, VkPipelineStageFlags2 stage) const;
+
+    // timeline value of the last submit that has finished on the gpu
+    uint64_t completed_value() const;
+    // timeline value of the last submit, 0 before the first one
+    uint64_t submitted_value() const { return _submitted; }
+
+    VkSemaphore timeline() const { return _timeline; }
+
+private:
+    VkDevice _device;
+    VkQueue _queue;
+    uint32_t _family;
+    uint32_t _graphicsFamily;
+
+    VkSemaphore _timeline;
+    uint64_t _submitted = 0;
+
+    struct Slot {
+        VkCommandPool pool;
+        std::vector<VkCommandBuffer> cmds;
+        // command buffers handed out since begin_frame()
+        uint32_t used = 0;
+        // timeline value the last submit from this slot signals
+        uint64_t value = 0;
+    };
+    std::vector<Slot> _slots;
+    uint32_t _currentSlot = 0;
+};
+//< async_compute
+
+}
@@ -0,0 +1,380 @@
+#include "vk_barriers.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> resource_access
+static constexpr VkAccessFlags2 WriteAccessMask = VK_ACCESS_2_SHADER_WRITE_BIT
+    | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT
+    | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+    | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+    | VK_ACCESS_2_TRANSFER_WRITE_BIT
+    | VK_ACCESS_2_HOST_WRITE_BIT
+    | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+AccessInfo vkutil::access_info(ResourceAccess access)
+{
+    constexpr VkPipelineStageFlags2 depthStages = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+    constexpr VkPipelineStageFlags2 shaderStages = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT
+        | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT
+        | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+
+    switch (access) {
+    case ResourceAccess::TransferRead:
+        return { VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL };
+    case ResourceAccess::TransferWrite:
+        return { VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL };
+    case ResourceAccess::ColorAttachmentWrite:
+        return { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    case ResourceAccess::ColorAttachmentReadWrite:
+        return { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+            VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    case ResourceAccess::DepthAttachmentRead:
+        return { depthStages, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT, VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_OPTIMAL };
+    case ResourceAccess::DepthAttachmentWrite:
+        return { depthStages, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+            VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL };
+    case ResourceAccess::VertexShaderRead:
+        return { VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    case ResourceAccess::FragmentShaderRead:
+        return { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    case ResourceAccess::ComputeShaderRead:
+        return { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    case ResourceAccess::ComputeShaderWrite:
+        return { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL };
+    case ResourceAccess::ComputeShaderReadWrite:
+        return { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL };
+    case ResourceAccess::AnyShaderRead:
+        return { shaderStages, VK_ACCESS_2_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    case ResourceAccess::UniformRead:
+        return { shaderStages, VK_ACCESS_2_UNIFORM_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+    case ResourceAccess::IndexRead:
+        return { VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT, VK_ACCESS_2_INDEX_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+    case ResourceAccess::IndirectRead:
+        return { VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+    case ResourceAccess::Present:
+        //the present semaphore does the waiting, the barrier only changes the layout
+        return { VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR };
+    }
+    return { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL };
+}
+
+bool vkutil::is_write_access(ResourceAccess access)
+{
+    return (access_info(access).access & WriteAccessMask) != 0;
+}
+//< resource_access
+
+//> barrier_resolve
+struct BarrierMasks {
+    VkPipelineStageFlags2 srcStage;
+    VkAccessFlags2 srcAccess;
+    VkPipelineStageFlags2 dstStage;
+    VkAccessFlags2 dstAccess;
+    VkImageLayout oldLayout;
+    VkImageLayout newLayout;
+
+    bool operator==(const BarrierMasks& o) const
+    {
+        return srcStage == o.srcStage && srcAccess == o.srcAccess && dstStage == o.dstStage
+            && dstAccess == o.dstAccess && oldLayout == o.oldLayout && newLayout == o.newLayout;
+    }
+};
+
+// works out the smallest barrier that makes next safe after what state recorded,
+// and moves state forward. Returns false when no barrier is needed at all
+static bool resolve(ResourceState& state, const AccessInfo& next, bool isImage, BarrierMasks& out)
+{
+    bool layoutChange = isImage && state.layout != next.layout;
+    bool nextWrites = (next.access & WriteAccessMask) != 0;
+
+    out.oldLayout = state.layout;
+    out.newLayout = isImage ? next.layout : VK_IMAGE_LAYOUT_UNDEFINED;
+    out.dstStage = next.stage;
+    out.dstAccess = next.access;
+
+    if (layoutChange || nextWrites) {
+        //write-after-read only needs the readers to finish, write-after-write and
+        //layout transitions also need the last write made available
+        out.srcStage = state.writeStage | state.readStages;
+        out.srcAccess = state.writeAccess;
+    } else {
+        //read-after-write, skipped when this reader already waited for the last write
+        bool alreadyVisible = (state.readStages & next.stage) == next.stage && (state.readAccess & next.access) == next.access;
+        if (alreadyVisible || state.writeStage == VK_PIPELINE_STAGE_2_NONE) {
+            state.readStages |= next.stage;
+            state.readAccess |= next.access;
+            return false;
+        }
+        out.srcStage = state.writeStage;
+        out.srcAccess = state.writeAccess;
+    }
+
+    bool needed = layoutChange || out.srcStage != VK_PIPELINE_STAGE_2_NONE;
+
+    if (nextWrites) {
+        state.writeStage = next.stage;
+        state.writeAccess = next.access & WriteAccessMask;
+        state.readStages = VK_PIPELINE_STAGE_2_NONE;
+        state.readAccess = VK_ACCESS_2_NONE;
+    } else if (layoutChange) {
+        //the transition itself is a write that happens before next.stage
+        state.writeStage = next.stage;
+        state.writeAccess = VK_ACCESS_2_NONE;
+        state.readStages = next.stage;
+        state.readAccess = next.access;
+    } else {
+        state.readStages |= next.stage;
+        state.readAccess |= next.access;
+    }
+    if (isImage) {
+        state.layout = next.layout;
+    }
+
+    return needed;
+}
+//< barrier_resolve
+
+//> tracked_resources
+void TrackedImage::init(VkImage newImage, VkImageAspectFlags newAspect, uint32_t mips, uint32_t layers)
+{
+    image = newImage;
+    aspect = newAspect;
+    mipLevels = mips;
+    arrayLayers = layers;
+    states.assign(mips * layers, ResourceState {});
+    queueFamily = VK_QUEUE_FAMILY_IGNORED;
+}
+
+void TrackedImage::reset(VkImageLayout layout, VkPipelineStageFlags2 stage)
+{
+    for (ResourceState& s : states) {
+        s = ResourceState {};
+        s.layout = layout;
+        s.writeStage = stage;
+    }
+    queueFamily = VK_QUEUE_FAMILY_IGNORED;
+}
+//< tracked_resources
+
+//> barrier_batch
+void BarrierBatch::image(TrackedImage& image, ResourceAccess access)
+{
+    VkImageSubresourceRange range {
+        .aspectMask = image.aspect,
+        .baseMipLevel = 0,
+        .levelCount = image.mipLevels,
+        .baseArrayLayer = 0,
+        .layerCount = image.arrayLayers,
+    };
+    this->image(image, access, range);
+}
+
+void BarrierBatch::image(TrackedImage& image, ResourceAccess access, const VkImageSubresourceRange& range)
+{
+    AccessInfo next = vkutil::access_info(access);
+    assert(next.layout != VK_IMAGE_LAYOUT_UNDEFINED && "buffer-only access used on an image");
+
+    uint32_t levelCount = range.levelCount == VK_REMAINING_MIP_LEVELS ? image.mipLevels - range.baseMipLevel : range.levelCount;
+    uint32_t layerCount = range.layerCount == VK_REMAINING_ARRAY_LAYERS ? image.arrayLayers - range.baseArrayLayer : range.layerCount;
+
+    for (uint32_t layer = range.baseArrayLayer; layer < range.baseArrayLayer + layerCount; layer++) {
+        //neighbouring mips that need the same barrier share one VkImageMemoryBarrier2
+        bool extending = false;
+        BarrierMasks previous {};
+
+        for (uint32_t mip = range.baseMipLevel; mip < range.baseMipLevel + levelCount; mip++) {
+            BarrierMasks masks;
+            if (!resolve(image.state(mip, layer), next, true, masks)) {
+                extending = false;
+                continue;
+            }
+
+            if (extending && masks == previous) {
+                _imageBarriers.back().subresourceRange.levelCount++;
+                continue;
+            }
+
+            VkImageMemoryBarrier2 barrier {.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2};
+            barrier.srcStageMask = masks.srcStage;
+            barrier.srcAccessMask = masks.srcAccess;
+            barrier.dstStageMask = masks.dstStage;
+            barrier.dstAccessMask = masks.dstAccess;
+            barrier.oldLayout = masks.oldLayout;
+            barrier.newLayout = masks.newLayout;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image.image;
+            barrier.subresourceRange = {
+                .aspectMask = range.aspectMask,
+                .baseMipLevel = mip,
+                .levelCount = 1,
+                .baseArrayLayer = layer,
+                .layerCount = 1,
+            };
+            _imageBarriers.push_back(barrier);
+
+            extending = true;
+            previous = masks;
+        }
+    }
+}
+
+void BarrierBatch::buffer(TrackedBuffer& buffer, ResourceAccess access, VkDeviceSize offset, VkDeviceSize size)
+{
+    BarrierMasks masks;
+    if (!resolve(buffer.state, vkutil::access_info(access), false, masks)) {
+        return;
+    }
+
+    VkBufferMemoryBarrier2 barrier {.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2};
+    barrier.srcStageMask = masks.srcStage;
+    barrier.srcAccessMask = masks.srcAccess;
+    barrier.dstStageMask = masks.dstStage;
+    barrier.dstAccessMask = masks.dstAccess;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = buffer.buffer;
+    barrier.offset = offset;
+    barrier.size = size;
+    _bufferBarriers.push_back(barrier);
+}
+
+void BarrierBatch::release_image(TrackedImage& image, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily)
+{
+    if (srcFamily == dstFamily) {
+        return;
+    }
+    ownership_image(image, dstAccess, srcFamily, dstFamily, true);
+}
+
+void BarrierBatch::acquire_image(TrackedImage& image, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily)
+{
+    if (srcFamily == dstFamily) {
+        this->image(image, dstAccess);
+        return;
+    }
+    ownership_image(image, dstAccess, srcFamily, dstFamily, false);
+}
+
+void BarrierBatch::release_buffer(TrackedBuffer& buffer, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily)
+{
+    if (srcFamily == dstFamily) {
+        return;
+    }
+    ownership_buffer(buffer, dstAccess, srcFamily, dstFamily, true);
+}
+
+void BarrierBatch::acquire_buffer(TrackedBuffer& buffer, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily)
+{
+    if (srcFamily == dstFamily) {
+        this->buffer(buffer, dstAccess);
+        return;
+    }
+    ownership_buffer(buffer, dstAccess, srcFamily, dstFamily, false);
+}
+
+// the release half only waits for the last accesses on the source queue, the
+// acquire half only blocks the destination stages, the semaphore between the
+// two submits orders them. The acquire starts at its own destination stages, so
+// a semaphore wait on those stages chains into it. Layouts have to match on
+// both halves, so the state only moves on at the acquire
+void BarrierBatch::ownership_image(TrackedImage& image, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily, bool release)
+{
+    AccessInfo next = vkutil::access_info(dstAccess);
+
+    for (uint32_t layer = 0; layer < image.arrayLayers; layer++) {
+        for (uint32_t mip = 0; mip < image.mipLevels; mip++) {
+            ResourceState& state = image.state(mip, layer);
+
+            VkImageMemoryBarrier2 barrier {.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2};
+            if (release) {
+                barrier.srcStageMask = state.writeStage | state.readStages;
+                barrier.srcAccessMask = state.writeAccess;
+            } else {
+                barrier.srcStageMask = next.stage;
+                barrier.dstStageMask = next.stage;
+                barrier.dstAccessMask = next.access;
+            }
+            barrier.oldLayout = state.layout;
+            barrier.newLayout = next.layout;
+            barrier.srcQueueFamilyIndex = srcFamily;
+            barrier.dstQueueFamilyIndex = dstFamily;
+            barrier.image = image.image;
+            barrier.subresourceRange = {
+                .aspectMask = image.aspect,
+                .baseMipLevel = mip,
+                .levelCount = 1,
+                .baseArrayLayer = layer,
+                .layerCount = 1,
+            };
+            _imageBarriers.push_back(barrier);
+
+            if (!release) {
+                state = ResourceState {};
+                state.layout = next.layout;
+                state.writeStage = next.stage;
+                state.writeAccess = next.access & WriteAccessMask;
+                if (state.writeAccess == VK_ACCESS_2_NONE) {
+                    state.readStages = next.stage;
+                    state.readAccess = next.access;
+                }
+            }
+        }
+    }
+}
+
+void BarrierBatch::ownership_buffer(TrackedBuffer& buffer, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily, bool release)
+{
+    AccessInfo next = vkutil::access_info(dstAccess);
+    ResourceState& state = buffer.state;
+
+    VkBufferMemoryBarrier2 barrier {.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2};
+    if (release) {
+        barrier.srcStageMask = state.writeStage | state.readStages;
+        barrier.srcAccessMask = state.writeAccess;
+    } else {
+        barrier.srcStageMask = next.stage;
+        barrier.dstStageMask = next.stage;
+        barrier.dstAccessMask = next.access;
+    }
+    barrier.srcQueueFamilyIndex = srcFamily;
+    barrier.dstQueueFamilyIndex = dstFamily;
+    barrier.buffer = buffer.buffer;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+    _bufferBarriers.push_back(barrier);
+
+    if (!release) {
+        state = ResourceState {};
+        state.writeStage = next.stage;
+        state.writeAccess = next.access & WriteAccessMask;
+        if (state.writeAccess == VK_ACCESS_2_NONE) {
+            state.readStages = next.stage;
+            state.readAccess = next.access;
+        }
+    }
+}
+
+void BarrierBatch::flush(VkCommandBuffer cmd)
+{
+    if (empty()) {
+        return;
+    }
+
+    VkDependencyInfo depInfo {.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+    depInfo.imageMemoryBarrierCount = (uint32_t)_imageBarriers.size();
+    depInfo.pImageMemoryBarriers = _imageBarriers.data();
+    depInfo.bufferMemoryBarrierCount = (uint32_t)_bufferBarriers.size();
+    depInfo.pBufferMemoryBarriers = _bufferBarriers.data();
+
+    vkCmdPipelineBarrier2(cmd, &depInfo);
+
+    //keep the capacity, the batch is reused every frame
+    _imageBarriers.clear();
+    _bufferBarriers.clear();
+}
+//< barrier_batch
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "vk_types.h"
+
+namespace Quasar::Renderer {
+
+//> resource_access
+// What a command does with a resource. Each access maps to the exact stages,
+// access bits and image layout it needs, so barriers never have to fall back
+// to ALL_COMMANDS / MEMORY_READ|MEMORY_WRITE.
+enum class ResourceAccess : uint8_t {
+    TransferRead,
+    TransferWrite,
+    ColorAttachmentWrite,
+    ColorAttachmentReadWrite,
+    DepthAttachmentRead,
+    DepthAttachmentWrite,
+    VertexShaderRead,
+    FragmentShaderRead,
+    ComputeShaderRead,
+    ComputeShaderWrite,
+    ComputeShaderReadWrite,
+    AnyShaderRead,
+    UniformRead,
+    IndexRead,
+    IndirectRead,
+    Present,
+};
+
+struct AccessInfo {
+    VkPipelineStageFlags2 stage;
+    VkAccessFlags2 access;
+    // layout images are in for this access, ignored for buffers
+    VkImageLayout layout;
+};
+
+// Synchronization state of one buffer or image subresource since its last write
+struct ResourceState {
+    VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkPipelineStageFlags2 writeStage = VK_PIPELINE_STAGE_2_NONE;
+    VkAccessFlags2 writeAccess = VK_ACCESS_2_NONE;
+    // readers that already waited for the last write
+    VkPipelineStageFlags2 readStages = VK_PIPELINE_STAGE_2_NONE;
+    VkAccessFlags2 readAccess = VK_ACCESS_2_NONE;
+};
+
+namespace vkutil {
+AccessInfo access_info(ResourceAccess access);
+// true when the access writes, read-modify-write accesses included
+bool is_write_access(ResourceAccess access);
+}
+//< resource_access
+
+//> tracked_resources
+// An image together with the layout, last writer and readers of each mip level
+// and array layer
+struct TrackedImage {
+    VkImage image = VK_NULL_HANDLE;
+    VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+    uint32_t mipLevels = 1;
+    uint32_t arrayLayers = 1;
+    // mip-major within each layer: states[layer * mipLevels + mip]
+    std::vector<ResourceState> states;
+    // family of the queue that used it last, VK_QUEUE_FAMILY_IGNORED when unknown
+    uint32_t queueFamily = VK_QUEUE_FAMILY_IGNORED;
+
+    void init(VkImage newImage, VkImageAspectFlags newAspect, uint32_t mips = 1, uint32_t layers = 1);
+
+    // forgets the history, e.g. for a freshly acquired swapchain image. stage is
+    // the stage anything touching the image has to wait for (the acquire
+    // semaphore's wait stage)
+    void reset(VkImageLayout layout, VkPipelineStageFlags2 stage = VK_PIPELINE_STAGE_2_NONE);
+
+    ResourceState& state(uint32_t mip, uint32_t layer) { return states[layer * mipLevels + mip]; }
+};
+
+struct TrackedBuffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    ResourceState state;
+    // family of the queue that used it last, VK_QUEUE_FAMILY_IGNORED when unknown
+    uint32_t queueFamily = VK_QUEUE_FAMILY_IGNORED;
+};
+//< tracked_resources
+
+//> barrier_batch
+// Collects the barriers a group of commands needs and issues them all in one
+// vkCmdPipelineBarrier2 when flush() is called, right before those commands are
+// recorded. Accesses that are already synchronized produce no barrier.
+// A resource should be used once per batch, flush between two dependent uses.
+class BarrierBatch {
+public:
+    void image(TrackedImage& image, ResourceAccess access);
+    void image(TrackedImage& image, ResourceAccess access, const VkImageSubresourceRange& range);
+    void buffer(TrackedBuffer& buffer, ResourceAccess access, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    // queue family ownership transfer. The release goes on the source queue, the
+    // matching acquire with the same arguments on the destination queue after a
+    // semaphore wait. Both are plain accesses when the families are the same
+    void release_image(TrackedImage& image, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily);
+    void acquire_image(TrackedImage& image, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily);
+    void release_buffer(TrackedBuffer& buffer, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily);
+    void acquire_buffer(TrackedBuffer& buffer, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily);
+
+    void flush(VkCommandBuffer cmd);
+
+    bool empty() const { return _imageBarriers.empty() && _bufferBarriers.empty(); }
+
+private:
+    void ownership_image(TrackedImage& image, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily, bool release);
+    void ownership_buffer(TrackedBuffer& buffer, ResourceAccess dstAccess, uint32_t srcFamily, uint32_t dstFamily, bool release);
+
+    std::vector<VkImageMemoryBarrier2> _imageBarriers;
+    std::vector<VkBufferMemoryBarrier2> _bufferBarriers;
+};
+//< barrier_batch
+
+}
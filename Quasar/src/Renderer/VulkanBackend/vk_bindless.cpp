@@ -0,0 +1,183 @@
+#include "vk_bindless.h"
+#include "vk_initializers.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> bindless_init
+void BindlessRegistry::init(VkDevice device, VkPhysicalDevice physicalDevice, DescriptorLayoutCache& layoutCache)
+{
+    _device = device;
+
+    //clamp the array sizes to what the device allows for update-after-bind sets
+    VkPhysicalDeviceDescriptorIndexingProperties indexingProps = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES};
+    VkPhysicalDeviceProperties2 props = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+    props.pNext = &indexingProps;
+    vkGetPhysicalDeviceProperties2(physicalDevice, &props);
+
+    _textures.capacity = std::min(MaxTextures, indexingProps.maxDescriptorSetUpdateAfterBindSampledImages);
+    _samplers.capacity = std::min(MaxSamplers, indexingProps.maxDescriptorSetUpdateAfterBindSamplers);
+    _buffers.capacity = std::min(MaxStorageBuffers, indexingProps.maxDescriptorSetUpdateAfterBindStorageBuffers);
+
+    VkShaderStageFlags stages = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+
+    std::array<VkDescriptorSetLayoutBinding, 3> bindings {};
+    bindings[0] = vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, stages, TextureBinding);
+    bindings[0].descriptorCount = _textures.capacity;
+    bindings[1] = vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_SAMPLER, stages, SamplerBinding);
+    bindings[1].descriptorCount = _samplers.capacity;
+    bindings[2] = vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, stages, StorageBufferBinding);
+    bindings[2].descriptorCount = _buffers.capacity;
+
+    //slots are filled as resources come and go, and may be rewritten while the set
+    //is bound as long as the gpu isn't reading that particular slot
+    VkDescriptorBindingFlags bindlessFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+        | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+        | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+    std::array<VkDescriptorBindingFlags, 3> bindingFlags = { bindlessFlags, bindlessFlags, bindlessFlags };
+
+    layout = layoutCache.create_descriptor_layout(bindings, bindingFlags, VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT);
+
+    std::array<VkDescriptorPoolSize, 3> poolSizes = {
+        VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, _textures.capacity },
+        VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_SAMPLER, _samplers.capacity },
+        VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, _buffers.capacity },
+    };
+
+    VkDescriptorPoolCreateInfo pool_info = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    pool_info.maxSets = 1;
+    pool_info.poolSizeCount = (uint32_t)poolSizes.size();
+    pool_info.pPoolSizes = poolSizes.data();
+
+    VK_CHECK(vkCreateDescriptorPool(_device, &pool_info, nullptr, &_pool));
+
+    VkDescriptorSetAllocateInfo allocInfo = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    allocInfo.descriptorPool = _pool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &layout;
+
+    VK_CHECK(vkAllocateDescriptorSets(_device, &allocInfo, &set));
+}
+
+void BindlessRegistry::cleanup()
+{
+    //the layout belongs to the layout cache
+    vkDestroyDescriptorPool(_device, _pool, nullptr);
+}
+//< bindless_init
+
+//> bindless_register
+uint32_t BindlessRegistry::register_texture(VkImageView view, VkImageLayout layout)
+{
+    uint32_t index = _textures.allocate();
+    if (index != INVALID_ID) {
+        update_texture(index, view, layout);
+    }
+    return index;
+}
+
+void BindlessRegistry::update_texture(uint32_t index, VkImageView view, VkImageLayout layout)
+{
+    VkDescriptorImageInfo info { .sampler = VK_NULL_HANDLE, .imageView = view, .imageLayout = layout };
+    write(TextureBinding, index, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, &info, nullptr);
+}
+
+uint32_t BindlessRegistry::register_sampler(VkSampler sampler)
+{
+    uint32_t index = _samplers.allocate();
+    if (index != INVALID_ID) {
+        VkDescriptorImageInfo info { .sampler = sampler };
+        write(SamplerBinding, index, VK_DESCRIPTOR_TYPE_SAMPLER, &info, nullptr);
+    }
+    return index;
+}
+
+uint32_t BindlessRegistry::register_storage_buffer(VkBuffer buffer, VkDeviceSize size, VkDeviceSize offset)
+{
+    uint32_t index = _buffers.allocate();
+    if (index != INVALID_ID) {
+        VkDescriptorBufferInfo info = vkinit::buffer_info(buffer, offset, size);
+        write(StorageBufferBinding, index, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, nullptr, &info);
+    }
+    return index;
+}
+
+void BindlessRegistry::release_texture(uint32_t index, uint64_t lastUsedFrame)
+{
+    _textures.release(index, lastUsedFrame);
+}
+
+void BindlessRegistry::release_sampler(uint32_t index, uint64_t lastUsedFrame)
+{
+    _samplers.release(index, lastUsedFrame);
+}
+
+void BindlessRegistry::release_storage_buffer(uint32_t index, uint64_t lastUsedFrame)
+{
+    _buffers.release(index, lastUsedFrame);
+}
+
+void BindlessRegistry::collect(uint64_t completedFrame)
+{
+    _textures.collect(completedFrame);
+    _samplers.collect(completedFrame);
+    _buffers.collect(completedFrame);
+}
+
+void BindlessRegistry::bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout pipelineLayout, uint32_t setIndex) const
+{
+    vkCmdBindDescriptorSets(cmd, bindPoint, pipelineLayout, setIndex, 1, &set, 0, nullptr);
+}
+
+void BindlessRegistry::write(uint32_t binding, uint32_t index, VkDescriptorType type,
+    const VkDescriptorImageInfo* imageInfo, const VkDescriptorBufferInfo* bufferInfo)
+{
+    VkWriteDescriptorSet write = {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    write.dstSet = set;
+    write.dstBinding = binding;
+    write.dstArrayElement = index;
+    write.descriptorCount = 1;
+    write.descriptorType = type;
+    write.pImageInfo = imageInfo;
+    write.pBufferInfo = bufferInfo;
+
+    vkUpdateDescriptorSets(_device, 1, &write, 0, nullptr);
+}
+//< bindless_register
+
+//> bindless_indices
+uint32_t BindlessRegistry::IndexAllocator::allocate()
+{
+    if (!freeIndices.empty()) {
+        uint32_t index = freeIndices.back();
+        freeIndices.pop_back();
+        return index;
+    }
+    if (next >= capacity) {
+        QS_CORE_ERROR("Bindless array is full (%u descriptors)", capacity);
+        return INVALID_ID;
+    }
+    return next++;
+}
+
+void BindlessRegistry::IndexAllocator::release(uint32_t index, uint64_t lastUsedFrame)
+{
+    if (index == INVALID_ID) {
+        return;
+    }
+    pending.emplace_back(lastUsedFrame, index);
+}
+
+void BindlessRegistry::IndexAllocator::collect(uint64_t completedFrame)
+{
+    //releases are queued in frame order, so stop at the first one still in flight
+    while (!pending.empty() && pending.front().first <= completedFrame) {
+        freeIndices.push_back(pending.front().second);
+        pending.pop_front();
+    }
+}
+//< bindless_indices
+
+}
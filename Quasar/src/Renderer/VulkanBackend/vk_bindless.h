@@ -0,0 +1,72 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_descriptors.h"
+
+namespace Quasar::Renderer {
+
+//> bindless
+// One global descriptor set holding every texture, sampler and storage buffer the
+// renderer knows about. Resources get a stable index when they are registered and
+// shaders index the arrays directly, so drawing with a different material never
+// needs a vkCmdBindDescriptorSets.
+class BindlessRegistry {
+public:
+    static constexpr uint32_t TextureBinding = 0;
+    static constexpr uint32_t SamplerBinding = 1;
+    static constexpr uint32_t StorageBufferBinding = 2;
+
+    static constexpr uint32_t MaxTextures = 16384;
+    static constexpr uint32_t MaxSamplers = 128;
+    static constexpr uint32_t MaxStorageBuffers = 4096;
+
+    void init(VkDevice device, VkPhysicalDevice physicalDevice, DescriptorLayoutCache& layoutCache);
+    void cleanup();
+
+    uint32_t register_texture(VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    uint32_t register_sampler(VkSampler sampler);
+    uint32_t register_storage_buffer(VkBuffer buffer, VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
+
+    // repoints an existing index, the index itself stays valid
+    void update_texture(uint32_t index, VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    // the index may still be read by frames in flight, so it only returns to the
+    // free list once frame lastUsedFrame has completed on the gpu
+    void release_texture(uint32_t index, uint64_t lastUsedFrame);
+    void release_sampler(uint32_t index, uint64_t lastUsedFrame);
+    void release_storage_buffer(uint32_t index, uint64_t lastUsedFrame);
+
+    // recycles every index released by frames up to and including completedFrame
+    void collect(uint64_t completedFrame);
+
+    void bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout pipelineLayout, uint32_t setIndex = 0) const;
+
+    VkDescriptorSetLayout layout;
+    VkDescriptorSet set;
+
+private:
+    struct IndexAllocator {
+        uint32_t capacity = 0;
+        uint32_t next = 0;
+        std::vector<uint32_t> freeIndices;
+        // (frame, index) pairs waiting for their frame to retire, in release order
+        std::deque<std::pair<uint64_t, uint32_t>> pending;
+
+        uint32_t allocate();
+        void release(uint32_t index, uint64_t lastUsedFrame);
+        void collect(uint64_t completedFrame);
+    };
+
+    void write(uint32_t binding, uint32_t index, VkDescriptorType type,
+        const VkDescriptorImageInfo* imageInfo, const VkDescriptorBufferInfo* bufferInfo);
+
+    VkDevice _device;
+    VkDescriptorPool _pool;
+
+    IndexAllocator _textures;
+    IndexAllocator _samplers;
+    IndexAllocator _buffers;
+};
+//< bindless
+
+}
@@ -0,0 +1,186 @@
+#include "vk_culling.h"
+#include "vk_initializers.h"
+#include "vk_pipelines.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+// mirrors the push constants of Builtin.DrawCull.comp.glsl
+struct CullPushConstants {
+    uint32_t late;
+    // visibility from the previous frames doesn't belong to these objects
+    uint32_t resetVisibility;
+};
+
+//> culler_init
+AllocatedBuffer DrawCuller::create_buffer(VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage)
+{
+    VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+
+    VmaAllocationCreateInfo vmaallocInfo = {};
+    vmaallocInfo.usage = memoryUsage;
+    if (memoryUsage != VMA_MEMORY_USAGE_GPU_ONLY) {
+        vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    }
+
+    AllocatedBuffer newBuffer;
+    VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &newBuffer.buffer, &newBuffer.allocation, &newBuffer.info));
+    return newBuffer;
+}
+
+void DrawCuller::init(VkDevice device, VmaAllocator allocator, DescriptorLayoutCache& layoutCache,
+    const TransientDescriptorAllocator& frameDescriptors, VkSampler depthSampler, uint32_t framesInFlight)
+{
+    _device = device;
+    _allocator = allocator;
+    _depthSampler = depthSampler;
+
+    _frames.resize(framesInFlight);
+    for (FrameBuffers& frame : _frames) {
+        //written by the cpu every frame
+        frame.objects = create_buffer(MaxObjects * sizeof(GPUCullObject), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU);
+        //counted on the gpu, read back when the slot comes around again
+        frame.statsBuffer = create_buffer(sizeof(CullStats), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU);
+        memset(frame.statsBuffer.info.pMappedData, 0, sizeof(CullStats));
+        vmaFlushAllocation(_allocator, frame.statsBuffer.allocation, 0, VK_WHOLE_SIZE);
+        frame.stats.buffer = frame.statsBuffer.buffer;
+    }
+
+    //frames run one after the other on the graphics queue, so one copy of the
+    //gpu-only buffers does, the render graph orders the accesses
+    VkBufferUsageFlags commandUsage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    _visibilityBuffer = create_buffer(MaxObjects * sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_ONLY);
+    _earlyBuffer = create_buffer(MaxObjects * sizeof(VkDrawIndexedIndirectCommand), commandUsage, VMA_MEMORY_USAGE_GPU_ONLY);
+    _lateBuffer = create_buffer(MaxObjects * sizeof(VkDrawIndexedIndirectCommand), commandUsage, VMA_MEMORY_USAGE_GPU_ONLY);
+    _finalBuffer = create_buffer(MaxObjects * sizeof(VkDrawIndexedIndirectCommand), commandUsage, VMA_MEMORY_USAGE_GPU_ONLY);
+    _visibility.buffer = _visibilityBuffer.buffer;
+    _earlyCommands.buffer = _earlyBuffer.buffer;
+    _lateCommands.buffer = _lateBuffer.buffer;
+    _finalCommands.buffer = _finalBuffer.buffer;
+
+    VkShaderModule cullShader;
+    if (!vkutil::load_shader_module("Assets/shaders/Builtin.DrawCull.comp.spv", _device, &cullShader)) {
+        QS_CORE_ERROR("Error when building the draw cull shader module");
+    }
+
+    //the sets come from the per-frame transient allocator, so the layout and the
+    //pipeline take its flags
+    std::array<VkDescriptorSetLayoutBinding, 7> bindings = {
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 0),
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 1),
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 2),
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 3),
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 4),
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 5),
+        vkinit::descriptorset_layout_binding(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_COMPUTE_BIT, 6),
+    };
+    _setLayout = layoutCache.create_descriptor_layout(bindings, {}, frameDescriptors.layout_create_flags());
+
+    VkPushConstantRange pushConstants = { .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(CullPushConstants) };
+    _pipelineLayout = layoutCache.create_pipeline_layout(std::span(&_setLayout, 1), std::span(&pushConstants, 1));
+
+    VkComputePipelineCreateInfo computePipelineCreateInfo = {.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    computePipelineCreateInfo.layout = _pipelineLayout;
+    computePipelineCreateInfo.stage = vkinit::pipeline_shader_stage_create_info(VK_SHADER_STAGE_COMPUTE_BIT, cullShader);
+    computePipelineCreateInfo.flags = frameDescriptors.pipeline_create_flags();
+
+    VK_CHECK(vkCreateComputePipelines(_device, VK_NULL_HANDLE, 1, &computePipelineCreateInfo, nullptr, &_pipeline));
+
+    vkDestroyShaderModule(_device, cullShader, nullptr);
+}
+
+void DrawCuller::destroy()
+{
+    //the layouts belong to the layout cache
+    vkDestroyPipeline(_device, _pipeline, nullptr);
+
+    for (FrameBuffers& frame : _frames) {
+        vmaDestroyBuffer(_allocator, frame.objects.buffer, frame.objects.allocation);
+        vmaDestroyBuffer(_allocator, frame.statsBuffer.buffer, frame.statsBuffer.allocation);
+    }
+    _frames.clear();
+
+    for (AllocatedBuffer* buffer : { &_visibilityBuffer, &_earlyBuffer, &_lateBuffer, &_finalBuffer }) {
+        vmaDestroyBuffer(_allocator, buffer->buffer, buffer->allocation);
+    }
+}
+//< culler_init
+
+//> culler_frame
+uint32_t DrawCuller::begin_frame(uint32_t frameSlot, std::span<const RenderObject> objects)
+{
+    _frameSlot = frameSlot;
+    FrameBuffers& frame = _frames[frameSlot];
+
+    //the frame that wrote these counters has completed
+    vmaInvalidateAllocation(_allocator, frame.statsBuffer.allocation, 0, VK_WHOLE_SIZE);
+    memcpy(&_stats, frame.statsBuffer.info.pMappedData, sizeof(CullStats));
+    memset(frame.statsBuffer.info.pMappedData, 0, sizeof(CullStats));
+    vmaFlushAllocation(_allocator, frame.statsBuffer.allocation, 0, VK_WHOLE_SIZE);
+
+    uint32_t count = (uint32_t)objects.size();
+    if (count > MaxObjects) {
+        QS_CORE_ERROR("%u objects submitted, only the first %u are drawn", count, MaxObjects);
+        count = MaxObjects;
+    }
+
+    _resetVisibility = count != _objectCount;
+    _objectCount = count;
+
+    GPUCullObject* gpuObjects = (GPUCullObject*)frame.objects.info.pMappedData;
+    for (uint32_t i = 0; i < count; i++) {
+        const RenderObject& object = objects[i];
+
+        //the sphere has to contain the scaled bounds, so take the largest axis scale
+        glm::vec3 center = glm::vec3(object.transform * glm::vec4(object.bounds.origin, 1.f));
+        float scale = std::max({ glm::length(glm::vec3(object.transform[0])),
+            glm::length(glm::vec3(object.transform[1])),
+            glm::length(glm::vec3(object.transform[2])) });
+
+        gpuObjects[i].sphere = glm::vec4(center, object.bounds.sphereRadius * scale);
+        gpuObjects[i].indexCount = object.indexCount;
+        gpuObjects[i].firstIndex = object.firstIndex;
+    }
+    vmaFlushAllocation(_allocator, frame.objects.allocation, 0, count * sizeof(GPUCullObject));
+
+    return count;
+}
+
+void DrawCuller::cull(VkCommandBuffer cmd, CullPhase phase, TransientDescriptorAllocator& frameDescriptors,
+    const RingAllocation& cullData, VkImageView depthPyramid)
+{
+    if (_objectCount == 0) {
+        return;
+    }
+
+    FrameBuffers& frame = _frames[_frameSlot];
+    VkBuffer commands = phase == CullPhase::Early ? _earlyBuffer.buffer : _lateBuffer.buffer;
+    VkDeviceSize commandBytes = _objectCount * sizeof(VkDrawIndexedIndirectCommand);
+
+    _writer.clear();
+    _writer.write_buffer(0, cullData.buffer, sizeof(GPUCullData), cullData.offset, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    _writer.write_buffer(1, frame.objects.buffer, _objectCount * sizeof(GPUCullObject), 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    _writer.write_buffer(2, _visibilityBuffer.buffer, _objectCount * sizeof(uint32_t), 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    _writer.write_buffer(3, commands, commandBytes, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    _writer.write_buffer(4, _finalBuffer.buffer, commandBytes, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    _writer.write_buffer(5, frame.statsBuffer.buffer, sizeof(CullStats), 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    _writer.write_image(6, depthPyramid, _depthSampler, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+    TransientDescriptorSet set = frameDescriptors.allocate(_setLayout, _writer);
+
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
+    frameDescriptors.bind(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipelineLayout, 0, std::span(&set, 1));
+
+    CullPushConstants pushConstants;
+    pushConstants.late = phase == CullPhase::Late ? 1 : 0;
+    pushConstants.resetVisibility = _resetVisibility ? 1 : 0;
+    vkCmdPushConstants(cmd, _pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullPushConstants), &pushConstants);
+
+    vkCmdDispatch(cmd, (_objectCount + 63) / 64, 1, 1);
+}
+//< culler_frame
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_barriers.h"
+#include "vk_descriptors.h"
+#include "vk_uniform_ring.h"
+
+namespace Quasar::Renderer {
+
+//> cull_types
+// mirrors CullObject in Builtin.DrawCull.comp.glsl
+struct GPUCullObject {
+    // world space bounding sphere, radius in w
+    glm::vec4 sphere;
+    uint32_t indexCount;
+    uint32_t firstIndex;
+    uint32_t pad[2];
+};
+
+// mirrors CullData in Builtin.DrawCull.comp.glsl
+struct GPUCullData {
+    glm::mat4 view;
+    // projection scale, P11 without the y flip
+    float P00, P11;
+    // reversed-Z depth of a view distance d is P32 / d - P22
+    float P22, P32;
+    float znear, zfar;
+    float pyramidWidth, pyramidHeight;
+    uint32_t objectCount;
+    uint32_t occlusionEnabled;
+    uint32_t pad[2];
+};
+
+// what the culling did to one frame's objects, read back once the frame completed
+struct CullStats {
+    uint32_t objects;
+    uint32_t frustumCulled;
+    uint32_t occlusionCulled;
+    // drawn in the first phase because they were visible the frame before
+    uint32_t earlyDraws;
+    // drawn in the second phase because they became visible this frame
+    uint32_t lateDraws;
+};
+
+enum class CullPhase : uint8_t {
+    Early,
+    Late,
+};
+//< cull_types
+
+//> draw_culler
+// Two-phase occlusion culling against the hierarchical-Z pyramid.
+//
+// The early phase draws what was visible last frame, which is almost everything
+// that is visible now. The depth pyramid is built from that, every object is
+// tested against it in the late phase, and the late phase draws the objects that
+// became visible. Each object gets its own VkDrawIndexedIndirectCommand whose
+// instance count the culling shader sets to 0 or 1, so culled objects never reach
+// the vertex shader.
+//
+// Visibility is remembered per object index, objects keep it as long as they keep
+// their place in the draw list. It starts over when the object count changes.
+class DrawCuller {
+public:
+    static constexpr uint32_t MaxObjects = 1 << 17;
+
+    void init(VkDevice device, VmaAllocator allocator, DescriptorLayoutCache& layoutCache,
+        const TransientDescriptorAllocator& frameDescriptors, VkSampler depthSampler, uint32_t framesInFlight);
+    void destroy();
+
+    // the previous use of frameSlot has completed. Reads back its stats and uploads
+    // the bounds of this frame's objects, returns how many objects will be culled
+    uint32_t begin_frame(uint32_t frameSlot, std::span<const RenderObject> objects);
+
+    // cullData is a GPUCullData in the uniform ring. The late phase samples the
+    // pyramid, which has to be in SHADER_READ_ONLY_OPTIMAL
+    void cull(VkCommandBuffer cmd, CullPhase phase, TransientDescriptorAllocator& frameDescriptors,
+        const RingAllocation& cullData, VkImageView depthPyramid);
+
+    // indirect commands of each phase, plus every visible object for passes that
+    // draw the final visible set once more
+    TrackedBuffer& draw_commands(CullPhase phase) { return phase == CullPhase::Early ? _earlyCommands : _lateCommands; }
+    TrackedBuffer& final_commands() { return _finalCommands; }
+    TrackedBuffer& visibility() { return _visibility; }
+    TrackedBuffer& stats_buffer() { return _frames[_frameSlot].stats; }
+
+    // byte offset of an object's command in the command buffers
+    static VkDeviceSize command_offset(uint32_t objectIndex) { return objectIndex * sizeof(VkDrawIndexedIndirectCommand); }
+
+    // the last frame read back in begin_frame()
+    const CullStats& stats() const { return _stats; }
+
+private:
+    struct FrameBuffers {
+        AllocatedBuffer objects;
+        AllocatedBuffer statsBuffer;
+        TrackedBuffer stats;
+    };
+
+    AllocatedBuffer create_buffer(VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage);
+
+    VkDevice _device;
+    VmaAllocator _allocator;
+    VkSampler _depthSampler;
+
+    VkDescriptorSetLayout _setLayout;
+    VkPipelineLayout _pipelineLayout;
+    VkPipeline _pipeline;
+    DescriptorWriter _writer;
+
+    std::vector<FrameBuffers> _frames;
+    uint32_t _frameSlot = 0;
+    uint32_t _objectCount = 0;
+    bool _resetVisibility = true;
+
+    AllocatedBuffer _visibilityBuffer;
+    AllocatedBuffer _earlyBuffer;
+    AllocatedBuffer _lateBuffer;
+    AllocatedBuffer _finalBuffer;
+    TrackedBuffer _visibility;
+    TrackedBuffer _earlyCommands;
+    TrackedBuffer _lateCommands;
+    TrackedBuffer _finalCommands;
+
+    CullStats _stats {};
+};
+//< draw_culler
+
+}
@@ -0,0 +1,206 @@
+#include "vk_descriptor_buffer.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> descbuf_init
+bool DescriptorBufferAllocator::is_supported(VkPhysicalDevice physicalDevice)
+{
+    uint32_t extensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr);
+    std::vector<VkExtensionProperties> extensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, extensions.data());
+
+    bool hasExtension = std::any_of(extensions.begin(), extensions.end(), [](const VkExtensionProperties& e) {
+        return strcmp(e.extensionName, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME) == 0;
+    });
+    if (!hasExtension) {
+        return false;
+    }
+
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT};
+    VkPhysicalDeviceFeatures2 features = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+    features.pNext = &descriptorBufferFeatures;
+    vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+
+    return descriptorBufferFeatures.descriptorBuffer == VK_TRUE;
+}
+
+void DescriptorBufferAllocator::init(VkDevice device, VkPhysicalDevice physicalDevice, VmaAllocator allocator, VkDeviceSize size)
+{
+    _device = device;
+    _allocator = allocator;
+    _head = 0;
+
+    _props = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT};
+    VkPhysicalDeviceProperties2 props = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+    props.pNext = &_props;
+    vkGetPhysicalDeviceProperties2(physicalDevice, &props);
+
+    //extension entry points are not exported by the loader
+    _vkGetDescriptorSetLayoutSizeEXT = (PFN_vkGetDescriptorSetLayoutSizeEXT)vkGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSizeEXT");
+    _vkGetDescriptorSetLayoutBindingOffsetEXT = (PFN_vkGetDescriptorSetLayoutBindingOffsetEXT)vkGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutBindingOffsetEXT");
+    _vkGetDescriptorEXT = (PFN_vkGetDescriptorEXT)vkGetDeviceProcAddr(device, "vkGetDescriptorEXT");
+    _vkCmdBindDescriptorBuffersEXT = (PFN_vkCmdBindDescriptorBuffersEXT)vkGetDeviceProcAddr(device, "vkCmdBindDescriptorBuffersEXT");
+    _vkCmdSetDescriptorBufferOffsetsEXT = (PFN_vkCmdSetDescriptorBufferOffsetsEXT)vkGetDeviceProcAddr(device, "vkCmdSetDescriptorBufferOffsetsEXT");
+
+    //a single buffer holds both sampler and resource descriptors, so it only
+    //takes one binding slot
+    VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT
+        | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT
+        | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    VmaAllocationCreateInfo vmaallocInfo = {};
+    vmaallocInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+
+    VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &_buffer.buffer, &_buffer.allocation, &_buffer.info));
+    _mapped = (uint8_t*)_buffer.info.pMappedData;
+
+    VkBufferDeviceAddressInfo addressInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+    addressInfo.buffer = _buffer.buffer;
+    _bufferAddress = vkGetBufferDeviceAddress(_device, &addressInfo);
+}
+
+void DescriptorBufferAllocator::destroy()
+{
+    vmaDestroyBuffer(_allocator, _buffer.buffer, _buffer.allocation);
+    _layoutSizes.clear();
+}
+
+void DescriptorBufferAllocator::reset()
+{
+    //the whole frame is retired, so rewinding the head is all it takes
+    _head = 0;
+    _stats.end_frame();
+}
+//< descbuf_init
+
+//> descbuf_alloc
+size_t DescriptorBufferAllocator::descriptor_size(VkDescriptorType type) const
+{
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER: return _props.samplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: return _props.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE: return _props.sampledImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE: return _props.storageImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER: return _props.uniformTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: return _props.storageTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER: return _props.uniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER: return _props.storageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return _props.inputAttachmentDescriptorSize;
+    default:
+        QS_CORE_ERROR("Descriptor type %s is not supported by the descriptor buffer allocator", string_VkDescriptorType(type));
+        return 0;
+    }
+}
+
+VkDeviceSize DescriptorBufferAllocator::layout_size(VkDescriptorSetLayout layout)
+{
+    auto it = _layoutSizes.find(layout);
+    if (it != _layoutSizes.end()) {
+        return it->second;
+    }
+
+    VkDeviceSize size;
+    _vkGetDescriptorSetLayoutSizeEXT(_device, layout, &size);
+    size = get_aligned(size, _props.descriptorBufferOffsetAlignment);
+    _layoutSizes[layout] = size;
+    return size;
+}
+
+TransientDescriptorSet DescriptorBufferAllocator::allocate(VkDescriptorSetLayout layout, DescriptorWriter& writer)
+{
+    VkDeviceSize setSize = layout_size(layout);
+    VkDeviceSize offset = get_aligned(_head, _props.descriptorBufferOffsetAlignment);
+
+    if (offset + setSize > _buffer.info.size) {
+        QS_CORE_FATAL("Descriptor buffer overflow: %llu bytes requested, %llu bytes free",
+            (unsigned long long)setSize, (unsigned long long)(_buffer.info.size - offset));
+        abort();
+    }
+    _head = offset + setSize;
+
+    _stats.sets++;
+    _stats.bytes = _head;
+
+    for (const VkWriteDescriptorSet& write : writer.writes) {
+        VkDeviceSize bindingOffset;
+        _vkGetDescriptorSetLayoutBindingOffsetEXT(_device, layout, write.dstBinding, &bindingOffset);
+
+        if (write.descriptorType < DescriptorUsageStats::TypeCount) {
+            _stats.descriptors[write.descriptorType] += write.descriptorCount;
+        }
+
+        size_t size = descriptor_size(write.descriptorType);
+        uint8_t* dst = _mapped + offset + bindingOffset + write.dstArrayElement * size;
+
+        VkDescriptorGetInfoEXT getInfo = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT};
+        getInfo.type = write.descriptorType;
+
+        VkDescriptorAddressInfoEXT addressInfo = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT};
+
+        switch (write.descriptorType) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            getInfo.data.pSampler = &write.pImageInfo->sampler;
+            break;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            getInfo.data.pCombinedImageSampler = write.pImageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            getInfo.data.pSampledImage = write.pImageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            getInfo.data.pStorageImage = write.pImageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            getInfo.data.pInputAttachmentImage = write.pImageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER: {
+            //buffer descriptors are described by address instead of handle
+            VkBufferDeviceAddressInfo bufferAddress = {.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+            bufferAddress.buffer = write.pBufferInfo->buffer;
+            addressInfo.address = vkGetBufferDeviceAddress(_device, &bufferAddress) + write.pBufferInfo->offset;
+            addressInfo.range = write.pBufferInfo->range;
+            addressInfo.format = VK_FORMAT_UNDEFINED;
+            if (write.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+                getInfo.data.pUniformBuffer = &addressInfo;
+            } else {
+                getInfo.data.pStorageBuffer = &addressInfo;
+            }
+            break;
+        }
+        default:
+            continue;
+        }
+
+        _vkGetDescriptorEXT(_device, &getInfo, size, dst);
+    }
+
+    return TransientDescriptorSet { .set = VK_NULL_HANDLE, .offset = offset };
+}
+
+void DescriptorBufferAllocator::bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+    uint32_t firstSet, std::span<const TransientDescriptorSet> sets)
+{
+    //rebinding the buffer every time is cheap and keeps bind() self contained
+    VkDescriptorBufferBindingInfoEXT bindingInfo = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT};
+    bindingInfo.address = _bufferAddress;
+    bindingInfo.usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+    _vkCmdBindDescriptorBuffersEXT(cmd, 1, &bindingInfo);
+
+    _bufferIndices.assign(sets.size(), 0);
+    _offsets.clear();
+    for (const TransientDescriptorSet& s : sets) {
+        _offsets.push_back(s.offset);
+    }
+
+    _vkCmdSetDescriptorBufferOffsetsEXT(cmd, bindPoint, layout, firstSet, (uint32_t)sets.size(), _bufferIndices.data(), _offsets.data());
+}
+//< descbuf_alloc
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_descriptors.h"
+
+namespace Quasar::Renderer {
+
+//> descriptor_buffer
+// VK_EXT_descriptor_buffer backend for transient descriptors. Descriptors are
+// written with vkGetDescriptorEXT straight into a persistently mapped buffer and
+// bound by offset, there are no pools, set allocations or pool resets.
+class DescriptorBufferAllocator : public TransientDescriptorAllocator {
+public:
+    // true when the device exposes the extension and its descriptorBuffer feature
+    static bool is_supported(VkPhysicalDevice physicalDevice);
+
+    void init(VkDevice device, VkPhysicalDevice physicalDevice, VmaAllocator allocator, VkDeviceSize size);
+
+    TransientDescriptorSet allocate(VkDescriptorSetLayout layout, DescriptorWriter& writer) override;
+    void bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+        uint32_t firstSet, std::span<const TransientDescriptorSet> sets) override;
+    void reset() override;
+    void destroy() override;
+
+    VkDescriptorSetLayoutCreateFlags layout_create_flags() const override { return VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT; }
+    VkPipelineCreateFlags pipeline_create_flags() const override { return VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT; }
+
+    const DescriptorUsageStats& usage() const override { return _stats; }
+
+private:
+    size_t descriptor_size(VkDescriptorType type) const;
+    VkDeviceSize layout_size(VkDescriptorSetLayout layout);
+
+    VkDevice _device;
+    VmaAllocator _allocator;
+    AllocatedBuffer _buffer;
+    VkDeviceAddress _bufferAddress;
+    uint8_t* _mapped;
+    VkDeviceSize _head;
+    DescriptorUsageStats _stats;
+
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT _props;
+    std::unordered_map<VkDescriptorSetLayout, VkDeviceSize> _layoutSizes;
+    std::vector<uint32_t> _bufferIndices;
+    std::vector<VkDeviceSize> _offsets;
+
+    PFN_vkGetDescriptorSetLayoutSizeEXT _vkGetDescriptorSetLayoutSizeEXT;
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT _vkGetDescriptorSetLayoutBindingOffsetEXT;
+    PFN_vkGetDescriptorEXT _vkGetDescriptorEXT;
+    PFN_vkCmdBindDescriptorBuffersEXT _vkCmdBindDescriptorBuffersEXT;
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT _vkCmdSetDescriptorBufferOffsetsEXT;
+};
+//< descriptor_buffer
+
+}
@@ -58,7 +58,7 @@ void DescriptorAllocator::init_pool(VkDevice device, uint32_t maxSets, std::span
 	pool_info.poolSizeCount = (uint32_t)poolSizes.size();
 	pool_info.pPoolSizes = poolSizes.data();
 
-	vkCreateDescriptorPool(device, &pool_info, nullptr, &pool);
+	VK_CHECK(vkCreateDescriptorPool(device, &pool_info, nullptr, &pool));
 }
 
 void DescriptorAllocator::clear_descriptors(VkDevice device)
@@ -87,8 +87,9 @@ VkDescriptorSet DescriptorAllocator::allocate(VkDevice device, VkDescriptorSetLa
 }
 //< descriptor_alloc
 //> write_image
-void DescriptorWriter::write_image(int binding,VkImageView image, VkSampler sampler,  VkImageLayout layout, VkDescriptorType type)
+void DescriptorWriter::write_image(int binding,VkImageView image, VkSampler sampler,  VkImageLayout layout, VkDescriptorType type, uint32_t arrayElement)
 {
+    const VkDescriptorImageInfo* oldInfos = imageInfos.data();
     VkDescriptorImageInfo& info = imageInfos.emplace_back(VkDescriptorImageInfo{
 		.sampler = sampler,
 		.imageView = image,
@@ -98,18 +99,25 @@ void DescriptorWriter::write_image(int binding,VkImageView image, VkSampler samp
 	VkWriteDescriptorSet write = { .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
 
 	write.dstBinding = binding;
-	write.dstSet = VK_NULL_HANDLE; //left empty for now until we need to write it
+	write.dstSet = VK_NULL_HANDLE; //left empty, update_set fills it in
+	write.dstArrayElement = arrayElement;
 	write.descriptorCount = 1;
 	write.descriptorType = type;
 	write.pImageInfo = &info;
 
 	writes.push_back(write);
+	infoIndices.push_back(uint32_t(imageInfos.size() - 1));
+
+	if (imageInfos.data() != oldInfos) {
+		fix_info_pointers();
+	}
 }
 //< write_image
 // 
 //> write_buffer
 void DescriptorWriter::write_buffer(int binding, VkBuffer buffer, size_t size, size_t offset, VkDescriptorType type)
 {
+	const VkDescriptorBufferInfo* oldInfos = bufferInfos.data();
 	VkDescriptorBufferInfo& info = bufferInfos.emplace_back(VkDescriptorBufferInfo{
 		.buffer = buffer,
 		.offset = offset,
@@ -119,20 +127,27 @@ void DescriptorWriter::write_buffer(int binding, VkBuffer buffer, size_t size, s
 	VkWriteDescriptorSet write = {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
 
 	write.dstBinding = binding;
-	write.dstSet = VK_NULL_HANDLE; //left empty for now until we need to write it
+	write.dstSet = VK_NULL_HANDLE; //left empty, update_set fills it in
 	write.descriptorCount = 1;
 	write.descriptorType = type;
 	write.pBufferInfo = &info;
 
 	writes.push_back(write);
+	infoIndices.push_back(uint32_t(bufferInfos.size() - 1));
+
+	if (bufferInfos.data() != oldInfos) {
+		fix_info_pointers();
+	}
 }
 //< write_buffer
 //> writer_end
 void DescriptorWriter::clear()
 {
+    //clear() keeps the capacity, so the vectors act as an arena reused frame to frame
     imageInfos.clear();
     writes.clear();
     bufferInfos.clear();
+    infoIndices.clear();
 }
 
 void DescriptorWriter::update_set(VkDevice device, VkDescriptorSet set)
@@ -143,17 +158,92 @@ void DescriptorWriter::update_set(VkDevice device, VkDescriptorSet set)
 
     vkUpdateDescriptorSets(device, (uint32_t)writes.size(), writes.data(), 0, nullptr);
 }
+
+void DescriptorWriter::fix_info_pointers()
+{
+    for (size_t i = 0; i < writes.size(); i++) {
+        if (writes[i].pImageInfo) {
+            writes[i].pImageInfo = &imageInfos[infoIndices[i]];
+        } else if (writes[i].pBufferInfo) {
+            writes[i].pBufferInfo = &bufferInfos[infoIndices[i]];
+        }
+    }
+}
 //< writer_end
+
+//> update_template
+void DescriptorTemplateWriter::begin_set(VkDescriptorSet set, const DescriptorUpdateTemplate& updateTemplate)
+{
+    uint32_t offset = (uint32_t)arena.size();
+    arena.resize(offset + updateTemplate.descriptorCount, TemplateDescriptor {});
+    sets.push_back(PendingSet { .set = set, .updateTemplate = &updateTemplate, .offset = offset });
+}
+
+TemplateDescriptor& DescriptorTemplateWriter::slot(uint32_t binding, uint32_t arrayElement)
+{
+    assert(!sets.empty() && "begin_set() must be called before writing");
+    const PendingSet& current = sets.back();
+    const std::vector<uint32_t>& offsets = current.updateTemplate->bindingOffsets;
+    assert(binding < offsets.size() && offsets[binding] != INVALID_ID);
+
+    uint32_t index = current.offset + offsets[binding] + arrayElement;
+    assert(index < arena.size());
+    return arena[index];
+}
+
+void DescriptorTemplateWriter::write_image(uint32_t binding, VkImageView image, VkSampler sampler, VkImageLayout layout, uint32_t arrayElement)
+{
+    slot(binding, arrayElement).image = VkDescriptorImageInfo {
+        .sampler = sampler,
+        .imageView = image,
+        .imageLayout = layout
+    };
+}
+
+void DescriptorTemplateWriter::write_buffer(uint32_t binding, VkBuffer buffer, size_t size, size_t offset, uint32_t arrayElement)
+{
+    slot(binding, arrayElement).buffer = VkDescriptorBufferInfo {
+        .buffer = buffer,
+        .offset = offset,
+        .range = size
+    };
+}
+
+void DescriptorTemplateWriter::write_texel_buffer(uint32_t binding, VkBufferView view, uint32_t arrayElement)
+{
+    slot(binding, arrayElement).texelBuffer = view;
+}
+
+void DescriptorTemplateWriter::update(VkDevice device)
+{
+    for (const PendingSet& pending : sets) {
+        vkUpdateDescriptorSetWithTemplate(device, pending.set, pending.updateTemplate->handle, arena.data() + pending.offset);
+    }
+}
+
+void DescriptorTemplateWriter::clear()
+{
+    arena.clear();
+    sets.clear();
+}
+//< update_template
 //> growpool_2
-void DescriptorAllocatorGrowable::init(VkDevice device, uint32_t maxSets, std::span<PoolSizeRatio> poolRatios)
+void DescriptorAllocatorGrowable::init(VkDevice device, uint32_t maxSets, std::span<PoolSizeRatio> poolRatios, const DescriptorLayoutCache* cache)
 {
     ratios.clear();
     
     for (auto r : poolRatios) {
         ratios.push_back(r);
     }
+    baseRatios = ratios;
+
+    layoutCache = cache;
+    stats = {};
+    untrackedLayouts = false;
+    tunedRatios = false;
 	
     VkDescriptorPool newPool = create_pool(device, maxSets, poolRatios);
+    poolSets = maxSets;
 
     setsPerPool = maxSets * 1.5; //grow it next allocation
 
@@ -162,6 +252,31 @@ void DescriptorAllocatorGrowable::init(VkDevice device, uint32_t maxSets, std::s
 
 void DescriptorAllocatorGrowable::clear_pools(VkDevice device)
 { 
+    stats.end_frame();
+
+    // a frame that fit into one pool is reset with a single call. When it spilled
+    // into more pools, merge them into one pool sized from the high-water marks so
+    // the next frames are back to a single reset. A single pool far larger than
+    // the frames need, such as the initial guess, is replaced the same way
+    bool canTune = layoutCache != nullptr && !untrackedLayouts && stats.maxSets > 0;
+    if (canTune) {
+        std::vector<PoolSizeRatio> tuned = tune_ratios();
+        uint32_t setCount = stats.maxSets + stats.maxSets / 4;
+
+        bool spilled = readyPools.size() + fullPools.size() > 1;
+        if (spilled || over_allocated(tuned, setCount)) {
+            destroy_pools(device);
+            ratios = std::move(tuned);
+            tunedRatios = true;
+
+            readyPools.push_back(create_pool(device, setCount, ratios));
+            poolSets = setCount;
+
+            setsPerPool = std::min<uint32_t>(setCount * 1.5, 4092);
+            return;
+        }
+    }
+
     for (auto p : readyPools) {
         vkResetDescriptorPool(device, p, 0);
     }
@@ -172,6 +287,43 @@ void DescriptorAllocatorGrowable::clear_pools(VkDevice device)
     fullPools.clear();
 }
 
+std::vector<DescriptorAllocatorGrowable::PoolSizeRatio> DescriptorAllocatorGrowable::tune_ratios() const
+{
+    // never drop a type we were told about completely, a frame that suddenly
+    // needs it should still find a few descriptors
+    constexpr float MinRatio = 0.1f;
+
+    std::vector<PoolSizeRatio> tuned;
+    for (uint32_t type = 0; type < DescriptorUsageStats::TypeCount; type++) {
+        bool isBase = std::any_of(baseRatios.begin(), baseRatios.end(), [&](const PoolSizeRatio& r) { return r.type == type; });
+        uint32_t used = stats.maxDescriptors[type];
+        if (used == 0 && !isBase) {
+            continue;
+        }
+
+        float observed = float(used) / float(stats.maxSets);
+        tuned.push_back(PoolSizeRatio { .type = (VkDescriptorType)type, .ratio = std::max(observed, MinRatio) });
+    }
+    return tuned;
+}
+
+bool DescriptorAllocatorGrowable::over_allocated(std::span<const PoolSizeRatio> tuned, uint32_t setCount) const
+{
+    // twice what the tuned pool would hold, small enough differences aren't
+    // worth a new pool and the high-water marks only grow
+    if (poolSets > 2 * setCount) {
+        return true;
+    }
+    for (const PoolSizeRatio& current : ratios) {
+        auto wanted = std::find_if(tuned.begin(), tuned.end(), [&](const PoolSizeRatio& r) { return r.type == current.type; });
+        float wantedCount = wanted == tuned.end() ? 0.f : wanted->ratio * setCount;
+        if (current.ratio * poolSets > 2.f * wantedCount + 1.f) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void DescriptorAllocatorGrowable::destroy_pools(VkDevice device)
 {
 	for (auto p : readyPools) {
@@ -212,7 +364,7 @@ VkDescriptorPool DescriptorAllocatorGrowable::create_pool(VkDevice device, uint3
 	for (PoolSizeRatio ratio : poolRatios) {
 		poolSizes.push_back(VkDescriptorPoolSize{
 			.type = ratio.type,
-			.descriptorCount = uint32_t(ratio.ratio * setCount)
+			.descriptorCount = std::max(uint32_t(ratio.ratio * setCount), 1u)
 		});
 	}
 
@@ -224,7 +376,7 @@ VkDescriptorPool DescriptorAllocatorGrowable::create_pool(VkDevice device, uint3
 	pool_info.pPoolSizes = poolSizes.data();
 
 	VkDescriptorPool newPool;
-	vkCreateDescriptorPool(device, &pool_info, nullptr, &newPool);
+	VK_CHECK(vkCreateDescriptorPool(device, &pool_info, nullptr, &newPool));
     return newPool;
 }
 //< growpool_1
@@ -253,12 +405,364 @@ VkDescriptorSet DescriptorAllocatorGrowable::allocate(VkDevice device, VkDescrip
         poolToUse = get_pool(device);
         allocInfo.descriptorPool = poolToUse;
 
-       VK_CHECK( vkAllocateDescriptorSets(device, &allocInfo, &ds));
+        result = vkAllocateDescriptorSets(device, &allocInfo, &ds);
+
+        //the tuned ratios starved a type this frame needs, go back to the original ones
+        if (result == VK_ERROR_OUT_OF_POOL_MEMORY && tunedRatios) {
+            QS_CORE_WARN("Descriptor pool ratios were tuned too tight, restoring the defaults");
+            fullPools.push_back(poolToUse);
+            ratios = baseRatios;
+            tunedRatios = false;
+
+            poolToUse = create_pool(device, setsPerPool, ratios);
+            poolSets = setsPerPool;
+            allocInfo.descriptorPool = poolToUse;
+            result = vkAllocateDescriptorSets(device, &allocInfo, &ds);
+        }
+        VK_CHECK(result);
     }
   
     readyPools.push_back(poolToUse);
+
+    stats.sets++;
+    const DescriptorLayoutCache::DescriptorLayoutInfo* layoutInfo = layoutCache ? layoutCache->get_layout_info(layout) : nullptr;
+    if (layoutInfo) {
+        stats.record_set(layoutInfo->bindings);
+    } else {
+        untrackedLayouts = true;
+    }
     return ds;
 }
 //< growpool_3
 
-}
\ No newline at end of file
+//> descriptor_usage
+void DescriptorUsageStats::record_set(std::span<const VkDescriptorSetLayoutBinding> bindings)
+{
+    for (const VkDescriptorSetLayoutBinding& b : bindings) {
+        if (b.descriptorType < TypeCount) {
+            descriptors[b.descriptorType] += b.descriptorCount;
+        }
+    }
+}
+
+void DescriptorUsageStats::end_frame()
+{
+    maxSets = std::max(maxSets, sets);
+    maxBytes = std::max(maxBytes, bytes);
+    for (uint32_t i = 0; i < TypeCount; i++) {
+        maxDescriptors[i] = std::max(maxDescriptors[i], descriptors[i]);
+    }
+
+    sets = 0;
+    bytes = 0;
+    descriptors.fill(0);
+}
+//< descriptor_usage
+
+//> transient_descriptors
+void PoolTransientDescriptorAllocator::init(VkDevice device, uint32_t initialSets, std::span<DescriptorAllocatorGrowable::PoolSizeRatio> poolRatios,
+    DescriptorLayoutCache* layoutCache)
+{
+    _device = device;
+    _layoutCache = layoutCache;
+    _pools.init(device, initialSets, poolRatios, layoutCache);
+}
+
+TransientDescriptorSet PoolTransientDescriptorAllocator::allocate(VkDescriptorSetLayout layout, DescriptorWriter& writer)
+{
+    VkDescriptorSet set = _pools.allocate(_device, layout);
+
+    //a template writes every descriptor of the set, so it only replaces the writes
+    //when they cover the whole layout. Partial writes go through vkUpdateDescriptorSets
+    const DescriptorUpdateTemplate* updateTemplate = nullptr;
+    if (_layoutCache && _layoutCache->get_layout_info(layout)) {
+        updateTemplate = &_layoutCache->get_update_template(layout);
+        uint32_t written = 0;
+        for (const VkWriteDescriptorSet& write : writer.writes) {
+            written += write.descriptorCount;
+        }
+        if (written != updateTemplate->descriptorCount) {
+            updateTemplate = nullptr;
+        }
+    }
+
+    if (!updateTemplate) {
+        writer.update_set(_device, set);
+        return TransientDescriptorSet { .set = set, .offset = 0 };
+    }
+
+    _templateWriter.clear();
+    _templateWriter.begin_set(set, *updateTemplate);
+    for (const VkWriteDescriptorSet& write : writer.writes) {
+        if (write.pBufferInfo) {
+            _templateWriter.write_buffer(write.dstBinding, write.pBufferInfo->buffer, write.pBufferInfo->range,
+                write.pBufferInfo->offset, write.dstArrayElement);
+        } else {
+            _templateWriter.write_image(write.dstBinding, write.pImageInfo->imageView, write.pImageInfo->sampler,
+                write.pImageInfo->imageLayout, write.dstArrayElement);
+        }
+    }
+    _templateWriter.update(_device);
+    return TransientDescriptorSet { .set = set, .offset = 0 };
+}
+
+void PoolTransientDescriptorAllocator::bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+    uint32_t firstSet, std::span<const TransientDescriptorSet> sets)
+{
+    _bindScratch.clear();
+    for (const TransientDescriptorSet& s : sets) {
+        _bindScratch.push_back(s.set);
+    }
+    vkCmdBindDescriptorSets(cmd, bindPoint, layout, firstSet, (uint32_t)_bindScratch.size(), _bindScratch.data(), 0, nullptr);
+}
+
+void PoolTransientDescriptorAllocator::reset()
+{
+    _pools.clear_pools(_device);
+}
+
+void PoolTransientDescriptorAllocator::destroy()
+{
+    _pools.destroy_pools(_device);
+}
+//< transient_descriptors
+
+//> layout_cache
+void DescriptorLayoutCache::init(VkDevice newDevice)
+{
+    device = newDevice;
+}
+
+void DescriptorLayoutCache::cleanup()
+{
+    for (auto& [layout, updateTemplate] : updateTemplates) {
+        vkDestroyDescriptorUpdateTemplate(device, updateTemplate.handle, nullptr);
+    }
+    updateTemplates.clear();
+
+    for (auto& [info, layout] : pipelineLayoutCache) {
+        vkDestroyPipelineLayout(device, layout, nullptr);
+    }
+    pipelineLayoutCache.clear();
+
+    for (auto& [info, layout] : layoutCache) {
+        vkDestroyDescriptorSetLayout(device, layout, nullptr);
+    }
+    layoutCache.clear();
+    layoutInfos.clear();
+}
+
+VkDescriptorSetLayout DescriptorLayoutCache::create_descriptor_layout(std::span<const VkDescriptorSetLayoutBinding> bindings,
+    std::span<const VkDescriptorBindingFlags> bindingFlags, VkDescriptorSetLayoutCreateFlags flags)
+{
+    assert(bindingFlags.empty() || bindingFlags.size() == bindings.size());
+
+    DescriptorLayoutInfo layoutInfo;
+    layoutInfo.flags = flags;
+    layoutInfo.bindings.assign(bindings.begin(), bindings.end());
+    layoutInfo.bindingFlags.assign(bindingFlags.begin(), bindingFlags.end());
+
+    //sort the bindings (and their flags along with them) so the lookup is order independent
+    std::vector<uint32_t> order(bindings.size());
+    for (uint32_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return bindings[a].binding < bindings[b].binding;
+    });
+    layoutInfo.immutableSamplerOffsets.assign(bindings.size(), INVALID_ID);
+    for (uint32_t i = 0; i < order.size(); i++) {
+        const VkDescriptorSetLayoutBinding& binding = bindings[order[i]];
+        layoutInfo.bindings[i] = binding;
+        if (!bindingFlags.empty()) {
+            layoutInfo.bindingFlags[i] = bindingFlags[order[i]];
+        }
+
+        //immutable samplers are part of the key, copied so the caller's array can go away
+        bool samplerType = binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER
+            || binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        if (samplerType && binding.pImmutableSamplers) {
+            layoutInfo.immutableSamplerOffsets[i] = (uint32_t)layoutInfo.immutableSamplers.size();
+            layoutInfo.immutableSamplers.insert(layoutInfo.immutableSamplers.end(),
+                binding.pImmutableSamplers, binding.pImmutableSamplers + binding.descriptorCount);
+        }
+    }
+    //pointed at the copies once they are all in, moving the info into the cache
+    //moves the vector's storage along with it so the pointers stay valid
+    for (uint32_t i = 0; i < order.size(); i++) {
+        uint32_t offset = layoutInfo.immutableSamplerOffsets[i];
+        layoutInfo.bindings[i].pImmutableSamplers = offset == INVALID_ID ? nullptr : layoutInfo.immutableSamplers.data() + offset;
+    }
+
+    auto it = layoutCache.find(layoutInfo);
+    if (it != layoutCache.end()) {
+        return it->second;
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO};
+    flagsInfo.bindingCount = (uint32_t)layoutInfo.bindingFlags.size();
+    flagsInfo.pBindingFlags = layoutInfo.bindingFlags.data();
+
+    VkDescriptorSetLayoutCreateInfo info = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    info.pNext = layoutInfo.bindingFlags.empty() ? nullptr : &flagsInfo;
+    info.flags = flags;
+    info.bindingCount = (uint32_t)layoutInfo.bindings.size();
+    info.pBindings = layoutInfo.bindings.data();
+
+    VkDescriptorSetLayout layout;
+    VK_CHECK(vkCreateDescriptorSetLayout(device, &info, nullptr, &layout));
+
+    auto inserted = layoutCache.emplace(std::move(layoutInfo), layout).first;
+    layoutInfos[layout] = &inserted->first;
+    return layout;
+}
+
+VkPipelineLayout DescriptorLayoutCache::create_pipeline_layout(std::span<const VkDescriptorSetLayout> setLayouts,
+    std::span<const VkPushConstantRange> pushConstantRanges)
+{
+    PipelineLayoutInfo layoutInfo;
+    layoutInfo.setLayouts.assign(setLayouts.begin(), setLayouts.end());
+    layoutInfo.pushConstantRanges.assign(pushConstantRanges.begin(), pushConstantRanges.end());
+
+    auto it = pipelineLayoutCache.find(layoutInfo);
+    if (it != pipelineLayoutCache.end()) {
+        return it->second;
+    }
+
+    VkPipelineLayoutCreateInfo info = vkinit::pipeline_layout_create_info();
+    info.setLayoutCount = (uint32_t)layoutInfo.setLayouts.size();
+    info.pSetLayouts = layoutInfo.setLayouts.data();
+    info.pushConstantRangeCount = (uint32_t)layoutInfo.pushConstantRanges.size();
+    info.pPushConstantRanges = layoutInfo.pushConstantRanges.data();
+
+    VkPipelineLayout layout;
+    VK_CHECK(vkCreatePipelineLayout(device, &info, nullptr, &layout));
+
+    pipelineLayoutCache.emplace(std::move(layoutInfo), layout);
+    return layout;
+}
+
+const DescriptorLayoutCache::DescriptorLayoutInfo* DescriptorLayoutCache::get_layout_info(VkDescriptorSetLayout layout) const
+{
+    auto it = layoutInfos.find(layout);
+    return it == layoutInfos.end() ? nullptr : it->second;
+}
+
+const DescriptorUpdateTemplate& DescriptorLayoutCache::get_update_template(VkDescriptorSetLayout layout)
+{
+    auto it = updateTemplates.find(layout);
+    if (it != updateTemplates.end()) {
+        return it->second;
+    }
+
+    const DescriptorLayoutInfo* info = get_layout_info(layout);
+    assert(info && "update templates are only built for layouts owned by the cache");
+
+    DescriptorUpdateTemplate updateTemplate;
+    if (!info->bindings.empty()) {
+        updateTemplate.bindingOffsets.assign(info->bindings.back().binding + 1, INVALID_ID);
+    }
+
+    //one entry per binding, all reading from a flat TemplateDescriptor array
+    std::vector<VkDescriptorUpdateTemplateEntry> entries;
+    for (const VkDescriptorSetLayoutBinding& b : info->bindings) {
+        //immutable samplers are baked into the layout and must not be written
+        if (b.descriptorCount == 0 || (b.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER && b.pImmutableSamplers)) {
+            continue;
+        }
+        if (b.descriptorType >= DescriptorUsageStats::TypeCount) {
+            QS_CORE_ERROR("Descriptor type %s can't be written through an update template", string_VkDescriptorType(b.descriptorType));
+            continue;
+        }
+
+        entries.push_back(VkDescriptorUpdateTemplateEntry {
+            .dstBinding = b.binding,
+            .dstArrayElement = 0,
+            .descriptorCount = b.descriptorCount,
+            .descriptorType = b.descriptorType,
+            .offset = updateTemplate.descriptorCount * sizeof(TemplateDescriptor),
+            .stride = sizeof(TemplateDescriptor),
+        });
+        updateTemplate.bindingOffsets[b.binding] = updateTemplate.descriptorCount;
+        updateTemplate.descriptorCount += b.descriptorCount;
+    }
+
+    VkDescriptorUpdateTemplateCreateInfo createInfo = {.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO};
+    createInfo.descriptorUpdateEntryCount = (uint32_t)entries.size();
+    createInfo.pDescriptorUpdateEntries = entries.data();
+    createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    createInfo.descriptorSetLayout = layout;
+
+    VK_CHECK(vkCreateDescriptorUpdateTemplate(device, &createInfo, nullptr, &updateTemplate.handle));
+
+    return updateTemplates[layout] = std::move(updateTemplate);
+}
+
+bool DescriptorLayoutCache::DescriptorLayoutInfo::operator==(const DescriptorLayoutInfo& other) const
+{
+    if (flags != other.flags || bindings.size() != other.bindings.size() || bindingFlags != other.bindingFlags
+        || immutableSamplers != other.immutableSamplers || immutableSamplerOffsets != other.immutableSamplerOffsets) {
+        return false;
+    }
+    for (size_t i = 0; i < bindings.size(); i++) {
+        const VkDescriptorSetLayoutBinding& a = bindings[i];
+        const VkDescriptorSetLayoutBinding& b = other.bindings[i];
+        if (a.binding != b.binding || a.descriptorType != b.descriptorType
+            || a.descriptorCount != b.descriptorCount || a.stageFlags != b.stageFlags) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t DescriptorLayoutCache::DescriptorLayoutInfo::hash() const
+{
+    size_t result = std::hash<size_t>()(bindings.size()) ^ std::hash<uint32_t>()(flags);
+
+    for (size_t i = 0; i < bindings.size(); i++) {
+        const VkDescriptorSetLayoutBinding& b = bindings[i];
+        //pack the binding data into a single int64. Not fully correct but its ok
+        size_t binding_hash = (size_t)b.binding | (size_t)b.descriptorType << 8 | (size_t)b.descriptorCount << 16 | (size_t)b.stageFlags << 40;
+        if (!bindingFlags.empty()) {
+            binding_hash ^= (size_t)bindingFlags[i] << 32;
+        }
+        //shuffle the packed binding data and xor it with the main hash
+        result ^= std::hash<size_t>()(binding_hash) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+    for (VkSampler sampler : immutableSamplers) {
+        result ^= std::hash<VkSampler>()(sampler) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+
+    return result;
+}
+
+bool DescriptorLayoutCache::PipelineLayoutInfo::operator==(const PipelineLayoutInfo& other) const
+{
+    if (setLayouts != other.setLayouts || pushConstantRanges.size() != other.pushConstantRanges.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < pushConstantRanges.size(); i++) {
+        const VkPushConstantRange& a = pushConstantRanges[i];
+        const VkPushConstantRange& b = other.pushConstantRanges[i];
+        if (a.stageFlags != b.stageFlags || a.offset != b.offset || a.size != b.size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t DescriptorLayoutCache::PipelineLayoutInfo::hash() const
+{
+    size_t result = std::hash<size_t>()(setLayouts.size());
+    for (VkDescriptorSetLayout layout : setLayouts) {
+        result ^= std::hash<VkDescriptorSetLayout>()(layout) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+    for (const VkPushConstantRange& range : pushConstantRanges) {
+        size_t range_hash = (size_t)range.stageFlags | (size_t)range.offset << 16 | (size_t)range.size << 40;
+        result ^= std::hash<size_t>()(range_hash) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+    return result;
+}
+//< layout_cache
+
+}
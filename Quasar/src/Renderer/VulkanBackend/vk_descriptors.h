@@ -4,9 +4,13 @@
 #include "vk_types.h"
 #include <deque>
 #include <span>
+#include <array>
+#include <unordered_map>
 
 namespace Quasar::Renderer {
 
+class DescriptorLayoutCache;
+
 //> descriptor_layout
 struct DescriptorLayoutBuilder {
 
@@ -19,18 +23,76 @@ struct DescriptorLayoutBuilder {
 //< descriptor_layout
 // 
 //> writer
+// The infos live in plain vectors that keep their capacity across clear(), so a
+// writer reused every frame stops allocating once it has seen its largest frame.
 struct DescriptorWriter {
-    std::deque<VkDescriptorImageInfo> imageInfos;
-    std::deque<VkDescriptorBufferInfo> bufferInfos;
+    std::vector<VkDescriptorImageInfo> imageInfos;
+    std::vector<VkDescriptorBufferInfo> bufferInfos;
     std::vector<VkWriteDescriptorSet> writes;
 
-    void write_image(int binding,VkImageView image,VkSampler sampler , VkImageLayout layout, VkDescriptorType type);
+    void write_image(int binding,VkImageView image,VkSampler sampler , VkImageLayout layout, VkDescriptorType type, uint32_t arrayElement = 0);
     void write_buffer(int binding,VkBuffer buffer,size_t size, size_t offset,VkDescriptorType type); 
 
     void clear();
     void update_set(VkDevice device, VkDescriptorSet set);
+
+private:
+    // repoints the writes after an info vector moved to a new allocation
+    void fix_info_pointers();
+
+    // index into imageInfos or bufferInfos for every write, parallel to writes
+    std::vector<uint32_t> infoIndices;
 };
 //< writer
+
+//> update_template
+// One descriptor worth of template data. Every entry of a template uses this as
+// its stride, so the data for a set is a flat array in binding order.
+union TemplateDescriptor {
+    VkDescriptorImageInfo image;
+    VkDescriptorBufferInfo buffer;
+    VkBufferView texelBuffer;
+};
+
+// VkDescriptorUpdateTemplate covering every binding of one set layout, owned by
+// the DescriptorLayoutCache
+struct DescriptorUpdateTemplate {
+    VkDescriptorUpdateTemplate handle = VK_NULL_HANDLE;
+    // TemplateDescriptors one set takes
+    uint32_t descriptorCount = 0;
+    // first TemplateDescriptor of each binding, indexed by binding number.
+    // INVALID_ID for binding numbers the layout skips
+    std::vector<uint32_t> bindingOffsets;
+};
+
+// Writes many sets through their update templates. The data of every set is
+// packed into one arena that is kept across frames, and update() issues one
+// vkUpdateDescriptorSetWithTemplate per set with no VkWriteDescriptorSet parsing.
+// A template writes every descriptor of the set, so all of them must be written
+// between begin_set() and update().
+struct DescriptorTemplateWriter {
+    void begin_set(VkDescriptorSet set, const DescriptorUpdateTemplate& updateTemplate);
+
+    void write_image(uint32_t binding, VkImageView image, VkSampler sampler, VkImageLayout layout, uint32_t arrayElement = 0);
+    void write_buffer(uint32_t binding, VkBuffer buffer, size_t size, size_t offset, uint32_t arrayElement = 0);
+    void write_texel_buffer(uint32_t binding, VkBufferView view, uint32_t arrayElement = 0);
+
+    void update(VkDevice device);
+    void clear();
+
+private:
+    struct PendingSet {
+        VkDescriptorSet set;
+        const DescriptorUpdateTemplate* updateTemplate;
+        uint32_t offset;
+    };
+
+    TemplateDescriptor& slot(uint32_t binding, uint32_t arrayElement);
+
+    std::vector<TemplateDescriptor> arena;
+    std::vector<PendingSet> sets;
+};
+//< update_template
 // 
 //> descriptor_allocator
 struct DescriptorAllocator {
@@ -50,6 +112,25 @@ struct DescriptorAllocator {
 };
 //< descriptor_allocator
 
+//> descriptor_usage
+// how many sets and descriptors of each type were allocated between two resets
+struct DescriptorUsageStats {
+    static constexpr uint32_t TypeCount = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 1;
+
+    uint32_t sets = 0;
+    std::array<uint32_t, TypeCount> descriptors {};
+    VkDeviceSize bytes = 0;
+
+    // high-water marks over every frame so far
+    uint32_t maxSets = 0;
+    std::array<uint32_t, TypeCount> maxDescriptors {};
+    VkDeviceSize maxBytes = 0;
+
+    void record_set(std::span<const VkDescriptorSetLayoutBinding> bindings);
+    void end_frame();
+};
+//< descriptor_usage
+
 //> descriptor_allocator_grow
 struct DescriptorAllocatorGrowable {
 public:
@@ -58,21 +139,158 @@ public:
 		float ratio;
 	};
 
-	void init(VkDevice device, uint32_t initialSets, std::span<PoolSizeRatio> poolRatios);
+	// with a layout cache the allocator can see how many descriptors each set takes,
+	// and uses the recorded high-water marks to size and tune its pools
+	void init(VkDevice device, uint32_t initialSets, std::span<PoolSizeRatio> poolRatios, const DescriptorLayoutCache* layoutCache = nullptr);
 	void clear_pools(VkDevice device);
 	void destroy_pools(VkDevice device);
 
     VkDescriptorSet allocate(VkDevice device, VkDescriptorSetLayout layout, void* pNext = nullptr);
+
+	const DescriptorUsageStats& usage() const { return stats; }
 private:
 	VkDescriptorPool get_pool(VkDevice device);
 	VkDescriptorPool create_pool(VkDevice device, uint32_t setCount, std::span<PoolSizeRatio> poolRatios);
+	// ratios from the high-water marks
+	std::vector<PoolSizeRatio> tune_ratios() const;
+	// the single pool holds far more than tuned ratios for setCount sets would
+	bool over_allocated(std::span<const PoolSizeRatio> tuned, uint32_t setCount) const;
 
 	std::vector<PoolSizeRatio> ratios;
+	// the ratios init() was given, tuning never drops a type below these entirely
+	std::vector<PoolSizeRatio> baseRatios;
 	std::vector<VkDescriptorPool> fullPools;
 	std::vector<VkDescriptorPool> readyPools;
 	uint32_t setsPerPool;
+	// sets of the pool created last, what over_allocated() measures against
+	uint32_t poolSets = 0;
 
+	const DescriptorLayoutCache* layoutCache = nullptr;
+	DescriptorUsageStats stats;
+	// set when a layout the cache doesn't know was allocated, the stats are
+	// incomplete then and must not be used for tuning
+	bool untrackedLayouts = false;
+	bool tunedRatios = false;
 };
 //< descriptor_allocator_grow
 
+//> transient_descriptors
+// a descriptor set handed out by a TransientDescriptorAllocator. Depending on the
+// backend it is either a real set or an offset into a descriptor buffer
+struct TransientDescriptorSet {
+    VkDescriptorSet set;
+    VkDeviceSize offset;
+};
+
+// Descriptors that only live for one frame. The allocator is reset wholesale once
+// the gpu is done with the frame, individual sets are never freed.
+class TransientDescriptorAllocator {
+public:
+    virtual ~TransientDescriptorAllocator() = default;
+
+    // allocates a set for the layout and fills it with the writer's descriptors
+    virtual TransientDescriptorSet allocate(VkDescriptorSetLayout layout, DescriptorWriter& writer) = 0;
+    virtual void bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+        uint32_t firstSet, std::span<const TransientDescriptorSet> sets) = 0;
+
+    // every set handed out since the last reset becomes invalid
+    virtual void reset() = 0;
+    virtual void destroy() = 0;
+
+    // flags the set layouts and pipelines used with this allocator must be created with
+    virtual VkDescriptorSetLayoutCreateFlags layout_create_flags() const = 0;
+    virtual VkPipelineCreateFlags pipeline_create_flags() const = 0;
+
+    virtual const DescriptorUsageStats& usage() const = 0;
+};
+
+// fallback backend, descriptor pools through DescriptorAllocatorGrowable. Sets of
+// layouts owned by the layoutCache are filled through their update templates
+class PoolTransientDescriptorAllocator : public TransientDescriptorAllocator {
+public:
+    void init(VkDevice device, uint32_t initialSets, std::span<DescriptorAllocatorGrowable::PoolSizeRatio> poolRatios,
+        DescriptorLayoutCache* layoutCache = nullptr);
+
+    TransientDescriptorSet allocate(VkDescriptorSetLayout layout, DescriptorWriter& writer) override;
+    void bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+        uint32_t firstSet, std::span<const TransientDescriptorSet> sets) override;
+    void reset() override;
+    void destroy() override;
+
+    VkDescriptorSetLayoutCreateFlags layout_create_flags() const override { return 0; }
+    VkPipelineCreateFlags pipeline_create_flags() const override { return 0; }
+
+    const DescriptorUsageStats& usage() const override { return _pools.usage(); }
+
+private:
+    VkDevice _device;
+    DescriptorAllocatorGrowable _pools;
+    DescriptorLayoutCache* _layoutCache = nullptr;
+    DescriptorTemplateWriter _templateWriter;
+    std::vector<VkDescriptorSet> _bindScratch;
+};
+//< transient_descriptors
+
+//> layout_cache
+// Deduplicates descriptor set layouts and pipeline layouts. Two requests with the
+// same bindings (order independent) get the same handle back, so pipelines built
+// from reflected shaders share layouts and stay compatible for set binding.
+class DescriptorLayoutCache {
+public:
+    struct DescriptorLayoutInfo {
+        // bindings are kept sorted by binding number
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+        // per-binding VkDescriptorBindingFlags, parallel to bindings. Empty when unused
+        std::vector<VkDescriptorBindingFlags> bindingFlags;
+        // the immutable samplers of every binding back to back, the bindings'
+        // pImmutableSamplers point in here
+        std::vector<VkSampler> immutableSamplers;
+        // first of each binding's immutable samplers, parallel to bindings.
+        // INVALID_ID for bindings without any
+        std::vector<uint32_t> immutableSamplerOffsets;
+        VkDescriptorSetLayoutCreateFlags flags = 0;
+
+        bool operator==(const DescriptorLayoutInfo& other) const;
+        size_t hash() const;
+    };
+
+    void init(VkDevice newDevice);
+    void cleanup();
+
+    VkDescriptorSetLayout create_descriptor_layout(std::span<const VkDescriptorSetLayoutBinding> bindings,
+        std::span<const VkDescriptorBindingFlags> bindingFlags = {}, VkDescriptorSetLayoutCreateFlags flags = 0);
+    VkPipelineLayout create_pipeline_layout(std::span<const VkDescriptorSetLayout> setLayouts,
+        std::span<const VkPushConstantRange> pushConstantRanges);
+
+    // bindings a cached layout was created with, nullptr for layouts the cache does not own
+    const DescriptorLayoutInfo* get_layout_info(VkDescriptorSetLayout layout) const;
+
+    // update template for a cached layout, built the first time it is asked for
+    const DescriptorUpdateTemplate& get_update_template(VkDescriptorSetLayout layout);
+
+private:
+    struct DescriptorLayoutHash {
+        size_t operator()(const DescriptorLayoutInfo& k) const { return k.hash(); }
+    };
+
+    struct PipelineLayoutInfo {
+        std::vector<VkDescriptorSetLayout> setLayouts;
+        std::vector<VkPushConstantRange> pushConstantRanges;
+
+        bool operator==(const PipelineLayoutInfo& other) const;
+        size_t hash() const;
+    };
+
+    struct PipelineLayoutHash {
+        size_t operator()(const PipelineLayoutInfo& k) const { return k.hash(); }
+    };
+
+    VkDevice device = VK_NULL_HANDLE;
+    std::unordered_map<DescriptorLayoutInfo, VkDescriptorSetLayout, DescriptorLayoutHash> layoutCache;
+    std::unordered_map<VkDescriptorSetLayout, const DescriptorLayoutInfo*> layoutInfos;
+    std::unordered_map<PipelineLayoutInfo, VkPipelineLayout, PipelineLayoutHash> pipelineLayoutCache;
+    std::unordered_map<VkDescriptorSetLayout, DescriptorUpdateTemplate> updateTemplates;
+};
+//< layout_cache
+
 }
\ No newline at end of file
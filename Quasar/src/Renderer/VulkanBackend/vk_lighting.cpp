@@ -0,0 +1,167 @@
+#include "vk_lighting.h"
+#include "vk_initializers.h"
+#include "vk_pipelines.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+// mirrors the push constants of Builtin.LightCluster.comp.glsl
+struct LightClusterPushConstants {
+    VkDeviceAddress sceneData;
+    VkDeviceAddress stats;
+    glm::vec2 screenSize;
+    float znear;
+    float zfar;
+};
+
+//> lighting_init
+AllocatedBuffer ClusteredLighting::create_buffer(VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage)
+{
+    VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = size;
+    bufferInfo.usage = usage | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    VmaAllocationCreateInfo vmaallocInfo = {};
+    vmaallocInfo.usage = memoryUsage;
+    if (memoryUsage != VMA_MEMORY_USAGE_GPU_ONLY) {
+        vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    }
+
+    AllocatedBuffer newBuffer;
+    VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &newBuffer.buffer, &newBuffer.allocation, &newBuffer.info));
+    return newBuffer;
+}
+
+VkDeviceAddress ClusteredLighting::buffer_address(VkBuffer buffer)
+{
+    VkBufferDeviceAddressInfo addressInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+    addressInfo.buffer = buffer;
+    return vkGetBufferDeviceAddress(_device, &addressInfo);
+}
+
+void ClusteredLighting::init(VkDevice device, VmaAllocator allocator, DescriptorLayoutCache& layoutCache, uint32_t framesInFlight)
+{
+    _device = device;
+    _allocator = allocator;
+
+    _frames.resize(framesInFlight);
+    for (FrameBuffers& frame : _frames) {
+        //written by the cpu every frame
+        frame.lights = create_buffer(MaxLights * sizeof(GPULight), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU);
+        frame.lightsAddress = buffer_address(frame.lights.buffer);
+        //counted on the gpu, read back when the slot comes around again
+        frame.statsBuffer = create_buffer(sizeof(LightClusterStats), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU);
+        frame.statsAddress = buffer_address(frame.statsBuffer.buffer);
+        memset(frame.statsBuffer.info.pMappedData, 0, sizeof(LightClusterStats));
+        vmaFlushAllocation(_allocator, frame.statsBuffer.allocation, 0, VK_WHOLE_SIZE);
+        frame.stats.buffer = frame.statsBuffer.buffer;
+    }
+
+    //every frame rebuilds the grid before shading, the render graph orders the
+    //accesses, so one copy does
+    _gridBuffer = create_buffer(ClusterCount * sizeof(glm::uvec2), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_ONLY);
+    _indexBuffer = create_buffer(MaxLightIndices * sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_ONLY);
+    _gridAddress = buffer_address(_gridBuffer.buffer);
+    _indexAddress = buffer_address(_indexBuffer.buffer);
+    _clusterGrid.buffer = _gridBuffer.buffer;
+    _lightIndices.buffer = _indexBuffer.buffer;
+
+    VkShaderModule clusterShader;
+    if (!vkutil::load_shader_module("Assets/shaders/Builtin.LightCluster.comp.spv", _device, &clusterShader)) {
+        QS_CORE_ERROR("Error when building the light cluster shader module");
+    }
+
+    //everything is reached through buffer addresses, so no descriptor sets
+    VkPushConstantRange pushConstants = { .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(LightClusterPushConstants) };
+    _pipelineLayout = layoutCache.create_pipeline_layout({}, std::span(&pushConstants, 1));
+
+    VkComputePipelineCreateInfo computePipelineCreateInfo = {.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    computePipelineCreateInfo.layout = _pipelineLayout;
+    computePipelineCreateInfo.stage = vkinit::pipeline_shader_stage_create_info(VK_SHADER_STAGE_COMPUTE_BIT, clusterShader);
+
+    VK_CHECK(vkCreateComputePipelines(_device, VK_NULL_HANDLE, 1, &computePipelineCreateInfo, nullptr, &_pipeline));
+
+    vkDestroyShaderModule(_device, clusterShader, nullptr);
+}
+
+void ClusteredLighting::destroy()
+{
+    //the layout belongs to the layout cache
+    vkDestroyPipeline(_device, _pipeline, nullptr);
+
+    for (FrameBuffers& frame : _frames) {
+        vmaDestroyBuffer(_allocator, frame.lights.buffer, frame.lights.allocation);
+        vmaDestroyBuffer(_allocator, frame.statsBuffer.buffer, frame.statsBuffer.allocation);
+    }
+    _frames.clear();
+
+    vmaDestroyBuffer(_allocator, _gridBuffer.buffer, _gridBuffer.allocation);
+    vmaDestroyBuffer(_allocator, _indexBuffer.buffer, _indexBuffer.allocation);
+}
+//< lighting_init
+
+//> lighting_frame
+uint32_t ClusteredLighting::begin_frame(uint32_t frameSlot, std::span<const GPULight> lights)
+{
+    _frameSlot = frameSlot;
+    FrameBuffers& frame = _frames[frameSlot];
+
+    //the frame that wrote these counters has completed. The index counter doubles
+    //as the allocator of the index list, so it has to start from zero
+    vmaInvalidateAllocation(_allocator, frame.statsBuffer.allocation, 0, VK_WHOLE_SIZE);
+    memcpy(&_stats, frame.statsBuffer.info.pMappedData, sizeof(LightClusterStats));
+    memset(frame.statsBuffer.info.pMappedData, 0, sizeof(LightClusterStats));
+    vmaFlushAllocation(_allocator, frame.statsBuffer.allocation, 0, VK_WHOLE_SIZE);
+
+    uint32_t count = (uint32_t)lights.size();
+    if (count > MaxLights) {
+        QS_CORE_ERROR("%u lights submitted, only the first %u are used", count, MaxLights);
+        count = MaxLights;
+    }
+    _lightCount = count;
+
+    memcpy(frame.lights.info.pMappedData, lights.data(), count * sizeof(GPULight));
+    vmaFlushAllocation(_allocator, frame.lights.allocation, 0, count * sizeof(GPULight));
+
+    return count;
+}
+
+void ClusteredLighting::update_scene_data(GPUSceneData& sceneData, VkExtent2D drawExtent, float znear, float zfar)
+{
+    _drawExtent = drawExtent;
+    _znear = znear;
+    _zfar = zfar;
+
+    sceneData.lights = _frames[_frameSlot].lightsAddress;
+    sceneData.clusterGrid = _gridAddress;
+    sceneData.lightIndices = _indexAddress;
+    sceneData.lightCount = _lightCount;
+
+    //slice k starts at znear * (zfar / znear)^(k / ClusterCountZ), so the slice of a
+    //view depth d is log(d) * scale + bias
+    float logRange = std::log(zfar / znear);
+    sceneData.clusterParams.x = std::ceil((float)drawExtent.width / ClusterCountX);
+    sceneData.clusterParams.y = std::ceil((float)drawExtent.height / ClusterCountY);
+    sceneData.clusterParams.z = ClusterCountZ / logRange;
+    sceneData.clusterParams.w = -(ClusterCountZ * std::log(znear)) / logRange;
+}
+
+void ClusteredLighting::build(VkCommandBuffer cmd, VkDeviceAddress sceneData)
+{
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
+
+    LightClusterPushConstants pushConstants;
+    pushConstants.sceneData = sceneData;
+    pushConstants.stats = _frames[_frameSlot].statsAddress;
+    pushConstants.screenSize = glm::vec2(_drawExtent.width, _drawExtent.height);
+    pushConstants.znear = _znear;
+    pushConstants.zfar = _zfar;
+    vkCmdPushConstants(cmd, _pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(LightClusterPushConstants), &pushConstants);
+
+    //one workgroup per cluster, so every cluster is written even without lights
+    vkCmdDispatch(cmd, ClusterCountX, ClusterCountY, ClusterCountZ);
+}
+//< lighting_frame
+
+}
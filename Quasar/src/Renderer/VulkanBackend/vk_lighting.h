@@ -0,0 +1,105 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_barriers.h"
+#include "vk_descriptors.h"
+
+namespace Quasar::Renderer {
+
+//> lighting_types
+// how the lights were spread over the clusters, read back once the frame completed
+struct LightClusterStats {
+    uint32_t lights;
+    // clusters with at least one light
+    uint32_t occupiedClusters;
+    // light indices handed out, the sum of every cluster's light count
+    uint32_t lightIndices;
+    uint32_t maxClusterLights;
+    // lights left out of a cluster because its list or the index buffer was full
+    uint32_t droppedLights;
+};
+//< lighting_types
+
+//> clustered_lighting
+// Clustered forward lighting.
+//
+// The view frustum is split into a ClusterCountX x ClusterCountY grid of screen
+// tiles and ClusterCountZ exponential depth slices. A compute pass tests every
+// light against every cluster's view space bounds and writes a compact list of
+// light indices per cluster. The shading pass finds its cluster from the fragment
+// position and depth and only loops over those lights.
+//
+// The shaders reach the lights, the grid and the index list through the buffer
+// addresses in GPUSceneData, so nothing is bound.
+class ClusteredLighting {
+public:
+    static constexpr uint32_t ClusterCountX = 16;
+    static constexpr uint32_t ClusterCountY = 9;
+    static constexpr uint32_t ClusterCountZ = 24;
+    static constexpr uint32_t ClusterCount = ClusterCountX * ClusterCountY * ClusterCountZ;
+
+    static constexpr uint32_t MaxLights = 1 << 14;
+    // lights a single cluster can hold, mirrors the shader
+    static constexpr uint32_t MaxClusterLights = 256;
+    // room for an average of 64 lights per cluster
+    static constexpr uint32_t MaxLightIndices = ClusterCount * 64;
+
+    void init(VkDevice device, VmaAllocator allocator, DescriptorLayoutCache& layoutCache, uint32_t framesInFlight);
+    void destroy();
+
+    // the previous use of frameSlot has completed. Reads back its stats and uploads
+    // this frame's lights, returns how many are used
+    uint32_t begin_frame(uint32_t frameSlot, std::span<const GPULight> lights);
+
+    // points the scene data at this frame's lights and grid. The grid follows the
+    // draw extent and the depth range of the projection
+    void update_scene_data(GPUSceneData& sceneData, VkExtent2D drawExtent, float znear, float zfar);
+
+    // assigns the lights to the clusters. sceneData is the GPUSceneData that
+    // update_scene_data() filled in
+    void build(VkCommandBuffer cmd, VkDeviceAddress sceneData);
+
+    TrackedBuffer& cluster_grid() { return _clusterGrid; }
+    TrackedBuffer& light_indices() { return _lightIndices; }
+    TrackedBuffer& stats_buffer() { return _frames[_frameSlot].stats; }
+
+    // the last frame read back in begin_frame()
+    const LightClusterStats& stats() const { return _stats; }
+
+private:
+    struct FrameBuffers {
+        AllocatedBuffer lights;
+        VkDeviceAddress lightsAddress;
+        AllocatedBuffer statsBuffer;
+        VkDeviceAddress statsAddress;
+        TrackedBuffer stats;
+    };
+
+    AllocatedBuffer create_buffer(VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage);
+    VkDeviceAddress buffer_address(VkBuffer buffer);
+
+    VkDevice _device;
+    VmaAllocator _allocator;
+
+    VkPipelineLayout _pipelineLayout;
+    VkPipeline _pipeline;
+
+    std::vector<FrameBuffers> _frames;
+    uint32_t _frameSlot = 0;
+    uint32_t _lightCount = 0;
+
+    VkExtent2D _drawExtent;
+    float _znear, _zfar;
+
+    AllocatedBuffer _gridBuffer;
+    AllocatedBuffer _indexBuffer;
+    VkDeviceAddress _gridAddress;
+    VkDeviceAddress _indexAddress;
+    TrackedBuffer _clusterGrid;
+    TrackedBuffer _lightIndices;
+
+    LightClusterStats _stats {};
+};
+//< clustered_lighting
+
+}
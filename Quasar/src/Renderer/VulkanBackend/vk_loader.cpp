@@ -0,0 +1,769 @@
+#include "vk_loader.h"
+
+#include "backend.h"
+#include "vk_initializers.h"
+
+#include <Renderer/MeshOptimizer.h>
+#include <Core/MappedFile.h>
+#include <Core/ThreadPool.h>
+
+#include <fastgltf/glm_element_traits.hpp>
+#include <fastgltf/parser.hpp>
+#include <fastgltf/tools.hpp>
+
+#include <glm/gtx/quaternion.hpp>
+
+#include <filesystem>
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> gltf_import
+// everything the workers read while a file streams in. Shared by the tasks, the
+// last one to finish unmaps the buffers
+struct GLTFImport {
+    fastgltf::GltfDataBuffer data;
+    fastgltf::Asset asset;
+    std::filesystem::path path;
+    std::filesystem::path directory;
+
+    // the .glb itself, its binary chunk is read straight from the mapping
+    MappedFile file;
+    std::vector<MappedFile> externalBuffers;
+
+    // start of every buffer's bytes, wherever they live
+    std::vector<const std::byte*> buffers;
+    // where every buffer starts on disk, for the texture loader to read images
+    // from. No path for the buffers that only live in memory, like data uris
+    std::vector<TextureLoader::Source> bufferFiles;
+
+    GLTFImportSettings settings;
+};
+
+// hands fastgltf's accessor tools the mapped buffers
+struct MappedBufferAdapter {
+    const GLTFImport* import;
+
+    const std::byte* operator()(const fastgltf::Buffer& buffer) const
+    {
+        return import->buffers[&buffer - import->asset.buffers.data()];
+    }
+};
+
+static VkFilter extract_filter(fastgltf::Filter filter)
+{
+    switch (filter) {
+    // nearest samplers
+    case fastgltf::Filter::Nearest:
+    case fastgltf::Filter::NearestMipMapNearest:
+    case fastgltf::Filter::NearestMipMapLinear:
+        return VK_FILTER_NEAREST;
+
+    // linear samplers
+    case fastgltf::Filter::Linear:
+    case fastgltf::Filter::LinearMipMapNearest:
+    case fastgltf::Filter::LinearMipMapLinear:
+    default:
+        return VK_FILTER_LINEAR;
+    }
+}
+
+static VkSamplerMipmapMode extract_mipmap_mode(fastgltf::Filter filter)
+{
+    switch (filter) {
+    case fastgltf::Filter::NearestMipMapNearest:
+    case fastgltf::Filter::LinearMipMapNearest:
+        return VK_SAMPLER_MIPMAP_MODE_NEAREST;
+
+    case fastgltf::Filter::NearestMipMapLinear:
+    case fastgltf::Filter::LinearMipMapLinear:
+    default:
+        return VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    }
+}
+
+static constexpr uint32_t GLBMagic = 0x46546C67; // "glTF"
+
+// largest error a level of detail may have, relative to the surface's bounding radius
+static constexpr float MaxLodError = 0.1f;
+
+// parses the json and maps every buffer. Only the json is copied, a .glb's binary
+// chunk is read from the mapped file in place
+static bool parse_gltf(GLTFImport& import, const std::filesystem::path& path)
+{
+    fastgltf::Parser parser {};
+
+    // buffers are mapped below instead of loaded
+    constexpr auto gltfOptions = fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::AllowDouble;
+
+    import.path = path;
+    import.directory = path.parent_path();
+
+    // a .glb's buffers are read by the workers right after parsing
+    MappedFile& file = import.file;
+    if (!file.Open(path.string(), MappedFile::Access::WillNeed)) {
+        return false;
+    }
+
+    const uint8_t* bytes = file.Data();
+    uint64_t size = file.Size();
+    uint32_t header[5] = {};
+    memcpy(header, bytes, std::min<size_t>(sizeof(header), size));
+    bool binary = size >= sizeof(header) && header[0] == GLBMagic;
+
+    // after the 12 byte header and the json chunk's header, the json, then the
+    // binary chunk's header and data
+    uint64_t jsonEnd = sizeof(header) + uint64_t(header[3]);
+    uint64_t binaryChunkOffset = jsonEnd + 8;
+    uint32_t binaryChunkSize = 0;
+    if (binary && binaryChunkOffset + 4 <= size) {
+        memcpy(&binaryChunkSize, bytes + jsonEnd, sizeof(binaryChunkSize));
+        if (binaryChunkSize > size - binaryChunkOffset) {
+            QS_CORE_ERROR("Failed to load glTF: the binary chunk of %s runs past the end of the file", path.string().c_str());
+            return false;
+        }
+    }
+
+    // simdjson reads past the end of the json and fastgltf zeroes that padding,
+    // so it gets a padded copy rather than the read only mapping. For a .glb the
+    // copy stops a word into the binary chunk and its header says so: fastgltf
+    // then sees the chunk and takes a view of it without reading it, and the view
+    // is pointed at the mapping below
+    if (binary && binaryChunkSize >= 4) {
+        uint64_t copySize = binaryChunkOffset + 4;
+        std::vector<uint8_t> glb(bytes, bytes + copySize);
+        uint32_t length = uint32_t(copySize);
+        memcpy(glb.data() + 8, &length, sizeof(length));
+        import.data.copyBytes(glb.data(), glb.size());
+    } else {
+        // json is small next to the buffers, nothing needs the mapping anymore
+        import.data.copyBytes(bytes, size);
+        file.Close();
+    }
+
+    if (binary) {
+        auto load = parser.loadBinaryGLTF(&import.data, import.directory, gltfOptions);
+        if (!load) {
+            QS_CORE_ERROR("Failed to load glTF: %s", std::string(fastgltf::getErrorMessage(load.error())).c_str());
+            return false;
+        }
+        import.asset = std::move(load.get());
+    } else {
+        auto load = parser.loadGLTF(&import.data, import.directory, gltfOptions);
+        if (!load) {
+            QS_CORE_ERROR("Failed to load glTF: %s", std::string(fastgltf::getErrorMessage(load.error())).c_str());
+            return false;
+        }
+        import.asset = std::move(load.get());
+    }
+
+    import.externalBuffers.reserve(import.asset.buffers.size());
+    for (fastgltf::Buffer& buffer : import.asset.buffers) {
+        const std::byte* start = nullptr;
+        TextureLoader::Source& location = import.bufferFiles.emplace_back();
+
+        std::visit(fastgltf::visitor {
+            [](auto& arg) {},
+            [&](fastgltf::sources::ByteView& view) {
+                // the binary chunk of the .glb, in the mapping rather than the copy
+                // unless it was too small to leave out
+                start = view.bytes.data();
+                if (file.IsOpen()) {
+                    start = reinterpret_cast<const std::byte*>(file.Data() + binaryChunkOffset);
+                    view.bytes = decltype(view.bytes)(start, binaryChunkSize);
+                }
+                location = { path.string(), binaryChunkOffset };
+            },
+            [&](fastgltf::sources::Vector& vector) {
+                start = reinterpret_cast<const std::byte*>(vector.bytes.data());
+            },
+            [&](fastgltf::sources::URI& uri) {
+                if (!uri.uri.isLocalPath()) {
+                    return;
+                }
+                const std::string bufferPath(uri.uri.path().begin(), uri.uri.path().end());
+                MappedFile& mapped = import.externalBuffers.emplace_back();
+                if (mapped.Open((import.directory / bufferPath).string(), MappedFile::Access::WillNeed)
+                    && uri.fileByteOffset < mapped.Size()) {
+                    start = reinterpret_cast<const std::byte*>(mapped.Data()) + uri.fileByteOffset;
+                    location = { (import.directory / bufferPath).string(), uri.fileByteOffset };
+                }
+            },
+        },
+            buffer.data);
+
+        if (!start) {
+            QS_CORE_ERROR("Failed to load glTF buffer %s", buffer.name.c_str());
+            return false;
+        }
+        import.buffers.push_back(start);
+    }
+
+    return true;
+}
+
+// where an image's encoded bytes are, the file it names or the range of a
+// buffer's file its buffer view covers. Images that only live in memory, a data
+// uri or a view of a decoded buffer, are read from there and keep the import
+// alive until they have loaded
+static bool image_source(const std::shared_ptr<GLTFImport>& importRef, uint32_t imageIndex, TextureLoader::Source& source)
+{
+    const GLTFImport& import = *importRef;
+    const fastgltf::Image& image = import.asset.images[imageIndex];
+    source = {};
+
+    auto in_memory = [&](const uint8_t* bytes, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        source.path = import.path.string();
+        source.offset = imageIndex;
+        source.bytes = std::span(bytes, size);
+        source.owner = importRef;
+    };
+
+    std::visit(fastgltf::visitor {
+        [](auto& arg) {},
+        [&](const fastgltf::sources::URI& filePath) {
+            if (!filePath.uri.isLocalPath()) {
+                return;
+            }
+            const std::string path(filePath.uri.path().begin(), filePath.uri.path().end());
+            source = { (import.directory / path).string(), filePath.fileByteOffset };
+        },
+        [&](const fastgltf::sources::Vector& vector) {
+            in_memory(vector.bytes.data(), vector.bytes.size());
+        },
+        [&](const fastgltf::sources::BufferView& view) {
+            const fastgltf::BufferView& bufferView = import.asset.bufferViews[view.bufferViewIndex];
+            const TextureLoader::Source& buffer = import.bufferFiles[bufferView.bufferIndex];
+            if (!buffer.path.empty()) {
+                source = { buffer.path, buffer.offset + bufferView.byteOffset, bufferView.byteLength };
+            } else {
+                in_memory(reinterpret_cast<const uint8_t*>(import.buffers[bufferView.bufferIndex]) + bufferView.byteOffset,
+                    bufferView.byteLength);
+            }
+        },
+    },
+        image.data);
+
+    return !source.path.empty();
+}
+
+// worker: converts a mesh's primitives to our vertex format and queues the upload
+static void load_mesh(std::shared_ptr<GLTFImport> import, std::shared_ptr<LoadedGLTF> scene, uint32_t meshIndex)
+{
+    Backend* engine = scene->creator;
+    const fastgltf::Asset& gltf = import->asset;
+    const fastgltf::Mesh& mesh = gltf.meshes[meshIndex];
+    std::shared_ptr<GLTFMesh> newmesh = scene->meshes[meshIndex];
+    MappedBufferAdapter adapter { import.get() };
+
+    std::vector<uint32_t> indices;
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> primitiveIndices;
+
+    for (auto&& p : mesh.primitives) {
+        if (!p.indicesAccessor.has_value() || p.findAttribute("POSITION") == p.attributes.end()) {
+            continue;
+        }
+        // nothing to draw, and no vertex to take the bounds from
+        if (gltf.accessors[p.indicesAccessor.value()].count == 0 || gltf.accessors[p.findAttribute("POSITION")->second].count == 0) {
+            continue;
+        }
+
+        GeoSurface newSurface;
+        newSurface.startIndex = (uint32_t)indices.size();
+        newSurface.count = (uint32_t)gltf.accessors[p.indicesAccessor.value()].count;
+
+        size_t initial_vtx = vertices.size();
+
+        const fastgltf::Accessor& posAccessor = gltf.accessors[p.findAttribute("POSITION")->second];
+
+        // load indexes
+        {
+            const fastgltf::Accessor& indexaccessor = gltf.accessors[p.indicesAccessor.value()];
+            primitiveIndices.clear();
+            primitiveIndices.reserve(indexaccessor.count);
+
+            fastgltf::iterateAccessor<std::uint32_t>(gltf, indexaccessor,
+                [&](std::uint32_t idx) {
+                    primitiveIndices.push_back(idx);
+                },
+                adapter);
+
+            // an index past the primitive's vertices would reach into the next
+            // primitive, or past every vertex, and the optimizers write through
+            // them, so the whole primitive is dropped
+            bool inRange = std::all_of(primitiveIndices.begin(), primitiveIndices.end(),
+                [&](uint32_t idx) { return idx < posAccessor.count; });
+            if (!inRange) {
+                QS_CORE_WARN("Skipping a primitive of mesh %s, its indices go past its %zu vertices", mesh.name.c_str(), posAccessor.count);
+                continue;
+            }
+
+            // the primitive's own index space, so the optimizer only sizes its
+            // tables for this primitive's vertices
+            if (import->settings.optimizeMeshes) {
+                OptimizeVertexCache(primitiveIndices.data(), primitiveIndices.size(), posAccessor.count);
+            }
+
+            indices.reserve(indices.size() + primitiveIndices.size());
+            for (uint32_t idx : primitiveIndices) {
+                indices.push_back(idx + uint32_t(initial_vtx));
+            }
+        }
+
+        // load vertex positions
+        {
+            vertices.resize(vertices.size() + posAccessor.count);
+
+            fastgltf::iterateAccessorWithIndex<glm::vec3>(gltf, posAccessor,
+                [&](glm::vec3 v, size_t index) {
+                    Vertex newvtx;
+                    newvtx.position = v;
+                    newvtx.normal = { 1, 0, 0 };
+                    newvtx.color = glm::vec4 { 1.f };
+                    newvtx.uv_x = 0;
+                    newvtx.uv_y = 0;
+                    vertices[initial_vtx + index] = newvtx;
+                },
+                adapter);
+        }
+
+        // load vertex normals
+        auto normals = p.findAttribute("NORMAL");
+        if (normals != p.attributes.end()) {
+            fastgltf::iterateAccessorWithIndex<glm::vec3>(gltf, gltf.accessors[(*normals).second],
+                [&](glm::vec3 v, size_t index) {
+                    vertices[initial_vtx + index].normal = v;
+                },
+                adapter);
+        }
+
+        // load UVs
+        auto uv = p.findAttribute("TEXCOORD_0");
+        if (uv != p.attributes.end()) {
+            fastgltf::iterateAccessorWithIndex<glm::vec2>(gltf, gltf.accessors[(*uv).second],
+                [&](glm::vec2 v, size_t index) {
+                    vertices[initial_vtx + index].uv_x = v.x;
+                    vertices[initial_vtx + index].uv_y = v.y;
+                },
+                adapter);
+        }
+
+        // load vertex colors
+        auto colors = p.findAttribute("COLOR_0");
+        if (colors != p.attributes.end()) {
+            fastgltf::iterateAccessorWithIndex<glm::vec4>(gltf, gltf.accessors[(*colors).second],
+                [&](glm::vec4 v, size_t index) {
+                    vertices[initial_vtx + index].color = v;
+                },
+                adapter);
+        }
+
+        if (p.materialIndex.has_value()) {
+            newSurface.material = scene->materials[p.materialIndex.value()];
+        } else {
+            newSurface.material = scene->materials[0];
+        }
+
+        //loop the vertices of this surface, find min/max bounds
+        glm::vec3 minpos = vertices[initial_vtx].position;
+        glm::vec3 maxpos = vertices[initial_vtx].position;
+        for (size_t i = initial_vtx; i < vertices.size(); i++) {
+            minpos = glm::min(minpos, vertices[i].position);
+            maxpos = glm::max(maxpos, vertices[i].position);
+        }
+        // calculate origin and extents from the min/max, use extent lenght for radius
+        newSurface.bounds.origin = (maxpos + minpos) / 2.f;
+        newSurface.bounds.extents = (maxpos - minpos) / 2.f;
+        newSurface.bounds.sphereRadius = glm::length(newSurface.bounds.extents);
+
+        // levels of detail go right after the primitive in the same index buffer,
+        // each one simplified from the one before
+        newSurface.lods.push_back({ newSurface.startIndex, newSurface.count, 0.f });
+        if (import->settings.generateLods) {
+            const float* positions = &vertices[initial_vtx].position.x;
+            std::vector<uint32_t> simplified(primitiveIndices.size());
+            float error = 0.f;
+
+            while (newSurface.lods.size() < MaxMeshLods) {
+                float lodError;
+                size_t count = SimplifyMesh(simplified.data(), primitiveIndices.data(), primitiveIndices.size(), positions,
+                    posAccessor.count, sizeof(Vertex), primitiveIndices.size() / 6 * 3, newSurface.bounds.sphereRadius * MaxLodError, &lodError);
+
+                // too little left to simplify to be worth a level
+                if (count == 0 || count > primitiveIndices.size() * 3 / 4) {
+                    break;
+                }
+
+                primitiveIndices.assign(simplified.begin(), simplified.begin() + count);
+                if (import->settings.optimizeMeshes) {
+                    OptimizeVertexCache(primitiveIndices.data(), primitiveIndices.size(), posAccessor.count);
+                }
+
+                // the errors of the levels in between add up
+                error += lodError;
+                newSurface.lods.push_back({ uint32_t(indices.size()), uint32_t(count), error });
+                for (uint32_t idx : primitiveIndices) {
+                    indices.push_back(idx + uint32_t(initial_vtx));
+                }
+            }
+        }
+
+        newmesh->surfaces.push_back(newSurface);
+    }
+
+    if (!indices.empty() && import->settings.optimizeMeshes) {
+        // surfaces keep their index ranges, only the vertices move
+        size_t vertexCount = OptimizeVertexFetch(vertices.data(), vertices.size(), sizeof(Vertex), indices.data(), indices.size());
+        vertices.resize(vertexCount);
+    }
+
+    if (!indices.empty() && import->settings.quantizeVertices) {
+        static_assert(sizeof(Vertex) == sizeof(MeshFileVertex));
+
+        std::vector<uint8_t> packed(sizeof(QuantizedVertexHeader) + vertices.size() * sizeof(QuantizedVertex));
+        QuantizedVertexHeader* header = reinterpret_cast<QuantizedVertexHeader*>(packed.data());
+        QuantizeVertices(reinterpret_cast<const MeshFileVertex*>(vertices.data()), vertices.size(), *header,
+            reinterpret_cast<QuantizedVertex*>(header + 1));
+
+        newmesh->meshBuffers = engine->create_mesh_buffers(packed.size(), indices.size() * sizeof(uint32_t), VK_INDEX_TYPE_UINT32);
+        newmesh->meshBuffers.vertexFormat = VertexFormat::Quantized;
+        engine->_uploads.upload_buffer(newmesh->meshBuffers.vertexBuffer.buffer, 0, packed.data(), packed.size());
+        engine->_uploads.upload_buffer(newmesh->meshBuffers.indexBuffer.buffer, 0, indices.data(), indices.size() * sizeof(uint32_t));
+    } else if (!indices.empty()) {
+        newmesh->meshBuffers = engine->create_mesh_buffers(vertices.size() * sizeof(Vertex), indices.size() * sizeof(uint32_t), VK_INDEX_TYPE_UINT32);
+        engine->_uploads.upload_buffer(newmesh->meshBuffers.vertexBuffer.buffer, 0, vertices.data(), vertices.size() * sizeof(Vertex));
+        engine->_uploads.upload_buffer(newmesh->meshBuffers.indexBuffer.buffer, 0, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    engine->_uploads.on_complete([scene = std::move(scene), newmesh, hasGeometry = !indices.empty()]() {
+        newmesh->ready = hasGeometry;
+        scene->pendingMeshes--;
+    });
+}
+
+std::optional<std::shared_ptr<LoadedGLTF>> load_gltf(Backend* engine, std::string_view filePath, const GLTFImportSettings& settings)
+{
+    QS_CORE_INFO("Loading GLTF: %s", std::string(filePath).c_str());
+
+    auto import = std::make_shared<GLTFImport>();
+    import->settings = settings;
+    if (!parse_gltf(*import, std::filesystem::path(filePath))) {
+        return {};
+    }
+    fastgltf::Asset& gltf = import->asset;
+
+    std::shared_ptr<LoadedGLTF> scene = std::make_shared<LoadedGLTF>();
+    scene->creator = engine;
+    LoadedGLTF& file = *scene.get();
+
+    // load samplers
+    for (fastgltf::Sampler& sampler : gltf.samplers) {
+
+        VkSamplerCreateInfo sampl = { .sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, .pNext = nullptr };
+        sampl.maxLod = VK_LOD_CLAMP_NONE;
+        sampl.minLod = 0;
+
+        sampl.magFilter = extract_filter(sampler.magFilter.value_or(fastgltf::Filter::Nearest));
+        sampl.minFilter = extract_filter(sampler.minFilter.value_or(fastgltf::Filter::Nearest));
+
+        sampl.mipmapMode = extract_mipmap_mode(sampler.minFilter.value_or(fastgltf::Filter::Nearest));
+
+        VkSampler newSampler;
+        vkCreateSampler(engine->_device, &sampl, nullptr, &newSampler);
+
+        file.samplers.push_back(newSampler);
+        file.samplerIndices.push_back(engine->_bindless.register_sampler(newSampler));
+    }
+
+    // images stream in later, until then materials show the default texture
+    file.imageHandles.resize(gltf.images.size(), INVALID_ID);
+    file.imageIndices.resize(gltf.images.size(), INVALID_ID);
+
+    // materials are created right away so meshes can point at them
+    auto texture_image = [&](const fastgltf::TextureInfo& info, uint32_t& samplerIndex) -> int {
+        const fastgltf::Texture& texture = gltf.textures[info.textureIndex];
+        if (texture.samplerIndex.has_value()) {
+            samplerIndex = file.samplerIndices[texture.samplerIndex.value()];
+        }
+        return texture.imageIndex.has_value() ? int(texture.imageIndex.value()) : -1;
+    };
+
+    for (fastgltf::Material& mat : gltf.materials) {
+        std::shared_ptr<GLTFMaterial> newMat = std::make_shared<GLTFMaterial>();
+        file.materials.push_back(newMat);
+
+        GPUGLTFMaterial constants {};
+        constants.colorFactors.x = mat.pbrData.baseColorFactor[0];
+        constants.colorFactors.y = mat.pbrData.baseColorFactor[1];
+        constants.colorFactors.z = mat.pbrData.baseColorFactor[2];
+        constants.colorFactors.w = mat.pbrData.baseColorFactor[3];
+
+        constants.metal_rough_factors.x = mat.pbrData.metallicFactor;
+        constants.metal_rough_factors.y = mat.pbrData.roughnessFactor;
+
+        // default the material textures
+        constants.colorTexIndex = engine->_whiteImageIndex;
+        constants.colorSamplerIndex = engine->_defaultSamplerLinearIndex;
+        constants.metalRoughTexIndex = engine->_whiteImageIndex;
+        constants.metalRoughSamplerIndex = engine->_defaultSamplerLinearIndex;
+
+        if (mat.pbrData.baseColorTexture.has_value()) {
+            newMat->colorImage = texture_image(mat.pbrData.baseColorTexture.value(), constants.colorSamplerIndex);
+        }
+        if (mat.pbrData.metallicRoughnessTexture.has_value()) {
+            newMat->metalRoughImage = texture_image(mat.pbrData.metallicRoughnessTexture.value(), constants.metalRoughSamplerIndex);
+        }
+
+        MaterialPass passType = MaterialPass::MainColor;
+        if (mat.alphaMode == fastgltf::AlphaMode::Blend) {
+            passType = MaterialPass::Transparent;
+        }
+
+        newMat->data = engine->create_material(passType, constants);
+    }
+
+    // primitives without a material use this one
+    if (file.materials.empty()) {
+        std::shared_ptr<GLTFMaterial> defaultMat = std::make_shared<GLTFMaterial>();
+
+        GPUGLTFMaterial constants {};
+        constants.colorFactors = glm::vec4(1.f);
+        constants.metal_rough_factors = glm::vec4(1.f, 0.5f, 0.f, 0.f);
+        constants.colorTexIndex = engine->_whiteImageIndex;
+        constants.colorSamplerIndex = engine->_defaultSamplerLinearIndex;
+        constants.metalRoughTexIndex = engine->_whiteImageIndex;
+        constants.metalRoughSamplerIndex = engine->_defaultSamplerLinearIndex;
+
+        defaultMat->data = engine->create_material(MaterialPass::MainColor, constants);
+        file.materials.push_back(defaultMat);
+    }
+
+    // meshes are filled in by the workers
+    for (fastgltf::Mesh& mesh : gltf.meshes) {
+        std::shared_ptr<GLTFMesh> newmesh = std::make_shared<GLTFMesh>();
+        newmesh->name = mesh.name;
+        file.meshes.push_back(newmesh);
+    }
+
+    // load all nodes and their meshes
+    for (fastgltf::Node& node : gltf.nodes) {
+        std::shared_ptr<Node> newNode;
+
+        // find if the node has a mesh, and if it does hook it to the mesh pointer and allocate it with the meshnode class
+        if (node.meshIndex.has_value()) {
+            newNode = std::make_shared<MeshNode>();
+            static_cast<MeshNode*>(newNode.get())->mesh = file.meshes[*node.meshIndex];
+        } else {
+            newNode = std::make_shared<Node>();
+        }
+
+        file.nodes.push_back(newNode);
+
+        std::visit(fastgltf::visitor { [&](fastgltf::Node::TransformMatrix matrix) {
+                                          memcpy(&newNode->localTransform, matrix.data(), sizeof(matrix));
+                                      },
+                       [&](fastgltf::Node::TRS transform) {
+                           glm::vec3 tl(transform.translation[0], transform.translation[1],
+                               transform.translation[2]);
+                           glm::quat rot(transform.rotation[3], transform.rotation[0], transform.rotation[1],
+                               transform.rotation[2]);
+                           glm::vec3 sc(transform.scale[0], transform.scale[1], transform.scale[2]);
+
+                           glm::mat4 tm = glm::translate(glm::mat4(1.f), tl);
+                           glm::mat4 rm = glm::toMat4(rot);
+                           glm::mat4 sm = glm::scale(glm::mat4(1.f), sc);
+
+                           newNode->localTransform = tm * rm * sm;
+                       } },
+            node.transform);
+    }
+
+    // run loop again to setup transform hierarchy
+    for (size_t i = 0; i < gltf.nodes.size(); i++) {
+        fastgltf::Node& node = gltf.nodes[i];
+        std::shared_ptr<Node>& sceneNode = file.nodes[i];
+
+        for (auto& c : node.children) {
+            sceneNode->children.push_back(file.nodes[c]);
+            file.nodes[c]->parent = sceneNode;
+        }
+    }
+
+    // find the top nodes, with no parents
+    for (auto& node : file.nodes) {
+        if (node->parent.lock() == nullptr) {
+            file.topNodes.push_back(node);
+            node->refreshTransform(glm::mat4 { 1.f });
+        }
+    }
+
+    // the texture loader decodes and streams the images. Its callbacks hold on to
+    // the scene only until clearAll releases the references
+    file.pendingImages = uint32_t(gltf.images.size());
+    for (uint32_t i = 0; i < gltf.images.size(); i++) {
+        TextureLoader::Source source;
+        if (!image_source(import, i, source)) {
+            QS_CORE_ERROR("Failed to load glTF image %s", gltf.images[i].name.c_str());
+            file.pendingImages--;
+            continue;
+        }
+        LoadedGLTF* loaded = scene.get();
+        file.imageHandles[i] = engine->_textures.load(source, [loaded, i](uint32_t index) { loaded->on_image_changed(i, index); });
+    }
+
+    // everything else heavy runs on the workers. Each task holds the import and the
+    // scene and hands its scene reference to the completion callback, so the scene
+    // is only ever destroyed on the render thread
+    file.pendingMeshes = uint32_t(gltf.meshes.size());
+
+    ThreadPool& pool = QS_THREAD_POOL;
+    for (uint32_t i = 0; i < gltf.meshes.size(); i++) {
+        pool.Enqueue([import, scene, i]() mutable { load_mesh(std::move(import), std::move(scene), i); });
+    }
+
+    return scene;
+}
+//< gltf_import
+
+//> loadedgltf
+void LoadedGLTF::on_image_changed(uint32_t image, uint32_t index)
+{
+    MaterialRegistry& registry = creator->_materials;
+    if (imageIndices[image] == INVALID_ID) {
+        pendingImages--;
+    }
+    imageIndices[image] = index;
+
+    // swap the image's new index into every material using it
+    for (auto& material : materials) {
+        if (material->colorImage != int(image) && material->metalRoughImage != int(image)) {
+            continue;
+        }
+
+        GPUGLTFMaterial data = registry.get(material->data.materialIndex);
+        if (material->colorImage == int(image)) {
+            data.colorTexIndex = imageIndices[image];
+        }
+        if (material->metalRoughImage == int(image)) {
+            data.metalRoughTexIndex = imageIndices[image];
+        }
+        registry.update(material->data.materialIndex, data);
+    }
+}
+
+void LoadedGLTF::Draw(const glm::mat4& topMatrix, DrawContext& ctx)
+{
+    // create renderables from the scenenodes
+    for (auto& n : topNodes) {
+        n->Draw(topMatrix, ctx);
+    }
+}
+
+void LoadedGLTF::clearAll()
+{
+    uint64_t frame = creator->_frameNumber;
+
+    for (auto& mesh : meshes) {
+        if (mesh->ready) {
+            creator->destroy_mesh(mesh->meshBuffers);
+        }
+    }
+
+    // the texture loader frees the images once no frame in flight samples them
+    for (TextureLoader::Handle handle : imageHandles) {
+        if (handle != INVALID_ID) {
+            creator->_textures.release(handle);
+        }
+    }
+    imageHandles.clear();
+
+    for (auto& material : materials) {
+        creator->_materials.release(material->data.materialIndex, frame);
+    }
+
+    for (size_t i = 0; i < samplers.size(); i++) {
+        creator->_bindless.release_sampler(samplerIndices[i], frame);
+        vkDestroySampler(creator->_device, samplers[i], 0);
+    }
+}
+//< loadedgltf
+
+//> meshnode_draw
+// the coarsest level whose error stays under the threshold on screen, moving
+// from the level picked last frame
+static uint32_t select_lod(const GeoSurface& surface, const glm::mat4& transform, const LodSelection& selection, uint32_t current)
+{
+    uint32_t lodCount = uint32_t(surface.lods.size());
+    if (!selection.enabled || lodCount < 2) {
+        return 0;
+    }
+
+    // errors grow with the largest scale of the transform and shrink with distance
+    float scale = std::max({ glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) });
+    glm::vec3 center = glm::vec3(transform * glm::vec4(surface.bounds.origin, 1.f));
+    float distance = glm::length(center - selection.viewPosition) - surface.bounds.sphereRadius * scale;
+    float pixelsPerError = scale * selection.pixelsPerUnit / std::max(distance, 1e-3f);
+
+    uint32_t lod = std::min(current, lodCount - 1);
+    while (lod > 0 && surface.lods[lod].error * pixelsPerError > selection.errorThreshold) {
+        lod--;
+    }
+    while (lod + 1 < lodCount && surface.lods[lod + 1].error * pixelsPerError <= selection.errorThreshold * (1.f - selection.hysteresis)) {
+        lod++;
+    }
+    return lod;
+}
+
+void MeshNode::Draw(const glm::mat4& topMatrix, DrawContext& ctx)
+{
+    // still streaming in
+    if (!mesh->ready) {
+        Node::Draw(topMatrix, ctx);
+        return;
+    }
+
+    glm::mat4 nodeMatrix = topMatrix * worldTransform;
+
+    lodLevels.resize(mesh->surfaces.size(), 0);
+
+    for (size_t i = 0; i < mesh->surfaces.size(); i++) {
+        const GeoSurface& s = mesh->surfaces[i];
+
+        lodLevels[i] = uint8_t(select_lod(s, nodeMatrix, ctx.lod, lodLevels[i]));
+        const MeshLod& lod = s.lods[lodLevels[i]];
+        ctx.fullTriangles += s.count / 3;
+        ctx.drawnTriangles += lod.indexCount / 3;
+
+        RenderObject def;
+        def.indexCount = lod.indexCount;
+        def.firstIndex = lod.firstIndex;
+        def.indexBuffer = mesh->meshBuffers.indexBuffer.buffer;
+        def.indexType = mesh->meshBuffers.indexType;
+        def.material = &s.material->data;
+        def.bounds = s.bounds;
+        def.transform = nodeMatrix;
+        def.vertexBufferAddress = mesh->meshBuffers.vertexBufferAddress;
+        def.vertexFormat = mesh->meshBuffers.vertexFormat;
+        // imported scenes don't move, the cached shadow cascades can keep them
+        def.isStatic = true;
+        def.shadowIndexCount = s.lods[0].indexCount;
+        def.shadowFirstIndex = s.lods[0].firstIndex;
+
+        if (s.material->data.passType == MaterialPass::Transparent) {
+            ctx.TransparentSurfaces.push_back(def);
+        } else {
+            ctx.OpaqueSurfaces.push_back(def);
+        }
+    }
+
+    // recurse down
+    Node::Draw(topMatrix, ctx);
+}
+//< meshnode_draw
+
+}
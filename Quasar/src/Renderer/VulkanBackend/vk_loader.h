@@ -0,0 +1,115 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_textures.h"
+
+#include <atomic>
+#include <string_view>
+
+namespace Quasar::Renderer {
+
+class Backend;
+
+//> loader_types
+struct GLTFMaterial {
+    MaterialInstance data;
+    // glTF images behind the color and metal/rough textures, -1 for none. The
+    // material shows the default white texture until the image has arrived, and
+    // follows it to every new index streaming gives it
+    int colorImage = -1;
+    int metalRoughImage = -1;
+};
+
+struct GeoSurface {
+    uint32_t startIndex;
+    uint32_t count;
+    Bounds bounds;
+    std::shared_ptr<GLTFMaterial> material;
+    // coarsening levels of detail, the first is startIndex and count
+    std::vector<MeshLod> lods;
+};
+
+struct GLTFMesh {
+    std::string name;
+
+    std::vector<GeoSurface> surfaces;
+    GPUMeshBuffers meshBuffers;
+
+    // set on the render thread once the buffers hold the mesh, nothing else is
+    // safe to read before
+    bool ready = false;
+};
+
+struct MeshNode : public Node {
+
+    std::shared_ptr<GLTFMesh> mesh;
+    // level of detail picked for each surface, kept between frames for the hysteresis
+    std::vector<uint8_t> lodLevels;
+
+    virtual void Draw(const glm::mat4& topMatrix, DrawContext& ctx) override;
+};
+
+struct GLTFImportSettings {
+    // reorder triangles for the post-transform cache and vertices for fetch
+    bool optimizeMeshes = true;
+    // store vertices as QuantizedVertex, 20 bytes instead of 48
+    bool quantizeVertices = false;
+    // simplified levels of detail after each primitive's indices
+    bool generateLods = true;
+};
+//< loader_types
+
+//> loadedgltf
+// A glTF scene that streams in. The node hierarchy and materials exist as soon as
+// load_gltf returns, meshes draw as their buffers arrive and textures replace the
+// default white one as the backend's TextureLoader brings them in.
+struct LoadedGLTF : public IRenderable {
+
+    // storage for all the data on a given glTF file, indexed like the file
+    std::vector<std::shared_ptr<GLTFMesh>> meshes;
+    std::vector<std::shared_ptr<Node>> nodes;
+    std::vector<std::shared_ptr<GLTFMaterial>> materials;
+
+    // nodes that dont have a parent, for iterating through the file in tree order
+    std::vector<std::shared_ptr<Node>> topNodes;
+
+    std::vector<VkSampler> samplers;
+
+    // the texture loader's references to the images, INVALID_ID for images it can't read
+    std::vector<TextureLoader::Handle> imageHandles;
+    // bindless indices of images and samplers, INVALID_ID until registered
+    std::vector<uint32_t> imageIndices;
+    std::vector<uint32_t> samplerIndices;
+
+    Backend* creator;
+
+    // meshes still converting or uploading and images that haven't arrived
+    std::atomic<uint32_t> pendingMeshes { 0 };
+    std::atomic<uint32_t> pendingImages { 0 };
+
+    bool is_loaded() const { return pendingMeshes == 0 && pendingImages == 0; }
+
+    // frees the gpu resources right away, the gpu must not be using them anymore
+    ~LoadedGLTF() { clearAll(); };
+
+    virtual void Draw(const glm::mat4& topMatrix, DrawContext& ctx);
+
+private:
+    friend std::optional<std::shared_ptr<LoadedGLTF>> load_gltf(Backend* engine, std::string_view filePath, const GLTFImportSettings& settings);
+
+    // called on the render thread whenever an image gets a new bindless index
+    void on_image_changed(uint32_t image, uint32_t index);
+
+    void clearAll();
+};
+//< loadedgltf
+
+// Parses a .gltf or .glb file and starts streaming its contents. Returns once the
+// scene graph exists; vertex conversion and the staging copies run on the thread
+// pool, and the gpu copies go through the backend's UploadQueue. Images go to the
+// backend's TextureLoader, straight from their files or from their range of the
+// buffer's file. The binary chunk of a .glb and external .bin buffers are memory
+// mapped and read in place, only the json is copied.
+std::optional<std::shared_ptr<LoadedGLTF>> load_gltf(Backend* engine, std::string_view filePath, const GLTFImportSettings& settings = {});
+
+}
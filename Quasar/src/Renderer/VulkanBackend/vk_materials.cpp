@@ -0,0 +1,72 @@
+#include "vk_materials.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> material_registry
+void MaterialRegistry::init(VkDevice device, VmaAllocator allocator, BindlessRegistry& bindless)
+{
+    _allocator = allocator;
+
+    VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = sizeof(GPUGLTFMaterial) * MaxMaterials;
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+    VmaAllocationCreateInfo vmaallocInfo = {};
+    vmaallocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+    vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+    VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &_buffer.buffer, &_buffer.allocation, &_buffer.info));
+    _data = static_cast<GPUGLTFMaterial*>(_buffer.info.pMappedData);
+
+    //shaders find the buffer at a fixed index, so it has to be registered first
+    uint32_t index = bindless.register_storage_buffer(_buffer.buffer);
+    assert(index == BufferIndex);
+}
+
+void MaterialRegistry::destroy()
+{
+    vmaDestroyBuffer(_allocator, _buffer.buffer, _buffer.allocation);
+}
+
+uint32_t MaterialRegistry::allocate(const GPUGLTFMaterial& data)
+{
+    uint32_t index;
+    if (!_freeIndices.empty()) {
+        index = _freeIndices.back();
+        _freeIndices.pop_back();
+    } else if (_next < MaxMaterials) {
+        index = _next++;
+    } else {
+        QS_CORE_ERROR("Material buffer is full (%u materials)", MaxMaterials);
+        return INVALID_ID;
+    }
+
+    update(index, data);
+    return index;
+}
+
+void MaterialRegistry::update(uint32_t index, const GPUGLTFMaterial& data)
+{
+    _data[index] = data;
+}
+
+void MaterialRegistry::release(uint32_t index, uint64_t lastUsedFrame)
+{
+    if (index == INVALID_ID) {
+        return;
+    }
+    _pending.emplace_back(lastUsedFrame, index);
+}
+
+void MaterialRegistry::collect(uint64_t completedFrame)
+{
+    while (!_pending.empty() && _pending.front().first <= completedFrame) {
+        _freeIndices.push_back(_pending.front().second);
+        _pending.pop_front();
+    }
+}
+//< material_registry
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_bindless.h"
+
+namespace Quasar::Renderer {
+
+//> material_registry
+// Every material's GPUGLTFMaterial in one host visible storage buffer, which is
+// the first storage buffer of the bindless set (MaterialBufferIndex in
+// bindless.glsl). Draws pass the material's index in their push constants.
+//
+// Render thread only. Rewriting a material is safe while frames are in flight,
+// they see either the old or the new values.
+class MaterialRegistry {
+public:
+    static constexpr uint32_t MaxMaterials = 16384;
+    // mirrors MaterialBufferIndex in bindless.glsl
+    static constexpr uint32_t BufferIndex = 0;
+
+    void init(VkDevice device, VmaAllocator allocator, BindlessRegistry& bindless);
+    void destroy();
+
+    // INVALID_ID when the buffer is full
+    uint32_t allocate(const GPUGLTFMaterial& data);
+    void update(uint32_t index, const GPUGLTFMaterial& data);
+    const GPUGLTFMaterial& get(uint32_t index) const { return _data[index]; }
+
+    // like BindlessRegistry, the index is reused once lastUsedFrame has completed
+    void release(uint32_t index, uint64_t lastUsedFrame);
+    void collect(uint64_t completedFrame);
+
+private:
+    VmaAllocator _allocator;
+    AllocatedBuffer _buffer;
+    GPUGLTFMaterial* _data;
+
+    uint32_t _next = 0;
+    std::vector<uint32_t> _freeIndices;
+    std::deque<std::pair<uint64_t, uint32_t>> _pending;
+};
+//< material_registry
+
+}
@@ -1,8 +1,12 @@
 ﻿#include "vk_pipelines.h"
 
-#include <fstream>
 #include "vk_initializers.h"
 
+#include <Core/Filesystem.h>
+#include <Core/MappedFile.h>
+
+#include <future>
+
 #include <qspch.h>
 
 namespace Quasar::Renderer {
@@ -26,6 +30,8 @@ void PipelineBuilder::clear()
 
 	_renderInfo = { .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO };
 
+	_flags = 0;
+
 	_shaderStages.clear();
 }
 //< pipe_clear
@@ -50,7 +56,8 @@ VkPipeline PipelineBuilder::build_pipeline(VkDevice device)
 
     colorBlending.logicOpEnable = VK_FALSE;
     colorBlending.logicOp = VK_LOGIC_OP_COPY;
-    colorBlending.attachmentCount = 1;
+    // depth-only pipelines have no color attachment to blend
+    colorBlending.attachmentCount = _renderInfo.colorAttachmentCount;
     colorBlending.pAttachments = &_colorBlendAttachment;
 
 
@@ -77,6 +84,7 @@ VkPipeline PipelineBuilder::build_pipeline(VkDevice device)
     pipelineInfo.pColorBlendState = &colorBlending;
     pipelineInfo.pDepthStencilState = &_depthStencil;
     pipelineInfo.layout = _pipelineLayout;
+    pipelineInfo.flags = _flags;
 
 //< build_pipeline_2
 //> build_pipeline_3
@@ -235,34 +243,65 @@ void PipelineBuilder::enable_depthtest(bool depthWriteEnable,VkCompareOp op)
 }
 //< depth_enable
 
-//> load_shader
-bool vkutil::load_shader_module(const char* filePath,
-    VkDevice device,
-    VkShaderModule* outShaderModule)
+void PipelineBuilder::set_depth_bias(float constantFactor, float slopeFactor)
 {
-    // open the file. With cursor at the end
-    std::ifstream file(filePath, std::ios::ate | std::ios::binary);
+    _rasterizer.depthBiasEnable = VK_TRUE;
+    _rasterizer.depthBiasConstantFactor = constantFactor;
+    _rasterizer.depthBiasSlopeFactor = slopeFactor;
+    _rasterizer.depthBiasClamp = 0.f;
+}
 
-    if (!file.is_open()) {
-        return false;
-    }
+void PipelineBuilder::set_create_flags(VkPipelineCreateFlags flags)
+{
+    _flags = flags;
+}
 
-    // find what the size of the file is by looking up the location of the cursor
-    // because the cursor is at the end, it gives the size directly in bytes
-    size_t fileSize = (size_t)file.tellg();
+//> load_shader
+// reads prefetch_shaders started, until their first load. Render thread only,
+// like the pipeline setup
+static std::unordered_map<std::string, std::future<std::vector<uint8_t>>> s_prefetchedShaders;
 
-    // spirv expects the buffer to be on uint32, so make sure to reserve a int
-    // vector big enough for the entire file
-    std::vector<uint32_t> buffer(fileSize / sizeof(uint32_t));
+void vkutil::prefetch_shaders(std::span<const char* const> filePaths)
+{
+    for (const char* filePath : filePaths) {
+        if (!s_prefetchedShaders.contains(filePath)) {
+            s_prefetchedShaders.emplace(filePath, Filesystem::ReadAsync(filePath));
+        }
+    }
+}
 
-    // put file cursor at beginning
-    file.seekg(0);
+bool vkutil::load_shader_module(const char* filePath,
+    VkDevice device,
+    VkShaderModule* outShaderModule,
+    ShaderReflection* outReflection)
+{
+    std::vector<uint8_t> prefetched;
+    auto it = s_prefetchedShaders.find(filePath);
+    if (it != s_prefetchedShaders.end()) {
+        prefetched = it->second.get();
+        s_prefetchedShaders.erase(it);
+    }
 
-    // load the entire file into the buffer
-    file.read((char*)buffer.data(), fileSize);
+    // spirv is read as uint32 words. The read bytes are heap allocated and the
+    // mapping starts on a page, so either way the words are used in place
+    MappedFile file;
+    std::span<const uint32_t> buffer;
+    if (!prefetched.empty()) {
+        buffer = std::span(reinterpret_cast<const uint32_t*>(prefetched.data()), prefetched.size() / sizeof(uint32_t));
+    } else {
+        // map the file, read once front to back by the reflection and the driver
+        if (!file.Open(filePath, MappedFile::Access::Sequential)) {
+            return false;
+        }
+        buffer = std::span(reinterpret_cast<const uint32_t*>(file.Data()), file.Size() / sizeof(uint32_t));
+    }
 
-    // now that the file is loaded into the buffer, we can close it
-    file.close();
+    // reflect the descriptor interface from the same words, so layouts never
+    // have to be written by hand to mirror the shader
+    if (outReflection && !reflect_shader_module(buffer, outReflection)) {
+        QS_CORE_ERROR("failed to reflect shader %s", filePath);
+        return false;
+    }
 
     // create a new shader module, using the buffer we loaded
     VkShaderModuleCreateInfo createInfo = {};
@@ -271,7 +310,7 @@ bool vkutil::load_shader_module(const char* filePath,
 
     // codeSize has to be in bytes, so multply the ints in the buffer by size of
     // int to know the real size of the buffer
-    createInfo.codeSize = buffer.size() * sizeof(uint32_t);
+    createInfo.codeSize = buffer.size_bytes();
     createInfo.pCode = buffer.data();
 
     // check that the creation goes well.
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "vk_types.h"
+#include "vk_reflection.h"
 
 namespace Quasar::Renderer {
 
@@ -17,6 +18,7 @@ public:
     VkPipelineDepthStencilStateCreateInfo _depthStencil;
     VkPipelineRenderingCreateInfo _renderInfo;
     VkFormat _colorAttachmentformat;
+    VkPipelineCreateFlags _flags;
 
 	PipelineBuilder(){ clear(); }
 
@@ -37,10 +39,18 @@ public:
 	void set_depth_format(VkFormat format);
 	void disable_depthtest();
     void enable_depthtest(bool depthWriteEnable,VkCompareOp op);
+    // slope scaled depth bias, negative values push depth away with reversed-Z
+    void set_depth_bias(float constantFactor, float slopeFactor);
+    // e.g. TransientDescriptorAllocator::pipeline_create_flags()
+    void set_create_flags(VkPipelineCreateFlags flags);
 };
 
 namespace vkutil {
-bool load_shader_module(const char* filePath, VkDevice device, VkShaderModule* outShaderModule);
+// starts reading the files in the background, all at once. The first
+// load_shader_module of each takes the bytes read instead of mapping the file
+void prefetch_shaders(std::span<const char* const> filePaths);
+// outReflection, when given, receives the bindings and push constants the module declares
+bool load_shader_module(const char* filePath, VkDevice device, VkShaderModule* outShaderModule, ShaderReflection* outReflection = nullptr);
 }
 
 }
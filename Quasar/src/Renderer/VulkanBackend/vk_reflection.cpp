@@ -0,0 +1,496 @@
+#include "vk_reflection.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> spirv_defs
+// the handful of SPIR-V enums the reflection needs, values from the SPIR-V 1.6 spec
+namespace spv {
+constexpr uint32_t MagicNumber = 0x07230203;
+
+enum Op : uint32_t {
+    OpEntryPoint = 15,
+    OpTypeBool = 20,
+    OpTypeInt = 21,
+    OpTypeFloat = 22,
+    OpTypeVector = 23,
+    OpTypeMatrix = 24,
+    OpTypeImage = 25,
+    OpTypeSampler = 26,
+    OpTypeSampledImage = 27,
+    OpTypeArray = 28,
+    OpTypeRuntimeArray = 29,
+    OpTypeStruct = 30,
+    OpTypePointer = 32,
+    OpConstant = 43,
+    OpSpecConstant = 50,
+    OpVariable = 59,
+    OpDecorate = 71,
+    OpMemberDecorate = 72,
+    OpTypeAccelerationStructureKHR = 5341,
+};
+
+enum Decoration : uint32_t {
+    DecorationBlock = 2,
+    DecorationBufferBlock = 3,
+    DecorationArrayStride = 6,
+    DecorationMatrixStride = 7,
+    DecorationBinding = 33,
+    DecorationDescriptorSet = 34,
+    DecorationOffset = 35,
+};
+
+enum StorageClass : uint32_t {
+    StorageClassUniformConstant = 0,
+    StorageClassUniform = 2,
+    StorageClassPushConstant = 9,
+    StorageClassStorageBuffer = 12,
+    StorageClassPhysicalStorageBuffer = 5349,
+};
+
+enum ExecutionModel : uint32_t {
+    ExecutionModelVertex = 0,
+    ExecutionModelTessellationControl = 1,
+    ExecutionModelTessellationEvaluation = 2,
+    ExecutionModelGeometry = 3,
+    ExecutionModelFragment = 4,
+    ExecutionModelGLCompute = 5,
+};
+
+enum Dim : uint32_t {
+    DimBuffer = 5,
+    DimSubpassData = 6,
+};
+} // namespace spv
+//< spirv_defs
+
+namespace {
+
+// everything the parser remembers about a single SPIR-V id
+struct SpirvId {
+    uint32_t opcode = 0;
+    // type id for variables/constants, element/pointee type for composite types
+    uint32_t typeId = 0;
+    uint32_t storageClass = 0;
+    // scalar width, vector/matrix component count, array length id or constant value
+    uint32_t value = 0;
+    // image dim and sampled operands
+    uint32_t dim = 0;
+    uint32_t sampled = 0;
+
+    uint32_t set = UINT32_MAX;
+    uint32_t binding = UINT32_MAX;
+    uint32_t arrayStride = 0;
+    bool block = false;
+    bool bufferBlock = false;
+
+    // struct members
+    std::vector<uint32_t> members;
+    std::vector<uint32_t> memberOffsets;
+    std::vector<uint32_t> memberMatrixStrides;
+};
+
+struct SpirvModule {
+    std::vector<SpirvId> ids;
+    uint32_t executionModel = UINT32_MAX;
+
+    uint32_t type_size(uint32_t typeId, uint32_t matrixStride = 0) const;
+    uint32_t struct_size(const SpirvId& type) const;
+    VkDescriptorType descriptor_type(const SpirvId& variable, const SpirvId& resource) const;
+};
+
+uint32_t SpirvModule::type_size(uint32_t typeId, uint32_t matrixStride) const
+{
+    const SpirvId& type = ids[typeId];
+    switch (type.opcode) {
+    case spv::OpTypeBool:
+    case spv::OpTypeInt:
+    case spv::OpTypeFloat:
+        //booleans are 32 bit when they appear in buffers
+        return type.opcode == spv::OpTypeBool ? 4 : type.value / 8;
+    case spv::OpTypeVector:
+        return type.value * type_size(type.typeId);
+    case spv::OpTypeMatrix:
+        if (matrixStride != 0) {
+            return type.value * matrixStride;
+        }
+        return type.value * type_size(type.typeId);
+    case spv::OpTypeArray: {
+        uint32_t length = ids[type.value].value;
+        if (type.arrayStride != 0) {
+            return length * type.arrayStride;
+        }
+        return length * type_size(type.typeId, matrixStride);
+    }
+    case spv::OpTypeRuntimeArray:
+        return 0;
+    case spv::OpTypeStruct:
+        return struct_size(type);
+    case spv::OpTypePointer:
+        //buffer device address pointers
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+uint32_t SpirvModule::struct_size(const SpirvId& type) const
+{
+    uint32_t size = 0;
+    for (size_t i = 0; i < type.members.size(); i++) {
+        uint32_t end = type.memberOffsets[i] + type_size(type.members[i], type.memberMatrixStrides[i]);
+        size = std::max(size, end);
+    }
+    return size;
+}
+
+VkDescriptorType SpirvModule::descriptor_type(const SpirvId& variable, const SpirvId& resource) const
+{
+    switch (resource.opcode) {
+    case spv::OpTypeSampler:
+        return VK_DESCRIPTOR_TYPE_SAMPLER;
+    case spv::OpTypeSampledImage:
+        return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    case spv::OpTypeImage:
+        if (resource.dim == spv::DimBuffer) {
+            return resource.sampled == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+        }
+        if (resource.dim == spv::DimSubpassData) {
+            return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+        }
+        return resource.sampled == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    case spv::OpTypeAccelerationStructureKHR:
+        return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+    case spv::OpTypeStruct:
+        //pre 1.3 SPIR-V marks storage buffers as Uniform + BufferBlock
+        if (variable.storageClass == spv::StorageClassStorageBuffer || resource.bufferBlock) {
+            return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
+        return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    default:
+        return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+}
+
+VkShaderStageFlagBits stage_from_execution_model(uint32_t model)
+{
+    switch (model) {
+    case spv::ExecutionModelVertex: return VK_SHADER_STAGE_VERTEX_BIT;
+    case spv::ExecutionModelTessellationControl: return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+    case spv::ExecutionModelTessellationEvaluation: return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+    case spv::ExecutionModelGeometry: return VK_SHADER_STAGE_GEOMETRY_BIT;
+    case spv::ExecutionModelFragment: return VK_SHADER_STAGE_FRAGMENT_BIT;
+    case spv::ExecutionModelGLCompute: return VK_SHADER_STAGE_COMPUTE_BIT;
+    default: return VK_SHADER_STAGE_ALL;
+    }
+}
+
+} // namespace
+
+//> reflect_module
+bool vkutil::reflect_shader_module(std::span<const uint32_t> code, ShaderReflection* outReflection)
+{
+    if (code.size() < 5 || code[0] != spv::MagicNumber) {
+        QS_CORE_ERROR("reflect_shader_module: not a SPIR-V binary");
+        return false;
+    }
+
+    SpirvModule module;
+    // word 3 of the header is the id bound, every id is smaller than it
+    module.ids.resize(code[3]);
+
+    auto valid_id = [&](uint32_t id) { return id < module.ids.size(); };
+
+    //single pass over the instruction stream. SPIR-V guarantees that types,
+    //constants and decorations come before any function bodies, which we skip over
+    size_t offset = 5;
+    while (offset < code.size()) {
+        uint32_t wordCount = code[offset] >> 16;
+        uint32_t opcode = code[offset] & 0xffff;
+        const uint32_t* op = &code[offset];
+
+        if (wordCount == 0 || offset + wordCount > code.size()) {
+            QS_CORE_ERROR("reflect_shader_module: malformed instruction at word %zu", offset);
+            return false;
+        }
+
+        //every case checks wordCount against the last operand it reads, a
+        //truncated instruction would otherwise read the next one's words
+        switch (opcode) {
+        case spv::OpEntryPoint:
+            //first entry point wins, pipelines only use "main"
+            if (module.executionModel == UINT32_MAX && wordCount >= 2) {
+                module.executionModel = op[1];
+            }
+            break;
+        case spv::OpTypeBool:
+        case spv::OpTypeSampler:
+        case spv::OpTypeAccelerationStructureKHR:
+            if (wordCount >= 2 && valid_id(op[1])) module.ids[op[1]].opcode = opcode;
+            break;
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+            if (wordCount >= 3 && valid_id(op[1])) {
+                module.ids[op[1]].opcode = opcode;
+                module.ids[op[1]].value = op[2];
+            }
+            break;
+        case spv::OpTypeVector:
+        case spv::OpTypeMatrix:
+            if (wordCount >= 4 && valid_id(op[1])) {
+                module.ids[op[1]].opcode = opcode;
+                module.ids[op[1]].typeId = op[2];
+                module.ids[op[1]].value = op[3];
+            }
+            break;
+        case spv::OpTypeImage:
+            if (wordCount >= 8 && valid_id(op[1])) {
+                module.ids[op[1]].opcode = opcode;
+                module.ids[op[1]].typeId = op[2];
+                module.ids[op[1]].dim = op[3];
+                module.ids[op[1]].sampled = op[7];
+            }
+            break;
+        case spv::OpTypeSampledImage:
+        case spv::OpTypeRuntimeArray:
+            if (wordCount >= 3 && valid_id(op[1])) {
+                module.ids[op[1]].opcode = opcode;
+                module.ids[op[1]].typeId = op[2];
+            }
+            break;
+        case spv::OpTypeArray:
+            if (wordCount >= 4 && valid_id(op[1])) {
+                module.ids[op[1]].opcode = opcode;
+                module.ids[op[1]].typeId = op[2];
+                //length is the id of a constant
+                module.ids[op[1]].value = op[3];
+            }
+            break;
+        case spv::OpTypeStruct:
+            if (wordCount >= 2 && valid_id(op[1])) {
+                SpirvId& type = module.ids[op[1]];
+                type.opcode = opcode;
+                type.members.assign(op + 2, op + wordCount);
+                //decorations may have already been seen, only grow the arrays
+                type.memberOffsets.resize(type.members.size(), 0);
+                type.memberMatrixStrides.resize(type.members.size(), 0);
+            }
+            break;
+        case spv::OpTypePointer:
+            if (wordCount >= 4 && valid_id(op[1])) {
+                module.ids[op[1]].opcode = opcode;
+                module.ids[op[1]].storageClass = op[2];
+                module.ids[op[1]].typeId = op[3];
+            }
+            break;
+        case spv::OpConstant:
+        case spv::OpSpecConstant:
+            //only the low word matters, array lengths never exceed 32 bits
+            if (wordCount >= 3 && valid_id(op[2])) {
+                module.ids[op[2]].opcode = opcode;
+                module.ids[op[2]].typeId = op[1];
+                module.ids[op[2]].value = wordCount > 3 ? op[3] : 0;
+            }
+            break;
+        case spv::OpVariable:
+            if (wordCount >= 4 && valid_id(op[2])) {
+                module.ids[op[2]].opcode = opcode;
+                module.ids[op[2]].typeId = op[1];
+                module.ids[op[2]].storageClass = op[3];
+            }
+            break;
+        case spv::OpDecorate:
+            if (wordCount >= 3 && valid_id(op[1])) {
+                SpirvId& target = module.ids[op[1]];
+                //only some decorations carry a literal in op[3]
+                bool literal = wordCount >= 4;
+                switch (op[2]) {
+                case spv::DecorationDescriptorSet: if (literal) target.set = op[3]; break;
+                case spv::DecorationBinding: if (literal) target.binding = op[3]; break;
+                case spv::DecorationBlock: target.block = true; break;
+                case spv::DecorationBufferBlock: target.bufferBlock = true; break;
+                case spv::DecorationArrayStride: if (literal) target.arrayStride = op[3]; break;
+                default: break;
+                }
+            }
+            break;
+        case spv::OpMemberDecorate:
+            if (wordCount >= 5 && valid_id(op[1])) {
+                SpirvId& target = module.ids[op[1]];
+                uint32_t member = op[2];
+                if (member >= target.memberOffsets.size()) {
+                    target.memberOffsets.resize(member + 1, 0);
+                    target.memberMatrixStrides.resize(member + 1, 0);
+                }
+                if (op[3] == spv::DecorationOffset) {
+                    target.memberOffsets[member] = op[4];
+                } else if (op[3] == spv::DecorationMatrixStride) {
+                    target.memberMatrixStrides[member] = op[4];
+                }
+            }
+            break;
+        default:
+            break;
+        }
+
+        offset += wordCount;
+    }
+
+    ShaderReflection reflection {};
+    reflection.stage = stage_from_execution_model(module.executionModel);
+    reflection.pushConstants = { .stageFlags = (VkShaderStageFlags)reflection.stage, .offset = 0, .size = 0 };
+
+    for (const SpirvId& variable : module.ids) {
+        if (variable.opcode != spv::OpVariable) {
+            continue;
+        }
+
+        const SpirvId& pointer = module.ids[variable.typeId];
+        if (pointer.opcode != spv::OpTypePointer) {
+            continue;
+        }
+
+        if (variable.storageClass == spv::StorageClassPushConstant) {
+            const SpirvId& block = module.ids[pointer.typeId];
+            if (block.opcode != spv::OpTypeStruct || block.members.empty()) {
+                continue;
+            }
+            //the range starts at the first member, shaders may skip the start with layout(offset = x)
+            uint32_t begin = *std::min_element(block.memberOffsets.begin(), block.memberOffsets.end());
+            reflection.pushConstants.offset = begin;
+            reflection.pushConstants.size = module.struct_size(block) - begin;
+            continue;
+        }
+
+        if (variable.storageClass != spv::StorageClassUniformConstant
+            && variable.storageClass != spv::StorageClassUniform
+            && variable.storageClass != spv::StorageClassStorageBuffer) {
+            continue;
+        }
+
+        //strip arrays of resources down to the resource itself
+        uint32_t count = 1;
+        uint32_t resourceId = pointer.typeId;
+        if (module.ids[resourceId].opcode == spv::OpTypeArray) {
+            count = module.ids[module.ids[resourceId].value].value;
+            resourceId = module.ids[resourceId].typeId;
+        } else if (module.ids[resourceId].opcode == spv::OpTypeRuntimeArray) {
+            count = 0;
+            resourceId = module.ids[resourceId].typeId;
+        }
+
+        VkDescriptorType type = module.descriptor_type(variable, module.ids[resourceId]);
+        if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) {
+            continue;
+        }
+
+        ReflectedBinding binding;
+        binding.set = variable.set == UINT32_MAX ? 0 : variable.set;
+        binding.binding = variable.binding == UINT32_MAX ? 0 : variable.binding;
+        binding.type = type;
+        binding.count = count;
+        binding.stageFlags = reflection.stage;
+        reflection.bindings.push_back(binding);
+    }
+
+    std::sort(reflection.bindings.begin(), reflection.bindings.end(), [](const ReflectedBinding& a, const ReflectedBinding& b) {
+        return a.set != b.set ? a.set < b.set : a.binding < b.binding;
+    });
+
+    *outReflection = std::move(reflection);
+    return true;
+}
+//< reflect_module
+
+//> reflect_layout
+ReflectedPipelineLayout vkutil::build_reflected_layout(DescriptorLayoutCache& cache, std::span<const ShaderReflection> stages,
+    std::span<const VkDescriptorSetLayout> setOverrides, uint32_t runtimeArrayCount)
+{
+    //merge bindings across stages, keyed by set then binding
+    std::vector<std::vector<VkDescriptorSetLayoutBinding>> sets;
+    std::vector<std::vector<VkDescriptorBindingFlags>> setFlags;
+
+    ReflectedPipelineLayout result {};
+    result.pushConstants = { .stageFlags = 0, .offset = UINT32_MAX, .size = 0 };
+    uint32_t pushConstantEnd = 0;
+
+    for (const ShaderReflection& stage : stages) {
+        for (const ReflectedBinding& b : stage.bindings) {
+            if (b.set >= sets.size()) {
+                sets.resize(b.set + 1);
+                setFlags.resize(b.set + 1);
+            }
+
+            auto& bindings = sets[b.set];
+            auto it = std::find_if(bindings.begin(), bindings.end(), [&](const VkDescriptorSetLayoutBinding& existing) {
+                return existing.binding == b.binding;
+            });
+
+            if (it != bindings.end()) {
+                if (it->descriptorType != b.type) {
+                    QS_CORE_ERROR("build_reflected_layout: set %u binding %u is declared with different types across stages", b.set, b.binding);
+                }
+                it->stageFlags |= b.stageFlags;
+                continue;
+            }
+
+            VkDescriptorSetLayoutBinding newbind {};
+            newbind.binding = b.binding;
+            newbind.descriptorType = b.type;
+            newbind.descriptorCount = b.count == 0 ? runtimeArrayCount : b.count;
+            newbind.stageFlags = b.stageFlags;
+            bindings.push_back(newbind);
+
+            //runtime arrays are only ever partially written
+            setFlags[b.set].push_back(b.count == 0 ? VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT : 0);
+        }
+
+        if (stage.pushConstants.size > 0) {
+            result.pushConstants.stageFlags |= stage.pushConstants.stageFlags;
+            result.pushConstants.offset = std::min(result.pushConstants.offset, stage.pushConstants.offset);
+            pushConstantEnd = std::max(pushConstantEnd, stage.pushConstants.offset + stage.pushConstants.size);
+        }
+    }
+
+    //one range covering every stage keeps the layout compatible with pipelines
+    //whose stages use different parts of the same block
+    if (pushConstantEnd > 0) {
+        result.pushConstants.size = pushConstantEnd - result.pushConstants.offset;
+    } else {
+        result.pushConstants.offset = 0;
+    }
+
+    size_t setCount = std::max(sets.size(), setOverrides.size());
+    result.setLayouts.resize(setCount);
+    for (size_t i = 0; i < setCount; i++) {
+        if (i < setOverrides.size() && setOverrides[i] != VK_NULL_HANDLE) {
+            result.setLayouts[i] = setOverrides[i];
+            continue;
+        }
+
+        //gaps get the (shared) empty layout so set numbers stay stable
+        static const std::vector<VkDescriptorSetLayoutBinding> noBindings;
+        const auto& bindings = i < sets.size() ? sets[i] : noBindings;
+
+        bool anyFlags = i < setFlags.size()
+            && std::any_of(setFlags[i].begin(), setFlags[i].end(), [](VkDescriptorBindingFlags f) { return f != 0; });
+
+        std::span<const VkDescriptorBindingFlags> flags;
+        if (anyFlags) {
+            flags = setFlags[i];
+        }
+        result.setLayouts[i] = cache.create_descriptor_layout(bindings, flags);
+    }
+
+    std::span<const VkPushConstantRange> ranges;
+    if (result.pushConstants.size > 0) {
+        ranges = std::span<const VkPushConstantRange>(&result.pushConstants, 1);
+    }
+    result.layout = cache.create_pipeline_layout(result.setLayouts, ranges);
+
+    return result;
+}
+//< reflect_layout
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_descriptors.h"
+
+namespace Quasar::Renderer {
+
+//> reflect_types
+struct ReflectedBinding {
+    uint32_t set;
+    uint32_t binding;
+    VkDescriptorType type;
+    // number of array elements, 0 for runtime sized arrays
+    uint32_t count;
+    VkShaderStageFlags stageFlags;
+};
+
+// resource interface of a single SPIR-V module
+struct ShaderReflection {
+    VkShaderStageFlagBits stage;
+    std::vector<ReflectedBinding> bindings;
+    // size is 0 when the shader declares no push constants
+    VkPushConstantRange pushConstants;
+};
+
+// pipeline layout merged from every stage of a pipeline
+struct ReflectedPipelineLayout {
+    VkPipelineLayout layout;
+    std::vector<VkDescriptorSetLayout> setLayouts;
+    VkPushConstantRange pushConstants;
+};
+//< reflect_types
+
+namespace vkutil {
+// parses the descriptor bindings, push constant block and stage out of a SPIR-V binary
+bool reflect_shader_module(std::span<const uint32_t> code, ShaderReflection* outReflection);
+
+// merges the stages into one layout per set plus a single push constant range, and
+// fetches them through the cache so identical pipelines share the same handles.
+// a non null entry in setOverrides replaces the reflected layout of that set.
+// runtime sized arrays in reflected sets get runtimeArrayCount descriptors
+ReflectedPipelineLayout build_reflected_layout(DescriptorLayoutCache& cache, std::span<const ShaderReflection> stages,
+    std::span<const VkDescriptorSetLayout> setOverrides = {}, uint32_t runtimeArrayCount = 1);
+} // namespace vkutil
+
+}
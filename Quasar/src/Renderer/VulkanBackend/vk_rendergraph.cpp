@@ -0,0 +1,759 @@
+#include "vk_rendergraph.h"
+#include "vk_initializers.h"
+
+#include <qspch.h>
+
+#include <sstream>
+
+namespace Quasar::Renderer {
+
+//> rg_init
+void RenderGraph::init(VkDevice device, VkPhysicalDevice physicalDevice, VmaAllocator allocator, uint32_t framesInFlight,
+    uint32_t graphicsFamily, uint32_t computeFamily)
+{
+    _device = device;
+    _allocator = allocator;
+    _framesInFlight = framesInFlight;
+    _graphicsFamily = graphicsFamily;
+    _computeFamily = computeFamily;
+
+    _queryCounts.assign(framesInFlight, 0);
+    _timedPasses.assign(framesInFlight, {});
+
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(physicalDevice, &props);
+    _timestampPeriod = props.limits.timestampPeriod;
+
+    //without timestamp support the graph just runs untimed
+    if (!props.limits.timestampComputeAndGraphics) {
+        QS_CORE_WARN("Device has no graphics timestamps, render graph passes won't be timed");
+        return;
+    }
+
+    VkQueryPoolCreateInfo queryInfo = {.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO};
+    queryInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryInfo.queryCount = MaxTimedPasses * 2 * framesInFlight;
+    VK_CHECK(vkCreateQueryPool(_device, &queryInfo, nullptr, &_queryPool));
+}
+
+void RenderGraph::destroy()
+{
+    destroy_physical(_physical);
+    for (auto& [frame, set] : _retired) {
+        destroy_physical(set);
+    }
+    _retired.clear();
+
+    if (_queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(_device, _queryPool, nullptr);
+        _queryPool = VK_NULL_HANDLE;
+    }
+}
+
+void RenderGraph::begin_frame(uint64_t frameNumber, uint32_t frameSlot)
+{
+    _frameNumber = frameNumber;
+    _frameSlot = frameSlot;
+
+    _passes.clear();
+    _resources.clear();
+    _order.clear();
+    _segments.clear();
+    _transfers.clear();
+    _discards.clear();
+
+    //a set retired in frame F was last used by frame F - 1, which is done once
+    //we are framesInFlight frames past it
+    while (!_retired.empty() && _retired.front().first + _framesInFlight <= frameNumber + 1) {
+        destroy_physical(_retired.front().second);
+        _retired.pop_front();
+    }
+
+    //the frame that last used this slot has completed, so its timestamps are available
+    uint32_t queryCount = _queryCounts[frameSlot];
+    if (_queryPool == VK_NULL_HANDLE || queryCount == 0) {
+        return;
+    }
+
+    _queryResults.resize(queryCount);
+    VkResult result = vkGetQueryPoolResults(_device, _queryPool, frameSlot * MaxTimedPasses * 2, queryCount,
+        _queryResults.size() * sizeof(uint64_t), _queryResults.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+    if (result != VK_SUCCESS) {
+        return;
+    }
+
+    const std::vector<std::string>& names = _timedPasses[frameSlot];
+    _timings.clear();
+    for (size_t i = 0; i < names.size(); i++) {
+        uint64_t ticks = _queryResults[i * 2 + 1] - _queryResults[i * 2];
+        _timings.push_back(PassTiming { .name = names[i], .milliseconds = float(ticks * _timestampPeriod / 1000000.0) });
+    }
+
+    if (timingCallback) {
+        timingCallback(_timings);
+    }
+}
+//< rg_init
+
+//> rg_declare
+RenderGraph::Resource RenderGraph::import_image(const std::string& name, TrackedImage& image, VkImageView view, VkExtent3D extent)
+{
+    ResourceNode& node = _resources.emplace_back();
+    node.name = name;
+    node.imported = true;
+    node.importedImage = &image;
+    node.importedView = view;
+    node.desc.extent = extent;
+    node.desc.mipLevels = image.mipLevels;
+    node.desc.arrayLayers = image.arrayLayers;
+    node.desc.aspect = image.aspect;
+    return Resource(_resources.size() - 1);
+}
+
+RenderGraph::Resource RenderGraph::import_buffer(const std::string& name, TrackedBuffer& buffer)
+{
+    ResourceNode& node = _resources.emplace_back();
+    node.name = name;
+    node.imported = true;
+    node.isBuffer = true;
+    node.importedBuffer = &buffer;
+    return Resource(_resources.size() - 1);
+}
+
+RenderGraph::Resource RenderGraph::create_image(const std::string& name, const RGImageDesc& desc)
+{
+    ResourceNode& node = _resources.emplace_back();
+    node.name = name;
+    node.desc = desc;
+    return Resource(_resources.size() - 1);
+}
+
+void RenderGraph::add_pass(const std::string& name, const std::function<void(PassBuilder&)>& setup, ExecuteFn execute)
+{
+    Pass& pass = _passes.emplace_back();
+    pass.name = name;
+    pass.execute = std::move(execute);
+
+    PassBuilder builder(*this, uint32_t(_passes.size() - 1));
+    setup(builder);
+}
+
+RenderGraph::Resource RenderGraph::PassBuilder::read(Resource resource, ResourceAccess access)
+{
+    assert(!vkutil::is_write_access(access) && "use write() for accesses that write");
+    _graph._passes[_pass].uses.push_back(ResourceUse { .resource = resource, .access = access, .writes = false, .reads = true });
+    return resource;
+}
+
+RenderGraph::Resource RenderGraph::PassBuilder::write(Resource resource, ResourceAccess access)
+{
+    //read-modify-write accesses also depend on whatever was there before
+    AccessInfo info = vkutil::access_info(access);
+    bool alsoReads = (info.access & (VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT)) != 0;
+
+    _graph._passes[_pass].uses.push_back(ResourceUse { .resource = resource, .access = access, .writes = true, .reads = alsoReads });
+    return resource;
+}
+
+void RenderGraph::PassBuilder::side_effect()
+{
+    _graph._passes[_pass].sideEffect = true;
+}
+
+void RenderGraph::PassBuilder::async_compute()
+{
+    _graph._passes[_pass].asyncCompute = true;
+}
+//< rg_declare
+
+//> rg_compile
+void RenderGraph::compile()
+{
+    build_dependencies();
+    cull_passes();
+    sort_passes();
+    compute_lifetimes();
+    build_segments();
+
+    size_t signature = transient_signature();
+    if (signature != _physical.signature || _physical.images.empty()) {
+        //frames in flight may still use the old images, free them once those are done
+        if (!_physical.images.empty()) {
+            _retired.emplace_back(_frameNumber, std::move(_physical));
+            _physical = {};
+        }
+        allocate_transients();
+        _physical.signature = signature;
+    } else {
+        uint32_t next = 0;
+        for (ResourceNode& node : _resources) {
+            if (!node.imported && node.firstLevel != INVALID_ID) {
+                node.physical = next++;
+            }
+        }
+    }
+
+    //transient contents never survive, and their memory may have been used by
+    //another image a moment ago
+    for (PhysicalImage& physical : _physical.images) {
+        physical.tracked.reset(VK_IMAGE_LAYOUT_UNDEFINED, physical.aliasWaitStage);
+    }
+
+    _queryCounts[_frameSlot] = 0;
+    _timedPasses[_frameSlot].clear();
+}
+
+void RenderGraph::build_dependencies()
+{
+    //declaration order is submission order, hazards are found against it
+    std::vector<uint32_t> lastWriter(_resources.size(), INVALID_ID);
+    std::vector<std::vector<uint32_t>> readersSinceWrite(_resources.size());
+
+    auto add_unique = [](std::vector<uint32_t>& list, uint32_t value) {
+        if (std::find(list.begin(), list.end(), value) == list.end()) {
+            list.push_back(value);
+        }
+    };
+
+    for (uint32_t p = 0; p < _passes.size(); p++) {
+        Pass& pass = _passes[p];
+
+        for (const ResourceUse& use : pass.uses) {
+            uint32_t writer = lastWriter[use.resource];
+            if (use.reads && writer != INVALID_ID && writer != p) {
+                add_unique(pass.producers, writer);
+                add_unique(pass.dependencies, writer);
+            }
+            if (use.writes) {
+                if (writer != INVALID_ID && writer != p) {
+                    add_unique(pass.dependencies, writer);
+                }
+                for (uint32_t reader : readersSinceWrite[use.resource]) {
+                    if (reader != p) {
+                        add_unique(pass.dependencies, reader);
+                    }
+                }
+            }
+        }
+
+        for (const ResourceUse& use : pass.uses) {
+            if (use.writes) {
+                lastWriter[use.resource] = p;
+                readersSinceWrite[use.resource].clear();
+            } else {
+                readersSinceWrite[use.resource].push_back(p);
+            }
+        }
+    }
+}
+
+void RenderGraph::cull_passes()
+{
+    //roots are passes with visible results, everything they read from stays alive
+    std::vector<uint32_t> stack;
+    for (uint32_t p = 0; p < _passes.size(); p++) {
+        Pass& pass = _passes[p];
+        bool writesImported = std::any_of(pass.uses.begin(), pass.uses.end(), [&](const ResourceUse& use) {
+            return use.writes && _resources[use.resource].imported;
+        });
+
+        pass.culled = !(pass.sideEffect || writesImported);
+        if (!pass.culled) {
+            stack.push_back(p);
+        }
+    }
+
+    while (!stack.empty()) {
+        uint32_t p = stack.back();
+        stack.pop_back();
+        for (uint32_t producer : _passes[p].producers) {
+            if (_passes[producer].culled) {
+                _passes[producer].culled = false;
+                stack.push_back(producer);
+            }
+        }
+    }
+}
+
+void RenderGraph::sort_passes()
+{
+    //a pass runs one level after the deepest pass it depends on. Passes sharing a
+    //level are independent, so their barriers are flushed together. Within a
+    //level graphics goes first, so the level's async compute work overlaps with
+    //it instead of holding it up
+    for (uint32_t p = 0; p < _passes.size(); p++) {
+        Pass& pass = _passes[p];
+        if (pass.culled) {
+            continue;
+        }
+
+        pass.level = 0;
+        for (uint32_t dep : pass.dependencies) {
+            if (!_passes[dep].culled) {
+                pass.level = std::max(pass.level, _passes[dep].level + 1);
+            }
+        }
+        _order.push_back(p);
+    }
+
+    std::stable_sort(_order.begin(), _order.end(), [&](uint32_t a, uint32_t b) {
+        if (_passes[a].level != _passes[b].level) {
+            return _passes[a].level < _passes[b].level;
+        }
+        return !_passes[a].asyncCompute && _passes[b].asyncCompute;
+    });
+}
+
+static VkImageUsageFlags usage_for_access(ResourceAccess access)
+{
+    switch (access) {
+    case ResourceAccess::TransferRead: return VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    case ResourceAccess::TransferWrite: return VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    case ResourceAccess::ColorAttachmentWrite:
+    case ResourceAccess::ColorAttachmentReadWrite: return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    case ResourceAccess::DepthAttachmentRead:
+    case ResourceAccess::DepthAttachmentWrite: return VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    case ResourceAccess::ComputeShaderWrite:
+    case ResourceAccess::ComputeShaderReadWrite: return VK_IMAGE_USAGE_STORAGE_BIT;
+    case ResourceAccess::VertexShaderRead:
+    case ResourceAccess::FragmentShaderRead:
+    case ResourceAccess::ComputeShaderRead:
+    case ResourceAccess::AnyShaderRead: return VK_IMAGE_USAGE_SAMPLED_BIT;
+    default: return 0;
+    }
+}
+
+void RenderGraph::compute_lifetimes()
+{
+    //_order is sorted by level, so the first use seen is in the lowest level
+    for (uint32_t p : _order) {
+        const Pass& pass = _passes[p];
+        for (const ResourceUse& use : pass.uses) {
+            ResourceNode& node = _resources[use.resource];
+            if (node.imported) {
+                continue;
+            }
+
+            if (node.firstLevel == INVALID_ID) {
+                node.firstLevel = pass.level;
+                if (!use.writes) {
+                    QS_CORE_WARN("Render graph pass '%s' reads transient image '%s' before anything wrote it",
+                        pass.name.c_str(), node.name.c_str());
+                }
+            }
+            node.lastLevel = pass.level;
+            node.asyncCompute |= pass.asyncCompute;
+            node.usage |= usage_for_access(use.access);
+            node.stages |= vkutil::access_info(use.access).stage;
+        }
+    }
+}
+
+void RenderGraph::build_segments()
+{
+    for (uint32_t i = 0; i < _order.size(); i++) {
+        bool async = _passes[_order[i]].asyncCompute;
+        if (_segments.empty() || _segments.back().asyncCompute != async) {
+            _segments.push_back(Segment { .asyncCompute = async, .begin = i });
+        }
+        _segments.back().end = i + 1;
+    }
+
+    //segment each resource was last used in, in execution order
+    std::vector<uint32_t> lastSegment(_resources.size(), INVALID_ID);
+    for (uint32_t s = 0; s < _segments.size(); s++) {
+        Segment& segment = _segments[s];
+        uint32_t family = segment.asyncCompute ? _computeFamily : _graphicsFamily;
+
+        for (uint32_t i = segment.begin; i < segment.end; i++) {
+            for (const ResourceUse& use : _passes[_order[i]].uses) {
+                uint32_t& last = lastSegment[use.resource];
+                if (last == s) {
+                    continue;
+                }
+
+                const ResourceNode& node = _resources[use.resource];
+                VkPipelineStageFlags2 stage = vkutil::access_info(use.access).stage;
+                if (last != INVALID_ID && _segments[last].asyncCompute != segment.asyncCompute) {
+                    //the segments alternate, so the latest one covers every earlier one
+                    segment.waitSegment = segment.waitSegment == INVALID_ID ? last : std::max(segment.waitSegment, last);
+                    segment.waitStage |= stage;
+                    _transfers.push_back(Transfer { .resource = use.resource, .from = last, .to = s, .access = use.access });
+                } else if (last == INVALID_ID && node.imported) {
+                    //the last frame's release was never recorded, it didn't know
+                    uint32_t owner = node.isBuffer ? node.importedBuffer->queueFamily : node.importedImage->queueFamily;
+                    if (owner != VK_QUEUE_FAMILY_IGNORED && owner != family) {
+                        segment.waitPreviousFrame = true;
+                        segment.waitStage |= stage;
+                        _discards.emplace_back(s, use.resource);
+                    }
+                }
+                last = s;
+            }
+        }
+    }
+}
+
+size_t RenderGraph::transient_signature() const
+{
+    size_t hash = 0;
+    auto combine = [&hash](size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+
+    for (const ResourceNode& node : _resources) {
+        if (node.imported || node.firstLevel == INVALID_ID) {
+            continue;
+        }
+        combine(node.desc.format);
+        combine(node.desc.extent.width);
+        combine(node.desc.extent.height);
+        combine(node.desc.extent.depth);
+        combine(node.desc.mipLevels);
+        combine(node.desc.arrayLayers);
+        combine(node.usage);
+        combine(node.asyncCompute);
+        combine(node.firstLevel);
+        combine(node.lastLevel);
+    }
+    return hash;
+}
+//< rg_compile
+
+//> rg_alias
+void RenderGraph::allocate_transients()
+{
+    struct Candidate {
+        uint32_t resource;
+        VkImage image;
+        VkMemoryRequirements requirements;
+    };
+
+    struct Block {
+        VkMemoryRequirements requirements;
+        VkPipelineStageFlags2 stages = VK_PIPELINE_STAGE_2_NONE;
+        std::vector<uint32_t> residents;
+    };
+
+    std::vector<Candidate> candidates;
+    for (uint32_t r = 0; r < _resources.size(); r++) {
+        ResourceNode& node = _resources[r];
+        if (node.imported || node.firstLevel == INVALID_ID) {
+            continue;
+        }
+
+        VkImageCreateInfo imageInfo = vkinit::image_create_info(node.desc.format, node.usage, node.desc.extent);
+        imageInfo.mipLevels = node.desc.mipLevels;
+        imageInfo.arrayLayers = node.desc.arrayLayers;
+        //aliased images must not assume anything about what the memory held before
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        Candidate c { .resource = r };
+        VK_CHECK(vkCreateImage(_device, &imageInfo, nullptr, &c.image));
+        vkGetImageMemoryRequirements(_device, c.image, &c.requirements);
+        candidates.push_back(c);
+
+        node.physical = uint32_t(candidates.size() - 1);
+        _physical.unaliasedBytes += c.requirements.size;
+    }
+
+    //biggest first, so smaller images tuck into the memory of larger ones
+    std::vector<uint32_t> bySize(candidates.size());
+    for (uint32_t i = 0; i < bySize.size(); i++) {
+        bySize[i] = i;
+    }
+    std::stable_sort(bySize.begin(), bySize.end(), [&](uint32_t a, uint32_t b) {
+        return candidates[a].requirements.size > candidates[b].requirements.size;
+    });
+
+    //all barriers of a level are issued before its first pass, so images may only
+    //share memory when one is done a whole level before the other starts. The
+    //alias barrier only orders one queue, images used on the async compute queue
+    //get memory of their own
+    auto overlaps = [&](uint32_t a, uint32_t b) {
+        const ResourceNode& ra = _resources[a];
+        const ResourceNode& rb = _resources[b];
+        if (ra.asyncCompute || rb.asyncCompute) {
+            return true;
+        }
+        return ra.firstLevel <= rb.lastLevel && rb.firstLevel <= ra.lastLevel;
+    };
+
+    std::vector<Block> blocks;
+    std::vector<uint32_t> blockOf(candidates.size());
+    for (uint32_t c : bySize) {
+        const Candidate& candidate = candidates[c];
+
+        uint32_t chosen = INVALID_ID;
+        for (uint32_t b = 0; b < blocks.size() && chosen == INVALID_ID; b++) {
+            if ((blocks[b].requirements.memoryTypeBits & candidate.requirements.memoryTypeBits) == 0) {
+                continue;
+            }
+            bool free = std::none_of(blocks[b].residents.begin(), blocks[b].residents.end(), [&](uint32_t other) {
+                return overlaps(candidates[other].resource, candidate.resource);
+            });
+            if (free) {
+                chosen = b;
+            }
+        }
+
+        if (chosen == INVALID_ID) {
+            blocks.push_back(Block { .requirements = candidate.requirements });
+            chosen = uint32_t(blocks.size() - 1);
+        }
+
+        Block& block = blocks[chosen];
+        block.requirements.size = std::max(block.requirements.size, candidate.requirements.size);
+        block.requirements.alignment = std::max(block.requirements.alignment, candidate.requirements.alignment);
+        block.requirements.memoryTypeBits &= candidate.requirements.memoryTypeBits;
+        block.stages |= _resources[candidate.resource].stages;
+        block.residents.push_back(c);
+        blockOf[c] = chosen;
+    }
+
+    VmaAllocationCreateInfo allocInfo = {};
+    allocInfo.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+    for (const Block& block : blocks) {
+        VmaAllocation allocation;
+        VK_CHECK(vmaAllocateMemory(_allocator, &block.requirements, &allocInfo, &allocation, nullptr));
+        _physical.blocks.push_back(allocation);
+        _physical.memoryBytes += block.requirements.size;
+    }
+
+    _physical.images.resize(candidates.size());
+    for (uint32_t c = 0; c < candidates.size(); c++) {
+        const Candidate& candidate = candidates[c];
+        const ResourceNode& node = _resources[candidate.resource];
+        const Block& block = blocks[blockOf[c]];
+
+        PhysicalImage& physical = _physical.images[c];
+        physical.image.image = candidate.image;
+        physical.image.allocation = _physical.blocks[blockOf[c]];
+        physical.image.imageExtent = node.desc.extent;
+        physical.image.imageFormat = node.desc.format;
+        //the previous frame's residents of the block count as well
+        physical.aliasWaitStage = block.stages;
+
+        VK_CHECK(vmaBindImageMemory(_allocator, physical.image.allocation, physical.image.image));
+
+        VkImageViewCreateInfo viewInfo = vkinit::imageview_create_info(node.desc.format, physical.image.image, node.desc.aspect);
+        viewInfo.subresourceRange.levelCount = node.desc.mipLevels;
+        viewInfo.subresourceRange.layerCount = node.desc.arrayLayers;
+        if (node.desc.arrayLayers > 1) {
+            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+        }
+        VK_CHECK(vkCreateImageView(_device, &viewInfo, nullptr, &physical.image.imageView));
+
+        physical.tracked.init(physical.image.image, node.desc.aspect, node.desc.mipLevels, node.desc.arrayLayers);
+    }
+}
+
+void RenderGraph::destroy_physical(PhysicalSet& set)
+{
+    for (PhysicalImage& physical : set.images) {
+        vkDestroyImageView(_device, physical.image.imageView, nullptr);
+        vkDestroyImage(_device, physical.image.image, nullptr);
+    }
+    for (VmaAllocation block : set.blocks) {
+        vmaFreeMemory(_allocator, block);
+    }
+    set = {};
+}
+//< rg_alias
+
+//> rg_execute
+void RenderGraph::write_timestamp(VkCommandBuffer cmd, VkPipelineStageFlags2 stage)
+{
+    uint32_t query = _frameSlot * MaxTimedPasses * 2 + _queryCounts[_frameSlot]++;
+    vkCmdWriteTimestamp2(cmd, stage, _queryPool, query);
+}
+
+uint32_t& RenderGraph::queue_family(Resource resource)
+{
+    ResourceNode& node = _resources[resource];
+    if (node.isBuffer) {
+        return node.importedBuffer->queueFamily;
+    }
+    return node.imported ? node.importedImage->queueFamily : _physical.images[node.physical].tracked.queueFamily;
+}
+
+void RenderGraph::execute(uint32_t segmentIndex, VkCommandBuffer cmd, BarrierBatch& barriers)
+{
+    const Segment& segment = _segments[segmentIndex];
+    auto family_of = [&](uint32_t s) {
+        return _segments[s].asyncCompute ? _computeFamily : _graphicsFamily;
+    };
+
+    //the query pool is reset on the graphics queue, so only graphics passes are timed
+    bool timed = _queryPool != VK_NULL_HANDLE && !segment.asyncCompute;
+    bool firstGraphics = std::none_of(_segments.begin(), _segments.begin() + segmentIndex, [](const Segment& s) {
+        return !s.asyncCompute;
+    });
+    if (timed && firstGraphics) {
+        vkCmdResetQueryPool(cmd, _queryPool, _frameSlot * MaxTimedPasses * 2, MaxTimedPasses * 2);
+    }
+
+    auto transfer = [&](const Transfer& t, bool release) {
+        ResourceNode& node = _resources[t.resource];
+        uint32_t src = family_of(t.from);
+        uint32_t dst = family_of(t.to);
+        if (node.isBuffer && release) {
+            barriers.release_buffer(*node.importedBuffer, t.access, src, dst);
+        } else if (node.isBuffer) {
+            barriers.acquire_buffer(*node.importedBuffer, t.access, src, dst);
+        } else {
+            TrackedImage& image = node.imported ? *node.importedImage : _physical.images[node.physical].tracked;
+            if (release) {
+                barriers.release_image(image, t.access, src, dst);
+            } else {
+                barriers.acquire_image(image, t.access, src, dst);
+            }
+        }
+    };
+
+    //what comes from the other queue is taken over in a barrier call of its own,
+    //before the first level's barriers
+    for (const auto& [s, resource] : _discards) {
+        if (s != segmentIndex) {
+            continue;
+        }
+        ResourceNode& node = _resources[resource];
+        if (node.isBuffer) {
+            node.importedBuffer->state = ResourceState {};
+        } else {
+            node.importedImage->reset(VK_IMAGE_LAYOUT_UNDEFINED);
+        }
+    }
+    for (const Transfer& t : _transfers) {
+        if (t.to == segmentIndex) {
+            transfer(t, false);
+        }
+    }
+    barriers.flush(cmd);
+
+    for (uint32_t p = segment.begin; p < segment.end; p++) {
+        for (const ResourceUse& use : _passes[_order[p]].uses) {
+            queue_family(use.resource) = family_of(segmentIndex);
+        }
+    }
+
+    size_t i = segment.begin;
+    while (i < segment.end) {
+        //barriers for a whole level go out in one call
+        uint32_t level = _passes[_order[i]].level;
+        size_t end = i;
+        while (end < segment.end && _passes[_order[end]].level == level) {
+            for (const ResourceUse& use : _passes[_order[end]].uses) {
+                ResourceNode& node = _resources[use.resource];
+                if (node.isBuffer) {
+                    barriers.buffer(*node.importedBuffer, use.access);
+                } else if (node.imported) {
+                    barriers.image(*node.importedImage, use.access);
+                } else {
+                    barriers.image(_physical.images[node.physical].tracked, use.access);
+                }
+            }
+            end++;
+        }
+        barriers.flush(cmd);
+
+        for (; i < end; i++) {
+            Pass& pass = _passes[_order[i]];
+
+            bool timePass = timed && _timedPasses[_frameSlot].size() < MaxTimedPasses;
+            if (timePass) {
+                _timedPasses[_frameSlot].push_back(pass.name);
+                write_timestamp(cmd, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
+            }
+
+            if (pass.execute) {
+                pass.execute(cmd, *this);
+            }
+
+            if (timePass) {
+                write_timestamp(cmd, VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT);
+            }
+        }
+    }
+
+    //hand over what the other queue uses next
+    for (const Transfer& t : _transfers) {
+        if (t.from == segmentIndex) {
+            transfer(t, true);
+        }
+    }
+    barriers.flush(cmd);
+}
+
+VkImage RenderGraph::image(Resource resource) const
+{
+    const ResourceNode& node = _resources[resource];
+    return node.imported ? node.importedImage->image : _physical.images[node.physical].image.image;
+}
+
+VkImageView RenderGraph::view(Resource resource) const
+{
+    const ResourceNode& node = _resources[resource];
+    return node.imported ? node.importedView : _physical.images[node.physical].image.imageView;
+}
+
+VkBuffer RenderGraph::buffer(Resource resource) const
+{
+    return _resources[resource].importedBuffer->buffer;
+}
+//< rg_execute
+
+//> rg_graphviz
+std::string RenderGraph::to_graphviz() const
+{
+    std::ostringstream out;
+    out << "digraph RenderGraph {\n";
+    out << "    rankdir=LR;\n";
+
+    for (uint32_t p = 0; p < _passes.size(); p++) {
+        const Pass& pass = _passes[p];
+        out << "    pass" << p << " [shape=box, label=\"" << pass.name;
+        if (!pass.culled) {
+            out << "\\nlevel " << pass.level;
+        }
+        if (pass.asyncCompute) {
+            out << "\\nasync compute";
+        }
+        out << "\"";
+        if (pass.culled) {
+            out << ", style=dashed, fontcolor=gray";
+        }
+        out << "];\n";
+    }
+
+    for (uint32_t r = 0; r < _resources.size(); r++) {
+        const ResourceNode& node = _resources[r];
+        out << "    res" << r << " [shape=ellipse, label=\"" << node.name;
+        if (!node.imported && node.physical != INVALID_ID && node.physical < _physical.images.size()) {
+            out << "\\nphysical " << node.physical;
+        }
+        out << "\"";
+        if (node.imported) {
+            out << ", peripheries=2";
+        }
+        out << "];\n";
+    }
+
+    for (uint32_t p = 0; p < _passes.size(); p++) {
+        for (const ResourceUse& use : _passes[p].uses) {
+            if (use.writes) {
+                out << "    pass" << p << " -> res" << use.resource << " [color=red];\n";
+            }
+            if (use.reads) {
+                out << "    res" << use.resource << " -> pass" << p << ";\n";
+            }
+        }
+    }
+
+    out << "}\n";
+    return out.str();
+}
+//< rg_graphviz
+
+}
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_barriers.h"
+
+namespace Quasar::Renderer {
+
+//> rendergraph_types
+struct RGImageDesc {
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    VkExtent3D extent = { 0, 0, 1 };
+    uint32_t mipLevels = 1;
+    uint32_t arrayLayers = 1;
+    VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+};
+
+struct PassTiming {
+    std::string name;
+    float milliseconds;
+};
+//< rendergraph_types
+
+//> rendergraph
+// Declarative frame graph, rebuilt every frame:
+//
+//   graph.begin_frame(frameNumber, frameSlot);
+//   auto color = graph.import_image("swapchain", trackedImage);
+//   graph.add_pass("clear", [&](RenderGraph::PassBuilder& pass) {
+//       pass.write(color, ResourceAccess::TransferWrite);
+//   }, [=](VkCommandBuffer cmd, const RenderGraph& g) { ... });
+//   graph.compile();
+//   for (uint32_t s = 0; s < graph.segments().size(); s++) {
+//       graph.execute(s, cmdForTheSegmentsQueue, barriers);
+//   }
+//
+// Passes run in dependency order. Passes whose results nothing reads are culled,
+// barriers come from the declared accesses, and transient images whose lifetimes
+// don't overlap share memory. Transient images never keep their contents across
+// frames.
+//
+// Passes marked async_compute() run on the async compute queue. The compiled
+// passes are split into segments wherever the queue changes, and every segment
+// is submitted on its own queue. Resources moving between the queues get queue
+// family ownership transfers, and each segment says which earlier submit of the
+// other queue it has to wait for.
+class RenderGraph {
+public:
+    using Resource = uint32_t;
+    using ExecuteFn = std::function<void(VkCommandBuffer cmd, const RenderGraph& graph)>;
+
+    class PassBuilder {
+    public:
+        Resource read(Resource resource, ResourceAccess access);
+        Resource write(Resource resource, ResourceAccess access);
+        // keeps the pass even when nothing reads what it writes
+        void side_effect();
+        // runs the pass on the async compute queue. Only for compute dispatches
+        void async_compute();
+
+    private:
+        friend class RenderGraph;
+        PassBuilder(RenderGraph& graph, uint32_t pass) : _graph(graph), _pass(pass) {}
+
+        RenderGraph& _graph;
+        uint32_t _pass;
+    };
+
+    // passes that run back to back on one queue, a range of the execution order
+    struct Segment {
+        bool asyncCompute = false;
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        // latest earlier segment of the other queue whose work this one has to
+        // wait for, INVALID_ID when there is none
+        uint32_t waitSegment = INVALID_ID;
+        // uses a resource the other queue last used in an earlier frame, so it has
+        // to wait for everything the other queue submitted before this frame
+        bool waitPreviousFrame = false;
+        // stages of this segment that wait for the other queue
+        VkPipelineStageFlags2 waitStage = VK_PIPELINE_STAGE_2_NONE;
+    };
+
+    static constexpr uint32_t MaxTimedPasses = 64;
+
+    // graphicsFamily and computeFamily are the queue families segments are
+    // submitted to, they may be the same
+    void init(VkDevice device, VkPhysicalDevice physicalDevice, VmaAllocator allocator, uint32_t framesInFlight,
+        uint32_t graphicsFamily, uint32_t computeFamily);
+    void destroy();
+
+    // starts a new graph. The previous use of frameSlot has completed, so its pass
+    // timings are read back here and transient memory retired by then is freed
+    void begin_frame(uint64_t frameNumber, uint32_t frameSlot);
+
+    // resources the graph doesn't own. Writing one counts as a side effect
+    Resource import_image(const std::string& name, TrackedImage& image, VkImageView view = VK_NULL_HANDLE, VkExtent3D extent = { 0, 0, 1 });
+    Resource import_buffer(const std::string& name, TrackedBuffer& buffer);
+    // images the graph allocates, only valid between the first and last pass using them
+    Resource create_image(const std::string& name, const RGImageDesc& desc);
+
+    void add_pass(const std::string& name, const std::function<void(PassBuilder&)>& setup, ExecuteFn execute);
+
+    void compile();
+    std::span<const Segment> segments() const { return _segments; }
+    // records one segment into a command buffer of its queue. Segments are
+    // executed in order, each submitted before the next one is executed
+    void execute(uint32_t segment, VkCommandBuffer cmd, BarrierBatch& barriers);
+
+    VkImage image(Resource resource) const;
+    VkImageView view(Resource resource) const;
+    VkBuffer buffer(Resource resource) const;
+    const RGImageDesc& desc(Resource resource) const { return _resources[resource].desc; }
+
+    // the compiled graph in graphviz dot format, culled passes are dashed
+    std::string to_graphviz() const;
+
+    // gpu time of every pass of the last frame read back in begin_frame(). Passes
+    // on the async compute queue are not timed, they overlap with graphics
+    std::span<const PassTiming> timings() const { return _timings; }
+    // called from begin_frame() whenever new timings are available
+    std::function<void(std::span<const PassTiming>)> timingCallback;
+
+    // bytes of device memory the transient images use, and what they would use without aliasing
+    VkDeviceSize transient_memory() const { return _physical.memoryBytes; }
+    VkDeviceSize transient_memory_unaliased() const { return _physical.unaliasedBytes; }
+
+private:
+    struct ResourceUse {
+        Resource resource;
+        ResourceAccess access;
+        bool writes;
+        bool reads;
+    };
+
+    struct Pass {
+        std::string name;
+        std::vector<ResourceUse> uses;
+        ExecuteFn execute;
+        bool sideEffect = false;
+        bool asyncCompute = false;
+        bool culled = false;
+        uint32_t level = 0;
+
+        // passes whose writes this pass reads
+        std::vector<uint32_t> producers;
+        // every earlier pass this one has to run after: producers plus
+        // write-after-read and write-after-write hazards
+        std::vector<uint32_t> dependencies;
+    };
+
+    struct ResourceNode {
+        std::string name;
+        bool imported = false;
+        bool isBuffer = false;
+        RGImageDesc desc;
+        TrackedImage* importedImage = nullptr;
+        VkImageView importedView = VK_NULL_HANDLE;
+        TrackedBuffer* importedBuffer = nullptr;
+
+        // filled by compile() for transient images. The lifetime is in levels,
+        // as execute() flushes the barriers of a level before any of its passes run
+        VkImageUsageFlags usage = 0;
+        VkPipelineStageFlags2 stages = VK_PIPELINE_STAGE_2_NONE;
+        uint32_t firstLevel = INVALID_ID;
+        uint32_t lastLevel = 0;
+        // used on the async compute queue
+        bool asyncCompute = false;
+        uint32_t physical = INVALID_ID;
+    };
+
+    struct PhysicalImage {
+        AllocatedImage image;
+        TrackedImage tracked;
+        // everything that may have touched this memory before, the first use waits on it
+        VkPipelineStageFlags2 aliasWaitStage;
+    };
+
+    // transient images and the memory blocks they are bound into
+    struct PhysicalSet {
+        std::vector<PhysicalImage> images;
+        std::vector<VmaAllocation> blocks;
+        size_t signature = 0;
+        VkDeviceSize memoryBytes = 0;
+        VkDeviceSize unaliasedBytes = 0;
+    };
+
+    void build_dependencies();
+    void cull_passes();
+    void sort_passes();
+    void compute_lifetimes();
+    void build_segments();
+    size_t transient_signature() const;
+    void allocate_transients();
+    void destroy_physical(PhysicalSet& set);
+    void write_timestamp(VkCommandBuffer cmd, VkPipelineStageFlags2 stage);
+    uint32_t& queue_family(Resource resource);
+
+    VkDevice _device;
+    VmaAllocator _allocator;
+    uint32_t _framesInFlight;
+    uint32_t _graphicsFamily;
+    uint32_t _computeFamily;
+    uint64_t _frameNumber = 0;
+    uint32_t _frameSlot = 0;
+
+    std::vector<Pass> _passes;
+    std::vector<ResourceNode> _resources;
+    // live passes in execution order
+    std::vector<uint32_t> _order;
+    std::vector<Segment> _segments;
+
+    // a resource changing queues between two segments, released at the end of
+    // the first and acquired for access at the start of the second
+    struct Transfer {
+        Resource resource;
+        uint32_t from;
+        uint32_t to;
+        ResourceAccess access;
+    };
+    std::vector<Transfer> _transfers;
+    // resources the other queue last used in an earlier frame. Their contents
+    // are not carried over, the segment starts them from scratch
+    std::vector<std::pair<uint32_t, Resource>> _discards;
+
+    PhysicalSet _physical;
+    // sets replaced while frames in flight may still use them, with the frame they were replaced in
+    std::deque<std::pair<uint64_t, PhysicalSet>> _retired;
+
+    VkQueryPool _queryPool = VK_NULL_HANDLE;
+    float _timestampPeriod = 0.f;
+    // per frame slot: how many timestamps were written and the names of the timed passes
+    std::vector<uint32_t> _queryCounts;
+    std::vector<std::vector<std::string>> _timedPasses;
+    std::vector<uint64_t> _queryResults;
+    std::vector<PassTiming> _timings;
+};
+//< rendergraph
+
+}
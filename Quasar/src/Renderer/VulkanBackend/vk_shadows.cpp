@@ -0,0 +1,329 @@
+#include "vk_shadows.h"
+#include "vk_initializers.h"
+#include "vk_pipelines.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> shadows_init
+void CascadedShadows::init(VkDevice device, VmaAllocator allocator, DescriptorLayoutCache& layoutCache, BindlessRegistry& bindless)
+{
+    _device = device;
+    _allocator = allocator;
+
+    //one layer per cascade, rendered through per layer views and sampled through
+    //the bindless set
+    _shadowMap.imageFormat = Format;
+    _shadowMap.imageExtent = { ShadowMapSize, ShadowMapSize, 1 };
+
+    VkImageCreateInfo imageInfo = vkinit::image_create_info(Format,
+        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, _shadowMap.imageExtent);
+    imageInfo.arrayLayers = CascadeCount;
+
+    VmaAllocationCreateInfo allocInfo = {};
+    allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+    allocInfo.requiredFlags = VkMemoryPropertyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    VK_CHECK(vmaCreateImage(_allocator, &imageInfo, &allocInfo, &_shadowMap.image, &_shadowMap.allocation, nullptr));
+
+    VkImageViewCreateInfo viewInfo = vkinit::imageview_create_info(Format, _shadowMap.image, VK_IMAGE_ASPECT_DEPTH_BIT);
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    viewInfo.subresourceRange.layerCount = CascadeCount;
+    VK_CHECK(vkCreateImageView(_device, &viewInfo, nullptr, &_shadowMap.imageView));
+
+    _shadowMapState.init(_shadowMap.image, VK_IMAGE_ASPECT_DEPTH_BIT, 1, CascadeCount);
+
+    //reversed-Z: lit where the fragment is at least as close to the sun as the
+    //stored depth. Outside the map the border depth of 0 leaves everything lit
+    VkSamplerCreateInfo samplerInfo = {.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+    samplerInfo.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+    samplerInfo.compareEnable = VK_TRUE;
+    samplerInfo.compareOp = VK_COMPARE_OP_GREATER_OR_EQUAL;
+    VK_CHECK(vkCreateSampler(_device, &samplerInfo, nullptr, &_compareSampler));
+    _samplerIndex = bindless.register_sampler(_compareSampler);
+
+    for (uint32_t i = 0; i < CascadeCount; i++) {
+        VkImageViewCreateInfo layerInfo = vkinit::imageview_create_info(Format, _shadowMap.image, VK_IMAGE_ASPECT_DEPTH_BIT);
+        layerInfo.subresourceRange.baseArrayLayer = i;
+        VK_CHECK(vkCreateImageView(_device, &layerInfo, nullptr, &_layerViews[i]));
+        _textureIndices[i] = bindless.register_texture(_layerViews[i]);
+    }
+
+    //the depth prepass shader draws the casters, with the cascade's matrix as the
+    //scene's viewproj
+    VkShaderModule shadowVertexShader;
+    ShaderReflection shadowReflection;
+    if (!vkutil::load_shader_module("Assets/shaders/Builtin.DepthPrepass.vert.spv", _device, &shadowVertexShader, &shadowReflection)) {
+        QS_CORE_ERROR("Error when building the shadow vertex shader module");
+    }
+
+    _pipeline.layout = vkutil::build_reflected_layout(layoutCache, std::span(&shadowReflection, 1)).layout;
+
+    PipelineBuilder pipelineBuilder;
+    pipelineBuilder._pipelineLayout = _pipeline.layout;
+    pipelineBuilder._shaderStages.push_back(
+        vkinit::pipeline_shader_stage_create_info(VK_SHADER_STAGE_VERTEX_BIT, shadowVertexShader));
+    pipelineBuilder.set_input_topology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+    pipelineBuilder.set_polygon_mode(VK_POLYGON_MODE_FILL);
+    pipelineBuilder.set_cull_mode(VK_CULL_MODE_NONE, VK_FRONT_FACE_CLOCKWISE);
+    pipelineBuilder.set_multisampling_none();
+    pipelineBuilder.disable_blending();
+    pipelineBuilder.enable_depthtest(true, VK_COMPARE_OP_GREATER_OR_EQUAL);
+    pipelineBuilder.set_depth_bias(-2.f, -2.5f);
+    pipelineBuilder.set_depth_format(Format);
+
+    _pipeline.pipeline = pipelineBuilder.build_pipeline(_device);
+
+    vkDestroyShaderModule(_device, shadowVertexShader, nullptr);
+}
+
+void CascadedShadows::destroy()
+{
+    //the layout belongs to the layout cache, the bindless indices go with the set
+    vkDestroyPipeline(_device, _pipeline.pipeline, nullptr);
+    vkDestroySampler(_device, _compareSampler, nullptr);
+
+    for (VkImageView view : _layerViews) {
+        vkDestroyImageView(_device, view, nullptr);
+    }
+    vkDestroyImageView(_device, _shadowMap.imageView, nullptr);
+    vmaDestroyImage(_allocator, _shadowMap.image, _shadowMap.allocation);
+}
+
+void CascadedShadows::invalidate()
+{
+    for (ShadowCascade& cascade : _cascades) {
+        cascade.cacheValid = false;
+    }
+}
+//< shadows_init
+
+//> shadows_update
+uint64_t CascadedShadows::static_scene_hash(std::span<const RenderObject> objects)
+{
+    //FNV-1a over everything that decides where a static surface casts
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&](const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+
+    for (const RenderObject& object : objects) {
+        if (!object.isStatic) {
+            continue;
+        }
+        mix(&object.indexBuffer, sizeof(object.indexBuffer));
+        mix(&object.shadowFirstIndex, sizeof(object.shadowFirstIndex));
+        mix(&object.shadowIndexCount, sizeof(object.shadowIndexCount));
+        mix(&object.transform, sizeof(object.transform));
+    }
+    return hash;
+}
+
+void CascadedShadows::fit_cascade(uint32_t index, const glm::mat4& invView, glm::vec2 tanHalfFov,
+    float splitNear, float splitFar, glm::vec3 lightDirection)
+{
+    ShadowCascade& cascade = _cascades[index];
+    cascade.splitFar = splitFar;
+
+    //corners of the frustum slice in world space
+    std::array<glm::vec3, 8> corners;
+    for (uint32_t i = 0; i < 8; i++) {
+        float depth = (i & 4) ? splitFar : splitNear;
+        glm::vec2 corner = glm::vec2((i & 1) ? 1.f : -1.f, (i & 2) ? 1.f : -1.f) * tanHalfFov * depth;
+        corners[i] = glm::vec3(invView * glm::vec4(corner, -depth, 1.f));
+    }
+
+    glm::vec3 center(0.f);
+    for (const glm::vec3& corner : corners) {
+        center += corner;
+    }
+    center /= 8.f;
+
+    //the bounding sphere doesn't change with the camera's rotation, rounding keeps
+    //float noise from changing it either
+    float radius = 0.f;
+    for (const glm::vec3& corner : corners) {
+        radius = std::max(radius, glm::length(corner - center));
+    }
+    radius = std::ceil(radius * 16.f) / 16.f;
+
+    glm::vec3 up = std::abs(lightDirection.y) > 0.99f ? glm::vec3(0.f, 0.f, 1.f) : glm::vec3(0.f, 1.f, 0.f);
+    glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.f), -lightDirection, up);
+
+    //cached cascades move in coarse steps, so they only re-render every few meters.
+    //the margin keeps the slice covered between steps
+    bool cached = index >= FirstCachedCascade;
+    float extent = cached ? radius * 1.25f : radius;
+    float texelSize = 2.f * extent / ShadowMapSize;
+    float step = cached ? std::ceil(radius * 0.25f / texelSize) * texelSize : texelSize;
+
+    glm::vec3 lightSpaceCenter = glm::vec3(lightRotation * glm::vec4(center, 1.f));
+    lightSpaceCenter.x = std::floor(lightSpaceCenter.x / step) * step;
+    lightSpaceCenter.y = std::floor(lightSpaceCenter.y / step) * step;
+    if (cached) {
+        lightSpaceCenter.z = std::floor(lightSpaceCenter.z / step) * step;
+    }
+    center = glm::vec3(glm::inverse(lightRotation) * glm::vec4(lightSpaceCenter, 1.f));
+
+    //the eye sits casterDistance behind the slice, so casters between the sun and
+    //the slice still land in the map. near and far are swapped for reversed-Z
+    float depthRange = casterDistance + 2.f * extent;
+    glm::vec3 eye = center + lightDirection * (casterDistance + extent);
+    cascade.view = glm::lookAt(eye, center, up);
+    glm::mat4 projection = glm::ortho(-extent, extent, -extent, extent, depthRange, 0.f);
+    cascade.viewProj = projection * cascade.view;
+    cascade.extent = extent;
+
+    if (cached) {
+        bool moved = !cascade.cacheValid
+            || center != cascade.cachedCenter
+            || lightDirection != cascade.cachedLightDirection
+            || extent != cascade.cachedExtent;
+        cascade.dirty = cascade.dirty || moved;
+        cascade.cachedCenter = center;
+        cascade.cachedLightDirection = lightDirection;
+        cascade.cachedExtent = extent;
+    } else {
+        cascade.dirty = true;
+    }
+}
+
+void CascadedShadows::cull_casters(uint32_t index, std::span<const RenderObject> objects, bool staticOnly)
+{
+    ShadowCascade& cascade = _cascades[index];
+    cascade.casters.clear();
+
+    float depthRange = casterDistance + 2.f * cascade.extent;
+    for (uint32_t i = 0; i < (uint32_t)objects.size(); i++) {
+        if (staticOnly && !objects[i].isStatic) {
+            continue;
+        }
+
+        //the box of the orthographic projection against the bounding sphere
+        glm::vec4 sphere = _spheres[i];
+        glm::vec3 center = glm::vec3(cascade.view * glm::vec4(glm::vec3(sphere), 1.f));
+        float radius = sphere.w;
+
+        bool visible = std::abs(center.x) <= cascade.extent + radius
+            && std::abs(center.y) <= cascade.extent + radius
+            && -center.z + radius >= 0.f
+            && -center.z - radius <= depthRange;
+        if (visible) {
+            cascade.casters.push_back(i);
+        }
+    }
+}
+
+void CascadedShadows::update(GPUSceneData& sceneData, UniformRing& uniformRing, std::span<const RenderObject> objects, float znear)
+{
+    sceneData.shadowCascades = enabled ? CascadeCount : 0;
+    sceneData.shadowTextures = _textureIndices;
+    sceneData.shadowSampler = _samplerIndex;
+    if (!enabled) {
+        for (ShadowCascade& cascade : _cascades) {
+            cascade.dirty = false;
+        }
+        return;
+    }
+
+    _spheres.resize(objects.size());
+    for (size_t i = 0; i < objects.size(); i++) {
+        const RenderObject& object = objects[i];
+        glm::vec3 center = glm::vec3(object.transform * glm::vec4(object.bounds.origin, 1.f));
+        float scale = std::max({ glm::length(glm::vec3(object.transform[0])),
+            glm::length(glm::vec3(object.transform[1])),
+            glm::length(glm::vec3(object.transform[2])) });
+        _spheres[i] = glm::vec4(center, object.bounds.sphereRadius * scale);
+    }
+
+    //sunlightDirection points at the sun
+    glm::vec3 lightDirection = glm::normalize(glm::vec3(sceneData.sunlightDirection));
+    glm::mat4 invView = glm::inverse(sceneData.view);
+    glm::vec2 tanHalfFov = glm::vec2(1.f / sceneData.proj[0][0], 1.f / std::abs(sceneData.proj[1][1]));
+
+    uint64_t sceneHash = static_scene_hash(objects);
+
+    float splitNear = znear;
+    for (uint32_t i = 0; i < CascadeCount; i++) {
+        ShadowCascade& cascade = _cascades[i];
+
+        //practical split scheme, a blend of logarithmic and uniform splits
+        float t = float(i + 1) / CascadeCount;
+        float logSplit = znear * std::pow(shadowDistance / znear, t);
+        float uniformSplit = znear + (shadowDistance - znear) * t;
+        float splitFar = splitLambda * logSplit + (1.f - splitLambda) * uniformSplit;
+
+        bool cached = i >= FirstCachedCascade;
+        cascade.dirty = cached && cascade.cachedSceneHash != sceneHash;
+        fit_cascade(i, invView, tanHalfFov, splitNear, splitFar, lightDirection);
+
+        if (cascade.dirty) {
+            cull_casters(i, objects, cached);
+            cascade.cachedSceneHash = sceneHash;
+            cascade.cacheValid = true;
+
+            GPUSceneData cascadeScene = sceneData;
+            cascadeScene.viewproj = cascade.viewProj;
+            cascade.sceneData = uniformRing.push(cascadeScene).address;
+        }
+
+        sceneData.shadowMatrices[i] = cascade.viewProj;
+        sceneData.cascadeSplits[i] = splitFar;
+        splitNear = splitFar;
+    }
+}
+//< shadows_update
+
+//> shadows_render
+void CascadedShadows::render(VkCommandBuffer cmd, std::span<const RenderObject> objects)
+{
+    VkExtent2D extent = { ShadowMapSize, ShadowMapSize };
+
+    for (uint32_t i = 0; i < CascadeCount; i++) {
+        const ShadowCascade& cascade = _cascades[i];
+        if (!cascade.dirty) {
+            continue;
+        }
+
+        VkRenderingAttachmentInfo depthAttachment = vkinit::depth_attachment_info(_layerViews[i], VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL);
+        VkRenderingInfo renderInfo = vkinit::rendering_info(extent, nullptr, &depthAttachment);
+        vkCmdBeginRendering(cmd, &renderInfo);
+
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipeline.pipeline);
+
+        VkViewport viewport = { 0.f, 0.f, (float)ShadowMapSize, (float)ShadowMapSize, 0.f, 1.f };
+        vkCmdSetViewport(cmd, 0, 1, &viewport);
+        VkRect2D scissor = { { 0, 0 }, extent };
+        vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+        for (uint32_t index : cascade.casters) {
+            const RenderObject& draw = objects[index];
+
+            vkCmdBindIndexBuffer(cmd, draw.indexBuffer, 0, draw.indexType);
+
+            GPUDrawPushConstants pushConstants;
+            pushConstants.worldMatrix = draw.transform;
+            pushConstants.vertexBuffer = draw.vertexBufferAddress;
+            pushConstants.sceneData = cascade.sceneData;
+            pushConstants.materialIndex = draw.material->materialIndex;
+            pushConstants.vertexFormat = draw.vertexFormat;
+            vkCmdPushConstants(cmd, _pipeline.layout, VK_SHADER_STAGE_VERTEX_BIT, 0, DrawPushConstantsSize, &pushConstants);
+
+            vkCmdDrawIndexed(cmd, draw.shadowIndexCount, 1, draw.shadowFirstIndex, 0, 0);
+        }
+
+        vkCmdEndRendering(cmd);
+    }
+}
+//< shadows_render
+
+}
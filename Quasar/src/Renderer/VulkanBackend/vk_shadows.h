@@ -0,0 +1,105 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_barriers.h"
+#include "vk_bindless.h"
+#include "vk_descriptors.h"
+#include "vk_uniform_ring.h"
+
+namespace Quasar::Renderer {
+
+//> shadow_types
+struct ShadowCascade {
+    // world to shadow map, reversed-Z
+    glm::mat4 viewProj;
+    glm::mat4 view;
+    // half the width of the square the cascade covers, in world units
+    float extent;
+    // view depth where the cascade ends
+    float splitFar;
+
+    // rendered this frame. Cached cascades only render when their key changes
+    bool dirty = true;
+    // indices of the surfaces that cast into this cascade
+    std::vector<uint32_t> casters;
+    // scene data with the cascade's matrix as viewproj, for the depth-only shader
+    VkDeviceAddress sceneData;
+
+    // what the cached contents were rendered with
+    glm::vec3 cachedCenter;
+    glm::vec3 cachedLightDirection;
+    float cachedExtent;
+    uint64_t cachedSceneHash = 0;
+    bool cacheValid = false;
+};
+//< shadow_types
+
+//> cascaded_shadows
+// Cascaded shadow maps for the sun.
+//
+// The part of the view frustum up to shadowDistance is split into CascadeCount
+// slices, and each slice gets a square orthographic projection around its bounding
+// sphere. The sphere keeps the size of a cascade constant while the camera turns,
+// and snapping its center to whole shadow map texels keeps the edges from
+// shimmering while the camera moves.
+//
+// Cascades from FirstCachedCascade on only hold surfaces flagged isStatic. They snap
+// to a coarser grid and are only re-rendered when that snapped position, the light
+// direction or the static surfaces change, so far shadows cost nothing most frames.
+// Every cascade culls its casters on its own.
+class CascadedShadows {
+public:
+    static constexpr uint32_t CascadeCount = 4;
+    static constexpr uint32_t FirstCachedCascade = 2;
+    static constexpr uint32_t ShadowMapSize = 2048;
+    static constexpr VkFormat Format = VK_FORMAT_D32_SFLOAT;
+
+    bool enabled = true;
+    // view distance the last cascade ends at
+    float shadowDistance = 250.f;
+    // blend between uniform (0) and logarithmic (1) cascade splits
+    float splitLambda = 0.75f;
+    // how far behind a cascade casters are still caught
+    float casterDistance = 200.f;
+
+    void init(VkDevice device, VmaAllocator allocator, DescriptorLayoutCache& layoutCache, BindlessRegistry& bindless);
+    void destroy();
+
+    // fits the cascades to the camera in sceneData, culls and uploads the per
+    // cascade scene data, and writes the shadow fields of sceneData
+    void update(GPUSceneData& sceneData, UniformRing& uniformRing, std::span<const RenderObject> objects, float znear);
+
+    // renders the dirty cascades, objects is what update() got
+    void render(VkCommandBuffer cmd, std::span<const RenderObject> objects);
+
+    // forces the cached cascades to render again
+    void invalidate();
+
+    TrackedImage& shadow_map() { return _shadowMapState; }
+    const ShadowCascade& cascade(uint32_t index) const { return _cascades[index]; }
+
+private:
+    void fit_cascade(uint32_t index, const glm::mat4& invView, glm::vec2 tanHalfFov,
+        float splitNear, float splitFar, glm::vec3 lightDirection);
+    void cull_casters(uint32_t index, std::span<const RenderObject> objects, bool staticOnly);
+    static uint64_t static_scene_hash(std::span<const RenderObject> objects);
+
+    VkDevice _device;
+    VmaAllocator _allocator;
+
+    AllocatedImage _shadowMap;
+    TrackedImage _shadowMapState;
+    std::array<VkImageView, CascadeCount> _layerViews;
+    VkSampler _compareSampler;
+    glm::uvec4 _textureIndices;
+    uint32_t _samplerIndex;
+
+    MaterialPipeline _pipeline;
+
+    std::array<ShadowCascade, CascadeCount> _cascades;
+    // world space bounding spheres of this frame's objects
+    std::vector<glm::vec4> _spheres;
+};
+//< cascaded_shadows
+
+}
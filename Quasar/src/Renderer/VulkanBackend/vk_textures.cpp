@@ -0,0 +1,762 @@
+#include "vk_textures.h"
+
+#include "backend.h"
+
+#include <Renderer/BlockCompression.h>
+#include <Core/Filesystem.h>
+#include <Core/ThreadPool.h>
+
+#include "stb_image.h"
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> texture_cache
+// the decoded or encoded mips of one image file, as written to the cache
+// directory. The levels follow the header, mip 0 first, each TextureLevelSize bytes
+struct TextureCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    // the source file the pixels were decoded from, as Filesystem::Stat has it
+    uint64_t sourceSize;
+    int64_t sourceTime;
+    // a TextureFormat
+    uint32_t format;
+    // always the full chain
+    uint32_t levelCount;
+};
+
+static constexpr uint32_t TextureCacheMagic = 0x58455451; // "QTEX"
+static constexpr uint32_t TextureCacheVersion = 4;
+
+static std::filesystem::path cache_path(const std::string& path)
+{
+    //FNV-1a, stable between runs unlike std::hash
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash = (hash ^ uint8_t(c)) * 1099511628211ull;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.qtex", (unsigned long long)hash);
+    return std::filesystem::path(TextureLoader::CacheDirectory) / name;
+}
+
+static void write_cache(const std::filesystem::path& path, const TextureCacheHeader& header,
+    std::span<const UploadQueue::ImageLevel> levels)
+{
+    //written next to the entry and renamed over it, so a reader never sees half a file
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const UploadQueue::ImageLevel& level : levels) {
+            file.write(static_cast<const char*>(level.data), level.size);
+        }
+        if (!file) {
+            return;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+}
+//< texture_cache
+
+static const char* format_name(TextureFormat format)
+{
+    switch (format) {
+    case TextureFormat::RGBA8: return "RGBA8";
+    case TextureFormat::RGBA8_SRGB: return "RGBA8 sRGB";
+    case TextureFormat::BC1: return "BC1";
+    case TextureFormat::BC1_SRGB: return "BC1 sRGB";
+    case TextureFormat::BC3: return "BC3";
+    case TextureFormat::BC3_SRGB: return "BC3 sRGB";
+    case TextureFormat::BC5: return "BC5";
+    case TextureFormat::BC7: return "BC7";
+    case TextureFormat::BC7_SRGB: return "BC7 sRGB";
+    }
+    return "unknown";
+}
+
+// starts reading the levels that are mapped from file in the background, so
+// their pages are in by the time a worker copies them to staging
+static void prefetch_levels(const MappedFile& file, std::span<const UploadQueue::ImageLevel> levels)
+{
+    if (!file.IsOpen()) {
+        return;
+    }
+    for (const UploadQueue::ImageLevel& level : levels) {
+        // levels decoded from a ktx2 live in memory instead
+        const uint8_t* begin = static_cast<const uint8_t*>(level.data);
+        if (begin >= file.Data() && begin < file.Data() + file.Size()) {
+            file.Advise(uint64_t(begin - file.Data()), level.size, MappedFile::Access::WillNeed);
+        }
+    }
+}
+
+// the encoded bytes of source, in memory or mapped into file. False when the
+// file can't be opened or the range lies outside it
+static bool source_bytes(const TextureLoader::Source& source, MappedFile& file, MappedFile::Access access,
+    const uint8_t*& bytes, uint64_t& size)
+{
+    if (!source.bytes.empty()) {
+        bytes = source.bytes.data();
+        size = source.bytes.size();
+        return true;
+    }
+
+    if (!file.Open(source.path, access) || source.offset >= file.Size()) {
+        return false;
+    }
+    uint64_t available = file.Size() - source.offset;
+    if (source.size > available) {
+        return false;
+    }
+    bytes = file.Data() + source.offset;
+    size = source.size > 0 ? source.size : available;
+    return true;
+}
+
+// first mip that fits in TextureLoader::TailSize
+static uint32_t tail_mip(uint32_t width, uint32_t height, uint32_t levelCount)
+{
+    uint32_t mip = 0;
+    while (mip + 1 < levelCount && std::max(MipExtent(width, mip), MipExtent(height, mip)) > TextureLoader::TailSize) {
+        mip++;
+    }
+    return mip;
+}
+
+//> texture_loader
+void TextureLoader::init(Backend* engine, uint32_t placeholderIndex, uint32_t errorIndex)
+{
+    _engine = engine;
+    _placeholderIndex = placeholderIndex;
+    _errorIndex = errorIndex;
+
+    std::error_code error;
+    std::filesystem::create_directories(CacheDirectory, error);
+}
+
+void TextureLoader::destroy()
+{
+    // the workers hold on to their textures until the upload callbacks ran
+    while (_loading > 0) {
+        _engine->_uploads.flush();
+        std::this_thread::yield();
+    }
+
+    for (auto& [path, texture] : _textures) {
+        if (texture->loaded) {
+            _engine->destroy_image(texture->image);
+        }
+    }
+    _textures.clear();
+    _byIndex.clear();
+    _references.clear();
+    _freeHandles.clear();
+    _committedBytes = 0;
+
+    for (auto& [frame, image] : _pendingDestroy) {
+        _engine->destroy_image(image);
+    }
+    _pendingDestroy.clear();
+}
+
+TextureLoader::Handle TextureLoader::load(const Source& source, std::function<void(uint32_t index)>&& onChanged)
+{
+    std::string path = source.path;
+    if (!source.bytes.empty()) {
+        path += "#memory" + std::to_string(source.offset);
+    } else if (source.offset > 0 || source.size > 0) {
+        path += "#" + std::to_string(source.offset);
+    }
+
+    Handle handle;
+    if (!_freeHandles.empty()) {
+        handle = _freeHandles.back();
+        _freeHandles.pop_back();
+    } else {
+        handle = Handle(_references.size());
+        _references.emplace_back();
+    }
+
+    std::shared_ptr<Texture> texture;
+    auto it = _textures.find(path);
+    if (it != _textures.end()) {
+        texture = it->second;
+    } else {
+        texture = std::make_shared<Texture>();
+        texture->path = path;
+        texture->source = source;
+        texture->index = _placeholderIndex;
+        _textures[path] = texture;
+
+        _loading++;
+        bool full = !streaming.enabled;
+        QS_THREAD_POOL.Enqueue([this, texture, full]() mutable { decode(std::move(texture), full); });
+    }
+
+    texture->handles.push_back(handle);
+    _references[handle] = Reference { texture, std::move(onChanged) };
+
+    // loaded, or failed for good, for an earlier reference
+    if (texture->index != _placeholderIndex && _references[handle].onChanged) {
+        std::function<void(uint32_t index)> changed = _references[handle].onChanged;
+        changed(texture->index);
+    }
+    return handle;
+}
+
+void TextureLoader::release(Handle handle)
+{
+    if (handle >= _references.size() || !_references[handle].texture) {
+        return;
+    }
+
+    std::shared_ptr<Texture> texture = std::move(_references[handle].texture);
+    _references[handle] = {};
+    _freeHandles.push_back(handle);
+
+    std::erase(texture->handles, handle);
+    if (!texture->handles.empty()) {
+        return;
+    }
+
+    _textures.erase(texture->path);
+    texture->released = true;
+
+    // an image still being uploaded is destroyed when it arrives
+    if (texture->streamingMip != INVALID_ID) {
+        _committedBytes -= texture->streamingBytes;
+    } else if (texture->loaded) {
+        _committedBytes -= texture->residentBytes;
+    }
+
+    if (texture->loaded) {
+        // frames up to the current one may still sample the image
+        uint64_t frame = _engine->_frameNumber;
+        _byIndex.erase(texture->index);
+        _engine->_bindless.release_texture(texture->index, frame);
+        _pendingDestroy.emplace_back(frame, texture->image);
+        texture->loaded = false;
+    }
+}
+
+uint32_t TextureLoader::index(Handle handle) const
+{
+    if (handle >= _references.size() || !_references[handle].texture) {
+        return _errorIndex;
+    }
+    return _references[handle].texture->index;
+}
+
+bool TextureLoader::is_loaded(Handle handle) const
+{
+    return handle < _references.size() && _references[handle].texture && _references[handle].texture->loaded;
+}
+
+void TextureLoader::collect(uint64_t completedFrame)
+{
+    while (!_pendingDestroy.empty() && _pendingDestroy.front().first <= completedFrame) {
+        _engine->destroy_image(_pendingDestroy.front().second);
+        _pendingDestroy.pop_front();
+    }
+}
+
+std::shared_ptr<TextureLoader::TextureData> TextureLoader::read_cache(const std::filesystem::path& path, TextureFormat format,
+    uint64_t sourceSize, int64_t sourceTime)
+{
+    // a miss is the common case on a first run, not worth an error
+    if (!Filesystem::Exists(path.string())) {
+        return nullptr;
+    }
+
+    // mips are read a few at a time as they stream in
+    auto data = std::make_shared<TextureData>();
+    if (!data->file.Open(path.string(), MappedFile::Access::Random) || data->file.Size() < sizeof(TextureCacheHeader)) {
+        return nullptr;
+    }
+
+    TextureCacheHeader header;
+    memcpy(&header, data->file.Data(), sizeof(header));
+    bool valid = header.magic == TextureCacheMagic && header.version == TextureCacheVersion
+        && header.sourceSize == sourceSize && header.sourceTime == sourceTime
+        && header.format == uint32_t(format) && header.width > 0 && header.height > 0
+        && header.levelCount == MipLevelCount(header.width, header.height);
+    if (!valid) {
+        return nullptr;
+    }
+
+    // the levels are used straight from the mapping
+    uint64_t offset = sizeof(header);
+    for (uint32_t level = 0; level < header.levelCount; level++) {
+        uint64_t size = TextureLevelSize(format, MipExtent(header.width, level), MipExtent(header.height, level));
+        if (offset + size > data->file.Size()) {
+            return nullptr;
+        }
+        data->levels.push_back({ data->file.Data() + offset, size_t(size) });
+        offset += size;
+    }
+    if (offset != data->file.Size()) {
+        return nullptr;
+    }
+
+    data->format = format;
+    data->width = header.width;
+    data->height = header.height;
+    return data;
+}
+
+void TextureLoader::decode(std::shared_ptr<Texture> texture, bool full)
+{
+    UploadQueue& uploads = _engine->_uploads;
+
+    const Source& source = texture->source;
+    Filesystem::FileInfo sourceInfo;
+    if (!Filesystem::Stat(source.path, sourceInfo)) {
+        QS_CORE_ERROR("Failed to load texture %s", texture->path.c_str());
+        uploads.on_complete([this, texture = std::move(texture)]() { finish_load(texture, nullptr, {}, 0); });
+        return;
+    }
+    // of the whole file for a range, which changes along with it
+    uint64_t sourceSize = sourceInfo.size;
+    int64_t sourceTime = sourceInfo.modified;
+
+    // the TextureConverter's output next to the source wins while it is up to date
+    Source read = source;
+    std::filesystem::path path = source.path;
+    std::filesystem::path converted = std::filesystem::path(path).replace_extension(".ktx2");
+    Filesystem::FileInfo convertedInfo;
+    bool wholeFile = source.bytes.empty() && source.offset == 0 && source.size == 0;
+    if (wholeFile && path.extension() != ".ktx2" && Filesystem::Stat(converted.string(), convertedInfo)
+        && convertedInfo.modified >= sourceTime) {
+        read = Source { converted.string() };
+    }
+
+    // KTX2 is told by its identifier rather than the name, so one embedded in a
+    // .glb goes up as it is too. Anything else is decoded from the source
+    std::shared_ptr<TextureData> data = load_ktx2(read);
+    if (!data && read.path != source.path) {
+        QS_CORE_WARN("Ignoring %s, it isn't a KTX2 image this engine reads", read.path.c_str());
+    }
+    if (!data && path.extension() != ".ktx2") {
+        // what a fresh decode is encoded to
+        TextureFormat format = _engine->_textureCompressionBC ? TextureFormat::BC7 : TextureFormat::RGBA8;
+        std::filesystem::path cachePath = cache_path(texture->path);
+
+        data = read_cache(cachePath, format, sourceSize, sourceTime);
+        if (!data) {
+            MappedFile file;
+            int w = 0, h = 0, channels;
+            stbi_uc* decoded = nullptr;
+            const uint8_t* bytes;
+            uint64_t size;
+            if (source_bytes(source, file, MappedFile::Access::Sequential, bytes, size)) {
+                decoded = stbi_load_from_memory(bytes, int(size), &w, &h, &channels, 4);
+            }
+
+            if (decoded) {
+                // mips on the cpu, the gpu can't blit into compressed images and
+                // streaming needs every level at hand
+                std::vector<std::vector<uint8_t>> levels = encode_levels(decoded, uint32_t(w), uint32_t(h), format);
+                stbi_image_free(decoded);
+
+                std::vector<UploadQueue::ImageLevel> spans;
+                for (const std::vector<uint8_t>& level : levels) {
+                    spans.push_back({ level.data(), level.size() });
+                }
+                TextureCacheHeader header { TextureCacheMagic, TextureCacheVersion, uint32_t(w), uint32_t(h), sourceSize,
+                    sourceTime, uint32_t(format), uint32_t(levels.size()) };
+                write_cache(cachePath, header, spans);
+
+                // mapped back from the cache rather than kept in memory
+                data = read_cache(cachePath, format, sourceSize, sourceTime);
+                if (!data) {
+                    data = std::make_shared<TextureData>();
+                    data->format = format;
+                    data->width = uint32_t(w);
+                    data->height = uint32_t(h);
+                    data->levels = std::move(spans);
+                    data->owned = std::move(levels);
+                }
+            }
+        }
+    }
+
+    if (!data) {
+        QS_CORE_ERROR("Failed to decode texture %s", texture->path.c_str());
+        uploads.on_complete([this, texture = std::move(texture)]() { finish_load(texture, nullptr, {}, 0); });
+        return;
+    }
+
+    uint64_t size = chain_bytes(*data, 0);
+    uint64_t uncompressed = 0;
+    for (uint32_t level = 0; level < data->levels.size(); level++) {
+        uncompressed += TextureLevelSize(TextureFormat::RGBA8, MipExtent(data->width, level), MipExtent(data->height, level));
+    }
+    QS_CORE_INFO("Texture %s: %s %ux%u, %.2f MB, %.2f MB as RGBA8, %.0f%% saved", texture->path.c_str(),
+        format_name(data->format), data->width, data->height, size / (1024.0 * 1024.0), uncompressed / (1024.0 * 1024.0),
+        100.0 * (1.0 - double(size) / uncompressed));
+
+    uint32_t firstMip = full ? 0 : tail_mip(data->width, data->height, uint32_t(data->levels.size()));
+    prefetch_levels(data->file, std::span(data->levels).subspan(firstMip));
+    AllocatedImage image = upload(*data, firstMip);
+
+    uploads.on_complete([this, texture = std::move(texture), data = std::move(data), image, firstMip]() {
+        finish_load(texture, data, image, firstMip);
+    });
+}
+
+std::shared_ptr<TextureLoader::TextureData> TextureLoader::load_ktx2(const Source& source)
+{
+    auto data = std::make_shared<TextureData>();
+    const uint8_t* bytes;
+    uint64_t size;
+    if (!source_bytes(source, data->file, MappedFile::Access::Random, bytes, size) || !ValidateKtx2(bytes, size)) {
+        return nullptr;
+    }
+
+    // level offsets count from the start of the KTX2 data, not of the file
+    Ktx2Header header;
+    memcpy(&header, bytes, sizeof(header));
+    data->format = TextureFormat(header.vkFormat);
+    data->width = header.pixelWidth;
+    data->height = header.pixelHeight;
+
+    data->levels.resize(header.levelCount);
+    for (uint32_t i = 0; i < header.levelCount; i++) {
+        Ktx2Level level;
+        memcpy(&level, bytes + sizeof(Ktx2Header) + i * sizeof(Ktx2Level), sizeof(level));
+        data->levels[i] = { bytes + level.byteOffset, size_t(level.byteLength) };
+    }
+
+    // the device can't sample it, every level goes back to RGBA8
+    if (IsBlockCompressed(data->format) && !_engine->_textureCompressionBC) {
+        for (uint32_t i = 0; i < header.levelCount; i++) {
+            uint32_t width = MipExtent(header.pixelWidth, i), height = MipExtent(header.pixelHeight, i);
+            std::vector<uint8_t>& pixels = data->owned.emplace_back(size_t(width) * height * 4);
+            DecompressLevel(data->format, static_cast<const uint8_t*>(data->levels[i].data), width, height, pixels.data());
+            data->levels[i] = { pixels.data(), pixels.size() };
+        }
+        data->format = IsSrgb(data->format) ? TextureFormat::RGBA8_SRGB : TextureFormat::RGBA8;
+        data->file.Close();
+    } else if (!source.bytes.empty()) {
+        // the bytes in memory go once the texture has loaded, streaming keeps a copy
+        for (UploadQueue::ImageLevel& level : data->levels) {
+            const uint8_t* begin = static_cast<const uint8_t*>(level.data);
+            std::vector<uint8_t>& copy = data->owned.emplace_back(begin, begin + level.size);
+            level = { copy.data(), copy.size() };
+        }
+    }
+
+    return data;
+}
+
+std::vector<std::vector<uint8_t>> TextureLoader::encode_levels(const uint8_t* pixels, uint32_t width, uint32_t height,
+    TextureFormat format)
+{
+    std::vector<std::vector<uint8_t>> levels;
+    std::vector<uint8_t> mip, next;
+    const uint8_t* source = pixels;
+
+    uint32_t levelCount = MipLevelCount(width, height);
+    for (uint32_t level = 0; level < levelCount; level++) {
+        uint32_t w = MipExtent(width, level), h = MipExtent(height, level);
+        if (level > 0) {
+            next.resize(size_t(w) * h * 4);
+            DownsampleLevel(source, MipExtent(width, level - 1), MipExtent(height, level - 1), IsSrgb(format), next.data());
+            mip.swap(next);
+            source = mip.data();
+        }
+
+        std::vector<uint8_t>& out = levels.emplace_back(TextureLevelSize(format, w, h));
+        if (IsBlockCompressed(format)) {
+            CompressBlockRows(format, source, w, h, 0, (h + 3) / 4, out.data());
+        } else {
+            memcpy(out.data(), source, out.size());
+        }
+    }
+    return levels;
+}
+
+AllocatedImage TextureLoader::upload(const TextureData& data, uint32_t firstMip)
+{
+    VkExtent3D extent { MipExtent(data.width, firstMip), MipExtent(data.height, firstMip), 1 };
+    std::span<const UploadQueue::ImageLevel> levels = std::span(data.levels).subspan(firstMip);
+
+    AllocatedImage image = _engine->create_image(extent, VkFormat(data.format),
+        VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, uint32_t(levels.size()));
+    _engine->_uploads.upload_image_levels(image, levels);
+    return image;
+}
+
+uint64_t TextureLoader::chain_bytes(const TextureData& data, uint32_t firstMip)
+{
+    uint64_t size = 0;
+    for (size_t level = firstMip; level < data.levels.size(); level++) {
+        size += data.levels[level].size;
+    }
+    return size;
+}
+
+void TextureLoader::finish_load(const std::shared_ptr<Texture>& texture, std::shared_ptr<const TextureData> data,
+    const AllocatedImage& image, uint32_t firstMip)
+{
+    _loading--;
+
+    // the levels are mapped or copied by now, bytes in memory aren't needed anymore
+    texture->source.bytes = {};
+    texture->source.owner.reset();
+
+    // nobody wants it anymore, and no frame has seen the image
+    if (texture->released) {
+        if (image.image != VK_NULL_HANDLE) {
+            _engine->destroy_image(image);
+        }
+        return;
+    }
+
+    if (image.image != VK_NULL_HANDLE) {
+        texture->data = std::move(data);
+        texture->tailMip = tail_mip(texture->data->width, texture->data->height, uint32_t(texture->data->levels.size()));
+        texture->wantedMip = texture->tailMip;
+        if (swap_image(*texture, image, firstMip)) {
+            _committedBytes += texture->residentBytes;
+            return;
+        }
+        _engine->destroy_image(image);
+    }
+
+    // stays on the error image for good, there is nothing to release
+    texture->index = _errorIndex;
+    texture->data.reset();
+    notify(*texture);
+}
+
+bool TextureLoader::swap_image(Texture& texture, const AllocatedImage& image, uint32_t firstMip)
+{
+    uint32_t index = _engine->_bindless.register_texture(image.imageView);
+    if (index == INVALID_ID) {
+        QS_CORE_ERROR("Out of bindless texture slots loading %s", texture.path.c_str());
+        return false;
+    }
+
+    if (texture.loaded) {
+        // frames up to the current one may still sample the old image
+        uint64_t frame = _engine->_frameNumber;
+        _byIndex.erase(texture.index);
+        _engine->_bindless.release_texture(texture.index, frame);
+        _pendingDestroy.emplace_back(frame, texture.image);
+    }
+
+    texture.image = image;
+    texture.index = index;
+    texture.loaded = true;
+    texture.residentMip = firstMip;
+    texture.residentBytes = chain_bytes(*texture.data, firstMip);
+    _byIndex[index] = &texture;
+
+    notify(texture);
+    return true;
+}
+
+void TextureLoader::notify(const Texture& texture)
+{
+    // callbacks may load or release, so nothing is held across them
+    std::vector<Handle> handles = texture.handles;
+    uint32_t index = texture.index;
+    for (Handle handle : handles) {
+        if (handle < _references.size() && _references[handle].texture.get() == &texture && _references[handle].onChanged) {
+            std::function<void(uint32_t index)> onChanged = _references[handle].onChanged;
+            onChanged(index);
+        }
+    }
+}
+//< texture_loader
+
+//> texture_streaming
+void TextureLoader::request(uint32_t textureIndex, float screenSize)
+{
+    auto it = _byIndex.find(textureIndex);
+    if (it == _byIndex.end()) {
+        return;
+    }
+
+    // a mip level per halving of the screen size against the texture's
+    Texture& texture = *it->second;
+    float size = float(std::max(texture.data->width, texture.data->height));
+    float mip = std::log2(size / std::max(screenSize, 1.f)) + streaming.mipBias;
+    uint32_t wanted = mip <= 0.f ? 0 : std::min(uint32_t(mip), texture.tailMip);
+
+    // 0 is never, so frame numbers are stamped one up
+    uint64_t frame = _engine->_frameNumber + 1;
+    if (texture.lastRequested != frame) {
+        texture.lastRequested = frame;
+        texture.wantedMip = wanted;
+        texture.screenSize = screenSize;
+    } else {
+        texture.wantedMip = std::min(texture.wantedMip, wanted);
+        texture.screenSize = std::max(texture.screenSize, screenSize);
+    }
+}
+
+uint64_t TextureLoader::budget_bytes() const
+{
+    if (!streaming.enabled) {
+        return UINT64_MAX;
+    }
+
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+    vmaGetHeapBudgets(_engine->_allocator, budgets);
+    const VkPhysicalDeviceMemoryProperties* memoryProperties;
+    vmaGetMemoryProperties(_engine->_allocator, &memoryProperties);
+
+    uint64_t budget = 0, usage = 0;
+    for (uint32_t i = 0; i < memoryProperties->memoryHeapCount; i++) {
+        if (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+            budget += budgets[i].budget;
+            usage += budgets[i].usage;
+        }
+    }
+
+    // everything that isn't a texture keeps what it has
+    uint64_t others = usage > _committedBytes ? usage - _committedBytes : 0;
+    uint64_t available = budget > others ? budget - others : 0;
+    uint64_t limit = std::min(uint64_t(double(budget) * streaming.budgetFraction), available);
+    if (streaming.budget > 0) {
+        limit = std::min(limit, streaming.budget);
+    }
+    return limit;
+}
+
+void TextureLoader::update()
+{
+    uint64_t frame = _engine->_frameNumber + 1;
+
+    std::vector<std::shared_ptr<Texture>> textures;
+    for (auto& [path, texture] : _textures) {
+        if (!texture->loaded) {
+            continue;
+        }
+        if (!streaming.enabled) {
+            texture->wantedMip = 0;
+        } else if (texture->lastRequested != frame) {
+            texture->wantedMip = texture->tailMip;
+            texture->screenSize = 0.f;
+        }
+        textures.push_back(texture);
+    }
+
+    const uint64_t budget = budget_bytes();
+
+    // least recently requested first, the largest of equals first
+    std::vector<std::shared_ptr<Texture>> lru = textures;
+    std::sort(lru.begin(), lru.end(), [](const std::shared_ptr<Texture>& a, const std::shared_ptr<Texture>& b) {
+        return a->lastRequested != b->lastRequested ? a->lastRequested < b->lastRequested : a->residentBytes > b->residentBytes;
+    });
+    size_t nextUnused = 0;
+
+    // drops textures no frame has asked for lately back to their tail until needed more bytes fit
+    auto evict_unused = [&](uint64_t needed) {
+        while (_committedBytes + needed > budget && nextUnused < lru.size() && lru[nextUnused]->lastRequested != frame) {
+            const std::shared_ptr<Texture>& texture = lru[nextUnused++];
+            if (texture->streamingMip == INVALID_ID && texture->residentMip < texture->tailMip) {
+                stream(texture, texture->tailMip);
+            }
+        }
+        return _committedBytes + needed <= budget;
+    };
+
+    // over budget with only textures in use left: the ones smallest on screen lose their finest mip
+    if (!evict_unused(0)) {
+        std::vector<std::shared_ptr<Texture>> used(lru.begin() + nextUnused, lru.end());
+        std::sort(used.begin(), used.end(), [](const std::shared_ptr<Texture>& a, const std::shared_ptr<Texture>& b) {
+            return a->screenSize < b->screenSize;
+        });
+        for (const std::shared_ptr<Texture>& texture : used) {
+            if (_committedBytes <= budget) {
+                break;
+            }
+            if (texture->streamingMip == INVALID_ID && texture->residentMip < texture->tailMip) {
+                stream(texture, texture->residentMip + 1);
+            }
+        }
+    }
+
+    // the largest on screen first, each at the finest mip that fits
+    std::vector<std::shared_ptr<Texture>> wanting;
+    for (const std::shared_ptr<Texture>& texture : textures) {
+        if (texture->streamingMip == INVALID_ID && texture->wantedMip < texture->residentMip) {
+            wanting.push_back(texture);
+        }
+    }
+    std::sort(wanting.begin(), wanting.end(), [](const std::shared_ptr<Texture>& a, const std::shared_ptr<Texture>& b) {
+        return a->screenSize > b->screenSize;
+    });
+
+    uint64_t started = 0;
+    for (const std::shared_ptr<Texture>& texture : wanting) {
+        for (uint32_t mip = texture->wantedMip; mip < texture->residentMip; mip++) {
+            uint64_t bytes = chain_bytes(*texture->data, mip);
+            if (started > 0 && started + bytes > streaming.uploadBytesPerFrame) {
+                return;
+            }
+            if (evict_unused(bytes - texture->residentBytes)) {
+                stream(texture, mip);
+                started += bytes;
+                break;
+            }
+        }
+    }
+}
+
+void TextureLoader::stream(const std::shared_ptr<Texture>& texture, uint32_t firstMip)
+{
+    // counted from now on, so the budget already sees where the texture is going
+    texture->streamingMip = firstMip;
+    texture->streamingBytes = chain_bytes(*texture->data, firstMip);
+    _committedBytes = _committedBytes - texture->residentBytes + texture->streamingBytes;
+
+    // the pages come in while the upload waits for a worker
+    prefetch_levels(texture->data->file, std::span(texture->data->levels).subspan(firstMip));
+
+    _loading++;
+    QS_THREAD_POOL.Enqueue([this, texture, data = texture->data, firstMip]() mutable {
+        AllocatedImage image = upload(*data, firstMip);
+        _engine->_uploads.on_complete([this, texture = std::move(texture), image]() { finish_stream(texture, image); });
+    });
+}
+
+void TextureLoader::finish_stream(const std::shared_ptr<Texture>& texture, const AllocatedImage& image)
+{
+    _loading--;
+
+    // released meanwhile, its bytes are already off the books
+    if (texture->released) {
+        _engine->destroy_image(image);
+        return;
+    }
+
+    uint32_t firstMip = texture->streamingMip;
+    texture->streamingMip = INVALID_ID;
+    if (!swap_image(*texture, image, firstMip)) {
+        _committedBytes = _committedBytes - texture->streamingBytes + texture->residentBytes;
+        _engine->destroy_image(image);
+    }
+}
+//< texture_streaming
+
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "vk_types.h"
+#include "vk_upload.h"
+
+#include <Renderer/TextureFormat.h>
+#include <Core/MappedFile.h>
+
+#include <filesystem>
+
+namespace Quasar::Renderer {
+
+class Backend;
+
+//> texture_loader
+// Loads textures from image files without stalling a frame, and streams their
+// mips in and out under a memory budget.
+//
+// load() hands out the placeholder's bindless index right away. A worker decodes
+// the file, or the bytes an embedded image takes up, and queues the upload of
+// its smallest mips, the ones up to TailSize. Once that batch has completed the
+// image gets an index of its own and the reference's callback swaps it in, the
+// same way the glTF importer patches its materials. Frames in flight keep
+// sampling the old index, an index is never repointed while the gpu may read it.
+//
+// Textures stay block compressed on the gpu when the device can sample BCn.
+// KTX2 data is uploaded as it is, mips included: a .ktx2 file, one embedded in
+// a .glb, or the one the TextureConverter tool wrote next to an image file.
+// Other image files are encoded to BC7 on the worker, mips made on the cpu.
+// Without BCn support compressed files are decoded back to RGBA8, and image
+// files keep RGBA8 mips made on the cpu.
+// Every load logs what the texture costs against plain RGBA8.
+//
+// Decoded or encoded levels are cached on disk in CacheDirectory under a hash of
+// the path, checked against the file's size and modification time, so later runs
+// skip the decode and the encode. The mips of a texture stay mapped from the
+// cache or the .ktx2 file for streaming.
+//
+// Streaming: every frame the renderer reports how many pixels each texture
+// covers on screen through request(), by the bindless index its materials hold.
+// update() turns that into the finest mip worth having and swaps textures to an
+// image with more mips, finest first by screen size. When the textures are over
+// budget the least recently requested ones drop back to their tail first, then
+// the ones still in use lose their finest mip. A residency change uploads a new
+// image and swaps its index in at the next frame boundary, like the first load,
+// the old image is destroyed once no frame in flight can sample it.
+//
+// Render thread only, the workers it starts only touch thread safe parts of the
+// backend.
+class TextureLoader {
+public:
+    static constexpr const char* CacheDirectory = "Cache/textures";
+    // mips up to this size are loaded first and never evicted
+    static constexpr uint32_t TailSize = 64;
+
+    struct StreamingSettings {
+        // off loads every mip right away, with no budget
+        bool enabled = true;
+        // bytes textures may take on the gpu, 0 leaves it to budgetFraction alone
+        uint64_t budget = 0;
+        // share of vma's device local budget textures may take, minus what
+        // everything else already uses
+        float budgetFraction = 0.5f;
+        // bytes of new images started per frame, at least one image always starts
+        uint64_t uploadBytesPerFrame = 32ull * 1024 * 1024;
+        // added to the mip the screen size asks for, positive keeps less detail
+        float mipBias = 0.f;
+    };
+
+    // one user's reference to a texture, what release() takes back
+    using Handle = uint32_t;
+
+    // where a texture's encoded bytes are, a whole file or a byte range of one,
+    // like an image in the binary chunk of a .glb, or memory, like a data uri
+    struct Source {
+        std::string path;
+        // for bytes in memory only what tells them apart from the file's others
+        uint64_t offset = 0;
+        // 0 reads to the end of the file
+        uint64_t size = 0;
+        // read instead of the file when set, which then only names the texture
+        // and dates its cache entry. owner keeps them alive until the first load
+        // is done, the loader doesn't hold on to them after
+        std::span<const uint8_t> bytes;
+        std::shared_ptr<const void> owner;
+    };
+
+    StreamingSettings streaming;
+
+    // bindless indices of the images shown while loading and after a failed load
+    void init(Backend* engine, uint32_t placeholderIndex, uint32_t errorIndex);
+    // waits for the loads still running
+    void destroy();
+
+    // a new reference to the texture, starting the load on first use. onChanged
+    // gets the texture's new bindless index on the render thread whenever it
+    // changes, when the image first arrives and on every residency change, until
+    // the reference is released. A texture that already arrived calls it before
+    // load returns
+    Handle load(const Source& source, std::function<void(uint32_t index)>&& onChanged = {});
+    Handle load(const std::string& path, std::function<void(uint32_t index)>&& onChanged = {})
+    {
+        return load(Source { path }, std::move(onChanged));
+    }
+    void release(Handle handle);
+
+    // current bindless index, the placeholder's until the image has arrived
+    uint32_t index(Handle handle) const;
+    bool is_loaded(Handle handle) const;
+
+    // usage feedback for this frame: textureIndex covers about screenSize pixels
+    // across. textureIndex is the one onChanged last handed out, indices that
+    // aren't streamed textures are ignored
+    void request(uint32_t textureIndex, float screenSize);
+    // applies this frame's feedback, evicting down to the budget and starting uploads
+    void update();
+
+    // destroys the images released by frames up to and including completedFrame
+    void collect(uint64_t completedFrame);
+
+    // bytes of the resident images and of the ones being uploaded
+    uint64_t resident_bytes() const { return _committedBytes; }
+    // what the textures may take right now
+    uint64_t budget_bytes() const;
+
+private:
+    // the full mip chain of a texture, mapped or in memory. Immutable once loaded,
+    // the workers read it while the render thread swaps images
+    struct TextureData {
+        MappedFile file;
+        std::vector<std::vector<uint8_t>> owned;
+        TextureFormat format;
+        uint32_t width;
+        uint32_t height;
+        // mip 0 first, pointing into file or owned
+        std::vector<UploadQueue::ImageLevel> levels;
+    };
+
+    struct Texture {
+        // the source's path, with the offset for a range or bytes in memory, names
+        // it in the cache and the log
+        std::string path;
+        Source source;
+        uint32_t index;
+        std::vector<Handle> handles;
+        AllocatedImage image {};
+        bool loaded = false;
+        // every reference was dropped, uploads still running throw their image away
+        bool released = false;
+
+        std::shared_ptr<const TextureData> data;
+        // first mip of image
+        uint32_t residentMip = 0;
+        // first mip of the tail, evictions stop there
+        uint32_t tailMip = 0;
+        uint64_t residentBytes = 0;
+        // mip of the image being uploaded, INVALID_ID when none
+        uint32_t streamingMip = INVALID_ID;
+        uint64_t streamingBytes = 0;
+
+        // this frame's feedback, tailMip without any
+        uint32_t wantedMip = 0;
+        float screenSize = 0.f;
+        uint64_t lastRequested = 0;
+    };
+
+    struct Reference {
+        std::shared_ptr<Texture> texture;
+        std::function<void(uint32_t index)> onChanged;
+    };
+
+    // worker side, decodes or reads the cache and queues the upload of the tail,
+    // or of every mip when full is set
+    void decode(std::shared_ptr<Texture> texture, bool full);
+    // worker side, a valid cache entry of the source in format, mapped
+    static std::shared_ptr<TextureData> read_cache(const std::filesystem::path& path, TextureFormat format,
+        uint64_t sourceSize, int64_t sourceTime);
+    // worker side, the source's levels, or nothing when it isn't a KTX2 image this loader reads
+    std::shared_ptr<TextureData> load_ktx2(const Source& source);
+    // worker side, the full mip chain of an RGBA8 image in format
+    static std::vector<std::vector<uint8_t>> encode_levels(const uint8_t* pixels, uint32_t width, uint32_t height,
+        TextureFormat format);
+    // worker side, creates an image of the levels from firstMip on and queues their upload
+    AllocatedImage upload(const TextureData& data, uint32_t firstMip);
+
+    // render thread, once the first upload has completed. image is empty when the load failed
+    void finish_load(const std::shared_ptr<Texture>& texture, std::shared_ptr<const TextureData> data,
+        const AllocatedImage& image, uint32_t firstMip);
+    // render thread, starts swapping the texture to an image from firstMip on
+    void stream(const std::shared_ptr<Texture>& texture, uint32_t firstMip);
+    // render thread, once a streamed image has arrived
+    void finish_stream(const std::shared_ptr<Texture>& texture, const AllocatedImage& image);
+    // render thread, points the texture at a new image and tells every reference.
+    // false when the image couldn't get an index, the texture stays as it was
+    bool swap_image(Texture& texture, const AllocatedImage& image, uint32_t firstMip);
+    void notify(const Texture& texture);
+
+    static uint64_t chain_bytes(const TextureData& data, uint32_t firstMip);
+
+    Backend* _engine;
+    uint32_t _placeholderIndex;
+    uint32_t _errorIndex;
+
+    std::unordered_map<std::string, std::shared_ptr<Texture>> _textures;
+    // bindless index of every resident texture, for the feedback
+    std::unordered_map<uint32_t, Texture*> _byIndex;
+
+    std::vector<Reference> _references;
+    std::vector<Handle> _freeHandles;
+
+    uint64_t _committedBytes = 0;
+    // decoding or uploading
+    uint32_t _loading = 0;
+    std::deque<std::pair<uint64_t, AllocatedImage>> _pendingDestroy;
+};
+//< texture_loader
+
+}
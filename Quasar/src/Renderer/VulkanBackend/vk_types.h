@@ -40,11 +40,39 @@ struct AllocatedBuffer {
 struct GPUGLTFMaterial {
     glm::vec4 colorFactors;
     glm::vec4 metal_rough_factors;
-    glm::vec4 extra[14];
+    // indices into the bindless texture and sampler arrays
+    uint32_t colorTexIndex;
+    uint32_t colorSamplerIndex;
+    uint32_t metalRoughTexIndex;
+    uint32_t metalRoughSamplerIndex;
+    glm::vec4 extra[13];
 };
 
 static_assert(sizeof(GPUGLTFMaterial) == 256);
 
+enum class LightType : uint32_t {
+    Point,
+    Spot,
+};
+
+// a point or spot light as the shaders see it, mirrors Light in scene.glsl
+struct GPULight {
+    glm::vec3 position;
+    // no light reaches past this distance
+    float range;
+    glm::vec3 color;
+    float intensity;
+    // spot lights only
+    glm::vec3 direction;
+    LightType type;
+    // cosines of the spot cone's half angles, full intensity inside the inner one
+    float spotInnerCos;
+    float spotOuterCos;
+    uint32_t pad[2];
+};
+
+static_assert(sizeof(GPULight) == 64);
+
 struct GPUSceneData {
     glm::mat4 view;
     glm::mat4 proj;
@@ -52,6 +80,24 @@ struct GPUSceneData {
     glm::vec4 ambientColor;
     glm::vec4 sunlightDirection; // w for sun power
     glm::vec4 sunlightColor;
+    // clustered lighting, filled in by ClusteredLighting
+    VkDeviceAddress lights;
+    VkDeviceAddress clusterGrid;
+    VkDeviceAddress lightIndices;
+    uint32_t lightCount;
+    uint32_t pad;
+    // pixels per cluster in xy, depth slice scale and bias in zw
+    glm::vec4 clusterParams;
+    // sun shadows, filled in by CascadedShadows
+    glm::mat4 shadowMatrices[4];
+    // view depth where each cascade ends
+    glm::vec4 cascadeSplits;
+    // bindless index of each cascade's layer and the comparison sampler
+    glm::uvec4 shadowTextures;
+    uint32_t shadowSampler;
+    // 0 when shadows are off
+    uint32_t shadowCascades;
+    uint32_t pad2[2];
 };
 
 //> mat_types
@@ -67,7 +113,9 @@ struct MaterialPipeline {
 
 struct MaterialInstance {
     MaterialPipeline* pipeline;
-    VkDescriptorSet materialSet;
+    // index of this material's GPUGLTFMaterial in the material buffer. Textures are
+    // reached through the bindless set, so there is no per material descriptor set
+    uint32_t materialIndex;
     MaterialPass passType;
 };
 //< mat_types
@@ -81,23 +129,104 @@ struct Vertex {
 	glm::vec4 color;
 };
 
+// layout of a vertex buffer, mirrors the VertexFormat constants in scene.glsl
+enum class VertexFormat : uint32_t {
+    // Vertex
+    Full,
+    // QuantizedVertexHeader followed by QuantizedVertex, see MeshOptimizer.h
+    Quantized
+};
+
 // holds the resources needed for a mesh
 struct GPUMeshBuffers {
 
     AllocatedBuffer indexBuffer;
     AllocatedBuffer vertexBuffer;
     VkDeviceAddress vertexBufferAddress;
+    VkIndexType indexType = VK_INDEX_TYPE_UINT32;
+    VertexFormat vertexFormat = VertexFormat::Full;
 };
 
 // push constants for our mesh object draws
 struct GPUDrawPushConstants {
     glm::mat4 worldMatrix;
     VkDeviceAddress vertexBuffer;
+    // this frame's GPUSceneData in the uniform ring
+    VkDeviceAddress sceneData;
+    uint32_t materialIndex;
+    VertexFormat vertexFormat;
 };
+
+// the shader push constant block ends at vertexFormat, the C++ struct has tail padding
+constexpr uint32_t DrawPushConstantsSize = offsetof(GPUDrawPushConstants, vertexFormat) + sizeof(uint32_t);
 //< vbuf_types
 
+//> renderobject
+// object space bounding sphere and box of a surface
+struct Bounds {
+    glm::vec3 origin;
+    float sphereRadius;
+    glm::vec3 extents;
+};
+
+struct RenderObject {
+    uint32_t indexCount;
+    uint32_t firstIndex;
+    VkBuffer indexBuffer;
+    VkIndexType indexType = VK_INDEX_TYPE_UINT32;
+
+    MaterialInstance* material;
+    Bounds bounds;
+
+    glm::mat4 transform;
+    VkDeviceAddress vertexBufferAddress;
+    VertexFormat vertexFormat = VertexFormat::Full;
+
+    // never moves or changes, so cached shadow cascades can keep it
+    bool isStatic = false;
+    // the range shadows draw, one fixed level of detail so the picked level
+    // changing with the camera doesn't invalidate the cached cascades
+    uint32_t shadowIndexCount;
+    uint32_t shadowFirstIndex;
+};
+
+// one level of detail of a surface, all levels share the mesh's buffers
+struct MeshLod {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    // how far the level strays from the full mesh, in object space units
+    float error;
+};
+
+constexpr uint32_t MaxMeshLods = 5;
+
+// how the scene picks levels of detail, set by the backend before the scene draws
+struct LodSelection {
+    bool enabled = true;
+    glm::vec3 viewPosition;
+    // pixels one world unit covers at a distance of one
+    float pixelsPerUnit;
+    // error in pixels a level may show on screen
+    float errorThreshold = 1.f;
+    // a coarser level has to stay this fraction below the threshold before it is
+    // picked, so objects near the switching distance don't flip every frame
+    float hysteresis = 0.25f;
+};
+
+// everything drawn this frame, filled by the scene before draw() and emptied by it
+struct DrawContext {
+    std::vector<RenderObject> OpaqueSurfaces;
+    std::vector<RenderObject> TransparentSurfaces;
+    std::vector<GPULight> Lights;
+
+    LodSelection lod;
+    // triangles of the submitted surfaces at full detail and at the picked level
+    uint64_t fullTriangles = 0;
+    uint64_t drawnTriangles = 0;
+};
+//< renderobject
+
 //> node_types
-struct DrawContext;
 
 // base class for a renderable dynamic object
 class IRenderable {
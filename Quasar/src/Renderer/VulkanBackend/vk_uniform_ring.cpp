@@ -0,0 +1,112 @@
+#include "vk_uniform_ring.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> uniform_ring_init
+void UniformRing::init(VkDevice device, VkPhysicalDevice physicalDevice, VmaAllocator allocator, VkDeviceSize size, uint32_t frameCount)
+{
+    _allocator = allocator;
+
+    //every slice can be bound as a dynamic uniform or storage buffer
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(physicalDevice, &props);
+    _alignment = std::max(props.limits.minUniformBufferOffsetAlignment, props.limits.minStorageBufferOffsetAlignment);
+
+    VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT
+        | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+        | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    //AUTO picks host visible vram when the device has it, system memory otherwise
+    VmaAllocationCreateInfo vmaallocInfo = {};
+    vmaallocInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+
+    VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &_buffer.buffer, &_buffer.allocation, &_buffer.info));
+    _mapped = (uint8_t*)_buffer.info.pMappedData;
+
+    VkBufferDeviceAddressInfo addressInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+    addressInfo.buffer = _buffer.buffer;
+    _bufferAddress = vkGetBufferDeviceAddress(device, &addressInfo);
+
+    _capacity = size;
+    _head = 0;
+    _used = 0;
+    _slotBytes.assign(frameCount, 0);
+    _currentSlot = 0;
+    _frameStart = 0;
+    _frameBytes = 0;
+    _lastFrameBytes = 0;
+}
+
+void UniformRing::destroy()
+{
+    vmaDestroyBuffer(_allocator, _buffer.buffer, _buffer.allocation);
+}
+//< uniform_ring_init
+
+//> uniform_ring_frame
+void UniformRing::begin_frame(uint32_t frameSlot)
+{
+    //frames retire in submission order, so the bytes of this slot are always the
+    //oldest ones still held
+    _used -= _slotBytes[frameSlot];
+    _slotBytes[frameSlot] = 0;
+
+    _currentSlot = frameSlot;
+    _frameStart = _head;
+    _lastFrameBytes = _frameBytes;
+    _frameBytes = 0;
+}
+
+void UniformRing::flush()
+{
+    //no-op on host coherent memory
+    VkDeviceSize written = _slotBytes[_currentSlot];
+    if (written == 0) {
+        return;
+    }
+
+    if (_frameStart + written <= _capacity) {
+        vmaFlushAllocation(_allocator, _buffer.allocation, _frameStart, written);
+    } else {
+        //the frame wrapped, flush the whole thing rather than two ranges
+        vmaFlushAllocation(_allocator, _buffer.allocation, 0, VK_WHOLE_SIZE);
+    }
+}
+
+RingAllocation UniformRing::allocate(VkDeviceSize size)
+{
+    VkDeviceSize offset = get_aligned(_head, _alignment);
+    if (offset + size > _capacity) {
+        //not enough room before the end, skip the tail and start over at 0
+        offset = 0;
+    }
+
+    //the padding skipped over belongs to this frame too, it is released with it
+    VkDeviceSize consumed = offset >= _head ? offset + size - _head : _capacity - _head + size;
+    if (_used + consumed > _capacity) {
+        QS_CORE_FATAL("Uniform ring overflow: %llu bytes requested, %llu bytes free",
+            (unsigned long long)size, (unsigned long long)(_capacity - _used));
+        abort();
+    }
+
+    _used += consumed;
+    _slotBytes[_currentSlot] += consumed;
+    _head = offset + size;
+    _frameBytes += size;
+
+    return RingAllocation {
+        .data = _mapped + offset,
+        .buffer = _buffer.buffer,
+        .offset = offset,
+        .address = _bufferAddress + offset,
+        .size = size,
+    };
+}
+//< uniform_ring_frame
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "vk_types.h"
+
+namespace Quasar::Renderer {
+
+//> uniform_ring
+// A slice of the ring, valid until the frame it was allocated in has completed
+struct RingAllocation {
+    void* data;
+    VkBuffer buffer;
+    // for dynamic uniform/storage buffer offsets
+    VkDeviceSize offset;
+    // buffer device address of the slice, for push constants and shader pointers
+    VkDeviceAddress address;
+    VkDeviceSize size;
+};
+
+// One persistently mapped buffer that per-frame uniforms and per-object data are
+// bump-allocated from. The ring wraps around and each frame slot remembers how
+// much of it that frame used, so begin_frame(), called once the slot's last frame has
+// completed, gives exactly that frame's bytes back. No buffers are created after init.
+class UniformRing {
+public:
+    void init(VkDevice device, VkPhysicalDevice physicalDevice, VmaAllocator allocator, VkDeviceSize size, uint32_t frameCount);
+    void destroy();
+
+    // the frame that last used frameSlot has finished on the gpu
+    void begin_frame(uint32_t frameSlot);
+    // makes the writes of the current frame visible to the gpu, call before submitting
+    void flush();
+
+    RingAllocation allocate(VkDeviceSize size);
+
+    template<typename T>
+    RingAllocation push(const T& value)
+    {
+        RingAllocation alloc = allocate(sizeof(T));
+        memcpy(alloc.data, &value, sizeof(T));
+        return alloc;
+    }
+
+    template<typename T>
+    RingAllocation push(std::span<const T> values)
+    {
+        RingAllocation alloc = allocate(values.size_bytes());
+        memcpy(alloc.data, values.data(), values.size_bytes());
+        return alloc;
+    }
+
+    VkBuffer buffer() const { return _buffer.buffer; }
+    VkDeviceSize alignment() const { return _alignment; }
+
+    // bytes handed out by the frame being recorded, and by the one before it
+    VkDeviceSize frame_bytes() const { return _frameBytes; }
+    VkDeviceSize last_frame_bytes() const { return _lastFrameBytes; }
+
+private:
+    VmaAllocator _allocator;
+    AllocatedBuffer _buffer;
+    VkDeviceAddress _bufferAddress;
+    uint8_t* _mapped;
+
+    VkDeviceSize _capacity;
+    VkDeviceSize _alignment;
+    VkDeviceSize _head;
+    // bytes held by frames that may still be in flight, wrap padding included
+    VkDeviceSize _used;
+
+    // bytes each frame slot took from the ring, released when the slot comes around again
+    std::vector<VkDeviceSize> _slotBytes;
+    uint32_t _currentSlot;
+    // where the current frame started writing, for flush()
+    VkDeviceSize _frameStart;
+
+    VkDeviceSize _frameBytes;
+    VkDeviceSize _lastFrameBytes;
+};
+//< uniform_ring
+
+}
@@ -0,0 +1,264 @@
+#include "vk_upload.h"
+#include "vk_images.h"
+#include "vk_initializers.h"
+
+#include <qspch.h>
+
+namespace Quasar::Renderer {
+
+//> upload_init
+void UploadQueue::init(VkDevice device, VmaAllocator allocator, VkQueue queue, uint32_t queueFamily)
+{
+    _device = device;
+    _allocator = allocator;
+    _queue = queue;
+    _queueFamily = queueFamily;
+
+    VkSemaphoreTypeCreateInfo timelineInfo = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO};
+    timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    timelineInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo semaphoreInfo = vkinit::semaphore_create_info();
+    semaphoreInfo.pNext = &timelineInfo;
+    VK_CHECK(vkCreateSemaphore(_device, &semaphoreInfo, nullptr, &_timeline));
+}
+
+void UploadQueue::destroy()
+{
+    flush();
+
+    // queued after the last flush, the callbacks never run
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (Copy& copy : _copies) {
+        vmaDestroyBuffer(_allocator, copy.staging.buffer, copy.staging.allocation);
+    }
+    _copies.clear();
+    _callbacks.clear();
+
+    for (Batch& batch : _freeBatches) {
+        vkDestroyCommandPool(_device, batch.pool, nullptr);
+    }
+    _freeBatches.clear();
+
+    vkDestroySemaphore(_device, _timeline, nullptr);
+}
+//< upload_init
+
+//> upload_queue
+AllocatedBuffer UploadQueue::create_staging(size_t size)
+{
+    VkBufferCreateInfo bufferInfo = {.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+    VmaAllocationCreateInfo vmaallocInfo = {};
+    vmaallocInfo.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+    vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+    //vma is internally synchronized, workers allocate without the queue lock
+    AllocatedBuffer staging;
+    VK_CHECK(vmaCreateBuffer(_allocator, &bufferInfo, &vmaallocInfo, &staging.buffer, &staging.allocation, &staging.info));
+    return staging;
+}
+
+AllocatedBuffer UploadQueue::create_staging(const void* data, size_t size)
+{
+    AllocatedBuffer staging = create_staging(size);
+    memcpy(staging.info.pMappedData, data, size);
+    return staging;
+}
+
+void UploadQueue::upload_buffer(VkBuffer dst, VkDeviceSize dstOffset, const void* data, size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    Copy copy;
+    copy.staging = create_staging(data, size);
+    copy.dstBuffer = dst;
+    copy.dstOffset = dstOffset;
+    copy.size = size;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _copies.push_back(copy);
+}
+
+void UploadQueue::upload_image_levels(const AllocatedImage& image, std::span<const ImageLevel> levels)
+{
+    //buffer offsets have to be multiples of the texel block size, 16 covers every format
+    Copy copy;
+    VkDeviceSize size = 0;
+    for (const ImageLevel& level : levels) {
+        copy.levelOffsets.push_back(size);
+        size += (level.size + 15) & ~VkDeviceSize(15);
+    }
+
+    copy.staging = create_staging(size);
+    for (size_t i = 0; i < levels.size(); i++) {
+        memcpy(static_cast<uint8_t*>(copy.staging.info.pMappedData) + copy.levelOffsets[i], levels[i].data, levels[i].size);
+    }
+    copy.image = image.image;
+    copy.extent = image.imageExtent;
+    copy.size = size;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _copies.push_back(std::move(copy));
+}
+
+void UploadQueue::on_complete(std::function<void()>&& function)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _callbacks.push_back(std::move(function));
+}
+
+UploadQueue::Batch UploadQueue::acquire_batch()
+{
+    if (!_freeBatches.empty()) {
+        Batch batch = std::move(_freeBatches.back());
+        _freeBatches.pop_back();
+        return batch;
+    }
+
+    Batch batch;
+    VkCommandPoolCreateInfo poolInfo = vkinit::command_pool_create_info(_queueFamily, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+    VK_CHECK(vkCreateCommandPool(_device, &poolInfo, nullptr, &batch.pool));
+
+    VkCommandBufferAllocateInfo cmdAllocInfo = vkinit::command_buffer_allocate_info(batch.pool, 1);
+    VK_CHECK(vkAllocateCommandBuffers(_device, &cmdAllocInfo, &batch.cmd));
+    return batch;
+}
+
+void UploadQueue::submit()
+{
+    std::vector<Copy> copies;
+    std::vector<std::function<void()>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        copies.swap(_copies);
+        callbacks.swap(_callbacks);
+    }
+
+    if (copies.empty() && callbacks.empty()) {
+        return;
+    }
+
+    Batch batch = acquire_batch();
+    VK_CHECK(vkResetCommandPool(_device, batch.pool, 0));
+
+    VkCommandBufferBeginInfo cmdBeginInfo = vkinit::command_buffer_begin_info(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    VK_CHECK(vkBeginCommandBuffer(batch.cmd, &cmdBeginInfo));
+
+    for (Copy& copy : copies) {
+        if (copy.image == VK_NULL_HANDLE) {
+            VkBufferCopy region { 0 };
+            region.srcOffset = 0;
+            region.dstOffset = copy.dstOffset;
+            region.size = copy.size;
+            vkCmdCopyBuffer(batch.cmd, copy.staging.buffer, copy.dstBuffer, 1, &region);
+        } else {
+            vkutil::transition_image(batch.cmd, copy.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+            std::vector<VkBufferImageCopy> regions(copy.levelOffsets.size());
+            for (uint32_t level = 0; level < regions.size(); level++) {
+                VkBufferImageCopy& region = regions[level];
+                region = {};
+                region.bufferOffset = copy.levelOffsets[level];
+                region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                region.imageSubresource.mipLevel = level;
+                region.imageSubresource.baseArrayLayer = 0;
+                region.imageSubresource.layerCount = 1;
+                region.imageExtent = { std::max(copy.extent.width >> level, 1u), std::max(copy.extent.height >> level, 1u), 1 };
+            }
+            vkCmdCopyBufferToImage(batch.cmd, copy.staging.buffer, copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                uint32_t(regions.size()), regions.data());
+
+            vkutil::transition_image(batch.cmd, copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        }
+        batch.staging.push_back(copy.staging);
+    }
+
+    //the frames that use the results are submitted later on the same queue
+    VkMemoryBarrier2 barrier = {.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT;
+
+    VkDependencyInfo depInfo = {.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+    depInfo.memoryBarrierCount = 1;
+    depInfo.pMemoryBarriers = &barrier;
+    vkCmdPipelineBarrier2(batch.cmd, &depInfo);
+
+    VK_CHECK(vkEndCommandBuffer(batch.cmd));
+
+    batch.value = ++_submitted;
+    batch.callbacks = std::move(callbacks);
+
+    VkCommandBufferSubmitInfo cmdInfo = vkinit::command_buffer_submit_info(batch.cmd);
+    VkSemaphoreSubmitInfo signalInfo = vkinit::semaphore_submit_info(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, _timeline);
+    signalInfo.value = batch.value;
+
+    VkSubmitInfo2 submit = vkinit::submit_info(&cmdInfo, &signalInfo, nullptr);
+    VK_CHECK(vkQueueSubmit2(_queue, 1, &submit, VK_NULL_HANDLE));
+
+    _inFlight.push_back(std::move(batch));
+}
+
+void UploadQueue::retire(Batch& batch)
+{
+    for (AllocatedBuffer& staging : batch.staging) {
+        vmaDestroyBuffer(_allocator, staging.buffer, staging.allocation);
+    }
+    batch.staging.clear();
+
+    //callbacks may queue more uploads, they go into a later batch
+    std::vector<std::function<void()>> callbacks = std::move(batch.callbacks);
+    batch.callbacks.clear();
+
+    _freeBatches.push_back(std::move(batch));
+
+    for (auto& callback : callbacks) {
+        callback();
+    }
+}
+
+void UploadQueue::poll()
+{
+    if (_inFlight.empty()) {
+        return;
+    }
+
+    uint64_t completed = 0;
+    VK_CHECK(vkGetSemaphoreCounterValue(_device, _timeline, &completed));
+
+    while (!_inFlight.empty() && _inFlight.front().value <= completed) {
+        Batch batch = std::move(_inFlight.front());
+        _inFlight.pop_front();
+        retire(batch);
+    }
+}
+
+void UploadQueue::flush()
+{
+    submit();
+
+    if (_submitted > 0) {
+        VkSemaphoreWaitInfo waitInfo = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &_timeline;
+        waitInfo.pValues = &_submitted;
+        VK_CHECK(vkWaitSemaphores(_device, &waitInfo, UINT64_MAX));
+    }
+
+    poll();
+}
+
+bool UploadQueue::idle()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _copies.empty() && _callbacks.empty() && _inFlight.empty();
+}
+//< upload_queue
+
+}
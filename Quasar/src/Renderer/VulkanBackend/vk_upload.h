@@ -0,0 +1,96 @@
+#pragma once
+
+#include "vk_types.h"
+
+#include <mutex>
+
+namespace Quasar::Renderer {
+
+//> upload_queue
+// Gets data into gpu-only buffers and images without stalling a frame.
+//
+// Uploads can be queued from any thread. The data goes into a staging buffer of
+// its own right away on the calling thread, so decoding and copying stay on the
+// workers. Once per frame the render thread records everything queued into one
+// command buffer and submits it ahead of the frame. Completion callbacks run on
+// the render thread in poll() once the gpu has finished their batch, so
+// resources are only published when their contents are in place.
+class UploadQueue {
+public:
+    void init(VkDevice device, VmaAllocator allocator, VkQueue queue, uint32_t queueFamily);
+    void destroy();
+
+    // thread safe
+    void upload_buffer(VkBuffer dst, VkDeviceSize dstOffset, const void* data, size_t size);
+
+    struct ImageLevel {
+        const void* data;
+        size_t size;
+    };
+
+    // thread safe. Fills the image's mips from levels, mip 0 first. Mips are made
+    // on the cpu: block compressed images can't be blitted into, and streaming
+    // uploads any tail of the chain again later. The image ends in
+    // SHADER_READ_ONLY_OPTIMAL
+    void upload_image_levels(const AllocatedImage& image, std::span<const ImageLevel> levels);
+
+    // thread safe. Runs function on the render thread once everything queued
+    // before it has reached the gpu
+    void on_complete(std::function<void()>&& function);
+
+    // render thread, submits everything queued since the last call
+    void submit();
+    // render thread, retires finished batches and runs their callbacks
+    void poll();
+    // render thread, submits and waits for everything queued so far
+    void flush();
+
+    // queued or in flight
+    bool idle();
+
+private:
+    struct Copy {
+        AllocatedBuffer staging;
+        VkBuffer dstBuffer = VK_NULL_HANDLE;
+        VkDeviceSize dstOffset = 0;
+        VkDeviceSize size = 0;
+        // images only
+        VkImage image = VK_NULL_HANDLE;
+        VkExtent3D extent;
+        // staging offset of every mip
+        std::vector<VkDeviceSize> levelOffsets;
+    };
+
+    struct Batch {
+        VkCommandPool pool;
+        VkCommandBuffer cmd;
+        // timeline value signaled when the batch is done
+        uint64_t value = 0;
+        std::vector<AllocatedBuffer> staging;
+        std::vector<std::function<void()>> callbacks;
+    };
+
+    AllocatedBuffer create_staging(const void* data, size_t size);
+    AllocatedBuffer create_staging(size_t size);
+    Batch acquire_batch();
+    void retire(Batch& batch);
+
+    VkDevice _device;
+    VmaAllocator _allocator;
+    VkQueue _queue;
+    uint32_t _queueFamily;
+
+    VkSemaphore _timeline;
+    uint64_t _submitted = 0;
+
+    std::mutex _mutex;
+    std::vector<Copy> _copies;
+    std::vector<std::function<void()>> _callbacks;
+
+    // render thread only
+    std::deque<Batch> _inFlight;
+    std::vector<Batch> _freeBatches;
+};
+//< upload_queue
+
+}
@@ -0,0 +1,429 @@
+// Converts OBJ and glTF meshes to the engine's binary .qmesh format, see
+// Quasar/src/Renderer/MeshFormat.h.
+//
+//   MeshConverter <input.obj|input.gltf|input.glb> <output.qmesh> [--32bit-indices] [--no-optimize]
+//
+// Every OBJ shape and every glTF primitive becomes one submesh. glTF node
+// transforms are not applied, meshes are written in their own space. Triangles
+// are reordered for the vertex cache inside each submesh and vertices for fetch
+// locality, unless --no-optimize is given.
+
+#include <MeshFormat.h>
+#include <MeshOptimizer.h>
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+
+#include <fastgltf/glm_element_traits.hpp>
+#include <fastgltf/parser.hpp>
+#include <fastgltf/tools.hpp>
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Quasar;
+
+struct Submesh {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    uint32_t materialSlot;
+};
+
+struct MeshData {
+    std::vector<MeshFileVertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<Submesh> submeshes;
+};
+
+static MeshFileVertex make_vertex(glm::vec3 position, glm::vec3 normal, glm::vec2 uv, glm::vec4 color)
+{
+    MeshFileVertex v;
+    v.position[0] = position.x;
+    v.position[1] = position.y;
+    v.position[2] = position.z;
+    v.uv_x = uv.x;
+    v.normal[0] = normal.x;
+    v.normal[1] = normal.y;
+    v.normal[2] = normal.z;
+    v.uv_y = uv.y;
+    v.color[0] = color.r;
+    v.color[1] = color.g;
+    v.color[2] = color.b;
+    v.color[3] = color.a;
+    return v;
+}
+
+static glm::vec3 position_of(const MeshFileVertex& v)
+{
+    return glm::vec3(v.position[0], v.position[1], v.position[2]);
+}
+
+// area weighted face normals for vertices [firstVertex, end) of sources that have none
+static void generate_normals(MeshData& mesh, size_t firstVertex, size_t firstIndex)
+{
+    std::vector<glm::vec3> normals(mesh.vertices.size() - firstVertex, glm::vec3(0.f));
+
+    for (size_t i = firstIndex; i + 2 < mesh.indices.size(); i += 3) {
+        uint32_t a = mesh.indices[i], b = mesh.indices[i + 1], c = mesh.indices[i + 2];
+        glm::vec3 n = glm::cross(position_of(mesh.vertices[b]) - position_of(mesh.vertices[a]),
+            position_of(mesh.vertices[c]) - position_of(mesh.vertices[a]));
+        normals[a - firstVertex] += n;
+        normals[b - firstVertex] += n;
+        normals[c - firstVertex] += n;
+    }
+
+    for (size_t i = 0; i < normals.size(); i++) {
+        glm::vec3 n = glm::length(normals[i]) > 0.f ? glm::normalize(normals[i]) : glm::vec3(0.f, 1.f, 0.f);
+        MeshFileVertex& v = mesh.vertices[firstVertex + i];
+        v.normal[0] = n.x;
+        v.normal[1] = n.y;
+        v.normal[2] = n.z;
+    }
+}
+
+static bool load_obj(const std::filesystem::path& path, MeshData& mesh)
+{
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn, err;
+
+    if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.string().c_str(),
+            path.parent_path().string().c_str())) {
+        fprintf(stderr, "Failed to load %s: %s\n", path.string().c_str(), err.c_str());
+        return false;
+    }
+    if (!warn.empty()) {
+        fprintf(stderr, "%s", warn.c_str());
+    }
+
+    struct Key {
+        int position, normal, uv;
+        bool operator==(const Key& other) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const
+        {
+            return (size_t(uint32_t(k.position)) * 73856093u) ^ (size_t(uint32_t(k.normal)) * 19349663u) ^ (size_t(uint32_t(k.uv)) * 83492791u);
+        }
+    };
+
+    for (const tinyobj::shape_t& shape : shapes) {
+        // vertices are shared within a shape only, so every submesh owns its range
+        std::unordered_map<Key, uint32_t, KeyHash> unique;
+        size_t firstVertex = mesh.vertices.size();
+        bool hasNormals = true;
+
+        Submesh submesh;
+        submesh.firstIndex = uint32_t(mesh.indices.size());
+        submesh.materialSlot = shape.mesh.material_ids.empty() ? 0 : uint32_t(std::max(shape.mesh.material_ids[0], 0));
+
+        for (const tinyobj::index_t& index : shape.mesh.indices) {
+            Key key { index.vertex_index, index.normal_index, index.texcoord_index };
+
+            auto it = unique.find(key);
+            if (it == unique.end()) {
+                glm::vec3 position(attrib.vertices[3 * index.vertex_index + 0],
+                    attrib.vertices[3 * index.vertex_index + 1],
+                    attrib.vertices[3 * index.vertex_index + 2]);
+
+                glm::vec3 normal(0.f);
+                if (index.normal_index >= 0) {
+                    normal = glm::vec3(attrib.normals[3 * index.normal_index + 0],
+                        attrib.normals[3 * index.normal_index + 1],
+                        attrib.normals[3 * index.normal_index + 2]);
+                } else {
+                    hasNormals = false;
+                }
+
+                // OBJ puts v = 0 at the bottom of the image
+                glm::vec2 uv(0.f);
+                if (index.texcoord_index >= 0) {
+                    uv = glm::vec2(attrib.texcoords[2 * index.texcoord_index + 0],
+                        1.f - attrib.texcoords[2 * index.texcoord_index + 1]);
+                }
+
+                glm::vec4 color(1.f);
+                if (!attrib.colors.empty()) {
+                    color = glm::vec4(attrib.colors[3 * index.vertex_index + 0],
+                        attrib.colors[3 * index.vertex_index + 1],
+                        attrib.colors[3 * index.vertex_index + 2], 1.f);
+                }
+
+                it = unique.emplace(key, uint32_t(mesh.vertices.size())).first;
+                mesh.vertices.push_back(make_vertex(position, normal, uv, color));
+            }
+
+            mesh.indices.push_back(it->second);
+        }
+
+        submesh.indexCount = uint32_t(mesh.indices.size()) - submesh.firstIndex;
+        if (!hasNormals) {
+            generate_normals(mesh, firstVertex, submesh.firstIndex);
+        }
+        mesh.submeshes.push_back(submesh);
+    }
+
+    return true;
+}
+
+static bool load_gltf(const std::filesystem::path& path, MeshData& mesh)
+{
+    fastgltf::Parser parser {};
+
+    constexpr auto gltfOptions = fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::AllowDouble
+        | fastgltf::Options::LoadGLBBuffers | fastgltf::Options::LoadExternalBuffers;
+
+    fastgltf::GltfDataBuffer data;
+    data.loadFromFile(path);
+
+    fastgltf::Asset gltf;
+
+    auto type = fastgltf::determineGltfFileType(&data);
+    if (type == fastgltf::GltfType::glTF) {
+        auto load = parser.loadGLTF(&data, path.parent_path(), gltfOptions);
+        if (!load) {
+            fprintf(stderr, "Failed to load %s: %d\n", path.string().c_str(), fastgltf::to_underlying(load.error()));
+            return false;
+        }
+        gltf = std::move(load.get());
+    } else if (type == fastgltf::GltfType::GLB) {
+        auto load = parser.loadBinaryGLTF(&data, path.parent_path(), gltfOptions);
+        if (!load) {
+            fprintf(stderr, "Failed to load %s: %d\n", path.string().c_str(), fastgltf::to_underlying(load.error()));
+            return false;
+        }
+        gltf = std::move(load.get());
+    } else {
+        fprintf(stderr, "%s is not a gltf file\n", path.string().c_str());
+        return false;
+    }
+
+    for (fastgltf::Mesh& gltfMesh : gltf.meshes) {
+        for (auto&& p : gltfMesh.primitives) {
+            if (!p.indicesAccessor.has_value()) {
+                fprintf(stderr, "Skipping a primitive of %s without indices\n", gltfMesh.name.c_str());
+                continue;
+            }
+
+            Submesh submesh;
+            submesh.firstIndex = uint32_t(mesh.indices.size());
+            submesh.materialSlot = p.materialIndex.has_value() ? uint32_t(p.materialIndex.value()) : 0;
+
+            size_t firstVertex = mesh.vertices.size();
+
+            // load vertex positions
+            {
+                fastgltf::Accessor& posAccessor = gltf.accessors[p.findAttribute("POSITION")->second];
+                mesh.vertices.resize(firstVertex + posAccessor.count);
+
+                fastgltf::iterateAccessorWithIndex<glm::vec3>(gltf, posAccessor,
+                    [&](glm::vec3 v, size_t index) {
+                        mesh.vertices[firstVertex + index] = make_vertex(v, glm::vec3(0.f), glm::vec2(0.f), glm::vec4(1.f));
+                    });
+            }
+
+            // load indexes
+            {
+                fastgltf::Accessor& indexaccessor = gltf.accessors[p.indicesAccessor.value()];
+                mesh.indices.reserve(mesh.indices.size() + indexaccessor.count);
+
+                fastgltf::iterateAccessor<std::uint32_t>(gltf, indexaccessor,
+                    [&](std::uint32_t idx) {
+                        mesh.indices.push_back(uint32_t(idx + firstVertex));
+                    });
+            }
+
+            // load vertex normals
+            auto normals = p.findAttribute("NORMAL");
+            if (normals != p.attributes.end()) {
+                fastgltf::iterateAccessorWithIndex<glm::vec3>(gltf, gltf.accessors[(*normals).second],
+                    [&](glm::vec3 v, size_t index) {
+                        MeshFileVertex& vertex = mesh.vertices[firstVertex + index];
+                        vertex.normal[0] = v.x;
+                        vertex.normal[1] = v.y;
+                        vertex.normal[2] = v.z;
+                    });
+            } else {
+                generate_normals(mesh, firstVertex, submesh.firstIndex);
+            }
+
+            // load UVs
+            auto uv = p.findAttribute("TEXCOORD_0");
+            if (uv != p.attributes.end()) {
+                fastgltf::iterateAccessorWithIndex<glm::vec2>(gltf, gltf.accessors[(*uv).second],
+                    [&](glm::vec2 v, size_t index) {
+                        mesh.vertices[firstVertex + index].uv_x = v.x;
+                        mesh.vertices[firstVertex + index].uv_y = v.y;
+                    });
+            }
+
+            // load vertex colors
+            auto colors = p.findAttribute("COLOR_0");
+            if (colors != p.attributes.end()) {
+                fastgltf::iterateAccessorWithIndex<glm::vec4>(gltf, gltf.accessors[(*colors).second],
+                    [&](glm::vec4 v, size_t index) {
+                        memcpy(mesh.vertices[firstVertex + index].color, &v, sizeof(float) * 4);
+                    });
+            }
+
+            submesh.indexCount = uint32_t(mesh.indices.size()) - submesh.firstIndex;
+            mesh.submeshes.push_back(submesh);
+        }
+    }
+
+    return true;
+}
+
+static MeshFileBounds compute_bounds(const MeshData& mesh, uint32_t firstIndex, uint32_t indexCount)
+{
+    MeshFileBounds bounds {};
+    if (indexCount == 0) {
+        return bounds;
+    }
+
+    glm::vec3 minpos = position_of(mesh.vertices[mesh.indices[firstIndex]]);
+    glm::vec3 maxpos = minpos;
+    for (uint32_t i = firstIndex; i < firstIndex + indexCount; i++) {
+        glm::vec3 p = position_of(mesh.vertices[mesh.indices[i]]);
+        minpos = glm::min(minpos, p);
+        maxpos = glm::max(maxpos, p);
+    }
+
+    glm::vec3 origin = (maxpos + minpos) / 2.f;
+    glm::vec3 extents = (maxpos - minpos) / 2.f;
+
+    // sphere around the box center that holds every vertex, tighter than the box corner
+    float radius = 0.f;
+    for (uint32_t i = firstIndex; i < firstIndex + indexCount; i++) {
+        radius = std::max(radius, glm::length(position_of(mesh.vertices[mesh.indices[i]]) - origin));
+    }
+
+    memcpy(bounds.origin, &origin, sizeof(bounds.origin));
+    memcpy(bounds.extents, &extents, sizeof(bounds.extents));
+    bounds.sphereRadius = radius;
+    return bounds;
+}
+
+static bool write_mesh(const std::filesystem::path& path, const MeshData& mesh, bool force32BitIndices)
+{
+    MeshFileHeader header {};
+    header.magic = MeshFileMagic;
+    header.version = MeshFileVersion;
+    header.vertexCount = uint32_t(mesh.vertices.size());
+    header.indexCount = uint32_t(mesh.indices.size());
+    header.indexSize = (!force32BitIndices && mesh.vertices.size() <= UINT16_MAX) ? 2 : 4;
+    header.submeshCount = uint32_t(mesh.submeshes.size());
+    header.submeshOffset = MeshFileAlign(sizeof(MeshFileHeader));
+    header.vertexOffset = MeshFileAlign(header.submeshOffset + header.submeshCount * sizeof(MeshFileSubmesh));
+    header.indexOffset = MeshFileAlign(header.vertexOffset + header.vertexCount * sizeof(MeshFileVertex));
+    header.fileSize = header.indexOffset + uint64_t(header.indexCount) * header.indexSize;
+    header.bounds = compute_bounds(mesh, 0, header.indexCount);
+
+    std::vector<uint8_t> file(header.fileSize, 0);
+    memcpy(file.data(), &header, sizeof(header));
+
+    MeshFileSubmesh* submeshes = reinterpret_cast<MeshFileSubmesh*>(file.data() + header.submeshOffset);
+    for (size_t i = 0; i < mesh.submeshes.size(); i++) {
+        const Submesh& s = mesh.submeshes[i];
+        submeshes[i] = MeshFileSubmesh {};
+        submeshes[i].firstIndex = s.firstIndex;
+        submeshes[i].indexCount = s.indexCount;
+        submeshes[i].materialSlot = s.materialSlot;
+        submeshes[i].bounds = compute_bounds(mesh, s.firstIndex, s.indexCount);
+    }
+
+    memcpy(file.data() + header.vertexOffset, mesh.vertices.data(), mesh.vertices.size() * sizeof(MeshFileVertex));
+
+    if (header.indexSize == 2) {
+        uint16_t* indices = reinterpret_cast<uint16_t*>(file.data() + header.indexOffset);
+        for (size_t i = 0; i < mesh.indices.size(); i++) {
+            indices[i] = uint16_t(mesh.indices[i]);
+        }
+    } else {
+        memcpy(file.data() + header.indexOffset, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out.write(reinterpret_cast<const char*>(file.data()), std::streamsize(file.size()))) {
+        fprintf(stderr, "Failed to write %s\n", path.string().c_str());
+        return false;
+    }
+
+    printf("%s: %u vertices, %u indices (%u bit), %u submeshes\n", path.string().c_str(), header.vertexCount,
+        header.indexCount, header.indexSize * 8, header.submeshCount);
+    return true;
+}
+
+static void optimize_mesh(MeshData& mesh)
+{
+    float before = AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+
+    for (const Submesh& submesh : mesh.submeshes) {
+        OptimizeVertexCache(&mesh.indices[submesh.firstIndex], submesh.indexCount, mesh.vertices.size());
+    }
+
+    size_t vertexCount = OptimizeVertexFetch(mesh.vertices.data(), mesh.vertices.size(), sizeof(MeshFileVertex),
+        mesh.indices.data(), mesh.indices.size());
+    mesh.vertices.resize(vertexCount);
+
+    float after = AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+    printf("vertex cache: %.3f -> %.3f misses per triangle\n", before, after);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "usage: MeshConverter <input.obj|input.gltf|input.glb> <output.qmesh> [--32bit-indices] [--no-optimize]\n");
+        return 1;
+    }
+
+    std::filesystem::path input = argv[1];
+    std::filesystem::path output = argv[2];
+    bool force32BitIndices = false;
+    bool optimize = true;
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--32bit-indices") == 0) {
+            force32BitIndices = true;
+        } else if (strcmp(argv[i], "--no-optimize") == 0) {
+            optimize = false;
+        }
+    }
+
+    std::string extension = input.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+
+    MeshData mesh;
+    bool loaded = false;
+    if (extension == ".obj") {
+        loaded = load_obj(input, mesh);
+    } else if (extension == ".gltf" || extension == ".glb") {
+        loaded = load_gltf(input, mesh);
+    } else {
+        fprintf(stderr, "Unsupported input format %s\n", extension.c_str());
+        return 1;
+    }
+
+    if (!loaded) {
+        return 1;
+    }
+    if (mesh.indices.empty()) {
+        fprintf(stderr, "%s has no triangles\n", input.string().c_str());
+        return 1;
+    }
+
+    if (optimize) {
+        optimize_mesh(mesh);
+    }
+
+    return write_mesh(output, mesh, force32BitIndices) ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+// Times the engine's OBJ loader against tinyobjloader with the usual
+// unordered_map vertex deduplication on top.
+//
+//   ObjBenchmark [file.obj] [runs]
+//
+// Without a file a grid of about one million triangles is written to
+// benchmark_grid.obj and loaded.
+
+#include <Core/Log.h>
+#include <Core/ThreadPool.h>
+#include <Renderer/VulkanBackend/obj_loader.h>
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+using namespace Quasar;
+using namespace Quasar::Renderer;
+
+// 708 x 708 quads, 1002528 triangles
+constexpr int GridSize = 709;
+
+static void write_grid(const char* path)
+{
+    std::ofstream out(path);
+    out << "o grid\n";
+    for (int y = 0; y < GridSize; y++) {
+        for (int x = 0; x < GridSize; x++) {
+            float fx = float(x) / (GridSize - 1), fy = float(y) / (GridSize - 1);
+            out << "v " << fx * 100.f << " " << std::sin(fx * 20.f) * std::cos(fy * 20.f) << " " << fy * 100.f << "\n";
+            out << "vt " << fx << " " << fy << "\n";
+            out << "vn 0 1 0\n";
+        }
+    }
+    for (int y = 0; y + 1 < GridSize; y++) {
+        for (int x = 0; x + 1 < GridSize; x++) {
+            int i = y * GridSize + x + 1;
+            int c[4] = { i, i + 1, i + GridSize + 1, i + GridSize };
+            out << "f";
+            for (int k : c) {
+                out << " " << k << "/" << k << "/" << k;
+            }
+            out << "\n";
+        }
+    }
+}
+
+struct TinyVertexKey {
+    int position, uv, normal;
+    bool operator==(const TinyVertexKey& other) const = default;
+};
+
+struct TinyVertexKeyHash {
+    size_t operator()(const TinyVertexKey& k) const
+    {
+        return std::hash<int>()(k.position) ^ (std::hash<int>()(k.uv) << 1) ^ (std::hash<int>()(k.normal) << 2);
+    }
+};
+
+static size_t load_tinyobj(const char* path, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+{
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn, err;
+    if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path)) {
+        fprintf(stderr, "tinyobjloader failed: %s\n", err.c_str());
+        return 0;
+    }
+
+    std::unordered_map<TinyVertexKey, uint32_t, TinyVertexKeyHash> unique;
+    for (const tinyobj::shape_t& shape : shapes) {
+        for (const tinyobj::index_t& index : shape.mesh.indices) {
+            TinyVertexKey key { index.vertex_index, index.texcoord_index, index.normal_index };
+            auto [it, inserted] = unique.try_emplace(key, uint32_t(vertices.size()));
+            if (inserted) {
+                Vertex v {};
+                v.position = { attrib.vertices[3 * index.vertex_index], attrib.vertices[3 * index.vertex_index + 1], attrib.vertices[3 * index.vertex_index + 2] };
+                if (index.normal_index >= 0) {
+                    v.normal = { attrib.normals[3 * index.normal_index], attrib.normals[3 * index.normal_index + 1], attrib.normals[3 * index.normal_index + 2] };
+                }
+                if (index.texcoord_index >= 0) {
+                    v.uv_x = attrib.texcoords[2 * index.texcoord_index];
+                    v.uv_y = 1.f - attrib.texcoords[2 * index.texcoord_index + 1];
+                }
+                v.color = glm::vec4(1.f);
+                vertices.push_back(v);
+            }
+            indices.push_back(it->second);
+        }
+    }
+    return indices.size() / 3;
+}
+
+template<typename F>
+static double best_of(int runs, F&& function)
+{
+    double best = 1e30;
+    for (int i = 0; i < runs; i++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        function();
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    Log::Init();
+    ThreadPool::Init();
+
+    const char* path = argc > 1 ? argv[1] : "benchmark_grid.obj";
+    int runs = argc > 2 ? std::max(1, atoi(argv[2])) : 5;
+    if (argc <= 1) {
+        write_grid(path);
+    }
+
+    size_t triangles = 0, vertexCount = 0;
+    double quasar = best_of(runs, [&]() {
+        std::optional<ObjMesh> mesh = load_obj(path);
+        triangles = mesh ? mesh->indices.size() / 3 : 0;
+        vertexCount = mesh ? mesh->vertices.size() : 0;
+    });
+    printf("load_obj:       %8.1f ms  %zu triangles, %zu vertices, %u worker threads\n", quasar, triangles, vertexCount,
+        QS_THREAD_POOL.GetThreadCount());
+
+    double tiny = best_of(runs, [&]() {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        triangles = load_tinyobj(path, vertices, indices);
+        vertexCount = vertices.size();
+    });
+    printf("tinyobjloader:  %8.1f ms  %zu triangles, %zu vertices\n", tiny, triangles, vertexCount);
+    printf("speedup:        %8.2fx\n", tiny / quasar);
+
+    QS_THREAD_POOL.Shutdown();
+    Log::Shutdown();
+    return 0;
+}
@@ -0,0 +1,257 @@
+// Packs files into one .pak archive for the engine to mount, see
+// Quasar/src/Core/PakFormat.h.
+//
+//   PakBuilder <output.pak> <file|directory>... [--compress none|lz4] [--exclude .ext]...
+//
+// Directories are packed recursively. Entries are named by the path as given,
+// which has to be relative to the directory the engine runs in, so packing
+// "Assets" from the project root gives "Assets/shaders/Builtin.Mesh.vert.spv".
+// Files with the same contents are stored once. With lz4, the default, an entry
+// is compressed when that saves at least an eighth of it, files that are
+// compressed already stay as they are.
+
+#include <Lz4.h>
+#include <PakFormat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Quasar;
+
+struct Options {
+    bool compress = true;
+    std::vector<std::string> excluded;
+};
+
+struct Source {
+    std::filesystem::path file;
+    std::string name;
+    uint64_t pathHash;
+};
+
+// a blob written so far, for finding duplicates
+struct Blob {
+    // the file it was read from, compared byte by byte on a hash match
+    size_t source;
+    uint64_t offset;
+    uint64_t storedSize;
+    PakCompression compression;
+};
+
+static bool read_file(const std::filesystem::path& path, std::vector<uint8_t>& bytes)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    bytes.resize(size_t(file.tellg()));
+    file.seekg(0);
+    return bool(file.read(reinterpret_cast<char*>(bytes.data()), std::streamsize(bytes.size())));
+}
+
+static bool is_excluded(const std::filesystem::path& path, const Options& options)
+{
+    std::string extension = path.extension().string();
+    return std::find(options.excluded.begin(), options.excluded.end(), extension) != options.excluded.end();
+}
+
+static void add_source(const std::filesystem::path& file, std::vector<Source>& sources)
+{
+    std::string name = PakNormalizePath(file.lexically_normal().generic_string());
+    sources.push_back({ file, name, PakPathHash(name) });
+}
+
+static bool collect(const std::filesystem::path& input, const std::filesystem::path& output, const Options& options,
+    std::vector<Source>& sources)
+{
+    std::error_code error;
+    if (input.is_absolute()) {
+        fprintf(stderr, "%s: paths are stored as given, they have to be relative\n", input.string().c_str());
+        return false;
+    }
+    if (std::filesystem::is_regular_file(input, error)) {
+        add_source(input, sources);
+        return true;
+    }
+    if (!std::filesystem::is_directory(input, error)) {
+        fprintf(stderr, "%s: no such file or directory\n", input.string().c_str());
+        return false;
+    }
+
+    for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(input, error)) {
+        if (!entry.is_regular_file() || is_excluded(entry.path(), options)
+            || std::filesystem::equivalent(entry.path(), output, error)) {
+            continue;
+        }
+        add_source(entry.path(), sources);
+    }
+    return !error;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "usage: PakBuilder <output.pak> <file|directory>... [--compress none|lz4] [--exclude .ext]...\n");
+        return 1;
+    }
+
+    std::filesystem::path output = argv[1];
+    std::vector<std::filesystem::path> inputs;
+    Options options;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--compress") == 0 && i + 1 < argc) {
+            std::string name = argv[++i];
+            if (name == "none" || name == "lz4") {
+                options.compress = name == "lz4";
+            } else {
+                fprintf(stderr, "Unknown compression %s\n", name.c_str());
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--exclude") == 0 && i + 1 < argc) {
+            options.excluded.push_back(argv[++i]);
+        } else {
+            inputs.push_back(argv[i]);
+        }
+    }
+
+    std::vector<Source> sources;
+    for (const std::filesystem::path& input : inputs) {
+        if (!collect(input, output, options, sources)) {
+            return 1;
+        }
+    }
+
+    // blobs in name order, so the files of a directory sit together
+    std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.name < b.name; });
+    sources.erase(std::unique(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.name == b.name; }),
+        sources.end());
+
+    // the table is sorted by hash, the names follow it in the same order
+    std::vector<size_t> order(sources.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sources[a].pathHash < sources[b].pathHash; });
+
+    std::vector<PakEntry> entries(sources.size());
+    std::vector<size_t> entryOf(sources.size());
+    std::string names;
+    for (size_t i = 0; i < order.size(); i++) {
+        const Source& source = sources[order[i]];
+        if (i > 0 && sources[order[i - 1]].pathHash == source.pathHash) {
+            fprintf(stderr, "%s and %s have the same path hash, rename one\n", sources[order[i - 1]].name.c_str(),
+                source.name.c_str());
+            return 1;
+        }
+        entries[i].pathHash = source.pathHash;
+        entries[i].nameOffset = uint32_t(names.size());
+        entries[i].nameLength = uint32_t(source.name.size());
+        entryOf[order[i]] = i;
+        names += source.name;
+    }
+
+    PakHeader header {};
+    header.magic = PakMagic;
+    header.version = PakVersion;
+    header.entryCount = uint32_t(entries.size());
+    header.entryOffset = sizeof(PakHeader);
+    header.namesOffset = header.entryOffset + entries.size() * sizeof(PakEntry);
+    header.namesSize = names.size();
+
+    // written next to the output and renamed over it, so a mounted pak is never half written
+    std::filesystem::path temporary = output;
+    temporary += ".tmp";
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        fprintf(stderr, "Could not write %s\n", temporary.string().c_str());
+        return 1;
+    }
+
+    // the tables are written last, once every entry knows its blob
+    uint64_t position = PakAlign(header.namesOffset + header.namesSize);
+    std::vector<char> zeros(PakAlignment, 0);
+    file.write(zeros.data(), std::streamsize(position));
+
+    std::multimap<std::pair<uint64_t, uint64_t>, Blob> blobs;
+    std::vector<uint8_t> bytes, other, compressed;
+    uint64_t totalSize = 0, duplicateSize = 0, storedSize = 0, paddingSize = 0;
+    for (size_t i = 0; i < sources.size(); i++) {
+        if (!read_file(sources[i].file, bytes)) {
+            fprintf(stderr, "Could not read %s\n", sources[i].file.string().c_str());
+            return 1;
+        }
+
+        PakEntry& entry = entries[entryOf[i]];
+        entry.contentHash = PakHash(bytes.data(), bytes.size());
+        entry.size = bytes.size();
+        totalSize += bytes.size();
+
+        const Blob* duplicate = nullptr;
+        auto range = blobs.equal_range({ entry.contentHash, entry.size });
+        for (auto it = range.first; it != range.second && !duplicate; it++) {
+            if (read_file(sources[it->second.source].file, other) && other == bytes) {
+                duplicate = &it->second;
+            }
+        }
+        if (duplicate) {
+            entry.offset = duplicate->offset;
+            entry.storedSize = duplicate->storedSize;
+            entry.compression = uint32_t(duplicate->compression);
+            duplicateSize += bytes.size();
+            continue;
+        }
+
+        const uint8_t* stored = bytes.data();
+        entry.storedSize = bytes.size();
+        entry.compression = uint32_t(PakCompression::None);
+        if (options.compress && !bytes.empty()) {
+            compressed.resize(Lz4CompressBound(bytes.size()));
+            size_t size = Lz4Compress(bytes.data(), bytes.size(), compressed.data(), compressed.size());
+            if (size > 0 && size <= bytes.size() - bytes.size() / 8) {
+                stored = compressed.data();
+                entry.storedSize = size;
+                entry.compression = uint32_t(PakCompression::LZ4);
+            }
+        }
+
+        uint64_t aligned = PakAlign(position);
+        file.write(zeros.data(), std::streamsize(aligned - position));
+        paddingSize += aligned - position;
+        entry.offset = aligned;
+        file.write(reinterpret_cast<const char*>(stored), std::streamsize(entry.storedSize));
+        position = aligned + entry.storedSize;
+        storedSize += entry.storedSize;
+
+        blobs.insert({ { entry.contentHash, entry.size },
+            Blob { i, entry.offset, entry.storedSize, PakCompression(entry.compression) } });
+    }
+
+    header.fileSize = position;
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), std::streamsize(entries.size() * sizeof(PakEntry)));
+    file.write(names.data(), std::streamsize(names.size()));
+    file.close();
+    if (!file) {
+        fprintf(stderr, "Could not write %s\n", temporary.string().c_str());
+        return 1;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, output, error);
+    if (error) {
+        fprintf(stderr, "Could not replace %s: %s\n", output.string().c_str(), error.message().c_str());
+        return 1;
+    }
+
+    printf("%s: %zu files, %zu blobs, %.2f MB -> %.2f MB (%.2f MB duplicates, %.2f MB alignment)\n",
+        output.string().c_str(), sources.size(), blobs.size(), totalSize / (1024.0 * 1024.0),
+        header.fileSize / (1024.0 * 1024.0), duplicateSize / (1024.0 * 1024.0), paddingSize / (1024.0 * 1024.0));
+    return 0;
+}
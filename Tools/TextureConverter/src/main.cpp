@@ -0,0 +1,360 @@
+// Converts images to block compressed KTX2 textures with their full mip chain,
+// see Quasar/src/Renderer/TextureFormat.h.
+//
+//   TextureConverter <input.png|input.jpg|directory> [output.ktx2] [--format auto|rgba8|bc1|bc3|bc5|bc7] [--srgb] [--force]
+//
+// A directory converts every image in it to a .ktx2 next to the source, skipping
+// the ones whose output is newer unless --force is given. The engine's texture
+// loader picks those up in place of the source. auto picks BC5 for normal maps,
+// named *_n or *_normal, and BC7 for everything else. Mips are box filtered on
+// the cpu, in linear space with --srgb, and every level is encoded on all cores.
+
+#include <BlockCompression.h>
+#include <TextureFormat.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Quasar;
+
+enum class FormatChoice {
+    Auto,
+    RGBA8,
+    BC1,
+    BC3,
+    BC5,
+    BC7,
+};
+
+struct Options {
+    FormatChoice format = FormatChoice::Auto;
+    bool srgb = false;
+    bool force = false;
+};
+
+static std::string lowercase(std::string s)
+{
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+    return s;
+}
+
+static bool is_image(const std::filesystem::path& path)
+{
+    std::string extension = lowercase(path.extension().string());
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+}
+
+static bool is_normal_map(const std::filesystem::path& path)
+{
+    std::string stem = lowercase(path.stem().string());
+    auto endsWith = [&](const char* suffix) {
+        size_t length = strlen(suffix);
+        return stem.size() >= length && stem.compare(stem.size() - length, length, suffix) == 0;
+    };
+    return endsWith("_n") || endsWith("_normal");
+}
+
+static TextureFormat pick_format(const std::filesystem::path& path, const Options& options)
+{
+    FormatChoice choice = options.format;
+    if (choice == FormatChoice::Auto) {
+        choice = is_normal_map(path) ? FormatChoice::BC5 : FormatChoice::BC7;
+    }
+
+    // normal maps are data, never sRGB
+    bool srgb = options.srgb && choice != FormatChoice::BC5;
+    switch (choice) {
+    case FormatChoice::RGBA8:
+        return srgb ? TextureFormat::RGBA8_SRGB : TextureFormat::RGBA8;
+    case FormatChoice::BC1:
+        return srgb ? TextureFormat::BC1_SRGB : TextureFormat::BC1;
+    case FormatChoice::BC3:
+        return srgb ? TextureFormat::BC3_SRGB : TextureFormat::BC3;
+    case FormatChoice::BC5:
+        return TextureFormat::BC5;
+    default:
+        return srgb ? TextureFormat::BC7_SRGB : TextureFormat::BC7;
+    }
+}
+
+static const char* format_name(TextureFormat format)
+{
+    switch (format) {
+    case TextureFormat::RGBA8: return "RGBA8";
+    case TextureFormat::RGBA8_SRGB: return "RGBA8 sRGB";
+    case TextureFormat::BC1: return "BC1";
+    case TextureFormat::BC1_SRGB: return "BC1 sRGB";
+    case TextureFormat::BC3: return "BC3";
+    case TextureFormat::BC3_SRGB: return "BC3 sRGB";
+    case TextureFormat::BC5: return "BC5";
+    case TextureFormat::BC7: return "BC7";
+    case TextureFormat::BC7_SRGB: return "BC7 sRGB";
+    }
+    return "unknown";
+}
+
+// one level, its block rows split evenly over the cores
+static std::vector<uint8_t> encode_level(TextureFormat format, const uint8_t* rgba, uint32_t width, uint32_t height)
+{
+    std::vector<uint8_t> out(TextureLevelSize(format, width, height));
+    if (!IsBlockCompressed(format)) {
+        memcpy(out.data(), rgba, out.size());
+        return out;
+    }
+
+    uint32_t rows = (height + 3) / 4;
+    uint32_t threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, rows);
+    uint32_t rowsPerThread = (rows + threadCount - 1) / threadCount;
+
+    std::vector<std::thread> threads;
+    for (uint32_t first = 0; first < rows; first += rowsPerThread) {
+        uint32_t count = std::min(rowsPerThread, rows - first);
+        threads.emplace_back([=, &out]() { CompressBlockRows(format, rgba, width, height, first, count, out.data()); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return out;
+}
+
+//> dfd
+// Khronos data format descriptor values, from khr_df.h
+constexpr uint32_t DfModelRGBSDA = 1;
+constexpr uint32_t DfModelBC1A = 128;
+constexpr uint32_t DfModelBC3 = 130;
+constexpr uint32_t DfModelBC5 = 132;
+constexpr uint32_t DfModelBC7 = 134;
+constexpr uint32_t DfPrimariesBT709 = 1;
+constexpr uint32_t DfTransferLinear = 1;
+constexpr uint32_t DfTransferSRGB = 2;
+constexpr uint32_t DfSampleLinear = 0x10;
+
+struct DfdSample {
+    uint32_t bitOffset;
+    uint32_t bitLength;
+    uint32_t channel;
+    uint32_t upper;
+};
+
+// the basic descriptor block of format, with the total size in front
+static std::vector<uint32_t> make_dfd(TextureFormat format)
+{
+    std::vector<DfdSample> samples;
+    uint32_t model;
+    switch (format) {
+    case TextureFormat::BC1:
+    case TextureFormat::BC1_SRGB:
+        model = DfModelBC1A;
+        samples = { { 0, 64, 15, ~0u } };
+        break;
+    case TextureFormat::BC3:
+    case TextureFormat::BC3_SRGB:
+        model = DfModelBC3;
+        samples = { { 0, 64, 15, ~0u }, { 64, 64, 0, ~0u } };
+        break;
+    case TextureFormat::BC5:
+        model = DfModelBC5;
+        samples = { { 0, 64, 0, ~0u }, { 64, 64, 1, ~0u } };
+        break;
+    case TextureFormat::BC7:
+    case TextureFormat::BC7_SRGB:
+        model = DfModelBC7;
+        samples = { { 0, 128, 0, ~0u } };
+        break;
+    default:
+        model = DfModelRGBSDA;
+        samples = { { 0, 8, 0, 255 }, { 8, 8, 1, 255 }, { 16, 8, 2, 255 }, { 24, 8, 15, 255 } };
+        break;
+    }
+
+    bool srgb = IsSrgb(format);
+    bool compressed = IsBlockCompressed(format);
+    uint32_t blockSize = 24 + 16 * uint32_t(samples.size());
+
+    std::vector<uint32_t> dfd;
+    dfd.push_back(4 + blockSize);
+    // vendor Khronos, basic descriptor type
+    dfd.push_back(0);
+    // version 1.3, then the block size
+    dfd.push_back(2 | blockSize << 16);
+    dfd.push_back(model | DfPrimariesBT709 << 8 | (srgb ? DfTransferSRGB : DfTransferLinear) << 16);
+    // texel block dimensions minus one
+    dfd.push_back(compressed ? (3 | 3 << 8) : 0);
+    // bytes per plane, one plane
+    dfd.push_back(TextureBlockSize(format));
+    dfd.push_back(0);
+
+    for (const DfdSample& sample : samples) {
+        // alpha stays linear in sRGB formats
+        uint32_t qualifiers = (srgb && sample.channel == 15) ? DfSampleLinear : 0;
+        dfd.push_back(sample.bitOffset | (sample.bitLength - 1) << 16 | (sample.channel | qualifiers) << 24);
+        dfd.push_back(0);
+        dfd.push_back(0);
+        dfd.push_back(sample.upper);
+    }
+    return dfd;
+}
+//< dfd
+
+static bool write_ktx2(const std::filesystem::path& path, TextureFormat format, uint32_t width, uint32_t height,
+    const std::vector<std::vector<uint8_t>>& levels)
+{
+    std::vector<uint32_t> dfd = make_dfd(format);
+
+    Ktx2Header header = {};
+    memcpy(header.identifier, Ktx2Identifier, sizeof(Ktx2Identifier));
+    header.vkFormat = uint32_t(format);
+    header.typeSize = 1;
+    header.pixelWidth = width;
+    header.pixelHeight = height;
+    header.faceCount = 1;
+    header.levelCount = uint32_t(levels.size());
+    header.dfdByteOffset = uint32_t(sizeof(Ktx2Header) + levels.size() * sizeof(Ktx2Level));
+    header.dfdByteLength = uint32_t(dfd.size() * sizeof(uint32_t));
+
+    // mips are stored smallest first, each aligned to the block size
+    const uint64_t alignment = IsBlockCompressed(format) ? TextureBlockSize(format) : 4;
+    std::vector<Ktx2Level> index(levels.size());
+    uint64_t offset = header.dfdByteOffset + header.dfdByteLength;
+    for (size_t i = levels.size(); i-- > 0;) {
+        offset = (offset + alignment - 1) / alignment * alignment;
+        index[i].byteOffset = offset;
+        index[i].byteLength = levels[i].size();
+        index[i].uncompressedByteLength = levels[i].size();
+        offset += levels[i].size();
+    }
+
+    std::vector<uint8_t> file(offset, 0);
+    memcpy(file.data(), &header, sizeof(header));
+    memcpy(file.data() + sizeof(header), index.data(), index.size() * sizeof(Ktx2Level));
+    memcpy(file.data() + header.dfdByteOffset, dfd.data(), header.dfdByteLength);
+    for (size_t i = 0; i < levels.size(); i++) {
+        memcpy(file.data() + index[i].byteOffset, levels[i].data(), levels[i].size());
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out.write(reinterpret_cast<const char*>(file.data()), std::streamsize(file.size()))) {
+        fprintf(stderr, "Failed to write %s\n", path.string().c_str());
+        return false;
+    }
+    return true;
+}
+
+static bool convert(const std::filesystem::path& input, const std::filesystem::path& output, const Options& options)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    int w = 0, h = 0, channels;
+    stbi_uc* pixels = stbi_load(input.string().c_str(), &w, &h, &channels, 4);
+    if (!pixels) {
+        fprintf(stderr, "Failed to load %s: %s\n", input.string().c_str(), stbi_failure_reason());
+        return false;
+    }
+
+    const uint32_t width = uint32_t(w), height = uint32_t(h);
+    const TextureFormat format = pick_format(input, options);
+
+    std::vector<std::vector<uint8_t>> levels;
+    std::vector<uint8_t> mip, next;
+    const uint8_t* source = pixels;
+    uint64_t compressedSize = 0, uncompressedSize = 0;
+
+    for (uint32_t level = 0; level < MipLevelCount(width, height); level++) {
+        uint32_t levelWidth = MipExtent(width, level), levelHeight = MipExtent(height, level);
+        if (level > 0) {
+            next.resize(size_t(levelWidth) * levelHeight * 4);
+            DownsampleLevel(source, MipExtent(width, level - 1), MipExtent(height, level - 1), IsSrgb(format), next.data());
+            mip.swap(next);
+            source = mip.data();
+        }
+
+        levels.push_back(encode_level(format, source, levelWidth, levelHeight));
+        compressedSize += levels.back().size();
+        uncompressedSize += uint64_t(levelWidth) * levelHeight * 4;
+    }
+    stbi_image_free(pixels);
+
+    if (!write_ktx2(output, format, width, height, levels)) {
+        return false;
+    }
+
+    long long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("%s: %s %ux%u, %zu mips, %.2f MB, %.2f MB as RGBA8 (%.0f%% saved), %lld ms\n", output.string().c_str(),
+        format_name(format), width, height, levels.size(), compressedSize / (1024.0 * 1024.0),
+        uncompressedSize / (1024.0 * 1024.0), 100.0 * (1.0 - double(compressedSize) / uncompressedSize), milliseconds);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: TextureConverter <input.png|input.jpg|directory> [output.ktx2] [--format auto|rgba8|bc1|bc3|bc5|bc7] [--srgb] [--force]\n");
+        return 1;
+    }
+
+    std::filesystem::path input = argv[1];
+    std::filesystem::path output;
+    Options options;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            std::string name = lowercase(argv[++i]);
+            if (name == "auto") {
+                options.format = FormatChoice::Auto;
+            } else if (name == "rgba8") {
+                options.format = FormatChoice::RGBA8;
+            } else if (name == "bc1") {
+                options.format = FormatChoice::BC1;
+            } else if (name == "bc3") {
+                options.format = FormatChoice::BC3;
+            } else if (name == "bc5") {
+                options.format = FormatChoice::BC5;
+            } else if (name == "bc7") {
+                options.format = FormatChoice::BC7;
+            } else {
+                fprintf(stderr, "Unknown format %s\n", name.c_str());
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--srgb") == 0) {
+            options.srgb = true;
+        } else if (strcmp(argv[i], "--force") == 0) {
+            options.force = true;
+        } else {
+            output = argv[i];
+        }
+    }
+
+    if (!std::filesystem::is_directory(input)) {
+        if (output.empty()) {
+            output = std::filesystem::path(input).replace_extension(".ktx2");
+        }
+        return convert(input, output, options) ? 0 : 1;
+    }
+
+    bool failed = false;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(input)) {
+        if (!entry.is_regular_file() || !is_image(entry.path())) {
+            continue;
+        }
+
+        std::filesystem::path target = std::filesystem::path(entry.path()).replace_extension(".ktx2");
+        std::error_code error;
+        if (!options.force && std::filesystem::exists(target, error)
+            && std::filesystem::last_write_time(target, error) >= entry.last_write_time()) {
+            continue;
+        }
+
+        failed |= !convert(entry.path(), target, options);
+    }
+    return failed ? 1 : 0;
+}
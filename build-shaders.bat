@@ -18,6 +18,30 @@ echo "Assets/shaders/Builtin.MaterialShader.frag.glsl -> Assets/shaders/Builtin.
 %vulkanSDKPath%\bin\glslc.exe -fshader-stage=frag Assets/shaders/Builtin.MaterialShader.frag.glsl -o Assets/shaders/Builtin.MaterialShader.frag.spv
 IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
 
+echo "Assets/shaders/Builtin.DepthPrepass.vert.glsl -> Assets/shaders/Builtin.DepthPrepass.vert.spv"
+%vulkanSDKPath%\bin\glslc.exe -fshader-stage=vert Assets/shaders/Builtin.DepthPrepass.vert.glsl -o Assets/shaders/Builtin.DepthPrepass.vert.spv
+IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
+
+echo "Assets/shaders/Builtin.DepthReduce.comp.glsl -> Assets/shaders/Builtin.DepthReduce.comp.spv"
+%vulkanSDKPath%\bin\glslc.exe -fshader-stage=comp Assets/shaders/Builtin.DepthReduce.comp.glsl -o Assets/shaders/Builtin.DepthReduce.comp.spv
+IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
+
+echo "Assets/shaders/Builtin.DrawCull.comp.glsl -> Assets/shaders/Builtin.DrawCull.comp.spv"
+%vulkanSDKPath%\bin\glslc.exe -fshader-stage=comp --target-env=vulkan1.3 Assets/shaders/Builtin.DrawCull.comp.glsl -o Assets/shaders/Builtin.DrawCull.comp.spv
+IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
+
+echo "Assets/shaders/Builtin.LightCluster.comp.glsl -> Assets/shaders/Builtin.LightCluster.comp.spv"
+%vulkanSDKPath%\bin\glslc.exe -fshader-stage=comp Assets/shaders/Builtin.LightCluster.comp.glsl -o Assets/shaders/Builtin.LightCluster.comp.spv
+IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
+
+echo "Assets/shaders/Builtin.Mesh.vert.glsl -> Assets/shaders/Builtin.Mesh.vert.spv"
+%vulkanSDKPath%\bin\glslc.exe -fshader-stage=vert Assets/shaders/Builtin.Mesh.vert.glsl -o Assets/shaders/Builtin.Mesh.vert.spv
+IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
+
+echo "Assets/shaders/Builtin.Mesh.frag.glsl -> Assets/shaders/Builtin.Mesh.frag.spv"
+%vulkanSDKPath%\bin\glslc.exe -fshader-stage=frag Assets/shaders/Builtin.Mesh.frag.glsl -o Assets/shaders/Builtin.Mesh.frag.spv
+IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
+
 @REM echo "Assets/shaders/Builtin.UIShader.vert.glsl -> Assets/shaders/Builtin.UIShader.vert.spv"
 @REM %vulkanSDKPath%\bin\glslc.exe -fshader-stage=vert Assets/shaders/Builtin.UIShader.vert.glsl -o Assets/shaders/Builtin.UIShader.vert.spv
 @REM IF %ERRORLEVEL% NEQ 0 (echo Error: %ERRORLEVEL% && exit)
@@ -25,6 +25,54 @@ then
 echo "Error:"$ERRORLEVEL && exit
 fi
 
+echo "Assets/shaders/Builtin.DepthPrepass.vert.glsl -> Assets/shaders/Builtin.DepthPrepass.vert.spv"
+$vulkanSDKPath/bin/glslc -fshader-stage=vert Assets/shaders/Builtin.DepthPrepass.vert.glsl -o Assets/shaders/Builtin.DepthPrepass.vert.spv
+ERRORLEVEL=$?
+if [ $ERRORLEVEL -ne 0 ]
+then
+echo "Error:"$ERRORLEVEL && exit
+fi
+
+echo "Assets/shaders/Builtin.DepthReduce.comp.glsl -> Assets/shaders/Builtin.DepthReduce.comp.spv"
+$vulkanSDKPath/bin/glslc -fshader-stage=comp Assets/shaders/Builtin.DepthReduce.comp.glsl -o Assets/shaders/Builtin.DepthReduce.comp.spv
+ERRORLEVEL=$?
+if [ $ERRORLEVEL -ne 0 ]
+then
+echo "Error:"$ERRORLEVEL && exit
+fi
+
+echo "Assets/shaders/Builtin.DrawCull.comp.glsl -> Assets/shaders/Builtin.DrawCull.comp.spv"
+$vulkanSDKPath/bin/glslc -fshader-stage=comp --target-env=vulkan1.3 Assets/shaders/Builtin.DrawCull.comp.glsl -o Assets/shaders/Builtin.DrawCull.comp.spv
+ERRORLEVEL=$?
+if [ $ERRORLEVEL -ne 0 ]
+then
+echo "Error:"$ERRORLEVEL && exit
+fi
+
+echo "Assets/shaders/Builtin.LightCluster.comp.glsl -> Assets/shaders/Builtin.LightCluster.comp.spv"
+$vulkanSDKPath/bin/glslc -fshader-stage=comp Assets/shaders/Builtin.LightCluster.comp.glsl -o Assets/shaders/Builtin.LightCluster.comp.spv
+ERRORLEVEL=$?
+if [ $ERRORLEVEL -ne 0 ]
+then
+echo "Error:"$ERRORLEVEL && exit
+fi
+
+echo "Assets/shaders/Builtin.Mesh.vert.glsl -> Assets/shaders/Builtin.Mesh.vert.spv"
+$vulkanSDKPath/bin/glslc -fshader-stage=vert Assets/shaders/Builtin.Mesh.vert.glsl -o Assets/shaders/Builtin.Mesh.vert.spv
+ERRORLEVEL=$?
+if [ $ERRORLEVEL -ne 0 ]
+then
+echo "Error:"$ERRORLEVEL && exit
+fi
+
+echo "Assets/shaders/Builtin.Mesh.frag.glsl -> Assets/shaders/Builtin.Mesh.frag.spv"
+$vulkanSDKPath/bin/glslc -fshader-stage=frag Assets/shaders/Builtin.Mesh.frag.glsl -o Assets/shaders/Builtin.Mesh.frag.spv
+ERRORLEVEL=$?
+if [ $ERRORLEVEL -ne 0 ]
+then
+echo "Error:"$ERRORLEVEL && exit
+fi
+
 # echo "Assets/shaders/Builtin.UIShader.vert.glsl -> Assets/shaders/Builtin.UIShader.vert.spv"
 # $vulkanSDKPath/bin/glslc -fshader-stage=vert Assets/shaders/Builtin.UIShader.vert.glsl -o Assets/shaders/Builtin.UIShader.vert.spv
 # ERRORLEVEL=$?